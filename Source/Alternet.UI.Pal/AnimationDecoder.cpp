@@ -0,0 +1,543 @@
+#include "AnimationDecoder.h"
+#include "ImageEncoder.h"
+#include "Api/InputStream.h"
+#include "ManagedInputStream.h"
+
+namespace Alternet::UI
+{
+    AnimationDecoder::AnimationDecoder()
+    {
+    }
+
+    AnimationDecoder::~AnimationDecoder()
+    {
+    }
+
+    int64_t AnimationDecoder::GetCacheLimit()
+    {
+        return _cacheLimit;
+    }
+
+    void AnimationDecoder::SetCacheLimit(int64_t value)
+    {
+        _cacheLimit = std::max(value, (int64_t)0);
+        TrimCache();
+    }
+
+    bool AnimationDecoder::LoadFile(const NativeStringSpan& path)
+    {
+        Close();
+
+        if (!_file.Open(wxStr(path)))
+            return false;
+
+        _data = (const uint8_t*)_file.GetData();
+        _dataSize = (size_t)_file.GetSize();
+        return Load();
+    }
+
+    bool AnimationDecoder::LoadStream(void* stream)
+    {
+        Close();
+
+        InputStream inputStream(stream);
+        ManagedInputStream managedInputStream(&inputStream);
+
+        wxMemoryOutputStream memory;
+        managedInputStream.Read(memory);
+
+        _buffer.resize((size_t)memory.GetLength());
+        memory.CopyTo(_buffer.data(), _buffer.size());
+
+        _data = _buffer.data();
+        _dataSize = _buffer.size();
+        return Load();
+    }
+
+    void AnimationDecoder::Close()
+    {
+        ClearCache();
+
+        _file.Close();
+        _buffer.clear();
+        _data = nullptr;
+        _dataSize = 0;
+
+#if wxUSE_GIF
+        _gif.reset();
+#endif
+        _size = wxSize();
+        _frames.clear();
+        _headerOffset = 0;
+        _headerChunks.clear();
+    }
+
+    bool AnimationDecoder::IsOk()
+    {
+        return !_frames.empty();
+    }
+
+    int AnimationDecoder::GetFrameCount()
+    {
+        return (int)_frames.size();
+    }
+
+    SizeI AnimationDecoder::GetSize()
+    {
+        return SizeI(_size.x, _size.y);
+    }
+
+    int AnimationDecoder::GetFrameDelay(int index)
+    {
+        if (index < 0 || index >= (int)_frames.size())
+            return 0;
+        return _frames[index].Delay;
+    }
+
+    Image* AnimationDecoder::GetFrame(int index)
+    {
+        auto frame = Compose(index);
+        if (frame == nullptr)
+            return nullptr;
+
+        // The bitmap is kept with the frame, showing the frame again on the
+        // next loop doesn't convert it again.
+        if (!frame->Bitmap.IsOk())
+        {
+            frame->Bitmap = wxBitmap(frame->Image, 32);
+            TrimCache();
+        }
+
+        auto image = new Image();
+        image->SetBitmap(frame->Bitmap);
+        return image;
+    }
+
+    void* AnimationDecoder::GetFrameImage(int index)
+    {
+        auto frame = Compose(index);
+        if (frame == nullptr)
+            return nullptr;
+
+        // Copied, the pixels of the generic image can be changed in place.
+        return new GenericImage(frame->Image.Copy());
+    }
+
+    int64_t AnimationDecoder::GetCachedBytes()
+    {
+        int64_t result = 0;
+        for (auto& item : _cache)
+            result += GetCachedSize(item.second);
+        return result;
+    }
+
+    void AnimationDecoder::ClearCache()
+    {
+        _cache.clear();
+        _cacheOrder.clear();
+        ResetCanvas();
+    }
+
+    bool AnimationDecoder::Load()
+    {
+        static const uint8_t pngSignature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+        auto loaded = false;
+
+        if (_dataSize >= sizeof(pngSignature) && memcmp(_data, pngSignature, sizeof(pngSignature)) == 0)
+        {
+            GenericImage::EnsureImageHandlersInitialized();
+            loaded = ParseApng();
+        }
+#if wxUSE_GIF
+        else if (_dataSize >= 6 && memcmp(_data, "GIF8", 4) == 0)
+            loaded = ParseGif();
+#endif
+
+        if (!loaded || _frames.empty() || _size.x <= 0 || _size.y <= 0)
+        {
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+#if wxUSE_GIF
+    bool AnimationDecoder::ParseGif()
+    {
+        // The decoder keeps the frames as palette indices, composing a frame
+        // only converts one of them.
+        wxMemoryInputStream stream(_data, _dataSize);
+        _gif.reset(new wxGIFDecoder());
+        if (_gif->LoadGIF(stream) != wxGIF_OK)
+            return false;
+
+        _size = _gif->GetAnimationSize();
+
+        for (unsigned int i = 0; i < _gif->GetFrameCount(); i++)
+        {
+            Frame frame;
+            frame.Rect = wxRect(_gif->GetFramePosition(i), _gif->GetFrameSize(i));
+            frame.Delay = (int)_gif->GetDelay(i);
+
+            switch (_gif->GetDisposalMethod(i))
+            {
+            case wxANIM_TOBACKGROUND:
+                frame.Dispose = Disposal::Background;
+                break;
+            case wxANIM_TOPREVIOUS:
+                frame.Dispose = Disposal::Previous;
+                break;
+            default:
+                frame.Dispose = Disposal::None;
+                break;
+            }
+
+            _frames.push_back(frame);
+        }
+
+        return true;
+    }
+#endif
+
+    bool AnimationDecoder::ParseApng()
+    {
+        auto read32 = [this](size_t offset)
+        {
+            auto p = _data + offset;
+            return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+        };
+
+        auto read16 = [this](size_t offset)
+        {
+            return (uint32_t)((_data[offset] << 8) | _data[offset + 1]);
+        };
+
+        std::vector<std::pair<size_t, size_t>> imageData;
+        auto imageDataIsFrame = false;
+        auto hasImageData = false;
+        size_t position = 8;
+
+        while (position + 12 <= _dataSize)
+        {
+            auto length = (size_t)read32(position);
+            auto type = (const char*)_data + position + 4;
+            auto data = position + 8;
+
+            if (length > _dataSize - data - 4)
+                return false;
+
+            if (memcmp(type, "IHDR", 4) == 0)
+            {
+                if (length != 13)
+                    return false;
+
+                _headerOffset = data;
+                _size = wxSize((int)read32(data), (int)read32(data + 4));
+            }
+            else if (memcmp(type, "fcTL", 4) == 0)
+            {
+                if (length < 26)
+                    return false;
+
+                Frame frame;
+                frame.Rect = wxRect((int)read32(data + 12), (int)read32(data + 16),
+                    (int)read32(data + 4), (int)read32(data + 8));
+
+                auto numerator = read16(data + 20);
+                auto denominator = read16(data + 22);
+                frame.Delay = (int)(numerator * 1000 / (denominator == 0 ? 100 : denominator));
+
+                auto dispose = _data[data + 24];
+                frame.Dispose = dispose == 1 ? Disposal::Background
+                    : dispose == 2 ? Disposal::Previous : Disposal::None;
+                frame.Blend = _data[data + 25] == 1;
+
+                _frames.push_back(frame);
+            }
+            else if (memcmp(type, "IDAT", 4) == 0)
+            {
+                // The default image is the first frame when its frame control
+                // chunk comes before the image data.
+                if (!hasImageData)
+                    imageDataIsFrame = !_frames.empty();
+                hasImageData = true;
+                imageData.push_back({ data, length });
+            }
+            else if (memcmp(type, "fdAT", 4) == 0)
+            {
+                // Data follows the sequence number.
+                if (length > 4 && !_frames.empty())
+                    _frames.back().Data.push_back({ data + 4, length - 4 });
+            }
+            else if (memcmp(type, "IEND", 4) == 0)
+                break;
+            else if (!hasImageData && memcmp(type, "acTL", 4) != 0)
+                _headerChunks.push_back({ position, length + 12 });
+
+            position = data + length + 4;
+        }
+
+        if (_headerOffset == 0 || !hasImageData)
+            return false;
+
+        // Not animated, shown as one frame.
+        if (_frames.empty())
+        {
+            Frame frame;
+            frame.Rect = wxRect(_size);
+            _frames.push_back(frame);
+            imageDataIsFrame = true;
+        }
+
+        if (imageDataIsFrame)
+            _frames[0].Data = imageData;
+
+        // Disposal to previous of the first frame clears it.
+        if (_frames[0].Dispose == Disposal::Previous)
+            _frames[0].Dispose = Disposal::Background;
+
+        _frames.erase(std::remove_if(_frames.begin(), _frames.end(),
+            [](const Frame& frame) { return frame.Data.empty(); }), _frames.end());
+
+        return true;
+    }
+
+    bool AnimationDecoder::DecodeFrame(int index, wxImage& result)
+    {
+        // Errors are reported by the result, not logged.
+        wxLogNull noLog;
+
+#if wxUSE_GIF
+        if (_gif != nullptr)
+            return _gif->ConvertToImage(index, &result);
+#endif
+
+        return DecodeApngFrame(_frames[index], result);
+    }
+
+    bool AnimationDecoder::DecodeApngFrame(const Frame& frame, wxImage& result)
+    {
+        static const uint8_t pngSignature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+        // The frame is decoded by the PNG handler as a separate image: the
+        // header with the size of the frame, the shared chunks like the
+        // palette and the frame data as IDAT.
+        wxMemoryOutputStream png;
+        png.Write(pngSignature, sizeof(pngSignature));
+
+        uint8_t header[13];
+        memcpy(header, _data + _headerOffset, sizeof(header));
+        for (int i = 0; i < 4; i++)
+        {
+            header[i] = (uint8_t)(frame.Rect.width >> (24 - i * 8));
+            header[i + 4] = (uint8_t)(frame.Rect.height >> (24 - i * 8));
+        }
+        ImageEncoder::WriteChunk(png, "IHDR", header, sizeof(header));
+
+        for (auto& chunk : _headerChunks)
+            png.Write(_data + chunk.first, chunk.second);
+
+        size_t dataSize = 0;
+        for (auto& part : frame.Data)
+            dataSize += part.second;
+
+        std::vector<uint8_t> data;
+        data.reserve(dataSize);
+        for (auto& part : frame.Data)
+            data.insert(data.end(), _data + part.first, _data + part.first + part.second);
+
+        ImageEncoder::WriteChunk(png, "IDAT", data.data(), data.size());
+        ImageEncoder::WriteChunk(png, "IEND", nullptr, 0);
+
+        wxMemoryInputStream stream(png);
+        return result.LoadFile(stream, wxBITMAP_TYPE_PNG);
+    }
+
+    void AnimationDecoder::ResetCanvas()
+    {
+        _canvas = wxImage();
+        _previousCanvas = wxImage();
+        _canvasIndex = -1;
+    }
+
+    void AnimationDecoder::ClearRect(const wxRect& rect)
+    {
+        auto clipped = rect.Intersect(wxRect(_size));
+        if (clipped.IsEmpty())
+            return;
+
+        for (int y = clipped.y; y < clipped.GetBottom() + 1; y++)
+        {
+            auto offset = (size_t)y * _size.x + clipped.x;
+            memset(_canvas.GetData() + offset * 3, 0, (size_t)clipped.width * 3);
+            memset(_canvas.GetAlpha() + offset, 0, (size_t)clipped.width);
+        }
+    }
+
+    void AnimationDecoder::DrawFrame(const Frame& frame, const wxImage& image)
+    {
+        auto clipped = wxRect(frame.Rect.GetPosition(), image.GetSize()).Intersect(wxRect(_size));
+        if (clipped.IsEmpty())
+            return;
+
+        auto source = image.GetData();
+        auto sourceAlpha = image.GetAlpha();
+        auto hasMask = image.HasMask();
+        unsigned char maskRed = 0, maskGreen = 0, maskBlue = 0;
+        if (hasMask)
+            image.GetOrFindMaskColour(&maskRed, &maskGreen, &maskBlue);
+
+        auto target = _canvas.GetData();
+        auto targetAlpha = _canvas.GetAlpha();
+
+        for (int y = clipped.y; y < clipped.GetBottom() + 1; y++)
+        {
+            auto sourceOffset = (size_t)(y - frame.Rect.y) * image.GetWidth() + (clipped.x - frame.Rect.x);
+            auto targetOffset = (size_t)y * _size.x + clipped.x;
+
+            for (int x = 0; x < clipped.width; x++, sourceOffset++, targetOffset++)
+            {
+                auto s = source + sourceOffset * 3;
+                auto t = target + targetOffset * 3;
+
+                int alpha = 255;
+                if (sourceAlpha != nullptr)
+                    alpha = sourceAlpha[sourceOffset];
+                else if (hasMask && s[0] == maskRed && s[1] == maskGreen && s[2] == maskBlue)
+                    alpha = 0;
+
+                if (!frame.Blend || alpha == 255)
+                {
+                    t[0] = s[0];
+                    t[1] = s[1];
+                    t[2] = s[2];
+                    targetAlpha[targetOffset] = (uint8_t)alpha;
+                    continue;
+                }
+
+                if (alpha == 0)
+                    continue;
+
+                // Source over the canvas with straight alpha.
+                int canvasAlpha = targetAlpha[targetOffset] * (255 - alpha) / 255;
+                int resultAlpha = alpha + canvasAlpha;
+
+                for (int c = 0; c < 3; c++)
+                    t[c] = (uint8_t)((s[c] * alpha + t[c] * canvasAlpha) / resultAlpha);
+                targetAlpha[targetOffset] = (uint8_t)resultAlpha;
+            }
+        }
+    }
+
+    AnimationDecoder::CachedFrame* AnimationDecoder::Compose(int index)
+    {
+        if (index < 0 || index >= (int)_frames.size())
+            return nullptr;
+
+        auto cached = FindCached(index);
+        if (cached != nullptr)
+            return cached;
+
+        // Going back restarts from the nearest cached frame which doesn't
+        // need the canvas before it, or from the first frame.
+        if (index <= _canvasIndex || !_canvas.IsOk())
+        {
+            ResetCanvas();
+
+            for (int i = index - 1; i >= 0; i--)
+            {
+                auto it = _cache.find(i);
+                if (it != _cache.end() && _frames[i].Dispose != Disposal::Previous)
+                {
+                    _canvas = it->second.Image.Copy();
+                    _canvasIndex = i;
+                    break;
+                }
+            }
+
+            if (!_canvas.IsOk())
+            {
+                _canvas = wxImage(_size, true);
+                _canvas.SetAlpha();
+                memset(_canvas.GetAlpha(), 0, (size_t)_size.x * _size.y);
+            }
+        }
+
+        for (int i = _canvasIndex + 1; i <= index; i++)
+        {
+            if (_canvasIndex >= 0)
+            {
+                auto& drawn = _frames[_canvasIndex];
+                if (drawn.Dispose == Disposal::Background)
+                    ClearRect(drawn.Rect);
+                else if (drawn.Dispose == Disposal::Previous && _previousCanvas.IsOk())
+                    _canvas = _previousCanvas;
+            }
+
+            auto& frame = _frames[i];
+            _previousCanvas = frame.Dispose == Disposal::Previous ? _canvas.Copy() : wxImage();
+
+            wxImage image;
+            if (!DecodeFrame(i, image))
+            {
+                ResetCanvas();
+                return nullptr;
+            }
+
+            DrawFrame(frame, image);
+            _canvasIndex = i;
+
+            // Frames passed on the way are cached too, the animation is
+            // usually played in order.
+            AddCached(i, _canvas.Copy());
+        }
+
+        return FindCached(index);
+    }
+
+    AnimationDecoder::CachedFrame* AnimationDecoder::FindCached(int index)
+    {
+        auto it = _cache.find(index);
+        if (it == _cache.end())
+            return nullptr;
+
+        auto order = std::find(_cacheOrder.begin(), _cacheOrder.end(), index);
+        if (order != _cacheOrder.end() && order + 1 != _cacheOrder.end())
+        {
+            _cacheOrder.erase(order);
+            _cacheOrder.push_back(index);
+        }
+
+        return &it->second;
+    }
+
+    void AnimationDecoder::AddCached(int index, const wxImage& image)
+    {
+        _cache[index].Image = image;
+        _cacheOrder.erase(std::remove(_cacheOrder.begin(), _cacheOrder.end(), index), _cacheOrder.end());
+        _cacheOrder.push_back(index);
+        TrimCache();
+    }
+
+    int64_t AnimationDecoder::GetCachedSize(const CachedFrame& frame) const
+    {
+        // RGB with alpha, and the same again for the bitmap.
+        auto size = (int64_t)_size.x * _size.y * 4;
+        return frame.Bitmap.IsOk() ? size * 2 : size;
+    }
+
+    void AnimationDecoder::TrimCache()
+    {
+        // The most recently used frame is kept whatever the limit is.
+        auto total = GetCachedBytes();
+        while (total > _cacheLimit && _cacheOrder.size() > 1)
+        {
+            auto it = _cache.find(_cacheOrder.front());
+            total -= GetCachedSize(it->second);
+            _cache.erase(it);
+            _cacheOrder.erase(_cacheOrder.begin());
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "Common.h"
+#include "ApiTypes.h"
+#include "Object.h"
+#include "Image.h"
+#include "MappedFile.h"
+
+#if wxUSE_GIF
+#include <wx/gifdecod.h>
+#endif
+
+namespace Alternet::UI
+{
+    // Frames of animated GIF and APNG images. The file is kept open and
+    // frames are composed on demand, starting from the nearest composed
+    // frame before them, with the disposal and blending of each frame.
+    // Composed frames are cached up to CacheLimit bytes, so animations
+    // played in a loop are decoded once.
+    class AnimationDecoder : public Object
+    {
+#include "Api/AnimationDecoder.inc"
+    public:
+        static constexpr int64_t DefaultCacheLimit = 32 * 1024 * 1024;
+
+    private:
+        enum class Disposal
+        {
+            None,
+            Background,
+            Previous,
+        };
+
+        struct Frame
+        {
+            wxRect Rect;
+            int Delay = 0;
+            Disposal Dispose = Disposal::None;
+            bool Blend = true;
+            // APNG: offsets and lengths of the compressed data of the frame.
+            std::vector<std::pair<size_t, size_t>> Data;
+        };
+
+        struct CachedFrame
+        {
+            wxImage Image;
+            wxBitmap Bitmap;
+        };
+
+        bool Load();
+        bool ParseApng();
+#if wxUSE_GIF
+        bool ParseGif();
+#endif
+
+        bool DecodeFrame(int index, wxImage& result);
+        bool DecodeApngFrame(const Frame& frame, wxImage& result);
+        void DrawFrame(const Frame& frame, const wxImage& image);
+        void ClearRect(const wxRect& rect);
+        void ResetCanvas();
+
+        CachedFrame* Compose(int index);
+        CachedFrame* FindCached(int index);
+        void AddCached(int index, const wxImage& image);
+        void TrimCache();
+        int64_t GetCachedSize(const CachedFrame& frame) const;
+
+        MappedFile _file;
+        std::vector<uint8_t> _buffer;
+        const uint8_t* _data = nullptr;
+        size_t _dataSize = 0;
+
+#if wxUSE_GIF
+        std::unique_ptr<wxGIFDecoder> _gif;
+#endif
+        wxSize _size;
+        std::vector<Frame> _frames;
+        // APNG: offset of IHDR and the chunks before the image data which
+        // are copied into the PNG of every frame.
+        size_t _headerOffset = 0;
+        std::vector<std::pair<size_t, size_t>> _headerChunks;
+
+        // Canvas with frame _canvasIndex drawn and, when that frame is
+        // disposed to previous, the canvas before it was drawn.
+        wxImage _canvas;
+        wxImage _previousCanvas;
+        int _canvasIndex = -1;
+
+        std::map<int, CachedFrame> _cache;
+        std::vector<int> _cacheOrder;
+        int64_t _cacheLimit = DefaultCacheLimit;
+    };
+}
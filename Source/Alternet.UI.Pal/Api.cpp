@@ -31,6 +31,7 @@
 #include "Api/RichTextBox.Api.h"
 #include "Api/TextBox.Api.h"
 #include "Api/TextBoxTextAttr.Api.h"
+#include "Api/TextViewer.Api.h"
 #include "Api/TreeView.Api.h"
 #include "Api/MemoryFSHandler.Api.h"
 #include "Api/WebBrowser.Api.h"
@@ -41,10 +42,13 @@
 #include "Api/RadialGradientBrush.Api.h"
 #include "Api/SolidBrush.Api.h"
 #include "Api/TextureBrush.Api.h"
+#include "Api/AnimationDecoder.Api.h"
 #include "Api/GenericImage.Api.h"
 #include "Api/IconSet.Api.h"
 #include "Api/Image.Api.h"
+#include "Api/ImageBundle.Api.h"
 #include "Api/ImageList.Api.h"
+#include "Api/MappedImage.Api.h"
 #include "Api/DrawingContext.Api.h"
 #include "Api/Font.Api.h"
 #include "Api/Pen.Api.h"
@@ -0,0 +1,122 @@
+// <auto-generated> DO NOT MODIFY MANUALLY. Copyright (c) 2026 AlterNET Software.</auto-generated>
+
+#pragma once
+
+#include "AnimationDecoder.h"
+#include "ApiUtils.h"
+#include "Exceptions.h"
+
+using namespace Alternet::UI;
+
+ALTERNET_UI_API AnimationDecoder* AnimationDecoder_Create_()
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_Create_");
+    return MarshalExceptions<AnimationDecoder*>([&](){
+        return new AnimationDecoder();
+    });
+}
+
+ALTERNET_UI_API int64_t AnimationDecoder_GetCacheLimit_(AnimationDecoder* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_GetCacheLimit_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetCacheLimit();
+    });
+}
+
+ALTERNET_UI_API void AnimationDecoder_SetCacheLimit_(AnimationDecoder* obj, int64_t value)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_SetCacheLimit_");
+    MarshalExceptions<void>([&](){
+        obj->SetCacheLimit(value);
+    });
+}
+
+ALTERNET_UI_API c_bool AnimationDecoder_LoadFile_(AnimationDecoder* obj, NativeStringSpan* path)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_LoadFile_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->LoadFile(*path);
+    });
+}
+
+ALTERNET_UI_API c_bool AnimationDecoder_LoadStream_(AnimationDecoder* obj, void* stream)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_LoadStream_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->LoadStream(stream);
+    });
+}
+
+ALTERNET_UI_API void AnimationDecoder_Close_(AnimationDecoder* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_Close_");
+    MarshalExceptions<void>([&](){
+        obj->Close();
+    });
+}
+
+ALTERNET_UI_API c_bool AnimationDecoder_IsOk_(AnimationDecoder* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_IsOk_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->IsOk();
+    });
+}
+
+ALTERNET_UI_API int AnimationDecoder_GetFrameCount_(AnimationDecoder* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_GetFrameCount_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetFrameCount();
+    });
+}
+
+ALTERNET_UI_API SizeI_C AnimationDecoder_GetSize_(AnimationDecoder* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_GetSize_");
+    return MarshalExceptions<SizeI_C>([&](){
+        return obj->GetSize();
+    });
+}
+
+ALTERNET_UI_API int AnimationDecoder_GetFrameDelay_(AnimationDecoder* obj, int index)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_GetFrameDelay_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetFrameDelay(index);
+    });
+}
+
+ALTERNET_UI_API Image* AnimationDecoder_GetFrame_(AnimationDecoder* obj, int index)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_GetFrame_");
+    return MarshalExceptions<Image*>([&](){
+        return obj->GetFrame(index);
+    });
+}
+
+ALTERNET_UI_API void* AnimationDecoder_GetFrameImage_(AnimationDecoder* obj, int index)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_GetFrameImage_");
+    return MarshalExceptions<void*>([&](){
+        return obj->GetFrameImage(index);
+    });
+}
+
+ALTERNET_UI_API int64_t AnimationDecoder_GetCachedBytes_(AnimationDecoder* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_GetCachedBytes_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetCachedBytes();
+    });
+}
+
+ALTERNET_UI_API void AnimationDecoder_ClearCache_(AnimationDecoder* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("AnimationDecoder_ClearCache_");
+    MarshalExceptions<void>([&](){
+        obj->ClearCache();
+    });
+}
+
@@ -14,6 +14,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Application* Application_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Application_Create_");
     return MarshalExceptions<Application*>([&](){
         return new Application();
     });
@@ -21,6 +22,7 @@ ALTERNET_UI_API Application* Application_Create_()
 
 ALTERNET_UI_API Keyboard* Application_GetKeyboard_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetKeyboard_");
     return MarshalExceptions<Keyboard*>([&](){
         return obj->GetKeyboard();
     });
@@ -28,6 +30,7 @@ ALTERNET_UI_API Keyboard* Application_GetKeyboard_(Application* obj)
 
 ALTERNET_UI_API Mouse* Application_GetMouse_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetMouse_");
     return MarshalExceptions<Mouse*>([&](){
         return obj->GetMouse();
     });
@@ -35,6 +38,7 @@ ALTERNET_UI_API Mouse* Application_GetMouse_(Application* obj)
 
 ALTERNET_UI_API Clipboard* Application_GetClipboard_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetClipboard_");
     return MarshalExceptions<Clipboard*>([&](){
         return obj->GetClipboard();
     });
@@ -42,6 +46,7 @@ ALTERNET_UI_API Clipboard* Application_GetClipboard_(Application* obj)
 
 ALTERNET_UI_API c_bool Application_GetInUixmlPreviewerMode_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetInUixmlPreviewerMode_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetInUixmlPreviewerMode();
     });
@@ -49,6 +54,7 @@ ALTERNET_UI_API c_bool Application_GetInUixmlPreviewerMode_(Application* obj)
 
 ALTERNET_UI_API void Application_SetInUixmlPreviewerMode_(Application* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetInUixmlPreviewerMode_");
     MarshalExceptions<void>([&](){
         obj->SetInUixmlPreviewerMode(value);
     });
@@ -56,6 +62,7 @@ ALTERNET_UI_API void Application_SetInUixmlPreviewerMode_(Application* obj, c_bo
 
 ALTERNET_UI_API c_bool Application_GetInvokeRequired_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetInvokeRequired_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetInvokeRequired();
     });
@@ -63,6 +70,7 @@ ALTERNET_UI_API c_bool Application_GetInvokeRequired_(Application* obj)
 
 ALTERNET_UI_API void Application_SetGtkCss_(c_bool inject, NativeStringSpan* css)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetGtkCss_");
     MarshalExceptions<void>([&](){
         Application::SetGtkCss(inject, *css);
     });
@@ -70,6 +78,7 @@ ALTERNET_UI_API void Application_SetGtkCss_(c_bool inject, NativeStringSpan* css
 
 ALTERNET_UI_API PropertyUpdateResult Application_SetAppearance_(Application* obj, ApplicationAppearance appearance)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetAppearance_");
     return MarshalExceptions<PropertyUpdateResult>([&](){
         return obj->SetAppearance(appearance);
     });
@@ -77,6 +86,7 @@ ALTERNET_UI_API PropertyUpdateResult Application_SetAppearance_(Application* obj
 
 ALTERNET_UI_API void Application_GetEventIdentifiers_(int* eventIdentifiers, int eventIdentifiersCount)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetEventIdentifiers_");
     MarshalExceptions<void>([&](){
         Application::GetEventIdentifiers(eventIdentifiers, eventIdentifiersCount);
     });
@@ -84,6 +94,7 @@ ALTERNET_UI_API void Application_GetEventIdentifiers_(int* eventIdentifiers, int
 
 ALTERNET_UI_API NativeStringSpan_C Application_GetEventArgString_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetEventArgString_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetEventArgString();
     });
@@ -91,6 +102,7 @@ ALTERNET_UI_API NativeStringSpan_C Application_GetEventArgString_(Application* o
 
 ALTERNET_UI_API void Application_ThrowError_(int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_ThrowError_");
     MarshalExceptions<void>([&](){
         Application::ThrowError(value);
     });
@@ -98,6 +110,7 @@ ALTERNET_UI_API void Application_ThrowError_(int value)
 
 ALTERNET_UI_API void Application_SetSystemOptionInt_(NativeStringSpan* name, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetSystemOptionInt_");
     MarshalExceptions<void>([&](){
         Application::SetSystemOptionInt(*name, value);
     });
@@ -105,6 +118,7 @@ ALTERNET_UI_API void Application_SetSystemOptionInt_(NativeStringSpan* name, int
 
 ALTERNET_UI_API NativeStringSpan_C Application_GetName_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetName();
     });
@@ -112,6 +126,7 @@ ALTERNET_UI_API NativeStringSpan_C Application_GetName_(Application* obj)
 
 ALTERNET_UI_API void Application_SetName_(Application* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetName_");
     MarshalExceptions<void>([&](){
         obj->SetName(*value);
     });
@@ -119,6 +134,7 @@ ALTERNET_UI_API void Application_SetName_(Application* obj, NativeStringSpan* va
 
 ALTERNET_UI_API void Application_Run_(Application* obj, Window* window)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_Run_");
     MarshalExceptions<void>([&](){
         obj->Run(window);
     });
@@ -126,6 +142,7 @@ ALTERNET_UI_API void Application_Run_(Application* obj, Window* window)
 
 ALTERNET_UI_API NativeStringSpan_C Application_GetDisplayName_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetDisplayName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetDisplayName();
     });
@@ -133,6 +150,7 @@ ALTERNET_UI_API NativeStringSpan_C Application_GetDisplayName_(Application* obj)
 
 ALTERNET_UI_API NativeStringSpan_C Application_GetAppClassName_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetAppClassName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetAppClassName();
     });
@@ -140,6 +158,7 @@ ALTERNET_UI_API NativeStringSpan_C Application_GetAppClassName_(Application* obj
 
 ALTERNET_UI_API NativeStringSpan_C Application_GetVendorName_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetVendorName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetVendorName();
     });
@@ -147,6 +166,7 @@ ALTERNET_UI_API NativeStringSpan_C Application_GetVendorName_(Application* obj)
 
 ALTERNET_UI_API NativeStringSpan_C Application_GetVendorDisplayName_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetVendorDisplayName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetVendorDisplayName();
     });
@@ -154,6 +174,7 @@ ALTERNET_UI_API NativeStringSpan_C Application_GetVendorDisplayName_(Application
 
 ALTERNET_UI_API void Application_SetDisplayName_(Application* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetDisplayName_");
     MarshalExceptions<void>([&](){
         obj->SetDisplayName(*value);
     });
@@ -161,6 +182,7 @@ ALTERNET_UI_API void Application_SetDisplayName_(Application* obj, NativeStringS
 
 ALTERNET_UI_API void Application_SetAppClassName_(Application* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetAppClassName_");
     MarshalExceptions<void>([&](){
         obj->SetAppClassName(*value);
     });
@@ -168,6 +190,7 @@ ALTERNET_UI_API void Application_SetAppClassName_(Application* obj, NativeString
 
 ALTERNET_UI_API void Application_SetVendorName_(Application* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetVendorName_");
     MarshalExceptions<void>([&](){
         obj->SetVendorName(*value);
     });
@@ -175,6 +198,7 @@ ALTERNET_UI_API void Application_SetVendorName_(Application* obj, NativeStringSp
 
 ALTERNET_UI_API void Application_SetVendorDisplayName_(Application* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetVendorDisplayName_");
     MarshalExceptions<void>([&](){
         obj->SetVendorDisplayName(*value);
     });
@@ -182,6 +206,7 @@ ALTERNET_UI_API void Application_SetVendorDisplayName_(Application* obj, NativeS
 
 ALTERNET_UI_API void* Application_GetTopWindow_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetTopWindow_");
     return MarshalExceptions<void*>([&](){
         return obj->GetTopWindow();
     });
@@ -189,6 +214,7 @@ ALTERNET_UI_API void* Application_GetTopWindow_(Application* obj)
 
 ALTERNET_UI_API void Application_ExitMainLoop_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_ExitMainLoop_");
     MarshalExceptions<void>([&](){
         obj->ExitMainLoop();
     });
@@ -196,6 +222,7 @@ ALTERNET_UI_API void Application_ExitMainLoop_(Application* obj)
 
 ALTERNET_UI_API void Application_WakeUpIdle_()
 {
+    ALTERNET_UI_PERF_EXPORT("Application_WakeUpIdle_");
     MarshalExceptions<void>([&](){
         Application::WakeUpIdle();
     });
@@ -203,6 +230,7 @@ ALTERNET_UI_API void Application_WakeUpIdle_()
 
 ALTERNET_UI_API void Application_Exit_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_Exit_");
     MarshalExceptions<void>([&](){
         obj->Exit();
     });
@@ -210,6 +238,7 @@ ALTERNET_UI_API void Application_Exit_(Application* obj)
 
 ALTERNET_UI_API void Application_SuppressDiagnostics_(int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SuppressDiagnostics_");
     MarshalExceptions<void>([&](){
         Application::SuppressDiagnostics(flags);
     });
@@ -217,6 +246,7 @@ ALTERNET_UI_API void Application_SuppressDiagnostics_(int flags)
 
 ALTERNET_UI_API void Application_BeginInvoke_(Application* obj, PInvokeCallbackActionType action)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_BeginInvoke_");
     MarshalExceptions<void>([&](){
         obj->BeginInvoke(action);
     });
@@ -224,6 +254,7 @@ ALTERNET_UI_API void Application_BeginInvoke_(Application* obj, PInvokeCallbackA
 
 ALTERNET_UI_API void Application_ProcessPendingEvents_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_ProcessPendingEvents_");
     MarshalExceptions<void>([&](){
         obj->ProcessPendingEvents();
     });
@@ -231,6 +262,7 @@ ALTERNET_UI_API void Application_ProcessPendingEvents_(Application* obj)
 
 ALTERNET_UI_API c_bool Application_HasPendingEvents_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_HasPendingEvents_");
     return MarshalExceptions<c_bool>([&](){
         return obj->HasPendingEvents();
     });
@@ -238,6 +270,7 @@ ALTERNET_UI_API c_bool Application_HasPendingEvents_(Application* obj)
 
 ALTERNET_UI_API void* Application_GetDisplayMode_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetDisplayMode_");
     return MarshalExceptions<void*>([&](){
         return obj->GetDisplayMode();
     });
@@ -245,6 +278,7 @@ ALTERNET_UI_API void* Application_GetDisplayMode_(Application* obj)
 
 ALTERNET_UI_API c_bool Application_GetExitOnFrameDelete_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetExitOnFrameDelete_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetExitOnFrameDelete();
     });
@@ -252,6 +286,7 @@ ALTERNET_UI_API c_bool Application_GetExitOnFrameDelete_(Application* obj)
 
 ALTERNET_UI_API int Application_GetLayoutDirection_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetLayoutDirection_");
     return MarshalExceptions<int>([&](){
         return obj->GetLayoutDirection();
     });
@@ -259,6 +294,7 @@ ALTERNET_UI_API int Application_GetLayoutDirection_(Application* obj)
 
 ALTERNET_UI_API c_bool Application_GetUseBestVisual_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetUseBestVisual_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetUseBestVisual();
     });
@@ -266,6 +302,7 @@ ALTERNET_UI_API c_bool Application_GetUseBestVisual_(Application* obj)
 
 ALTERNET_UI_API c_bool Application_IsActive_(Application* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_IsActive_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsActive();
     });
@@ -273,6 +310,7 @@ ALTERNET_UI_API c_bool Application_IsActive_(Application* obj)
 
 ALTERNET_UI_API c_bool Application_SafeYield_(Application* obj, void* window, c_bool onlyIfNeeded)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SafeYield_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SafeYield(window, onlyIfNeeded);
     });
@@ -280,6 +318,7 @@ ALTERNET_UI_API c_bool Application_SafeYield_(Application* obj, void* window, c_
 
 ALTERNET_UI_API c_bool Application_SafeYieldFor_(Application* obj, void* window, int64_t eventsToProcess)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SafeYieldFor_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SafeYieldFor(window, eventsToProcess);
     });
@@ -287,6 +326,7 @@ ALTERNET_UI_API c_bool Application_SafeYieldFor_(Application* obj, void* window,
 
 ALTERNET_UI_API c_bool Application_SetDisplayMode_(Application* obj, void* videoMode)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetDisplayMode_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetDisplayMode(videoMode);
     });
@@ -294,6 +334,7 @@ ALTERNET_UI_API c_bool Application_SetDisplayMode_(Application* obj, void* video
 
 ALTERNET_UI_API void Application_SetExitOnFrameDelete_(Application* obj, c_bool flag)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetExitOnFrameDelete_");
     MarshalExceptions<void>([&](){
         obj->SetExitOnFrameDelete(flag);
     });
@@ -301,6 +342,7 @@ ALTERNET_UI_API void Application_SetExitOnFrameDelete_(Application* obj, c_bool
 
 ALTERNET_UI_API c_bool Application_SetNativeTheme_(Application* obj, NativeStringSpan* theme)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetNativeTheme_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetNativeTheme(*theme);
     });
@@ -308,6 +350,7 @@ ALTERNET_UI_API c_bool Application_SetNativeTheme_(Application* obj, NativeStrin
 
 ALTERNET_UI_API void Application_SetTopWindow_(Application* obj, void* window)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetTopWindow_");
     MarshalExceptions<void>([&](){
         obj->SetTopWindow(window);
     });
@@ -315,6 +358,7 @@ ALTERNET_UI_API void Application_SetTopWindow_(Application* obj, void* window)
 
 ALTERNET_UI_API void Application_SetUseBestVisual_(Application* obj, c_bool flag, c_bool forceTrueColor)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_SetUseBestVisual_");
     MarshalExceptions<void>([&](){
         obj->SetUseBestVisual(flag, forceTrueColor);
     });
@@ -322,11 +366,60 @@ ALTERNET_UI_API void Application_SetUseBestVisual_(Application* obj, c_bool flag
 
 ALTERNET_UI_API NativeStringSpan_C Application_GetCustomData_(Application* obj, NativeStringSpan* key)
 {
+    ALTERNET_UI_PERF_EXPORT("Application_GetCustomData_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetCustomData(*key);
     });
 }
 
+ALTERNET_UI_API NativeStringSpan_C Application_GetPerformanceCounters_()
+{
+    ALTERNET_UI_PERF_EXPORT("Application_GetPerformanceCounters_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return Application::GetPerformanceCounters();
+    });
+}
+
+ALTERNET_UI_API void Application_ResetPerformanceCounters_()
+{
+    ALTERNET_UI_PERF_EXPORT("Application_ResetPerformanceCounters_");
+    MarshalExceptions<void>([&](){
+        Application::ResetPerformanceCounters();
+    });
+}
+
+ALTERNET_UI_API void Application_StartPerformanceTrace_(int maxEvents)
+{
+    ALTERNET_UI_PERF_EXPORT("Application_StartPerformanceTrace_");
+    MarshalExceptions<void>([&](){
+        Application::StartPerformanceTrace(maxEvents);
+    });
+}
+
+ALTERNET_UI_API void Application_StopPerformanceTrace_()
+{
+    ALTERNET_UI_PERF_EXPORT("Application_StopPerformanceTrace_");
+    MarshalExceptions<void>([&](){
+        Application::StopPerformanceTrace();
+    });
+}
+
+ALTERNET_UI_API NativeStringSpan_C Application_GetPerformanceTraceJson_()
+{
+    ALTERNET_UI_PERF_EXPORT("Application_GetPerformanceTraceJson_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return Application::GetPerformanceTraceJson();
+    });
+}
+
+ALTERNET_UI_API void Application_GetStartupTimings_(int64_t* timings, int timingsCount)
+{
+    ALTERNET_UI_PERF_EXPORT("Application_GetStartupTimings_");
+    MarshalExceptions<void>([&](){
+        Application::GetStartupTimings(timings, timingsCount);
+    });
+}
+
 ALTERNET_UI_API void Application_SetEventCallback_(Application::ApplicationEventCallbackType callback)
 {
     Application::SetEventCallback(callback);
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Brush* Brush_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Brush_Create_");
     return MarshalExceptions<Brush*>([&](){
         return new Brush();
     });
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Button* Button_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Button_Create_");
     return MarshalExceptions<Button*>([&](){
         return new Button();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API Button* Button_Create_()
 
 ALTERNET_UI_API c_bool Button_GetImagesEnabled_()
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetImagesEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return Button::GetImagesEnabled();
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API c_bool Button_GetImagesEnabled_()
 
 ALTERNET_UI_API void Button_SetImagesEnabled_(c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetImagesEnabled_");
     MarshalExceptions<void>([&](){
         Button::SetImagesEnabled(value);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void Button_SetImagesEnabled_(c_bool value)
 
 ALTERNET_UI_API c_bool Button_GetExactFit_(Button* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetExactFit_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetExactFit();
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API c_bool Button_GetExactFit_(Button* obj)
 
 ALTERNET_UI_API void Button_SetExactFit_(Button* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetExactFit_");
     MarshalExceptions<void>([&](){
         obj->SetExactFit(value);
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API void Button_SetExactFit_(Button* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Button_GetHasBorder_(Button* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API c_bool Button_GetHasBorder_(Button* obj)
 
 ALTERNET_UI_API void Button_SetHasBorder_(Button* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API void Button_SetHasBorder_(Button* obj, c_bool value)
 
 ALTERNET_UI_API Image* Button_GetNormalImage_(Button* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetNormalImage_");
     return MarshalExceptions<Image*>([&](){
         return obj->GetNormalImage();
     });
@@ -67,6 +75,7 @@ ALTERNET_UI_API Image* Button_GetNormalImage_(Button* obj)
 
 ALTERNET_UI_API void Button_SetNormalImage_(Button* obj, Image* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetNormalImage_");
     MarshalExceptions<void>([&](){
         obj->SetNormalImage(value);
     });
@@ -74,6 +83,7 @@ ALTERNET_UI_API void Button_SetNormalImage_(Button* obj, Image* value)
 
 ALTERNET_UI_API Image* Button_GetHoveredImage_(Button* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetHoveredImage_");
     return MarshalExceptions<Image*>([&](){
         return obj->GetHoveredImage();
     });
@@ -81,6 +91,7 @@ ALTERNET_UI_API Image* Button_GetHoveredImage_(Button* obj)
 
 ALTERNET_UI_API void Button_SetHoveredImage_(Button* obj, Image* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetHoveredImage_");
     MarshalExceptions<void>([&](){
         obj->SetHoveredImage(value);
     });
@@ -88,6 +99,7 @@ ALTERNET_UI_API void Button_SetHoveredImage_(Button* obj, Image* value)
 
 ALTERNET_UI_API Image* Button_GetPressedImage_(Button* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetPressedImage_");
     return MarshalExceptions<Image*>([&](){
         return obj->GetPressedImage();
     });
@@ -95,6 +107,7 @@ ALTERNET_UI_API Image* Button_GetPressedImage_(Button* obj)
 
 ALTERNET_UI_API void Button_SetPressedImage_(Button* obj, Image* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetPressedImage_");
     MarshalExceptions<void>([&](){
         obj->SetPressedImage(value);
     });
@@ -102,6 +115,7 @@ ALTERNET_UI_API void Button_SetPressedImage_(Button* obj, Image* value)
 
 ALTERNET_UI_API Image* Button_GetDisabledImage_(Button* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetDisabledImage_");
     return MarshalExceptions<Image*>([&](){
         return obj->GetDisabledImage();
     });
@@ -109,6 +123,7 @@ ALTERNET_UI_API Image* Button_GetDisabledImage_(Button* obj)
 
 ALTERNET_UI_API void Button_SetDisabledImage_(Button* obj, Image* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetDisabledImage_");
     MarshalExceptions<void>([&](){
         obj->SetDisabledImage(value);
     });
@@ -116,6 +131,7 @@ ALTERNET_UI_API void Button_SetDisabledImage_(Button* obj, Image* value)
 
 ALTERNET_UI_API Image* Button_GetFocusedImage_(Button* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetFocusedImage_");
     return MarshalExceptions<Image*>([&](){
         return obj->GetFocusedImage();
     });
@@ -123,6 +139,7 @@ ALTERNET_UI_API Image* Button_GetFocusedImage_(Button* obj)
 
 ALTERNET_UI_API void Button_SetFocusedImage_(Button* obj, Image* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetFocusedImage_");
     MarshalExceptions<void>([&](){
         obj->SetFocusedImage(value);
     });
@@ -130,6 +147,7 @@ ALTERNET_UI_API void Button_SetFocusedImage_(Button* obj, Image* value)
 
 ALTERNET_UI_API c_bool Button_GetTextVisible_(Button* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetTextVisible_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetTextVisible();
     });
@@ -137,6 +155,7 @@ ALTERNET_UI_API c_bool Button_GetTextVisible_(Button* obj)
 
 ALTERNET_UI_API void Button_SetTextVisible_(Button* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetTextVisible_");
     MarshalExceptions<void>([&](){
         obj->SetTextVisible(value);
     });
@@ -144,6 +163,7 @@ ALTERNET_UI_API void Button_SetTextVisible_(Button* obj, c_bool value)
 
 ALTERNET_UI_API int Button_GetTextAlign_(Button* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_GetTextAlign_");
     return MarshalExceptions<int>([&](){
         return obj->GetTextAlign();
     });
@@ -151,6 +171,7 @@ ALTERNET_UI_API int Button_GetTextAlign_(Button* obj)
 
 ALTERNET_UI_API void Button_SetTextAlign_(Button* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetTextAlign_");
     MarshalExceptions<void>([&](){
         obj->SetTextAlign(value);
     });
@@ -158,6 +179,7 @@ ALTERNET_UI_API void Button_SetTextAlign_(Button* obj, int value)
 
 ALTERNET_UI_API void Button_SetImagePosition_(Button* obj, int dir)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetImagePosition_");
     MarshalExceptions<void>([&](){
         obj->SetImagePosition(dir);
     });
@@ -165,6 +187,7 @@ ALTERNET_UI_API void Button_SetImagePosition_(Button* obj, int dir)
 
 ALTERNET_UI_API void Button_SetImageMargins_(Button* obj, float x, float y)
 {
+    ALTERNET_UI_PERF_EXPORT("Button_SetImageMargins_");
     MarshalExceptions<void>([&](){
         obj->SetImageMargins(x, y);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Calendar* Calendar_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_Create_");
     return MarshalExceptions<Calendar*>([&](){
         return new Calendar();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API Calendar* Calendar_Create_()
 
 ALTERNET_UI_API c_bool Calendar_GetSundayFirst_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetSundayFirst_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetSundayFirst();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API c_bool Calendar_GetSundayFirst_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetSundayFirst_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetSundayFirst_");
     MarshalExceptions<void>([&](){
         obj->SetSundayFirst(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void Calendar_SetSundayFirst_(Calendar* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Calendar_GetMondayFirst_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetMondayFirst_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetMondayFirst();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API c_bool Calendar_GetMondayFirst_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetMondayFirst_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetMondayFirst_");
     MarshalExceptions<void>([&](){
         obj->SetMondayFirst(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void Calendar_SetMondayFirst_(Calendar* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Calendar_GetShowHolidays_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetShowHolidays_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowHolidays();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API c_bool Calendar_GetShowHolidays_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetShowHolidays_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetShowHolidays_");
     MarshalExceptions<void>([&](){
         obj->SetShowHolidays(value);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void Calendar_SetShowHolidays_(Calendar* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Calendar_GetNoYearChange_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetNoYearChange_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetNoYearChange();
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API c_bool Calendar_GetNoYearChange_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetNoYearChange_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetNoYearChange_");
     MarshalExceptions<void>([&](){
         obj->SetNoYearChange(value);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API void Calendar_SetNoYearChange_(Calendar* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Calendar_GetNoMonthChange_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetNoMonthChange_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetNoMonthChange();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API c_bool Calendar_GetNoMonthChange_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetNoMonthChange_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetNoMonthChange_");
     MarshalExceptions<void>([&](){
         obj->SetNoMonthChange(value);
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API void Calendar_SetNoMonthChange_(Calendar* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Calendar_GetSequentalMonthSelect_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetSequentalMonthSelect_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetSequentalMonthSelect();
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API c_bool Calendar_GetSequentalMonthSelect_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetSequentalMonthSelect_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetSequentalMonthSelect_");
     MarshalExceptions<void>([&](){
         obj->SetSequentalMonthSelect(value);
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API void Calendar_SetSequentalMonthSelect_(Calendar* obj, c_bool val
 
 ALTERNET_UI_API c_bool Calendar_GetShowSurroundWeeks_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetShowSurroundWeeks_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowSurroundWeeks();
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API c_bool Calendar_GetShowSurroundWeeks_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetShowSurroundWeeks_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetShowSurroundWeeks_");
     MarshalExceptions<void>([&](){
         obj->SetShowSurroundWeeks(value);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API void Calendar_SetShowSurroundWeeks_(Calendar* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Calendar_GetShowWeekNumbers_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetShowWeekNumbers_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowWeekNumbers();
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API c_bool Calendar_GetShowWeekNumbers_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetShowWeekNumbers_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetShowWeekNumbers_");
     MarshalExceptions<void>([&](){
         obj->SetShowWeekNumbers(value);
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API void Calendar_SetShowWeekNumbers_(Calendar* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Calendar_GetUseGeneric_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetUseGeneric_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetUseGeneric();
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API c_bool Calendar_GetUseGeneric_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetUseGeneric_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetUseGeneric_");
     MarshalExceptions<void>([&](){
         obj->SetUseGeneric(value);
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API void Calendar_SetUseGeneric_(Calendar* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Calendar_GetHasBorder_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API c_bool Calendar_GetHasBorder_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetHasBorder_(Calendar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API void Calendar_SetHasBorder_(Calendar* obj, c_bool value)
 
 ALTERNET_UI_API DateTime_C Calendar_GetValue_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetValue_");
     return MarshalExceptions<DateTime_C>([&](){
         return obj->GetValue();
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API DateTime_C Calendar_GetValue_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetValue_(Calendar* obj, DateTime* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetValue_");
     MarshalExceptions<void>([&](){
         obj->SetValue(*value);
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API void Calendar_SetValue_(Calendar* obj, DateTime* value)
 
 ALTERNET_UI_API DateTime_C Calendar_GetMinValue_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetMinValue_");
     return MarshalExceptions<DateTime_C>([&](){
         return obj->GetMinValue();
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API DateTime_C Calendar_GetMinValue_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetMinValue_(Calendar* obj, DateTime* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetMinValue_");
     MarshalExceptions<void>([&](){
         obj->SetMinValue(*value);
     });
@@ -185,6 +210,7 @@ ALTERNET_UI_API void Calendar_SetMinValue_(Calendar* obj, DateTime* value)
 
 ALTERNET_UI_API DateTime_C Calendar_GetMaxValue_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetMaxValue_");
     return MarshalExceptions<DateTime_C>([&](){
         return obj->GetMaxValue();
     });
@@ -192,6 +218,7 @@ ALTERNET_UI_API DateTime_C Calendar_GetMaxValue_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetMaxValue_(Calendar* obj, DateTime* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetMaxValue_");
     MarshalExceptions<void>([&](){
         obj->SetMaxValue(*value);
     });
@@ -199,6 +226,7 @@ ALTERNET_UI_API void Calendar_SetMaxValue_(Calendar* obj, DateTime* value)
 
 ALTERNET_UI_API c_bool Calendar_SetRange_(Calendar* obj, c_bool useMinValue, c_bool useMaxValue)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetRange_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetRange(useMinValue, useMaxValue);
     });
@@ -206,6 +234,7 @@ ALTERNET_UI_API c_bool Calendar_SetRange_(Calendar* obj, c_bool useMinValue, c_b
 
 ALTERNET_UI_API void Calendar_SetHolidayColors_(Calendar* obj, Color* colorFg, Color* colorBg)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetHolidayColors_");
     MarshalExceptions<void>([&](){
         obj->SetHolidayColors(*colorFg, *colorBg);
     });
@@ -213,6 +242,7 @@ ALTERNET_UI_API void Calendar_SetHolidayColors_(Calendar* obj, Color* colorFg, C
 
 ALTERNET_UI_API Color_C Calendar_GetHolidayColorFg_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetHolidayColorFg_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetHolidayColorFg();
     });
@@ -220,6 +250,7 @@ ALTERNET_UI_API Color_C Calendar_GetHolidayColorFg_(Calendar* obj)
 
 ALTERNET_UI_API Color_C Calendar_GetHolidayColorBg_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetHolidayColorBg_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetHolidayColorBg();
     });
@@ -227,6 +258,7 @@ ALTERNET_UI_API Color_C Calendar_GetHolidayColorBg_(Calendar* obj)
 
 ALTERNET_UI_API int Calendar_HitTest_(Calendar* obj, PointI* point)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_HitTest_");
     return MarshalExceptions<int>([&](){
         return obj->HitTest(*point);
     });
@@ -234,6 +266,7 @@ ALTERNET_UI_API int Calendar_HitTest_(Calendar* obj, PointI* point)
 
 ALTERNET_UI_API void Calendar_SetHeaderColors_(Calendar* obj, Color* colorFg, Color* colorBg)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetHeaderColors_");
     MarshalExceptions<void>([&](){
         obj->SetHeaderColors(*colorFg, *colorBg);
     });
@@ -241,6 +274,7 @@ ALTERNET_UI_API void Calendar_SetHeaderColors_(Calendar* obj, Color* colorFg, Co
 
 ALTERNET_UI_API Color_C Calendar_GetHeaderColorFg_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetHeaderColorFg_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetHeaderColorFg();
     });
@@ -248,6 +282,7 @@ ALTERNET_UI_API Color_C Calendar_GetHeaderColorFg_(Calendar* obj)
 
 ALTERNET_UI_API Color_C Calendar_GetHeaderColorBg_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetHeaderColorBg_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetHeaderColorBg();
     });
@@ -255,6 +290,7 @@ ALTERNET_UI_API Color_C Calendar_GetHeaderColorBg_(Calendar* obj)
 
 ALTERNET_UI_API void Calendar_SetHighlightColors_(Calendar* obj, Color* colorFg, Color* colorBg)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetHighlightColors_");
     MarshalExceptions<void>([&](){
         obj->SetHighlightColors(*colorFg, *colorBg);
     });
@@ -262,6 +298,7 @@ ALTERNET_UI_API void Calendar_SetHighlightColors_(Calendar* obj, Color* colorFg,
 
 ALTERNET_UI_API Color_C Calendar_GetHighlightColorFg_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetHighlightColorFg_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetHighlightColorFg();
     });
@@ -269,6 +306,7 @@ ALTERNET_UI_API Color_C Calendar_GetHighlightColorFg_(Calendar* obj)
 
 ALTERNET_UI_API Color_C Calendar_GetHighlightColorBg_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetHighlightColorBg_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetHighlightColorBg();
     });
@@ -276,6 +314,7 @@ ALTERNET_UI_API Color_C Calendar_GetHighlightColorBg_(Calendar* obj)
 
 ALTERNET_UI_API c_bool Calendar_AllowMonthChange_(Calendar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_AllowMonthChange_");
     return MarshalExceptions<c_bool>([&](){
         return obj->AllowMonthChange();
     });
@@ -283,6 +322,7 @@ ALTERNET_UI_API c_bool Calendar_AllowMonthChange_(Calendar* obj)
 
 ALTERNET_UI_API c_bool Calendar_EnableMonthChange_(Calendar* obj, c_bool enable)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_EnableMonthChange_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EnableMonthChange(enable);
     });
@@ -290,6 +330,7 @@ ALTERNET_UI_API c_bool Calendar_EnableMonthChange_(Calendar* obj, c_bool enable)
 
 ALTERNET_UI_API void Calendar_Mark_(Calendar* obj, int day, c_bool mark)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_Mark_");
     MarshalExceptions<void>([&](){
         obj->Mark(day, mark);
     });
@@ -297,6 +338,7 @@ ALTERNET_UI_API void Calendar_Mark_(Calendar* obj, int day, c_bool mark)
 
 ALTERNET_UI_API void* Calendar_GetAttr_(Calendar* obj, int day)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetAttr_");
     return MarshalExceptions<void*>([&](){
         return obj->GetAttr(day);
     });
@@ -304,6 +346,7 @@ ALTERNET_UI_API void* Calendar_GetAttr_(Calendar* obj, int day)
 
 ALTERNET_UI_API void Calendar_SetAttr_(Calendar* obj, int day, void* calendarDateAttr)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetAttr_");
     MarshalExceptions<void>([&](){
         obj->SetAttr(day, calendarDateAttr);
     });
@@ -311,6 +354,7 @@ ALTERNET_UI_API void Calendar_SetAttr_(Calendar* obj, int day, void* calendarDat
 
 ALTERNET_UI_API void Calendar_ResetAttr_(Calendar* obj, int day)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_ResetAttr_");
     MarshalExceptions<void>([&](){
         obj->ResetAttr(day);
     });
@@ -318,6 +362,7 @@ ALTERNET_UI_API void Calendar_ResetAttr_(Calendar* obj, int day)
 
 ALTERNET_UI_API void Calendar_EnableHolidayDisplay_(Calendar* obj, c_bool display)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_EnableHolidayDisplay_");
     MarshalExceptions<void>([&](){
         obj->EnableHolidayDisplay(display);
     });
@@ -325,6 +370,7 @@ ALTERNET_UI_API void Calendar_EnableHolidayDisplay_(Calendar* obj, c_bool displa
 
 ALTERNET_UI_API void Calendar_SetHoliday_(Calendar* obj, int day)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetHoliday_");
     MarshalExceptions<void>([&](){
         obj->SetHoliday(day);
     });
@@ -332,6 +378,7 @@ ALTERNET_UI_API void Calendar_SetHoliday_(Calendar* obj, int day)
 
 ALTERNET_UI_API void* Calendar_GetMarkDateAttr_()
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_GetMarkDateAttr_");
     return MarshalExceptions<void*>([&](){
         return Calendar::GetMarkDateAttr();
     });
@@ -339,6 +386,7 @@ ALTERNET_UI_API void* Calendar_GetMarkDateAttr_()
 
 ALTERNET_UI_API void Calendar_SetMarkDateAttr_(void* dateAttr)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_SetMarkDateAttr_");
     MarshalExceptions<void>([&](){
         Calendar::SetMarkDateAttr(dateAttr);
     });
@@ -346,6 +394,7 @@ ALTERNET_UI_API void Calendar_SetMarkDateAttr_(void* dateAttr)
 
 ALTERNET_UI_API void* Calendar_CreateDateAttr_(int border)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_CreateDateAttr_");
     return MarshalExceptions<void*>([&](){
         return Calendar::CreateDateAttr(border);
     });
@@ -353,6 +402,7 @@ ALTERNET_UI_API void* Calendar_CreateDateAttr_(int border)
 
 ALTERNET_UI_API void Calendar_DeleteDateAttr_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DeleteDateAttr_");
     MarshalExceptions<void>([&](){
         Calendar::DeleteDateAttr(handle);
     });
@@ -360,6 +410,7 @@ ALTERNET_UI_API void Calendar_DeleteDateAttr_(void* handle)
 
 ALTERNET_UI_API void Calendar_DateAttrSetTextColor_(void* handle, Color* colText)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrSetTextColor_");
     MarshalExceptions<void>([&](){
         Calendar::DateAttrSetTextColor(handle, *colText);
     });
@@ -367,6 +418,7 @@ ALTERNET_UI_API void Calendar_DateAttrSetTextColor_(void* handle, Color* colText
 
 ALTERNET_UI_API void Calendar_DateAttrSetBackgroundColor_(void* handle, Color* colBack)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrSetBackgroundColor_");
     MarshalExceptions<void>([&](){
         Calendar::DateAttrSetBackgroundColor(handle, *colBack);
     });
@@ -374,6 +426,7 @@ ALTERNET_UI_API void Calendar_DateAttrSetBackgroundColor_(void* handle, Color* c
 
 ALTERNET_UI_API void Calendar_DateAttrSetBorderColor_(void* handle, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrSetBorderColor_");
     MarshalExceptions<void>([&](){
         Calendar::DateAttrSetBorderColor(handle, *color);
     });
@@ -381,6 +434,7 @@ ALTERNET_UI_API void Calendar_DateAttrSetBorderColor_(void* handle, Color* color
 
 ALTERNET_UI_API void Calendar_DateAttrSetBorder_(void* handle, int border)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrSetBorder_");
     MarshalExceptions<void>([&](){
         Calendar::DateAttrSetBorder(handle, border);
     });
@@ -388,6 +442,7 @@ ALTERNET_UI_API void Calendar_DateAttrSetBorder_(void* handle, int border)
 
 ALTERNET_UI_API void Calendar_DateAttrSetHoliday_(void* handle, c_bool holiday)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrSetHoliday_");
     MarshalExceptions<void>([&](){
         Calendar::DateAttrSetHoliday(handle, holiday);
     });
@@ -395,6 +450,7 @@ ALTERNET_UI_API void Calendar_DateAttrSetHoliday_(void* handle, c_bool holiday)
 
 ALTERNET_UI_API c_bool Calendar_DateAttrHasTextColor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrHasTextColor_");
     return MarshalExceptions<c_bool>([&](){
         return Calendar::DateAttrHasTextColor(handle);
     });
@@ -402,6 +458,7 @@ ALTERNET_UI_API c_bool Calendar_DateAttrHasTextColor_(void* handle)
 
 ALTERNET_UI_API c_bool Calendar_DateAttrHasBackgroundColor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrHasBackgroundColor_");
     return MarshalExceptions<c_bool>([&](){
         return Calendar::DateAttrHasBackgroundColor(handle);
     });
@@ -409,6 +466,7 @@ ALTERNET_UI_API c_bool Calendar_DateAttrHasBackgroundColor_(void* handle)
 
 ALTERNET_UI_API c_bool Calendar_DateAttrHasBorderColor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrHasBorderColor_");
     return MarshalExceptions<c_bool>([&](){
         return Calendar::DateAttrHasBorderColor(handle);
     });
@@ -416,6 +474,7 @@ ALTERNET_UI_API c_bool Calendar_DateAttrHasBorderColor_(void* handle)
 
 ALTERNET_UI_API c_bool Calendar_DateAttrHasBorder_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return Calendar::DateAttrHasBorder(handle);
     });
@@ -423,6 +482,7 @@ ALTERNET_UI_API c_bool Calendar_DateAttrHasBorder_(void* handle)
 
 ALTERNET_UI_API c_bool Calendar_DateAttrIsHoliday_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrIsHoliday_");
     return MarshalExceptions<c_bool>([&](){
         return Calendar::DateAttrIsHoliday(handle);
     });
@@ -430,6 +490,7 @@ ALTERNET_UI_API c_bool Calendar_DateAttrIsHoliday_(void* handle)
 
 ALTERNET_UI_API Color_C Calendar_DateAttrGetTextColor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrGetTextColor_");
     return MarshalExceptions<Color_C>([&](){
         return Calendar::DateAttrGetTextColor(handle);
     });
@@ -437,6 +498,7 @@ ALTERNET_UI_API Color_C Calendar_DateAttrGetTextColor_(void* handle)
 
 ALTERNET_UI_API Color_C Calendar_DateAttrGetBackgroundColor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrGetBackgroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return Calendar::DateAttrGetBackgroundColor(handle);
     });
@@ -444,6 +506,7 @@ ALTERNET_UI_API Color_C Calendar_DateAttrGetBackgroundColor_(void* handle)
 
 ALTERNET_UI_API Color_C Calendar_DateAttrGetBorderColor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrGetBorderColor_");
     return MarshalExceptions<Color_C>([&](){
         return Calendar::DateAttrGetBorderColor(handle);
     });
@@ -451,6 +514,7 @@ ALTERNET_UI_API Color_C Calendar_DateAttrGetBorderColor_(void* handle)
 
 ALTERNET_UI_API int Calendar_DateAttrGetBorder_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Calendar_DateAttrGetBorder_");
     return MarshalExceptions<int>([&](){
         return Calendar::DateAttrGetBorder(handle);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API CheckBox* CheckBox_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_Create_");
     return MarshalExceptions<CheckBox*>([&](){
         return new CheckBox();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API CheckBox* CheckBox_Create_()
 
 ALTERNET_UI_API c_bool CheckBox_GetIsChecked_(CheckBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_GetIsChecked_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsChecked();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API c_bool CheckBox_GetIsChecked_(CheckBox* obj)
 
 ALTERNET_UI_API void CheckBox_SetIsChecked_(CheckBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_SetIsChecked_");
     MarshalExceptions<void>([&](){
         obj->SetIsChecked(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void CheckBox_SetIsChecked_(CheckBox* obj, c_bool value)
 
 ALTERNET_UI_API int CheckBox_GetCheckState_(CheckBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_GetCheckState_");
     return MarshalExceptions<int>([&](){
         return obj->GetCheckState();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API int CheckBox_GetCheckState_(CheckBox* obj)
 
 ALTERNET_UI_API void CheckBox_SetCheckState_(CheckBox* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_SetCheckState_");
     MarshalExceptions<void>([&](){
         obj->SetCheckState(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void CheckBox_SetCheckState_(CheckBox* obj, int value)
 
 ALTERNET_UI_API c_bool CheckBox_GetThreeState_(CheckBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_GetThreeState_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetThreeState();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API c_bool CheckBox_GetThreeState_(CheckBox* obj)
 
 ALTERNET_UI_API void CheckBox_SetThreeState_(CheckBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_SetThreeState_");
     MarshalExceptions<void>([&](){
         obj->SetThreeState(value);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void CheckBox_SetThreeState_(CheckBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool CheckBox_GetAlignRight_(CheckBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_GetAlignRight_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAlignRight();
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API c_bool CheckBox_GetAlignRight_(CheckBox* obj)
 
 ALTERNET_UI_API void CheckBox_SetAlignRight_(CheckBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_SetAlignRight_");
     MarshalExceptions<void>([&](){
         obj->SetAlignRight(value);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API void CheckBox_SetAlignRight_(CheckBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool CheckBox_GetAllowAllStatesForUser_(CheckBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_GetAllowAllStatesForUser_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowAllStatesForUser();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API c_bool CheckBox_GetAllowAllStatesForUser_(CheckBox* obj)
 
 ALTERNET_UI_API void CheckBox_SetAllowAllStatesForUser_(CheckBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("CheckBox_SetAllowAllStatesForUser_");
     MarshalExceptions<void>([&](){
         obj->SetAllowAllStatesForUser(value);
     });
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Clipboard* Clipboard_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Clipboard_Create_");
     return MarshalExceptions<Clipboard*>([&](){
         return new Clipboard();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API Clipboard* Clipboard_Create_()
 
 ALTERNET_UI_API UnmanagedDataObject* Clipboard_GetDataObject_(Clipboard* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Clipboard_GetDataObject_");
     return MarshalExceptions<UnmanagedDataObject*>([&](){
         return obj->GetDataObject();
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API UnmanagedDataObject* Clipboard_GetDataObject_(Clipboard* obj)
 
 ALTERNET_UI_API void Clipboard_SetDataObject_(Clipboard* obj, UnmanagedDataObject* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Clipboard_SetDataObject_");
     MarshalExceptions<void>([&](){
         obj->SetDataObject(value);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void Clipboard_SetDataObject_(Clipboard* obj, UnmanagedDataObjec
 
 ALTERNET_UI_API c_bool Clipboard_Flush_(Clipboard* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Clipboard_Flush_");
     return MarshalExceptions<c_bool>([&](){
         return obj->Flush();
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API c_bool Clipboard_Flush_(Clipboard* obj)
 
 ALTERNET_UI_API c_bool Clipboard_IsIntFormatSupported_(Clipboard* obj, int format)
 {
+    ALTERNET_UI_PERF_EXPORT("Clipboard_IsIntFormatSupported_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsIntFormatSupported(format);
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API c_bool Clipboard_IsIntFormatSupported_(Clipboard* obj, int forma
 
 ALTERNET_UI_API c_bool Clipboard_IsStrFormatSupported_(Clipboard* obj, NativeStringSpan* format)
 {
+    ALTERNET_UI_PERF_EXPORT("Clipboard_IsStrFormatSupported_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsStrFormatSupported(*format);
     });
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API ColorDialog* ColorDialog_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_Create_");
     return MarshalExceptions<ColorDialog*>([&](){
         return new ColorDialog();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API ColorDialog* ColorDialog_Create_()
 
 ALTERNET_UI_API ModalResult ColorDialog_ShowModal_(ColorDialog* obj, Window* owner)
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_ShowModal_");
     return MarshalExceptions<ModalResult>([&](){
         return obj->ShowModal(owner);
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API ModalResult ColorDialog_ShowModal_(ColorDialog* obj, Window* own
 
 ALTERNET_UI_API void ColorDialog_SetColor_(ColorDialog* obj, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_SetColor_");
     MarshalExceptions<void>([&](){
         obj->SetColor(*color);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void ColorDialog_SetColor_(ColorDialog* obj, Color* color)
 
 ALTERNET_UI_API uint8_t ColorDialog_GetColorR_(ColorDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_GetColorR_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorR();
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API uint8_t ColorDialog_GetColorR_(ColorDialog* obj)
 
 ALTERNET_UI_API uint8_t ColorDialog_GetColorG_(ColorDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_GetColorG_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorG();
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API uint8_t ColorDialog_GetColorG_(ColorDialog* obj)
 
 ALTERNET_UI_API uint8_t ColorDialog_GetColorB_(ColorDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_GetColorB_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorB();
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API uint8_t ColorDialog_GetColorB_(ColorDialog* obj)
 
 ALTERNET_UI_API uint8_t ColorDialog_GetColorA_(ColorDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_GetColorA_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorA();
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API uint8_t ColorDialog_GetColorA_(ColorDialog* obj)
 
 ALTERNET_UI_API uint8_t ColorDialog_GetColorState_(ColorDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_GetColorState_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorState();
     });
@@ -67,6 +75,7 @@ ALTERNET_UI_API uint8_t ColorDialog_GetColorState_(ColorDialog* obj)
 
 ALTERNET_UI_API NativeStringSpan_C ColorDialog_GetTitle_(ColorDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_GetTitle_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetTitle();
     });
@@ -74,6 +83,7 @@ ALTERNET_UI_API NativeStringSpan_C ColorDialog_GetTitle_(ColorDialog* obj)
 
 ALTERNET_UI_API void ColorDialog_SetTitle_(ColorDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("ColorDialog_SetTitle_");
     MarshalExceptions<void>([&](){
         obj->SetTitle(*value);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API ComboBox* ComboBox_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_Create_");
     return MarshalExceptions<ComboBox*>([&](){
         return new ComboBox();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API ComboBox* ComboBox_Create_()
 
 ALTERNET_UI_API c_bool ComboBox_GetAllowMouseWheel_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetAllowMouseWheel_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowMouseWheel();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API c_bool ComboBox_GetAllowMouseWheel_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SetAllowMouseWheel_(ComboBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SetAllowMouseWheel_");
     MarshalExceptions<void>([&](){
         obj->SetAllowMouseWheel(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void ComboBox_SetAllowMouseWheel_(ComboBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool ComboBox_GetHasBorder_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API c_bool ComboBox_GetHasBorder_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SetHasBorder_(ComboBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void ComboBox_SetHasBorder_(ComboBox* obj, c_bool value)
 
 ALTERNET_UI_API int ComboBox_GetItemsCount_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetItemsCount_");
     return MarshalExceptions<int>([&](){
         return obj->GetItemsCount();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API int ComboBox_GetItemsCount_(ComboBox* obj)
 
 ALTERNET_UI_API c_bool ComboBox_GetIsEditable_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetIsEditable_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsEditable();
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API c_bool ComboBox_GetIsEditable_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SetIsEditable_(ComboBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SetIsEditable_");
     MarshalExceptions<void>([&](){
         obj->SetIsEditable(value);
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API void ComboBox_SetIsEditable_(ComboBox* obj, c_bool value)
 
 ALTERNET_UI_API int ComboBox_GetSelectedIndex_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetSelectedIndex_");
     return MarshalExceptions<int>([&](){
         return obj->GetSelectedIndex();
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API int ComboBox_GetSelectedIndex_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SetSelectedIndex_(ComboBox* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SetSelectedIndex_");
     MarshalExceptions<void>([&](){
         obj->SetSelectedIndex(value);
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API void ComboBox_SetSelectedIndex_(ComboBox* obj, int value)
 
 ALTERNET_UI_API int ComboBox_GetTextSelectionStart_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetTextSelectionStart_");
     return MarshalExceptions<int>([&](){
         return obj->GetTextSelectionStart();
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API int ComboBox_GetTextSelectionStart_(ComboBox* obj)
 
 ALTERNET_UI_API int ComboBox_GetTextSelectionLength_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetTextSelectionLength_");
     return MarshalExceptions<int>([&](){
         return obj->GetTextSelectionLength();
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API int ComboBox_GetTextSelectionLength_(ComboBox* obj)
 
 ALTERNET_UI_API int ComboBox_GetTextMarginsX_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetTextMarginsX_");
     return MarshalExceptions<int>([&](){
         return obj->GetTextMarginsX();
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API int ComboBox_GetTextMarginsX_(ComboBox* obj)
 
 ALTERNET_UI_API int ComboBox_GetTextMarginsY_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetTextMarginsY_");
     return MarshalExceptions<int>([&](){
         return obj->GetTextMarginsY();
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API int ComboBox_GetTextMarginsY_(ComboBox* obj)
 
 ALTERNET_UI_API int ComboBox_GetOwnerDrawStyle_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetOwnerDrawStyle_");
     return MarshalExceptions<int>([&](){
         return obj->GetOwnerDrawStyle();
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API int ComboBox_GetOwnerDrawStyle_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SetOwnerDrawStyle_(ComboBox* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SetOwnerDrawStyle_");
     MarshalExceptions<void>([&](){
         obj->SetOwnerDrawStyle(value);
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API void ComboBox_SetOwnerDrawStyle_(ComboBox* obj, int value)
 
 ALTERNET_UI_API void* ComboBox_GetPopupWidget_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetPopupWidget_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPopupWidget();
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API void* ComboBox_GetPopupWidget_(ComboBox* obj)
 
 ALTERNET_UI_API void* ComboBox_GetEventDc_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetEventDc_");
     return MarshalExceptions<void*>([&](){
         return obj->GetEventDc();
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API void* ComboBox_GetEventDc_(ComboBox* obj)
 
 ALTERNET_UI_API int ComboBox_GetEventItem_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetEventItem_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventItem();
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API int ComboBox_GetEventItem_(ComboBox* obj)
 
 ALTERNET_UI_API int ComboBox_GetEventFlags_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetEventFlags_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventFlags();
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API int ComboBox_GetEventFlags_(ComboBox* obj)
 
 ALTERNET_UI_API int ComboBox_GetEventResultInt_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetEventResultInt_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventResultInt();
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API int ComboBox_GetEventResultInt_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SetEventResultInt_(ComboBox* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SetEventResultInt_");
     MarshalExceptions<void>([&](){
         obj->SetEventResultInt(value);
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API void ComboBox_SetEventResultInt_(ComboBox* obj, int value)
 
 ALTERNET_UI_API c_bool ComboBox_GetEventCalled_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetEventCalled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetEventCalled();
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API c_bool ComboBox_GetEventCalled_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SetEventCalled_(ComboBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SetEventCalled_");
     MarshalExceptions<void>([&](){
         obj->SetEventCalled(value);
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API void ComboBox_SetEventCalled_(ComboBox* obj, c_bool value)
 
 ALTERNET_UI_API void ComboBox_DismissPopup_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_DismissPopup_");
     MarshalExceptions<void>([&](){
         obj->DismissPopup();
     });
@@ -185,6 +210,7 @@ ALTERNET_UI_API void ComboBox_DismissPopup_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_ShowPopup_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_ShowPopup_");
     MarshalExceptions<void>([&](){
         obj->ShowPopup();
     });
@@ -192,6 +218,7 @@ ALTERNET_UI_API void ComboBox_ShowPopup_(ComboBox* obj)
 
 ALTERNET_UI_API NativeStringSpan_C ComboBox_GetEmptyTextHint_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetEmptyTextHint_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetEmptyTextHint();
     });
@@ -199,6 +226,7 @@ ALTERNET_UI_API NativeStringSpan_C ComboBox_GetEmptyTextHint_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SetEmptyTextHint_(ComboBox* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SetEmptyTextHint_");
     MarshalExceptions<void>([&](){
         obj->SetEmptyTextHint(*value);
     });
@@ -206,6 +234,7 @@ ALTERNET_UI_API void ComboBox_SetEmptyTextHint_(ComboBox* obj, NativeStringSpan*
 
 ALTERNET_UI_API RectI_C ComboBox_GetEventRect_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_GetEventRect_");
     return MarshalExceptions<RectI_C>([&](){
         return obj->GetEventRect();
     });
@@ -213,6 +242,7 @@ ALTERNET_UI_API RectI_C ComboBox_GetEventRect_(ComboBox* obj)
 
 ALTERNET_UI_API int ComboBox_DefaultOnMeasureItemWidth_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_DefaultOnMeasureItemWidth_");
     return MarshalExceptions<int>([&](){
         return obj->DefaultOnMeasureItemWidth();
     });
@@ -220,6 +250,7 @@ ALTERNET_UI_API int ComboBox_DefaultOnMeasureItemWidth_(ComboBox* obj)
 
 ALTERNET_UI_API int ComboBox_DefaultOnMeasureItem_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_DefaultOnMeasureItem_");
     return MarshalExceptions<int>([&](){
         return obj->DefaultOnMeasureItem();
     });
@@ -227,6 +258,7 @@ ALTERNET_UI_API int ComboBox_DefaultOnMeasureItem_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_DefaultOnDrawBackground_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_DefaultOnDrawBackground_");
     MarshalExceptions<void>([&](){
         obj->DefaultOnDrawBackground();
     });
@@ -234,6 +266,7 @@ ALTERNET_UI_API void ComboBox_DefaultOnDrawBackground_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_DefaultOnDrawItem_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_DefaultOnDrawItem_");
     MarshalExceptions<void>([&](){
         obj->DefaultOnDrawItem();
     });
@@ -241,6 +274,7 @@ ALTERNET_UI_API void ComboBox_DefaultOnDrawItem_(ComboBox* obj)
 
 ALTERNET_UI_API void* ComboBox_CreateItemsInsertion_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_CreateItemsInsertion_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateItemsInsertion();
     });
@@ -248,6 +282,7 @@ ALTERNET_UI_API void* ComboBox_CreateItemsInsertion_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_AddItemToInsertion_(ComboBox* obj, void* insertion, NativeStringSpan* item)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_AddItemToInsertion_");
     MarshalExceptions<void>([&](){
         obj->AddItemToInsertion(insertion, *item);
     });
@@ -255,6 +290,7 @@ ALTERNET_UI_API void ComboBox_AddItemToInsertion_(ComboBox* obj, void* insertion
 
 ALTERNET_UI_API void ComboBox_CommitItemsInsertion_(ComboBox* obj, void* insertion, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_CommitItemsInsertion_");
     MarshalExceptions<void>([&](){
         obj->CommitItemsInsertion(insertion, index);
     });
@@ -262,6 +298,7 @@ ALTERNET_UI_API void ComboBox_CommitItemsInsertion_(ComboBox* obj, void* inserti
 
 ALTERNET_UI_API void ComboBox_InsertItem_(ComboBox* obj, int index, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_InsertItem_");
     MarshalExceptions<void>([&](){
         obj->InsertItem(index, *value);
     });
@@ -269,6 +306,7 @@ ALTERNET_UI_API void ComboBox_InsertItem_(ComboBox* obj, int index, NativeString
 
 ALTERNET_UI_API void ComboBox_RemoveItemAt_(ComboBox* obj, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_RemoveItemAt_");
     MarshalExceptions<void>([&](){
         obj->RemoveItemAt(index);
     });
@@ -276,6 +314,7 @@ ALTERNET_UI_API void ComboBox_RemoveItemAt_(ComboBox* obj, int index)
 
 ALTERNET_UI_API void ComboBox_ClearItems_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_ClearItems_");
     MarshalExceptions<void>([&](){
         obj->ClearItems();
     });
@@ -283,6 +322,7 @@ ALTERNET_UI_API void ComboBox_ClearItems_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SelectTextRange_(ComboBox* obj, int start, int length)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SelectTextRange_");
     MarshalExceptions<void>([&](){
         obj->SelectTextRange(start, length);
     });
@@ -290,6 +330,7 @@ ALTERNET_UI_API void ComboBox_SelectTextRange_(ComboBox* obj, int start, int len
 
 ALTERNET_UI_API void ComboBox_SelectAllText_(ComboBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SelectAllText_");
     MarshalExceptions<void>([&](){
         obj->SelectAllText();
     });
@@ -297,6 +338,7 @@ ALTERNET_UI_API void ComboBox_SelectAllText_(ComboBox* obj)
 
 ALTERNET_UI_API void ComboBox_SetItem_(ComboBox* obj, int index, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("ComboBox_SetItem_");
     MarshalExceptions<void>([&](){
         obj->SetItem(index, *value);
     });
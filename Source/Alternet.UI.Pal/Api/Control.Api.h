@@ -12,6 +12,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API c_bool Control_GetWantChars_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetWantChars_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetWantChars();
     });
@@ -19,6 +20,7 @@ ALTERNET_UI_API c_bool Control_GetWantChars_(Control* obj)
 
 ALTERNET_UI_API void Control_SetWantChars_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetWantChars_");
     MarshalExceptions<void>([&](){
         obj->SetWantChars(value);
     });
@@ -26,6 +28,7 @@ ALTERNET_UI_API void Control_SetWantChars_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetBindScrollEvents_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetBindScrollEvents_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetBindScrollEvents();
     });
@@ -33,6 +36,7 @@ ALTERNET_UI_API c_bool Control_GetBindScrollEvents_(Control* obj)
 
 ALTERNET_UI_API void Control_SetBindScrollEvents_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetBindScrollEvents_");
     MarshalExceptions<void>([&](){
         obj->SetBindScrollEvents(value);
     });
@@ -40,6 +44,7 @@ ALTERNET_UI_API void Control_SetBindScrollEvents_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetProcessIdle_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetProcessIdle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetProcessIdle();
     });
@@ -47,6 +52,7 @@ ALTERNET_UI_API c_bool Control_GetProcessIdle_(Control* obj)
 
 ALTERNET_UI_API void Control_SetProcessIdle_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetProcessIdle_");
     MarshalExceptions<void>([&](){
         obj->SetProcessIdle(value);
     });
@@ -54,6 +60,7 @@ ALTERNET_UI_API void Control_SetProcessIdle_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetProcessUIUpdates_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetProcessUIUpdates_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetProcessUIUpdates();
     });
@@ -61,6 +68,7 @@ ALTERNET_UI_API c_bool Control_GetProcessUIUpdates_(Control* obj)
 
 ALTERNET_UI_API void Control_SetProcessUIUpdates_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetProcessUIUpdates_");
     MarshalExceptions<void>([&](){
         obj->SetProcessUIUpdates(value);
     });
@@ -68,6 +76,7 @@ ALTERNET_UI_API void Control_SetProcessUIUpdates_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetIsBold_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetIsBold_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsBold();
     });
@@ -75,6 +84,7 @@ ALTERNET_UI_API c_bool Control_GetIsBold_(Control* obj)
 
 ALTERNET_UI_API void Control_SetIsBold_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetIsBold_");
     MarshalExceptions<void>([&](){
         obj->SetIsBold(value);
     });
@@ -82,6 +92,7 @@ ALTERNET_UI_API void Control_SetIsBold_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetAcceptsFocus_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetAcceptsFocus_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAcceptsFocus();
     });
@@ -89,6 +100,7 @@ ALTERNET_UI_API c_bool Control_GetAcceptsFocus_(Control* obj)
 
 ALTERNET_UI_API void Control_SetAcceptsFocus_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetAcceptsFocus_");
     MarshalExceptions<void>([&](){
         obj->SetAcceptsFocus(value);
     });
@@ -96,6 +108,7 @@ ALTERNET_UI_API void Control_SetAcceptsFocus_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetAcceptsFocusFromKeyboard_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetAcceptsFocusFromKeyboard_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAcceptsFocusFromKeyboard();
     });
@@ -103,6 +116,7 @@ ALTERNET_UI_API c_bool Control_GetAcceptsFocusFromKeyboard_(Control* obj)
 
 ALTERNET_UI_API void Control_SetAcceptsFocusFromKeyboard_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetAcceptsFocusFromKeyboard_");
     MarshalExceptions<void>([&](){
         obj->SetAcceptsFocusFromKeyboard(value);
     });
@@ -110,6 +124,7 @@ ALTERNET_UI_API void Control_SetAcceptsFocusFromKeyboard_(Control* obj, c_bool v
 
 ALTERNET_UI_API c_bool Control_GetAcceptsFocusRecursively_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetAcceptsFocusRecursively_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAcceptsFocusRecursively();
     });
@@ -117,6 +132,7 @@ ALTERNET_UI_API c_bool Control_GetAcceptsFocusRecursively_(Control* obj)
 
 ALTERNET_UI_API void Control_SetAcceptsFocusRecursively_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetAcceptsFocusRecursively_");
     MarshalExceptions<void>([&](){
         obj->SetAcceptsFocusRecursively(value);
     });
@@ -124,6 +140,7 @@ ALTERNET_UI_API void Control_SetAcceptsFocusRecursively_(Control* obj, c_bool va
 
 ALTERNET_UI_API c_bool Control_GetAcceptsFocusAll_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetAcceptsFocusAll_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAcceptsFocusAll();
     });
@@ -131,6 +148,7 @@ ALTERNET_UI_API c_bool Control_GetAcceptsFocusAll_(Control* obj)
 
 ALTERNET_UI_API void Control_SetAcceptsFocusAll_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetAcceptsFocusAll_");
     MarshalExceptions<void>([&](){
         obj->SetAcceptsFocusAll(value);
     });
@@ -138,6 +156,7 @@ ALTERNET_UI_API void Control_SetAcceptsFocusAll_(Control* obj, c_bool value)
 
 ALTERNET_UI_API int Control_GetBorderStyle_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetBorderStyle_");
     return MarshalExceptions<int>([&](){
         return obj->GetBorderStyle();
     });
@@ -145,6 +164,7 @@ ALTERNET_UI_API int Control_GetBorderStyle_(Control* obj)
 
 ALTERNET_UI_API void Control_SetBorderStyle_(Control* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetBorderStyle_");
     MarshalExceptions<void>([&](){
         obj->SetBorderStyle(value);
     });
@@ -152,6 +172,7 @@ ALTERNET_UI_API void Control_SetBorderStyle_(Control* obj, int value)
 
 ALTERNET_UI_API int Control_GetLayoutDirection_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetLayoutDirection_");
     return MarshalExceptions<int>([&](){
         return obj->GetLayoutDirection();
     });
@@ -159,6 +180,7 @@ ALTERNET_UI_API int Control_GetLayoutDirection_(Control* obj)
 
 ALTERNET_UI_API void Control_SetLayoutDirection_(Control* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetLayoutDirection_");
     MarshalExceptions<void>([&](){
         obj->SetLayoutDirection(value);
     });
@@ -166,6 +188,7 @@ ALTERNET_UI_API void Control_SetLayoutDirection_(Control* obj, int value)
 
 ALTERNET_UI_API int Control_GetId_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetId_");
     return MarshalExceptions<int>([&](){
         return obj->GetId();
     });
@@ -173,6 +196,7 @@ ALTERNET_UI_API int Control_GetId_(Control* obj)
 
 ALTERNET_UI_API void Control_SetId_(Control* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetId_");
     MarshalExceptions<void>([&](){
         obj->SetId(value);
     });
@@ -180,6 +204,7 @@ ALTERNET_UI_API void Control_SetId_(Control* obj, int value)
 
 ALTERNET_UI_API int Control_GetEventOldDpi_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetEventOldDpi_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventOldDpi();
     });
@@ -187,6 +212,7 @@ ALTERNET_UI_API int Control_GetEventOldDpi_(Control* obj)
 
 ALTERNET_UI_API int Control_GetEventNewDpi_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetEventNewDpi_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventNewDpi();
     });
@@ -194,6 +220,7 @@ ALTERNET_UI_API int Control_GetEventNewDpi_(Control* obj)
 
 ALTERNET_UI_API Control* Control_GetEventFocusedControl_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetEventFocusedControl_");
     return MarshalExceptions<Control*>([&](){
         return obj->GetEventFocusedControl();
     });
@@ -201,6 +228,7 @@ ALTERNET_UI_API Control* Control_GetEventFocusedControl_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetIsActive_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetIsActive_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsActive();
     });
@@ -208,6 +236,7 @@ ALTERNET_UI_API c_bool Control_GetIsActive_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetIsHandleCreated_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetIsHandleCreated_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsHandleCreated();
     });
@@ -215,6 +244,7 @@ ALTERNET_UI_API c_bool Control_GetIsHandleCreated_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetIsWxWidgetCreated_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetIsWxWidgetCreated_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsWxWidgetCreated();
     });
@@ -222,6 +252,7 @@ ALTERNET_UI_API c_bool Control_GetIsWxWidgetCreated_(Control* obj)
 
 ALTERNET_UI_API void* Control_GetHandle_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetHandle_");
     return MarshalExceptions<void*>([&](){
         return obj->GetHandle();
     });
@@ -229,6 +260,7 @@ ALTERNET_UI_API void* Control_GetHandle_(Control* obj)
 
 ALTERNET_UI_API void* Control_GetWxWidget_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetWxWidget_");
     return MarshalExceptions<void*>([&](){
         return obj->GetWxWidget();
     });
@@ -236,6 +268,7 @@ ALTERNET_UI_API void* Control_GetWxWidget_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetIsScrollable_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetIsScrollable_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsScrollable();
     });
@@ -243,6 +276,7 @@ ALTERNET_UI_API c_bool Control_GetIsScrollable_(Control* obj)
 
 ALTERNET_UI_API void Control_SetIsScrollable_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetIsScrollable_");
     MarshalExceptions<void>([&](){
         obj->SetIsScrollable(value);
     });
@@ -250,6 +284,7 @@ ALTERNET_UI_API void Control_SetIsScrollable_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetIsMouseCaptured_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetIsMouseCaptured_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsMouseCaptured();
     });
@@ -257,6 +292,7 @@ ALTERNET_UI_API c_bool Control_GetIsMouseCaptured_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetTabStop_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetTabStop_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetTabStop();
     });
@@ -264,6 +300,7 @@ ALTERNET_UI_API c_bool Control_GetTabStop_(Control* obj)
 
 ALTERNET_UI_API void Control_SetTabStop_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetTabStop_");
     MarshalExceptions<void>([&](){
         obj->SetTabStop(value);
     });
@@ -271,6 +308,7 @@ ALTERNET_UI_API void Control_SetTabStop_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetIsFocused_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetIsFocused_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsFocused();
     });
@@ -278,6 +316,7 @@ ALTERNET_UI_API c_bool Control_GetIsFocused_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetIsFocusable_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetIsFocusable_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsFocusable();
     });
@@ -285,6 +324,7 @@ ALTERNET_UI_API c_bool Control_GetIsFocusable_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetCanAcceptFocus_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetCanAcceptFocus_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanAcceptFocus();
     });
@@ -292,6 +332,7 @@ ALTERNET_UI_API c_bool Control_GetCanAcceptFocus_(Control* obj)
 
 ALTERNET_UI_API Control* Control_GetParentRefCounted_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetParentRefCounted_");
     return MarshalExceptions<Control*>([&](){
         return obj->GetParentRefCounted();
     });
@@ -299,6 +340,7 @@ ALTERNET_UI_API Control* Control_GetParentRefCounted_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetAllowDrop_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetAllowDrop_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowDrop();
     });
@@ -306,6 +348,7 @@ ALTERNET_UI_API c_bool Control_GetAllowDrop_(Control* obj)
 
 ALTERNET_UI_API void Control_SetAllowDrop_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetAllowDrop_");
     MarshalExceptions<void>([&](){
         obj->SetAllowDrop(value);
     });
@@ -313,6 +356,7 @@ ALTERNET_UI_API void Control_SetAllowDrop_(Control* obj, c_bool value)
 
 ALTERNET_UI_API float Control_GetAutoPaddingLeft_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetAutoPaddingLeft_");
     return MarshalExceptions<float>([&](){
         return obj->GetAutoPaddingLeft();
     });
@@ -320,6 +364,7 @@ ALTERNET_UI_API float Control_GetAutoPaddingLeft_(Control* obj)
 
 ALTERNET_UI_API float Control_GetAutoPaddingTop_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetAutoPaddingTop_");
     return MarshalExceptions<float>([&](){
         return obj->GetAutoPaddingTop();
     });
@@ -327,6 +372,7 @@ ALTERNET_UI_API float Control_GetAutoPaddingTop_(Control* obj)
 
 ALTERNET_UI_API float Control_GetAutoPaddingRight_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetAutoPaddingRight_");
     return MarshalExceptions<float>([&](){
         return obj->GetAutoPaddingRight();
     });
@@ -334,6 +380,7 @@ ALTERNET_UI_API float Control_GetAutoPaddingRight_(Control* obj)
 
 ALTERNET_UI_API float Control_GetAutoPaddingBottom_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetAutoPaddingBottom_");
     return MarshalExceptions<float>([&](){
         return obj->GetAutoPaddingBottom();
     });
@@ -341,6 +388,7 @@ ALTERNET_UI_API float Control_GetAutoPaddingBottom_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetVisible_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetVisible_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetVisible();
     });
@@ -348,6 +396,7 @@ ALTERNET_UI_API c_bool Control_GetVisible_(Control* obj)
 
 ALTERNET_UI_API void Control_SetVisible_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetVisible_");
     MarshalExceptions<void>([&](){
         obj->SetVisible(value);
     });
@@ -355,6 +404,7 @@ ALTERNET_UI_API void Control_SetVisible_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetEnabled_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetEnabled();
     });
@@ -362,6 +412,7 @@ ALTERNET_UI_API c_bool Control_GetEnabled_(Control* obj)
 
 ALTERNET_UI_API void Control_SetEnabled_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetEnabled_");
     MarshalExceptions<void>([&](){
         obj->SetEnabled(value);
     });
@@ -369,6 +420,7 @@ ALTERNET_UI_API void Control_SetEnabled_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetUserPaint_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetUserPaint_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetUserPaint();
     });
@@ -376,6 +428,7 @@ ALTERNET_UI_API c_bool Control_GetUserPaint_(Control* obj)
 
 ALTERNET_UI_API void Control_SetUserPaint_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetUserPaint_");
     MarshalExceptions<void>([&](){
         obj->SetUserPaint(value);
     });
@@ -383,6 +436,7 @@ ALTERNET_UI_API void Control_SetUserPaint_(Control* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Control_GetIsMouseOver_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetIsMouseOver_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsMouseOver();
     });
@@ -390,6 +444,7 @@ ALTERNET_UI_API c_bool Control_GetIsMouseOver_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_GetHasWindowCreated_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetHasWindowCreated_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasWindowCreated();
     });
@@ -397,6 +452,7 @@ ALTERNET_UI_API c_bool Control_GetHasWindowCreated_(Control* obj)
 
 ALTERNET_UI_API void* Control_GetCGContextRef_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetCGContextRef_");
     return MarshalExceptions<void*>([&](){
         return obj->GetCGContextRef();
     });
@@ -404,6 +460,7 @@ ALTERNET_UI_API void* Control_GetCGContextRef_(Control* obj)
 
 ALTERNET_UI_API void Control_SetAllowDefaultContextMenu_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetAllowDefaultContextMenu_");
     MarshalExceptions<void>([&](){
         obj->SetAllowDefaultContextMenu(value);
     });
@@ -411,6 +468,7 @@ ALTERNET_UI_API void Control_SetAllowDefaultContextMenu_(Control* obj, c_bool va
 
 ALTERNET_UI_API void Control_SetScrollBar_(Control* obj, ScrollBarOrientation orientation, HiddenOrVisible visible, int value, int largeChange, int maximum)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetScrollBar_");
     MarshalExceptions<void>([&](){
         obj->SetScrollBar(orientation, visible, value, largeChange, maximum);
     });
@@ -418,6 +476,7 @@ ALTERNET_UI_API void Control_SetScrollBar_(Control* obj, ScrollBarOrientation or
 
 ALTERNET_UI_API c_bool Control_IsScrollBarVisible_(Control* obj, ScrollBarOrientation orientation)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_IsScrollBarVisible_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsScrollBarVisible(orientation);
     });
@@ -425,6 +484,7 @@ ALTERNET_UI_API c_bool Control_IsScrollBarVisible_(Control* obj, ScrollBarOrient
 
 ALTERNET_UI_API int Control_GetScrollBarValue_(Control* obj, ScrollBarOrientation orientation)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetScrollBarValue_");
     return MarshalExceptions<int>([&](){
         return obj->GetScrollBarValue(orientation);
     });
@@ -432,6 +492,7 @@ ALTERNET_UI_API int Control_GetScrollBarValue_(Control* obj, ScrollBarOrientatio
 
 ALTERNET_UI_API int Control_GetScrollBarLargeChange_(Control* obj, ScrollBarOrientation orientation)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetScrollBarLargeChange_");
     return MarshalExceptions<int>([&](){
         return obj->GetScrollBarLargeChange(orientation);
     });
@@ -439,6 +500,7 @@ ALTERNET_UI_API int Control_GetScrollBarLargeChange_(Control* obj, ScrollBarOrie
 
 ALTERNET_UI_API int Control_GetScrollBarMaximum_(Control* obj, ScrollBarOrientation orientation)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetScrollBarMaximum_");
     return MarshalExceptions<int>([&](){
         return obj->GetScrollBarMaximum(orientation);
     });
@@ -446,6 +508,7 @@ ALTERNET_UI_API int Control_GetScrollBarMaximum_(Control* obj, ScrollBarOrientat
 
 ALTERNET_UI_API void* Control_CreateControl_()
 {
+    ALTERNET_UI_PERF_EXPORT("Control_CreateControl_");
     return MarshalExceptions<void*>([&](){
         return Control::CreateControl();
     });
@@ -453,6 +516,7 @@ ALTERNET_UI_API void* Control_CreateControl_()
 
 ALTERNET_UI_API c_bool Control_EnableTouchEvents_(Control* obj, int flag)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_EnableTouchEvents_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EnableTouchEvents(flag);
     });
@@ -460,6 +524,7 @@ ALTERNET_UI_API c_bool Control_EnableTouchEvents_(Control* obj, int flag)
 
 ALTERNET_UI_API c_bool Control_BeginRepositioningChildren_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_BeginRepositioningChildren_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginRepositioningChildren();
     });
@@ -467,6 +532,7 @@ ALTERNET_UI_API c_bool Control_BeginRepositioningChildren_(Control* obj)
 
 ALTERNET_UI_API void Control_EndRepositioningChildren_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_EndRepositioningChildren_");
     MarshalExceptions<void>([&](){
         obj->EndRepositioningChildren();
     });
@@ -474,6 +540,7 @@ ALTERNET_UI_API void Control_EndRepositioningChildren_(Control* obj)
 
 ALTERNET_UI_API RectI_C Control_GetUpdateClientRect_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetUpdateClientRect_");
     return MarshalExceptions<RectI_C>([&](){
         return obj->GetUpdateClientRect();
     });
@@ -481,6 +548,7 @@ ALTERNET_UI_API RectI_C Control_GetUpdateClientRect_(Control* obj)
 
 ALTERNET_UI_API void Control_CenterOnParent_(Control* obj, int orientation)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_CenterOnParent_");
     MarshalExceptions<void>([&](){
         obj->CenterOnParent(orientation);
     });
@@ -488,6 +556,7 @@ ALTERNET_UI_API void Control_CenterOnParent_(Control* obj, int orientation)
 
 ALTERNET_UI_API void Control_RefreshRect_(Control* obj, RectD* rect, c_bool eraseBackground)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_RefreshRect_");
     MarshalExceptions<void>([&](){
         obj->RefreshRect(*rect, eraseBackground);
     });
@@ -495,6 +564,7 @@ ALTERNET_UI_API void Control_RefreshRect_(Control* obj, RectD* rect, c_bool eras
 
 ALTERNET_UI_API void Control_Raise_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_Raise_");
     MarshalExceptions<void>([&](){
         obj->Raise();
     });
@@ -502,6 +572,7 @@ ALTERNET_UI_API void Control_Raise_(Control* obj)
 
 ALTERNET_UI_API void Control_Lower_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_Lower_");
     MarshalExceptions<void>([&](){
         obj->Lower();
     });
@@ -509,6 +580,7 @@ ALTERNET_UI_API void Control_Lower_(Control* obj)
 
 ALTERNET_UI_API void Control_SetAllowDoubleBuffered_(Control* obj, c_bool allow)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetAllowDoubleBuffered_");
     MarshalExceptions<void>([&](){
         obj->SetAllowDoubleBuffered(allow);
     });
@@ -516,6 +588,7 @@ ALTERNET_UI_API void Control_SetAllowDoubleBuffered_(Control* obj, c_bool allow)
 
 ALTERNET_UI_API void Control_DisableRecreate_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_DisableRecreate_");
     MarshalExceptions<void>([&](){
         obj->DisableRecreate();
     });
@@ -523,6 +596,7 @@ ALTERNET_UI_API void Control_DisableRecreate_(Control* obj)
 
 ALTERNET_UI_API void Control_EnableRecreate_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_EnableRecreate_");
     MarshalExceptions<void>([&](){
         obj->EnableRecreate();
     });
@@ -530,6 +604,7 @@ ALTERNET_UI_API void Control_EnableRecreate_(Control* obj)
 
 ALTERNET_UI_API void Control_UnsetToolTip_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_UnsetToolTip_");
     MarshalExceptions<void>([&](){
         obj->UnsetToolTip();
     });
@@ -537,6 +612,7 @@ ALTERNET_UI_API void Control_UnsetToolTip_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_IsTransparentBackgroundSupported_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_IsTransparentBackgroundSupported_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsTransparentBackgroundSupported();
     });
@@ -544,6 +620,7 @@ ALTERNET_UI_API c_bool Control_IsTransparentBackgroundSupported_(Control* obj)
 
 ALTERNET_UI_API c_bool Control_SetBackgroundStyle_(Control* obj, int style)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetBackgroundStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetBackgroundStyle(style);
     });
@@ -551,6 +628,7 @@ ALTERNET_UI_API c_bool Control_SetBackgroundStyle_(Control* obj, int style)
 
 ALTERNET_UI_API int Control_GetBackgroundStyle_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetBackgroundStyle_");
     return MarshalExceptions<int>([&](){
         return obj->GetBackgroundStyle();
     });
@@ -558,6 +636,7 @@ ALTERNET_UI_API int Control_GetBackgroundStyle_(Control* obj)
 
 ALTERNET_UI_API Color_C Control_GetDefaultAttributesBgColor_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetDefaultAttributesBgColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetDefaultAttributesBgColor();
     });
@@ -565,6 +644,7 @@ ALTERNET_UI_API Color_C Control_GetDefaultAttributesBgColor_(Control* obj)
 
 ALTERNET_UI_API Color_C Control_GetDefaultAttributesFgColor_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetDefaultAttributesFgColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetDefaultAttributesFgColor();
     });
@@ -572,6 +652,7 @@ ALTERNET_UI_API Color_C Control_GetDefaultAttributesFgColor_(Control* obj)
 
 ALTERNET_UI_API Color_C Control_GetClassDefaultAttributesBgColor_(int controlType, int windowVariant)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetClassDefaultAttributesBgColor_");
     return MarshalExceptions<Color_C>([&](){
         return Control::GetClassDefaultAttributesBgColor(controlType, windowVariant);
     });
@@ -579,6 +660,7 @@ ALTERNET_UI_API Color_C Control_GetClassDefaultAttributesBgColor_(int controlTyp
 
 ALTERNET_UI_API Color_C Control_GetClassDefaultAttributesFgColor_(int controlType, int windowVariant)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetClassDefaultAttributesFgColor_");
     return MarshalExceptions<Color_C>([&](){
         return Control::GetClassDefaultAttributesFgColor(controlType, windowVariant);
     });
@@ -586,6 +668,7 @@ ALTERNET_UI_API Color_C Control_GetClassDefaultAttributesFgColor_(int controlTyp
 
 ALTERNET_UI_API int Control_DrawingFromDip_(float value, void* window)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_DrawingFromDip_");
     return MarshalExceptions<int>([&](){
         return Control::DrawingFromDip(value, window);
     });
@@ -593,6 +676,7 @@ ALTERNET_UI_API int Control_DrawingFromDip_(float value, void* window)
 
 ALTERNET_UI_API float Control_DrawingDPIScaleFactor_(void* window)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_DrawingDPIScaleFactor_");
     return MarshalExceptions<float>([&](){
         return Control::DrawingDPIScaleFactor(window);
     });
@@ -600,6 +684,7 @@ ALTERNET_UI_API float Control_DrawingDPIScaleFactor_(void* window)
 
 ALTERNET_UI_API float Control_DrawingToDip_(int value, void* window)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_DrawingToDip_");
     return MarshalExceptions<float>([&](){
         return Control::DrawingToDip(value, window);
     });
@@ -607,6 +692,7 @@ ALTERNET_UI_API float Control_DrawingToDip_(int value, void* window)
 
 ALTERNET_UI_API float Control_DrawingFromDipF_(float value, void* window)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_DrawingFromDipF_");
     return MarshalExceptions<float>([&](){
         return Control::DrawingFromDipF(value, window);
     });
@@ -614,6 +700,7 @@ ALTERNET_UI_API float Control_DrawingFromDipF_(float value, void* window)
 
 ALTERNET_UI_API void Control_SetCursor_(Control* obj, void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetCursor_");
     MarshalExceptions<void>([&](){
         obj->SetCursor(handle);
     });
@@ -621,6 +708,7 @@ ALTERNET_UI_API void Control_SetCursor_(Control* obj, void* handle)
 
 ALTERNET_UI_API NativeStringSpan_C Control_GetName_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetName();
     });
@@ -628,6 +716,7 @@ ALTERNET_UI_API NativeStringSpan_C Control_GetName_(Control* obj)
 
 ALTERNET_UI_API void Control_SetName_(Control* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetName_");
     MarshalExceptions<void>([&](){
         obj->SetName(*value);
     });
@@ -635,6 +724,7 @@ ALTERNET_UI_API void Control_SetName_(Control* obj, NativeStringSpan* value)
 
 ALTERNET_UI_API NativeStringSpan_C Control_GetText_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetText_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetText();
     });
@@ -642,6 +732,7 @@ ALTERNET_UI_API NativeStringSpan_C Control_GetText_(Control* obj)
 
 ALTERNET_UI_API void Control_SetText_(Control* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetText_");
     MarshalExceptions<void>([&](){
         obj->SetText(*value);
     });
@@ -649,6 +740,7 @@ ALTERNET_UI_API void Control_SetText_(Control* obj, NativeStringSpan* value)
 
 ALTERNET_UI_API NativeStringSpan_C Control_GetToolTip_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetToolTip_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetToolTip();
     });
@@ -656,6 +748,7 @@ ALTERNET_UI_API NativeStringSpan_C Control_GetToolTip_(Control* obj)
 
 ALTERNET_UI_API void Control_SetToolTip_(Control* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetToolTip_");
     MarshalExceptions<void>([&](){
         obj->SetToolTip(*value);
     });
@@ -663,6 +756,7 @@ ALTERNET_UI_API void Control_SetToolTip_(Control* obj, NativeStringSpan* value)
 
 ALTERNET_UI_API RectD_C Control_GetBounds_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetBounds_");
     return MarshalExceptions<RectD_C>([&](){
         return obj->GetBounds();
     });
@@ -670,6 +764,7 @@ ALTERNET_UI_API RectD_C Control_GetBounds_(Control* obj)
 
 ALTERNET_UI_API void* Control_GetDrawingContext_(Control* obj, c_bool native)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetDrawingContext_");
     return MarshalExceptions<void*>([&](){
         return obj->GetDrawingContext(native);
     });
@@ -677,6 +772,7 @@ ALTERNET_UI_API void* Control_GetDrawingContext_(Control* obj, c_bool native)
 
 ALTERNET_UI_API RectI_C Control_GetBoundsI_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetBoundsI_");
     return MarshalExceptions<RectI_C>([&](){
         return obj->GetBoundsI();
     });
@@ -684,6 +780,7 @@ ALTERNET_UI_API RectI_C Control_GetBoundsI_(Control* obj)
 
 ALTERNET_UI_API SizeD_C Control_GetClientSize_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetClientSize_");
     return MarshalExceptions<SizeD_C>([&](){
         return obj->GetClientSize();
     });
@@ -691,6 +788,7 @@ ALTERNET_UI_API SizeD_C Control_GetClientSize_(Control* obj)
 
 ALTERNET_UI_API void Control_SetBounds_(Control* obj, RectD* bounds)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetBounds_");
     MarshalExceptions<void>([&](){
         obj->SetBounds(*bounds);
     });
@@ -698,6 +796,7 @@ ALTERNET_UI_API void Control_SetBounds_(Control* obj, RectD* bounds)
 
 ALTERNET_UI_API void Control_SetBoundsI_(Control* obj, RectI* bounds)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetBoundsI_");
     MarshalExceptions<void>([&](){
         obj->SetBoundsI(*bounds);
     });
@@ -705,6 +804,7 @@ ALTERNET_UI_API void Control_SetBoundsI_(Control* obj, RectI* bounds)
 
 ALTERNET_UI_API void Control_SetClientSize_(Control* obj, SizeD* size)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetClientSize_");
     MarshalExceptions<void>([&](){
         obj->SetClientSize(*size);
     });
@@ -712,6 +812,7 @@ ALTERNET_UI_API void Control_SetClientSize_(Control* obj, SizeD* size)
 
 ALTERNET_UI_API Color_C Control_GetBackgroundColor_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetBackgroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetBackgroundColor();
     });
@@ -719,6 +820,7 @@ ALTERNET_UI_API Color_C Control_GetBackgroundColor_(Control* obj)
 
 ALTERNET_UI_API Color_C Control_GetForegroundColor_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetForegroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetForegroundColor();
     });
@@ -726,6 +828,7 @@ ALTERNET_UI_API Color_C Control_GetForegroundColor_(Control* obj)
 
 ALTERNET_UI_API void Control_SetBackgroundColor_(Control* obj, Color* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetBackgroundColor_");
     MarshalExceptions<void>([&](){
         obj->SetBackgroundColor(*value);
     });
@@ -733,6 +836,7 @@ ALTERNET_UI_API void Control_SetBackgroundColor_(Control* obj, Color* value)
 
 ALTERNET_UI_API void Control_SetForegroundColor_(Control* obj, Color* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetForegroundColor_");
     MarshalExceptions<void>([&](){
         obj->SetForegroundColor(*value);
     });
@@ -740,6 +844,7 @@ ALTERNET_UI_API void Control_SetForegroundColor_(Control* obj, Color* value)
 
 ALTERNET_UI_API void Control_SetFontRef_(Control* obj, void* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetFontRef_");
     MarshalExceptions<void>([&](){
         obj->SetFontRef(value);
     });
@@ -747,6 +852,7 @@ ALTERNET_UI_API void Control_SetFontRef_(Control* obj, void* value)
 
 ALTERNET_UI_API Control* Control_HitTest_(PointD* screenPoint)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_HitTest_");
     return MarshalExceptions<Control*>([&](){
         return Control::HitTest(*screenPoint);
     });
@@ -754,6 +860,7 @@ ALTERNET_UI_API Control* Control_HitTest_(PointD* screenPoint)
 
 ALTERNET_UI_API Control* Control_GetFocusedControl_()
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetFocusedControl_");
     return MarshalExceptions<Control*>([&](){
         return Control::GetFocusedControl();
     });
@@ -761,6 +868,7 @@ ALTERNET_UI_API Control* Control_GetFocusedControl_()
 
 ALTERNET_UI_API void Control_NotifyCaptureLost_()
 {
+    ALTERNET_UI_PERF_EXPORT("Control_NotifyCaptureLost_");
     MarshalExceptions<void>([&](){
         Control::NotifyCaptureLost();
     });
@@ -768,6 +876,7 @@ ALTERNET_UI_API void Control_NotifyCaptureLost_()
 
 ALTERNET_UI_API void Control_Freeze_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_Freeze_");
     MarshalExceptions<void>([&](){
         obj->Freeze();
     });
@@ -775,6 +884,7 @@ ALTERNET_UI_API void Control_Freeze_(Control* obj)
 
 ALTERNET_UI_API void Control_Thaw_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_Thaw_");
     MarshalExceptions<void>([&](){
         obj->Thaw();
     });
@@ -782,6 +892,7 @@ ALTERNET_UI_API void Control_Thaw_(Control* obj)
 
 ALTERNET_UI_API void Control_BeginIgnoreRecreate_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_BeginIgnoreRecreate_");
     MarshalExceptions<void>([&](){
         obj->BeginIgnoreRecreate();
     });
@@ -789,6 +900,7 @@ ALTERNET_UI_API void Control_BeginIgnoreRecreate_(Control* obj)
 
 ALTERNET_UI_API void Control_EndIgnoreRecreate_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_EndIgnoreRecreate_");
     MarshalExceptions<void>([&](){
         obj->EndIgnoreRecreate();
     });
@@ -796,6 +908,7 @@ ALTERNET_UI_API void Control_EndIgnoreRecreate_(Control* obj)
 
 ALTERNET_UI_API SizeD_C Control_GetDPI_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetDPI_");
     return MarshalExceptions<SizeD_C>([&](){
         return obj->GetDPI();
     });
@@ -803,6 +916,7 @@ ALTERNET_UI_API SizeD_C Control_GetDPI_(Control* obj)
 
 ALTERNET_UI_API void Control_SetMouseCapture_(Control* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetMouseCapture_");
     MarshalExceptions<void>([&](){
         obj->SetMouseCapture(value);
     });
@@ -810,6 +924,7 @@ ALTERNET_UI_API void Control_SetMouseCapture_(Control* obj, c_bool value)
 
 ALTERNET_UI_API void Control_AddChild_(Control* obj, Control* control)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_AddChild_");
     MarshalExceptions<void>([&](){
         obj->AddChild(control);
     });
@@ -817,6 +932,7 @@ ALTERNET_UI_API void Control_AddChild_(Control* obj, Control* control)
 
 ALTERNET_UI_API void Control_RemoveChild_(Control* obj, Control* control)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_RemoveChild_");
     MarshalExceptions<void>([&](){
         obj->RemoveChild(control);
     });
@@ -824,6 +940,7 @@ ALTERNET_UI_API void Control_RemoveChild_(Control* obj, Control* control)
 
 ALTERNET_UI_API void Control_Invalidate_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_Invalidate_");
     MarshalExceptions<void>([&](){
         obj->Invalidate();
     });
@@ -831,6 +948,7 @@ ALTERNET_UI_API void Control_Invalidate_(Control* obj)
 
 ALTERNET_UI_API void Control_Update_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_Update_");
     MarshalExceptions<void>([&](){
         obj->Update();
     });
@@ -838,6 +956,7 @@ ALTERNET_UI_API void Control_Update_(Control* obj)
 
 ALTERNET_UI_API DrawingContext* Control_OpenDrawingContextForDC_(void* dc, c_bool deleteDc)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_OpenDrawingContextForDC_");
     return MarshalExceptions<DrawingContext*>([&](){
         return Control::OpenDrawingContextForDC(dc, deleteDc);
     });
@@ -845,6 +964,7 @@ ALTERNET_UI_API DrawingContext* Control_OpenDrawingContextForDC_(void* dc, c_boo
 
 ALTERNET_UI_API void Control_InvalidateBestSize_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_InvalidateBestSize_");
     MarshalExceptions<void>([&](){
         obj->InvalidateBestSize();
     });
@@ -852,6 +972,7 @@ ALTERNET_UI_API void Control_InvalidateBestSize_(Control* obj)
 
 ALTERNET_UI_API SizeD_C Control_GetPreferredSize_(Control* obj, SizeD* availableSize)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetPreferredSize_");
     return MarshalExceptions<SizeD_C>([&](){
         return obj->GetPreferredSize(*availableSize);
     });
@@ -859,6 +980,7 @@ ALTERNET_UI_API SizeD_C Control_GetPreferredSize_(Control* obj, SizeD* available
 
 ALTERNET_UI_API void Control_SetFocusFlags_(Control* obj, c_bool canSelect, c_bool tabStop, c_bool acceptsFocusRecursively)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetFocusFlags_");
     MarshalExceptions<void>([&](){
         obj->SetFocusFlags(canSelect, tabStop, acceptsFocusRecursively);
     });
@@ -866,6 +988,7 @@ ALTERNET_UI_API void Control_SetFocusFlags_(Control* obj, c_bool canSelect, c_bo
 
 ALTERNET_UI_API DragDropEffects Control_DoDragDrop_(Control* obj, UnmanagedDataObject* data, DragDropEffects allowedEffects)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_DoDragDrop_");
     return MarshalExceptions<DragDropEffects>([&](){
         return obj->DoDragDrop(data, allowedEffects);
     });
@@ -873,6 +996,7 @@ ALTERNET_UI_API DragDropEffects Control_DoDragDrop_(Control* obj, UnmanagedDataO
 
 ALTERNET_UI_API void Control_BeginUpdate_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_BeginUpdate_");
     MarshalExceptions<void>([&](){
         obj->BeginUpdate();
     });
@@ -880,6 +1004,7 @@ ALTERNET_UI_API void Control_BeginUpdate_(Control* obj)
 
 ALTERNET_UI_API void Control_EndUpdate_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_EndUpdate_");
     MarshalExceptions<void>([&](){
         obj->EndUpdate();
     });
@@ -887,6 +1012,7 @@ ALTERNET_UI_API void Control_EndUpdate_(Control* obj)
 
 ALTERNET_UI_API void Control_RecreateWindow_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_RecreateWindow_");
     MarshalExceptions<void>([&](){
         obj->RecreateWindow();
     });
@@ -894,6 +1020,7 @@ ALTERNET_UI_API void Control_RecreateWindow_(Control* obj)
 
 ALTERNET_UI_API void Control_ResetBackgroundColor_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_ResetBackgroundColor_");
     MarshalExceptions<void>([&](){
         obj->ResetBackgroundColor();
     });
@@ -901,6 +1028,7 @@ ALTERNET_UI_API void Control_ResetBackgroundColor_(Control* obj)
 
 ALTERNET_UI_API void Control_ResetForegroundColor_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_ResetForegroundColor_");
     MarshalExceptions<void>([&](){
         obj->ResetForegroundColor();
     });
@@ -908,6 +1036,7 @@ ALTERNET_UI_API void Control_ResetForegroundColor_(Control* obj)
 
 ALTERNET_UI_API PointD_C Control_ClientToScreen_(Control* obj, PointD* point)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_ClientToScreen_");
     return MarshalExceptions<PointD_C>([&](){
         return obj->ClientToScreen(*point);
     });
@@ -915,6 +1044,7 @@ ALTERNET_UI_API PointD_C Control_ClientToScreen_(Control* obj, PointD* point)
 
 ALTERNET_UI_API PointD_C Control_ScreenToClient_(Control* obj, PointD* point)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_ScreenToClient_");
     return MarshalExceptions<PointD_C>([&](){
         return obj->ScreenToClient(*point);
     });
@@ -922,6 +1052,7 @@ ALTERNET_UI_API PointD_C Control_ScreenToClient_(Control* obj, PointD* point)
 
 ALTERNET_UI_API PointI_C Control_ScreenToDevice_(Control* obj, PointD* point)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_ScreenToDevice_");
     return MarshalExceptions<PointI_C>([&](){
         return obj->ScreenToDevice(*point);
     });
@@ -929,6 +1060,7 @@ ALTERNET_UI_API PointI_C Control_ScreenToDevice_(Control* obj, PointD* point)
 
 ALTERNET_UI_API PointD_C Control_DeviceToScreen_(Control* obj, PointI* point)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_DeviceToScreen_");
     return MarshalExceptions<PointD_C>([&](){
         return obj->DeviceToScreen(*point);
     });
@@ -936,6 +1068,7 @@ ALTERNET_UI_API PointD_C Control_DeviceToScreen_(Control* obj, PointI* point)
 
 ALTERNET_UI_API c_bool Control_SetFocus_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetFocus_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetFocus();
     });
@@ -943,6 +1076,7 @@ ALTERNET_UI_API c_bool Control_SetFocus_(Control* obj)
 
 ALTERNET_UI_API void Control_FocusNextControl_(Control* obj, c_bool forward, c_bool nested)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_FocusNextControl_");
     MarshalExceptions<void>([&](){
         obj->FocusNextControl(forward, nested);
     });
@@ -950,6 +1084,7 @@ ALTERNET_UI_API void Control_FocusNextControl_(Control* obj, c_bool forward, c_b
 
 ALTERNET_UI_API void Control_BeginInit_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_BeginInit_");
     MarshalExceptions<void>([&](){
         obj->BeginInit();
     });
@@ -957,6 +1092,7 @@ ALTERNET_UI_API void Control_BeginInit_(Control* obj)
 
 ALTERNET_UI_API void Control_EndInit_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_EndInit_");
     MarshalExceptions<void>([&](){
         obj->EndInit();
     });
@@ -964,6 +1100,7 @@ ALTERNET_UI_API void Control_EndInit_(Control* obj)
 
 ALTERNET_UI_API void Control_Destroy_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_Destroy_");
     MarshalExceptions<void>([&](){
         obj->Destroy();
     });
@@ -971,6 +1108,7 @@ ALTERNET_UI_API void Control_Destroy_(Control* obj)
 
 ALTERNET_UI_API void Control_SaveScreenshot_(Control* obj, NativeStringSpan* fileName)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SaveScreenshot_");
     MarshalExceptions<void>([&](){
         obj->SaveScreenshot(*fileName);
     });
@@ -978,6 +1116,7 @@ ALTERNET_UI_API void Control_SaveScreenshot_(Control* obj, NativeStringSpan* fil
 
 ALTERNET_UI_API void Control_SendSizeEvent_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SendSizeEvent_");
     MarshalExceptions<void>([&](){
         obj->SendSizeEvent();
     });
@@ -985,6 +1124,7 @@ ALTERNET_UI_API void Control_SendSizeEvent_(Control* obj)
 
 ALTERNET_UI_API void Control_SendMouseDownEvent_(Control* obj, int x, int y)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SendMouseDownEvent_");
     MarshalExceptions<void>([&](){
         obj->SendMouseDownEvent(x, y);
     });
@@ -992,6 +1132,7 @@ ALTERNET_UI_API void Control_SendMouseDownEvent_(Control* obj, int x, int y)
 
 ALTERNET_UI_API void Control_SendMouseUpEvent_(Control* obj, int x, int y)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SendMouseUpEvent_");
     MarshalExceptions<void>([&](){
         obj->SendMouseUpEvent(x, y);
     });
@@ -999,6 +1140,7 @@ ALTERNET_UI_API void Control_SendMouseUpEvent_(Control* obj, int x, int y)
 
 ALTERNET_UI_API void Control_SetBoundsEx_(Control* obj, RectD* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetBoundsEx_");
     MarshalExceptions<void>([&](){
         obj->SetBoundsEx(*rect, flags);
     });
@@ -1006,6 +1148,7 @@ ALTERNET_UI_API void Control_SetBoundsEx_(Control* obj, RectD* rect, int flags)
 
 ALTERNET_UI_API void* Control_GetContainingSizer_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetContainingSizer_");
     return MarshalExceptions<void*>([&](){
         return obj->GetContainingSizer();
     });
@@ -1013,6 +1156,7 @@ ALTERNET_UI_API void* Control_GetContainingSizer_(Control* obj)
 
 ALTERNET_UI_API void* Control_GetSizer_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetSizer_");
     return MarshalExceptions<void*>([&](){
         return obj->GetSizer();
     });
@@ -1020,6 +1164,7 @@ ALTERNET_UI_API void* Control_GetSizer_(Control* obj)
 
 ALTERNET_UI_API void Control_SetSizer_(Control* obj, void* sizer, c_bool deleteOld)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetSizer_");
     MarshalExceptions<void>([&](){
         obj->SetSizer(sizer, deleteOld);
     });
@@ -1027,6 +1172,7 @@ ALTERNET_UI_API void Control_SetSizer_(Control* obj, void* sizer, c_bool deleteO
 
 ALTERNET_UI_API void Control_SetSizerAndFit_(Control* obj, void* sizer, c_bool deleteOld)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_SetSizerAndFit_");
     MarshalExceptions<void>([&](){
         obj->SetSizerAndFit(sizer, deleteOld);
     });
@@ -1034,6 +1180,7 @@ ALTERNET_UI_API void Control_SetSizerAndFit_(Control* obj, void* sizer, c_bool d
 
 ALTERNET_UI_API int Control_GetScrollBarEvtKind_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetScrollBarEvtKind_");
     return MarshalExceptions<int>([&](){
         return obj->GetScrollBarEvtKind();
     });
@@ -1041,11 +1188,76 @@ ALTERNET_UI_API int Control_GetScrollBarEvtKind_(Control* obj)
 
 ALTERNET_UI_API int Control_GetScrollBarEvtPosition_(Control* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Control_GetScrollBarEvtPosition_");
     return MarshalExceptions<int>([&](){
         return obj->GetScrollBarEvtPosition();
     });
 }
 
+ALTERNET_UI_API void Control_FlushRecreate_(Control* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("Control_FlushRecreate_");
+    MarshalExceptions<void>([&](){
+        obj->FlushRecreate();
+    });
+}
+
+ALTERNET_UI_API void Control_FlushPendingRecreations_()
+{
+    ALTERNET_UI_PERF_EXPORT("Control_FlushPendingRecreations_");
+    MarshalExceptions<void>([&](){
+        Control::FlushPendingRecreations();
+    });
+}
+
+ALTERNET_UI_API NativeStringSpan_C Control_GetRecreationStats_()
+{
+    ALTERNET_UI_PERF_EXPORT("Control_GetRecreationStats_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return Control::GetRecreationStats();
+    });
+}
+
+ALTERNET_UI_API void Control_ResetRecreationStats_()
+{
+    ALTERNET_UI_PERF_EXPORT("Control_ResetRecreationStats_");
+    MarshalExceptions<void>([&](){
+        Control::ResetRecreationStats();
+    });
+}
+
+ALTERNET_UI_API void Control_SetWindowPoolGroup_(Control* obj, NativeStringSpan* value)
+{
+    ALTERNET_UI_PERF_EXPORT("Control_SetWindowPoolGroup_");
+    MarshalExceptions<void>([&](){
+        obj->SetWindowPoolGroup(*value);
+    });
+}
+
+ALTERNET_UI_API void Control_SetWindowPoolCapacity_(NativeStringSpan* group, int capacity)
+{
+    ALTERNET_UI_PERF_EXPORT("Control_SetWindowPoolCapacity_");
+    MarshalExceptions<void>([&](){
+        Control::SetWindowPoolCapacity(*group, capacity);
+    });
+}
+
+ALTERNET_UI_API NativeStringSpan_C Control_GetWindowPoolStats_()
+{
+    ALTERNET_UI_PERF_EXPORT("Control_GetWindowPoolStats_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return Control::GetWindowPoolStats();
+    });
+}
+
+ALTERNET_UI_API void Control_ClearWindowPool_()
+{
+    ALTERNET_UI_PERF_EXPORT("Control_ClearWindowPool_");
+    MarshalExceptions<void>([&](){
+        Control::ClearWindowPool();
+    });
+}
+
 ALTERNET_UI_API void Control_SetEventCallback_(Control::ControlEventCallbackType callback)
 {
     Control::SetEventCallback(callback);
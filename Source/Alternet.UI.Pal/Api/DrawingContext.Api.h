@@ -7,6 +7,7 @@
 #include "Font.h"
 #include "Brush.h"
 #include "Pen.h"
+#include "GenericImage.h"
 #include "ApiUtils.h"
 #include "Exceptions.h"
 
@@ -14,6 +15,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API c_bool DrawingContext_GetIsOk_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_GetIsOk_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsOk();
     });
@@ -21,6 +23,7 @@ ALTERNET_UI_API c_bool DrawingContext_GetIsOk_(DrawingContext* obj)
 
 ALTERNET_UI_API void* DrawingContext_GetWxWidgetDC_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_GetWxWidgetDC_");
     return MarshalExceptions<void*>([&](){
         return obj->GetWxWidgetDC();
     });
@@ -28,6 +31,7 @@ ALTERNET_UI_API void* DrawingContext_GetWxWidgetDC_(DrawingContext* obj)
 
 ALTERNET_UI_API InterpolationMode DrawingContext_GetInterpolationMode_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_GetInterpolationMode_");
     return MarshalExceptions<InterpolationMode>([&](){
         return obj->GetInterpolationMode();
     });
@@ -35,6 +39,7 @@ ALTERNET_UI_API InterpolationMode DrawingContext_GetInterpolationMode_(DrawingCo
 
 ALTERNET_UI_API void DrawingContext_SetInterpolationMode_(DrawingContext* obj, InterpolationMode value)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_SetInterpolationMode_");
     MarshalExceptions<void>([&](){
         obj->SetInterpolationMode(value);
     });
@@ -42,6 +47,7 @@ ALTERNET_UI_API void DrawingContext_SetInterpolationMode_(DrawingContext* obj, I
 
 ALTERNET_UI_API DrawingContext* DrawingContext_CreateMemoryDC_(float scaleFactor)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_CreateMemoryDC_");
     return MarshalExceptions<DrawingContext*>([&](){
         return DrawingContext::CreateMemoryDC(scaleFactor);
     });
@@ -49,6 +55,7 @@ ALTERNET_UI_API DrawingContext* DrawingContext_CreateMemoryDC_(float scaleFactor
 
 ALTERNET_UI_API DrawingContext* DrawingContext_CreateMemoryDCFromImage_(Image* image)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_CreateMemoryDCFromImage_");
     return MarshalExceptions<DrawingContext*>([&](){
         return DrawingContext::CreateMemoryDCFromImage(image);
     });
@@ -56,6 +63,7 @@ ALTERNET_UI_API DrawingContext* DrawingContext_CreateMemoryDCFromImage_(Image* i
 
 ALTERNET_UI_API void* DrawingContext_GetHandle_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_GetHandle_");
     return MarshalExceptions<void*>([&](){
         return obj->GetHandle();
     });
@@ -63,6 +71,7 @@ ALTERNET_UI_API void* DrawingContext_GetHandle_(DrawingContext* obj)
 
 ALTERNET_UI_API void DrawingContext_Save_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_Save_");
     MarshalExceptions<void>([&](){
         obj->Save();
     });
@@ -70,6 +79,7 @@ ALTERNET_UI_API void DrawingContext_Save_(DrawingContext* obj)
 
 ALTERNET_UI_API void DrawingContext_Restore_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_Restore_");
     MarshalExceptions<void>([&](){
         obj->Restore();
     });
@@ -77,6 +87,7 @@ ALTERNET_UI_API void DrawingContext_Restore_(DrawingContext* obj)
 
 ALTERNET_UI_API void DrawingContext_SetClippingRect_(DrawingContext* obj, RectD* rect)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_SetClippingRect_");
     MarshalExceptions<void>([&](){
         obj->SetClippingRect(*rect);
     });
@@ -84,6 +95,7 @@ ALTERNET_UI_API void DrawingContext_SetClippingRect_(DrawingContext* obj, RectD*
 
 ALTERNET_UI_API RectD_C DrawingContext_GetClippingBox_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_GetClippingBox_");
     return MarshalExceptions<RectD_C>([&](){
         return obj->GetClippingBox();
     });
@@ -91,6 +103,7 @@ ALTERNET_UI_API RectD_C DrawingContext_GetClippingBox_(DrawingContext* obj)
 
 ALTERNET_UI_API SizeI_C DrawingContext_GetSize_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_GetSize_");
     return MarshalExceptions<SizeI_C>([&](){
         return obj->GetSize();
     });
@@ -98,6 +111,7 @@ ALTERNET_UI_API SizeI_C DrawingContext_GetSize_(DrawingContext* obj)
 
 ALTERNET_UI_API SizeI_C DrawingContext_GetPPI_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_GetPPI_");
     return MarshalExceptions<SizeI_C>([&](){
         return obj->GetPPI();
     });
@@ -105,6 +119,7 @@ ALTERNET_UI_API SizeI_C DrawingContext_GetPPI_(DrawingContext* obj)
 
 ALTERNET_UI_API void DrawingContext_DrawBitmapAtPointI_(DrawingContext* obj, Image* image, int x, int y, c_bool useMask)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawBitmapAtPointI_");
     MarshalExceptions<void>([&](){
         obj->DrawBitmapAtPointI(image, x, y, useMask);
     });
@@ -112,6 +127,7 @@ ALTERNET_UI_API void DrawingContext_DrawBitmapAtPointI_(DrawingContext* obj, Ima
 
 ALTERNET_UI_API void DrawingContext_DrawBitmapAtRectI_(DrawingContext* obj, Image* image, RectI* rect, c_bool useMask)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawBitmapAtRectI_");
     MarshalExceptions<void>([&](){
         obj->DrawBitmapAtRectI(image, *rect, useMask);
     });
@@ -119,6 +135,7 @@ ALTERNET_UI_API void DrawingContext_DrawBitmapAtRectI_(DrawingContext* obj, Imag
 
 ALTERNET_UI_API void DrawingContext_DrawText_(DrawingContext* obj, NativeStringSpan* text, PointD* location, Font* font, Color* foreColor, Brush* backColor, float angle, c_bool useBrush)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawText_");
     MarshalExceptions<void>([&](){
         obj->DrawText(*text, *location, font, *foreColor, backColor, angle, useBrush);
     });
@@ -126,6 +143,7 @@ ALTERNET_UI_API void DrawingContext_DrawText_(DrawingContext* obj, NativeStringS
 
 ALTERNET_UI_API SizeI_C DrawingContext_GetDpi_(DrawingContext* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_GetDpi_");
     return MarshalExceptions<SizeI_C>([&](){
         return obj->GetDpi();
     });
@@ -133,6 +151,7 @@ ALTERNET_UI_API SizeI_C DrawingContext_GetDpi_(DrawingContext* obj)
 
 ALTERNET_UI_API void DrawingContext_ImageFromDrawingContext_(Image* image, int width, int height, DrawingContext* dc)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_ImageFromDrawingContext_");
     MarshalExceptions<void>([&](){
         DrawingContext::ImageFromDrawingContext(image, width, height, dc);
     });
@@ -140,6 +159,7 @@ ALTERNET_UI_API void DrawingContext_ImageFromDrawingContext_(Image* image, int w
 
 ALTERNET_UI_API void DrawingContext_ImageFromGenericImageDC_(Image* image, void* source, DrawingContext* dc)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_ImageFromGenericImageDC_");
     MarshalExceptions<void>([&](){
         DrawingContext::ImageFromGenericImageDC(image, source, dc);
     });
@@ -147,6 +167,7 @@ ALTERNET_UI_API void DrawingContext_ImageFromGenericImageDC_(Image* image, void*
 
 ALTERNET_UI_API SizeD_C DrawingContext_GetTextExtentSimple_(DrawingContext* obj, NativeStringSpan* text, void* font)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_GetTextExtentSimple_");
     return MarshalExceptions<SizeD_C>([&](){
         return obj->GetTextExtentSimple(*text, font);
     });
@@ -154,6 +175,7 @@ ALTERNET_UI_API SizeD_C DrawingContext_GetTextExtentSimple_(DrawingContext* obj,
 
 ALTERNET_UI_API DrawingContext* DrawingContext_FromImage_(Image* image)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_FromImage_");
     return MarshalExceptions<DrawingContext*>([&](){
         return DrawingContext::FromImage(image);
     });
@@ -161,6 +183,7 @@ ALTERNET_UI_API DrawingContext* DrawingContext_FromImage_(Image* image)
 
 ALTERNET_UI_API DrawingContext* DrawingContext_FromScreen_()
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_FromScreen_");
     return MarshalExceptions<DrawingContext*>([&](){
         return DrawingContext::FromScreen();
     });
@@ -168,6 +191,7 @@ ALTERNET_UI_API DrawingContext* DrawingContext_FromScreen_()
 
 ALTERNET_UI_API void DrawingContext_RoundedRectangle_(DrawingContext* obj, Pen* pen, Brush* brush, RectD* rectangle, float cornerRadius)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_RoundedRectangle_");
     MarshalExceptions<void>([&](){
         obj->RoundedRectangle(pen, brush, *rectangle, cornerRadius);
     });
@@ -175,6 +199,7 @@ ALTERNET_UI_API void DrawingContext_RoundedRectangle_(DrawingContext* obj, Pen*
 
 ALTERNET_UI_API void DrawingContext_Rectangle_(DrawingContext* obj, Pen* pen, Brush* brush, RectD* rectangle)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_Rectangle_");
     MarshalExceptions<void>([&](){
         obj->Rectangle(pen, brush, *rectangle);
     });
@@ -182,6 +207,7 @@ ALTERNET_UI_API void DrawingContext_Rectangle_(DrawingContext* obj, Pen* pen, Br
 
 ALTERNET_UI_API void DrawingContext_Ellipse_(DrawingContext* obj, Pen* pen, Brush* brush, RectD* rectangle)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_Ellipse_");
     MarshalExceptions<void>([&](){
         obj->Ellipse(pen, brush, *rectangle);
     });
@@ -189,6 +215,7 @@ ALTERNET_UI_API void DrawingContext_Ellipse_(DrawingContext* obj, Pen* pen, Brus
 
 ALTERNET_UI_API void DrawingContext_Circle_(DrawingContext* obj, Pen* pen, Brush* brush, PointD* center, float radius)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_Circle_");
     MarshalExceptions<void>([&](){
         obj->Circle(pen, brush, *center, radius);
     });
@@ -196,6 +223,7 @@ ALTERNET_UI_API void DrawingContext_Circle_(DrawingContext* obj, Pen* pen, Brush
 
 ALTERNET_UI_API void DrawingContext_FillRectangle_(DrawingContext* obj, Brush* brush, RectD* rectangle)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_FillRectangle_");
     MarshalExceptions<void>([&](){
         obj->FillRectangle(brush, *rectangle);
     });
@@ -203,6 +231,7 @@ ALTERNET_UI_API void DrawingContext_FillRectangle_(DrawingContext* obj, Brush* b
 
 ALTERNET_UI_API void DrawingContext_FillRectangleI_(DrawingContext* obj, Brush* brush, RectI* rectangle)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_FillRectangleI_");
     MarshalExceptions<void>([&](){
         obj->FillRectangleI(brush, *rectangle);
     });
@@ -210,6 +239,7 @@ ALTERNET_UI_API void DrawingContext_FillRectangleI_(DrawingContext* obj, Brush*
 
 ALTERNET_UI_API void DrawingContext_DrawRectangle_(DrawingContext* obj, Pen* pen, RectD* rectangle)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawRectangle_");
     MarshalExceptions<void>([&](){
         obj->DrawRectangle(pen, *rectangle);
     });
@@ -217,6 +247,7 @@ ALTERNET_UI_API void DrawingContext_DrawRectangle_(DrawingContext* obj, Pen* pen
 
 ALTERNET_UI_API void DrawingContext_FillEllipse_(DrawingContext* obj, Brush* brush, RectD* bounds)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_FillEllipse_");
     MarshalExceptions<void>([&](){
         obj->FillEllipse(brush, *bounds);
     });
@@ -224,6 +255,7 @@ ALTERNET_UI_API void DrawingContext_FillEllipse_(DrawingContext* obj, Brush* bru
 
 ALTERNET_UI_API void DrawingContext_DrawEllipse_(DrawingContext* obj, Pen* pen, RectD* bounds)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawEllipse_");
     MarshalExceptions<void>([&](){
         obj->DrawEllipse(pen, *bounds);
     });
@@ -231,6 +263,7 @@ ALTERNET_UI_API void DrawingContext_DrawEllipse_(DrawingContext* obj, Pen* pen,
 
 ALTERNET_UI_API void DrawingContext_DrawImageAtPoint_(DrawingContext* obj, Image* image, PointD* origin, c_bool useMask)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawImageAtPoint_");
     MarshalExceptions<void>([&](){
         obj->DrawImageAtPoint(image, *origin, useMask);
     });
@@ -238,6 +271,7 @@ ALTERNET_UI_API void DrawingContext_DrawImageAtPoint_(DrawingContext* obj, Image
 
 ALTERNET_UI_API void DrawingContext_DrawImageAtRect_(DrawingContext* obj, Image* image, RectD* destinationRect, c_bool useMask)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawImageAtRect_");
     MarshalExceptions<void>([&](){
         obj->DrawImageAtRect(image, *destinationRect, useMask);
     });
@@ -245,6 +279,7 @@ ALTERNET_UI_API void DrawingContext_DrawImageAtRect_(DrawingContext* obj, Image*
 
 ALTERNET_UI_API void DrawingContext_SetTransformValues_(DrawingContext* obj, float m11, float m12, float m21, float m22, float dx, float dy)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_SetTransformValues_");
     MarshalExceptions<void>([&](){
         obj->SetTransformValues(m11, m12, m21, m22, dx, dy);
     });
@@ -252,6 +287,7 @@ ALTERNET_UI_API void DrawingContext_SetTransformValues_(DrawingContext* obj, flo
 
 ALTERNET_UI_API void DrawingContext_DrawLine_(DrawingContext* obj, Pen* pen, PointD* a, PointD* b)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawLine_");
     MarshalExceptions<void>([&](){
         obj->DrawLine(pen, *a, *b);
     });
@@ -259,6 +295,7 @@ ALTERNET_UI_API void DrawingContext_DrawLine_(DrawingContext* obj, Pen* pen, Poi
 
 ALTERNET_UI_API void DrawingContext_DrawPoint_(DrawingContext* obj, Pen* pen, float x, float y)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawPoint_");
     MarshalExceptions<void>([&](){
         obj->DrawPoint(pen, x, y);
     });
@@ -266,6 +303,7 @@ ALTERNET_UI_API void DrawingContext_DrawPoint_(DrawingContext* obj, Pen* pen, fl
 
 ALTERNET_UI_API void DrawingContext_DrawCircle_(DrawingContext* obj, Pen* pen, PointD* center, float radius)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawCircle_");
     MarshalExceptions<void>([&](){
         obj->DrawCircle(pen, *center, radius);
     });
@@ -273,6 +311,7 @@ ALTERNET_UI_API void DrawingContext_DrawCircle_(DrawingContext* obj, Pen* pen, P
 
 ALTERNET_UI_API void DrawingContext_FillCircle_(DrawingContext* obj, Brush* brush, PointD* center, float radius)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_FillCircle_");
     MarshalExceptions<void>([&](){
         obj->FillCircle(brush, *center, radius);
     });
@@ -280,6 +319,7 @@ ALTERNET_UI_API void DrawingContext_FillCircle_(DrawingContext* obj, Brush* brus
 
 ALTERNET_UI_API void DrawingContext_DrawRoundedRectangle_(DrawingContext* obj, Pen* pen, RectD* rect, float cornerRadius)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawRoundedRectangle_");
     MarshalExceptions<void>([&](){
         obj->DrawRoundedRectangle(pen, *rect, cornerRadius);
     });
@@ -287,8 +327,49 @@ ALTERNET_UI_API void DrawingContext_DrawRoundedRectangle_(DrawingContext* obj, P
 
 ALTERNET_UI_API void DrawingContext_FillRoundedRectangle_(DrawingContext* obj, Brush* brush, RectD* rect, float cornerRadius)
 {
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_FillRoundedRectangle_");
     MarshalExceptions<void>([&](){
         obj->FillRoundedRectangle(brush, *rect, cornerRadius);
     });
 }
 
+ALTERNET_UI_API DrawingContext* DrawingContext_CreateHeadless_(GenericImage* target)
+{
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_CreateHeadless_");
+    return MarshalExceptions<DrawingContext*>([&](){
+        return DrawingContext::CreateHeadless(target);
+    });
+}
+
+ALTERNET_UI_API void DrawingContext_Flush_(DrawingContext* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_Flush_");
+    MarshalExceptions<void>([&](){
+        obj->Flush();
+    });
+}
+
+ALTERNET_UI_API void DrawingContext_FillRectangles_(DrawingContext* obj, Brush* brush, float* rects, int rectsCount)
+{
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_FillRectangles_");
+    MarshalExceptions<void>([&](){
+        obj->FillRectangles(brush, rects, rectsCount);
+    });
+}
+
+ALTERNET_UI_API void DrawingContext_DrawLineSegments_(DrawingContext* obj, Pen* pen, float* points, int pointsCount)
+{
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawLineSegments_");
+    MarshalExceptions<void>([&](){
+        obj->DrawLineSegments(pen, points, pointsCount);
+    });
+}
+
+ALTERNET_UI_API void DrawingContext_DrawLines_(DrawingContext* obj, Pen* pen, float* points, int pointsCount)
+{
+    ALTERNET_UI_PERF_EXPORT("DrawingContext_DrawLines_");
+    MarshalExceptions<void>([&](){
+        obj->DrawLines(pen, points, pointsCount);
+    });
+}
+
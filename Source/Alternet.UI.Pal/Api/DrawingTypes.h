@@ -781,6 +781,24 @@ constexpr Coord M_PI_Coord = 3.1415927f;
 			fromDipSf(value.Y, scaleFactor));
 	};
 
+	inline wxRect fromDipSf(const Rect& value, float scaleFactor)
+	{
+		return wxRect(
+			fromDipSf(value.X, scaleFactor),
+			fromDipSf(value.Y, scaleFactor),
+			fromDipSf(value.Width, scaleFactor),
+			fromDipSf(value.Height, scaleFactor));
+	};
+
+	inline Rect fromDipFSf(const Rect& value, float scaleFactor)
+	{
+		return Rect(
+			value.X * scaleFactor,
+			value.Y * scaleFactor,
+			value.Width * scaleFactor,
+			value.Height * scaleFactor);
+	};
+
 	inline Point fromDipF(const Point& value, wxWindow* window)
 	{
 		return Point(
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API FileDialog* FileDialog_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_Create_");
     return MarshalExceptions<FileDialog*>([&](){
         return new FileDialog();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API FileDialog* FileDialog_Create_()
 
 ALTERNET_UI_API c_bool FileDialog_GetOverwritePrompt_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetOverwritePrompt_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetOverwritePrompt();
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API c_bool FileDialog_GetOverwritePrompt_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetOverwritePrompt_(FileDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetOverwritePrompt_");
     MarshalExceptions<void>([&](){
         obj->SetOverwritePrompt(value);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void FileDialog_SetOverwritePrompt_(FileDialog* obj, c_bool valu
 
 ALTERNET_UI_API c_bool FileDialog_GetNoShortcutFollow_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetNoShortcutFollow_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetNoShortcutFollow();
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API c_bool FileDialog_GetNoShortcutFollow_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetNoShortcutFollow_(FileDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetNoShortcutFollow_");
     MarshalExceptions<void>([&](){
         obj->SetNoShortcutFollow(value);
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API void FileDialog_SetNoShortcutFollow_(FileDialog* obj, c_bool val
 
 ALTERNET_UI_API c_bool FileDialog_GetFileMustExist_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetFileMustExist_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetFileMustExist();
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API c_bool FileDialog_GetFileMustExist_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetFileMustExist_(FileDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetFileMustExist_");
     MarshalExceptions<void>([&](){
         obj->SetFileMustExist(value);
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API void FileDialog_SetFileMustExist_(FileDialog* obj, c_bool value)
 
 ALTERNET_UI_API c_bool FileDialog_GetChangeDir_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetChangeDir_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetChangeDir();
     });
@@ -67,6 +75,7 @@ ALTERNET_UI_API c_bool FileDialog_GetChangeDir_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetChangeDir_(FileDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetChangeDir_");
     MarshalExceptions<void>([&](){
         obj->SetChangeDir(value);
     });
@@ -74,6 +83,7 @@ ALTERNET_UI_API void FileDialog_SetChangeDir_(FileDialog* obj, c_bool value)
 
 ALTERNET_UI_API c_bool FileDialog_GetPreviewFiles_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetPreviewFiles_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetPreviewFiles();
     });
@@ -81,6 +91,7 @@ ALTERNET_UI_API c_bool FileDialog_GetPreviewFiles_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetPreviewFiles_(FileDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetPreviewFiles_");
     MarshalExceptions<void>([&](){
         obj->SetPreviewFiles(value);
     });
@@ -88,6 +99,7 @@ ALTERNET_UI_API void FileDialog_SetPreviewFiles_(FileDialog* obj, c_bool value)
 
 ALTERNET_UI_API c_bool FileDialog_GetShowHiddenFiles_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetShowHiddenFiles_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowHiddenFiles();
     });
@@ -95,6 +107,7 @@ ALTERNET_UI_API c_bool FileDialog_GetShowHiddenFiles_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetShowHiddenFiles_(FileDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetShowHiddenFiles_");
     MarshalExceptions<void>([&](){
         obj->SetShowHiddenFiles(value);
     });
@@ -102,6 +115,7 @@ ALTERNET_UI_API void FileDialog_SetShowHiddenFiles_(FileDialog* obj, c_bool valu
 
 ALTERNET_UI_API int FileDialog_GetSelectedFilterIndex_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetSelectedFilterIndex_");
     return MarshalExceptions<int>([&](){
         return obj->GetSelectedFilterIndex();
     });
@@ -109,6 +123,7 @@ ALTERNET_UI_API int FileDialog_GetSelectedFilterIndex_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetSelectedFilterIndex_(FileDialog* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetSelectedFilterIndex_");
     MarshalExceptions<void>([&](){
         obj->SetSelectedFilterIndex(value);
     });
@@ -116,6 +131,7 @@ ALTERNET_UI_API void FileDialog_SetSelectedFilterIndex_(FileDialog* obj, int val
 
 ALTERNET_UI_API FileDialogMode FileDialog_GetMode_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetMode_");
     return MarshalExceptions<FileDialogMode>([&](){
         return obj->GetMode();
     });
@@ -123,6 +139,7 @@ ALTERNET_UI_API FileDialogMode FileDialog_GetMode_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetMode_(FileDialog* obj, FileDialogMode value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetMode_");
     MarshalExceptions<void>([&](){
         obj->SetMode(value);
     });
@@ -130,6 +147,7 @@ ALTERNET_UI_API void FileDialog_SetMode_(FileDialog* obj, FileDialogMode value)
 
 ALTERNET_UI_API c_bool FileDialog_GetAllowMultipleSelection_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetAllowMultipleSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowMultipleSelection();
     });
@@ -137,6 +155,7 @@ ALTERNET_UI_API c_bool FileDialog_GetAllowMultipleSelection_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetAllowMultipleSelection_(FileDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetAllowMultipleSelection_");
     MarshalExceptions<void>([&](){
         obj->SetAllowMultipleSelection(value);
     });
@@ -144,6 +163,7 @@ ALTERNET_UI_API void FileDialog_SetAllowMultipleSelection_(FileDialog* obj, c_bo
 
 ALTERNET_UI_API NativeStringSpan_C FileDialog_GetFileNames_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetFileNames_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetFileNames();
     });
@@ -151,6 +171,7 @@ ALTERNET_UI_API NativeStringSpan_C FileDialog_GetFileNames_(FileDialog* obj)
 
 ALTERNET_UI_API NativeStringSpan_C FileDialog_GetInitialDirectory_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetInitialDirectory_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetInitialDirectory();
     });
@@ -158,6 +179,7 @@ ALTERNET_UI_API NativeStringSpan_C FileDialog_GetInitialDirectory_(FileDialog* o
 
 ALTERNET_UI_API void FileDialog_SetInitialDirectory_(FileDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetInitialDirectory_");
     MarshalExceptions<void>([&](){
         obj->SetInitialDirectory(*value);
     });
@@ -165,6 +187,7 @@ ALTERNET_UI_API void FileDialog_SetInitialDirectory_(FileDialog* obj, NativeStri
 
 ALTERNET_UI_API NativeStringSpan_C FileDialog_GetTitle_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetTitle_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetTitle();
     });
@@ -172,6 +195,7 @@ ALTERNET_UI_API NativeStringSpan_C FileDialog_GetTitle_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetTitle_(FileDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetTitle_");
     MarshalExceptions<void>([&](){
         obj->SetTitle(*value);
     });
@@ -179,6 +203,7 @@ ALTERNET_UI_API void FileDialog_SetTitle_(FileDialog* obj, NativeStringSpan* val
 
 ALTERNET_UI_API NativeStringSpan_C FileDialog_GetFilter_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetFilter_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetFilter();
     });
@@ -186,6 +211,7 @@ ALTERNET_UI_API NativeStringSpan_C FileDialog_GetFilter_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetFilter_(FileDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetFilter_");
     MarshalExceptions<void>([&](){
         obj->SetFilter(*value);
     });
@@ -193,6 +219,7 @@ ALTERNET_UI_API void FileDialog_SetFilter_(FileDialog* obj, NativeStringSpan* va
 
 ALTERNET_UI_API NativeStringSpan_C FileDialog_GetFileName_(FileDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_GetFileName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetFileName();
     });
@@ -200,6 +227,7 @@ ALTERNET_UI_API NativeStringSpan_C FileDialog_GetFileName_(FileDialog* obj)
 
 ALTERNET_UI_API void FileDialog_SetFileName_(FileDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_SetFileName_");
     MarshalExceptions<void>([&](){
         obj->SetFileName(*value);
     });
@@ -207,6 +235,7 @@ ALTERNET_UI_API void FileDialog_SetFileName_(FileDialog* obj, NativeStringSpan*
 
 ALTERNET_UI_API ModalResult FileDialog_ShowModal_(FileDialog* obj, Window* owner)
 {
+    ALTERNET_UI_PERF_EXPORT("FileDialog_ShowModal_");
     return MarshalExceptions<ModalResult>([&](){
         return obj->ShowModal(owner);
     });
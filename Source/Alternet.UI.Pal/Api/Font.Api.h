@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Font* Font_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Font_Create_");
     return MarshalExceptions<Font*>([&](){
         return new Font();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API Font* Font_Create_()
 
 ALTERNET_UI_API float Font_GetSizeInPoints_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetSizeInPoints_");
     return MarshalExceptions<float>([&](){
         return obj->GetSizeInPoints();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API float Font_GetSizeInPoints_(Font* obj)
 
 ALTERNET_UI_API FontStyle Font_GetStyle_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetStyle_");
     return MarshalExceptions<FontStyle>([&](){
         return obj->GetStyle();
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API FontStyle Font_GetStyle_(Font* obj)
 
 ALTERNET_UI_API void* Font_CreateFontRef_(GenericFontFamily genericFamily, NativeStringSpan* familyName, float emSizeInPoints, FontStyle style)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_CreateFontRef_");
     return MarshalExceptions<void*>([&](){
         return Font::CreateFontRef(genericFamily, *familyName, emSizeInPoints, style);
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API void* Font_CreateFontRef_(GenericFontFamily genericFamily, Nativ
 
 ALTERNET_UI_API void* Font_CreateFontRefDefault_()
 {
+    ALTERNET_UI_PERF_EXPORT("Font_CreateFontRefDefault_");
     return MarshalExceptions<void*>([&](){
         return Font::CreateFontRefDefault();
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void* Font_CreateFontRefDefault_()
 
 ALTERNET_UI_API void* Font_CreateFontRefDefaultMono_()
 {
+    ALTERNET_UI_PERF_EXPORT("Font_CreateFontRefDefaultMono_");
     return MarshalExceptions<void*>([&](){
         return Font::CreateFontRefDefaultMono();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API void* Font_CreateFontRefDefaultMono_()
 
 ALTERNET_UI_API void Font_DeleteFontRef_(void* fontRef)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_DeleteFontRef_");
     MarshalExceptions<void>([&](){
         Font::DeleteFontRef(fontRef);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void Font_DeleteFontRef_(void* fontRef)
 
 ALTERNET_UI_API SizeI_C Font_GetPixelSize_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetPixelSize_");
     return MarshalExceptions<SizeI_C>([&](){
         return obj->GetPixelSize();
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API SizeI_C Font_GetPixelSize_(Font* obj)
 
 ALTERNET_UI_API c_bool Font_IsUsingSizeInPixels_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_IsUsingSizeInPixels_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsUsingSizeInPixels();
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API c_bool Font_IsUsingSizeInPixels_(Font* obj)
 
 ALTERNET_UI_API int Font_GetNumericWeight_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetNumericWeight_");
     return MarshalExceptions<int>([&](){
         return obj->GetNumericWeight();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API int Font_GetNumericWeight_(Font* obj)
 
 ALTERNET_UI_API c_bool Font_GetUnderlined_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetUnderlined_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetUnderlined();
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API c_bool Font_GetUnderlined_(Font* obj)
 
 ALTERNET_UI_API c_bool Font_GetItalic_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetItalic_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetItalic();
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API c_bool Font_GetItalic_(Font* obj)
 
 ALTERNET_UI_API c_bool Font_GetStrikethrough_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetStrikethrough_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetStrikethrough();
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API c_bool Font_GetStrikethrough_(Font* obj)
 
 ALTERNET_UI_API int Font_GetEncoding_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetEncoding_");
     return MarshalExceptions<int>([&](){
         return obj->GetEncoding();
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API int Font_GetEncoding_(Font* obj)
 
 ALTERNET_UI_API c_bool Font_IsFixedWidth_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_IsFixedWidth_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsFixedWidth();
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API c_bool Font_IsFixedWidth_(Font* obj)
 
 ALTERNET_UI_API int Font_GetDefaultEncoding_()
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetDefaultEncoding_");
     return MarshalExceptions<int>([&](){
         return Font::GetDefaultEncoding();
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API int Font_GetDefaultEncoding_()
 
 ALTERNET_UI_API void Font_SetDefaultEncoding_(int encoding)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_SetDefaultEncoding_");
     MarshalExceptions<void>([&](){
         Font::SetDefaultEncoding(encoding);
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API void Font_SetDefaultEncoding_(int encoding)
 
 ALTERNET_UI_API int Font_GetWeight_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetWeight_");
     return MarshalExceptions<int>([&](){
         return obj->GetWeight();
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API int Font_GetWeight_(Font* obj)
 
 ALTERNET_UI_API void Font_Initialize_(Font* obj, GenericFontFamily genericFamily, NativeStringSpan* familyName, float emSizeInPoints, FontStyle style)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_Initialize_");
     MarshalExceptions<void>([&](){
         obj->Initialize(genericFamily, *familyName, emSizeInPoints, style);
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API void Font_Initialize_(Font* obj, GenericFontFamily genericFamily
 
 ALTERNET_UI_API void Font_InitializeWithDefaultFont_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_InitializeWithDefaultFont_");
     MarshalExceptions<void>([&](){
         obj->InitializeWithDefaultFont();
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API void Font_InitializeWithDefaultFont_(Font* obj)
 
 ALTERNET_UI_API void Font_InitializeWithDefaultMonoFont_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_InitializeWithDefaultMonoFont_");
     MarshalExceptions<void>([&](){
         obj->InitializeWithDefaultMonoFont();
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API void Font_InitializeWithDefaultMonoFont_(Font* obj)
 
 ALTERNET_UI_API void Font_InitializeFromFontRef_(Font* obj, void* font)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_InitializeFromFontRef_");
     MarshalExceptions<void>([&](){
         obj->InitializeFromFontRef(font);
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API void Font_InitializeFromFontRef_(Font* obj, void* font)
 
 ALTERNET_UI_API c_bool Font_IsFamilyValid_(NativeStringSpan* fontFamily)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_IsFamilyValid_");
     return MarshalExceptions<c_bool>([&](){
         return Font::IsFamilyValid(*fontFamily);
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API c_bool Font_IsFamilyValid_(NativeStringSpan* fontFamily)
 
 ALTERNET_UI_API NativeStringSpan_C Font_GetGenericFamilyName_(GenericFontFamily genericFamily)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetGenericFamilyName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return Font::GetGenericFamilyName(genericFamily);
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API NativeStringSpan_C Font_GetGenericFamilyName_(GenericFontFamily
 
 ALTERNET_UI_API NativeStringSpan_C Font_GetFamilies_()
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetFamilies_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return Font::GetFamilies();
     });
@@ -185,6 +210,7 @@ ALTERNET_UI_API NativeStringSpan_C Font_GetFamilies_()
 
 ALTERNET_UI_API NativeStringSpan_C Font_GetName_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetName();
     });
@@ -192,6 +218,7 @@ ALTERNET_UI_API NativeStringSpan_C Font_GetName_(Font* obj)
 
 ALTERNET_UI_API NativeStringSpan_C Font_GetDescription_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_GetDescription_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetDescription();
     });
@@ -199,6 +226,7 @@ ALTERNET_UI_API NativeStringSpan_C Font_GetDescription_(Font* obj)
 
 ALTERNET_UI_API c_bool Font_IsEqualTo_(Font* obj, Font* other)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_IsEqualTo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsEqualTo(other);
     });
@@ -206,6 +234,7 @@ ALTERNET_UI_API c_bool Font_IsEqualTo_(Font* obj, Font* other)
 
 ALTERNET_UI_API NativeStringSpan_C Font_Serialize_(Font* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Font_Serialize_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->Serialize();
     });
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API FontDialog* FontDialog_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_Create_");
     return MarshalExceptions<FontDialog*>([&](){
         return new FontDialog();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API FontDialog* FontDialog_Create_()
 
 ALTERNET_UI_API c_bool FontDialog_GetAllowSymbols_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetAllowSymbols_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowSymbols();
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API c_bool FontDialog_GetAllowSymbols_(FontDialog* obj)
 
 ALTERNET_UI_API void FontDialog_SetAllowSymbols_(FontDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_SetAllowSymbols_");
     MarshalExceptions<void>([&](){
         obj->SetAllowSymbols(value);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void FontDialog_SetAllowSymbols_(FontDialog* obj, c_bool value)
 
 ALTERNET_UI_API c_bool FontDialog_GetShowHelp_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetShowHelp_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowHelp();
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API c_bool FontDialog_GetShowHelp_(FontDialog* obj)
 
 ALTERNET_UI_API void FontDialog_SetShowHelp_(FontDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_SetShowHelp_");
     MarshalExceptions<void>([&](){
         obj->SetShowHelp(value);
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API void FontDialog_SetShowHelp_(FontDialog* obj, c_bool value)
 
 ALTERNET_UI_API c_bool FontDialog_GetEnableEffects_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetEnableEffects_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetEnableEffects();
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API c_bool FontDialog_GetEnableEffects_(FontDialog* obj)
 
 ALTERNET_UI_API void FontDialog_SetEnableEffects_(FontDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_SetEnableEffects_");
     MarshalExceptions<void>([&](){
         obj->SetEnableEffects(value);
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API void FontDialog_SetEnableEffects_(FontDialog* obj, c_bool value)
 
 ALTERNET_UI_API int FontDialog_GetRestrictSelection_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetRestrictSelection_");
     return MarshalExceptions<int>([&](){
         return obj->GetRestrictSelection();
     });
@@ -67,6 +75,7 @@ ALTERNET_UI_API int FontDialog_GetRestrictSelection_(FontDialog* obj)
 
 ALTERNET_UI_API void FontDialog_SetRestrictSelection_(FontDialog* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_SetRestrictSelection_");
     MarshalExceptions<void>([&](){
         obj->SetRestrictSelection(value);
     });
@@ -74,6 +83,7 @@ ALTERNET_UI_API void FontDialog_SetRestrictSelection_(FontDialog* obj, int value
 
 ALTERNET_UI_API float FontDialog_GetResultFontSizeInPoints_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetResultFontSizeInPoints_");
     return MarshalExceptions<float>([&](){
         return obj->GetResultFontSizeInPoints();
     });
@@ -81,6 +91,7 @@ ALTERNET_UI_API float FontDialog_GetResultFontSizeInPoints_(FontDialog* obj)
 
 ALTERNET_UI_API FontStyle FontDialog_GetResultFontStyle_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetResultFontStyle_");
     return MarshalExceptions<FontStyle>([&](){
         return obj->GetResultFontStyle();
     });
@@ -88,6 +99,7 @@ ALTERNET_UI_API FontStyle FontDialog_GetResultFontStyle_(FontDialog* obj)
 
 ALTERNET_UI_API void FontDialog_SetColor_(FontDialog* obj, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_SetColor_");
     MarshalExceptions<void>([&](){
         obj->SetColor(*color);
     });
@@ -95,6 +107,7 @@ ALTERNET_UI_API void FontDialog_SetColor_(FontDialog* obj, Color* color)
 
 ALTERNET_UI_API uint8_t FontDialog_GetColorR_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetColorR_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorR();
     });
@@ -102,6 +115,7 @@ ALTERNET_UI_API uint8_t FontDialog_GetColorR_(FontDialog* obj)
 
 ALTERNET_UI_API uint8_t FontDialog_GetColorG_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetColorG_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorG();
     });
@@ -109,6 +123,7 @@ ALTERNET_UI_API uint8_t FontDialog_GetColorG_(FontDialog* obj)
 
 ALTERNET_UI_API uint8_t FontDialog_GetColorB_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetColorB_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorB();
     });
@@ -116,6 +131,7 @@ ALTERNET_UI_API uint8_t FontDialog_GetColorB_(FontDialog* obj)
 
 ALTERNET_UI_API uint8_t FontDialog_GetColorA_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetColorA_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorA();
     });
@@ -123,6 +139,7 @@ ALTERNET_UI_API uint8_t FontDialog_GetColorA_(FontDialog* obj)
 
 ALTERNET_UI_API uint8_t FontDialog_GetColorState_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetColorState_");
     return MarshalExceptions<uint8_t>([&](){
         return obj->GetColorState();
     });
@@ -130,6 +147,7 @@ ALTERNET_UI_API uint8_t FontDialog_GetColorState_(FontDialog* obj)
 
 ALTERNET_UI_API ModalResult FontDialog_ShowModal_(FontDialog* obj, Window* owner)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_ShowModal_");
     return MarshalExceptions<ModalResult>([&](){
         return obj->ShowModal(owner);
     });
@@ -137,6 +155,7 @@ ALTERNET_UI_API ModalResult FontDialog_ShowModal_(FontDialog* obj, Window* owner
 
 ALTERNET_UI_API void FontDialog_SetRange_(FontDialog* obj, int minRange, int maxRange)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_SetRange_");
     MarshalExceptions<void>([&](){
         obj->SetRange(minRange, maxRange);
     });
@@ -144,6 +163,7 @@ ALTERNET_UI_API void FontDialog_SetRange_(FontDialog* obj, int minRange, int max
 
 ALTERNET_UI_API void FontDialog_SetInitialFont_(FontDialog* obj, GenericFontFamily genericFamily, NativeStringSpan* familyName, float emSizeInPoints, FontStyle style)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_SetInitialFont_");
     MarshalExceptions<void>([&](){
         obj->SetInitialFont(genericFamily, *familyName, emSizeInPoints, style);
     });
@@ -151,6 +171,7 @@ ALTERNET_UI_API void FontDialog_SetInitialFont_(FontDialog* obj, GenericFontFami
 
 ALTERNET_UI_API NativeStringSpan_C FontDialog_GetResultFontName_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetResultFontName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetResultFontName();
     });
@@ -158,6 +179,7 @@ ALTERNET_UI_API NativeStringSpan_C FontDialog_GetResultFontName_(FontDialog* obj
 
 ALTERNET_UI_API NativeStringSpan_C FontDialog_GetTitle_(FontDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_GetTitle_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetTitle();
     });
@@ -165,6 +187,7 @@ ALTERNET_UI_API NativeStringSpan_C FontDialog_GetTitle_(FontDialog* obj)
 
 ALTERNET_UI_API void FontDialog_SetTitle_(FontDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("FontDialog_SetTitle_");
     MarshalExceptions<void>([&](){
         obj->SetTitle(*value);
     });
@@ -12,6 +12,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API GenericImage* GenericImage_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Create_");
     return MarshalExceptions<GenericImage*>([&](){
         return new GenericImage();
     });
@@ -19,6 +20,7 @@ ALTERNET_UI_API GenericImage* GenericImage_Create_()
 
 ALTERNET_UI_API Color_C GenericImage_FindFirstUnusedColor_(void* handle, uint8_t startR, uint8_t startG, uint8_t startB)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_FindFirstUnusedColor_");
     return MarshalExceptions<Color_C>([&](){
         return GenericImage::FindFirstUnusedColor(handle, startR, startG, startB);
     });
@@ -26,6 +28,7 @@ ALTERNET_UI_API Color_C GenericImage_FindFirstUnusedColor_(void* handle, uint8_t
 
 ALTERNET_UI_API void* GenericImage_CreateImage_()
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateImage_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::CreateImage();
     });
@@ -33,6 +36,7 @@ ALTERNET_UI_API void* GenericImage_CreateImage_()
 
 ALTERNET_UI_API void* GenericImage_CreateImageWithSize_(int width, int height, c_bool clear)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateImageWithSize_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::CreateImageWithSize(width, height, clear);
     });
@@ -40,6 +44,7 @@ ALTERNET_UI_API void* GenericImage_CreateImageWithSize_(int width, int height, c
 
 ALTERNET_UI_API void* GenericImage_CreateImageFromFileWithBitmapType_(NativeStringSpan* name, int bitmapType, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateImageFromFileWithBitmapType_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::CreateImageFromFileWithBitmapType(*name, bitmapType, index);
     });
@@ -47,6 +52,7 @@ ALTERNET_UI_API void* GenericImage_CreateImageFromFileWithBitmapType_(NativeStri
 
 ALTERNET_UI_API void* GenericImage_CreateImageFromFileWithMimeType_(NativeStringSpan* name, NativeStringSpan* mimetype, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateImageFromFileWithMimeType_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::CreateImageFromFileWithMimeType(*name, *mimetype, index);
     });
@@ -54,6 +60,7 @@ ALTERNET_UI_API void* GenericImage_CreateImageFromFileWithMimeType_(NativeString
 
 ALTERNET_UI_API void* GenericImage_CreateImageFromStreamWithBitmapData_(void* stream, int bitmapType, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateImageFromStreamWithBitmapData_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::CreateImageFromStreamWithBitmapData(stream, bitmapType, index);
     });
@@ -61,6 +68,7 @@ ALTERNET_UI_API void* GenericImage_CreateImageFromStreamWithBitmapData_(void* st
 
 ALTERNET_UI_API void* GenericImage_CreateImageFromStreamWithMimeType_(void* stream, NativeStringSpan* mimetype, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateImageFromStreamWithMimeType_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::CreateImageFromStreamWithMimeType(stream, *mimetype, index);
     });
@@ -68,6 +76,7 @@ ALTERNET_UI_API void* GenericImage_CreateImageFromStreamWithMimeType_(void* stre
 
 ALTERNET_UI_API void* GenericImage_CreateImageWithSizeAndData_(int width, int height, void* data, c_bool static_data)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateImageWithSizeAndData_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::CreateImageWithSizeAndData(width, height, data, static_data);
     });
@@ -75,6 +84,7 @@ ALTERNET_UI_API void* GenericImage_CreateImageWithSizeAndData_(int width, int he
 
 ALTERNET_UI_API void* GenericImage_CreateImageWithAlpha_(int width, int height, void* data, void* alpha, c_bool static_data)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateImageWithAlpha_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::CreateImageWithAlpha(width, height, data, alpha, static_data);
     });
@@ -82,6 +92,7 @@ ALTERNET_UI_API void* GenericImage_CreateImageWithAlpha_(int width, int height,
 
 ALTERNET_UI_API void GenericImage_DeleteImage_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_DeleteImage_");
     MarshalExceptions<void>([&](){
         GenericImage::DeleteImage(handle);
     });
@@ -89,6 +100,7 @@ ALTERNET_UI_API void GenericImage_DeleteImage_(void* handle)
 
 ALTERNET_UI_API void GenericImage_SetAlpha_(void* handle, int x, int y, uint8_t alpha)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetAlpha_");
     MarshalExceptions<void>([&](){
         GenericImage::SetAlpha(handle, x, y, alpha);
     });
@@ -96,6 +108,7 @@ ALTERNET_UI_API void GenericImage_SetAlpha_(void* handle, int x, int y, uint8_t
 
 ALTERNET_UI_API void GenericImage_ClearAlpha_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ClearAlpha_");
     MarshalExceptions<void>([&](){
         GenericImage::ClearAlpha(handle);
     });
@@ -103,6 +116,7 @@ ALTERNET_UI_API void GenericImage_ClearAlpha_(void* handle)
 
 ALTERNET_UI_API void GenericImage_SetLoadFlags_(void* handle, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetLoadFlags_");
     MarshalExceptions<void>([&](){
         GenericImage::SetLoadFlags(handle, flags);
     });
@@ -110,6 +124,7 @@ ALTERNET_UI_API void GenericImage_SetLoadFlags_(void* handle, int flags)
 
 ALTERNET_UI_API void GenericImage_SetMask_(void* handle, c_bool hasMask)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetMask_");
     MarshalExceptions<void>([&](){
         GenericImage::SetMask(handle, hasMask);
     });
@@ -117,6 +132,7 @@ ALTERNET_UI_API void GenericImage_SetMask_(void* handle, c_bool hasMask)
 
 ALTERNET_UI_API void GenericImage_SetMaskColor_(void* handle, uint8_t red, uint8_t green, uint8_t blue)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetMaskColor_");
     MarshalExceptions<void>([&](){
         GenericImage::SetMaskColor(handle, red, green, blue);
     });
@@ -124,6 +140,7 @@ ALTERNET_UI_API void GenericImage_SetMaskColor_(void* handle, uint8_t red, uint8
 
 ALTERNET_UI_API c_bool GenericImage_SetMaskFromImage_(void* handle, void* image, uint8_t mr, uint8_t mg, uint8_t mb)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetMaskFromImage_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::SetMaskFromImage(handle, image, mr, mg, mb);
     });
@@ -131,6 +148,7 @@ ALTERNET_UI_API c_bool GenericImage_SetMaskFromImage_(void* handle, void* image,
 
 ALTERNET_UI_API void GenericImage_SetOptionString_(void* handle, NativeStringSpan* name, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetOptionString_");
     MarshalExceptions<void>([&](){
         GenericImage::SetOptionString(handle, *name, *value);
     });
@@ -138,6 +156,7 @@ ALTERNET_UI_API void GenericImage_SetOptionString_(void* handle, NativeStringSpa
 
 ALTERNET_UI_API void GenericImage_SetOptionInt_(void* handle, NativeStringSpan* name, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetOptionInt_");
     MarshalExceptions<void>([&](){
         GenericImage::SetOptionInt(handle, *name, value);
     });
@@ -145,6 +164,7 @@ ALTERNET_UI_API void GenericImage_SetOptionInt_(void* handle, NativeStringSpan*
 
 ALTERNET_UI_API void GenericImage_SetRGB_(void* handle, int x, int y, uint8_t r, uint8_t g, uint8_t b)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetRGB_");
     MarshalExceptions<void>([&](){
         GenericImage::SetRGB(handle, x, y, r, g, b);
     });
@@ -152,6 +172,7 @@ ALTERNET_UI_API void GenericImage_SetRGB_(void* handle, int x, int y, uint8_t r,
 
 ALTERNET_UI_API void GenericImage_SetRGBRect_(void* handle, RectI* rect, uint8_t red, uint8_t green, uint8_t blue)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetRGBRect_");
     MarshalExceptions<void>([&](){
         GenericImage::SetRGBRect(handle, *rect, red, green, blue);
     });
@@ -159,6 +180,7 @@ ALTERNET_UI_API void GenericImage_SetRGBRect_(void* handle, RectI* rect, uint8_t
 
 ALTERNET_UI_API void GenericImage_SetImageType_(void* handle, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetImageType_");
     MarshalExceptions<void>([&](){
         GenericImage::SetImageType(handle, type);
     });
@@ -166,6 +188,7 @@ ALTERNET_UI_API void GenericImage_SetImageType_(void* handle, int type)
 
 ALTERNET_UI_API void GenericImage_SetDefaultLoadFlags_(int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetDefaultLoadFlags_");
     MarshalExceptions<void>([&](){
         GenericImage::SetDefaultLoadFlags(flags);
     });
@@ -173,6 +196,7 @@ ALTERNET_UI_API void GenericImage_SetDefaultLoadFlags_(int flags)
 
 ALTERNET_UI_API int GenericImage_GetLoadFlags_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetLoadFlags_");
     return MarshalExceptions<int>([&](){
         return GenericImage::GetLoadFlags(handle);
     });
@@ -180,6 +204,7 @@ ALTERNET_UI_API int GenericImage_GetLoadFlags_(void* handle)
 
 ALTERNET_UI_API void* GenericImage_Copy_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Copy_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::Copy(handle);
     });
@@ -187,6 +212,7 @@ ALTERNET_UI_API void* GenericImage_Copy_(void* handle)
 
 ALTERNET_UI_API c_bool GenericImage_CreateFreshImage_(void* handle, int width, int height, c_bool clear)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateFreshImage_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::CreateFreshImage(handle, width, height, clear);
     });
@@ -194,6 +220,7 @@ ALTERNET_UI_API c_bool GenericImage_CreateFreshImage_(void* handle, int width, i
 
 ALTERNET_UI_API void GenericImage_Clear_(void* handle, uint8_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Clear_");
     MarshalExceptions<void>([&](){
         GenericImage::Clear(handle, value);
     });
@@ -201,6 +228,7 @@ ALTERNET_UI_API void GenericImage_Clear_(void* handle, uint8_t value)
 
 ALTERNET_UI_API void GenericImage_DestroyImageData_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_DestroyImageData_");
     MarshalExceptions<void>([&](){
         GenericImage::DestroyImageData(handle);
     });
@@ -208,6 +236,7 @@ ALTERNET_UI_API void GenericImage_DestroyImageData_(void* handle)
 
 ALTERNET_UI_API void GenericImage_InitAlpha_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_InitAlpha_");
     MarshalExceptions<void>([&](){
         GenericImage::InitAlpha(handle);
     });
@@ -215,6 +244,7 @@ ALTERNET_UI_API void GenericImage_InitAlpha_(void* handle)
 
 ALTERNET_UI_API void* GenericImage_Blur_(void* handle, int blurRadius)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Blur_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::Blur(handle, blurRadius);
     });
@@ -222,6 +252,7 @@ ALTERNET_UI_API void* GenericImage_Blur_(void* handle, int blurRadius)
 
 ALTERNET_UI_API void* GenericImage_BlurHorizontal_(void* handle, int blurRadius)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_BlurHorizontal_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::BlurHorizontal(handle, blurRadius);
     });
@@ -229,6 +260,7 @@ ALTERNET_UI_API void* GenericImage_BlurHorizontal_(void* handle, int blurRadius)
 
 ALTERNET_UI_API void* GenericImage_BlurVertical_(void* handle, int blurRadius)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_BlurVertical_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::BlurVertical(handle, blurRadius);
     });
@@ -236,6 +268,7 @@ ALTERNET_UI_API void* GenericImage_BlurVertical_(void* handle, int blurRadius)
 
 ALTERNET_UI_API void* GenericImage_Mirror_(void* handle, c_bool horizontally)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Mirror_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::Mirror(handle, horizontally);
     });
@@ -243,6 +276,7 @@ ALTERNET_UI_API void* GenericImage_Mirror_(void* handle, c_bool horizontally)
 
 ALTERNET_UI_API void GenericImage_Paste_(void* handle, void* image, int x, int y, int alphaBlend)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Paste_");
     MarshalExceptions<void>([&](){
         GenericImage::Paste(handle, image, x, y, alphaBlend);
     });
@@ -250,6 +284,7 @@ ALTERNET_UI_API void GenericImage_Paste_(void* handle, void* image, int x, int y
 
 ALTERNET_UI_API void GenericImage_Replace_(void* handle, uint8_t r1, uint8_t g1, uint8_t b1, uint8_t r2, uint8_t g2, uint8_t b2)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Replace_");
     MarshalExceptions<void>([&](){
         GenericImage::Replace(handle, r1, g1, b1, r2, g2, b2);
     });
@@ -257,6 +292,7 @@ ALTERNET_UI_API void GenericImage_Replace_(void* handle, uint8_t r1, uint8_t g1,
 
 ALTERNET_UI_API void GenericImage_Rescale_(void* handle, int width, int height, int quality)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Rescale_");
     MarshalExceptions<void>([&](){
         GenericImage::Rescale(handle, width, height, quality);
     });
@@ -264,6 +300,7 @@ ALTERNET_UI_API void GenericImage_Rescale_(void* handle, int width, int height,
 
 ALTERNET_UI_API void GenericImage_Resize_(void* handle, SizeI* size, PointI* pos, int red, int green, int blue)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Resize_");
     MarshalExceptions<void>([&](){
         GenericImage::Resize(handle, *size, *pos, red, green, blue);
     });
@@ -271,6 +308,7 @@ ALTERNET_UI_API void GenericImage_Resize_(void* handle, SizeI* size, PointI* pos
 
 ALTERNET_UI_API void* GenericImage_Rotate90_(void* handle, c_bool clockwise)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Rotate90_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::Rotate90(handle, clockwise);
     });
@@ -278,6 +316,7 @@ ALTERNET_UI_API void* GenericImage_Rotate90_(void* handle, c_bool clockwise)
 
 ALTERNET_UI_API void* GenericImage_Rotate180_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Rotate180_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::Rotate180(handle);
     });
@@ -285,6 +324,7 @@ ALTERNET_UI_API void* GenericImage_Rotate180_(void* handle)
 
 ALTERNET_UI_API void GenericImage_RotateHue_(void* handle, double angle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_RotateHue_");
     MarshalExceptions<void>([&](){
         GenericImage::RotateHue(handle, angle);
     });
@@ -292,6 +332,7 @@ ALTERNET_UI_API void GenericImage_RotateHue_(void* handle, double angle)
 
 ALTERNET_UI_API void GenericImage_ChangeSaturation_(void* handle, double factor)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ChangeSaturation_");
     MarshalExceptions<void>([&](){
         GenericImage::ChangeSaturation(handle, factor);
     });
@@ -299,6 +340,7 @@ ALTERNET_UI_API void GenericImage_ChangeSaturation_(void* handle, double factor)
 
 ALTERNET_UI_API void GenericImage_ChangeBrightness_(void* handle, double factor)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ChangeBrightness_");
     MarshalExceptions<void>([&](){
         GenericImage::ChangeBrightness(handle, factor);
     });
@@ -306,6 +348,7 @@ ALTERNET_UI_API void GenericImage_ChangeBrightness_(void* handle, double factor)
 
 ALTERNET_UI_API void GenericImage_ChangeHSV_(void* handle, double angleH, double factorS, double factorV)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ChangeHSV_");
     MarshalExceptions<void>([&](){
         GenericImage::ChangeHSV(handle, angleH, factorS, factorV);
     });
@@ -313,6 +356,7 @@ ALTERNET_UI_API void GenericImage_ChangeHSV_(void* handle, double angleH, double
 
 ALTERNET_UI_API void* GenericImage_Scale_(void* handle, int width, int height, int quality)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Scale_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::Scale(handle, width, height, quality);
     });
@@ -320,6 +364,7 @@ ALTERNET_UI_API void* GenericImage_Scale_(void* handle, int width, int height, i
 
 ALTERNET_UI_API void* GenericImage_Size_(void* handle, SizeI* size, PointI* pos, int red, int green, int blue)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_Size_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::Size(handle, *size, *pos, red, green, blue);
     });
@@ -327,6 +372,7 @@ ALTERNET_UI_API void* GenericImage_Size_(void* handle, SizeI* size, PointI* pos,
 
 ALTERNET_UI_API c_bool GenericImage_ConvertAlphaToMask_(void* handle, uint8_t threshold)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ConvertAlphaToMask_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::ConvertAlphaToMask(handle, threshold);
     });
@@ -334,6 +380,7 @@ ALTERNET_UI_API c_bool GenericImage_ConvertAlphaToMask_(void* handle, uint8_t th
 
 ALTERNET_UI_API c_bool GenericImage_ConvertAlphaToMaskUseColor_(void* handle, uint8_t mr, uint8_t mg, uint8_t mb, uint8_t threshold)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ConvertAlphaToMaskUseColor_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::ConvertAlphaToMaskUseColor(handle, mr, mg, mb, threshold);
     });
@@ -341,6 +388,7 @@ ALTERNET_UI_API c_bool GenericImage_ConvertAlphaToMaskUseColor_(void* handle, ui
 
 ALTERNET_UI_API void* GenericImage_ConvertToGreyscaleEx_(void* handle, double weight_r, double weight_g, double weight_b)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ConvertToGreyscaleEx_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::ConvertToGreyscaleEx(handle, weight_r, weight_g, weight_b);
     });
@@ -348,6 +396,7 @@ ALTERNET_UI_API void* GenericImage_ConvertToGreyscaleEx_(void* handle, double we
 
 ALTERNET_UI_API void* GenericImage_ConvertToGreyscale_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ConvertToGreyscale_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::ConvertToGreyscale(handle);
     });
@@ -355,6 +404,7 @@ ALTERNET_UI_API void* GenericImage_ConvertToGreyscale_(void* handle)
 
 ALTERNET_UI_API void* GenericImage_ConvertToMono_(void* handle, uint8_t r, uint8_t g, uint8_t b)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ConvertToMono_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::ConvertToMono(handle, r, g, b);
     });
@@ -362,6 +412,7 @@ ALTERNET_UI_API void* GenericImage_ConvertToMono_(void* handle, uint8_t r, uint8
 
 ALTERNET_UI_API void* GenericImage_ConvertToDisabled_(void* handle, uint8_t brightness)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ConvertToDisabled_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::ConvertToDisabled(handle, brightness);
     });
@@ -369,6 +420,7 @@ ALTERNET_UI_API void* GenericImage_ConvertToDisabled_(void* handle, uint8_t brig
 
 ALTERNET_UI_API void* GenericImage_ChangeLightness_(void* handle, int alpha)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_ChangeLightness_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::ChangeLightness(handle, alpha);
     });
@@ -376,6 +428,7 @@ ALTERNET_UI_API void* GenericImage_ChangeLightness_(void* handle, int alpha)
 
 ALTERNET_UI_API uint8_t GenericImage_GetAlpha_(void* handle, int x, int y)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetAlpha_");
     return MarshalExceptions<uint8_t>([&](){
         return GenericImage::GetAlpha(handle, x, y);
     });
@@ -383,6 +436,7 @@ ALTERNET_UI_API uint8_t GenericImage_GetAlpha_(void* handle, int x, int y)
 
 ALTERNET_UI_API uint8_t GenericImage_GetRed_(void* handle, int x, int y)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetRed_");
     return MarshalExceptions<uint8_t>([&](){
         return GenericImage::GetRed(handle, x, y);
     });
@@ -390,6 +444,7 @@ ALTERNET_UI_API uint8_t GenericImage_GetRed_(void* handle, int x, int y)
 
 ALTERNET_UI_API uint8_t GenericImage_GetGreen_(void* handle, int x, int y)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetGreen_");
     return MarshalExceptions<uint8_t>([&](){
         return GenericImage::GetGreen(handle, x, y);
     });
@@ -397,6 +452,7 @@ ALTERNET_UI_API uint8_t GenericImage_GetGreen_(void* handle, int x, int y)
 
 ALTERNET_UI_API uint8_t GenericImage_GetBlue_(void* handle, int x, int y)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetBlue_");
     return MarshalExceptions<uint8_t>([&](){
         return GenericImage::GetBlue(handle, x, y);
     });
@@ -404,6 +460,7 @@ ALTERNET_UI_API uint8_t GenericImage_GetBlue_(void* handle, int x, int y)
 
 ALTERNET_UI_API uint8_t GenericImage_GetMaskRed_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetMaskRed_");
     return MarshalExceptions<uint8_t>([&](){
         return GenericImage::GetMaskRed(handle);
     });
@@ -411,6 +468,7 @@ ALTERNET_UI_API uint8_t GenericImage_GetMaskRed_(void* handle)
 
 ALTERNET_UI_API uint8_t GenericImage_GetMaskGreen_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetMaskGreen_");
     return MarshalExceptions<uint8_t>([&](){
         return GenericImage::GetMaskGreen(handle);
     });
@@ -418,6 +476,7 @@ ALTERNET_UI_API uint8_t GenericImage_GetMaskGreen_(void* handle)
 
 ALTERNET_UI_API uint8_t GenericImage_GetMaskBlue_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetMaskBlue_");
     return MarshalExceptions<uint8_t>([&](){
         return GenericImage::GetMaskBlue(handle);
     });
@@ -425,6 +484,7 @@ ALTERNET_UI_API uint8_t GenericImage_GetMaskBlue_(void* handle)
 
 ALTERNET_UI_API int GenericImage_GetWidth_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetWidth_");
     return MarshalExceptions<int>([&](){
         return GenericImage::GetWidth(handle);
     });
@@ -432,6 +492,7 @@ ALTERNET_UI_API int GenericImage_GetWidth_(void* handle)
 
 ALTERNET_UI_API int GenericImage_GetHeight_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetHeight_");
     return MarshalExceptions<int>([&](){
         return GenericImage::GetHeight(handle);
     });
@@ -439,6 +500,7 @@ ALTERNET_UI_API int GenericImage_GetHeight_(void* handle)
 
 ALTERNET_UI_API SizeI_C GenericImage_GetSize_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetSize_");
     return MarshalExceptions<SizeI_C>([&](){
         return GenericImage::GetSize(handle);
     });
@@ -446,6 +508,7 @@ ALTERNET_UI_API SizeI_C GenericImage_GetSize_(void* handle)
 
 ALTERNET_UI_API NativeStringSpan_C GenericImage_GetOptionString_(void* handle, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetOptionString_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return GenericImage::GetOptionString(handle, *name);
     });
@@ -453,6 +516,7 @@ ALTERNET_UI_API NativeStringSpan_C GenericImage_GetOptionString_(void* handle, N
 
 ALTERNET_UI_API int GenericImage_GetOptionInt_(void* handle, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetOptionInt_");
     return MarshalExceptions<int>([&](){
         return GenericImage::GetOptionInt(handle, *name);
     });
@@ -460,6 +524,7 @@ ALTERNET_UI_API int GenericImage_GetOptionInt_(void* handle, NativeStringSpan* n
 
 ALTERNET_UI_API void* GenericImage_GetSubImage_(void* handle, RectI* rect)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetSubImage_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::GetSubImage(handle, *rect);
     });
@@ -467,6 +532,7 @@ ALTERNET_UI_API void* GenericImage_GetSubImage_(void* handle, RectI* rect)
 
 ALTERNET_UI_API int GenericImage_GetImageType_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetImageType_");
     return MarshalExceptions<int>([&](){
         return GenericImage::GetImageType(handle);
     });
@@ -474,6 +540,7 @@ ALTERNET_UI_API int GenericImage_GetImageType_(void* handle)
 
 ALTERNET_UI_API c_bool GenericImage_HasAlpha_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_HasAlpha_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::HasAlpha(handle);
     });
@@ -481,6 +548,7 @@ ALTERNET_UI_API c_bool GenericImage_HasAlpha_(void* handle)
 
 ALTERNET_UI_API c_bool GenericImage_HasMask_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_HasMask_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::HasMask(handle);
     });
@@ -488,6 +556,7 @@ ALTERNET_UI_API c_bool GenericImage_HasMask_(void* handle)
 
 ALTERNET_UI_API c_bool GenericImage_HasOption_(void* handle, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_HasOption_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::HasOption(handle, *name);
     });
@@ -495,6 +564,7 @@ ALTERNET_UI_API c_bool GenericImage_HasOption_(void* handle, NativeStringSpan* n
 
 ALTERNET_UI_API c_bool GenericImage_IsOk_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_IsOk_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::IsOk(handle);
     });
@@ -502,6 +572,7 @@ ALTERNET_UI_API c_bool GenericImage_IsOk_(void* handle)
 
 ALTERNET_UI_API c_bool GenericImage_IsTransparent_(void* handle, int x, int y, uint8_t threshold)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_IsTransparent_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::IsTransparent(handle, x, y, threshold);
     });
@@ -509,6 +580,7 @@ ALTERNET_UI_API c_bool GenericImage_IsTransparent_(void* handle, int x, int y, u
 
 ALTERNET_UI_API c_bool GenericImage_LoadStreamWithBitmapType_(void* handle, void* stream, int bitmapType, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_LoadStreamWithBitmapType_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::LoadStreamWithBitmapType(handle, stream, bitmapType, index);
     });
@@ -516,6 +588,7 @@ ALTERNET_UI_API c_bool GenericImage_LoadStreamWithBitmapType_(void* handle, void
 
 ALTERNET_UI_API c_bool GenericImage_LoadFileWithBitmapType_(void* handle, NativeStringSpan* name, int bitmapType, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_LoadFileWithBitmapType_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::LoadFileWithBitmapType(handle, *name, bitmapType, index);
     });
@@ -523,6 +596,7 @@ ALTERNET_UI_API c_bool GenericImage_LoadFileWithBitmapType_(void* handle, Native
 
 ALTERNET_UI_API c_bool GenericImage_LoadFileWithMimeType_(void* handle, NativeStringSpan* name, NativeStringSpan* mimetype, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_LoadFileWithMimeType_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::LoadFileWithMimeType(handle, *name, *mimetype, index);
     });
@@ -530,6 +604,7 @@ ALTERNET_UI_API c_bool GenericImage_LoadFileWithMimeType_(void* handle, NativeSt
 
 ALTERNET_UI_API c_bool GenericImage_LoadStreamWithMimeType_(void* handle, void* stream, NativeStringSpan* mimetype, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_LoadStreamWithMimeType_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::LoadStreamWithMimeType(handle, stream, *mimetype, index);
     });
@@ -537,6 +612,7 @@ ALTERNET_UI_API c_bool GenericImage_LoadStreamWithMimeType_(void* handle, void*
 
 ALTERNET_UI_API c_bool GenericImage_SaveStreamWithMimeType_(void* handle, void* stream, NativeStringSpan* mimetype)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SaveStreamWithMimeType_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::SaveStreamWithMimeType(handle, stream, *mimetype);
     });
@@ -544,6 +620,7 @@ ALTERNET_UI_API c_bool GenericImage_SaveStreamWithMimeType_(void* handle, void*
 
 ALTERNET_UI_API c_bool GenericImage_SaveFileWithBitmapType_(void* handle, NativeStringSpan* name, int bitmapType)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SaveFileWithBitmapType_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::SaveFileWithBitmapType(handle, *name, bitmapType);
     });
@@ -551,6 +628,7 @@ ALTERNET_UI_API c_bool GenericImage_SaveFileWithBitmapType_(void* handle, Native
 
 ALTERNET_UI_API c_bool GenericImage_SaveFileWithMimeType_(void* handle, NativeStringSpan* name, NativeStringSpan* mimetype)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SaveFileWithMimeType_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::SaveFileWithMimeType(handle, *name, *mimetype);
     });
@@ -558,6 +636,7 @@ ALTERNET_UI_API c_bool GenericImage_SaveFileWithMimeType_(void* handle, NativeSt
 
 ALTERNET_UI_API c_bool GenericImage_SaveFile_(void* handle, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SaveFile_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::SaveFile(handle, *name);
     });
@@ -565,6 +644,7 @@ ALTERNET_UI_API c_bool GenericImage_SaveFile_(void* handle, NativeStringSpan* na
 
 ALTERNET_UI_API c_bool GenericImage_SaveStreamWithBitmapType_(void* handle, void* stream, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SaveStreamWithBitmapType_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::SaveStreamWithBitmapType(handle, stream, type);
     });
@@ -572,6 +652,7 @@ ALTERNET_UI_API c_bool GenericImage_SaveStreamWithBitmapType_(void* handle, void
 
 ALTERNET_UI_API c_bool GenericImage_CanRead_(NativeStringSpan* filename)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CanRead_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::CanRead(*filename);
     });
@@ -579,6 +660,7 @@ ALTERNET_UI_API c_bool GenericImage_CanRead_(NativeStringSpan* filename)
 
 ALTERNET_UI_API c_bool GenericImage_CanReadStream_(void* stream)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CanReadStream_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::CanReadStream(stream);
     });
@@ -586,6 +668,7 @@ ALTERNET_UI_API c_bool GenericImage_CanReadStream_(void* stream)
 
 ALTERNET_UI_API int GenericImage_GetDefaultLoadFlags_()
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetDefaultLoadFlags_");
     return MarshalExceptions<int>([&](){
         return GenericImage::GetDefaultLoadFlags();
     });
@@ -593,6 +676,7 @@ ALTERNET_UI_API int GenericImage_GetDefaultLoadFlags_()
 
 ALTERNET_UI_API NativeStringSpan_C GenericImage_GetImageExtWildcard_()
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetImageExtWildcard_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return GenericImage::GetImageExtWildcard();
     });
@@ -600,6 +684,7 @@ ALTERNET_UI_API NativeStringSpan_C GenericImage_GetImageExtWildcard_()
 
 ALTERNET_UI_API void GenericImage_AddHandler_(void* handler)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_AddHandler_");
     MarshalExceptions<void>([&](){
         GenericImage::AddHandler(handler);
     });
@@ -607,6 +692,7 @@ ALTERNET_UI_API void GenericImage_AddHandler_(void* handler)
 
 ALTERNET_UI_API void GenericImage_CleanUpHandlers_()
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CleanUpHandlers_");
     MarshalExceptions<void>([&](){
         GenericImage::CleanUpHandlers();
     });
@@ -614,6 +700,7 @@ ALTERNET_UI_API void GenericImage_CleanUpHandlers_()
 
 ALTERNET_UI_API void* GenericImage_FindHandlerByName_(NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_FindHandlerByName_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::FindHandlerByName(*name);
     });
@@ -621,6 +708,7 @@ ALTERNET_UI_API void* GenericImage_FindHandlerByName_(NativeStringSpan* name)
 
 ALTERNET_UI_API void* GenericImage_FindHandlerByExt_(NativeStringSpan* extension, int bitmapType)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_FindHandlerByExt_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::FindHandlerByExt(*extension, bitmapType);
     });
@@ -628,6 +716,7 @@ ALTERNET_UI_API void* GenericImage_FindHandlerByExt_(NativeStringSpan* extension
 
 ALTERNET_UI_API void* GenericImage_FindHandlerByBitmapType_(int bitmapType)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_FindHandlerByBitmapType_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::FindHandlerByBitmapType(bitmapType);
     });
@@ -635,6 +724,7 @@ ALTERNET_UI_API void* GenericImage_FindHandlerByBitmapType_(int bitmapType)
 
 ALTERNET_UI_API void* GenericImage_FindHandlerByMime_(NativeStringSpan* mimetype)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_FindHandlerByMime_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::FindHandlerByMime(*mimetype);
     });
@@ -642,6 +732,7 @@ ALTERNET_UI_API void* GenericImage_FindHandlerByMime_(NativeStringSpan* mimetype
 
 ALTERNET_UI_API void GenericImage_InsertHandler_(void* handler)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_InsertHandler_");
     MarshalExceptions<void>([&](){
         GenericImage::InsertHandler(handler);
     });
@@ -649,6 +740,7 @@ ALTERNET_UI_API void GenericImage_InsertHandler_(void* handler)
 
 ALTERNET_UI_API c_bool GenericImage_RemoveHandler_(NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_RemoveHandler_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::RemoveHandler(*name);
     });
@@ -656,6 +748,7 @@ ALTERNET_UI_API c_bool GenericImage_RemoveHandler_(NativeStringSpan* name)
 
 ALTERNET_UI_API int GenericImage_GetImageCountInFile_(NativeStringSpan* filename, int bitmapType)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetImageCountInFile_");
     return MarshalExceptions<int>([&](){
         return GenericImage::GetImageCountInFile(*filename, bitmapType);
     });
@@ -663,6 +756,7 @@ ALTERNET_UI_API int GenericImage_GetImageCountInFile_(NativeStringSpan* filename
 
 ALTERNET_UI_API int GenericImage_GetImageCountInStream_(void* stream, int bitmapType)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetImageCountInStream_");
     return MarshalExceptions<int>([&](){
         return GenericImage::GetImageCountInStream(stream, bitmapType);
     });
@@ -670,6 +764,7 @@ ALTERNET_UI_API int GenericImage_GetImageCountInStream_(void* stream, int bitmap
 
 ALTERNET_UI_API void* GenericImage_GetAlphaData_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetAlphaData_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::GetAlphaData(handle);
     });
@@ -677,6 +772,7 @@ ALTERNET_UI_API void* GenericImage_GetAlphaData_(void* handle)
 
 ALTERNET_UI_API void* GenericImage_GetData_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetData_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::GetData(handle);
     });
@@ -684,6 +780,7 @@ ALTERNET_UI_API void* GenericImage_GetData_(void* handle)
 
 ALTERNET_UI_API c_bool GenericImage_CreateData_(void* handle, int width, int height, void* data, c_bool static_data)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateData_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::CreateData(handle, width, height, data, static_data);
     });
@@ -691,6 +788,7 @@ ALTERNET_UI_API c_bool GenericImage_CreateData_(void* handle, int width, int hei
 
 ALTERNET_UI_API c_bool GenericImage_CreateAlphaData_(void* handle, int width, int height, void* data, void* alpha, c_bool static_data)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateAlphaData_");
     return MarshalExceptions<c_bool>([&](){
         return GenericImage::CreateAlphaData(handle, width, height, data, alpha, static_data);
     });
@@ -698,6 +796,7 @@ ALTERNET_UI_API c_bool GenericImage_CreateAlphaData_(void* handle, int width, in
 
 ALTERNET_UI_API void GenericImage_SetAlphaData_(void* handle, void* alpha, c_bool static_data)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetAlphaData_");
     MarshalExceptions<void>([&](){
         GenericImage::SetAlphaData(handle, alpha, static_data);
     });
@@ -705,6 +804,7 @@ ALTERNET_UI_API void GenericImage_SetAlphaData_(void* handle, void* alpha, c_boo
 
 ALTERNET_UI_API void GenericImage_SetData_(void* handle, void* data, c_bool static_data)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetData_");
     MarshalExceptions<void>([&](){
         GenericImage::SetData(handle, data, static_data);
     });
@@ -712,6 +812,7 @@ ALTERNET_UI_API void GenericImage_SetData_(void* handle, void* data, c_bool stat
 
 ALTERNET_UI_API void GenericImage_SetDataWithSize_(void* handle, void* data, int new_width, int new_height, c_bool static_data)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetDataWithSize_");
     MarshalExceptions<void>([&](){
         GenericImage::SetDataWithSize(handle, data, new_width, new_height, static_data);
     });
@@ -719,6 +820,7 @@ ALTERNET_UI_API void GenericImage_SetDataWithSize_(void* handle, void* data, int
 
 ALTERNET_UI_API void* GenericImage_LockBits_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_LockBits_");
     return MarshalExceptions<void*>([&](){
         return GenericImage::LockBits(handle);
     });
@@ -726,6 +828,7 @@ ALTERNET_UI_API void* GenericImage_LockBits_(void* handle)
 
 ALTERNET_UI_API int GenericImage_GetStride_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetStride_");
     return MarshalExceptions<int>([&](){
         return GenericImage::GetStride(handle);
     });
@@ -733,8 +836,113 @@ ALTERNET_UI_API int GenericImage_GetStride_(void* handle)
 
 ALTERNET_UI_API void GenericImage_UnlockBits_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("GenericImage_UnlockBits_");
     MarshalExceptions<void>([&](){
         GenericImage::UnlockBits(handle);
     });
 }
 
+ALTERNET_UI_API int64_t GenericImage_DecodeFileAsync_(NativeStringSpan* path, int bitmapType, int index)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_DecodeFileAsync_");
+    return MarshalExceptions<int64_t>([&](){
+        return GenericImage::DecodeFileAsync(*path, bitmapType, index);
+    });
+}
+
+ALTERNET_UI_API int64_t GenericImage_DecodeMemoryAsync_(void* data, int dataCount, int bitmapType, int index)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_DecodeMemoryAsync_");
+    return MarshalExceptions<int64_t>([&](){
+        return GenericImage::DecodeMemoryAsync(data, dataCount, bitmapType, index);
+    });
+}
+
+ALTERNET_UI_API c_bool GenericImage_CancelDecode_(int64_t id)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CancelDecode_");
+    return MarshalExceptions<c_bool>([&](){
+        return GenericImage::CancelDecode(id);
+    });
+}
+
+ALTERNET_UI_API int GenericImage_PollDecoded_(int64_t* results, int resultsCount)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_PollDecoded_");
+    return MarshalExceptions<int>([&](){
+        return GenericImage::PollDecoded(results, resultsCount);
+    });
+}
+
+ALTERNET_UI_API void GenericImage_SetDecodeThreadCount_(int value)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetDecodeThreadCount_");
+    MarshalExceptions<void>([&](){
+        GenericImage::SetDecodeThreadCount(value);
+    });
+}
+
+ALTERNET_UI_API int GenericImage_GetDecodeThreadCount_()
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetDecodeThreadCount_");
+    return MarshalExceptions<int>([&](){
+        return GenericImage::GetDecodeThreadCount();
+    });
+}
+
+ALTERNET_UI_API int GenericImage_GetDecodePendingCount_()
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_GetDecodePendingCount_");
+    return MarshalExceptions<int>([&](){
+        return GenericImage::GetDecodePendingCount();
+    });
+}
+
+ALTERNET_UI_API void* GenericImage_CreateThumbnailFromFile_(NativeStringSpan* path, int width, int height)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateThumbnailFromFile_");
+    return MarshalExceptions<void*>([&](){
+        return GenericImage::CreateThumbnailFromFile(*path, width, height);
+    });
+}
+
+ALTERNET_UI_API void* GenericImage_CreateThumbnailFromMemory_(void* data, int dataCount, int width, int height)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateThumbnailFromMemory_");
+    return MarshalExceptions<void*>([&](){
+        return GenericImage::CreateThumbnailFromMemory(data, dataCount, width, height);
+    });
+}
+
+ALTERNET_UI_API int64_t GenericImage_DecodeThumbnailAsync_(NativeStringSpan* path, int width, int height)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_DecodeThumbnailAsync_");
+    return MarshalExceptions<int64_t>([&](){
+        return GenericImage::DecodeThumbnailAsync(*path, width, height);
+    });
+}
+
+ALTERNET_UI_API void GenericImage_SetEnabledImageTypes_(int* bitmapTypes, int bitmapTypesCount)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SetEnabledImageTypes_");
+    MarshalExceptions<void>([&](){
+        GenericImage::SetEnabledImageTypes(bitmapTypes, bitmapTypesCount);
+    });
+}
+
+ALTERNET_UI_API void* GenericImage_CreateImageFromMappedFile_(NativeStringSpan* path)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_CreateImageFromMappedFile_");
+    return MarshalExceptions<void*>([&](){
+        return GenericImage::CreateImageFromMappedFile(*path);
+    });
+}
+
+ALTERNET_UI_API c_bool GenericImage_SaveStreamWithPreset_(void* handle, void* stream, int bitmapType, int preset, int quality, int compressionLevel, int filter, int threadCount)
+{
+    ALTERNET_UI_PERF_EXPORT("GenericImage_SaveStreamWithPreset_");
+    return MarshalExceptions<c_bool>([&](){
+        return GenericImage::SaveStreamWithPreset(handle, stream, bitmapType, preset, quality, compressionLevel, filter, threadCount);
+    });
+}
+
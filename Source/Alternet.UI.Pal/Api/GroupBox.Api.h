@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API GroupBox* GroupBox_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("GroupBox_Create_");
     return MarshalExceptions<GroupBox*>([&](){
         return new GroupBox();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API GroupBox* GroupBox_Create_()
 
 ALTERNET_UI_API int GroupBox_GetTopBorderForSizer_(GroupBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("GroupBox_GetTopBorderForSizer_");
     return MarshalExceptions<int>([&](){
         return obj->GetTopBorderForSizer();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API int GroupBox_GetTopBorderForSizer_(GroupBox* obj)
 
 ALTERNET_UI_API int GroupBox_GetOtherBorderForSizer_(GroupBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("GroupBox_GetOtherBorderForSizer_");
     return MarshalExceptions<int>([&](){
         return obj->GetOtherBorderForSizer();
     });
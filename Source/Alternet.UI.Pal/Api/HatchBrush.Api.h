@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API HatchBrush* HatchBrush_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("HatchBrush_Create_");
     return MarshalExceptions<HatchBrush*>([&](){
         return new HatchBrush();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API HatchBrush* HatchBrush_Create_()
 
 ALTERNET_UI_API void HatchBrush_Initialize_(HatchBrush* obj, BrushHatchStyle style, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("HatchBrush_Initialize_");
     MarshalExceptions<void>([&](){
         obj->Initialize(style, *color);
     });
@@ -4,6 +4,7 @@
 
 #include "IconSet.h"
 #include "Image.h"
+#include "ImageBundle.h"
 #include "InputStream.h"
 #include "ApiUtils.h"
 #include "Exceptions.h"
@@ -12,6 +13,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API IconSet* IconSet_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("IconSet_Create_");
     return MarshalExceptions<IconSet*>([&](){
         return new IconSet();
     });
@@ -19,6 +21,7 @@ ALTERNET_UI_API IconSet* IconSet_Create_()
 
 ALTERNET_UI_API void IconSet_AddImage_(IconSet* obj, Image* image)
 {
+    ALTERNET_UI_PERF_EXPORT("IconSet_AddImage_");
     MarshalExceptions<void>([&](){
         obj->AddImage(image);
     });
@@ -26,6 +29,7 @@ ALTERNET_UI_API void IconSet_AddImage_(IconSet* obj, Image* image)
 
 ALTERNET_UI_API void IconSet_LoadFromStream_(IconSet* obj, void* stream)
 {
+    ALTERNET_UI_PERF_EXPORT("IconSet_LoadFromStream_");
     MarshalExceptions<void>([&](){
         obj->LoadFromStream(stream);
     });
@@ -33,6 +37,7 @@ ALTERNET_UI_API void IconSet_LoadFromStream_(IconSet* obj, void* stream)
 
 ALTERNET_UI_API void IconSet_Clear_(IconSet* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("IconSet_Clear_");
     MarshalExceptions<void>([&](){
         obj->Clear();
     });
@@ -40,8 +45,17 @@ ALTERNET_UI_API void IconSet_Clear_(IconSet* obj)
 
 ALTERNET_UI_API c_bool IconSet_IsOk_(IconSet* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("IconSet_IsOk_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsOk();
     });
 }
 
+ALTERNET_UI_API void IconSet_AddImageBundle_(IconSet* obj, ImageBundle* bundle)
+{
+    ALTERNET_UI_PERF_EXPORT("IconSet_AddImageBundle_");
+    MarshalExceptions<void>([&](){
+        obj->AddImageBundle(bundle);
+    });
+}
+
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Image.h"
+#include "ImageBundle.h"
 #include "InputStream.h"
 #include "OutputStream.h"
 #include "ApiUtils.h"
@@ -12,6 +13,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Image* Image_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Image_Create_");
     return MarshalExceptions<Image*>([&](){
         return new Image();
     });
@@ -19,6 +21,7 @@ ALTERNET_UI_API Image* Image_Create_()
 
 ALTERNET_UI_API c_bool Image_GetHasMask_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetHasMask_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasMask();
     });
@@ -26,6 +29,7 @@ ALTERNET_UI_API c_bool Image_GetHasMask_(Image* obj)
 
 ALTERNET_UI_API float Image_GetScaleFactor_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetScaleFactor_");
     return MarshalExceptions<float>([&](){
         return obj->GetScaleFactor();
     });
@@ -33,6 +37,7 @@ ALTERNET_UI_API float Image_GetScaleFactor_(Image* obj)
 
 ALTERNET_UI_API void Image_SetScaleFactor_(Image* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_SetScaleFactor_");
     MarshalExceptions<void>([&](){
         obj->SetScaleFactor(value);
     });
@@ -40,6 +45,7 @@ ALTERNET_UI_API void Image_SetScaleFactor_(Image* obj, float value)
 
 ALTERNET_UI_API int Image_GetDipSizeX_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetDipSizeX_");
     return MarshalExceptions<int>([&](){
         return obj->GetDipSizeX();
     });
@@ -47,6 +53,7 @@ ALTERNET_UI_API int Image_GetDipSizeX_(Image* obj)
 
 ALTERNET_UI_API int Image_GetDipSizeY_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetDipSizeY_");
     return MarshalExceptions<int>([&](){
         return obj->GetDipSizeY();
     });
@@ -54,6 +61,7 @@ ALTERNET_UI_API int Image_GetDipSizeY_(Image* obj)
 
 ALTERNET_UI_API float Image_GetScaledHeight_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetScaledHeight_");
     return MarshalExceptions<float>([&](){
         return obj->GetScaledHeight();
     });
@@ -61,6 +69,7 @@ ALTERNET_UI_API float Image_GetScaledHeight_(Image* obj)
 
 ALTERNET_UI_API int Image_GetScaledSizeX_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetScaledSizeX_");
     return MarshalExceptions<int>([&](){
         return obj->GetScaledSizeX();
     });
@@ -68,6 +77,7 @@ ALTERNET_UI_API int Image_GetScaledSizeX_(Image* obj)
 
 ALTERNET_UI_API int Image_GetScaledSizeY_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetScaledSizeY_");
     return MarshalExceptions<int>([&](){
         return obj->GetScaledSizeY();
     });
@@ -75,6 +85,7 @@ ALTERNET_UI_API int Image_GetScaledSizeY_(Image* obj)
 
 ALTERNET_UI_API float Image_GetScaledWidth_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetScaledWidth_");
     return MarshalExceptions<float>([&](){
         return obj->GetScaledWidth();
     });
@@ -82,6 +93,7 @@ ALTERNET_UI_API float Image_GetScaledWidth_(Image* obj)
 
 ALTERNET_UI_API int Image_GetPixelSizeX_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetPixelSizeX_");
     return MarshalExceptions<int>([&](){
         return obj->GetPixelSizeX();
     });
@@ -89,6 +101,7 @@ ALTERNET_UI_API int Image_GetPixelSizeX_(Image* obj)
 
 ALTERNET_UI_API int Image_GetPixelSizeY_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetPixelSizeY_");
     return MarshalExceptions<int>([&](){
         return obj->GetPixelSizeY();
     });
@@ -96,6 +109,7 @@ ALTERNET_UI_API int Image_GetPixelSizeY_(Image* obj)
 
 ALTERNET_UI_API c_bool Image_GetIsOk_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetIsOk_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsOk();
     });
@@ -103,6 +117,7 @@ ALTERNET_UI_API c_bool Image_GetIsOk_(Image* obj)
 
 ALTERNET_UI_API c_bool Image_GetHasAlpha_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetHasAlpha_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasAlpha();
     });
@@ -110,6 +125,7 @@ ALTERNET_UI_API c_bool Image_GetHasAlpha_(Image* obj)
 
 ALTERNET_UI_API void Image_SetHasAlpha_(Image* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_SetHasAlpha_");
     MarshalExceptions<void>([&](){
         obj->SetHasAlpha(value);
     });
@@ -117,6 +133,7 @@ ALTERNET_UI_API void Image_SetHasAlpha_(Image* obj, c_bool value)
 
 ALTERNET_UI_API int Image_GetPixelWidth_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetPixelWidth_");
     return MarshalExceptions<int>([&](){
         return obj->GetPixelWidth();
     });
@@ -124,6 +141,7 @@ ALTERNET_UI_API int Image_GetPixelWidth_(Image* obj)
 
 ALTERNET_UI_API int Image_GetPixelHeight_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetPixelHeight_");
     return MarshalExceptions<int>([&](){
         return obj->GetPixelHeight();
     });
@@ -131,6 +149,7 @@ ALTERNET_UI_API int Image_GetPixelHeight_(Image* obj)
 
 ALTERNET_UI_API int Image_GetDepth_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetDepth_");
     return MarshalExceptions<int>([&](){
         return obj->GetDepth();
     });
@@ -138,6 +157,7 @@ ALTERNET_UI_API int Image_GetDepth_(Image* obj)
 
 ALTERNET_UI_API int Image_GetStaticOption_(int objectId, int propId)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetStaticOption_");
     return MarshalExceptions<int>([&](){
         return Image::GetStaticOption(objectId, propId);
     });
@@ -145,6 +165,7 @@ ALTERNET_UI_API int Image_GetStaticOption_(int objectId, int propId)
 
 ALTERNET_UI_API void Image_Log_()
 {
+    ALTERNET_UI_PERF_EXPORT("Image_Log_");
     MarshalExceptions<void>([&](){
         Image::Log();
     });
@@ -152,6 +173,7 @@ ALTERNET_UI_API void Image_Log_()
 
 ALTERNET_UI_API c_bool Image_InitializeFromDipSize_(Image* obj, int width, int height, float scale, int depth)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_InitializeFromDipSize_");
     return MarshalExceptions<c_bool>([&](){
         return obj->InitializeFromDipSize(width, height, scale, depth);
     });
@@ -159,6 +181,7 @@ ALTERNET_UI_API c_bool Image_InitializeFromDipSize_(Image* obj, int width, int h
 
 ALTERNET_UI_API c_bool Image_InitializeFromScreen_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_InitializeFromScreen_");
     return MarshalExceptions<c_bool>([&](){
         return obj->InitializeFromScreen();
     });
@@ -166,6 +189,7 @@ ALTERNET_UI_API c_bool Image_InitializeFromScreen_(Image* obj)
 
 ALTERNET_UI_API c_bool Image_LoadFromStream_(Image* obj, void* stream)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_LoadFromStream_");
     return MarshalExceptions<c_bool>([&](){
         return obj->LoadFromStream(stream);
     });
@@ -173,6 +197,7 @@ ALTERNET_UI_API c_bool Image_LoadFromStream_(Image* obj, void* stream)
 
 ALTERNET_UI_API c_bool Image_LoadSvgFromStream_(Image* obj, void* stream, int width, int height, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_LoadSvgFromStream_");
     return MarshalExceptions<c_bool>([&](){
         return obj->LoadSvgFromStream(stream, width, height, *color);
     });
@@ -180,6 +205,7 @@ ALTERNET_UI_API c_bool Image_LoadSvgFromStream_(Image* obj, void* stream, int wi
 
 ALTERNET_UI_API c_bool Image_LoadSvgFromString_(Image* obj, NativeStringSpan* s, int width, int height, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_LoadSvgFromString_");
     return MarshalExceptions<c_bool>([&](){
         return obj->LoadSvgFromString(*s, width, height, *color);
     });
@@ -187,6 +213,7 @@ ALTERNET_UI_API c_bool Image_LoadSvgFromString_(Image* obj, NativeStringSpan* s,
 
 ALTERNET_UI_API void Image_Initialize_(Image* obj, SizeI* size, int depth)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_Initialize_");
     MarshalExceptions<void>([&](){
         obj->Initialize(*size, depth);
     });
@@ -194,6 +221,7 @@ ALTERNET_UI_API void Image_Initialize_(Image* obj, SizeI* size, int depth)
 
 ALTERNET_UI_API void Image_InitializeFromImage_(Image* obj, Image* source, SizeI* size)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_InitializeFromImage_");
     MarshalExceptions<void>([&](){
         obj->InitializeFromImage(source, *size);
     });
@@ -201,6 +229,7 @@ ALTERNET_UI_API void Image_InitializeFromImage_(Image* obj, Image* source, SizeI
 
 ALTERNET_UI_API void Image_CopyFrom_(Image* obj, Image* otherImage)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_CopyFrom_");
     MarshalExceptions<void>([&](){
         obj->CopyFrom(otherImage);
     });
@@ -208,6 +237,7 @@ ALTERNET_UI_API void Image_CopyFrom_(Image* obj, Image* otherImage)
 
 ALTERNET_UI_API c_bool Image_SaveToStream_(Image* obj, void* stream, NativeStringSpan* format)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_SaveToStream_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SaveToStream(stream, *format);
     });
@@ -215,6 +245,7 @@ ALTERNET_UI_API c_bool Image_SaveToStream_(Image* obj, void* stream, NativeStrin
 
 ALTERNET_UI_API c_bool Image_SaveToFile_(Image* obj, NativeStringSpan* fileName)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_SaveToFile_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SaveToFile(*fileName);
     });
@@ -222,6 +253,7 @@ ALTERNET_UI_API c_bool Image_SaveToFile_(Image* obj, NativeStringSpan* fileName)
 
 ALTERNET_UI_API void* Image_ConvertToGenericImage_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_ConvertToGenericImage_");
     return MarshalExceptions<void*>([&](){
         return obj->ConvertToGenericImage();
     });
@@ -229,6 +261,7 @@ ALTERNET_UI_API void* Image_ConvertToGenericImage_(Image* obj)
 
 ALTERNET_UI_API void Image_LoadFromGenericImage_(Image* obj, void* image, int depth)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_LoadFromGenericImage_");
     MarshalExceptions<void>([&](){
         obj->LoadFromGenericImage(image, depth);
     });
@@ -236,6 +269,7 @@ ALTERNET_UI_API void Image_LoadFromGenericImage_(Image* obj, void* image, int de
 
 ALTERNET_UI_API c_bool Image_GrayScale_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GrayScale_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GrayScale();
     });
@@ -243,6 +277,7 @@ ALTERNET_UI_API c_bool Image_GrayScale_(Image* obj)
 
 ALTERNET_UI_API c_bool Image_ResetAlpha_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_ResetAlpha_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ResetAlpha();
     });
@@ -250,6 +285,7 @@ ALTERNET_UI_API c_bool Image_ResetAlpha_(Image* obj)
 
 ALTERNET_UI_API c_bool Image_LoadFile_(Image* obj, NativeStringSpan* name, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_LoadFile_");
     return MarshalExceptions<c_bool>([&](){
         return obj->LoadFile(*name, type);
     });
@@ -257,6 +293,7 @@ ALTERNET_UI_API c_bool Image_LoadFile_(Image* obj, NativeStringSpan* name, int t
 
 ALTERNET_UI_API c_bool Image_SaveFile_(Image* obj, NativeStringSpan* name, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_SaveFile_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SaveFile(*name, type);
     });
@@ -264,6 +301,7 @@ ALTERNET_UI_API c_bool Image_SaveFile_(Image* obj, NativeStringSpan* name, int t
 
 ALTERNET_UI_API c_bool Image_SaveStream_(Image* obj, void* stream, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_SaveStream_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SaveStream(stream, type);
     });
@@ -271,6 +309,7 @@ ALTERNET_UI_API c_bool Image_SaveStream_(Image* obj, void* stream, int type)
 
 ALTERNET_UI_API c_bool Image_LoadStream_(Image* obj, void* stream, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_LoadStream_");
     return MarshalExceptions<c_bool>([&](){
         return obj->LoadStream(stream, type);
     });
@@ -278,6 +317,7 @@ ALTERNET_UI_API c_bool Image_LoadStream_(Image* obj, void* stream, int type)
 
 ALTERNET_UI_API Image* Image_GetSubBitmap_(Image* obj, RectI* rect)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetSubBitmap_");
     return MarshalExceptions<Image*>([&](){
         return obj->GetSubBitmap(*rect);
     });
@@ -285,6 +325,7 @@ ALTERNET_UI_API Image* Image_GetSubBitmap_(Image* obj, RectI* rect)
 
 ALTERNET_UI_API Image* Image_ConvertToDisabled_(Image* obj, uint8_t brightness)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_ConvertToDisabled_");
     return MarshalExceptions<Image*>([&](){
         return obj->ConvertToDisabled(brightness);
     });
@@ -292,6 +333,7 @@ ALTERNET_UI_API Image* Image_ConvertToDisabled_(Image* obj, uint8_t brightness)
 
 ALTERNET_UI_API c_bool Image_Rescale_(Image* obj, SizeI* sizeNeeded)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_Rescale_");
     return MarshalExceptions<c_bool>([&](){
         return obj->Rescale(*sizeNeeded);
     });
@@ -299,6 +341,7 @@ ALTERNET_UI_API c_bool Image_Rescale_(Image* obj, SizeI* sizeNeeded)
 
 ALTERNET_UI_API int Image_GetDefaultBitmapType_()
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetDefaultBitmapType_");
     return MarshalExceptions<int>([&](){
         return Image::GetDefaultBitmapType();
     });
@@ -306,6 +349,7 @@ ALTERNET_UI_API int Image_GetDefaultBitmapType_()
 
 ALTERNET_UI_API void* Image_LockBits_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_LockBits_");
     return MarshalExceptions<void*>([&](){
         return obj->LockBits();
     });
@@ -313,6 +357,7 @@ ALTERNET_UI_API void* Image_LockBits_(Image* obj)
 
 ALTERNET_UI_API int Image_GetStride_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_GetStride_");
     return MarshalExceptions<int>([&](){
         return obj->GetStride();
     });
@@ -320,8 +365,81 @@ ALTERNET_UI_API int Image_GetStride_(Image* obj)
 
 ALTERNET_UI_API void Image_UnlockBits_(Image* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Image_UnlockBits_");
     MarshalExceptions<void>([&](){
         obj->UnlockBits();
     });
 }
 
+ALTERNET_UI_API void Image_SetBundle_(Image* obj, ImageBundle* bundle)
+{
+    ALTERNET_UI_PERF_EXPORT("Image_SetBundle_");
+    MarshalExceptions<void>([&](){
+        obj->SetBundle(bundle);
+    });
+}
+
+ALTERNET_UI_API c_bool Image_SaveStreamWithPreset_(Image* obj, void* stream, int bitmapType, int preset, int quality, int compressionLevel, int filter, int threadCount)
+{
+    ALTERNET_UI_PERF_EXPORT("Image_SaveStreamWithPreset_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->SaveStreamWithPreset(stream, bitmapType, preset, quality, compressionLevel, filter, threadCount);
+    });
+}
+
+ALTERNET_UI_API c_bool Image_SaveFileWithPreset_(Image* obj, NativeStringSpan* fileName, int bitmapType, int preset, int quality, int compressionLevel, int filter, int threadCount)
+{
+    ALTERNET_UI_PERF_EXPORT("Image_SaveFileWithPreset_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->SaveFileWithPreset(*fileName, bitmapType, preset, quality, compressionLevel, filter, threadCount);
+    });
+}
+
+ALTERNET_UI_API Image* Image_CreatePooled_(int width, int height, int depth, double scaleFactor)
+{
+    ALTERNET_UI_PERF_EXPORT("Image_CreatePooled_");
+    return MarshalExceptions<Image*>([&](){
+        return Image::CreatePooled(width, height, depth, scaleFactor);
+    });
+}
+
+ALTERNET_UI_API void Image_ReturnToPool_(Image* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("Image_ReturnToPool_");
+    MarshalExceptions<void>([&](){
+        obj->ReturnToPool();
+    });
+}
+
+ALTERNET_UI_API void Image_SetBitmapPoolLimit_(int64_t value)
+{
+    ALTERNET_UI_PERF_EXPORT("Image_SetBitmapPoolLimit_");
+    MarshalExceptions<void>([&](){
+        Image::SetBitmapPoolLimit(value);
+    });
+}
+
+ALTERNET_UI_API int64_t Image_GetBitmapPoolLimit_()
+{
+    ALTERNET_UI_PERF_EXPORT("Image_GetBitmapPoolLimit_");
+    return MarshalExceptions<int64_t>([&](){
+        return Image::GetBitmapPoolLimit();
+    });
+}
+
+ALTERNET_UI_API int64_t Image_GetBitmapPoolBytes_()
+{
+    ALTERNET_UI_PERF_EXPORT("Image_GetBitmapPoolBytes_");
+    return MarshalExceptions<int64_t>([&](){
+        return Image::GetBitmapPoolBytes();
+    });
+}
+
+ALTERNET_UI_API void Image_ClearBitmapPool_()
+{
+    ALTERNET_UI_PERF_EXPORT("Image_ClearBitmapPool_");
+    MarshalExceptions<void>([&](){
+        Image::ClearBitmapPool();
+    });
+}
+
@@ -0,0 +1,84 @@
+// <auto-generated> DO NOT MODIFY MANUALLY. Copyright (c) 2026 AlterNET Software.</auto-generated>
+
+#pragma once
+
+#include "ImageBundle.h"
+#include "Image.h"
+#include "Control.h"
+#include "ApiUtils.h"
+#include "Exceptions.h"
+
+using namespace Alternet::UI;
+
+ALTERNET_UI_API ImageBundle* ImageBundle_Create_()
+{
+    ALTERNET_UI_PERF_EXPORT("ImageBundle_Create_");
+    return MarshalExceptions<ImageBundle*>([&](){
+        return new ImageBundle();
+    });
+}
+
+ALTERNET_UI_API void ImageBundle_AddImage_(ImageBundle* obj, Image* image)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageBundle_AddImage_");
+    MarshalExceptions<void>([&](){
+        obj->AddImage(image);
+    });
+}
+
+ALTERNET_UI_API c_bool ImageBundle_LoadSvgFromString_(ImageBundle* obj, NativeStringSpan* s, int width, int height, Color* color)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageBundle_LoadSvgFromString_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->LoadSvgFromString(*s, width, height, *color);
+    });
+}
+
+ALTERNET_UI_API void ImageBundle_Clear_(ImageBundle* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageBundle_Clear_");
+    MarshalExceptions<void>([&](){
+        obj->Clear();
+    });
+}
+
+ALTERNET_UI_API c_bool ImageBundle_IsOk_(ImageBundle* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageBundle_IsOk_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->IsOk();
+    });
+}
+
+ALTERNET_UI_API Image* ImageBundle_GetImage_(ImageBundle* obj, double scale)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageBundle_GetImage_");
+    return MarshalExceptions<Image*>([&](){
+        return obj->GetImage(scale);
+    });
+}
+
+ALTERNET_UI_API Image* ImageBundle_GetImageForControl_(ImageBundle* obj, Control* control)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageBundle_GetImageForControl_");
+    return MarshalExceptions<Image*>([&](){
+        return obj->GetImageForControl(control);
+    });
+}
+
+ALTERNET_UI_API int ImageBundle_GetCachedCount_(ImageBundle* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageBundle_GetCachedCount_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetCachedCount();
+    });
+}
+
+ALTERNET_UI_API void ImageBundle_ClearCache_(ImageBundle* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageBundle_ClearCache_");
+    MarshalExceptions<void>([&](){
+        obj->ClearCache();
+    });
+}
+
@@ -4,6 +4,7 @@
 
 #include "ImageList.h"
 #include "Image.h"
+#include "DrawingContext.h"
 #include "ApiUtils.h"
 #include "Exceptions.h"
 
@@ -11,6 +12,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API ImageList* ImageList_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_Create_");
     return MarshalExceptions<ImageList*>([&](){
         return new ImageList();
     });
@@ -18,6 +20,7 @@ ALTERNET_UI_API ImageList* ImageList_Create_()
 
 ALTERNET_UI_API int ImageList_GetPixelImageSizeX_(ImageList* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_GetPixelImageSizeX_");
     return MarshalExceptions<int>([&](){
         return obj->GetPixelImageSizeX();
     });
@@ -25,6 +28,7 @@ ALTERNET_UI_API int ImageList_GetPixelImageSizeX_(ImageList* obj)
 
 ALTERNET_UI_API int ImageList_GetPixelImageSizeY_(ImageList* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_GetPixelImageSizeY_");
     return MarshalExceptions<int>([&](){
         return obj->GetPixelImageSizeY();
     });
@@ -32,6 +36,7 @@ ALTERNET_UI_API int ImageList_GetPixelImageSizeY_(ImageList* obj)
 
 ALTERNET_UI_API float ImageList_GetImageSizeX_(ImageList* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_GetImageSizeX_");
     return MarshalExceptions<float>([&](){
         return obj->GetImageSizeX();
     });
@@ -39,13 +44,31 @@ ALTERNET_UI_API float ImageList_GetImageSizeX_(ImageList* obj)
 
 ALTERNET_UI_API float ImageList_GetImageSizeY_(ImageList* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_GetImageSizeY_");
     return MarshalExceptions<float>([&](){
         return obj->GetImageSizeY();
     });
 }
 
+ALTERNET_UI_API c_bool ImageList_GetUseAtlas_(ImageList* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageList_GetUseAtlas_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->GetUseAtlas();
+    });
+}
+
+ALTERNET_UI_API void ImageList_SetUseAtlas_(ImageList* obj, c_bool value)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageList_SetUseAtlas_");
+    MarshalExceptions<void>([&](){
+        obj->SetUseAtlas(value);
+    });
+}
+
 ALTERNET_UI_API void ImageList_AddImage_(ImageList* obj, Image* image)
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_AddImage_");
     MarshalExceptions<void>([&](){
         obj->AddImage(image);
     });
@@ -53,6 +76,7 @@ ALTERNET_UI_API void ImageList_AddImage_(ImageList* obj, Image* image)
 
 ALTERNET_UI_API void ImageList_SetImageSize_(ImageList* obj, float sizeX, float sizeY)
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_SetImageSize_");
     MarshalExceptions<void>([&](){
         obj->SetImageSize(sizeX, sizeY);
     });
@@ -60,6 +84,7 @@ ALTERNET_UI_API void ImageList_SetImageSize_(ImageList* obj, float sizeX, float
 
 ALTERNET_UI_API void ImageList_SetPixelImageSize_(ImageList* obj, int sizeX, int sizeY)
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_SetPixelImageSize_");
     MarshalExceptions<void>([&](){
         obj->SetPixelImageSize(sizeX, sizeY);
     });
@@ -67,6 +92,7 @@ ALTERNET_UI_API void ImageList_SetPixelImageSize_(ImageList* obj, int sizeX, int
 
 ALTERNET_UI_API c_bool ImageList_Remove_(ImageList* obj, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_Remove_");
     return MarshalExceptions<c_bool>([&](){
         return obj->Remove(index);
     });
@@ -74,8 +100,25 @@ ALTERNET_UI_API c_bool ImageList_Remove_(ImageList* obj, int index)
 
 ALTERNET_UI_API c_bool ImageList_Clear_(ImageList* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ImageList_Clear_");
     return MarshalExceptions<c_bool>([&](){
         return obj->Clear();
     });
 }
 
+ALTERNET_UI_API int ImageList_AddImages_(ImageList* obj, int64_t* images, int imagesCount)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageList_AddImages_");
+    return MarshalExceptions<int>([&](){
+        return obj->AddImages(images, imagesCount);
+    });
+}
+
+ALTERNET_UI_API void ImageList_Draw_(ImageList* obj, DrawingContext* dc, int index, int x, int y)
+{
+    ALTERNET_UI_PERF_EXPORT("ImageList_Draw_");
+    MarshalExceptions<void>([&](){
+        obj->Draw(dc, index, x, y);
+    });
+}
+
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Keyboard* Keyboard_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Keyboard_Create_");
     return MarshalExceptions<Keyboard*>([&](){
         return new Keyboard();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API Keyboard* Keyboard_Create_()
 
 ALTERNET_UI_API int Keyboard_GetInputChar_()
 {
+    ALTERNET_UI_PERF_EXPORT("Keyboard_GetInputChar_");
     return MarshalExceptions<int>([&](){
         return Keyboard::GetInputChar();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API int Keyboard_GetInputChar_()
 
 ALTERNET_UI_API uint8_t Keyboard_GetInputEventCode_()
 {
+    ALTERNET_UI_PERF_EXPORT("Keyboard_GetInputEventCode_");
     return MarshalExceptions<uint8_t>([&](){
         return Keyboard::GetInputEventCode();
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API uint8_t Keyboard_GetInputEventCode_()
 
 ALTERNET_UI_API c_bool Keyboard_GetInputHandled_()
 {
+    ALTERNET_UI_PERF_EXPORT("Keyboard_GetInputHandled_");
     return MarshalExceptions<c_bool>([&](){
         return Keyboard::GetInputHandled();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API c_bool Keyboard_GetInputHandled_()
 
 ALTERNET_UI_API void Keyboard_SetInputHandled_(c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Keyboard_SetInputHandled_");
     MarshalExceptions<void>([&](){
         Keyboard::SetInputHandled(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void Keyboard_SetInputHandled_(c_bool value)
 
 ALTERNET_UI_API int Keyboard_GetInputKey_()
 {
+    ALTERNET_UI_PERF_EXPORT("Keyboard_GetInputKey_");
     return MarshalExceptions<int>([&](){
         return Keyboard::GetInputKey();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API int Keyboard_GetInputKey_()
 
 ALTERNET_UI_API c_bool Keyboard_GetInputIsRepeat_()
 {
+    ALTERNET_UI_PERF_EXPORT("Keyboard_GetInputIsRepeat_");
     return MarshalExceptions<c_bool>([&](){
         return Keyboard::GetInputIsRepeat();
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API c_bool Keyboard_GetInputIsRepeat_()
 
 ALTERNET_UI_API KeyStates Keyboard_GetKeyState_(Key key)
 {
+    ALTERNET_UI_PERF_EXPORT("Keyboard_GetKeyState_");
     return MarshalExceptions<KeyStates>([&](){
         return Keyboard::GetKeyState(key);
     });
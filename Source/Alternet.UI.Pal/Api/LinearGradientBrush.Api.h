@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API LinearGradientBrush* LinearGradientBrush_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("LinearGradientBrush_Create_");
     return MarshalExceptions<LinearGradientBrush*>([&](){
         return new LinearGradientBrush();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API LinearGradientBrush* LinearGradientBrush_Create_()
 
 ALTERNET_UI_API void LinearGradientBrush_Initialize_(LinearGradientBrush* obj, PointD* startPoint, PointD* endPoint, Color* gradientStopsColors, int gradientStopsColorsCount, float* gradientStopsOffsets, int gradientStopsOffsetsCount)
 {
+    ALTERNET_UI_PERF_EXPORT("LinearGradientBrush_Initialize_");
     MarshalExceptions<void>([&](){
         obj->Initialize(*startPoint, *endPoint, gradientStopsColors, gradientStopsColorsCount, gradientStopsOffsets, gradientStopsOffsetsCount);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API ListBox* ListBox_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_Create_");
     return MarshalExceptions<ListBox*>([&](){
         return new ListBox();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API ListBox* ListBox_Create_()
 
 ALTERNET_UI_API c_bool ListBox_GetHasBorder_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API c_bool ListBox_GetHasBorder_(ListBox* obj)
 
 ALTERNET_UI_API void ListBox_SetHasBorder_(ListBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void ListBox_SetHasBorder_(ListBox* obj, c_bool value)
 
 ALTERNET_UI_API void ListBox_Check_(ListBox* obj, int item, c_bool check)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_Check_");
     MarshalExceptions<void>([&](){
         obj->Check(item, check);
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API void ListBox_Check_(ListBox* obj, int item, c_bool check)
 
 ALTERNET_UI_API c_bool ListBox_IsChecked_(ListBox* obj, int item)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_IsChecked_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsChecked(item);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API c_bool ListBox_IsChecked_(ListBox* obj, int item)
 
 ALTERNET_UI_API void* ListBox_CreateListBox_(ListBoxHandlerCreateFlags createFlags)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_CreateListBox_");
     return MarshalExceptions<void*>([&](){
         return ListBox::CreateListBox(createFlags);
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API void* ListBox_CreateListBox_(ListBoxHandlerCreateFlags createFla
 
 ALTERNET_UI_API int ListBox_GetSelection_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetSelection_");
     return MarshalExceptions<int>([&](){
         return obj->GetSelection();
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API int ListBox_GetSelection_(ListBox* obj)
 
 ALTERNET_UI_API c_bool ListBox_IsSelected_(ListBox* obj, int n)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_IsSelected_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsSelected(n);
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API c_bool ListBox_IsSelected_(ListBox* obj, int n)
 
 ALTERNET_UI_API c_bool ListBox_IsSorted_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_IsSorted_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsSorted();
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API c_bool ListBox_IsSorted_(ListBox* obj)
 
 ALTERNET_UI_API c_bool ListBox_SetStringSelection_(ListBox* obj, NativeStringSpan* s, c_bool select)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_SetStringSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetStringSelection(*s, select);
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API c_bool ListBox_SetStringSelection_(ListBox* obj, NativeStringSpa
 
 ALTERNET_UI_API void ListBox_SetItemSelection_(ListBox* obj, int index, c_bool select)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_SetItemSelection_");
     MarshalExceptions<void>([&](){
         obj->SetItemSelection(index, select);
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API void ListBox_SetItemSelection_(ListBox* obj, int index, c_bool s
 
 ALTERNET_UI_API int ListBox_FindString_(ListBox* obj, NativeStringSpan* s, c_bool bCase)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_FindString_");
     return MarshalExceptions<int>([&](){
         return obj->FindString(*s, bCase);
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API int ListBox_FindString_(ListBox* obj, NativeStringSpan* s, c_boo
 
 ALTERNET_UI_API int ListBox_GetCountPerPage_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetCountPerPage_");
     return MarshalExceptions<int>([&](){
         return obj->GetCountPerPage();
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API int ListBox_GetCountPerPage_(ListBox* obj)
 
 ALTERNET_UI_API int ListBox_GetTopItem_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetTopItem_");
     return MarshalExceptions<int>([&](){
         return obj->GetTopItem();
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API int ListBox_GetTopItem_(ListBox* obj)
 
 ALTERNET_UI_API int ListBox_HitTest_(ListBox* obj, PointD* point)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_HitTest_");
     return MarshalExceptions<int>([&](){
         return obj->HitTest(*point);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API int ListBox_HitTest_(ListBox* obj, PointD* point)
 
 ALTERNET_UI_API NativeStringSpan_C ListBox_GetString_(ListBox* obj, uint32_t n)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetString_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetString(n);
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API NativeStringSpan_C ListBox_GetString_(ListBox* obj, uint32_t n)
 
 ALTERNET_UI_API uint32_t ListBox_GetCount_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetCount_");
     return MarshalExceptions<uint32_t>([&](){
         return obj->GetCount();
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API uint32_t ListBox_GetCount_(ListBox* obj)
 
 ALTERNET_UI_API void ListBox_Deselect_(ListBox* obj, int n)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_Deselect_");
     MarshalExceptions<void>([&](){
         obj->Deselect(n);
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API void ListBox_Deselect_(ListBox* obj, int n)
 
 ALTERNET_UI_API void ListBox_EnsureVisible_(ListBox* obj, int n)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_EnsureVisible_");
     MarshalExceptions<void>([&](){
         obj->EnsureVisible(n);
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API void ListBox_EnsureVisible_(ListBox* obj, int n)
 
 ALTERNET_UI_API void ListBox_SetFirstItem_(ListBox* obj, int n)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_SetFirstItem_");
     MarshalExceptions<void>([&](){
         obj->SetFirstItem(n);
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API void ListBox_SetFirstItem_(ListBox* obj, int n)
 
 ALTERNET_UI_API void ListBox_SetFirstItemStr_(ListBox* obj, NativeStringSpan* s)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_SetFirstItemStr_");
     MarshalExceptions<void>([&](){
         obj->SetFirstItemStr(*s);
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API void ListBox_SetFirstItemStr_(ListBox* obj, NativeStringSpan* s)
 
 ALTERNET_UI_API void ListBox_SetSelection_(ListBox* obj, int n)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_SetSelection_");
     MarshalExceptions<void>([&](){
         obj->SetSelection(n);
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API void ListBox_SetSelection_(ListBox* obj, int n)
 
 ALTERNET_UI_API void ListBox_SetString_(ListBox* obj, uint32_t n, NativeStringSpan* s)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_SetString_");
     MarshalExceptions<void>([&](){
         obj->SetString(n, *s);
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API void ListBox_SetString_(ListBox* obj, uint32_t n, NativeStringSp
 
 ALTERNET_UI_API void ListBox_Clear_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_Clear_");
     MarshalExceptions<void>([&](){
         obj->Clear();
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API void ListBox_Clear_(ListBox* obj)
 
 ALTERNET_UI_API void ListBox_Delete_(ListBox* obj, uint32_t n)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_Delete_");
     MarshalExceptions<void>([&](){
         obj->Delete(n);
     });
@@ -185,6 +210,7 @@ ALTERNET_UI_API void ListBox_Delete_(ListBox* obj, uint32_t n)
 
 ALTERNET_UI_API int ListBox_Append_(ListBox* obj, NativeStringSpan* s)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_Append_");
     return MarshalExceptions<int>([&](){
         return obj->Append(*s);
     });
@@ -192,6 +218,7 @@ ALTERNET_UI_API int ListBox_Append_(ListBox* obj, NativeStringSpan* s)
 
 ALTERNET_UI_API int ListBox_Insert_(ListBox* obj, NativeStringSpan* item, uint32_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_Insert_");
     return MarshalExceptions<int>([&](){
         return obj->Insert(*item, pos);
     });
@@ -199,6 +226,7 @@ ALTERNET_UI_API int ListBox_Insert_(ListBox* obj, NativeStringSpan* item, uint32
 
 ALTERNET_UI_API int ListBox_GetSelectionsCount_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetSelectionsCount_");
     return MarshalExceptions<int>([&](){
         return obj->GetSelectionsCount();
     });
@@ -206,6 +234,7 @@ ALTERNET_UI_API int ListBox_GetSelectionsCount_(ListBox* obj)
 
 ALTERNET_UI_API int ListBox_GetSelectionsItem_(ListBox* obj, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetSelectionsItem_");
     return MarshalExceptions<int>([&](){
         return obj->GetSelectionsItem(index);
     });
@@ -213,6 +242,7 @@ ALTERNET_UI_API int ListBox_GetSelectionsItem_(ListBox* obj, int index)
 
 ALTERNET_UI_API void ListBox_UpdateSelections_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_UpdateSelections_");
     MarshalExceptions<void>([&](){
         obj->UpdateSelections();
     });
@@ -220,6 +250,7 @@ ALTERNET_UI_API void ListBox_UpdateSelections_(ListBox* obj)
 
 ALTERNET_UI_API void ListBox_SetFlags_(ListBox* obj, ListBoxHandlerFlags flags)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_SetFlags_");
     MarshalExceptions<void>([&](){
         obj->SetFlags(flags);
     });
@@ -227,6 +258,7 @@ ALTERNET_UI_API void ListBox_SetFlags_(ListBox* obj, ListBoxHandlerFlags flags)
 
 ALTERNET_UI_API ListBoxHandlerFlags ListBox_GetFlags_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetFlags_");
     return MarshalExceptions<ListBoxHandlerFlags>([&](){
         return obj->GetFlags();
     });
@@ -234,6 +266,7 @@ ALTERNET_UI_API ListBoxHandlerFlags ListBox_GetFlags_(ListBox* obj)
 
 ALTERNET_UI_API int ListBox_GetCheckedIndexesCount_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetCheckedIndexesCount_");
     return MarshalExceptions<int>([&](){
         return obj->GetCheckedIndexesCount();
     });
@@ -241,6 +274,7 @@ ALTERNET_UI_API int ListBox_GetCheckedIndexesCount_(ListBox* obj)
 
 ALTERNET_UI_API int ListBox_GetCheckedIndexesItem_(ListBox* obj, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_GetCheckedIndexesItem_");
     return MarshalExceptions<int>([&](){
         return obj->GetCheckedIndexesItem(index);
     });
@@ -248,6 +282,7 @@ ALTERNET_UI_API int ListBox_GetCheckedIndexesItem_(ListBox* obj, int index)
 
 ALTERNET_UI_API void ListBox_UpdateCheckedIndexes_(ListBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListBox_UpdateCheckedIndexes_");
     MarshalExceptions<void>([&](){
         obj->UpdateCheckedIndexes();
     });
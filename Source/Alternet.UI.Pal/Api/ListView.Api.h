@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API ListView* ListView_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_Create_");
     return MarshalExceptions<ListView*>([&](){
         return new ListView();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API ListView* ListView_Create_()
 
 ALTERNET_UI_API c_bool ListView_GetHasBorder_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API c_bool ListView_GetHasBorder_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetHasBorder_(ListView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void ListView_SetHasBorder_(ListView* obj, c_bool value)
 
 ALTERNET_UI_API int64_t ListView_GetItemsCount_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetItemsCount_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetItemsCount();
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API int64_t ListView_GetItemsCount_(ListView* obj)
 
 ALTERNET_UI_API ImageList* ListView_GetSmallImageList_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetSmallImageList_");
     return MarshalExceptions<ImageList*>([&](){
         return obj->GetSmallImageList();
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API ImageList* ListView_GetSmallImageList_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetSmallImageList_(ListView* obj, ImageList* value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetSmallImageList_");
     MarshalExceptions<void>([&](){
         obj->SetSmallImageList(value);
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API void ListView_SetSmallImageList_(ListView* obj, ImageList* value
 
 ALTERNET_UI_API ImageList* ListView_GetLargeImageList_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetLargeImageList_");
     return MarshalExceptions<ImageList*>([&](){
         return obj->GetLargeImageList();
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API ImageList* ListView_GetLargeImageList_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetLargeImageList_(ListView* obj, ImageList* value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetLargeImageList_");
     MarshalExceptions<void>([&](){
         obj->SetLargeImageList(value);
     });
@@ -67,6 +75,7 @@ ALTERNET_UI_API void ListView_SetLargeImageList_(ListView* obj, ImageList* value
 
 ALTERNET_UI_API ListViewView ListView_GetCurrentView_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetCurrentView_");
     return MarshalExceptions<ListViewView>([&](){
         return obj->GetCurrentView();
     });
@@ -74,6 +83,7 @@ ALTERNET_UI_API ListViewView ListView_GetCurrentView_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetCurrentView_(ListView* obj, ListViewView value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetCurrentView_");
     MarshalExceptions<void>([&](){
         obj->SetCurrentView(value);
     });
@@ -81,6 +91,7 @@ ALTERNET_UI_API void ListView_SetCurrentView_(ListView* obj, ListViewView value)
 
 ALTERNET_UI_API ListViewSelectionMode ListView_GetSelectionMode_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetSelectionMode_");
     return MarshalExceptions<ListViewSelectionMode>([&](){
         return obj->GetSelectionMode();
     });
@@ -88,6 +99,7 @@ ALTERNET_UI_API ListViewSelectionMode ListView_GetSelectionMode_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetSelectionMode_(ListView* obj, ListViewSelectionMode value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetSelectionMode_");
     MarshalExceptions<void>([&](){
         obj->SetSelectionMode(value);
     });
@@ -95,6 +107,7 @@ ALTERNET_UI_API void ListView_SetSelectionMode_(ListView* obj, ListViewSelection
 
 ALTERNET_UI_API c_bool ListView_GetAllowLabelEdit_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetAllowLabelEdit_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowLabelEdit();
     });
@@ -102,6 +115,7 @@ ALTERNET_UI_API c_bool ListView_GetAllowLabelEdit_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetAllowLabelEdit_(ListView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetAllowLabelEdit_");
     MarshalExceptions<void>([&](){
         obj->SetAllowLabelEdit(value);
     });
@@ -109,6 +123,7 @@ ALTERNET_UI_API void ListView_SetAllowLabelEdit_(ListView* obj, c_bool value)
 
 ALTERNET_UI_API int64_t ListView_GetTopItemIndex_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetTopItemIndex_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetTopItemIndex();
     });
@@ -116,6 +131,7 @@ ALTERNET_UI_API int64_t ListView_GetTopItemIndex_(ListView* obj)
 
 ALTERNET_UI_API ListViewGridLinesDisplayMode ListView_GetGridLinesDisplayMode_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetGridLinesDisplayMode_");
     return MarshalExceptions<ListViewGridLinesDisplayMode>([&](){
         return obj->GetGridLinesDisplayMode();
     });
@@ -123,6 +139,7 @@ ALTERNET_UI_API ListViewGridLinesDisplayMode ListView_GetGridLinesDisplayMode_(L
 
 ALTERNET_UI_API void ListView_SetGridLinesDisplayMode_(ListView* obj, ListViewGridLinesDisplayMode value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetGridLinesDisplayMode_");
     MarshalExceptions<void>([&](){
         obj->SetGridLinesDisplayMode(value);
     });
@@ -130,6 +147,7 @@ ALTERNET_UI_API void ListView_SetGridLinesDisplayMode_(ListView* obj, ListViewGr
 
 ALTERNET_UI_API ListViewSortMode ListView_GetSortMode_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetSortMode_");
     return MarshalExceptions<ListViewSortMode>([&](){
         return obj->GetSortMode();
     });
@@ -137,6 +155,7 @@ ALTERNET_UI_API ListViewSortMode ListView_GetSortMode_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetSortMode_(ListView* obj, ListViewSortMode value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetSortMode_");
     MarshalExceptions<void>([&](){
         obj->SetSortMode(value);
     });
@@ -144,6 +163,7 @@ ALTERNET_UI_API void ListView_SetSortMode_(ListView* obj, ListViewSortMode value
 
 ALTERNET_UI_API c_bool ListView_GetColumnHeaderVisible_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetColumnHeaderVisible_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetColumnHeaderVisible();
     });
@@ -151,6 +171,7 @@ ALTERNET_UI_API c_bool ListView_GetColumnHeaderVisible_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetColumnHeaderVisible_(ListView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetColumnHeaderVisible_");
     MarshalExceptions<void>([&](){
         obj->SetColumnHeaderVisible(value);
     });
@@ -158,6 +179,7 @@ ALTERNET_UI_API void ListView_SetColumnHeaderVisible_(ListView* obj, c_bool valu
 
 ALTERNET_UI_API int64_t ListView_GetFocusedItemIndex_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetFocusedItemIndex_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetFocusedItemIndex();
     });
@@ -165,6 +187,7 @@ ALTERNET_UI_API int64_t ListView_GetFocusedItemIndex_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetFocusedItemIndex_(ListView* obj, int64_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetFocusedItemIndex_");
     MarshalExceptions<void>([&](){
         obj->SetFocusedItemIndex(value);
     });
@@ -172,6 +195,7 @@ ALTERNET_UI_API void ListView_SetFocusedItemIndex_(ListView* obj, int64_t value)
 
 ALTERNET_UI_API void* ListView_OpenSelectedIndicesArray_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_OpenSelectedIndicesArray_");
     return MarshalExceptions<void*>([&](){
         return obj->OpenSelectedIndicesArray();
     });
@@ -179,6 +203,7 @@ ALTERNET_UI_API void* ListView_OpenSelectedIndicesArray_(ListView* obj)
 
 ALTERNET_UI_API int ListView_GetSelectedIndicesItemCount_(ListView* obj, void* array)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetSelectedIndicesItemCount_");
     return MarshalExceptions<int>([&](){
         return obj->GetSelectedIndicesItemCount(array);
     });
@@ -186,6 +211,7 @@ ALTERNET_UI_API int ListView_GetSelectedIndicesItemCount_(ListView* obj, void* a
 
 ALTERNET_UI_API int64_t ListView_GetSelectedIndicesItemAt_(ListView* obj, void* array, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetSelectedIndicesItemAt_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetSelectedIndicesItemAt(array, index);
     });
@@ -193,6 +219,7 @@ ALTERNET_UI_API int64_t ListView_GetSelectedIndicesItemAt_(ListView* obj, void*
 
 ALTERNET_UI_API void ListView_CloseSelectedIndicesArray_(ListView* obj, void* array)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_CloseSelectedIndicesArray_");
     MarshalExceptions<void>([&](){
         obj->CloseSelectedIndicesArray(array);
     });
@@ -200,6 +227,7 @@ ALTERNET_UI_API void ListView_CloseSelectedIndicesArray_(ListView* obj, void* ar
 
 ALTERNET_UI_API void ListView_InsertItemAt_(ListView* obj, int64_t index, NativeStringSpan* text, int64_t columnIndex, int imageIndex)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_InsertItemAt_");
     MarshalExceptions<void>([&](){
         obj->InsertItemAt(index, *text, columnIndex, imageIndex);
     });
@@ -207,6 +235,7 @@ ALTERNET_UI_API void ListView_InsertItemAt_(ListView* obj, int64_t index, Native
 
 ALTERNET_UI_API void ListView_RemoveItemAt_(ListView* obj, int64_t index)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_RemoveItemAt_");
     MarshalExceptions<void>([&](){
         obj->RemoveItemAt(index);
     });
@@ -214,6 +243,7 @@ ALTERNET_UI_API void ListView_RemoveItemAt_(ListView* obj, int64_t index)
 
 ALTERNET_UI_API void ListView_ClearItems_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_ClearItems_");
     MarshalExceptions<void>([&](){
         obj->ClearItems();
     });
@@ -221,6 +251,7 @@ ALTERNET_UI_API void ListView_ClearItems_(ListView* obj)
 
 ALTERNET_UI_API void ListView_InsertColumnAt_(ListView* obj, int64_t index, NativeStringSpan* header, float width, ListViewColumnWidthMode widthMode)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_InsertColumnAt_");
     MarshalExceptions<void>([&](){
         obj->InsertColumnAt(index, *header, width, widthMode);
     });
@@ -228,6 +259,7 @@ ALTERNET_UI_API void ListView_InsertColumnAt_(ListView* obj, int64_t index, Nati
 
 ALTERNET_UI_API void ListView_RemoveColumnAt_(ListView* obj, int64_t index)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_RemoveColumnAt_");
     MarshalExceptions<void>([&](){
         obj->RemoveColumnAt(index);
     });
@@ -235,6 +267,7 @@ ALTERNET_UI_API void ListView_RemoveColumnAt_(ListView* obj, int64_t index)
 
 ALTERNET_UI_API void ListView_ClearSelected_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_ClearSelected_");
     MarshalExceptions<void>([&](){
         obj->ClearSelected();
     });
@@ -242,6 +275,7 @@ ALTERNET_UI_API void ListView_ClearSelected_(ListView* obj)
 
 ALTERNET_UI_API void ListView_SetSelected_(ListView* obj, int64_t index, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetSelected_");
     MarshalExceptions<void>([&](){
         obj->SetSelected(index, value);
     });
@@ -249,6 +283,7 @@ ALTERNET_UI_API void ListView_SetSelected_(ListView* obj, int64_t index, c_bool
 
 ALTERNET_UI_API void* ListView_ItemHitTest_(ListView* obj, PointD* point)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_ItemHitTest_");
     return MarshalExceptions<void*>([&](){
         return obj->ItemHitTest(*point);
     });
@@ -256,6 +291,7 @@ ALTERNET_UI_API void* ListView_ItemHitTest_(ListView* obj, PointD* point)
 
 ALTERNET_UI_API ListViewHitTestLocations ListView_GetHitTestResultLocations_(ListView* obj, void* hitTestResult)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetHitTestResultLocations_");
     return MarshalExceptions<ListViewHitTestLocations>([&](){
         return obj->GetHitTestResultLocations(hitTestResult);
     });
@@ -263,6 +299,7 @@ ALTERNET_UI_API ListViewHitTestLocations ListView_GetHitTestResultLocations_(Lis
 
 ALTERNET_UI_API int64_t ListView_GetHitTestResultItemIndex_(ListView* obj, void* hitTestResult)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetHitTestResultItemIndex_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetHitTestResultItemIndex(hitTestResult);
     });
@@ -270,6 +307,7 @@ ALTERNET_UI_API int64_t ListView_GetHitTestResultItemIndex_(ListView* obj, void*
 
 ALTERNET_UI_API int64_t ListView_GetHitTestResultColumnIndex_(ListView* obj, void* hitTestResult)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetHitTestResultColumnIndex_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetHitTestResultColumnIndex(hitTestResult);
     });
@@ -277,6 +315,7 @@ ALTERNET_UI_API int64_t ListView_GetHitTestResultColumnIndex_(ListView* obj, voi
 
 ALTERNET_UI_API void ListView_FreeHitTestResult_(ListView* obj, void* hitTestResult)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_FreeHitTestResult_");
     MarshalExceptions<void>([&](){
         obj->FreeHitTestResult(hitTestResult);
     });
@@ -284,6 +323,7 @@ ALTERNET_UI_API void ListView_FreeHitTestResult_(ListView* obj, void* hitTestRes
 
 ALTERNET_UI_API void ListView_BeginLabelEdit_(ListView* obj, int64_t itemIndex)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_BeginLabelEdit_");
     MarshalExceptions<void>([&](){
         obj->BeginLabelEdit(itemIndex);
     });
@@ -291,6 +331,7 @@ ALTERNET_UI_API void ListView_BeginLabelEdit_(ListView* obj, int64_t itemIndex)
 
 ALTERNET_UI_API RectD_C ListView_GetItemBounds_(ListView* obj, int64_t itemIndex, ListViewItemBoundsPortion portion)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_GetItemBounds_");
     return MarshalExceptions<RectD_C>([&](){
         return obj->GetItemBounds(itemIndex, portion);
     });
@@ -298,6 +339,7 @@ ALTERNET_UI_API RectD_C ListView_GetItemBounds_(ListView* obj, int64_t itemIndex
 
 ALTERNET_UI_API void ListView_Clear_(ListView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_Clear_");
     MarshalExceptions<void>([&](){
         obj->Clear();
     });
@@ -305,6 +347,7 @@ ALTERNET_UI_API void ListView_Clear_(ListView* obj)
 
 ALTERNET_UI_API void ListView_EnsureItemVisible_(ListView* obj, int64_t itemIndex)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_EnsureItemVisible_");
     MarshalExceptions<void>([&](){
         obj->EnsureItemVisible(itemIndex);
     });
@@ -312,6 +355,7 @@ ALTERNET_UI_API void ListView_EnsureItemVisible_(ListView* obj, int64_t itemInde
 
 ALTERNET_UI_API void ListView_SetItemText_(ListView* obj, int64_t itemIndex, int64_t columnIndex, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetItemText_");
     MarshalExceptions<void>([&](){
         obj->SetItemText(itemIndex, columnIndex, *text);
     });
@@ -319,6 +363,7 @@ ALTERNET_UI_API void ListView_SetItemText_(ListView* obj, int64_t itemIndex, int
 
 ALTERNET_UI_API void ListView_SetItemImageIndex_(ListView* obj, int64_t itemIndex, int64_t columnIndex, int imageIndex)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetItemImageIndex_");
     MarshalExceptions<void>([&](){
         obj->SetItemImageIndex(itemIndex, columnIndex, imageIndex);
     });
@@ -326,6 +371,7 @@ ALTERNET_UI_API void ListView_SetItemImageIndex_(ListView* obj, int64_t itemInde
 
 ALTERNET_UI_API void ListView_SetColumnWidth_(ListView* obj, int64_t columnIndex, float fixedWidth, ListViewColumnWidthMode widthMode)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetColumnWidth_");
     MarshalExceptions<void>([&](){
         obj->SetColumnWidth(columnIndex, fixedWidth, widthMode);
     });
@@ -333,6 +379,7 @@ ALTERNET_UI_API void ListView_SetColumnWidth_(ListView* obj, int64_t columnIndex
 
 ALTERNET_UI_API void ListView_SetColumnTitle_(ListView* obj, int64_t columnIndex, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("ListView_SetColumnTitle_");
     MarshalExceptions<void>([&](){
         obj->SetColumnTitle(columnIndex, *text);
     });
@@ -0,0 +1,74 @@
+// <auto-generated> DO NOT MODIFY MANUALLY. Copyright (c) 2026 AlterNET Software.</auto-generated>
+
+#pragma once
+
+#include "MappedImage.h"
+#include "ApiUtils.h"
+#include "Exceptions.h"
+
+using namespace Alternet::UI;
+
+ALTERNET_UI_API MappedImage* MappedImage_Create_()
+{
+    ALTERNET_UI_PERF_EXPORT("MappedImage_Create_");
+    return MarshalExceptions<MappedImage*>([&](){
+        return new MappedImage();
+    });
+}
+
+ALTERNET_UI_API c_bool MappedImage_Open_(MappedImage* obj, NativeStringSpan* path)
+{
+    ALTERNET_UI_PERF_EXPORT("MappedImage_Open_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->Open(*path);
+    });
+}
+
+ALTERNET_UI_API void MappedImage_Close_(MappedImage* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("MappedImage_Close_");
+    MarshalExceptions<void>([&](){
+        obj->Close();
+    });
+}
+
+ALTERNET_UI_API c_bool MappedImage_IsOk_(MappedImage* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("MappedImage_IsOk_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->IsOk();
+    });
+}
+
+ALTERNET_UI_API int MappedImage_GetWidth_(MappedImage* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("MappedImage_GetWidth_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetWidth();
+    });
+}
+
+ALTERNET_UI_API int MappedImage_GetHeight_(MappedImage* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("MappedImage_GetHeight_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetHeight();
+    });
+}
+
+ALTERNET_UI_API void* MappedImage_ReadImage_(MappedImage* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("MappedImage_ReadImage_");
+    return MarshalExceptions<void*>([&](){
+        return obj->ReadImage();
+    });
+}
+
+ALTERNET_UI_API void* MappedImage_ReadRegion_(MappedImage* obj, int x, int y, int width, int height)
+{
+    ALTERNET_UI_PERF_EXPORT("MappedImage_ReadRegion_");
+    return MarshalExceptions<void*>([&](){
+        return obj->ReadRegion(x, y, width, height);
+    });
+}
+
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API MemoryFSHandler* MemoryFSHandler_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("MemoryFSHandler_Create_");
     return MarshalExceptions<MemoryFSHandler*>([&](){
         return new MemoryFSHandler();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API MemoryFSHandler* MemoryFSHandler_Create_()
 
 ALTERNET_UI_API void MemoryFSHandler_RemoveFile_(NativeStringSpan* filename)
 {
+    ALTERNET_UI_PERF_EXPORT("MemoryFSHandler_RemoveFile_");
     MarshalExceptions<void>([&](){
         MemoryFSHandler::RemoveFile(*filename);
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API void MemoryFSHandler_RemoveFile_(NativeStringSpan* filename)
 
 ALTERNET_UI_API void MemoryFSHandler_AddTextFileWithMimeType_(NativeStringSpan* filename, NativeStringSpan* textdata, NativeStringSpan* mimetype)
 {
+    ALTERNET_UI_PERF_EXPORT("MemoryFSHandler_AddTextFileWithMimeType_");
     MarshalExceptions<void>([&](){
         MemoryFSHandler::AddTextFileWithMimeType(*filename, *textdata, *mimetype);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void MemoryFSHandler_AddTextFileWithMimeType_(NativeStringSpan*
 
 ALTERNET_UI_API void MemoryFSHandler_AddTextFile_(NativeStringSpan* filename, NativeStringSpan* textdata)
 {
+    ALTERNET_UI_PERF_EXPORT("MemoryFSHandler_AddTextFile_");
     MarshalExceptions<void>([&](){
         MemoryFSHandler::AddTextFile(*filename, *textdata);
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API void MemoryFSHandler_AddTextFile_(NativeStringSpan* filename, Na
 
 ALTERNET_UI_API void MemoryFSHandler_AddFile_(NativeStringSpan* filename, void* binarydata, int size)
 {
+    ALTERNET_UI_PERF_EXPORT("MemoryFSHandler_AddFile_");
     MarshalExceptions<void>([&](){
         MemoryFSHandler::AddFile(*filename, binarydata, size);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void MemoryFSHandler_AddFile_(NativeStringSpan* filename, void*
 
 ALTERNET_UI_API void MemoryFSHandler_AddFileWithMimeType_(NativeStringSpan* filename, void* binarydata, int size, NativeStringSpan* mimetype)
 {
+    ALTERNET_UI_PERF_EXPORT("MemoryFSHandler_AddFileWithMimeType_");
     MarshalExceptions<void>([&](){
         MemoryFSHandler::AddFileWithMimeType(*filename, binarydata, size, *mimetype);
     });
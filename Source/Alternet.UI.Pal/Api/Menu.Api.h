@@ -13,6 +13,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Menu* Menu_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_Create_");
     return MarshalExceptions<Menu*>([&](){
         return new Menu();
     });
@@ -20,6 +21,7 @@ ALTERNET_UI_API Menu* Menu_Create_()
 
 ALTERNET_UI_API c_bool Menu_GetEventMenuItemChecked_()
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_GetEventMenuItemChecked_");
     return MarshalExceptions<c_bool>([&](){
         return Menu::GetEventMenuItemChecked();
     });
@@ -27,6 +29,7 @@ ALTERNET_UI_API c_bool Menu_GetEventMenuItemChecked_()
 
 ALTERNET_UI_API NativeStringSpan_C Menu_GetMacHelpMenuTitleName_(Menu* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_GetMacHelpMenuTitleName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetMacHelpMenuTitleName();
     });
@@ -34,6 +37,7 @@ ALTERNET_UI_API NativeStringSpan_C Menu_GetMacHelpMenuTitleName_(Menu* obj)
 
 ALTERNET_UI_API NativeStringSpan_C Menu_GetMacWindowMenuTitleName_(Menu* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_GetMacWindowMenuTitleName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetMacWindowMenuTitleName();
     });
@@ -41,6 +45,7 @@ ALTERNET_UI_API NativeStringSpan_C Menu_GetMacWindowMenuTitleName_(Menu* obj)
 
 ALTERNET_UI_API void Menu_MacSetCommonMenuBar_(Menu* obj, void* menuBar)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MacSetCommonMenuBar_");
     MarshalExceptions<void>([&](){
         obj->MacSetCommonMenuBar(menuBar);
     });
@@ -48,6 +53,7 @@ ALTERNET_UI_API void Menu_MacSetCommonMenuBar_(Menu* obj, void* menuBar)
 
 ALTERNET_UI_API void* Menu_GetMainMenu_(Window* window)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_GetMainMenu_");
     return MarshalExceptions<void*>([&](){
         return Menu::GetMainMenu(window);
     });
@@ -55,6 +61,7 @@ ALTERNET_UI_API void* Menu_GetMainMenu_(Window* window)
 
 ALTERNET_UI_API void* Menu_FindMenuItem_(Window* window, NativeStringSpan* id)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_FindMenuItem_");
     return MarshalExceptions<void*>([&](){
         return Menu::FindMenuItem(window, *id);
     });
@@ -62,6 +69,7 @@ ALTERNET_UI_API void* Menu_FindMenuItem_(Window* window, NativeStringSpan* id)
 
 ALTERNET_UI_API void Menu_SetMainMenu_(Window* window, void* menu)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_SetMainMenu_");
     MarshalExceptions<void>([&](){
         Menu::SetMainMenu(window, menu);
     });
@@ -69,6 +77,7 @@ ALTERNET_UI_API void Menu_SetMainMenu_(Window* window, void* menu)
 
 ALTERNET_UI_API c_bool Menu_MainMenuAppend_(void* menuHandle, void* menu, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MainMenuAppend_");
     return MarshalExceptions<c_bool>([&](){
         return Menu::MainMenuAppend(menuHandle, menu, *text);
     });
@@ -76,6 +85,7 @@ ALTERNET_UI_API c_bool Menu_MainMenuAppend_(void* menuHandle, void* menu, Native
 
 ALTERNET_UI_API void Menu_MainMenuSetEnabled_(void* menuHandle, NativeStringSpan* childId, c_bool enable)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MainMenuSetEnabled_");
     MarshalExceptions<void>([&](){
         Menu::MainMenuSetEnabled(menuHandle, *childId, enable);
     });
@@ -83,6 +93,7 @@ ALTERNET_UI_API void Menu_MainMenuSetEnabled_(void* menuHandle, NativeStringSpan
 
 ALTERNET_UI_API void* Menu_MainMenuGetSubMenu_(void* menuHandle, NativeStringSpan* childId)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MainMenuGetSubMenu_");
     return MarshalExceptions<void*>([&](){
         return Menu::MainMenuGetSubMenu(menuHandle, *childId);
     });
@@ -90,6 +101,7 @@ ALTERNET_UI_API void* Menu_MainMenuGetSubMenu_(void* menuHandle, NativeStringSpa
 
 ALTERNET_UI_API void* Menu_MainMenuRemove_(void* menuHandle, NativeStringSpan* childId)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MainMenuRemove_");
     return MarshalExceptions<void*>([&](){
         return Menu::MainMenuRemove(menuHandle, *childId);
     });
@@ -97,6 +109,7 @@ ALTERNET_UI_API void* Menu_MainMenuRemove_(void* menuHandle, NativeStringSpan* c
 
 ALTERNET_UI_API c_bool Menu_MainMenuInsert_(void* menuHandle, NativeStringSpan* childId, void* menu, NativeStringSpan* title)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MainMenuInsert_");
     return MarshalExceptions<c_bool>([&](){
         return Menu::MainMenuInsert(menuHandle, *childId, menu, *title);
     });
@@ -104,6 +117,7 @@ ALTERNET_UI_API c_bool Menu_MainMenuInsert_(void* menuHandle, NativeStringSpan*
 
 ALTERNET_UI_API void* Menu_MainMenuReplace_(void* menuHandle, NativeStringSpan* childId, void* menu, NativeStringSpan* title)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MainMenuReplace_");
     return MarshalExceptions<void*>([&](){
         return Menu::MainMenuReplace(menuHandle, *childId, menu, *title);
     });
@@ -111,6 +125,7 @@ ALTERNET_UI_API void* Menu_MainMenuReplace_(void* menuHandle, NativeStringSpan*
 
 ALTERNET_UI_API void Menu_MainMenuSetText_(void* menuHandle, NativeStringSpan* childId, NativeStringSpan* label)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MainMenuSetText_");
     MarshalExceptions<void>([&](){
         Menu::MainMenuSetText(menuHandle, *childId, *label);
     });
@@ -118,6 +133,7 @@ ALTERNET_UI_API void Menu_MainMenuSetText_(void* menuHandle, NativeStringSpan* c
 
 ALTERNET_UI_API void* Menu_CreateMainMenu_(NativeStringSpan* id)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_CreateMainMenu_");
     return MarshalExceptions<void*>([&](){
         return Menu::CreateMainMenu(*id);
     });
@@ -125,6 +141,7 @@ ALTERNET_UI_API void* Menu_CreateMainMenu_(NativeStringSpan* id)
 
 ALTERNET_UI_API void* Menu_CreateContextMenu_(NativeStringSpan* id)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_CreateContextMenu_");
     return MarshalExceptions<void*>([&](){
         return Menu::CreateContextMenu(*id);
     });
@@ -132,6 +149,7 @@ ALTERNET_UI_API void* Menu_CreateContextMenu_(NativeStringSpan* id)
 
 ALTERNET_UI_API void* Menu_CreateMenuItem_(MenuItemType itemType, NativeStringSpan* id, NativeStringSpan* title, NativeStringSpan* help, void* menuHandle)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_CreateMenuItem_");
     return MarshalExceptions<void*>([&](){
         return Menu::CreateMenuItem(itemType, *id, *title, *help, menuHandle);
     });
@@ -139,6 +157,7 @@ ALTERNET_UI_API void* Menu_CreateMenuItem_(MenuItemType itemType, NativeStringSp
 
 ALTERNET_UI_API void Menu_DestroyMainMenu_(void* menuHandle)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_DestroyMainMenu_");
     MarshalExceptions<void>([&](){
         Menu::DestroyMainMenu(menuHandle);
     });
@@ -146,6 +165,7 @@ ALTERNET_UI_API void Menu_DestroyMainMenu_(void* menuHandle)
 
 ALTERNET_UI_API void Menu_DestroyMenuItem_(void* menuHandle)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_DestroyMenuItem_");
     MarshalExceptions<void>([&](){
         Menu::DestroyMenuItem(menuHandle);
     });
@@ -153,6 +173,7 @@ ALTERNET_UI_API void Menu_DestroyMenuItem_(void* menuHandle)
 
 ALTERNET_UI_API void Menu_DestroyContextMenu_(void* menuHandle)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_DestroyContextMenu_");
     MarshalExceptions<void>([&](){
         Menu::DestroyContextMenu(menuHandle);
     });
@@ -160,6 +181,7 @@ ALTERNET_UI_API void Menu_DestroyContextMenu_(void* menuHandle)
 
 ALTERNET_UI_API NativeStringSpan_C Menu_GetMenuId_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_GetMenuId_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return Menu::GetMenuId(handle);
     });
@@ -167,6 +189,7 @@ ALTERNET_UI_API NativeStringSpan_C Menu_GetMenuId_(void* handle)
 
 ALTERNET_UI_API MenuItemType Menu_GetMenuItemType_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_GetMenuItemType_");
     return MarshalExceptions<MenuItemType>([&](){
         return Menu::GetMenuItemType(handle);
     });
@@ -174,6 +197,7 @@ ALTERNET_UI_API MenuItemType Menu_GetMenuItemType_(void* handle)
 
 ALTERNET_UI_API void Menu_SetMenuItemBitmap_(void* handle, Image* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_SetMenuItemBitmap_");
     MarshalExceptions<void>([&](){
         Menu::SetMenuItemBitmap(handle, value);
     });
@@ -181,6 +205,7 @@ ALTERNET_UI_API void Menu_SetMenuItemBitmap_(void* handle, Image* value)
 
 ALTERNET_UI_API void Menu_SetMenuItemEnabled_(void* handle, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_SetMenuItemEnabled_");
     MarshalExceptions<void>([&](){
         Menu::SetMenuItemEnabled(handle, value);
     });
@@ -188,6 +213,7 @@ ALTERNET_UI_API void Menu_SetMenuItemEnabled_(void* handle, c_bool value)
 
 ALTERNET_UI_API void Menu_SetMenuItemRole_(void* handle, NativeStringSpan* role)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_SetMenuItemRole_");
     MarshalExceptions<void>([&](){
         Menu::SetMenuItemRole(handle, *role);
     });
@@ -195,6 +221,7 @@ ALTERNET_UI_API void Menu_SetMenuItemRole_(void* handle, NativeStringSpan* role)
 
 ALTERNET_UI_API void Menu_SetMenuItemText_(void* handle, NativeStringSpan* value, NativeStringSpan* rightValue)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_SetMenuItemText_");
     MarshalExceptions<void>([&](){
         Menu::SetMenuItemText(handle, *value, *rightValue);
     });
@@ -202,6 +229,7 @@ ALTERNET_UI_API void Menu_SetMenuItemText_(void* handle, NativeStringSpan* value
 
 ALTERNET_UI_API void Menu_SetMenuItemChecked_(void* handle, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_SetMenuItemChecked_");
     MarshalExceptions<void>([&](){
         Menu::SetMenuItemChecked(handle, value);
     });
@@ -209,6 +237,7 @@ ALTERNET_UI_API void Menu_SetMenuItemChecked_(void* handle, c_bool value)
 
 ALTERNET_UI_API void Menu_SetMenuItemSubMenu_(void* handle, void* subMenuHandle)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_SetMenuItemSubMenu_");
     MarshalExceptions<void>([&](){
         Menu::SetMenuItemSubMenu(handle, subMenuHandle);
     });
@@ -216,6 +245,7 @@ ALTERNET_UI_API void Menu_SetMenuItemSubMenu_(void* handle, void* subMenuHandle)
 
 ALTERNET_UI_API void Menu_SetMenuItemShortcut_(void* handle, Key key, ModifierKeys modifierKeys)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_SetMenuItemShortcut_");
     MarshalExceptions<void>([&](){
         Menu::SetMenuItemShortcut(handle, key, modifierKeys);
     });
@@ -223,6 +253,7 @@ ALTERNET_UI_API void Menu_SetMenuItemShortcut_(void* handle, Key key, ModifierKe
 
 ALTERNET_UI_API void Menu_MenuAddItem_(void* handle, void* itemHandle)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MenuAddItem_");
     MarshalExceptions<void>([&](){
         Menu::MenuAddItem(handle, itemHandle);
     });
@@ -230,6 +261,7 @@ ALTERNET_UI_API void Menu_MenuAddItem_(void* handle, void* itemHandle)
 
 ALTERNET_UI_API void Menu_MenuRemoveItem_(void* handle, NativeStringSpan* childId)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MenuRemoveItem_");
     MarshalExceptions<void>([&](){
         Menu::MenuRemoveItem(handle, *childId);
     });
@@ -237,6 +269,7 @@ ALTERNET_UI_API void Menu_MenuRemoveItem_(void* handle, NativeStringSpan* childI
 
 ALTERNET_UI_API c_bool Menu_MenuInsertItem_(void* handle, NativeStringSpan* childId, void* itemHandle)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_MenuInsertItem_");
     return MarshalExceptions<c_bool>([&](){
         return Menu::MenuInsertItem(handle, *childId, itemHandle);
     });
@@ -244,6 +277,7 @@ ALTERNET_UI_API c_bool Menu_MenuInsertItem_(void* handle, NativeStringSpan* chil
 
 ALTERNET_UI_API void Menu_Show_(void* menuHandle, Control* control, PointD* position)
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_Show_");
     MarshalExceptions<void>([&](){
         Menu::Show(menuHandle, control, *position);
     });
@@ -251,6 +285,7 @@ ALTERNET_UI_API void Menu_Show_(void* menuHandle, Control* control, PointD* posi
 
 ALTERNET_UI_API NativeStringSpan_C Menu_GetEventMenuItemId_()
 {
+    ALTERNET_UI_PERF_EXPORT("Menu_GetEventMenuItemId_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return Menu::GetEventMenuItemId();
     });
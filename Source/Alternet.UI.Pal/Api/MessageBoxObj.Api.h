@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API DialogResult MessageBoxObj_Show_(Window* owner, NativeStringSpan* text, NativeStringSpan* caption, MessageBoxButtons buttons, MessageBoxIcon icon, MessageBoxDefaultButton defaultButton)
 {
+    ALTERNET_UI_PERF_EXPORT("MessageBoxObj_Show_");
     return MarshalExceptions<DialogResult>([&](){
         return MessageBoxObj::Show(owner, *text, *caption, buttons, icon, defaultButton);
     });
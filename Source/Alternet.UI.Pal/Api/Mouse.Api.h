@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Mouse* Mouse_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Mouse_Create_");
     return MarshalExceptions<Mouse*>([&](){
         return new Mouse();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API Mouse* Mouse_Create_()
 
 ALTERNET_UI_API PointI_C Mouse_GetPosition_()
 {
+    ALTERNET_UI_PERF_EXPORT("Mouse_GetPosition_");
     return MarshalExceptions<PointI_C>([&](){
         return Mouse::GetPosition();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API PointI_C Mouse_GetPosition_()
 
 ALTERNET_UI_API MouseButtonState Mouse_GetButtonState_(MouseButton button)
 {
+    ALTERNET_UI_PERF_EXPORT("Mouse_GetButtonState_");
     return MarshalExceptions<MouseButtonState>([&](){
         return Mouse::GetButtonState(button);
     });
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API NotifyIcon* NotifyIcon_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_Create_");
     return MarshalExceptions<NotifyIcon*>([&](){
         return new NotifyIcon();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API NotifyIcon* NotifyIcon_Create_()
 
 ALTERNET_UI_API Image* NotifyIcon_GetIcon_(NotifyIcon* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_GetIcon_");
     return MarshalExceptions<Image*>([&](){
         return obj->GetIcon();
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API Image* NotifyIcon_GetIcon_(NotifyIcon* obj)
 
 ALTERNET_UI_API void NotifyIcon_SetIcon_(NotifyIcon* obj, Image* value)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_SetIcon_");
     MarshalExceptions<void>([&](){
         obj->SetIcon(value);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void NotifyIcon_SetIcon_(NotifyIcon* obj, Image* value)
 
 ALTERNET_UI_API c_bool NotifyIcon_GetVisible_(NotifyIcon* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_GetVisible_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetVisible();
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API c_bool NotifyIcon_GetVisible_(NotifyIcon* obj)
 
 ALTERNET_UI_API void NotifyIcon_SetVisible_(NotifyIcon* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_SetVisible_");
     MarshalExceptions<void>([&](){
         obj->SetVisible(value);
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API void NotifyIcon_SetVisible_(NotifyIcon* obj, c_bool value)
 
 ALTERNET_UI_API c_bool NotifyIcon_GetIsAvailable_()
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_GetIsAvailable_");
     return MarshalExceptions<c_bool>([&](){
         return NotifyIcon::GetIsAvailable();
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API c_bool NotifyIcon_GetIsAvailable_()
 
 ALTERNET_UI_API c_bool NotifyIcon_GetIsIconInstalled_(NotifyIcon* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_GetIsIconInstalled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsIconInstalled();
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API c_bool NotifyIcon_GetIsIconInstalled_(NotifyIcon* obj)
 
 ALTERNET_UI_API c_bool NotifyIcon_GetIsOk_(NotifyIcon* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_GetIsOk_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsOk();
     });
@@ -67,6 +75,7 @@ ALTERNET_UI_API c_bool NotifyIcon_GetIsOk_(NotifyIcon* obj)
 
 ALTERNET_UI_API NativeStringSpan_C NotifyIcon_GetText_(NotifyIcon* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_GetText_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetText();
     });
@@ -74,6 +83,7 @@ ALTERNET_UI_API NativeStringSpan_C NotifyIcon_GetText_(NotifyIcon* obj)
 
 ALTERNET_UI_API void NotifyIcon_SetText_(NotifyIcon* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_SetText_");
     MarshalExceptions<void>([&](){
         obj->SetText(*value);
     });
@@ -81,6 +91,7 @@ ALTERNET_UI_API void NotifyIcon_SetText_(NotifyIcon* obj, NativeStringSpan* valu
 
 ALTERNET_UI_API void NotifyIcon_ShowPopup_(NotifyIcon* obj, void* menuHandle)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_ShowPopup_");
     MarshalExceptions<void>([&](){
         obj->ShowPopup(menuHandle);
     });
@@ -88,6 +99,7 @@ ALTERNET_UI_API void NotifyIcon_ShowPopup_(NotifyIcon* obj, void* menuHandle)
 
 ALTERNET_UI_API void NotifyIcon_SetPopupMenu_(NotifyIcon* obj, void* menuHandle)
 {
+    ALTERNET_UI_PERF_EXPORT("NotifyIcon_SetPopupMenu_");
     MarshalExceptions<void>([&](){
         obj->SetPopupMenu(menuHandle);
     });
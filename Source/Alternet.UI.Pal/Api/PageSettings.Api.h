@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API PageSettings* PageSettings_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_Create_");
     return MarshalExceptions<PageSettings*>([&](){
         return new PageSettings();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API PageSettings* PageSettings_Create_()
 
 ALTERNET_UI_API c_bool PageSettings_GetColor_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetColor_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetColor();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API c_bool PageSettings_GetColor_(PageSettings* obj)
 
 ALTERNET_UI_API void PageSettings_SetColor_(PageSettings* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetColor_");
     MarshalExceptions<void>([&](){
         obj->SetColor(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void PageSettings_SetColor_(PageSettings* obj, c_bool value)
 
 ALTERNET_UI_API c_bool PageSettings_GetLandscape_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetLandscape_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetLandscape();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API c_bool PageSettings_GetLandscape_(PageSettings* obj)
 
 ALTERNET_UI_API void PageSettings_SetLandscape_(PageSettings* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetLandscape_");
     MarshalExceptions<void>([&](){
         obj->SetLandscape(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void PageSettings_SetLandscape_(PageSettings* obj, c_bool value)
 
 ALTERNET_UI_API float PageSettings_GetMarginLeft_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetMarginLeft_");
     return MarshalExceptions<float>([&](){
         return obj->GetMarginLeft();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API float PageSettings_GetMarginLeft_(PageSettings* obj)
 
 ALTERNET_UI_API void PageSettings_SetMarginLeft_(PageSettings* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetMarginLeft_");
     MarshalExceptions<void>([&](){
         obj->SetMarginLeft(value);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void PageSettings_SetMarginLeft_(PageSettings* obj, float value)
 
 ALTERNET_UI_API float PageSettings_GetMarginRight_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetMarginRight_");
     return MarshalExceptions<float>([&](){
         return obj->GetMarginRight();
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API float PageSettings_GetMarginRight_(PageSettings* obj)
 
 ALTERNET_UI_API void PageSettings_SetMarginRight_(PageSettings* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetMarginRight_");
     MarshalExceptions<void>([&](){
         obj->SetMarginRight(value);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API void PageSettings_SetMarginRight_(PageSettings* obj, float value
 
 ALTERNET_UI_API float PageSettings_GetMarginTop_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetMarginTop_");
     return MarshalExceptions<float>([&](){
         return obj->GetMarginTop();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API float PageSettings_GetMarginTop_(PageSettings* obj)
 
 ALTERNET_UI_API void PageSettings_SetMarginTop_(PageSettings* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetMarginTop_");
     MarshalExceptions<void>([&](){
         obj->SetMarginTop(value);
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API void PageSettings_SetMarginTop_(PageSettings* obj, float value)
 
 ALTERNET_UI_API float PageSettings_GetMarginBottom_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetMarginBottom_");
     return MarshalExceptions<float>([&](){
         return obj->GetMarginBottom();
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API float PageSettings_GetMarginBottom_(PageSettings* obj)
 
 ALTERNET_UI_API void PageSettings_SetMarginBottom_(PageSettings* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetMarginBottom_");
     MarshalExceptions<void>([&](){
         obj->SetMarginBottom(value);
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API void PageSettings_SetMarginBottom_(PageSettings* obj, float valu
 
 ALTERNET_UI_API c_bool PageSettings_GetUseCustomPaperSize_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetUseCustomPaperSize_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetUseCustomPaperSize();
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API c_bool PageSettings_GetUseCustomPaperSize_(PageSettings* obj)
 
 ALTERNET_UI_API void PageSettings_SetUseCustomPaperSize_(PageSettings* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetUseCustomPaperSize_");
     MarshalExceptions<void>([&](){
         obj->SetUseCustomPaperSize(value);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API void PageSettings_SetUseCustomPaperSize_(PageSettings* obj, c_bo
 
 ALTERNET_UI_API PaperKind PageSettings_GetPaperSize_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetPaperSize_");
     return MarshalExceptions<PaperKind>([&](){
         return obj->GetPaperSize();
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API PaperKind PageSettings_GetPaperSize_(PageSettings* obj)
 
 ALTERNET_UI_API void PageSettings_SetPaperSize_(PageSettings* obj, PaperKind value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetPaperSize_");
     MarshalExceptions<void>([&](){
         obj->SetPaperSize(value);
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API void PageSettings_SetPaperSize_(PageSettings* obj, PaperKind val
 
 ALTERNET_UI_API PrinterResolutionKind PageSettings_GetPrinterResolution_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetPrinterResolution_");
     return MarshalExceptions<PrinterResolutionKind>([&](){
         return obj->GetPrinterResolution();
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API PrinterResolutionKind PageSettings_GetPrinterResolution_(PageSet
 
 ALTERNET_UI_API void PageSettings_SetPrinterResolution_(PageSettings* obj, PrinterResolutionKind value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetPrinterResolution_");
     MarshalExceptions<void>([&](){
         obj->SetPrinterResolution(value);
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API void PageSettings_SetPrinterResolution_(PageSettings* obj, Print
 
 ALTERNET_UI_API SizeD_C PageSettings_GetCustomPaperSize_(PageSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_GetCustomPaperSize_");
     return MarshalExceptions<SizeD_C>([&](){
         return obj->GetCustomPaperSize();
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API SizeD_C PageSettings_GetCustomPaperSize_(PageSettings* obj)
 
 ALTERNET_UI_API void PageSettings_SetCustomPaperSize_(PageSettings* obj, SizeD* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSettings_SetCustomPaperSize_");
     MarshalExceptions<void>([&](){
         obj->SetCustomPaperSize(*value);
     });
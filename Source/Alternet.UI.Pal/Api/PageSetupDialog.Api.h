@@ -12,6 +12,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API PageSetupDialog* PageSetupDialog_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_Create_");
     return MarshalExceptions<PageSetupDialog*>([&](){
         return new PageSetupDialog();
     });
@@ -19,6 +20,7 @@ ALTERNET_UI_API PageSetupDialog* PageSetupDialog_Create_()
 
 ALTERNET_UI_API PrintDocument* PageSetupDialog_GetDocument_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetDocument_");
     return MarshalExceptions<PrintDocument*>([&](){
         return obj->GetDocument();
     });
@@ -26,6 +28,7 @@ ALTERNET_UI_API PrintDocument* PageSetupDialog_GetDocument_(PageSetupDialog* obj
 
 ALTERNET_UI_API void PageSetupDialog_SetDocument_(PageSetupDialog* obj, PrintDocument* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetDocument_");
     MarshalExceptions<void>([&](){
         obj->SetDocument(value);
     });
@@ -33,6 +36,7 @@ ALTERNET_UI_API void PageSetupDialog_SetDocument_(PageSetupDialog* obj, PrintDoc
 
 ALTERNET_UI_API float PageSetupDialog_GetMinMarginLeft_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetMinMarginLeft_");
     return MarshalExceptions<float>([&](){
         return obj->GetMinMarginLeft();
     });
@@ -40,6 +44,7 @@ ALTERNET_UI_API float PageSetupDialog_GetMinMarginLeft_(PageSetupDialog* obj)
 
 ALTERNET_UI_API void PageSetupDialog_SetMinMarginLeft_(PageSetupDialog* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetMinMarginLeft_");
     MarshalExceptions<void>([&](){
         obj->SetMinMarginLeft(value);
     });
@@ -47,6 +52,7 @@ ALTERNET_UI_API void PageSetupDialog_SetMinMarginLeft_(PageSetupDialog* obj, flo
 
 ALTERNET_UI_API float PageSetupDialog_GetMinMarginTop_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetMinMarginTop_");
     return MarshalExceptions<float>([&](){
         return obj->GetMinMarginTop();
     });
@@ -54,6 +60,7 @@ ALTERNET_UI_API float PageSetupDialog_GetMinMarginTop_(PageSetupDialog* obj)
 
 ALTERNET_UI_API void PageSetupDialog_SetMinMarginTop_(PageSetupDialog* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetMinMarginTop_");
     MarshalExceptions<void>([&](){
         obj->SetMinMarginTop(value);
     });
@@ -61,6 +68,7 @@ ALTERNET_UI_API void PageSetupDialog_SetMinMarginTop_(PageSetupDialog* obj, floa
 
 ALTERNET_UI_API float PageSetupDialog_GetMinMarginRight_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetMinMarginRight_");
     return MarshalExceptions<float>([&](){
         return obj->GetMinMarginRight();
     });
@@ -68,6 +76,7 @@ ALTERNET_UI_API float PageSetupDialog_GetMinMarginRight_(PageSetupDialog* obj)
 
 ALTERNET_UI_API void PageSetupDialog_SetMinMarginRight_(PageSetupDialog* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetMinMarginRight_");
     MarshalExceptions<void>([&](){
         obj->SetMinMarginRight(value);
     });
@@ -75,6 +84,7 @@ ALTERNET_UI_API void PageSetupDialog_SetMinMarginRight_(PageSetupDialog* obj, fl
 
 ALTERNET_UI_API float PageSetupDialog_GetMinMarginBottom_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetMinMarginBottom_");
     return MarshalExceptions<float>([&](){
         return obj->GetMinMarginBottom();
     });
@@ -82,6 +92,7 @@ ALTERNET_UI_API float PageSetupDialog_GetMinMarginBottom_(PageSetupDialog* obj)
 
 ALTERNET_UI_API void PageSetupDialog_SetMinMarginBottom_(PageSetupDialog* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetMinMarginBottom_");
     MarshalExceptions<void>([&](){
         obj->SetMinMarginBottom(value);
     });
@@ -89,6 +100,7 @@ ALTERNET_UI_API void PageSetupDialog_SetMinMarginBottom_(PageSetupDialog* obj, f
 
 ALTERNET_UI_API c_bool PageSetupDialog_GetMinMarginsValueSet_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetMinMarginsValueSet_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetMinMarginsValueSet();
     });
@@ -96,6 +108,7 @@ ALTERNET_UI_API c_bool PageSetupDialog_GetMinMarginsValueSet_(PageSetupDialog* o
 
 ALTERNET_UI_API void PageSetupDialog_SetMinMarginsValueSet_(PageSetupDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetMinMarginsValueSet_");
     MarshalExceptions<void>([&](){
         obj->SetMinMarginsValueSet(value);
     });
@@ -103,6 +116,7 @@ ALTERNET_UI_API void PageSetupDialog_SetMinMarginsValueSet_(PageSetupDialog* obj
 
 ALTERNET_UI_API c_bool PageSetupDialog_GetAllowMargins_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetAllowMargins_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowMargins();
     });
@@ -110,6 +124,7 @@ ALTERNET_UI_API c_bool PageSetupDialog_GetAllowMargins_(PageSetupDialog* obj)
 
 ALTERNET_UI_API void PageSetupDialog_SetAllowMargins_(PageSetupDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetAllowMargins_");
     MarshalExceptions<void>([&](){
         obj->SetAllowMargins(value);
     });
@@ -117,6 +132,7 @@ ALTERNET_UI_API void PageSetupDialog_SetAllowMargins_(PageSetupDialog* obj, c_bo
 
 ALTERNET_UI_API c_bool PageSetupDialog_GetAllowOrientation_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetAllowOrientation_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowOrientation();
     });
@@ -124,6 +140,7 @@ ALTERNET_UI_API c_bool PageSetupDialog_GetAllowOrientation_(PageSetupDialog* obj
 
 ALTERNET_UI_API void PageSetupDialog_SetAllowOrientation_(PageSetupDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetAllowOrientation_");
     MarshalExceptions<void>([&](){
         obj->SetAllowOrientation(value);
     });
@@ -131,6 +148,7 @@ ALTERNET_UI_API void PageSetupDialog_SetAllowOrientation_(PageSetupDialog* obj,
 
 ALTERNET_UI_API c_bool PageSetupDialog_GetAllowPaper_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetAllowPaper_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowPaper();
     });
@@ -138,6 +156,7 @@ ALTERNET_UI_API c_bool PageSetupDialog_GetAllowPaper_(PageSetupDialog* obj)
 
 ALTERNET_UI_API void PageSetupDialog_SetAllowPaper_(PageSetupDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetAllowPaper_");
     MarshalExceptions<void>([&](){
         obj->SetAllowPaper(value);
     });
@@ -145,6 +164,7 @@ ALTERNET_UI_API void PageSetupDialog_SetAllowPaper_(PageSetupDialog* obj, c_bool
 
 ALTERNET_UI_API c_bool PageSetupDialog_GetAllowPrinter_(PageSetupDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_GetAllowPrinter_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowPrinter();
     });
@@ -152,6 +172,7 @@ ALTERNET_UI_API c_bool PageSetupDialog_GetAllowPrinter_(PageSetupDialog* obj)
 
 ALTERNET_UI_API void PageSetupDialog_SetAllowPrinter_(PageSetupDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_SetAllowPrinter_");
     MarshalExceptions<void>([&](){
         obj->SetAllowPrinter(value);
     });
@@ -159,6 +180,7 @@ ALTERNET_UI_API void PageSetupDialog_SetAllowPrinter_(PageSetupDialog* obj, c_bo
 
 ALTERNET_UI_API ModalResult PageSetupDialog_ShowModal_(PageSetupDialog* obj, Window* owner)
 {
+    ALTERNET_UI_PERF_EXPORT("PageSetupDialog_ShowModal_");
     return MarshalExceptions<ModalResult>([&](){
         return obj->ShowModal(owner);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Panel* Panel_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Panel_Create_");
     return MarshalExceptions<Panel*>([&](){
         return new Panel();
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Pen* Pen_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Pen_Create_");
     return MarshalExceptions<Pen*>([&](){
         return new Pen();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API Pen* Pen_Create_()
 
 ALTERNET_UI_API void Pen_Initialize_(Pen* obj, DashStyle style, Color* color, float width, LineCap lineCap, LineJoin lineJoin)
 {
+    ALTERNET_UI_PERF_EXPORT("Pen_Initialize_");
     MarshalExceptions<void>([&](){
         obj->Initialize(style, *color, width, lineCap, lineJoin);
     });
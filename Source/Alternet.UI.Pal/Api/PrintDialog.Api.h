@@ -12,6 +12,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API PrintDialog* PrintDialog_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_Create_");
     return MarshalExceptions<PrintDialog*>([&](){
         return new PrintDialog();
     });
@@ -19,6 +20,7 @@ ALTERNET_UI_API PrintDialog* PrintDialog_Create_()
 
 ALTERNET_UI_API c_bool PrintDialog_GetAllowSomePages_(PrintDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_GetAllowSomePages_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowSomePages();
     });
@@ -26,6 +28,7 @@ ALTERNET_UI_API c_bool PrintDialog_GetAllowSomePages_(PrintDialog* obj)
 
 ALTERNET_UI_API void PrintDialog_SetAllowSomePages_(PrintDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_SetAllowSomePages_");
     MarshalExceptions<void>([&](){
         obj->SetAllowSomePages(value);
     });
@@ -33,6 +36,7 @@ ALTERNET_UI_API void PrintDialog_SetAllowSomePages_(PrintDialog* obj, c_bool val
 
 ALTERNET_UI_API c_bool PrintDialog_GetAllowSelection_(PrintDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_GetAllowSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowSelection();
     });
@@ -40,6 +44,7 @@ ALTERNET_UI_API c_bool PrintDialog_GetAllowSelection_(PrintDialog* obj)
 
 ALTERNET_UI_API void PrintDialog_SetAllowSelection_(PrintDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_SetAllowSelection_");
     MarshalExceptions<void>([&](){
         obj->SetAllowSelection(value);
     });
@@ -47,6 +52,7 @@ ALTERNET_UI_API void PrintDialog_SetAllowSelection_(PrintDialog* obj, c_bool val
 
 ALTERNET_UI_API c_bool PrintDialog_GetAllowPrintToFile_(PrintDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_GetAllowPrintToFile_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowPrintToFile();
     });
@@ -54,6 +60,7 @@ ALTERNET_UI_API c_bool PrintDialog_GetAllowPrintToFile_(PrintDialog* obj)
 
 ALTERNET_UI_API void PrintDialog_SetAllowPrintToFile_(PrintDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_SetAllowPrintToFile_");
     MarshalExceptions<void>([&](){
         obj->SetAllowPrintToFile(value);
     });
@@ -61,6 +68,7 @@ ALTERNET_UI_API void PrintDialog_SetAllowPrintToFile_(PrintDialog* obj, c_bool v
 
 ALTERNET_UI_API c_bool PrintDialog_GetShowHelp_(PrintDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_GetShowHelp_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowHelp();
     });
@@ -68,6 +76,7 @@ ALTERNET_UI_API c_bool PrintDialog_GetShowHelp_(PrintDialog* obj)
 
 ALTERNET_UI_API void PrintDialog_SetShowHelp_(PrintDialog* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_SetShowHelp_");
     MarshalExceptions<void>([&](){
         obj->SetShowHelp(value);
     });
@@ -75,6 +84,7 @@ ALTERNET_UI_API void PrintDialog_SetShowHelp_(PrintDialog* obj, c_bool value)
 
 ALTERNET_UI_API PrintDocument* PrintDialog_GetDocument_(PrintDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_GetDocument_");
     return MarshalExceptions<PrintDocument*>([&](){
         return obj->GetDocument();
     });
@@ -82,6 +92,7 @@ ALTERNET_UI_API PrintDocument* PrintDialog_GetDocument_(PrintDialog* obj)
 
 ALTERNET_UI_API void PrintDialog_SetDocument_(PrintDialog* obj, PrintDocument* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_SetDocument_");
     MarshalExceptions<void>([&](){
         obj->SetDocument(value);
     });
@@ -89,6 +100,7 @@ ALTERNET_UI_API void PrintDialog_SetDocument_(PrintDialog* obj, PrintDocument* v
 
 ALTERNET_UI_API ModalResult PrintDialog_ShowModal_(PrintDialog* obj, Window* owner)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDialog_ShowModal_");
     return MarshalExceptions<ModalResult>([&](){
         return obj->ShowModal(owner);
     });
@@ -13,6 +13,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API PrintDocument* PrintDocument_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_Create_");
     return MarshalExceptions<PrintDocument*>([&](){
         return new PrintDocument();
     });
@@ -20,6 +21,7 @@ ALTERNET_UI_API PrintDocument* PrintDocument_Create_()
 
 ALTERNET_UI_API c_bool PrintDocument_GetOriginAtMargins_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetOriginAtMargins_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetOriginAtMargins();
     });
@@ -27,6 +29,7 @@ ALTERNET_UI_API c_bool PrintDocument_GetOriginAtMargins_(PrintDocument* obj)
 
 ALTERNET_UI_API void PrintDocument_SetOriginAtMargins_(PrintDocument* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_SetOriginAtMargins_");
     MarshalExceptions<void>([&](){
         obj->SetOriginAtMargins(value);
     });
@@ -34,6 +37,7 @@ ALTERNET_UI_API void PrintDocument_SetOriginAtMargins_(PrintDocument* obj, c_boo
 
 ALTERNET_UI_API PrinterSettings* PrintDocument_GetPrinterSettings_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetPrinterSettings_");
     return MarshalExceptions<PrinterSettings*>([&](){
         return obj->GetPrinterSettings();
     });
@@ -41,6 +45,7 @@ ALTERNET_UI_API PrinterSettings* PrintDocument_GetPrinterSettings_(PrintDocument
 
 ALTERNET_UI_API PageSettings* PrintDocument_GetPageSettings_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetPageSettings_");
     return MarshalExceptions<PageSettings*>([&](){
         return obj->GetPageSettings();
     });
@@ -48,6 +53,7 @@ ALTERNET_UI_API PageSettings* PrintDocument_GetPageSettings_(PrintDocument* obj)
 
 ALTERNET_UI_API DrawingContext* PrintDocument_GetPrintPage_DrawingContext_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetPrintPage_DrawingContext_");
     return MarshalExceptions<DrawingContext*>([&](){
         return obj->GetPrintPage_DrawingContext();
     });
@@ -55,6 +61,7 @@ ALTERNET_UI_API DrawingContext* PrintDocument_GetPrintPage_DrawingContext_(Print
 
 ALTERNET_UI_API c_bool PrintDocument_GetPrintPage_HasMorePages_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetPrintPage_HasMorePages_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetPrintPage_HasMorePages();
     });
@@ -62,6 +69,7 @@ ALTERNET_UI_API c_bool PrintDocument_GetPrintPage_HasMorePages_(PrintDocument* o
 
 ALTERNET_UI_API void PrintDocument_SetPrintPage_HasMorePages_(PrintDocument* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_SetPrintPage_HasMorePages_");
     MarshalExceptions<void>([&](){
         obj->SetPrintPage_HasMorePages(value);
     });
@@ -69,6 +77,7 @@ ALTERNET_UI_API void PrintDocument_SetPrintPage_HasMorePages_(PrintDocument* obj
 
 ALTERNET_UI_API int PrintDocument_GetPrintPage_PageNumber_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetPrintPage_PageNumber_");
     return MarshalExceptions<int>([&](){
         return obj->GetPrintPage_PageNumber();
     });
@@ -76,6 +85,7 @@ ALTERNET_UI_API int PrintDocument_GetPrintPage_PageNumber_(PrintDocument* obj)
 
 ALTERNET_UI_API NativeStringSpan_C PrintDocument_GetDocumentName_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetDocumentName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetDocumentName();
     });
@@ -83,6 +93,7 @@ ALTERNET_UI_API NativeStringSpan_C PrintDocument_GetDocumentName_(PrintDocument*
 
 ALTERNET_UI_API void PrintDocument_SetDocumentName_(PrintDocument* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_SetDocumentName_");
     MarshalExceptions<void>([&](){
         obj->SetDocumentName(*value);
     });
@@ -90,6 +101,7 @@ ALTERNET_UI_API void PrintDocument_SetDocumentName_(PrintDocument* obj, NativeSt
 
 ALTERNET_UI_API void PrintDocument_Print_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_Print_");
     MarshalExceptions<void>([&](){
         obj->Print();
     });
@@ -97,6 +109,7 @@ ALTERNET_UI_API void PrintDocument_Print_(PrintDocument* obj)
 
 ALTERNET_UI_API RectD_C PrintDocument_GetPrintPage_MarginBounds_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetPrintPage_MarginBounds_");
     return MarshalExceptions<RectD_C>([&](){
         return obj->GetPrintPage_MarginBounds();
     });
@@ -104,6 +117,7 @@ ALTERNET_UI_API RectD_C PrintDocument_GetPrintPage_MarginBounds_(PrintDocument*
 
 ALTERNET_UI_API RectD_C PrintDocument_GetPrintPage_PhysicalPageBounds_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetPrintPage_PhysicalPageBounds_");
     return MarshalExceptions<RectD_C>([&](){
         return obj->GetPrintPage_PhysicalPageBounds();
     });
@@ -111,6 +125,7 @@ ALTERNET_UI_API RectD_C PrintDocument_GetPrintPage_PhysicalPageBounds_(PrintDocu
 
 ALTERNET_UI_API RectD_C PrintDocument_GetPrintPage_PageBounds_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetPrintPage_PageBounds_");
     return MarshalExceptions<RectD_C>([&](){
         return obj->GetPrintPage_PageBounds();
     });
@@ -118,6 +133,7 @@ ALTERNET_UI_API RectD_C PrintDocument_GetPrintPage_PageBounds_(PrintDocument* ob
 
 ALTERNET_UI_API RectD_C PrintDocument_GetPrintPage_PrintablePageBounds_(PrintDocument* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintDocument_GetPrintPage_PrintablePageBounds_");
     return MarshalExceptions<RectD_C>([&](){
         return obj->GetPrintPage_PrintablePageBounds();
     });
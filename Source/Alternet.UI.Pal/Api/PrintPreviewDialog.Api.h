@@ -12,6 +12,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API PrintPreviewDialog* PrintPreviewDialog_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("PrintPreviewDialog_Create_");
     return MarshalExceptions<PrintPreviewDialog*>([&](){
         return new PrintPreviewDialog();
     });
@@ -19,6 +20,7 @@ ALTERNET_UI_API PrintPreviewDialog* PrintPreviewDialog_Create_()
 
 ALTERNET_UI_API PrintDocument* PrintPreviewDialog_GetDocument_(PrintPreviewDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintPreviewDialog_GetDocument_");
     return MarshalExceptions<PrintDocument*>([&](){
         return obj->GetDocument();
     });
@@ -26,6 +28,7 @@ ALTERNET_UI_API PrintDocument* PrintPreviewDialog_GetDocument_(PrintPreviewDialo
 
 ALTERNET_UI_API void PrintPreviewDialog_SetDocument_(PrintPreviewDialog* obj, PrintDocument* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintPreviewDialog_SetDocument_");
     MarshalExceptions<void>([&](){
         obj->SetDocument(value);
     });
@@ -33,6 +36,7 @@ ALTERNET_UI_API void PrintPreviewDialog_SetDocument_(PrintPreviewDialog* obj, Pr
 
 ALTERNET_UI_API NativeStringSpan_C PrintPreviewDialog_GetTitle_(PrintPreviewDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintPreviewDialog_GetTitle_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetTitle();
     });
@@ -40,6 +44,7 @@ ALTERNET_UI_API NativeStringSpan_C PrintPreviewDialog_GetTitle_(PrintPreviewDial
 
 ALTERNET_UI_API void PrintPreviewDialog_SetTitle_(PrintPreviewDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintPreviewDialog_SetTitle_");
     MarshalExceptions<void>([&](){
         obj->SetTitle(*value);
     });
@@ -47,6 +52,7 @@ ALTERNET_UI_API void PrintPreviewDialog_SetTitle_(PrintPreviewDialog* obj, Nativ
 
 ALTERNET_UI_API void PrintPreviewDialog_ShowModal_(PrintPreviewDialog* obj, Window* owner)
 {
+    ALTERNET_UI_PERF_EXPORT("PrintPreviewDialog_ShowModal_");
     MarshalExceptions<void>([&](){
         obj->ShowModal(owner);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API PrinterSettings* PrinterSettings_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_Create_");
     return MarshalExceptions<PrinterSettings*>([&](){
         return new PrinterSettings();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API PrinterSettings* PrinterSettings_Create_()
 
 ALTERNET_UI_API Duplex PrinterSettings_GetDuplex_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetDuplex_");
     return MarshalExceptions<Duplex>([&](){
         return obj->GetDuplex();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API Duplex PrinterSettings_GetDuplex_(PrinterSettings* obj)
 
 ALTERNET_UI_API void PrinterSettings_SetDuplex_(PrinterSettings* obj, Duplex value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetDuplex_");
     MarshalExceptions<void>([&](){
         obj->SetDuplex(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void PrinterSettings_SetDuplex_(PrinterSettings* obj, Duplex val
 
 ALTERNET_UI_API int PrinterSettings_GetFromPage_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetFromPage_");
     return MarshalExceptions<int>([&](){
         return obj->GetFromPage();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API int PrinterSettings_GetFromPage_(PrinterSettings* obj)
 
 ALTERNET_UI_API void PrinterSettings_SetFromPage_(PrinterSettings* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetFromPage_");
     MarshalExceptions<void>([&](){
         obj->SetFromPage(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void PrinterSettings_SetFromPage_(PrinterSettings* obj, int valu
 
 ALTERNET_UI_API int PrinterSettings_GetToPage_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetToPage_");
     return MarshalExceptions<int>([&](){
         return obj->GetToPage();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API int PrinterSettings_GetToPage_(PrinterSettings* obj)
 
 ALTERNET_UI_API void PrinterSettings_SetToPage_(PrinterSettings* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetToPage_");
     MarshalExceptions<void>([&](){
         obj->SetToPage(value);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void PrinterSettings_SetToPage_(PrinterSettings* obj, int value)
 
 ALTERNET_UI_API int PrinterSettings_GetMinimumPage_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetMinimumPage_");
     return MarshalExceptions<int>([&](){
         return obj->GetMinimumPage();
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API int PrinterSettings_GetMinimumPage_(PrinterSettings* obj)
 
 ALTERNET_UI_API void PrinterSettings_SetMinimumPage_(PrinterSettings* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetMinimumPage_");
     MarshalExceptions<void>([&](){
         obj->SetMinimumPage(value);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API void PrinterSettings_SetMinimumPage_(PrinterSettings* obj, int v
 
 ALTERNET_UI_API int PrinterSettings_GetMaximumPage_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetMaximumPage_");
     return MarshalExceptions<int>([&](){
         return obj->GetMaximumPage();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API int PrinterSettings_GetMaximumPage_(PrinterSettings* obj)
 
 ALTERNET_UI_API void PrinterSettings_SetMaximumPage_(PrinterSettings* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetMaximumPage_");
     MarshalExceptions<void>([&](){
         obj->SetMaximumPage(value);
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API void PrinterSettings_SetMaximumPage_(PrinterSettings* obj, int v
 
 ALTERNET_UI_API PrintRange PrinterSettings_GetPrintRange_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetPrintRange_");
     return MarshalExceptions<PrintRange>([&](){
         return obj->GetPrintRange();
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API PrintRange PrinterSettings_GetPrintRange_(PrinterSettings* obj)
 
 ALTERNET_UI_API void PrinterSettings_SetPrintRange_(PrinterSettings* obj, PrintRange value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetPrintRange_");
     MarshalExceptions<void>([&](){
         obj->SetPrintRange(value);
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API void PrinterSettings_SetPrintRange_(PrinterSettings* obj, PrintR
 
 ALTERNET_UI_API c_bool PrinterSettings_GetCollate_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetCollate_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCollate();
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API c_bool PrinterSettings_GetCollate_(PrinterSettings* obj)
 
 ALTERNET_UI_API void PrinterSettings_SetCollate_(PrinterSettings* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetCollate_");
     MarshalExceptions<void>([&](){
         obj->SetCollate(value);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API void PrinterSettings_SetCollate_(PrinterSettings* obj, c_bool va
 
 ALTERNET_UI_API int PrinterSettings_GetCopies_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetCopies_");
     return MarshalExceptions<int>([&](){
         return obj->GetCopies();
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API int PrinterSettings_GetCopies_(PrinterSettings* obj)
 
 ALTERNET_UI_API void PrinterSettings_SetCopies_(PrinterSettings* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetCopies_");
     MarshalExceptions<void>([&](){
         obj->SetCopies(value);
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API void PrinterSettings_SetCopies_(PrinterSettings* obj, int value)
 
 ALTERNET_UI_API c_bool PrinterSettings_GetPrintToFile_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetPrintToFile_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetPrintToFile();
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API c_bool PrinterSettings_GetPrintToFile_(PrinterSettings* obj)
 
 ALTERNET_UI_API void PrinterSettings_SetPrintToFile_(PrinterSettings* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetPrintToFile_");
     MarshalExceptions<void>([&](){
         obj->SetPrintToFile(value);
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API void PrinterSettings_SetPrintToFile_(PrinterSettings* obj, c_boo
 
 ALTERNET_UI_API c_bool PrinterSettings_GetIsValid_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetIsValid_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsValid();
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API c_bool PrinterSettings_GetIsValid_(PrinterSettings* obj)
 
 ALTERNET_UI_API c_bool PrinterSettings_GetIsDefaultPrinter_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetIsDefaultPrinter_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsDefaultPrinter();
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API c_bool PrinterSettings_GetIsDefaultPrinter_(PrinterSettings* obj
 
 ALTERNET_UI_API NativeStringSpan_C PrinterSettings_GetPrinterName_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetPrinterName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetPrinterName();
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API NativeStringSpan_C PrinterSettings_GetPrinterName_(PrinterSettin
 
 ALTERNET_UI_API void PrinterSettings_SetPrinterName_(PrinterSettings* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetPrinterName_");
     MarshalExceptions<void>([&](){
         obj->SetPrinterName(*value);
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API void PrinterSettings_SetPrinterName_(PrinterSettings* obj, Nativ
 
 ALTERNET_UI_API NativeStringSpan_C PrinterSettings_GetPrintFileName_(PrinterSettings* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_GetPrintFileName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetPrintFileName();
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API NativeStringSpan_C PrinterSettings_GetPrintFileName_(PrinterSett
 
 ALTERNET_UI_API void PrinterSettings_SetPrintFileName_(PrinterSettings* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PrinterSettings_SetPrintFileName_");
     MarshalExceptions<void>([&](){
         obj->SetPrintFileName(*value);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API ProgressBar* ProgressBar_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_Create_");
     return MarshalExceptions<ProgressBar*>([&](){
         return new ProgressBar();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API ProgressBar* ProgressBar_Create_()
 
 ALTERNET_UI_API int ProgressBar_GetMinimum_(ProgressBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_GetMinimum_");
     return MarshalExceptions<int>([&](){
         return obj->GetMinimum();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API int ProgressBar_GetMinimum_(ProgressBar* obj)
 
 ALTERNET_UI_API void ProgressBar_SetMinimum_(ProgressBar* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_SetMinimum_");
     MarshalExceptions<void>([&](){
         obj->SetMinimum(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void ProgressBar_SetMinimum_(ProgressBar* obj, int value)
 
 ALTERNET_UI_API int ProgressBar_GetMaximum_(ProgressBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_GetMaximum_");
     return MarshalExceptions<int>([&](){
         return obj->GetMaximum();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API int ProgressBar_GetMaximum_(ProgressBar* obj)
 
 ALTERNET_UI_API void ProgressBar_SetMaximum_(ProgressBar* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_SetMaximum_");
     MarshalExceptions<void>([&](){
         obj->SetMaximum(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void ProgressBar_SetMaximum_(ProgressBar* obj, int value)
 
 ALTERNET_UI_API int ProgressBar_GetValue_(ProgressBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_GetValue_");
     return MarshalExceptions<int>([&](){
         return obj->GetValue();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API int ProgressBar_GetValue_(ProgressBar* obj)
 
 ALTERNET_UI_API void ProgressBar_SetValue_(ProgressBar* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_SetValue_");
     MarshalExceptions<void>([&](){
         obj->SetValue(value);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void ProgressBar_SetValue_(ProgressBar* obj, int value)
 
 ALTERNET_UI_API c_bool ProgressBar_GetIsIndeterminate_(ProgressBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_GetIsIndeterminate_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsIndeterminate();
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API c_bool ProgressBar_GetIsIndeterminate_(ProgressBar* obj)
 
 ALTERNET_UI_API void ProgressBar_SetIsIndeterminate_(ProgressBar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_SetIsIndeterminate_");
     MarshalExceptions<void>([&](){
         obj->SetIsIndeterminate(value);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API void ProgressBar_SetIsIndeterminate_(ProgressBar* obj, c_bool va
 
 ALTERNET_UI_API ProgressBarOrientation ProgressBar_GetOrientation_(ProgressBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_GetOrientation_");
     return MarshalExceptions<ProgressBarOrientation>([&](){
         return obj->GetOrientation();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API ProgressBarOrientation ProgressBar_GetOrientation_(ProgressBar*
 
 ALTERNET_UI_API void ProgressBar_SetOrientation_(ProgressBar* obj, ProgressBarOrientation value)
 {
+    ALTERNET_UI_PERF_EXPORT("ProgressBar_SetOrientation_");
     MarshalExceptions<void>([&](){
         obj->SetOrientation(value);
     });
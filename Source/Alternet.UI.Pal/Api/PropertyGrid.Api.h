@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API PropertyGrid* PropertyGrid_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_Create_");
     return MarshalExceptions<PropertyGrid*>([&](){
         return new PropertyGrid();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API PropertyGrid* PropertyGrid_Create_()
 
 ALTERNET_UI_API int PropertyGrid_GetEventValidationFailureBehavior_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetEventValidationFailureBehavior_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventValidationFailureBehavior();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API int PropertyGrid_GetEventValidationFailureBehavior_(PropertyGrid
 
 ALTERNET_UI_API void PropertyGrid_SetEventValidationFailureBehavior_(PropertyGrid* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetEventValidationFailureBehavior_");
     MarshalExceptions<void>([&](){
         obj->SetEventValidationFailureBehavior(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void PropertyGrid_SetEventValidationFailureBehavior_(PropertyGri
 
 ALTERNET_UI_API void* PropertyGrid_GetEventPropValue_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetEventPropValue_");
     return MarshalExceptions<void*>([&](){
         return obj->GetEventPropValue();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API void* PropertyGrid_GetEventPropValue_(PropertyGrid* obj)
 
 ALTERNET_UI_API int PropertyGrid_GetEventColumn_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetEventColumn_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventColumn();
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API int PropertyGrid_GetEventColumn_(PropertyGrid* obj)
 
 ALTERNET_UI_API void* PropertyGrid_GetEventProperty_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetEventProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->GetEventProperty();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API void* PropertyGrid_GetEventProperty_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_GetHasBorder_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API c_bool PropertyGrid_GetHasBorder_(PropertyGrid* obj)
 
 ALTERNET_UI_API void PropertyGrid_SetHasBorder_(PropertyGrid* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API void PropertyGrid_SetHasBorder_(PropertyGrid* obj, c_bool value)
 
 ALTERNET_UI_API int64_t PropertyGrid_GetCreateStyle_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetCreateStyle_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetCreateStyle();
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API int64_t PropertyGrid_GetCreateStyle_(PropertyGrid* obj)
 
 ALTERNET_UI_API void PropertyGrid_SetCreateStyle_(PropertyGrid* obj, int64_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetCreateStyle_");
     MarshalExceptions<void>([&](){
         obj->SetCreateStyle(value);
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API void PropertyGrid_SetCreateStyle_(PropertyGrid* obj, int64_t val
 
 ALTERNET_UI_API int64_t PropertyGrid_GetCreateStyleEx_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetCreateStyleEx_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetCreateStyleEx();
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API int64_t PropertyGrid_GetCreateStyleEx_(PropertyGrid* obj)
 
 ALTERNET_UI_API void PropertyGrid_SetCreateStyleEx_(PropertyGrid* obj, int64_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetCreateStyleEx_");
     MarshalExceptions<void>([&](){
         obj->SetCreateStyleEx(value);
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API void PropertyGrid_SetCreateStyleEx_(PropertyGrid* obj, int64_t v
 
 ALTERNET_UI_API PointI_C PropertyGrid_CalcScrolledPosition_(PropertyGrid* obj, PointI* point)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CalcScrolledPosition_");
     return MarshalExceptions<PointI_C>([&](){
         return obj->CalcScrolledPosition(*point);
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API PointI_C PropertyGrid_CalcScrolledPosition_(PropertyGrid* obj, P
 
 ALTERNET_UI_API PointI_C PropertyGrid_CalcUnscrolledPosition_(PropertyGrid* obj, PointI* point)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CalcUnscrolledPosition_");
     return MarshalExceptions<PointI_C>([&](){
         return obj->CalcUnscrolledPosition(*point);
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API PointI_C PropertyGrid_CalcUnscrolledPosition_(PropertyGrid* obj,
 
 ALTERNET_UI_API int PropertyGrid_GetHitTestColumn_(PropertyGrid* obj, PointI* point)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetHitTestColumn_");
     return MarshalExceptions<int>([&](){
         return obj->GetHitTestColumn(*point);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API int PropertyGrid_GetHitTestColumn_(PropertyGrid* obj, PointI* po
 
 ALTERNET_UI_API void* PropertyGrid_GetHitTestProp_(PropertyGrid* obj, PointI* point)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetHitTestProp_");
     return MarshalExceptions<void*>([&](){
         return obj->GetHitTestProp(*point);
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API void* PropertyGrid_GetHitTestProp_(PropertyGrid* obj, PointI* po
 
 ALTERNET_UI_API void* PropertyGrid_ColorDatabaseCreate_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ColorDatabaseCreate_");
     return MarshalExceptions<void*>([&](){
         return PropertyGrid::ColorDatabaseCreate();
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API void* PropertyGrid_ColorDatabaseCreate_()
 
 ALTERNET_UI_API void PropertyGrid_ColorDatabaseDelete_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ColorDatabaseDelete_");
     MarshalExceptions<void>([&](){
         PropertyGrid::ColorDatabaseDelete(handle);
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API void PropertyGrid_ColorDatabaseDelete_(void* handle)
 
 ALTERNET_UI_API void PropertyGrid_ColorDatabaseSetGlobal_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ColorDatabaseSetGlobal_");
     MarshalExceptions<void>([&](){
         PropertyGrid::ColorDatabaseSetGlobal(handle);
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API void PropertyGrid_ColorDatabaseSetGlobal_(void* handle)
 
 ALTERNET_UI_API void PropertyGrid_ColorDatabaseAdd_(void* handle, NativeStringSpan* name, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ColorDatabaseAdd_");
     MarshalExceptions<void>([&](){
         PropertyGrid::ColorDatabaseAdd(handle, *name, *color);
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API void PropertyGrid_ColorDatabaseAdd_(void* handle, NativeStringSp
 
 ALTERNET_UI_API Color_C PropertyGrid_ColorDatabaseFind_(void* handle, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ColorDatabaseFind_");
     return MarshalExceptions<Color_C>([&](){
         return PropertyGrid::ColorDatabaseFind(handle, *name);
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API Color_C PropertyGrid_ColorDatabaseFind_(void* handle, NativeStri
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_ColorDatabaseFindName_(void* handle, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ColorDatabaseFindName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return PropertyGrid::ColorDatabaseFindName(handle, *color);
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_ColorDatabaseFindName_(void* han
 
 ALTERNET_UI_API void PropertyGrid_KnownColorsClear_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_KnownColorsClear_");
     MarshalExceptions<void>([&](){
         PropertyGrid::KnownColorsClear();
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API void PropertyGrid_KnownColorsClear_()
 
 ALTERNET_UI_API void PropertyGrid_KnownColorsAdd_(NativeStringSpan* name, NativeStringSpan* title, Color* value, int knownColor)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_KnownColorsAdd_");
     MarshalExceptions<void>([&](){
         PropertyGrid::KnownColorsAdd(*name, *title, *value, knownColor);
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API void PropertyGrid_KnownColorsAdd_(NativeStringSpan* name, Native
 
 ALTERNET_UI_API void PropertyGrid_KnownColorsApply_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_KnownColorsApply_");
     MarshalExceptions<void>([&](){
         PropertyGrid::KnownColorsApply();
     });
@@ -185,6 +210,7 @@ ALTERNET_UI_API void PropertyGrid_KnownColorsApply_()
 
 ALTERNET_UI_API void PropertyGrid_KnownColorsSetCustomColorTitle_(NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_KnownColorsSetCustomColorTitle_");
     MarshalExceptions<void>([&](){
         PropertyGrid::KnownColorsSetCustomColorTitle(*value);
     });
@@ -192,6 +218,7 @@ ALTERNET_UI_API void PropertyGrid_KnownColorsSetCustomColorTitle_(NativeStringSp
 
 ALTERNET_UI_API void* PropertyGrid_GetPropertyValidator_(PropertyGrid* obj, void* prop)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValidator_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPropertyValidator(prop);
     });
@@ -199,6 +226,7 @@ ALTERNET_UI_API void* PropertyGrid_GetPropertyValidator_(PropertyGrid* obj, void
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyValidator_(PropertyGrid* obj, void* prop, void* validator)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValidator_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyValidator(prop, validator);
     });
@@ -206,6 +234,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyValidator_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyFlag_(PropertyGrid* obj, void* prop, int flag, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyFlag_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyFlag(prop, flag, value);
     });
@@ -213,6 +242,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyFlag_(PropertyGrid* obj, void* prop
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetEventPropertyName_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetEventPropertyName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetEventPropertyName();
     });
@@ -220,6 +250,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetEventPropertyName_(PropertyGr
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetEventValidationFailureMessage_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetEventValidationFailureMessage_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetEventValidationFailureMessage();
     });
@@ -227,6 +258,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetEventValidationFailureMessage
 
 ALTERNET_UI_API void PropertyGrid_SetEventValidationFailureMessage_(PropertyGrid* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetEventValidationFailureMessage_");
     MarshalExceptions<void>([&](){
         obj->SetEventValidationFailureMessage(*value);
     });
@@ -234,6 +266,7 @@ ALTERNET_UI_API void PropertyGrid_SetEventValidationFailureMessage_(PropertyGrid
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetNameAsLabel_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetNameAsLabel_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return PropertyGrid::GetNameAsLabel();
     });
@@ -241,6 +274,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetNameAsLabel_()
 
 ALTERNET_UI_API void* PropertyGrid_CreateEx_(int64_t styles)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateEx_");
     return MarshalExceptions<void*>([&](){
         return PropertyGrid::CreateEx(styles);
     });
@@ -248,6 +282,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateEx_(int64_t styles)
 
 ALTERNET_UI_API void PropertyGrid_AddActionTrigger_(PropertyGrid* obj, int action, int keycode, int modifiers)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_AddActionTrigger_");
     MarshalExceptions<void>([&](){
         obj->AddActionTrigger(action, keycode, modifiers);
     });
@@ -255,6 +290,7 @@ ALTERNET_UI_API void PropertyGrid_AddActionTrigger_(PropertyGrid* obj, int actio
 
 ALTERNET_UI_API void PropertyGrid_DedicateKey_(PropertyGrid* obj, int keycode)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_DedicateKey_");
     MarshalExceptions<void>([&](){
         obj->DedicateKey(keycode);
     });
@@ -262,6 +298,7 @@ ALTERNET_UI_API void PropertyGrid_DedicateKey_(PropertyGrid* obj, int keycode)
 
 ALTERNET_UI_API void PropertyGrid_AutoGetTranslation_(c_bool enable)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_AutoGetTranslation_");
     MarshalExceptions<void>([&](){
         PropertyGrid::AutoGetTranslation(enable);
     });
@@ -269,6 +306,7 @@ ALTERNET_UI_API void PropertyGrid_AutoGetTranslation_(c_bool enable)
 
 ALTERNET_UI_API void PropertyGrid_CenterSplitter_(PropertyGrid* obj, c_bool enableAutoResizing)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CenterSplitter_");
     MarshalExceptions<void>([&](){
         obj->CenterSplitter(enableAutoResizing);
     });
@@ -276,6 +314,7 @@ ALTERNET_UI_API void PropertyGrid_CenterSplitter_(PropertyGrid* obj, c_bool enab
 
 ALTERNET_UI_API void PropertyGrid_ClearActionTriggers_(PropertyGrid* obj, int action)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ClearActionTriggers_");
     MarshalExceptions<void>([&](){
         obj->ClearActionTriggers(action);
     });
@@ -283,6 +322,7 @@ ALTERNET_UI_API void PropertyGrid_ClearActionTriggers_(PropertyGrid* obj, int ac
 
 ALTERNET_UI_API c_bool PropertyGrid_CommitChangesFromEditor_(PropertyGrid* obj, uint32_t flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CommitChangesFromEditor_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CommitChangesFromEditor(flags);
     });
@@ -290,6 +330,7 @@ ALTERNET_UI_API c_bool PropertyGrid_CommitChangesFromEditor_(PropertyGrid* obj,
 
 ALTERNET_UI_API void PropertyGrid_EditorsValueWasModified_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_EditorsValueWasModified_");
     MarshalExceptions<void>([&](){
         obj->EditorsValueWasModified();
     });
@@ -297,6 +338,7 @@ ALTERNET_UI_API void PropertyGrid_EditorsValueWasModified_(PropertyGrid* obj)
 
 ALTERNET_UI_API void PropertyGrid_EditorsValueWasNotModified_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_EditorsValueWasNotModified_");
     MarshalExceptions<void>([&](){
         obj->EditorsValueWasNotModified();
     });
@@ -304,6 +346,7 @@ ALTERNET_UI_API void PropertyGrid_EditorsValueWasNotModified_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_EnableCategories_(PropertyGrid* obj, c_bool enable)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_EnableCategories_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EnableCategories(enable);
     });
@@ -311,6 +354,7 @@ ALTERNET_UI_API c_bool PropertyGrid_EnableCategories_(PropertyGrid* obj, c_bool
 
 ALTERNET_UI_API SizeD_C PropertyGrid_FitColumns_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_FitColumns_");
     return MarshalExceptions<SizeD_C>([&](){
         return obj->FitColumns();
     });
@@ -318,6 +362,7 @@ ALTERNET_UI_API SizeD_C PropertyGrid_FitColumns_(PropertyGrid* obj)
 
 ALTERNET_UI_API Color_C PropertyGrid_GetCaptionBackgroundColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetCaptionBackgroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetCaptionBackgroundColor();
     });
@@ -325,6 +370,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetCaptionBackgroundColor_(PropertyGrid* ob
 
 ALTERNET_UI_API Color_C PropertyGrid_GetCaptionForegroundColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetCaptionForegroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetCaptionForegroundColor();
     });
@@ -332,6 +378,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetCaptionForegroundColor_(PropertyGrid* ob
 
 ALTERNET_UI_API Color_C PropertyGrid_GetCellBackgroundColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetCellBackgroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetCellBackgroundColor();
     });
@@ -339,6 +386,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetCellBackgroundColor_(PropertyGrid* obj)
 
 ALTERNET_UI_API Color_C PropertyGrid_GetCellDisabledTextColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetCellDisabledTextColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetCellDisabledTextColor();
     });
@@ -346,6 +394,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetCellDisabledTextColor_(PropertyGrid* obj
 
 ALTERNET_UI_API Color_C PropertyGrid_GetCellTextColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetCellTextColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetCellTextColor();
     });
@@ -353,6 +402,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetCellTextColor_(PropertyGrid* obj)
 
 ALTERNET_UI_API uint32_t PropertyGrid_GetColumnCount_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetColumnCount_");
     return MarshalExceptions<uint32_t>([&](){
         return obj->GetColumnCount();
     });
@@ -360,6 +410,7 @@ ALTERNET_UI_API uint32_t PropertyGrid_GetColumnCount_(PropertyGrid* obj)
 
 ALTERNET_UI_API Color_C PropertyGrid_GetEmptySpaceColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetEmptySpaceColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetEmptySpaceColor();
     });
@@ -367,6 +418,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetEmptySpaceColor_(PropertyGrid* obj)
 
 ALTERNET_UI_API int PropertyGrid_GetFontHeight_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetFontHeight_");
     return MarshalExceptions<int>([&](){
         return obj->GetFontHeight();
     });
@@ -374,6 +426,7 @@ ALTERNET_UI_API int PropertyGrid_GetFontHeight_(PropertyGrid* obj)
 
 ALTERNET_UI_API Color_C PropertyGrid_GetLineColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetLineColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetLineColor();
     });
@@ -381,6 +434,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetLineColor_(PropertyGrid* obj)
 
 ALTERNET_UI_API Color_C PropertyGrid_GetMarginColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetMarginColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetMarginColor();
     });
@@ -388,6 +442,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetMarginColor_(PropertyGrid* obj)
 
 ALTERNET_UI_API int PropertyGrid_GetMarginWidth_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetMarginWidth_");
     return MarshalExceptions<int>([&](){
         return obj->GetMarginWidth();
     });
@@ -395,6 +450,7 @@ ALTERNET_UI_API int PropertyGrid_GetMarginWidth_(PropertyGrid* obj)
 
 ALTERNET_UI_API int PropertyGrid_GetRowHeight_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetRowHeight_");
     return MarshalExceptions<int>([&](){
         return obj->GetRowHeight();
     });
@@ -402,6 +458,7 @@ ALTERNET_UI_API int PropertyGrid_GetRowHeight_(PropertyGrid* obj)
 
 ALTERNET_UI_API Color_C PropertyGrid_GetSelectionBackgroundColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetSelectionBackgroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetSelectionBackgroundColor();
     });
@@ -409,6 +466,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetSelectionBackgroundColor_(PropertyGrid*
 
 ALTERNET_UI_API Color_C PropertyGrid_GetSelectionForegroundColor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetSelectionForegroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetSelectionForegroundColor();
     });
@@ -416,6 +474,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetSelectionForegroundColor_(PropertyGrid*
 
 ALTERNET_UI_API int PropertyGrid_GetSplitterPosition_(PropertyGrid* obj, uint32_t splitterIndex)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetSplitterPosition_");
     return MarshalExceptions<int>([&](){
         return obj->GetSplitterPosition(splitterIndex);
     });
@@ -423,6 +482,7 @@ ALTERNET_UI_API int PropertyGrid_GetSplitterPosition_(PropertyGrid* obj, uint32_
 
 ALTERNET_UI_API int PropertyGrid_GetVerticalSpacing_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetVerticalSpacing_");
     return MarshalExceptions<int>([&](){
         return obj->GetVerticalSpacing();
     });
@@ -430,6 +490,7 @@ ALTERNET_UI_API int PropertyGrid_GetVerticalSpacing_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_IsEditorFocused_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsEditorFocused_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsEditorFocused();
     });
@@ -437,6 +498,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsEditorFocused_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_IsEditorsValueModified_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsEditorsValueModified_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsEditorsValueModified();
     });
@@ -444,6 +506,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsEditorsValueModified_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_IsAnyModified_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsAnyModified_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsAnyModified();
     });
@@ -451,6 +514,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsAnyModified_(PropertyGrid* obj)
 
 ALTERNET_UI_API void PropertyGrid_ResetColors_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ResetColors_");
     MarshalExceptions<void>([&](){
         obj->ResetColors();
     });
@@ -458,6 +522,7 @@ ALTERNET_UI_API void PropertyGrid_ResetColors_(PropertyGrid* obj)
 
 ALTERNET_UI_API void PropertyGrid_ResetColumnSizes_(PropertyGrid* obj, c_bool enableAutoResizing)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ResetColumnSizes_");
     MarshalExceptions<void>([&](){
         obj->ResetColumnSizes(enableAutoResizing);
     });
@@ -465,6 +530,7 @@ ALTERNET_UI_API void PropertyGrid_ResetColumnSizes_(PropertyGrid* obj, c_bool en
 
 ALTERNET_UI_API void PropertyGrid_MakeColumnEditable_(PropertyGrid* obj, uint32_t column, c_bool editable)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_MakeColumnEditable_");
     MarshalExceptions<void>([&](){
         obj->MakeColumnEditable(column, editable);
     });
@@ -472,6 +538,7 @@ ALTERNET_UI_API void PropertyGrid_MakeColumnEditable_(PropertyGrid* obj, uint32_
 
 ALTERNET_UI_API void PropertyGrid_BeginLabelEdit_(PropertyGrid* obj, uint32_t column)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_BeginLabelEdit_");
     MarshalExceptions<void>([&](){
         obj->BeginLabelEdit(column);
     });
@@ -479,6 +546,7 @@ ALTERNET_UI_API void PropertyGrid_BeginLabelEdit_(PropertyGrid* obj, uint32_t co
 
 ALTERNET_UI_API void PropertyGrid_EndLabelEdit_(PropertyGrid* obj, c_bool commit)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_EndLabelEdit_");
     MarshalExceptions<void>([&](){
         obj->EndLabelEdit(commit);
     });
@@ -486,6 +554,7 @@ ALTERNET_UI_API void PropertyGrid_EndLabelEdit_(PropertyGrid* obj, c_bool commit
 
 ALTERNET_UI_API void PropertyGrid_SetCaptionBackgroundColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetCaptionBackgroundColor_");
     MarshalExceptions<void>([&](){
         obj->SetCaptionBackgroundColor(*col);
     });
@@ -493,6 +562,7 @@ ALTERNET_UI_API void PropertyGrid_SetCaptionBackgroundColor_(PropertyGrid* obj,
 
 ALTERNET_UI_API void PropertyGrid_SetCaptionTextColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetCaptionTextColor_");
     MarshalExceptions<void>([&](){
         obj->SetCaptionTextColor(*col);
     });
@@ -500,6 +570,7 @@ ALTERNET_UI_API void PropertyGrid_SetCaptionTextColor_(PropertyGrid* obj, Color*
 
 ALTERNET_UI_API void PropertyGrid_SetCellBackgroundColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetCellBackgroundColor_");
     MarshalExceptions<void>([&](){
         obj->SetCellBackgroundColor(*col);
     });
@@ -507,6 +578,7 @@ ALTERNET_UI_API void PropertyGrid_SetCellBackgroundColor_(PropertyGrid* obj, Col
 
 ALTERNET_UI_API void PropertyGrid_SetCellDisabledTextColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetCellDisabledTextColor_");
     MarshalExceptions<void>([&](){
         obj->SetCellDisabledTextColor(*col);
     });
@@ -514,6 +586,7 @@ ALTERNET_UI_API void PropertyGrid_SetCellDisabledTextColor_(PropertyGrid* obj, C
 
 ALTERNET_UI_API void PropertyGrid_SetCellTextColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetCellTextColor_");
     MarshalExceptions<void>([&](){
         obj->SetCellTextColor(*col);
     });
@@ -521,6 +594,7 @@ ALTERNET_UI_API void PropertyGrid_SetCellTextColor_(PropertyGrid* obj, Color* co
 
 ALTERNET_UI_API void PropertyGrid_SetColumnCount_(PropertyGrid* obj, int colCount)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetColumnCount_");
     MarshalExceptions<void>([&](){
         obj->SetColumnCount(colCount);
     });
@@ -528,6 +602,7 @@ ALTERNET_UI_API void PropertyGrid_SetColumnCount_(PropertyGrid* obj, int colCoun
 
 ALTERNET_UI_API void PropertyGrid_SetEmptySpaceColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetEmptySpaceColor_");
     MarshalExceptions<void>([&](){
         obj->SetEmptySpaceColor(*col);
     });
@@ -535,6 +610,7 @@ ALTERNET_UI_API void PropertyGrid_SetEmptySpaceColor_(PropertyGrid* obj, Color*
 
 ALTERNET_UI_API void PropertyGrid_SetLineColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetLineColor_");
     MarshalExceptions<void>([&](){
         obj->SetLineColor(*col);
     });
@@ -542,6 +618,7 @@ ALTERNET_UI_API void PropertyGrid_SetLineColor_(PropertyGrid* obj, Color* col)
 
 ALTERNET_UI_API void PropertyGrid_SetMarginColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetMarginColor_");
     MarshalExceptions<void>([&](){
         obj->SetMarginColor(*col);
     });
@@ -549,6 +626,7 @@ ALTERNET_UI_API void PropertyGrid_SetMarginColor_(PropertyGrid* obj, Color* col)
 
 ALTERNET_UI_API void PropertyGrid_SetSelectionBackgroundColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetSelectionBackgroundColor_");
     MarshalExceptions<void>([&](){
         obj->SetSelectionBackgroundColor(*col);
     });
@@ -556,6 +634,7 @@ ALTERNET_UI_API void PropertyGrid_SetSelectionBackgroundColor_(PropertyGrid* obj
 
 ALTERNET_UI_API void PropertyGrid_SetSelectionTextColor_(PropertyGrid* obj, Color* col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetSelectionTextColor_");
     MarshalExceptions<void>([&](){
         obj->SetSelectionTextColor(*col);
     });
@@ -563,6 +642,7 @@ ALTERNET_UI_API void PropertyGrid_SetSelectionTextColor_(PropertyGrid* obj, Colo
 
 ALTERNET_UI_API void PropertyGrid_SetSplitterPosition_(PropertyGrid* obj, int newXPos, int col)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetSplitterPosition_");
     MarshalExceptions<void>([&](){
         obj->SetSplitterPosition(newXPos, col);
     });
@@ -570,6 +650,7 @@ ALTERNET_UI_API void PropertyGrid_SetSplitterPosition_(PropertyGrid* obj, int ne
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetUnspecifiedValueText_(PropertyGrid* obj, int argFlags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetUnspecifiedValueText_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetUnspecifiedValueText(argFlags);
     });
@@ -577,6 +658,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetUnspecifiedValueText_(Propert
 
 ALTERNET_UI_API void PropertyGrid_SetVirtualWidth_(PropertyGrid* obj, int width)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetVirtualWidth_");
     MarshalExceptions<void>([&](){
         obj->SetVirtualWidth(width);
     });
@@ -584,6 +666,7 @@ ALTERNET_UI_API void PropertyGrid_SetVirtualWidth_(PropertyGrid* obj, int width)
 
 ALTERNET_UI_API void PropertyGrid_SetSplitterLeft_(PropertyGrid* obj, c_bool privateChildrenToo)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetSplitterLeft_");
     MarshalExceptions<void>([&](){
         obj->SetSplitterLeft(privateChildrenToo);
     });
@@ -591,6 +674,7 @@ ALTERNET_UI_API void PropertyGrid_SetSplitterLeft_(PropertyGrid* obj, c_bool pri
 
 ALTERNET_UI_API void PropertyGrid_SetVerticalSpacing_(PropertyGrid* obj, int vspacing)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetVerticalSpacing_");
     MarshalExceptions<void>([&](){
         obj->SetVerticalSpacing(vspacing);
     });
@@ -598,6 +682,7 @@ ALTERNET_UI_API void PropertyGrid_SetVerticalSpacing_(PropertyGrid* obj, int vsp
 
 ALTERNET_UI_API c_bool PropertyGrid_HasVirtualWidth_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_HasVirtualWidth_");
     return MarshalExceptions<c_bool>([&](){
         return obj->HasVirtualWidth();
     });
@@ -605,6 +690,7 @@ ALTERNET_UI_API c_bool PropertyGrid_HasVirtualWidth_(PropertyGrid* obj)
 
 ALTERNET_UI_API uint32_t PropertyGrid_GetCommonValueCount_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetCommonValueCount_");
     return MarshalExceptions<uint32_t>([&](){
         return obj->GetCommonValueCount();
     });
@@ -612,6 +698,7 @@ ALTERNET_UI_API uint32_t PropertyGrid_GetCommonValueCount_(PropertyGrid* obj)
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetCommonValueLabel_(PropertyGrid* obj, uint32_t i)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetCommonValueLabel_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetCommonValueLabel(i);
     });
@@ -619,6 +706,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetCommonValueLabel_(PropertyGri
 
 ALTERNET_UI_API int PropertyGrid_GetUnspecifiedCommonValue_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetUnspecifiedCommonValue_");
     return MarshalExceptions<int>([&](){
         return obj->GetUnspecifiedCommonValue();
     });
@@ -626,6 +714,7 @@ ALTERNET_UI_API int PropertyGrid_GetUnspecifiedCommonValue_(PropertyGrid* obj)
 
 ALTERNET_UI_API void PropertyGrid_SetUnspecifiedCommonValue_(PropertyGrid* obj, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetUnspecifiedCommonValue_");
     MarshalExceptions<void>([&](){
         obj->SetUnspecifiedCommonValue(index);
     });
@@ -633,6 +722,7 @@ ALTERNET_UI_API void PropertyGrid_SetUnspecifiedCommonValue_(PropertyGrid* obj,
 
 ALTERNET_UI_API c_bool PropertyGrid_IsSmallScreen_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsSmallScreen_");
     return MarshalExceptions<c_bool>([&](){
         return PropertyGrid::IsSmallScreen();
     });
@@ -640,6 +730,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsSmallScreen_()
 
 ALTERNET_UI_API void PropertyGrid_RefreshEditor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_RefreshEditor_");
     MarshalExceptions<void>([&](){
         obj->RefreshEditor();
     });
@@ -647,6 +738,7 @@ ALTERNET_UI_API void PropertyGrid_RefreshEditor_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_WasValueChangedInEvent_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_WasValueChangedInEvent_");
     return MarshalExceptions<c_bool>([&](){
         return obj->WasValueChangedInEvent();
     });
@@ -654,6 +746,7 @@ ALTERNET_UI_API c_bool PropertyGrid_WasValueChangedInEvent_(PropertyGrid* obj)
 
 ALTERNET_UI_API int PropertyGrid_GetSpacingY_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetSpacingY_");
     return MarshalExceptions<int>([&](){
         return obj->GetSpacingY();
     });
@@ -661,6 +754,7 @@ ALTERNET_UI_API int PropertyGrid_GetSpacingY_(PropertyGrid* obj)
 
 ALTERNET_UI_API void PropertyGrid_SetupTextCtrlValue_(PropertyGrid* obj, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetupTextCtrlValue_");
     MarshalExceptions<void>([&](){
         obj->SetupTextCtrlValue(*text);
     });
@@ -668,6 +762,7 @@ ALTERNET_UI_API void PropertyGrid_SetupTextCtrlValue_(PropertyGrid* obj, NativeS
 
 ALTERNET_UI_API c_bool PropertyGrid_UnfocusEditor_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_UnfocusEditor_");
     return MarshalExceptions<c_bool>([&](){
         return obj->UnfocusEditor();
     });
@@ -675,6 +770,7 @@ ALTERNET_UI_API c_bool PropertyGrid_UnfocusEditor_(PropertyGrid* obj)
 
 ALTERNET_UI_API void* PropertyGrid_GetLastItem_(PropertyGrid* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetLastItem_");
     return MarshalExceptions<void*>([&](){
         return obj->GetLastItem(flags);
     });
@@ -682,6 +778,7 @@ ALTERNET_UI_API void* PropertyGrid_GetLastItem_(PropertyGrid* obj, int flags)
 
 ALTERNET_UI_API void* PropertyGrid_GetRoot_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetRoot_");
     return MarshalExceptions<void*>([&](){
         return obj->GetRoot();
     });
@@ -689,6 +786,7 @@ ALTERNET_UI_API void* PropertyGrid_GetRoot_(PropertyGrid* obj)
 
 ALTERNET_UI_API void* PropertyGrid_GetSelectedProperty_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetSelectedProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->GetSelectedProperty();
     });
@@ -696,6 +794,7 @@ ALTERNET_UI_API void* PropertyGrid_GetSelectedProperty_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_EnsureVisible_(PropertyGrid* obj, void* propArg)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_EnsureVisible_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EnsureVisible(propArg);
     });
@@ -703,6 +802,7 @@ ALTERNET_UI_API c_bool PropertyGrid_EnsureVisible_(PropertyGrid* obj, void* prop
 
 ALTERNET_UI_API c_bool PropertyGrid_SelectProperty_(PropertyGrid* obj, void* propArg, c_bool focus)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SelectProperty_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SelectProperty(propArg, focus);
     });
@@ -710,6 +810,7 @@ ALTERNET_UI_API c_bool PropertyGrid_SelectProperty_(PropertyGrid* obj, void* pro
 
 ALTERNET_UI_API c_bool PropertyGrid_AddToSelection_(PropertyGrid* obj, void* propArg)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_AddToSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->AddToSelection(propArg);
     });
@@ -717,6 +818,7 @@ ALTERNET_UI_API c_bool PropertyGrid_AddToSelection_(PropertyGrid* obj, void* pro
 
 ALTERNET_UI_API c_bool PropertyGrid_RemoveFromSelection_(PropertyGrid* obj, void* propArg)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_RemoveFromSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->RemoveFromSelection(propArg);
     });
@@ -724,6 +826,7 @@ ALTERNET_UI_API c_bool PropertyGrid_RemoveFromSelection_(PropertyGrid* obj, void
 
 ALTERNET_UI_API void PropertyGrid_SetCurrentCategory_(PropertyGrid* obj, void* propArg)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetCurrentCategory_");
     MarshalExceptions<void>([&](){
         obj->SetCurrentCategory(propArg);
     });
@@ -731,6 +834,7 @@ ALTERNET_UI_API void PropertyGrid_SetCurrentCategory_(PropertyGrid* obj, void* p
 
 ALTERNET_UI_API RectI_C PropertyGrid_GetImageRect_(PropertyGrid* obj, void* p, int item)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetImageRect_");
     return MarshalExceptions<RectI_C>([&](){
         return obj->GetImageRect(p, item);
     });
@@ -738,6 +842,7 @@ ALTERNET_UI_API RectI_C PropertyGrid_GetImageRect_(PropertyGrid* obj, void* p, i
 
 ALTERNET_UI_API SizeI_C PropertyGrid_GetImageSize_(PropertyGrid* obj, void* p, int item)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetImageSize_");
     return MarshalExceptions<SizeI_C>([&](){
         return obj->GetImageSize(p, item);
     });
@@ -745,6 +850,7 @@ ALTERNET_UI_API SizeI_C PropertyGrid_GetImageSize_(PropertyGrid* obj, void* p, i
 
 ALTERNET_UI_API void* PropertyGrid_CreateStringProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateStringProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateStringProperty(*label, *name, *value);
     });
@@ -752,6 +858,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateStringProperty_(PropertyGrid* obj, Nati
 
 ALTERNET_UI_API void* PropertyGrid_CreateFilenameProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateFilenameProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateFilenameProperty(*label, *name, *value);
     });
@@ -759,6 +866,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateFilenameProperty_(PropertyGrid* obj, Na
 
 ALTERNET_UI_API void* PropertyGrid_CreateDirProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateDirProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateDirProperty(*label, *name, *value);
     });
@@ -766,6 +874,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateDirProperty_(PropertyGrid* obj, NativeS
 
 ALTERNET_UI_API void* PropertyGrid_CreateImageFilenameProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateImageFilenameProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateImageFilenameProperty(*label, *name, *value);
     });
@@ -773,6 +882,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateImageFilenameProperty_(PropertyGrid* ob
 
 ALTERNET_UI_API void* PropertyGrid_CreateSystemColorProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, Color* value, uint32_t kind)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateSystemColorProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateSystemColorProperty(*label, *name, *value, kind);
     });
@@ -780,6 +890,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateSystemColorProperty_(PropertyGrid* obj,
 
 ALTERNET_UI_API void* PropertyGrid_CreateCursorProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateCursorProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateCursorProperty(*label, *name, value);
     });
@@ -787,6 +898,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateCursorProperty_(PropertyGrid* obj, Nati
 
 ALTERNET_UI_API void* PropertyGrid_CreateBoolProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateBoolProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateBoolProperty(*label, *name, value);
     });
@@ -794,6 +906,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateBoolProperty_(PropertyGrid* obj, Native
 
 ALTERNET_UI_API void* PropertyGrid_CreateIntProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, int64_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateIntProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateIntProperty(*label, *name, value);
     });
@@ -801,6 +914,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateIntProperty_(PropertyGrid* obj, NativeS
 
 ALTERNET_UI_API void* PropertyGrid_CreateFloatProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, double value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateFloatProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateFloatProperty(*label, *name, value);
     });
@@ -808,6 +922,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateFloatProperty_(PropertyGrid* obj, Nativ
 
 ALTERNET_UI_API void* PropertyGrid_CreateUIntProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, uint64_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateUIntProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateUIntProperty(*label, *name, value);
     });
@@ -815,6 +930,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateUIntProperty_(PropertyGrid* obj, Native
 
 ALTERNET_UI_API void* PropertyGrid_CreateLongStringProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateLongStringProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateLongStringProperty(*label, *name, *value);
     });
@@ -822,6 +938,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateLongStringProperty_(PropertyGrid* obj,
 
 ALTERNET_UI_API void* PropertyGrid_CreateDateProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, DateTime* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateDateProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateDateProperty(*label, *name, *value);
     });
@@ -829,6 +946,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateDateProperty_(PropertyGrid* obj, Native
 
 ALTERNET_UI_API void PropertyGrid_Clear_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_Clear_");
     MarshalExceptions<void>([&](){
         obj->Clear();
     });
@@ -836,6 +954,7 @@ ALTERNET_UI_API void PropertyGrid_Clear_(PropertyGrid* obj)
 
 ALTERNET_UI_API void* PropertyGrid_Append_(PropertyGrid* obj, void* property)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_Append_");
     return MarshalExceptions<void*>([&](){
         return obj->Append(property);
     });
@@ -843,6 +962,7 @@ ALTERNET_UI_API void* PropertyGrid_Append_(PropertyGrid* obj, void* property)
 
 ALTERNET_UI_API void* PropertyGrid_CreateEditEnumProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, void* choices, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateEditEnumProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateEditEnumProperty(*label, *name, choices, *value);
     });
@@ -850,6 +970,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateEditEnumProperty_(PropertyGrid* obj, Na
 
 ALTERNET_UI_API void* PropertyGrid_CreateEnumProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, void* choices, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateEnumProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateEnumProperty(*label, *name, choices, value);
     });
@@ -857,6 +978,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateEnumProperty_(PropertyGrid* obj, Native
 
 ALTERNET_UI_API void* PropertyGrid_CreateFlagsProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, void* choices, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateFlagsProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateFlagsProperty(*label, *name, choices, value);
     });
@@ -864,6 +986,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateFlagsProperty_(PropertyGrid* obj, Nativ
 
 ALTERNET_UI_API c_bool PropertyGrid_ClearSelection_(PropertyGrid* obj, c_bool validation)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ClearSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ClearSelection(validation);
     });
@@ -871,6 +994,7 @@ ALTERNET_UI_API c_bool PropertyGrid_ClearSelection_(PropertyGrid* obj, c_bool va
 
 ALTERNET_UI_API void PropertyGrid_ClearModifiedStatus_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ClearModifiedStatus_");
     MarshalExceptions<void>([&](){
         obj->ClearModifiedStatus();
     });
@@ -878,6 +1002,7 @@ ALTERNET_UI_API void PropertyGrid_ClearModifiedStatus_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_CollapseAll_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CollapseAll_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CollapseAll();
     });
@@ -885,6 +1010,7 @@ ALTERNET_UI_API c_bool PropertyGrid_CollapseAll_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_EditorValidate_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_EditorValidate_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EditorValidate();
     });
@@ -892,6 +1018,7 @@ ALTERNET_UI_API c_bool PropertyGrid_EditorValidate_(PropertyGrid* obj)
 
 ALTERNET_UI_API c_bool PropertyGrid_ExpandAll_(PropertyGrid* obj, c_bool expand)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ExpandAll_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ExpandAll(expand);
     });
@@ -899,6 +1026,7 @@ ALTERNET_UI_API c_bool PropertyGrid_ExpandAll_(PropertyGrid* obj, c_bool expand)
 
 ALTERNET_UI_API void* PropertyGrid_CreatePropCategory_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreatePropCategory_");
     return MarshalExceptions<void*>([&](){
         return obj->CreatePropCategory(*label, *name);
     });
@@ -906,6 +1034,7 @@ ALTERNET_UI_API void* PropertyGrid_CreatePropCategory_(PropertyGrid* obj, Native
 
 ALTERNET_UI_API void* PropertyGrid_GetFirst_(PropertyGrid* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetFirst_");
     return MarshalExceptions<void*>([&](){
         return obj->GetFirst(flags);
     });
@@ -913,6 +1042,7 @@ ALTERNET_UI_API void* PropertyGrid_GetFirst_(PropertyGrid* obj, int flags)
 
 ALTERNET_UI_API void* PropertyGrid_GetProperty_(PropertyGrid* obj, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->GetProperty(*name);
     });
@@ -920,6 +1050,7 @@ ALTERNET_UI_API void* PropertyGrid_GetProperty_(PropertyGrid* obj, NativeStringS
 
 ALTERNET_UI_API void* PropertyGrid_GetPropertyByLabel_(PropertyGrid* obj, NativeStringSpan* label)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyByLabel_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPropertyByLabel(*label);
     });
@@ -927,6 +1058,7 @@ ALTERNET_UI_API void* PropertyGrid_GetPropertyByLabel_(PropertyGrid* obj, Native
 
 ALTERNET_UI_API void* PropertyGrid_GetPropertyByName_(PropertyGrid* obj, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyByName_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPropertyByName(*name);
     });
@@ -934,6 +1066,7 @@ ALTERNET_UI_API void* PropertyGrid_GetPropertyByName_(PropertyGrid* obj, NativeS
 
 ALTERNET_UI_API void* PropertyGrid_GetPropertyByNameAndSubName_(PropertyGrid* obj, NativeStringSpan* name, NativeStringSpan* subname)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyByNameAndSubName_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPropertyByNameAndSubName(*name, *subname);
     });
@@ -941,6 +1074,7 @@ ALTERNET_UI_API void* PropertyGrid_GetPropertyByNameAndSubName_(PropertyGrid* ob
 
 ALTERNET_UI_API void* PropertyGrid_GetSelection_(PropertyGrid* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetSelection_");
     return MarshalExceptions<void*>([&](){
         return obj->GetSelection();
     });
@@ -948,6 +1082,7 @@ ALTERNET_UI_API void* PropertyGrid_GetSelection_(PropertyGrid* obj)
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyName_(PropertyGrid* obj, void* property)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetPropertyName(property);
     });
@@ -955,6 +1090,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyName_(PropertyGrid* o
 
 ALTERNET_UI_API void PropertyGrid_InitAllTypeHandlers_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_InitAllTypeHandlers_");
     MarshalExceptions<void>([&](){
         PropertyGrid::InitAllTypeHandlers();
     });
@@ -962,6 +1098,7 @@ ALTERNET_UI_API void PropertyGrid_InitAllTypeHandlers_()
 
 ALTERNET_UI_API void PropertyGrid_RegisterAdditionalEditors_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_RegisterAdditionalEditors_");
     MarshalExceptions<void>([&](){
         PropertyGrid::RegisterAdditionalEditors();
     });
@@ -969,6 +1106,7 @@ ALTERNET_UI_API void PropertyGrid_RegisterAdditionalEditors_()
 
 ALTERNET_UI_API c_bool PropertyGrid_RestoreEditableState_(PropertyGrid* obj, NativeStringSpan* src, int restoreStates)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_RestoreEditableState_");
     return MarshalExceptions<c_bool>([&](){
         return obj->RestoreEditableState(*src, restoreStates);
     });
@@ -976,6 +1114,7 @@ ALTERNET_UI_API c_bool PropertyGrid_RestoreEditableState_(PropertyGrid* obj, Nat
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_SaveEditableState_(PropertyGrid* obj, int includedStates)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SaveEditableState_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->SaveEditableState(includedStates);
     });
@@ -983,6 +1122,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_SaveEditableState_(PropertyGrid*
 
 ALTERNET_UI_API void PropertyGrid_SetBoolChoices_(NativeStringSpan* trueChoice, NativeStringSpan* falseChoice)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetBoolChoices_");
     MarshalExceptions<void>([&](){
         PropertyGrid::SetBoolChoices(*trueChoice, *falseChoice);
     });
@@ -990,6 +1130,7 @@ ALTERNET_UI_API void PropertyGrid_SetBoolChoices_(NativeStringSpan* trueChoice,
 
 ALTERNET_UI_API c_bool PropertyGrid_SetColumnProportion_(PropertyGrid* obj, uint32_t column, int proportion)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetColumnProportion_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetColumnProportion(column, proportion);
     });
@@ -997,6 +1138,7 @@ ALTERNET_UI_API c_bool PropertyGrid_SetColumnProportion_(PropertyGrid* obj, uint
 
 ALTERNET_UI_API int PropertyGrid_GetColumnProportion_(PropertyGrid* obj, uint32_t column)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetColumnProportion_");
     return MarshalExceptions<int>([&](){
         return obj->GetColumnProportion(column);
     });
@@ -1004,6 +1146,7 @@ ALTERNET_UI_API int PropertyGrid_GetColumnProportion_(PropertyGrid* obj, uint32_
 
 ALTERNET_UI_API void PropertyGrid_Sort_(PropertyGrid* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_Sort_");
     MarshalExceptions<void>([&](){
         obj->Sort(flags);
     });
@@ -1011,6 +1154,7 @@ ALTERNET_UI_API void PropertyGrid_Sort_(PropertyGrid* obj, int flags)
 
 ALTERNET_UI_API void PropertyGrid_RefreshProperty_(PropertyGrid* obj, void* p)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_RefreshProperty_");
     MarshalExceptions<void>([&](){
         obj->RefreshProperty(p);
     });
@@ -1018,6 +1162,7 @@ ALTERNET_UI_API void PropertyGrid_RefreshProperty_(PropertyGrid* obj, void* p)
 
 ALTERNET_UI_API void* PropertyGrid_CreateColorProperty_(PropertyGrid* obj, NativeStringSpan* label, NativeStringSpan* name, Color* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_CreateColorProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->CreateColorProperty(*label, *name, *value);
     });
@@ -1025,6 +1170,7 @@ ALTERNET_UI_API void* PropertyGrid_CreateColorProperty_(PropertyGrid* obj, Nativ
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyReadOnly_(PropertyGrid* obj, void* id, c_bool set, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyReadOnly_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyReadOnly(id, set, flags);
     });
@@ -1032,6 +1178,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyReadOnly_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyValueUnspecified_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValueUnspecified_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyValueUnspecified(id);
     });
@@ -1039,6 +1186,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyValueUnspecified_(PropertyGrid* obj
 
 ALTERNET_UI_API void* PropertyGrid_AppendIn_(PropertyGrid* obj, void* id, void* newproperty)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_AppendIn_");
     return MarshalExceptions<void*>([&](){
         return obj->AppendIn(id, newproperty);
     });
@@ -1046,6 +1194,7 @@ ALTERNET_UI_API void* PropertyGrid_AppendIn_(PropertyGrid* obj, void* id, void*
 
 ALTERNET_UI_API void PropertyGrid_BeginAddChildren_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_BeginAddChildren_");
     MarshalExceptions<void>([&](){
         obj->BeginAddChildren(id);
     });
@@ -1053,6 +1202,7 @@ ALTERNET_UI_API void PropertyGrid_BeginAddChildren_(PropertyGrid* obj, void* id)
 
 ALTERNET_UI_API c_bool PropertyGrid_Collapse_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_Collapse_");
     return MarshalExceptions<c_bool>([&](){
         return obj->Collapse(id);
     });
@@ -1060,6 +1210,7 @@ ALTERNET_UI_API c_bool PropertyGrid_Collapse_(PropertyGrid* obj, void* id)
 
 ALTERNET_UI_API void PropertyGrid_DeleteProperty_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_DeleteProperty_");
     MarshalExceptions<void>([&](){
         obj->DeleteProperty(id);
     });
@@ -1067,6 +1218,7 @@ ALTERNET_UI_API void PropertyGrid_DeleteProperty_(PropertyGrid* obj, void* id)
 
 ALTERNET_UI_API void* PropertyGrid_RemoveProperty_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_RemoveProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->RemoveProperty(id);
     });
@@ -1074,6 +1226,7 @@ ALTERNET_UI_API void* PropertyGrid_RemoveProperty_(PropertyGrid* obj, void* id)
 
 ALTERNET_UI_API c_bool PropertyGrid_DisableProperty_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_DisableProperty_");
     return MarshalExceptions<c_bool>([&](){
         return obj->DisableProperty(id);
     });
@@ -1081,6 +1234,7 @@ ALTERNET_UI_API c_bool PropertyGrid_DisableProperty_(PropertyGrid* obj, void* id
 
 ALTERNET_UI_API c_bool PropertyGrid_EnableProperty_(PropertyGrid* obj, void* id, c_bool enable)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_EnableProperty_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EnableProperty(id, enable);
     });
@@ -1088,6 +1242,7 @@ ALTERNET_UI_API c_bool PropertyGrid_EnableProperty_(PropertyGrid* obj, void* id,
 
 ALTERNET_UI_API void PropertyGrid_EndAddChildren_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_EndAddChildren_");
     MarshalExceptions<void>([&](){
         obj->EndAddChildren(id);
     });
@@ -1095,6 +1250,7 @@ ALTERNET_UI_API void PropertyGrid_EndAddChildren_(PropertyGrid* obj, void* id)
 
 ALTERNET_UI_API c_bool PropertyGrid_Expand_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_Expand_");
     return MarshalExceptions<c_bool>([&](){
         return obj->Expand(id);
     });
@@ -1102,6 +1258,7 @@ ALTERNET_UI_API c_bool PropertyGrid_Expand_(PropertyGrid* obj, void* id)
 
 ALTERNET_UI_API void* PropertyGrid_GetFirstChild_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetFirstChild_");
     return MarshalExceptions<void*>([&](){
         return obj->GetFirstChild(id);
     });
@@ -1109,6 +1266,7 @@ ALTERNET_UI_API void* PropertyGrid_GetFirstChild_(PropertyGrid* obj, void* id)
 
 ALTERNET_UI_API void* PropertyGrid_GetPropertyCategory_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyCategory_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPropertyCategory(id);
     });
@@ -1116,6 +1274,7 @@ ALTERNET_UI_API void* PropertyGrid_GetPropertyCategory_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API void* PropertyGrid_GetPropertyClientData_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyClientData_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPropertyClientData(id);
     });
@@ -1123,6 +1282,7 @@ ALTERNET_UI_API void* PropertyGrid_GetPropertyClientData_(PropertyGrid* obj, voi
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyHelpString_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyHelpString_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetPropertyHelpString(id);
     });
@@ -1130,6 +1290,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyHelpString_(PropertyG
 
 ALTERNET_UI_API void* PropertyGrid_GetPropertyImage_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyImage_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPropertyImage(id);
     });
@@ -1137,6 +1298,7 @@ ALTERNET_UI_API void* PropertyGrid_GetPropertyImage_(PropertyGrid* obj, void* id
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyLabel_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyLabel_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetPropertyLabel(id);
     });
@@ -1144,6 +1306,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyLabel_(PropertyGrid*
 
 ALTERNET_UI_API void* PropertyGrid_GetPropertyParent_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyParent_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPropertyParent(id);
     });
@@ -1151,6 +1314,7 @@ ALTERNET_UI_API void* PropertyGrid_GetPropertyParent_(PropertyGrid* obj, void* i
 
 ALTERNET_UI_API void* PropertyGrid_GetPropertyValueAsVariant_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValueAsVariant_");
     return MarshalExceptions<void*>([&](){
         return obj->GetPropertyValueAsVariant(id);
     });
@@ -1158,6 +1322,7 @@ ALTERNET_UI_API void* PropertyGrid_GetPropertyValueAsVariant_(PropertyGrid* obj,
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyValueAsString_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValueAsString_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetPropertyValueAsString(id);
     });
@@ -1165,6 +1330,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyValueAsString_(Proper
 
 ALTERNET_UI_API int64_t PropertyGrid_GetPropertyValueAsLong_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValueAsLong_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetPropertyValueAsLong(id);
     });
@@ -1172,6 +1338,7 @@ ALTERNET_UI_API int64_t PropertyGrid_GetPropertyValueAsLong_(PropertyGrid* obj,
 
 ALTERNET_UI_API uint64_t PropertyGrid_GetPropertyValueAsULong_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValueAsULong_");
     return MarshalExceptions<uint64_t>([&](){
         return obj->GetPropertyValueAsULong(id);
     });
@@ -1179,6 +1346,7 @@ ALTERNET_UI_API uint64_t PropertyGrid_GetPropertyValueAsULong_(PropertyGrid* obj
 
 ALTERNET_UI_API int PropertyGrid_GetPropertyValueAsInt_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValueAsInt_");
     return MarshalExceptions<int>([&](){
         return obj->GetPropertyValueAsInt(id);
     });
@@ -1186,6 +1354,7 @@ ALTERNET_UI_API int PropertyGrid_GetPropertyValueAsInt_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API c_bool PropertyGrid_GetPropertyValueAsBool_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValueAsBool_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetPropertyValueAsBool(id);
     });
@@ -1193,6 +1362,7 @@ ALTERNET_UI_API c_bool PropertyGrid_GetPropertyValueAsBool_(PropertyGrid* obj, v
 
 ALTERNET_UI_API double PropertyGrid_GetPropertyValueAsDouble_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValueAsDouble_");
     return MarshalExceptions<double>([&](){
         return obj->GetPropertyValueAsDouble(id);
     });
@@ -1200,6 +1370,7 @@ ALTERNET_UI_API double PropertyGrid_GetPropertyValueAsDouble_(PropertyGrid* obj,
 
 ALTERNET_UI_API DateTime_C PropertyGrid_GetPropertyValueAsDateTime_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValueAsDateTime_");
     return MarshalExceptions<DateTime_C>([&](){
         return obj->GetPropertyValueAsDateTime(id);
     });
@@ -1207,6 +1378,7 @@ ALTERNET_UI_API DateTime_C PropertyGrid_GetPropertyValueAsDateTime_(PropertyGrid
 
 ALTERNET_UI_API c_bool PropertyGrid_HideProperty_(PropertyGrid* obj, void* id, c_bool hide, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_HideProperty_");
     return MarshalExceptions<c_bool>([&](){
         return obj->HideProperty(id, hide, flags);
     });
@@ -1214,6 +1386,7 @@ ALTERNET_UI_API c_bool PropertyGrid_HideProperty_(PropertyGrid* obj, void* id, c
 
 ALTERNET_UI_API void* PropertyGrid_Insert_(PropertyGrid* obj, void* priorThis, void* newproperty)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_Insert_");
     return MarshalExceptions<void*>([&](){
         return obj->Insert(priorThis, newproperty);
     });
@@ -1221,6 +1394,7 @@ ALTERNET_UI_API void* PropertyGrid_Insert_(PropertyGrid* obj, void* priorThis, v
 
 ALTERNET_UI_API void* PropertyGrid_InsertByIndex_(PropertyGrid* obj, void* parent, int index, void* newproperty)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_InsertByIndex_");
     return MarshalExceptions<void*>([&](){
         return obj->InsertByIndex(parent, index, newproperty);
     });
@@ -1228,6 +1402,7 @@ ALTERNET_UI_API void* PropertyGrid_InsertByIndex_(PropertyGrid* obj, void* paren
 
 ALTERNET_UI_API c_bool PropertyGrid_IsPropertyCategory_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsPropertyCategory_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsPropertyCategory(id);
     });
@@ -1235,6 +1410,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsPropertyCategory_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API c_bool PropertyGrid_IsPropertyEnabled_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsPropertyEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsPropertyEnabled(id);
     });
@@ -1242,6 +1418,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsPropertyEnabled_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API c_bool PropertyGrid_IsPropertyExpanded_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsPropertyExpanded_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsPropertyExpanded(id);
     });
@@ -1249,6 +1426,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsPropertyExpanded_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API c_bool PropertyGrid_IsPropertyModified_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsPropertyModified_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsPropertyModified(id);
     });
@@ -1256,6 +1434,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsPropertyModified_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API c_bool PropertyGrid_IsPropertySelected_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsPropertySelected_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsPropertySelected(id);
     });
@@ -1263,6 +1442,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsPropertySelected_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API c_bool PropertyGrid_IsPropertyShown_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsPropertyShown_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsPropertyShown(id);
     });
@@ -1270,6 +1450,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsPropertyShown_(PropertyGrid* obj, void* id
 
 ALTERNET_UI_API c_bool PropertyGrid_IsPropertyValueUnspecified_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_IsPropertyValueUnspecified_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsPropertyValueUnspecified(id);
     });
@@ -1277,6 +1458,7 @@ ALTERNET_UI_API c_bool PropertyGrid_IsPropertyValueUnspecified_(PropertyGrid* ob
 
 ALTERNET_UI_API void PropertyGrid_LimitPropertyEditing_(PropertyGrid* obj, void* id, c_bool limit)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_LimitPropertyEditing_");
     MarshalExceptions<void>([&](){
         obj->LimitPropertyEditing(id, limit);
     });
@@ -1284,6 +1466,7 @@ ALTERNET_UI_API void PropertyGrid_LimitPropertyEditing_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API void* PropertyGrid_ReplaceProperty_(PropertyGrid* obj, void* id, void* property)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ReplaceProperty_");
     return MarshalExceptions<void*>([&](){
         return obj->ReplaceProperty(id, property);
     });
@@ -1291,6 +1474,7 @@ ALTERNET_UI_API void* PropertyGrid_ReplaceProperty_(PropertyGrid* obj, void* id,
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyBackgroundColor_(PropertyGrid* obj, void* id, Color* color, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyBackgroundColor_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyBackgroundColor(id, *color, flags);
     });
@@ -1298,6 +1482,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyBackgroundColor_(PropertyGrid* obj,
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyColorsToDefault_(PropertyGrid* obj, void* id, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyColorsToDefault_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyColorsToDefault(id, flags);
     });
@@ -1305,6 +1490,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyColorsToDefault_(PropertyGrid* obj,
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyTextColor_(PropertyGrid* obj, void* id, Color* col, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyTextColor_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyTextColor(id, *col, flags);
     });
@@ -1312,6 +1498,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyTextColor_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API Color_C PropertyGrid_GetPropertyBackgroundColor_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyBackgroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetPropertyBackgroundColor(id);
     });
@@ -1319,6 +1506,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetPropertyBackgroundColor_(PropertyGrid* o
 
 ALTERNET_UI_API Color_C PropertyGrid_GetPropertyTextColor_(PropertyGrid* obj, void* id)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyTextColor_");
     return MarshalExceptions<Color_C>([&](){
         return obj->GetPropertyTextColor(id);
     });
@@ -1326,6 +1514,7 @@ ALTERNET_UI_API Color_C PropertyGrid_GetPropertyTextColor_(PropertyGrid* obj, vo
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyClientData_(PropertyGrid* obj, void* id, void* clientData)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyClientData_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyClientData(id, clientData);
     });
@@ -1333,6 +1522,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyClientData_(PropertyGrid* obj, void
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyEditor_(PropertyGrid* obj, void* id, void* editor)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyEditor_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyEditor(id, editor);
     });
@@ -1340,6 +1530,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyEditor_(PropertyGrid* obj, void* id
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyEditorByName_(PropertyGrid* obj, void* id, NativeStringSpan* editorName)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyEditorByName_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyEditorByName(id, *editorName);
     });
@@ -1347,6 +1538,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyEditorByName_(PropertyGrid* obj, vo
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyLabel_(PropertyGrid* obj, void* id, NativeStringSpan* newproplabel)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyLabel_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyLabel(id, *newproplabel);
     });
@@ -1354,6 +1546,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyLabel_(PropertyGrid* obj, void* id,
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyName_(PropertyGrid* obj, void* id, NativeStringSpan* newName)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyName_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyName(id, *newName);
     });
@@ -1361,6 +1554,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyName_(PropertyGrid* obj, void* id,
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyHelpString_(PropertyGrid* obj, void* id, NativeStringSpan* helpString)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyHelpString_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyHelpString(id, *helpString);
     });
@@ -1368,6 +1562,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyHelpString_(PropertyGrid* obj, void
 
 ALTERNET_UI_API c_bool PropertyGrid_SetPropertyMaxLength_(PropertyGrid* obj, void* id, int maxLen)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyMaxLength_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetPropertyMaxLength(id, maxLen);
     });
@@ -1375,6 +1570,7 @@ ALTERNET_UI_API c_bool PropertyGrid_SetPropertyMaxLength_(PropertyGrid* obj, voi
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsLong_(PropertyGrid* obj, void* id, int64_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValueAsLong_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyValueAsLong(id, value);
     });
@@ -1382,6 +1578,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsLong_(PropertyGrid* obj, voi
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsInt_(PropertyGrid* obj, void* id, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValueAsInt_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyValueAsInt(id, value);
     });
@@ -1389,6 +1586,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsInt_(PropertyGrid* obj, void
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsDouble_(PropertyGrid* obj, void* id, double value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValueAsDouble_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyValueAsDouble(id, value);
     });
@@ -1396,6 +1594,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsDouble_(PropertyGrid* obj, v
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsBool_(PropertyGrid* obj, void* id, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValueAsBool_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyValueAsBool(id, value);
     });
@@ -1403,6 +1602,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsBool_(PropertyGrid* obj, voi
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsStr_(PropertyGrid* obj, void* id, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValueAsStr_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyValueAsStr(id, *value);
     });
@@ -1410,6 +1610,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsStr_(PropertyGrid* obj, void
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsVariant_(PropertyGrid* obj, void* id, void* variant)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValueAsVariant_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyValueAsVariant(id, variant);
     });
@@ -1417,6 +1618,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsVariant_(PropertyGrid* obj,
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsDateTime_(PropertyGrid* obj, void* id, DateTime* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValueAsDateTime_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyValueAsDateTime(id, *value);
     });
@@ -1424,6 +1626,7 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyValueAsDateTime_(PropertyGrid* obj,
 
 ALTERNET_UI_API void PropertyGrid_SetValidationFailureBehavior_(PropertyGrid* obj, int vfbFlags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetValidationFailureBehavior_");
     MarshalExceptions<void>([&](){
         obj->SetValidationFailureBehavior(vfbFlags);
     });
@@ -1431,6 +1634,7 @@ ALTERNET_UI_API void PropertyGrid_SetValidationFailureBehavior_(PropertyGrid* ob
 
 ALTERNET_UI_API void PropertyGrid_SortChildren_(PropertyGrid* obj, void* id, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SortChildren_");
     MarshalExceptions<void>([&](){
         obj->SortChildren(id, flags);
     });
@@ -1438,6 +1642,7 @@ ALTERNET_UI_API void PropertyGrid_SortChildren_(PropertyGrid* obj, void* id, int
 
 ALTERNET_UI_API void* PropertyGrid_GetEditorByName_(NativeStringSpan* editorName)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetEditorByName_");
     return MarshalExceptions<void*>([&](){
         return PropertyGrid::GetEditorByName(*editorName);
     });
@@ -1445,6 +1650,7 @@ ALTERNET_UI_API void* PropertyGrid_GetEditorByName_(NativeStringSpan* editorName
 
 ALTERNET_UI_API c_bool PropertyGrid_ChangePropertyValue_(PropertyGrid* obj, void* id, void* variant)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ChangePropertyValue_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ChangePropertyValue(id, variant);
     });
@@ -1452,6 +1658,7 @@ ALTERNET_UI_API c_bool PropertyGrid_ChangePropertyValue_(PropertyGrid* obj, void
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyAttribute_(PropertyGrid* obj, void* id, NativeStringSpan* attrName, void* variant, int64_t argFlags)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyAttribute_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyAttribute(id, *attrName, variant, argFlags);
     });
@@ -1459,11 +1666,84 @@ ALTERNET_UI_API void PropertyGrid_SetPropertyAttribute_(PropertyGrid* obj, void*
 
 ALTERNET_UI_API void PropertyGrid_SetPropertyAttributeAll_(PropertyGrid* obj, NativeStringSpan* attrName, void* variant)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyAttributeAll_");
     MarshalExceptions<void>([&](){
         obj->SetPropertyAttributeAll(*attrName, variant);
     });
 }
 
+ALTERNET_UI_API int PropertyGrid_AppendProperties_(PropertyGrid* obj, int64_t* schema, int schemaCount, NativeStringSpan* strings, int64_t* results, int resultsCount)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_AppendProperties_");
+    return MarshalExceptions<int>([&](){
+        return obj->AppendProperties(schema, schemaCount, *strings, results, resultsCount);
+    });
+}
+
+ALTERNET_UI_API int PropertyGrid_SetPropertyValues_(PropertyGrid* obj, int64_t* values, int valuesCount, NativeStringSpan* strings)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValues_");
+    return MarshalExceptions<int>([&](){
+        return obj->SetPropertyValues(values, valuesCount, *strings);
+    });
+}
+
+ALTERNET_UI_API int PropertyGrid_ApplyPropertyValues_(PropertyGrid* obj, int64_t* values, int valuesCount, NativeStringSpan* strings)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ApplyPropertyValues_");
+    return MarshalExceptions<int>([&](){
+        return obj->ApplyPropertyValues(values, valuesCount, *strings);
+    });
+}
+
+ALTERNET_UI_API int PropertyGrid_GetPropertyValues_(PropertyGrid* obj, int64_t* values, int valuesCount)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValues_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetPropertyValues(values, valuesCount);
+    });
+}
+
+ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyValuesText_(PropertyGrid* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValuesText_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return obj->GetPropertyValuesText();
+    });
+}
+
+ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetEventPropValueInline_(PropertyGrid* obj, int64_t* value, int valueCount)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetEventPropValueInline_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return obj->GetEventPropValueInline(value, valueCount);
+    });
+}
+
+ALTERNET_UI_API NativeStringSpan_C PropertyGrid_GetPropertyValueInline_(PropertyGrid* obj, void* id, int64_t* value, int valueCount)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_GetPropertyValueInline_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return obj->GetPropertyValueInline(id, value, valueCount);
+    });
+}
+
+ALTERNET_UI_API void PropertyGrid_SetPropertyValueInline_(PropertyGrid* obj, void* id, int64_t* value, int valueCount, NativeStringSpan* text)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_SetPropertyValueInline_");
+    MarshalExceptions<void>([&](){
+        obj->SetPropertyValueInline(id, value, valueCount, *text);
+    });
+}
+
+ALTERNET_UI_API c_bool PropertyGrid_ChangePropertyValueInline_(PropertyGrid* obj, void* id, int64_t* value, int valueCount, NativeStringSpan* text)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGrid_ChangePropertyValueInline_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->ChangePropertyValueInline(id, value, valueCount, *text);
+    });
+}
+
 ALTERNET_UI_API void PropertyGrid_SetEventCallback_(PropertyGrid::PropertyGridEventCallbackType callback)
 {
     PropertyGrid::SetEventCallback(callback);
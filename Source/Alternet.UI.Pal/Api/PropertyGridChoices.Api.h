@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API PropertyGridChoices* PropertyGridChoices_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_Create_");
     return MarshalExceptions<PropertyGridChoices*>([&](){
         return new PropertyGridChoices();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API PropertyGridChoices* PropertyGridChoices_Create_()
 
 ALTERNET_UI_API void* PropertyGridChoices_CreatePropertyGridChoices_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_CreatePropertyGridChoices_");
     return MarshalExceptions<void*>([&](){
         return PropertyGridChoices::CreatePropertyGridChoices();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API void* PropertyGridChoices_CreatePropertyGridChoices_()
 
 ALTERNET_UI_API void PropertyGridChoices_Delete_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_Delete_");
     MarshalExceptions<void>([&](){
         PropertyGridChoices::Delete(handle);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void PropertyGridChoices_Delete_(void* handle)
 
 ALTERNET_UI_API void PropertyGridChoices_Add_(void* handle, NativeStringSpan* text, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_Add_");
     MarshalExceptions<void>([&](){
         PropertyGridChoices::Add(handle, *text, value);
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API void PropertyGridChoices_Add_(void* handle, NativeStringSpan* te
 
 ALTERNET_UI_API void PropertyGridChoices_SetLabel_(void* handle, uint32_t ind, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_SetLabel_");
     MarshalExceptions<void>([&](){
         PropertyGridChoices::SetLabel(handle, ind, *value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void PropertyGridChoices_SetLabel_(void* handle, uint32_t ind, N
 
 ALTERNET_UI_API void PropertyGridChoices_SetFgCol_(void* handle, uint32_t ind, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_SetFgCol_");
     MarshalExceptions<void>([&](){
         PropertyGridChoices::SetFgCol(handle, ind, *color);
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API void PropertyGridChoices_SetFgCol_(void* handle, uint32_t ind, C
 
 ALTERNET_UI_API void PropertyGridChoices_SetBgCol_(void* handle, uint32_t ind, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_SetBgCol_");
     MarshalExceptions<void>([&](){
         PropertyGridChoices::SetBgCol(handle, ind, *color);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void PropertyGridChoices_SetBgCol_(void* handle, uint32_t ind, C
 
 ALTERNET_UI_API Color_C PropertyGridChoices_GetFgCol_(void* handle, uint32_t ind)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_GetFgCol_");
     return MarshalExceptions<Color_C>([&](){
         return PropertyGridChoices::GetFgCol(handle, ind);
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API Color_C PropertyGridChoices_GetFgCol_(void* handle, uint32_t ind
 
 ALTERNET_UI_API Color_C PropertyGridChoices_GetBgCol_(void* handle, uint32_t ind)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_GetBgCol_");
     return MarshalExceptions<Color_C>([&](){
         return PropertyGridChoices::GetBgCol(handle, ind);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API Color_C PropertyGridChoices_GetBgCol_(void* handle, uint32_t ind
 
 ALTERNET_UI_API void* PropertyGridChoices_GetBitmap_(void* handle, uint32_t ind)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_GetBitmap_");
     return MarshalExceptions<void*>([&](){
         return PropertyGridChoices::GetBitmap(handle, ind);
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API void* PropertyGridChoices_GetBitmap_(void* handle, uint32_t ind)
 
 ALTERNET_UI_API void PropertyGridChoices_SetBitmapFromItem_(void* handle, uint32_t ind, void* handle2, uint32_t ind2)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_SetBitmapFromItem_");
     MarshalExceptions<void>([&](){
         PropertyGridChoices::SetBitmapFromItem(handle, ind, handle2, ind2);
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API void PropertyGridChoices_SetBitmapFromItem_(void* handle, uint32
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGridChoices_GetLabel_(void* handle, uint32_t ind)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_GetLabel_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return PropertyGridChoices::GetLabel(handle, ind);
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGridChoices_GetLabel_(void* handle, u
 
 ALTERNET_UI_API uint32_t PropertyGridChoices_GetCount_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_GetCount_");
     return MarshalExceptions<uint32_t>([&](){
         return PropertyGridChoices::GetCount(handle);
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API uint32_t PropertyGridChoices_GetCount_(void* handle)
 
 ALTERNET_UI_API int PropertyGridChoices_GetValue_(void* handle, uint32_t ind)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_GetValue_");
     return MarshalExceptions<int>([&](){
         return PropertyGridChoices::GetValue(handle, ind);
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API int PropertyGridChoices_GetValue_(void* handle, uint32_t ind)
 
 ALTERNET_UI_API int PropertyGridChoices_GetLabelIndex_(void* handle, NativeStringSpan* str)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_GetLabelIndex_");
     return MarshalExceptions<int>([&](){
         return PropertyGridChoices::GetLabelIndex(handle, *str);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API int PropertyGridChoices_GetLabelIndex_(void* handle, NativeStrin
 
 ALTERNET_UI_API int PropertyGridChoices_GetValueIndex_(void* handle, int val)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_GetValueIndex_");
     return MarshalExceptions<int>([&](){
         return PropertyGridChoices::GetValueIndex(handle, val);
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API int PropertyGridChoices_GetValueIndex_(void* handle, int val)
 
 ALTERNET_UI_API void PropertyGridChoices_Insert_(void* handle, int index, NativeStringSpan* text, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_Insert_");
     MarshalExceptions<void>([&](){
         PropertyGridChoices::Insert(handle, index, *text, value);
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API void PropertyGridChoices_Insert_(void* handle, int index, Native
 
 ALTERNET_UI_API c_bool PropertyGridChoices_IsOk_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_IsOk_");
     return MarshalExceptions<c_bool>([&](){
         return PropertyGridChoices::IsOk(handle);
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API c_bool PropertyGridChoices_IsOk_(void* handle)
 
 ALTERNET_UI_API void PropertyGridChoices_RemoveAt_(void* handle, uint64_t nIndex, uint64_t count)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_RemoveAt_");
     MarshalExceptions<void>([&](){
         PropertyGridChoices::RemoveAt(handle, nIndex, count);
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API void PropertyGridChoices_RemoveAt_(void* handle, uint64_t nIndex
 
 ALTERNET_UI_API void PropertyGridChoices_Clear_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridChoices_Clear_");
     MarshalExceptions<void>([&](){
         PropertyGridChoices::Clear(handle);
     });
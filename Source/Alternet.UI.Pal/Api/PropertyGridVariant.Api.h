@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API PropertyGridVariant* PropertyGridVariant_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_Create_");
     return MarshalExceptions<PropertyGridVariant*>([&](){
         return new PropertyGridVariant();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API PropertyGridVariant* PropertyGridVariant_Create_()
 
 ALTERNET_UI_API void PropertyGridVariant_Delete_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_Delete_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::Delete(handle);
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API void PropertyGridVariant_Delete_(void* handle)
 
 ALTERNET_UI_API void* PropertyGridVariant_CreateVariant_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_CreateVariant_");
     return MarshalExceptions<void*>([&](){
         return PropertyGridVariant::CreateVariant();
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void* PropertyGridVariant_CreateVariant_()
 
 ALTERNET_UI_API c_bool PropertyGridVariant_IsNull_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_IsNull_");
     return MarshalExceptions<c_bool>([&](){
         return PropertyGridVariant::IsNull(handle);
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API c_bool PropertyGridVariant_IsNull_(void* handle)
 
 ALTERNET_UI_API c_bool PropertyGridVariant_Unshare_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_Unshare_");
     return MarshalExceptions<c_bool>([&](){
         return PropertyGridVariant::Unshare(handle);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API c_bool PropertyGridVariant_Unshare_(void* handle)
 
 ALTERNET_UI_API void PropertyGridVariant_MakeNull_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_MakeNull_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::MakeNull(handle);
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API void PropertyGridVariant_MakeNull_(void* handle)
 
 ALTERNET_UI_API void PropertyGridVariant_Clear_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_Clear_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::Clear(handle);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void PropertyGridVariant_Clear_(void* handle)
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGridVariant_GetValueType_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetValueType_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return PropertyGridVariant::GetValueType(handle);
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGridVariant_GetValueType_(void* handl
 
 ALTERNET_UI_API c_bool PropertyGridVariant_IsType_(void* handle, NativeStringSpan* type)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_IsType_");
     return MarshalExceptions<c_bool>([&](){
         return PropertyGridVariant::IsType(handle, *type);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API c_bool PropertyGridVariant_IsType_(void* handle, NativeStringSpa
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGridVariant_MakeString_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_MakeString_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return PropertyGridVariant::MakeString(handle);
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGridVariant_MakeString_(void* handle)
 
 ALTERNET_UI_API Color_C PropertyGridVariant_GetColor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetColor_");
     return MarshalExceptions<Color_C>([&](){
         return PropertyGridVariant::GetColor(handle);
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API Color_C PropertyGridVariant_GetColor_(void* handle)
 
 ALTERNET_UI_API double PropertyGridVariant_GetDouble_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetDouble_");
     return MarshalExceptions<double>([&](){
         return PropertyGridVariant::GetDouble(handle);
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API double PropertyGridVariant_GetDouble_(void* handle)
 
 ALTERNET_UI_API c_bool PropertyGridVariant_GetBool_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetBool_");
     return MarshalExceptions<c_bool>([&](){
         return PropertyGridVariant::GetBool(handle);
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API c_bool PropertyGridVariant_GetBool_(void* handle)
 
 ALTERNET_UI_API int PropertyGridVariant_GetInt_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetInt_");
     return MarshalExceptions<int>([&](){
         return PropertyGridVariant::GetInt(handle);
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API int PropertyGridVariant_GetInt_(void* handle)
 
 ALTERNET_UI_API uint32_t PropertyGridVariant_GetUInt_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetUInt_");
     return MarshalExceptions<uint32_t>([&](){
         return PropertyGridVariant::GetUInt(handle);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API uint32_t PropertyGridVariant_GetUInt_(void* handle)
 
 ALTERNET_UI_API int64_t PropertyGridVariant_GetLong_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetLong_");
     return MarshalExceptions<int64_t>([&](){
         return PropertyGridVariant::GetLong(handle);
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API int64_t PropertyGridVariant_GetLong_(void* handle)
 
 ALTERNET_UI_API uint64_t PropertyGridVariant_GetULong_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetULong_");
     return MarshalExceptions<uint64_t>([&](){
         return PropertyGridVariant::GetULong(handle);
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API uint64_t PropertyGridVariant_GetULong_(void* handle)
 
 ALTERNET_UI_API DateTime_C PropertyGridVariant_GetDateTime_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetDateTime_");
     return MarshalExceptions<DateTime_C>([&](){
         return PropertyGridVariant::GetDateTime(handle);
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API DateTime_C PropertyGridVariant_GetDateTime_(void* handle)
 
 ALTERNET_UI_API NativeStringSpan_C PropertyGridVariant_GetString_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetString_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return PropertyGridVariant::GetString(handle);
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API NativeStringSpan_C PropertyGridVariant_GetString_(void* handle)
 
 ALTERNET_UI_API void PropertyGridVariant_SetColor_(void* handle, Color* val, uint32_t kind)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetColor_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetColor(handle, *val, kind);
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API void PropertyGridVariant_SetColor_(void* handle, Color* val, uin
 
 ALTERNET_UI_API void PropertyGridVariant_SetDouble_(void* handle, double val)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetDouble_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetDouble(handle, val);
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API void PropertyGridVariant_SetDouble_(void* handle, double val)
 
 ALTERNET_UI_API void PropertyGridVariant_SetBool_(void* handle, c_bool val)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetBool_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetBool(handle, val);
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API void PropertyGridVariant_SetBool_(void* handle, c_bool val)
 
 ALTERNET_UI_API void PropertyGridVariant_SetLong_(void* handle, int64_t val)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetLong_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetLong(handle, val);
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API void PropertyGridVariant_SetLong_(void* handle, int64_t val)
 
 ALTERNET_UI_API void PropertyGridVariant_SetULong_(void* handle, uint64_t val)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetULong_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetULong(handle, val);
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API void PropertyGridVariant_SetULong_(void* handle, uint64_t val)
 
 ALTERNET_UI_API void PropertyGridVariant_SetInt_(void* handle, int val)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetInt_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetInt(handle, val);
     });
@@ -185,6 +210,7 @@ ALTERNET_UI_API void PropertyGridVariant_SetInt_(void* handle, int val)
 
 ALTERNET_UI_API void PropertyGridVariant_SetUInt_(void* handle, uint32_t val)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetUInt_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetUInt(handle, val);
     });
@@ -192,6 +218,7 @@ ALTERNET_UI_API void PropertyGridVariant_SetUInt_(void* handle, uint32_t val)
 
 ALTERNET_UI_API void PropertyGridVariant_SetShort_(void* handle, int16_t val)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetShort_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetShort(handle, val);
     });
@@ -199,6 +226,7 @@ ALTERNET_UI_API void PropertyGridVariant_SetShort_(void* handle, int16_t val)
 
 ALTERNET_UI_API void PropertyGridVariant_SetDateTime_(void* handle, DateTime* val)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetDateTime_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetDateTime(handle, *val);
     });
@@ -206,6 +234,7 @@ ALTERNET_UI_API void PropertyGridVariant_SetDateTime_(void* handle, DateTime* va
 
 ALTERNET_UI_API void PropertyGridVariant_SetString_(void* handle, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetString_");
     MarshalExceptions<void>([&](){
         PropertyGridVariant::SetString(handle, *value);
     });
@@ -213,8 +242,25 @@ ALTERNET_UI_API void PropertyGridVariant_SetString_(void* handle, NativeStringSp
 
 ALTERNET_UI_API uint32_t PropertyGridVariant_GetLastColorKind_()
 {
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetLastColorKind_");
     return MarshalExceptions<uint32_t>([&](){
         return PropertyGridVariant::GetLastColorKind();
     });
 }
 
+ALTERNET_UI_API NativeStringSpan_C PropertyGridVariant_GetInline_(void* handle, int64_t* value, int valueCount)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_GetInline_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return PropertyGridVariant::GetInline(handle, value, valueCount);
+    });
+}
+
+ALTERNET_UI_API void PropertyGridVariant_SetInline_(void* handle, int64_t* value, int valueCount, NativeStringSpan* text)
+{
+    ALTERNET_UI_PERF_EXPORT("PropertyGridVariant_SetInline_");
+    MarshalExceptions<void>([&](){
+        PropertyGridVariant::SetInline(handle, value, valueCount, *text);
+    });
+}
+
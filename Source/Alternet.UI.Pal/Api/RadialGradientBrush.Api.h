@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API RadialGradientBrush* RadialGradientBrush_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("RadialGradientBrush_Create_");
     return MarshalExceptions<RadialGradientBrush*>([&](){
         return new RadialGradientBrush();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API RadialGradientBrush* RadialGradientBrush_Create_()
 
 ALTERNET_UI_API void RadialGradientBrush_Initialize_(RadialGradientBrush* obj, PointD* center, float radius, PointD* gradientOrigin, Color* gradientStopsColors, int gradientStopsColorsCount, float* gradientStopsOffsets, int gradientStopsOffsetsCount)
 {
+    ALTERNET_UI_PERF_EXPORT("RadialGradientBrush_Initialize_");
     MarshalExceptions<void>([&](){
         obj->Initialize(*center, radius, *gradientOrigin, gradientStopsColors, gradientStopsColorsCount, gradientStopsOffsets, gradientStopsOffsetsCount);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API RadioButton* RadioButton_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("RadioButton_Create_");
     return MarshalExceptions<RadioButton*>([&](){
         return new RadioButton();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API RadioButton* RadioButton_Create_()
 
 ALTERNET_UI_API c_bool RadioButton_GetIsChecked_(RadioButton* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RadioButton_GetIsChecked_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsChecked();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API c_bool RadioButton_GetIsChecked_(RadioButton* obj)
 
 ALTERNET_UI_API void RadioButton_SetIsChecked_(RadioButton* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("RadioButton_SetIsChecked_");
     MarshalExceptions<void>([&](){
         obj->SetIsChecked(value);
     });
@@ -13,6 +13,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API RichTextBox* RichTextBox_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Create_");
     return MarshalExceptions<RichTextBox*>([&](){
         return new RichTextBox();
     });
@@ -20,6 +21,7 @@ ALTERNET_UI_API RichTextBox* RichTextBox_Create_()
 
 ALTERNET_UI_API c_bool RichTextBox_GetHasBorder_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -27,6 +29,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetHasBorder_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetHasBorder_(RichTextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -34,6 +37,7 @@ ALTERNET_UI_API void RichTextBox_SetHasBorder_(RichTextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool RichTextBox_LoadFromStream_(RichTextBox* obj, void* stream, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_LoadFromStream_");
     return MarshalExceptions<c_bool>([&](){
         return obj->LoadFromStream(stream, type);
     });
@@ -41,6 +45,7 @@ ALTERNET_UI_API c_bool RichTextBox_LoadFromStream_(RichTextBox* obj, void* strea
 
 ALTERNET_UI_API c_bool RichTextBox_SaveToStream_(RichTextBox* obj, void* stream, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SaveToStream_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SaveToStream(stream, type);
     });
@@ -48,6 +53,7 @@ ALTERNET_UI_API c_bool RichTextBox_SaveToStream_(RichTextBox* obj, void* stream,
 
 ALTERNET_UI_API c_bool RichTextBox_ApplyStyleToSelection_(RichTextBox* obj, void* style, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ApplyStyleToSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ApplyStyleToSelection(style, flags);
     });
@@ -55,6 +61,7 @@ ALTERNET_UI_API c_bool RichTextBox_ApplyStyleToSelection_(RichTextBox* obj, void
 
 ALTERNET_UI_API void RichTextBox_InitFileHandlers_()
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_InitFileHandlers_");
     MarshalExceptions<void>([&](){
         RichTextBox::InitFileHandlers();
     });
@@ -62,6 +69,7 @@ ALTERNET_UI_API void RichTextBox_InitFileHandlers_()
 
 ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetReportedUrl_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetReportedUrl_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetReportedUrl();
     });
@@ -69,6 +77,7 @@ ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetReportedUrl_(RichTextBox* obj)
 
 ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetRange_(RichTextBox* obj, int64_t from, int64_t to)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetRange_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetRange(from, to);
     });
@@ -76,6 +85,7 @@ ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetRange_(RichTextBox* obj, int64
 
 ALTERNET_UI_API int RichTextBox_GetLineLength_(RichTextBox* obj, int64_t lineNo)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetLineLength_");
     return MarshalExceptions<int>([&](){
         return obj->GetLineLength(lineNo);
     });
@@ -83,6 +93,7 @@ ALTERNET_UI_API int RichTextBox_GetLineLength_(RichTextBox* obj, int64_t lineNo)
 
 ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetLineText_(RichTextBox* obj, int64_t lineNo)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetLineText_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetLineText(lineNo);
     });
@@ -90,6 +101,7 @@ ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetLineText_(RichTextBox* obj, in
 
 ALTERNET_UI_API int RichTextBox_GetNumberOfLines_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetNumberOfLines_");
     return MarshalExceptions<int>([&](){
         return obj->GetNumberOfLines();
     });
@@ -97,6 +109,7 @@ ALTERNET_UI_API int RichTextBox_GetNumberOfLines_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_IsModified_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsModified_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsModified();
     });
@@ -104,6 +117,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsModified_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_IsEditable_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsEditable_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsEditable();
     });
@@ -111,6 +125,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsEditable_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_IsSingleLine_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsSingleLine_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsSingleLine();
     });
@@ -118,6 +133,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsSingleLine_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_IsMultiLine_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsMultiLine_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsMultiLine();
     });
@@ -125,6 +141,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsMultiLine_(RichTextBox* obj)
 
 ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetStringSelection_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStringSelection_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetStringSelection();
     });
@@ -132,6 +149,7 @@ ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetStringSelection_(RichTextBox*
 
 ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetFilename_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetFilename_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetFilename();
     });
@@ -139,6 +157,7 @@ ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetFilename_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetFilename_(RichTextBox* obj, NativeStringSpan* filename)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetFilename_");
     MarshalExceptions<void>([&](){
         obj->SetFilename(*filename);
     });
@@ -146,6 +165,7 @@ ALTERNET_UI_API void RichTextBox_SetFilename_(RichTextBox* obj, NativeStringSpan
 
 ALTERNET_UI_API void RichTextBox_SetDelayedLayoutThreshold_(RichTextBox* obj, int64_t threshold)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetDelayedLayoutThreshold_");
     MarshalExceptions<void>([&](){
         obj->SetDelayedLayoutThreshold(threshold);
     });
@@ -153,6 +173,7 @@ ALTERNET_UI_API void RichTextBox_SetDelayedLayoutThreshold_(RichTextBox* obj, in
 
 ALTERNET_UI_API int64_t RichTextBox_GetDelayedLayoutThreshold_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetDelayedLayoutThreshold_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetDelayedLayoutThreshold();
     });
@@ -160,6 +181,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetDelayedLayoutThreshold_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_GetFullLayoutRequired_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetFullLayoutRequired_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetFullLayoutRequired();
     });
@@ -167,6 +189,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetFullLayoutRequired_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetFullLayoutRequired_(RichTextBox* obj, c_bool b)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetFullLayoutRequired_");
     MarshalExceptions<void>([&](){
         obj->SetFullLayoutRequired(b);
     });
@@ -174,6 +197,7 @@ ALTERNET_UI_API void RichTextBox_SetFullLayoutRequired_(RichTextBox* obj, c_bool
 
 ALTERNET_UI_API int64_t RichTextBox_GetFullLayoutTime_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetFullLayoutTime_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetFullLayoutTime();
     });
@@ -181,6 +205,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetFullLayoutTime_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetFullLayoutTime_(RichTextBox* obj, int64_t t)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetFullLayoutTime_");
     MarshalExceptions<void>([&](){
         obj->SetFullLayoutTime(t);
     });
@@ -188,6 +213,7 @@ ALTERNET_UI_API void RichTextBox_SetFullLayoutTime_(RichTextBox* obj, int64_t t)
 
 ALTERNET_UI_API int64_t RichTextBox_GetFullLayoutSavedPosition_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetFullLayoutSavedPosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetFullLayoutSavedPosition();
     });
@@ -195,6 +221,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetFullLayoutSavedPosition_(RichTextBox* obj
 
 ALTERNET_UI_API void RichTextBox_SetFullLayoutSavedPosition_(RichTextBox* obj, int64_t p)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetFullLayoutSavedPosition_");
     MarshalExceptions<void>([&](){
         obj->SetFullLayoutSavedPosition(p);
     });
@@ -202,6 +229,7 @@ ALTERNET_UI_API void RichTextBox_SetFullLayoutSavedPosition_(RichTextBox* obj, i
 
 ALTERNET_UI_API void RichTextBox_ForceDelayedLayout_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ForceDelayedLayout_");
     MarshalExceptions<void>([&](){
         obj->ForceDelayedLayout();
     });
@@ -209,6 +237,7 @@ ALTERNET_UI_API void RichTextBox_ForceDelayedLayout_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_GetCaretAtLineStart_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetCaretAtLineStart_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCaretAtLineStart();
     });
@@ -216,6 +245,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetCaretAtLineStart_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetCaretAtLineStart_(RichTextBox* obj, c_bool atStart)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetCaretAtLineStart_");
     MarshalExceptions<void>([&](){
         obj->SetCaretAtLineStart(atStart);
     });
@@ -223,6 +253,7 @@ ALTERNET_UI_API void RichTextBox_SetCaretAtLineStart_(RichTextBox* obj, c_bool a
 
 ALTERNET_UI_API c_bool RichTextBox_GetDragging_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetDragging_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetDragging();
     });
@@ -230,6 +261,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetDragging_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetDragging_(RichTextBox* obj, c_bool dragging)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetDragging_");
     MarshalExceptions<void>([&](){
         obj->SetDragging(dragging);
     });
@@ -237,6 +269,7 @@ ALTERNET_UI_API void RichTextBox_SetDragging_(RichTextBox* obj, c_bool dragging)
 
 ALTERNET_UI_API void* RichTextBox_GetContextMenu_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetContextMenu_");
     return MarshalExceptions<void*>([&](){
         return obj->GetContextMenu();
     });
@@ -244,6 +277,7 @@ ALTERNET_UI_API void* RichTextBox_GetContextMenu_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetContextMenu_(RichTextBox* obj, void* menu)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetContextMenu_");
     MarshalExceptions<void>([&](){
         obj->SetContextMenu(menu);
     });
@@ -251,6 +285,7 @@ ALTERNET_UI_API void RichTextBox_SetContextMenu_(RichTextBox* obj, void* menu)
 
 ALTERNET_UI_API int64_t RichTextBox_GetSelectionAnchor_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetSelectionAnchor_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetSelectionAnchor();
     });
@@ -258,6 +293,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetSelectionAnchor_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetSelectionAnchor_(RichTextBox* obj, int64_t anchor)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetSelectionAnchor_");
     MarshalExceptions<void>([&](){
         obj->SetSelectionAnchor(anchor);
     });
@@ -265,6 +301,7 @@ ALTERNET_UI_API void RichTextBox_SetSelectionAnchor_(RichTextBox* obj, int64_t a
 
 ALTERNET_UI_API void* RichTextBox_GetSelectionAnchorObject_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetSelectionAnchorObject_");
     return MarshalExceptions<void*>([&](){
         return obj->GetSelectionAnchorObject();
     });
@@ -272,6 +309,7 @@ ALTERNET_UI_API void* RichTextBox_GetSelectionAnchorObject_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetSelectionAnchorObject_(RichTextBox* obj, void* anchor)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetSelectionAnchorObject_");
     MarshalExceptions<void>([&](){
         obj->SetSelectionAnchorObject(anchor);
     });
@@ -279,6 +317,7 @@ ALTERNET_UI_API void RichTextBox_SetSelectionAnchorObject_(RichTextBox* obj, voi
 
 ALTERNET_UI_API void* RichTextBox_GetFocusObject_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetFocusObject_");
     return MarshalExceptions<void*>([&](){
         return obj->GetFocusObject();
     });
@@ -286,6 +325,7 @@ ALTERNET_UI_API void* RichTextBox_GetFocusObject_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_StoreFocusObject_(RichTextBox* obj, void* richObj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_StoreFocusObject_");
     MarshalExceptions<void>([&](){
         obj->StoreFocusObject(richObj);
     });
@@ -293,6 +333,7 @@ ALTERNET_UI_API void RichTextBox_StoreFocusObject_(RichTextBox* obj, void* richO
 
 ALTERNET_UI_API c_bool RichTextBox_SetFocusObject_(RichTextBox* obj, void* richObj, c_bool setCaretPosition)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetFocusObject_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetFocusObject(richObj, setCaretPosition);
     });
@@ -300,6 +341,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetFocusObject_(RichTextBox* obj, void* richO
 
 ALTERNET_UI_API void RichTextBox_Invalidate_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Invalidate_");
     MarshalExceptions<void>([&](){
         obj->Invalidate();
     });
@@ -307,6 +349,7 @@ ALTERNET_UI_API void RichTextBox_Invalidate_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_Clear_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Clear_");
     MarshalExceptions<void>([&](){
         obj->Clear();
     });
@@ -314,6 +357,7 @@ ALTERNET_UI_API void RichTextBox_Clear_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_Replace_(RichTextBox* obj, int64_t from, int64_t to, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Replace_");
     MarshalExceptions<void>([&](){
         obj->Replace(from, to, *value);
     });
@@ -321,6 +365,7 @@ ALTERNET_UI_API void RichTextBox_Replace_(RichTextBox* obj, int64_t from, int64_
 
 ALTERNET_UI_API void RichTextBox_Remove_(RichTextBox* obj, int64_t from, int64_t to)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Remove_");
     MarshalExceptions<void>([&](){
         obj->Remove(from, to);
     });
@@ -328,6 +373,7 @@ ALTERNET_UI_API void RichTextBox_Remove_(RichTextBox* obj, int64_t from, int64_t
 
 ALTERNET_UI_API c_bool RichTextBox_LoadFile_(RichTextBox* obj, NativeStringSpan* file, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_LoadFile_");
     return MarshalExceptions<c_bool>([&](){
         return obj->LoadFile(*file, type);
     });
@@ -335,6 +381,7 @@ ALTERNET_UI_API c_bool RichTextBox_LoadFile_(RichTextBox* obj, NativeStringSpan*
 
 ALTERNET_UI_API c_bool RichTextBox_SaveFile_(RichTextBox* obj, NativeStringSpan* file, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SaveFile_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SaveFile(*file, type);
     });
@@ -342,6 +389,7 @@ ALTERNET_UI_API c_bool RichTextBox_SaveFile_(RichTextBox* obj, NativeStringSpan*
 
 ALTERNET_UI_API void RichTextBox_SetHandlerFlags_(RichTextBox* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetHandlerFlags_");
     MarshalExceptions<void>([&](){
         obj->SetHandlerFlags(flags);
     });
@@ -349,6 +397,7 @@ ALTERNET_UI_API void RichTextBox_SetHandlerFlags_(RichTextBox* obj, int flags)
 
 ALTERNET_UI_API int RichTextBox_GetHandlerFlags_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetHandlerFlags_");
     return MarshalExceptions<int>([&](){
         return obj->GetHandlerFlags();
     });
@@ -356,6 +405,7 @@ ALTERNET_UI_API int RichTextBox_GetHandlerFlags_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_MarkDirty_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MarkDirty_");
     MarshalExceptions<void>([&](){
         obj->MarkDirty();
     });
@@ -363,6 +413,7 @@ ALTERNET_UI_API void RichTextBox_MarkDirty_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_DiscardEdits_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_DiscardEdits_");
     MarshalExceptions<void>([&](){
         obj->DiscardEdits();
     });
@@ -370,6 +421,7 @@ ALTERNET_UI_API void RichTextBox_DiscardEdits_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetMaxLength_(RichTextBox* obj, uint64_t len)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetMaxLength_");
     MarshalExceptions<void>([&](){
         obj->SetMaxLength(len);
     });
@@ -377,6 +429,7 @@ ALTERNET_UI_API void RichTextBox_SetMaxLength_(RichTextBox* obj, uint64_t len)
 
 ALTERNET_UI_API void RichTextBox_WriteText_(RichTextBox* obj, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_WriteText_");
     MarshalExceptions<void>([&](){
         obj->WriteText(*text);
     });
@@ -384,6 +437,7 @@ ALTERNET_UI_API void RichTextBox_WriteText_(RichTextBox* obj, NativeStringSpan*
 
 ALTERNET_UI_API void RichTextBox_AppendText_(RichTextBox* obj, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_AppendText_");
     MarshalExceptions<void>([&](){
         obj->AppendText(*text);
     });
@@ -391,6 +445,7 @@ ALTERNET_UI_API void RichTextBox_AppendText_(RichTextBox* obj, NativeStringSpan*
 
 ALTERNET_UI_API int64_t RichTextBox_XYToPosition_(RichTextBox* obj, int64_t x, int64_t y)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_XYToPosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->XYToPosition(x, y);
     });
@@ -398,6 +453,7 @@ ALTERNET_UI_API int64_t RichTextBox_XYToPosition_(RichTextBox* obj, int64_t x, i
 
 ALTERNET_UI_API void RichTextBox_ShowPosition_(RichTextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ShowPosition_");
     MarshalExceptions<void>([&](){
         obj->ShowPosition(pos);
     });
@@ -405,6 +461,7 @@ ALTERNET_UI_API void RichTextBox_ShowPosition_(RichTextBox* obj, int64_t pos)
 
 ALTERNET_UI_API void RichTextBox_Copy_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Copy_");
     MarshalExceptions<void>([&](){
         obj->Copy();
     });
@@ -412,6 +469,7 @@ ALTERNET_UI_API void RichTextBox_Copy_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_Cut_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Cut_");
     MarshalExceptions<void>([&](){
         obj->Cut();
     });
@@ -419,6 +477,7 @@ ALTERNET_UI_API void RichTextBox_Cut_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_Paste_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Paste_");
     MarshalExceptions<void>([&](){
         obj->Paste();
     });
@@ -426,6 +485,7 @@ ALTERNET_UI_API void RichTextBox_Paste_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_DeleteSelection_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_DeleteSelection_");
     MarshalExceptions<void>([&](){
         obj->DeleteSelection();
     });
@@ -433,6 +493,7 @@ ALTERNET_UI_API void RichTextBox_DeleteSelection_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_CanCopy_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CanCopy_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanCopy();
     });
@@ -440,6 +501,7 @@ ALTERNET_UI_API c_bool RichTextBox_CanCopy_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_CanCut_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CanCut_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanCut();
     });
@@ -447,6 +509,7 @@ ALTERNET_UI_API c_bool RichTextBox_CanCut_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_CanPaste_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CanPaste_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanPaste();
     });
@@ -454,6 +517,7 @@ ALTERNET_UI_API c_bool RichTextBox_CanPaste_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_CanDeleteSelection_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CanDeleteSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanDeleteSelection();
     });
@@ -461,6 +525,7 @@ ALTERNET_UI_API c_bool RichTextBox_CanDeleteSelection_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_Undo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Undo_");
     MarshalExceptions<void>([&](){
         obj->Undo();
     });
@@ -468,6 +533,7 @@ ALTERNET_UI_API void RichTextBox_Undo_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_Redo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Redo_");
     MarshalExceptions<void>([&](){
         obj->Redo();
     });
@@ -475,6 +541,7 @@ ALTERNET_UI_API void RichTextBox_Redo_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_CanUndo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CanUndo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanUndo();
     });
@@ -482,6 +549,7 @@ ALTERNET_UI_API c_bool RichTextBox_CanUndo_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_CanRedo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CanRedo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanRedo();
     });
@@ -489,6 +557,7 @@ ALTERNET_UI_API c_bool RichTextBox_CanRedo_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetInsertionPoint_(RichTextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetInsertionPoint_");
     MarshalExceptions<void>([&](){
         obj->SetInsertionPoint(pos);
     });
@@ -496,6 +565,7 @@ ALTERNET_UI_API void RichTextBox_SetInsertionPoint_(RichTextBox* obj, int64_t po
 
 ALTERNET_UI_API void RichTextBox_SetInsertionPointEnd_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetInsertionPointEnd_");
     MarshalExceptions<void>([&](){
         obj->SetInsertionPointEnd();
     });
@@ -503,6 +573,7 @@ ALTERNET_UI_API void RichTextBox_SetInsertionPointEnd_(RichTextBox* obj)
 
 ALTERNET_UI_API int64_t RichTextBox_GetInsertionPoint_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetInsertionPoint_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetInsertionPoint();
     });
@@ -510,6 +581,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetInsertionPoint_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetSelection_(RichTextBox* obj, int64_t from, int64_t to)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetSelection_");
     MarshalExceptions<void>([&](){
         obj->SetSelection(from, to);
     });
@@ -517,6 +589,7 @@ ALTERNET_UI_API void RichTextBox_SetSelection_(RichTextBox* obj, int64_t from, i
 
 ALTERNET_UI_API void RichTextBox_SetEditable_(RichTextBox* obj, c_bool editable)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetEditable_");
     MarshalExceptions<void>([&](){
         obj->SetEditable(editable);
     });
@@ -524,6 +597,7 @@ ALTERNET_UI_API void RichTextBox_SetEditable_(RichTextBox* obj, c_bool editable)
 
 ALTERNET_UI_API c_bool RichTextBox_HasSelection_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_HasSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->HasSelection();
     });
@@ -531,6 +605,7 @@ ALTERNET_UI_API c_bool RichTextBox_HasSelection_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_HasUnfocusedSelection_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_HasUnfocusedSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->HasUnfocusedSelection();
     });
@@ -538,6 +613,7 @@ ALTERNET_UI_API c_bool RichTextBox_HasUnfocusedSelection_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_Newline_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Newline_");
     return MarshalExceptions<c_bool>([&](){
         return obj->Newline();
     });
@@ -545,6 +621,7 @@ ALTERNET_UI_API c_bool RichTextBox_Newline_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_LineBreak_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_LineBreak_");
     return MarshalExceptions<c_bool>([&](){
         return obj->LineBreak();
     });
@@ -552,6 +629,7 @@ ALTERNET_UI_API c_bool RichTextBox_LineBreak_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_EndStyle_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndStyle();
     });
@@ -559,6 +637,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndStyle_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_EndAllStyles_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndAllStyles_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndAllStyles();
     });
@@ -566,6 +645,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndAllStyles_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginBold_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginBold_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginBold();
     });
@@ -573,6 +653,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginBold_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_EndBold_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndBold_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndBold();
     });
@@ -580,6 +661,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndBold_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginItalic_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginItalic_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginItalic();
     });
@@ -587,6 +669,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginItalic_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_EndItalic_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndItalic_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndItalic();
     });
@@ -594,6 +677,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndItalic_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginUnderline_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginUnderline_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginUnderline();
     });
@@ -601,6 +685,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginUnderline_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_EndUnderline_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndUnderline_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndUnderline();
     });
@@ -608,6 +693,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndUnderline_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginFontSize_(RichTextBox* obj, int pointSize)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginFontSize_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginFontSize(pointSize);
     });
@@ -615,6 +701,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginFontSize_(RichTextBox* obj, int pointSiz
 
 ALTERNET_UI_API c_bool RichTextBox_EndFontSize_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndFontSize_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndFontSize();
     });
@@ -622,6 +709,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndFontSize_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginFontRef_(RichTextBox* obj, void* font)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginFontRef_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginFontRef(font);
     });
@@ -629,6 +717,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginFontRef_(RichTextBox* obj, void* font)
 
 ALTERNET_UI_API c_bool RichTextBox_EndFont_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndFont_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndFont();
     });
@@ -636,6 +725,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndFont_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginTextColour_(RichTextBox* obj, Color* colour)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginTextColour_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginTextColour(*colour);
     });
@@ -643,6 +733,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginTextColour_(RichTextBox* obj, Color* col
 
 ALTERNET_UI_API c_bool RichTextBox_EndTextColour_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndTextColour_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndTextColour();
     });
@@ -650,6 +741,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndTextColour_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginAlignment_(RichTextBox* obj, int alignment)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginAlignment_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginAlignment(alignment);
     });
@@ -657,6 +749,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginAlignment_(RichTextBox* obj, int alignme
 
 ALTERNET_UI_API c_bool RichTextBox_EndAlignment_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndAlignment_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndAlignment();
     });
@@ -664,6 +757,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndAlignment_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginLeftIndent_(RichTextBox* obj, int leftIndent, int leftSubIndent)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginLeftIndent_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginLeftIndent(leftIndent, leftSubIndent);
     });
@@ -671,6 +765,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginLeftIndent_(RichTextBox* obj, int leftIn
 
 ALTERNET_UI_API c_bool RichTextBox_EndLeftIndent_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndLeftIndent_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndLeftIndent();
     });
@@ -678,6 +773,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndLeftIndent_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginRightIndent_(RichTextBox* obj, int rightIndent)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginRightIndent_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginRightIndent(rightIndent);
     });
@@ -685,6 +781,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginRightIndent_(RichTextBox* obj, int right
 
 ALTERNET_UI_API c_bool RichTextBox_EndRightIndent_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndRightIndent_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndRightIndent();
     });
@@ -692,6 +789,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndRightIndent_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginParagraphSpacing_(RichTextBox* obj, int before, int after)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginParagraphSpacing_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginParagraphSpacing(before, after);
     });
@@ -699,6 +797,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginParagraphSpacing_(RichTextBox* obj, int
 
 ALTERNET_UI_API c_bool RichTextBox_EndParagraphSpacing_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndParagraphSpacing_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndParagraphSpacing();
     });
@@ -706,6 +805,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndParagraphSpacing_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginLineSpacing_(RichTextBox* obj, int lineSpacing)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginLineSpacing_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginLineSpacing(lineSpacing);
     });
@@ -713,6 +813,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginLineSpacing_(RichTextBox* obj, int lineS
 
 ALTERNET_UI_API c_bool RichTextBox_EndLineSpacing_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndLineSpacing_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndLineSpacing();
     });
@@ -720,6 +821,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndLineSpacing_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginNumberedBullet_(RichTextBox* obj, int bulletNumber, int leftIndent, int leftSubIndent, int bulletStyle)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginNumberedBullet_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginNumberedBullet(bulletNumber, leftIndent, leftSubIndent, bulletStyle);
     });
@@ -727,6 +829,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginNumberedBullet_(RichTextBox* obj, int bu
 
 ALTERNET_UI_API c_bool RichTextBox_EndNumberedBullet_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndNumberedBullet_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndNumberedBullet();
     });
@@ -734,6 +837,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndNumberedBullet_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginSymbolBullet_(RichTextBox* obj, NativeStringSpan* symbol, int leftIndent, int leftSubIndent, int bulletStyle)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginSymbolBullet_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginSymbolBullet(*symbol, leftIndent, leftSubIndent, bulletStyle);
     });
@@ -741,6 +845,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginSymbolBullet_(RichTextBox* obj, NativeSt
 
 ALTERNET_UI_API c_bool RichTextBox_EndSymbolBullet_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndSymbolBullet_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndSymbolBullet();
     });
@@ -748,6 +853,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndSymbolBullet_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginStandardBullet_(RichTextBox* obj, NativeStringSpan* bulletName, int leftIndent, int leftSubIndent, int bulletStyle)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginStandardBullet_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginStandardBullet(*bulletName, leftIndent, leftSubIndent, bulletStyle);
     });
@@ -755,6 +861,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginStandardBullet_(RichTextBox* obj, Native
 
 ALTERNET_UI_API c_bool RichTextBox_EndStandardBullet_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndStandardBullet_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndStandardBullet();
     });
@@ -762,6 +869,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndStandardBullet_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginCharacterStyle_(RichTextBox* obj, NativeStringSpan* characterStyle)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginCharacterStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginCharacterStyle(*characterStyle);
     });
@@ -769,6 +877,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginCharacterStyle_(RichTextBox* obj, Native
 
 ALTERNET_UI_API c_bool RichTextBox_EndCharacterStyle_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndCharacterStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndCharacterStyle();
     });
@@ -776,6 +885,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndCharacterStyle_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginParagraphStyle_(RichTextBox* obj, NativeStringSpan* paragraphStyle)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginParagraphStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginParagraphStyle(*paragraphStyle);
     });
@@ -783,6 +893,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginParagraphStyle_(RichTextBox* obj, Native
 
 ALTERNET_UI_API c_bool RichTextBox_EndParagraphStyle_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndParagraphStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndParagraphStyle();
     });
@@ -790,6 +901,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndParagraphStyle_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginListStyle_(RichTextBox* obj, NativeStringSpan* listStyle, int level, int number)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginListStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginListStyle(*listStyle, level, number);
     });
@@ -797,6 +909,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginListStyle_(RichTextBox* obj, NativeStrin
 
 ALTERNET_UI_API c_bool RichTextBox_EndListStyle_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndListStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndListStyle();
     });
@@ -804,6 +917,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndListStyle_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginURL_(RichTextBox* obj, NativeStringSpan* url, NativeStringSpan* characterStyle)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginURL_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginURL(*url, *characterStyle);
     });
@@ -811,6 +925,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginURL_(RichTextBox* obj, NativeStringSpan*
 
 ALTERNET_UI_API c_bool RichTextBox_EndURL_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndURL_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndURL();
     });
@@ -818,6 +933,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndURL_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_IsSelectionBold_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsSelectionBold_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsSelectionBold();
     });
@@ -825,6 +941,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsSelectionBold_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_IsSelectionItalics_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsSelectionItalics_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsSelectionItalics();
     });
@@ -832,6 +949,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsSelectionItalics_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_IsSelectionUnderlined_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsSelectionUnderlined_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsSelectionUnderlined();
     });
@@ -839,6 +957,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsSelectionUnderlined_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_DoesSelectionHaveTextEffectFlag_(RichTextBox* obj, int flag)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_DoesSelectionHaveTextEffectFlag_");
     return MarshalExceptions<c_bool>([&](){
         return obj->DoesSelectionHaveTextEffectFlag(flag);
     });
@@ -846,6 +965,7 @@ ALTERNET_UI_API c_bool RichTextBox_DoesSelectionHaveTextEffectFlag_(RichTextBox*
 
 ALTERNET_UI_API c_bool RichTextBox_IsSelectionAligned_(RichTextBox* obj, int alignment)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsSelectionAligned_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsSelectionAligned(alignment);
     });
@@ -853,6 +973,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsSelectionAligned_(RichTextBox* obj, int ali
 
 ALTERNET_UI_API c_bool RichTextBox_ApplyBoldToSelection_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ApplyBoldToSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ApplyBoldToSelection();
     });
@@ -860,6 +981,7 @@ ALTERNET_UI_API c_bool RichTextBox_ApplyBoldToSelection_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_ApplyItalicToSelection_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ApplyItalicToSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ApplyItalicToSelection();
     });
@@ -867,6 +989,7 @@ ALTERNET_UI_API c_bool RichTextBox_ApplyItalicToSelection_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_ApplyUnderlineToSelection_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ApplyUnderlineToSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ApplyUnderlineToSelection();
     });
@@ -874,6 +997,7 @@ ALTERNET_UI_API c_bool RichTextBox_ApplyUnderlineToSelection_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_ApplyTextEffectToSelection_(RichTextBox* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ApplyTextEffectToSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ApplyTextEffectToSelection(flags);
     });
@@ -881,6 +1005,7 @@ ALTERNET_UI_API c_bool RichTextBox_ApplyTextEffectToSelection_(RichTextBox* obj,
 
 ALTERNET_UI_API c_bool RichTextBox_ApplyAlignmentToSelection_(RichTextBox* obj, int alignment)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ApplyAlignmentToSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ApplyAlignmentToSelection(alignment);
     });
@@ -888,6 +1013,7 @@ ALTERNET_UI_API c_bool RichTextBox_ApplyAlignmentToSelection_(RichTextBox* obj,
 
 ALTERNET_UI_API c_bool RichTextBox_ApplyStyle_(RichTextBox* obj, void* def)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ApplyStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ApplyStyle(def);
     });
@@ -895,6 +1021,7 @@ ALTERNET_UI_API c_bool RichTextBox_ApplyStyle_(RichTextBox* obj, void* def)
 
 ALTERNET_UI_API void RichTextBox_SetStyleSheet_(RichTextBox* obj, void* styleSheet)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetStyleSheet_");
     MarshalExceptions<void>([&](){
         obj->SetStyleSheet(styleSheet);
     });
@@ -902,6 +1029,7 @@ ALTERNET_UI_API void RichTextBox_SetStyleSheet_(RichTextBox* obj, void* styleShe
 
 ALTERNET_UI_API c_bool RichTextBox_SetDefaultStyleToCursorStyle_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetDefaultStyleToCursorStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetDefaultStyleToCursorStyle();
     });
@@ -909,6 +1037,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetDefaultStyleToCursorStyle_(RichTextBox* ob
 
 ALTERNET_UI_API void RichTextBox_SelectNone_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SelectNone_");
     MarshalExceptions<void>([&](){
         obj->SelectNone();
     });
@@ -916,6 +1045,7 @@ ALTERNET_UI_API void RichTextBox_SelectNone_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_SelectWord_(RichTextBox* obj, int64_t position)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SelectWord_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SelectWord(position);
     });
@@ -923,6 +1053,7 @@ ALTERNET_UI_API c_bool RichTextBox_SelectWord_(RichTextBox* obj, int64_t positio
 
 ALTERNET_UI_API c_bool RichTextBox_LayoutContent_(RichTextBox* obj, c_bool onlyVisibleRect)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_LayoutContent_");
     return MarshalExceptions<c_bool>([&](){
         return obj->LayoutContent(onlyVisibleRect);
     });
@@ -930,6 +1061,7 @@ ALTERNET_UI_API c_bool RichTextBox_LayoutContent_(RichTextBox* obj, c_bool onlyV
 
 ALTERNET_UI_API c_bool RichTextBox_MoveCaret_(RichTextBox* obj, int64_t pos, c_bool showAtLineStart, void* container)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveCaret_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveCaret(pos, showAtLineStart, container);
     });
@@ -937,6 +1069,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveCaret_(RichTextBox* obj, int64_t pos, c_b
 
 ALTERNET_UI_API c_bool RichTextBox_MoveRight_(RichTextBox* obj, int noPositions, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveRight_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveRight(noPositions, flags);
     });
@@ -944,6 +1077,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveRight_(RichTextBox* obj, int noPositions,
 
 ALTERNET_UI_API c_bool RichTextBox_MoveLeft_(RichTextBox* obj, int noPositions, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveLeft_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveLeft(noPositions, flags);
     });
@@ -951,6 +1085,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveLeft_(RichTextBox* obj, int noPositions,
 
 ALTERNET_UI_API c_bool RichTextBox_MoveUp_(RichTextBox* obj, int noLines, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveUp_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveUp(noLines, flags);
     });
@@ -958,6 +1093,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveUp_(RichTextBox* obj, int noLines, int fl
 
 ALTERNET_UI_API c_bool RichTextBox_MoveDown_(RichTextBox* obj, int noLines, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveDown_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveDown(noLines, flags);
     });
@@ -965,6 +1101,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveDown_(RichTextBox* obj, int noLines, int
 
 ALTERNET_UI_API c_bool RichTextBox_MoveToLineEnd_(RichTextBox* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveToLineEnd_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveToLineEnd(flags);
     });
@@ -972,6 +1109,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveToLineEnd_(RichTextBox* obj, int flags)
 
 ALTERNET_UI_API c_bool RichTextBox_MoveToLineStart_(RichTextBox* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveToLineStart_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveToLineStart(flags);
     });
@@ -979,6 +1117,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveToLineStart_(RichTextBox* obj, int flags)
 
 ALTERNET_UI_API c_bool RichTextBox_MoveToParagraphEnd_(RichTextBox* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveToParagraphEnd_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveToParagraphEnd(flags);
     });
@@ -986,6 +1125,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveToParagraphEnd_(RichTextBox* obj, int fla
 
 ALTERNET_UI_API c_bool RichTextBox_MoveToParagraphStart_(RichTextBox* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveToParagraphStart_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveToParagraphStart(flags);
     });
@@ -993,6 +1133,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveToParagraphStart_(RichTextBox* obj, int f
 
 ALTERNET_UI_API c_bool RichTextBox_MoveHome_(RichTextBox* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveHome_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveHome(flags);
     });
@@ -1000,6 +1141,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveHome_(RichTextBox* obj, int flags)
 
 ALTERNET_UI_API c_bool RichTextBox_MoveEnd_(RichTextBox* obj, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveEnd_");
     return MarshalExceptions<c_bool>([&](){
         return obj->MoveEnd(flags);
     });
@@ -1007,6 +1149,7 @@ ALTERNET_UI_API c_bool RichTextBox_MoveEnd_(RichTextBox* obj, int flags)
 
 ALTERNET_UI_API c_bool RichTextBox_PageUp_(RichTextBox* obj, int noPages, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_PageUp_");
     return MarshalExceptions<c_bool>([&](){
         return obj->PageUp(noPages, flags);
     });
@@ -1014,6 +1157,7 @@ ALTERNET_UI_API c_bool RichTextBox_PageUp_(RichTextBox* obj, int noPages, int fl
 
 ALTERNET_UI_API c_bool RichTextBox_PageDown_(RichTextBox* obj, int noPages, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_PageDown_");
     return MarshalExceptions<c_bool>([&](){
         return obj->PageDown(noPages, flags);
     });
@@ -1021,6 +1165,7 @@ ALTERNET_UI_API c_bool RichTextBox_PageDown_(RichTextBox* obj, int noPages, int
 
 ALTERNET_UI_API c_bool RichTextBox_WordLeft_(RichTextBox* obj, int noPages, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_WordLeft_");
     return MarshalExceptions<c_bool>([&](){
         return obj->WordLeft(noPages, flags);
     });
@@ -1028,6 +1173,7 @@ ALTERNET_UI_API c_bool RichTextBox_WordLeft_(RichTextBox* obj, int noPages, int
 
 ALTERNET_UI_API c_bool RichTextBox_WordRight_(RichTextBox* obj, int noPages, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_WordRight_");
     return MarshalExceptions<c_bool>([&](){
         return obj->WordRight(noPages, flags);
     });
@@ -1035,6 +1181,7 @@ ALTERNET_UI_API c_bool RichTextBox_WordRight_(RichTextBox* obj, int noPages, int
 
 ALTERNET_UI_API c_bool RichTextBox_PushStyleSheet_(RichTextBox* obj, void* styleSheet)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_PushStyleSheet_");
     return MarshalExceptions<c_bool>([&](){
         return obj->PushStyleSheet(styleSheet);
     });
@@ -1042,6 +1189,7 @@ ALTERNET_UI_API c_bool RichTextBox_PushStyleSheet_(RichTextBox* obj, void* style
 
 ALTERNET_UI_API void* RichTextBox_PopStyleSheet_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_PopStyleSheet_");
     return MarshalExceptions<void*>([&](){
         return obj->PopStyleSheet();
     });
@@ -1049,6 +1197,7 @@ ALTERNET_UI_API void* RichTextBox_PopStyleSheet_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_ApplyStyleSheet_(RichTextBox* obj, void* styleSheet)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ApplyStyleSheet_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ApplyStyleSheet(styleSheet);
     });
@@ -1056,6 +1205,7 @@ ALTERNET_UI_API c_bool RichTextBox_ApplyStyleSheet_(RichTextBox* obj, void* styl
 
 ALTERNET_UI_API c_bool RichTextBox_ShowContextMenu_(RichTextBox* obj, void* menu, PointI* pt, c_bool addPropertyCommands)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ShowContextMenu_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ShowContextMenu(menu, *pt, addPropertyCommands);
     });
@@ -1063,6 +1213,7 @@ ALTERNET_UI_API c_bool RichTextBox_ShowContextMenu_(RichTextBox* obj, void* menu
 
 ALTERNET_UI_API int RichTextBox_PrepareContextMenu_(RichTextBox* obj, void* menu, PointI* pt, c_bool addPropertyCommands)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_PrepareContextMenu_");
     return MarshalExceptions<int>([&](){
         return obj->PrepareContextMenu(menu, *pt, addPropertyCommands);
     });
@@ -1070,6 +1221,7 @@ ALTERNET_UI_API int RichTextBox_PrepareContextMenu_(RichTextBox* obj, void* menu
 
 ALTERNET_UI_API c_bool RichTextBox_CanEditProperties_(RichTextBox* obj, void* richObj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CanEditProperties_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanEditProperties(richObj);
     });
@@ -1077,6 +1229,7 @@ ALTERNET_UI_API c_bool RichTextBox_CanEditProperties_(RichTextBox* obj, void* ri
 
 ALTERNET_UI_API c_bool RichTextBox_EditProperties_(RichTextBox* obj, void* richObj, void* parentWindow)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EditProperties_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EditProperties(richObj, parentWindow);
     });
@@ -1084,6 +1237,7 @@ ALTERNET_UI_API c_bool RichTextBox_EditProperties_(RichTextBox* obj, void* richO
 
 ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetPropertiesMenuLabel_(RichTextBox* obj, void* richObj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetPropertiesMenuLabel_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetPropertiesMenuLabel(richObj);
     });
@@ -1091,6 +1245,7 @@ ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetPropertiesMenuLabel_(RichTextB
 
 ALTERNET_UI_API c_bool RichTextBox_BeginBatchUndo_(RichTextBox* obj, NativeStringSpan* cmdName)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginBatchUndo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginBatchUndo(*cmdName);
     });
@@ -1098,6 +1253,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginBatchUndo_(RichTextBox* obj, NativeStrin
 
 ALTERNET_UI_API c_bool RichTextBox_EndBatchUndo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndBatchUndo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndBatchUndo();
     });
@@ -1105,6 +1261,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndBatchUndo_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BatchingUndo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BatchingUndo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BatchingUndo();
     });
@@ -1112,6 +1269,7 @@ ALTERNET_UI_API c_bool RichTextBox_BatchingUndo_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginSuppressUndo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginSuppressUndo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginSuppressUndo();
     });
@@ -1119,6 +1277,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginSuppressUndo_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_EndSuppressUndo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EndSuppressUndo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->EndSuppressUndo();
     });
@@ -1126,6 +1285,7 @@ ALTERNET_UI_API c_bool RichTextBox_EndSuppressUndo_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_SuppressingUndo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SuppressingUndo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SuppressingUndo();
     });
@@ -1133,6 +1293,7 @@ ALTERNET_UI_API c_bool RichTextBox_SuppressingUndo_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_EnableVerticalScrollbar_(RichTextBox* obj, c_bool enable)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EnableVerticalScrollbar_");
     MarshalExceptions<void>([&](){
         obj->EnableVerticalScrollbar(enable);
     });
@@ -1140,6 +1301,7 @@ ALTERNET_UI_API void RichTextBox_EnableVerticalScrollbar_(RichTextBox* obj, c_bo
 
 ALTERNET_UI_API c_bool RichTextBox_GetVerticalScrollbarEnabled_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetVerticalScrollbarEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetVerticalScrollbarEnabled();
     });
@@ -1147,6 +1309,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetVerticalScrollbarEnabled_(RichTextBox* obj
 
 ALTERNET_UI_API void RichTextBox_SetFontScale_(RichTextBox* obj, float fontScale, c_bool refresh)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetFontScale_");
     MarshalExceptions<void>([&](){
         obj->SetFontScale(fontScale, refresh);
     });
@@ -1154,6 +1317,7 @@ ALTERNET_UI_API void RichTextBox_SetFontScale_(RichTextBox* obj, float fontScale
 
 ALTERNET_UI_API float RichTextBox_GetFontScale_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetFontScale_");
     return MarshalExceptions<float>([&](){
         return obj->GetFontScale();
     });
@@ -1161,6 +1325,7 @@ ALTERNET_UI_API float RichTextBox_GetFontScale_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_GetVirtualAttributesEnabled_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetVirtualAttributesEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetVirtualAttributesEnabled();
     });
@@ -1168,6 +1333,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetVirtualAttributesEnabled_(RichTextBox* obj
 
 ALTERNET_UI_API void RichTextBox_EnableVirtualAttributes_(RichTextBox* obj, c_bool b)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EnableVirtualAttributes_");
     MarshalExceptions<void>([&](){
         obj->EnableVirtualAttributes(b);
     });
@@ -1175,6 +1341,7 @@ ALTERNET_UI_API void RichTextBox_EnableVirtualAttributes_(RichTextBox* obj, c_bo
 
 ALTERNET_UI_API void RichTextBox_DoWriteText_(RichTextBox* obj, NativeStringSpan* value, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_DoWriteText_");
     MarshalExceptions<void>([&](){
         obj->DoWriteText(*value, flags);
     });
@@ -1182,6 +1349,7 @@ ALTERNET_UI_API void RichTextBox_DoWriteText_(RichTextBox* obj, NativeStringSpan
 
 ALTERNET_UI_API c_bool RichTextBox_ExtendSelection_(RichTextBox* obj, int64_t oldPosition, int64_t newPosition, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ExtendSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ExtendSelection(oldPosition, newPosition, flags);
     });
@@ -1189,6 +1357,7 @@ ALTERNET_UI_API c_bool RichTextBox_ExtendSelection_(RichTextBox* obj, int64_t ol
 
 ALTERNET_UI_API c_bool RichTextBox_ExtendCellSelection_(RichTextBox* obj, void* table, int noRowSteps, int noColSteps)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ExtendCellSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ExtendCellSelection(table, noRowSteps, noColSteps);
     });
@@ -1196,6 +1365,7 @@ ALTERNET_UI_API c_bool RichTextBox_ExtendCellSelection_(RichTextBox* obj, void*
 
 ALTERNET_UI_API c_bool RichTextBox_StartCellSelection_(RichTextBox* obj, void* table, void* newCell)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_StartCellSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->StartCellSelection(table, newCell);
     });
@@ -1203,6 +1373,7 @@ ALTERNET_UI_API c_bool RichTextBox_StartCellSelection_(RichTextBox* obj, void* t
 
 ALTERNET_UI_API c_bool RichTextBox_ScrollIntoView_(RichTextBox* obj, int64_t position, int keyCode)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ScrollIntoView_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ScrollIntoView(position, keyCode);
     });
@@ -1210,6 +1381,7 @@ ALTERNET_UI_API c_bool RichTextBox_ScrollIntoView_(RichTextBox* obj, int64_t pos
 
 ALTERNET_UI_API void RichTextBox_SetCaretPosition_(RichTextBox* obj, int64_t position, c_bool showAtLineStart)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetCaretPosition_");
     MarshalExceptions<void>([&](){
         obj->SetCaretPosition(position, showAtLineStart);
     });
@@ -1217,6 +1389,7 @@ ALTERNET_UI_API void RichTextBox_SetCaretPosition_(RichTextBox* obj, int64_t pos
 
 ALTERNET_UI_API int64_t RichTextBox_GetCaretPosition_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetCaretPosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetCaretPosition();
     });
@@ -1224,6 +1397,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetCaretPosition_(RichTextBox* obj)
 
 ALTERNET_UI_API int64_t RichTextBox_GetAdjustedCaretPosition_(RichTextBox* obj, int64_t caretPos)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetAdjustedCaretPosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetAdjustedCaretPosition(caretPos);
     });
@@ -1231,6 +1405,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetAdjustedCaretPosition_(RichTextBox* obj,
 
 ALTERNET_UI_API void RichTextBox_MoveCaretForward_(RichTextBox* obj, int64_t oldPosition)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveCaretForward_");
     MarshalExceptions<void>([&](){
         obj->MoveCaretForward(oldPosition);
     });
@@ -1238,6 +1413,7 @@ ALTERNET_UI_API void RichTextBox_MoveCaretForward_(RichTextBox* obj, int64_t old
 
 ALTERNET_UI_API PointI_C RichTextBox_GetPhysicalPoint_(RichTextBox* obj, PointI* ptLogical)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetPhysicalPoint_");
     return MarshalExceptions<PointI_C>([&](){
         return obj->GetPhysicalPoint(*ptLogical);
     });
@@ -1245,6 +1421,7 @@ ALTERNET_UI_API PointI_C RichTextBox_GetPhysicalPoint_(RichTextBox* obj, PointI*
 
 ALTERNET_UI_API PointI_C RichTextBox_GetLogicalPoint_(RichTextBox* obj, PointI* ptPhysical)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetLogicalPoint_");
     return MarshalExceptions<PointI_C>([&](){
         return obj->GetLogicalPoint(*ptPhysical);
     });
@@ -1252,6 +1429,7 @@ ALTERNET_UI_API PointI_C RichTextBox_GetLogicalPoint_(RichTextBox* obj, PointI*
 
 ALTERNET_UI_API int64_t RichTextBox_FindNextWordPosition_(RichTextBox* obj, int direction)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_FindNextWordPosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->FindNextWordPosition(direction);
     });
@@ -1259,6 +1437,7 @@ ALTERNET_UI_API int64_t RichTextBox_FindNextWordPosition_(RichTextBox* obj, int
 
 ALTERNET_UI_API c_bool RichTextBox_IsPositionVisible_(RichTextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsPositionVisible_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsPositionVisible(pos);
     });
@@ -1266,6 +1445,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsPositionVisible_(RichTextBox* obj, int64_t
 
 ALTERNET_UI_API int64_t RichTextBox_GetFirstVisiblePosition_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetFirstVisiblePosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetFirstVisiblePosition();
     });
@@ -1273,6 +1453,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetFirstVisiblePosition_(RichTextBox* obj)
 
 ALTERNET_UI_API int64_t RichTextBox_GetCaretPositionForDefaultStyle_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetCaretPositionForDefaultStyle_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetCaretPositionForDefaultStyle();
     });
@@ -1280,6 +1461,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetCaretPositionForDefaultStyle_(RichTextBox
 
 ALTERNET_UI_API void RichTextBox_SetCaretPositionForDefaultStyle_(RichTextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetCaretPositionForDefaultStyle_");
     MarshalExceptions<void>([&](){
         obj->SetCaretPositionForDefaultStyle(pos);
     });
@@ -1287,6 +1469,7 @@ ALTERNET_UI_API void RichTextBox_SetCaretPositionForDefaultStyle_(RichTextBox* o
 
 ALTERNET_UI_API void RichTextBox_MoveCaretBack_(RichTextBox* obj, int64_t oldPosition)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_MoveCaretBack_");
     MarshalExceptions<void>([&](){
         obj->MoveCaretBack(oldPosition);
     });
@@ -1294,6 +1477,7 @@ ALTERNET_UI_API void RichTextBox_MoveCaretBack_(RichTextBox* obj, int64_t oldPos
 
 ALTERNET_UI_API c_bool RichTextBox_GetCaretPositionForIndex_(RichTextBox* obj, int64_t position, RectI* rect, void* container)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetCaretPositionForIndex_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCaretPositionForIndex(position, *rect, container);
     });
@@ -1301,6 +1485,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetCaretPositionForIndex_(RichTextBox* obj, i
 
 ALTERNET_UI_API void* RichTextBox_GetVisibleLineForCaretPosition_(RichTextBox* obj, int64_t caretPosition)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetVisibleLineForCaretPosition_");
     return MarshalExceptions<void*>([&](){
         return obj->GetVisibleLineForCaretPosition(caretPosition);
     });
@@ -1308,6 +1493,7 @@ ALTERNET_UI_API void* RichTextBox_GetVisibleLineForCaretPosition_(RichTextBox* o
 
 ALTERNET_UI_API void* RichTextBox_GetCommandProcessor_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetCommandProcessor_");
     return MarshalExceptions<void*>([&](){
         return obj->GetCommandProcessor();
     });
@@ -1315,6 +1501,7 @@ ALTERNET_UI_API void* RichTextBox_GetCommandProcessor_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_IsDefaultStyleShowing_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsDefaultStyleShowing_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsDefaultStyleShowing();
     });
@@ -1322,6 +1509,7 @@ ALTERNET_UI_API c_bool RichTextBox_IsDefaultStyleShowing_(RichTextBox* obj)
 
 ALTERNET_UI_API PointI_C RichTextBox_GetFirstVisiblePoint_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetFirstVisiblePoint_");
     return MarshalExceptions<PointI_C>([&](){
         return obj->GetFirstVisiblePoint();
     });
@@ -1329,6 +1517,7 @@ ALTERNET_UI_API PointI_C RichTextBox_GetFirstVisiblePoint_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_EnableImages_(RichTextBox* obj, c_bool b)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EnableImages_");
     MarshalExceptions<void>([&](){
         obj->EnableImages(b);
     });
@@ -1336,6 +1525,7 @@ ALTERNET_UI_API void RichTextBox_EnableImages_(RichTextBox* obj, c_bool b)
 
 ALTERNET_UI_API c_bool RichTextBox_GetImagesEnabled_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetImagesEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetImagesEnabled();
     });
@@ -1343,6 +1533,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetImagesEnabled_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_EnableDelayedImageLoading_(RichTextBox* obj, c_bool b)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_EnableDelayedImageLoading_");
     MarshalExceptions<void>([&](){
         obj->EnableDelayedImageLoading(b);
     });
@@ -1350,6 +1541,7 @@ ALTERNET_UI_API void RichTextBox_EnableDelayedImageLoading_(RichTextBox* obj, c_
 
 ALTERNET_UI_API c_bool RichTextBox_GetDelayedImageLoading_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetDelayedImageLoading_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetDelayedImageLoading();
     });
@@ -1357,6 +1549,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetDelayedImageLoading_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_GetDelayedImageProcessingRequired_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetDelayedImageProcessingRequired_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetDelayedImageProcessingRequired();
     });
@@ -1364,6 +1557,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetDelayedImageProcessingRequired_(RichTextBo
 
 ALTERNET_UI_API void RichTextBox_SetDelayedImageProcessingRequired_(RichTextBox* obj, c_bool b)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetDelayedImageProcessingRequired_");
     MarshalExceptions<void>([&](){
         obj->SetDelayedImageProcessingRequired(b);
     });
@@ -1371,6 +1565,7 @@ ALTERNET_UI_API void RichTextBox_SetDelayedImageProcessingRequired_(RichTextBox*
 
 ALTERNET_UI_API int64_t RichTextBox_GetDelayedImageProcessingTime_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetDelayedImageProcessingTime_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetDelayedImageProcessingTime();
     });
@@ -1378,6 +1573,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetDelayedImageProcessingTime_(RichTextBox*
 
 ALTERNET_UI_API void RichTextBox_SetDelayedImageProcessingTime_(RichTextBox* obj, int64_t t)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetDelayedImageProcessingTime_");
     MarshalExceptions<void>([&](){
         obj->SetDelayedImageProcessingTime(t);
     });
@@ -1385,6 +1581,7 @@ ALTERNET_UI_API void RichTextBox_SetDelayedImageProcessingTime_(RichTextBox* obj
 
 ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetValue_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetValue_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetValue();
     });
@@ -1392,6 +1589,7 @@ ALTERNET_UI_API NativeStringSpan_C RichTextBox_GetValue_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetValue_(RichTextBox* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetValue_");
     MarshalExceptions<void>([&](){
         obj->SetValue(*value);
     });
@@ -1399,6 +1597,7 @@ ALTERNET_UI_API void RichTextBox_SetValue_(RichTextBox* obj, NativeStringSpan* v
 
 ALTERNET_UI_API void RichTextBox_SetLineHeight_(RichTextBox* obj, int height)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetLineHeight_");
     MarshalExceptions<void>([&](){
         obj->SetLineHeight(height);
     });
@@ -1406,6 +1605,7 @@ ALTERNET_UI_API void RichTextBox_SetLineHeight_(RichTextBox* obj, int height)
 
 ALTERNET_UI_API int RichTextBox_GetLineHeight_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetLineHeight_");
     return MarshalExceptions<int>([&](){
         return obj->GetLineHeight();
     });
@@ -1413,6 +1613,7 @@ ALTERNET_UI_API int RichTextBox_GetLineHeight_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_SetCaretPositionAfterClick_(RichTextBox* obj, void* container, int64_t position, int hitTestFlags, c_bool extendSelection)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetCaretPositionAfterClick_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetCaretPositionAfterClick(container, position, hitTestFlags, extendSelection);
     });
@@ -1420,6 +1621,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetCaretPositionAfterClick_(RichTextBox* obj,
 
 ALTERNET_UI_API void RichTextBox_ClearAvailableFontNames_()
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ClearAvailableFontNames_");
     MarshalExceptions<void>([&](){
         RichTextBox::ClearAvailableFontNames();
     });
@@ -1427,6 +1629,7 @@ ALTERNET_UI_API void RichTextBox_ClearAvailableFontNames_()
 
 ALTERNET_UI_API c_bool RichTextBox_ProcessDelayedImageLoading_(RichTextBox* obj, c_bool refresh)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ProcessDelayedImageLoading_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ProcessDelayedImageLoading(refresh);
     });
@@ -1434,6 +1637,7 @@ ALTERNET_UI_API c_bool RichTextBox_ProcessDelayedImageLoading_(RichTextBox* obj,
 
 ALTERNET_UI_API void RichTextBox_RequestDelayedImageProcessing_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_RequestDelayedImageProcessing_");
     MarshalExceptions<void>([&](){
         obj->RequestDelayedImageProcessing();
     });
@@ -1441,6 +1645,7 @@ ALTERNET_UI_API void RichTextBox_RequestDelayedImageProcessing_(RichTextBox* obj
 
 ALTERNET_UI_API c_bool RichTextBox_GetUncombinedStyle_(RichTextBox* obj, int64_t position, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetUncombinedStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetUncombinedStyle(position, style);
     });
@@ -1448,6 +1653,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetUncombinedStyle_(RichTextBox* obj, int64_t
 
 ALTERNET_UI_API c_bool RichTextBox_GetUncombinedStyle2_(RichTextBox* obj, int64_t position, void* style, void* container)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetUncombinedStyle2_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetUncombinedStyle2(position, style, container);
     });
@@ -1455,6 +1661,7 @@ ALTERNET_UI_API c_bool RichTextBox_GetUncombinedStyle2_(RichTextBox* obj, int64_
 
 ALTERNET_UI_API c_bool RichTextBox_SetDefaultStyle_(RichTextBox* obj, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetDefaultStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetDefaultStyle(style);
     });
@@ -1462,6 +1669,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetDefaultStyle_(RichTextBox* obj, void* styl
 
 ALTERNET_UI_API c_bool RichTextBox_SetDefaultRichStyle_(RichTextBox* obj, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetDefaultRichStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetDefaultRichStyle(style);
     });
@@ -1469,6 +1677,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetDefaultRichStyle_(RichTextBox* obj, void*
 
 ALTERNET_UI_API void* RichTextBox_GetDefaultStyleEx_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetDefaultStyleEx_");
     return MarshalExceptions<void*>([&](){
         return obj->GetDefaultStyleEx();
     });
@@ -1476,6 +1685,7 @@ ALTERNET_UI_API void* RichTextBox_GetDefaultStyleEx_(RichTextBox* obj)
 
 ALTERNET_UI_API int64_t RichTextBox_GetLastPosition_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetLastPosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetLastPosition();
     });
@@ -1483,6 +1693,7 @@ ALTERNET_UI_API int64_t RichTextBox_GetLastPosition_(RichTextBox* obj)
 
 ALTERNET_UI_API void* RichTextBox_GetStyle_(RichTextBox* obj, int64_t position)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyle_");
     return MarshalExceptions<void*>([&](){
         return obj->GetStyle(position);
     });
@@ -1490,6 +1701,7 @@ ALTERNET_UI_API void* RichTextBox_GetStyle_(RichTextBox* obj, int64_t position)
 
 ALTERNET_UI_API void* RichTextBox_GetRichStyle_(RichTextBox* obj, int64_t position)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetRichStyle_");
     return MarshalExceptions<void*>([&](){
         return obj->GetRichStyle(position);
     });
@@ -1497,6 +1709,7 @@ ALTERNET_UI_API void* RichTextBox_GetRichStyle_(RichTextBox* obj, int64_t positi
 
 ALTERNET_UI_API void* RichTextBox_GetStyleInContainer_(RichTextBox* obj, int64_t position, void* container)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyleInContainer_");
     return MarshalExceptions<void*>([&](){
         return obj->GetStyleInContainer(position, container);
     });
@@ -1504,6 +1717,7 @@ ALTERNET_UI_API void* RichTextBox_GetStyleInContainer_(RichTextBox* obj, int64_t
 
 ALTERNET_UI_API c_bool RichTextBox_SetStyle_(RichTextBox* obj, int64_t start, int64_t end, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetStyle(start, end, style);
     });
@@ -1511,6 +1725,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetStyle_(RichTextBox* obj, int64_t start, in
 
 ALTERNET_UI_API c_bool RichTextBox_SetRichStyle_(RichTextBox* obj, int64_t start, int64_t end, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetRichStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetRichStyle(start, end, style);
     });
@@ -1518,6 +1733,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetRichStyle_(RichTextBox* obj, int64_t start
 
 ALTERNET_UI_API void RichTextBox_SetStyle2_(RichTextBox* obj, void* richObj, void* textAttr, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetStyle2_");
     MarshalExceptions<void>([&](){
         obj->SetStyle2(richObj, textAttr, flags);
     });
@@ -1525,6 +1741,7 @@ ALTERNET_UI_API void RichTextBox_SetStyle2_(RichTextBox* obj, void* richObj, voi
 
 ALTERNET_UI_API void* RichTextBox_GetStyleForRange_(RichTextBox* obj, int64_t startRange, int64_t endRange)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyleForRange_");
     return MarshalExceptions<void*>([&](){
         return obj->GetStyleForRange(startRange, endRange);
     });
@@ -1532,6 +1749,7 @@ ALTERNET_UI_API void* RichTextBox_GetStyleForRange_(RichTextBox* obj, int64_t st
 
 ALTERNET_UI_API void* RichTextBox_GetStyleForRange2_(RichTextBox* obj, int64_t startRange, int64_t endRange)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyleForRange2_");
     return MarshalExceptions<void*>([&](){
         return obj->GetStyleForRange2(startRange, endRange);
     });
@@ -1539,6 +1757,7 @@ ALTERNET_UI_API void* RichTextBox_GetStyleForRange2_(RichTextBox* obj, int64_t s
 
 ALTERNET_UI_API void* RichTextBox_GetStyleForRange3_(RichTextBox* obj, int64_t startRange, int64_t endRange, void* container)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyleForRange3_");
     return MarshalExceptions<void*>([&](){
         return obj->GetStyleForRange3(startRange, endRange, container);
     });
@@ -1546,6 +1765,7 @@ ALTERNET_UI_API void* RichTextBox_GetStyleForRange3_(RichTextBox* obj, int64_t s
 
 ALTERNET_UI_API c_bool RichTextBox_SetStyleEx_(RichTextBox* obj, int64_t startRange, int64_t endRange, void* style, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetStyleEx_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetStyleEx(startRange, endRange, style, flags);
     });
@@ -1553,6 +1773,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetStyleEx_(RichTextBox* obj, int64_t startRa
 
 ALTERNET_UI_API c_bool RichTextBox_SetListStyle_(RichTextBox* obj, int64_t startRange, int64_t endRange, void* def, int flags, int startFrom, int specifiedLevel)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetListStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetListStyle(startRange, endRange, def, flags, startFrom, specifiedLevel);
     });
@@ -1560,6 +1781,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetListStyle_(RichTextBox* obj, int64_t start
 
 ALTERNET_UI_API c_bool RichTextBox_SetListStyle2_(RichTextBox* obj, int64_t startRange, int64_t endRange, NativeStringSpan* defName, int flags, int startFrom, int specifiedLevel)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetListStyle2_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetListStyle2(startRange, endRange, *defName, flags, startFrom, specifiedLevel);
     });
@@ -1567,6 +1789,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetListStyle2_(RichTextBox* obj, int64_t star
 
 ALTERNET_UI_API c_bool RichTextBox_ClearListStyle_(RichTextBox* obj, int64_t startRange, int64_t endRange, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ClearListStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->ClearListStyle(startRange, endRange, flags);
     });
@@ -1574,6 +1797,7 @@ ALTERNET_UI_API c_bool RichTextBox_ClearListStyle_(RichTextBox* obj, int64_t sta
 
 ALTERNET_UI_API c_bool RichTextBox_NumberList_(RichTextBox* obj, int64_t startRange, int64_t endRange, void* def, int flags, int startFrom, int specifiedLevel)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_NumberList_");
     return MarshalExceptions<c_bool>([&](){
         return obj->NumberList(startRange, endRange, def, flags, startFrom, specifiedLevel);
     });
@@ -1581,6 +1805,7 @@ ALTERNET_UI_API c_bool RichTextBox_NumberList_(RichTextBox* obj, int64_t startRa
 
 ALTERNET_UI_API c_bool RichTextBox_NumberList2_(RichTextBox* obj, int64_t startRange, int64_t endRange, NativeStringSpan* defName, int flags, int startFrom, int specifiedLevel)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_NumberList2_");
     return MarshalExceptions<c_bool>([&](){
         return obj->NumberList2(startRange, endRange, *defName, flags, startFrom, specifiedLevel);
     });
@@ -1588,6 +1813,7 @@ ALTERNET_UI_API c_bool RichTextBox_NumberList2_(RichTextBox* obj, int64_t startR
 
 ALTERNET_UI_API c_bool RichTextBox_PromoteList_(RichTextBox* obj, int promoteBy, int64_t startRange, int64_t endRange, void* def, int flags, int specifiedLevel)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_PromoteList_");
     return MarshalExceptions<c_bool>([&](){
         return obj->PromoteList(promoteBy, startRange, endRange, def, flags, specifiedLevel);
     });
@@ -1595,6 +1821,7 @@ ALTERNET_UI_API c_bool RichTextBox_PromoteList_(RichTextBox* obj, int promoteBy,
 
 ALTERNET_UI_API c_bool RichTextBox_PromoteList2_(RichTextBox* obj, int promoteBy, int64_t startRange, int64_t endRange, NativeStringSpan* defName, int flags, int specifiedLevel)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_PromoteList2_");
     return MarshalExceptions<c_bool>([&](){
         return obj->PromoteList2(promoteBy, startRange, endRange, *defName, flags, specifiedLevel);
     });
@@ -1602,6 +1829,7 @@ ALTERNET_UI_API c_bool RichTextBox_PromoteList2_(RichTextBox* obj, int promoteBy
 
 ALTERNET_UI_API c_bool RichTextBox_Delete_(RichTextBox* obj, int64_t startRange, int64_t endRange)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_Delete_");
     return MarshalExceptions<c_bool>([&](){
         return obj->Delete(startRange, endRange);
     });
@@ -1609,6 +1837,7 @@ ALTERNET_UI_API c_bool RichTextBox_Delete_(RichTextBox* obj, int64_t startRange,
 
 ALTERNET_UI_API void* RichTextBox_WriteTable_(RichTextBox* obj, int rows, int cols, void* tableAttr, void* cellAttr)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_WriteTable_");
     return MarshalExceptions<void*>([&](){
         return obj->WriteTable(rows, cols, tableAttr, cellAttr);
     });
@@ -1616,6 +1845,7 @@ ALTERNET_UI_API void* RichTextBox_WriteTable_(RichTextBox* obj, int rows, int co
 
 ALTERNET_UI_API void RichTextBox_SetBasicStyle_(RichTextBox* obj, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetBasicStyle_");
     MarshalExceptions<void>([&](){
         obj->SetBasicStyle(style);
     });
@@ -1623,6 +1853,7 @@ ALTERNET_UI_API void RichTextBox_SetBasicStyle_(RichTextBox* obj, void* style)
 
 ALTERNET_UI_API void* RichTextBox_GetBasicStyle_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetBasicStyle_");
     return MarshalExceptions<void*>([&](){
         return obj->GetBasicStyle();
     });
@@ -1630,6 +1861,7 @@ ALTERNET_UI_API void* RichTextBox_GetBasicStyle_(RichTextBox* obj)
 
 ALTERNET_UI_API c_bool RichTextBox_BeginStyle_(RichTextBox* obj, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->BeginStyle(style);
     });
@@ -1637,6 +1869,7 @@ ALTERNET_UI_API c_bool RichTextBox_BeginStyle_(RichTextBox* obj, void* style)
 
 ALTERNET_UI_API c_bool RichTextBox_HasCharacterAttributes_(RichTextBox* obj, int64_t startRange, int64_t endRange, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_HasCharacterAttributes_");
     return MarshalExceptions<c_bool>([&](){
         return obj->HasCharacterAttributes(startRange, endRange, style);
     });
@@ -1644,6 +1877,7 @@ ALTERNET_UI_API c_bool RichTextBox_HasCharacterAttributes_(RichTextBox* obj, int
 
 ALTERNET_UI_API void* RichTextBox_GetStyleSheet_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyleSheet_");
     return MarshalExceptions<void*>([&](){
         return obj->GetStyleSheet();
     });
@@ -1651,6 +1885,7 @@ ALTERNET_UI_API void* RichTextBox_GetStyleSheet_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetAndShowDefaultStyle_(RichTextBox* obj, void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetAndShowDefaultStyle_");
     MarshalExceptions<void>([&](){
         obj->SetAndShowDefaultStyle(attr);
     });
@@ -1658,6 +1893,7 @@ ALTERNET_UI_API void RichTextBox_SetAndShowDefaultStyle_(RichTextBox* obj, void*
 
 ALTERNET_UI_API void RichTextBox_SetSelectionRange_(RichTextBox* obj, int64_t startRange, int64_t endRange)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetSelectionRange_");
     MarshalExceptions<void>([&](){
         obj->SetSelectionRange(startRange, endRange);
     });
@@ -1665,6 +1901,7 @@ ALTERNET_UI_API void RichTextBox_SetSelectionRange_(RichTextBox* obj, int64_t st
 
 ALTERNET_UI_API PointI_C RichTextBox_PositionToXY_(RichTextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_PositionToXY_");
     return MarshalExceptions<PointI_C>([&](){
         return obj->PositionToXY(pos);
     });
@@ -1672,6 +1909,7 @@ ALTERNET_UI_API PointI_C RichTextBox_PositionToXY_(RichTextBox* obj, int64_t pos
 
 ALTERNET_UI_API void* RichTextBox_WriteTextBox_(RichTextBox* obj, void* textAttr)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_WriteTextBox_");
     return MarshalExceptions<void*>([&](){
         return obj->WriteTextBox(textAttr);
     });
@@ -1679,6 +1917,7 @@ ALTERNET_UI_API void* RichTextBox_WriteTextBox_(RichTextBox* obj, void* textAttr
 
 ALTERNET_UI_API c_bool RichTextBox_HasParagraphAttributes_(RichTextBox* obj, int64_t startRange, int64_t endRange, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_HasParagraphAttributes_");
     return MarshalExceptions<c_bool>([&](){
         return obj->HasParagraphAttributes(startRange, endRange, style);
     });
@@ -1686,6 +1925,7 @@ ALTERNET_UI_API c_bool RichTextBox_HasParagraphAttributes_(RichTextBox* obj, int
 
 ALTERNET_UI_API c_bool RichTextBox_SetProperties_(RichTextBox* obj, int64_t startRange, int64_t endRange, void* properties, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetProperties_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetProperties(startRange, endRange, properties, flags);
     });
@@ -1693,6 +1933,7 @@ ALTERNET_UI_API c_bool RichTextBox_SetProperties_(RichTextBox* obj, int64_t star
 
 ALTERNET_UI_API void RichTextBox_SetTextCursor_(RichTextBox* obj, void* cursor)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetTextCursor_");
     MarshalExceptions<void>([&](){
         obj->SetTextCursor(cursor);
     });
@@ -1700,6 +1941,7 @@ ALTERNET_UI_API void RichTextBox_SetTextCursor_(RichTextBox* obj, void* cursor)
 
 ALTERNET_UI_API void* RichTextBox_GetTextCursor_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetTextCursor_");
     return MarshalExceptions<void*>([&](){
         return obj->GetTextCursor();
     });
@@ -1707,6 +1949,7 @@ ALTERNET_UI_API void* RichTextBox_GetTextCursor_(RichTextBox* obj)
 
 ALTERNET_UI_API void RichTextBox_SetURLCursor_(RichTextBox* obj, void* cursor)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetURLCursor_");
     MarshalExceptions<void>([&](){
         obj->SetURLCursor(cursor);
     });
@@ -1714,6 +1957,7 @@ ALTERNET_UI_API void RichTextBox_SetURLCursor_(RichTextBox* obj, void* cursor)
 
 ALTERNET_UI_API void* RichTextBox_GetURLCursor_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetURLCursor_");
     return MarshalExceptions<void*>([&](){
         return obj->GetURLCursor();
     });
@@ -1721,6 +1965,7 @@ ALTERNET_UI_API void* RichTextBox_GetURLCursor_(RichTextBox* obj)
 
 ALTERNET_UI_API void* RichTextBox_GetSelection_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetSelection_");
     return MarshalExceptions<void*>([&](){
         return obj->GetSelection();
     });
@@ -1728,6 +1973,7 @@ ALTERNET_UI_API void* RichTextBox_GetSelection_(RichTextBox* obj)
 
 ALTERNET_UI_API void* RichTextBox_GetContextMenuPropertiesInfo_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetContextMenuPropertiesInfo_");
     return MarshalExceptions<void*>([&](){
         return obj->GetContextMenuPropertiesInfo();
     });
@@ -1735,6 +1981,7 @@ ALTERNET_UI_API void* RichTextBox_GetContextMenuPropertiesInfo_(RichTextBox* obj
 
 ALTERNET_UI_API void RichTextBox_SetSelection2_(RichTextBox* obj, void* sel)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetSelection2_");
     MarshalExceptions<void>([&](){
         obj->SetSelection2(sel);
     });
@@ -1742,6 +1989,7 @@ ALTERNET_UI_API void RichTextBox_SetSelection2_(RichTextBox* obj, void* sel)
 
 ALTERNET_UI_API c_bool RichTextBox_WriteImage_(RichTextBox* obj, Image* bitmap, int bitmapType, void* textAttr)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_WriteImage_");
     return MarshalExceptions<c_bool>([&](){
         return obj->WriteImage(bitmap, bitmapType, textAttr);
     });
@@ -1749,6 +1997,7 @@ ALTERNET_UI_API c_bool RichTextBox_WriteImage_(RichTextBox* obj, Image* bitmap,
 
 ALTERNET_UI_API c_bool RichTextBox_WriteImage2_(RichTextBox* obj, NativeStringSpan* filename, int bitmapType, void* textAttr)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_WriteImage2_");
     return MarshalExceptions<c_bool>([&](){
         return obj->WriteImage2(*filename, bitmapType, textAttr);
     });
@@ -1756,6 +2005,7 @@ ALTERNET_UI_API c_bool RichTextBox_WriteImage2_(RichTextBox* obj, NativeStringSp
 
 ALTERNET_UI_API c_bool RichTextBox_WriteImage3_(RichTextBox* obj, void* imageBlock, void* textAttr)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_WriteImage3_");
     return MarshalExceptions<c_bool>([&](){
         return obj->WriteImage3(imageBlock, textAttr);
     });
@@ -1763,6 +2013,7 @@ ALTERNET_UI_API c_bool RichTextBox_WriteImage3_(RichTextBox* obj, void* imageBlo
 
 ALTERNET_UI_API void* RichTextBox_WriteField_(RichTextBox* obj, NativeStringSpan* fieldType, void* properties, void* textAttr)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_WriteField_");
     return MarshalExceptions<void*>([&](){
         return obj->WriteField(*fieldType, properties, textAttr);
     });
@@ -1770,6 +2021,7 @@ ALTERNET_UI_API void* RichTextBox_WriteField_(RichTextBox* obj, NativeStringSpan
 
 ALTERNET_UI_API c_bool RichTextBox_CanDeleteRange_(RichTextBox* obj, void* container, int64_t startRange, int64_t endRange)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CanDeleteRange_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanDeleteRange(container, startRange, endRange);
     });
@@ -1777,6 +2029,7 @@ ALTERNET_UI_API c_bool RichTextBox_CanDeleteRange_(RichTextBox* obj, void* conta
 
 ALTERNET_UI_API c_bool RichTextBox_CanInsertContent_(RichTextBox* obj, void* container, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CanInsertContent_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanInsertContent(container, pos);
     });
@@ -1784,6 +2037,7 @@ ALTERNET_UI_API c_bool RichTextBox_CanInsertContent_(RichTextBox* obj, void* con
 
 ALTERNET_UI_API void* RichTextBox_GetBuffer_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetBuffer_");
     return MarshalExceptions<void*>([&](){
         return obj->GetBuffer();
     });
@@ -1791,11 +2045,140 @@ ALTERNET_UI_API void* RichTextBox_GetBuffer_(RichTextBox* obj)
 
 ALTERNET_UI_API int64_t RichTextBox_DeleteSelectedContent_(RichTextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_DeleteSelectedContent_");
     return MarshalExceptions<int64_t>([&](){
         return obj->DeleteSelectedContent();
     });
 }
 
+ALTERNET_UI_API int RichTextBox_RegisterStyle_(RichTextBox* obj, void* style)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_RegisterStyle_");
+    return MarshalExceptions<int>([&](){
+        return obj->RegisterStyle(style);
+    });
+}
+
+ALTERNET_UI_API void RichTextBox_ClearRegisteredStyles_(RichTextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ClearRegisteredStyles_");
+    MarshalExceptions<void>([&](){
+        obj->ClearRegisteredStyles();
+    });
+}
+
+ALTERNET_UI_API void RichTextBox_ApplyStyleRuns_(RichTextBox* obj, int64_t* runs, int runsCount)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_ApplyStyleRuns_");
+    MarshalExceptions<void>([&](){
+        obj->ApplyStyleRuns(runs, runsCount);
+    });
+}
+
+ALTERNET_UI_API int RichTextBox_GetStyleId_(RichTextBox* obj, int64_t position)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyleId_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetStyleId(position);
+    });
+}
+
+ALTERNET_UI_API int RichTextBox_GetStyleIdForRange_(RichTextBox* obj, int64_t startRange, int64_t endRange)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyleIdForRange_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetStyleIdForRange(startRange, endRange);
+    });
+}
+
+ALTERNET_UI_API c_bool RichTextBox_SetSearchPattern_(RichTextBox* obj, NativeStringSpan* pattern, int options)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_SetSearchPattern_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->SetSearchPattern(*pattern, options);
+    });
+}
+
+ALTERNET_UI_API int RichTextBox_FindMatches_(RichTextBox* obj, int64_t start, int64_t* results, int resultsCount, int timeBudgetMs)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_FindMatches_");
+    return MarshalExceptions<int>([&](){
+        return obj->FindMatches(start, results, resultsCount, timeBudgetMs);
+    });
+}
+
+ALTERNET_UI_API int64_t RichTextBox_GetSearchCursor_(RichTextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetSearchCursor_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetSearchCursor();
+    });
+}
+
+ALTERNET_UI_API c_bool RichTextBox_BeginLoadFromStream_(RichTextBox* obj, void* stream, int type)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginLoadFromStream_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->BeginLoadFromStream(stream, type);
+    });
+}
+
+ALTERNET_UI_API c_bool RichTextBox_BeginLoadFile_(RichTextBox* obj, NativeStringSpan* file, int type)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_BeginLoadFile_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->BeginLoadFile(*file, type);
+    });
+}
+
+ALTERNET_UI_API c_bool RichTextBox_IsLoading_(RichTextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_IsLoading_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->IsLoading();
+    });
+}
+
+ALTERNET_UI_API int RichTextBox_GetLoadProgress_(RichTextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetLoadProgress_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetLoadProgress();
+    });
+}
+
+ALTERNET_UI_API c_bool RichTextBox_GetLoadResult_(RichTextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetLoadResult_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->GetLoadResult();
+    });
+}
+
+ALTERNET_UI_API void RichTextBox_CancelLoad_(RichTextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_CancelLoad_");
+    MarshalExceptions<void>([&](){
+        obj->CancelLoad();
+    });
+}
+
+ALTERNET_UI_API int RichTextBox_GetStyleIdInContainer_(RichTextBox* obj, int64_t position, void* container)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyleIdInContainer_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetStyleIdInContainer(position, container);
+    });
+}
+
+ALTERNET_UI_API int RichTextBox_GetStyleIdForRangeInContainer_(RichTextBox* obj, int64_t startRange, int64_t endRange, void* container)
+{
+    ALTERNET_UI_PERF_EXPORT("RichTextBox_GetStyleIdForRangeInContainer_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetStyleIdForRangeInContainer(startRange, endRange, container);
+    });
+}
+
 ALTERNET_UI_API void RichTextBox_SetEventCallback_(RichTextBox::RichTextBoxEventCallbackType callback)
 {
     RichTextBox::SetEventCallback(callback);
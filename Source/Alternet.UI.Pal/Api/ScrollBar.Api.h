@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API ScrollBar* ScrollBar_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_Create_");
     return MarshalExceptions<ScrollBar*>([&](){
         return new ScrollBar();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API ScrollBar* ScrollBar_Create_()
 
 ALTERNET_UI_API int ScrollBar_GetEventTypeID_(ScrollBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_GetEventTypeID_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventTypeID();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API int ScrollBar_GetEventTypeID_(ScrollBar* obj)
 
 ALTERNET_UI_API int ScrollBar_GetEventOldPos_(ScrollBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_GetEventOldPos_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventOldPos();
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API int ScrollBar_GetEventOldPos_(ScrollBar* obj)
 
 ALTERNET_UI_API int ScrollBar_GetEventNewPos_(ScrollBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_GetEventNewPos_");
     return MarshalExceptions<int>([&](){
         return obj->GetEventNewPos();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API int ScrollBar_GetEventNewPos_(ScrollBar* obj)
 
 ALTERNET_UI_API c_bool ScrollBar_GetIsVertical_(ScrollBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_GetIsVertical_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsVertical();
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API c_bool ScrollBar_GetIsVertical_(ScrollBar* obj)
 
 ALTERNET_UI_API void ScrollBar_SetIsVertical_(ScrollBar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_SetIsVertical_");
     MarshalExceptions<void>([&](){
         obj->SetIsVertical(value);
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API void ScrollBar_SetIsVertical_(ScrollBar* obj, c_bool value)
 
 ALTERNET_UI_API int ScrollBar_GetThumbPosition_(ScrollBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_GetThumbPosition_");
     return MarshalExceptions<int>([&](){
         return obj->GetThumbPosition();
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API int ScrollBar_GetThumbPosition_(ScrollBar* obj)
 
 ALTERNET_UI_API void ScrollBar_SetThumbPosition_(ScrollBar* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_SetThumbPosition_");
     MarshalExceptions<void>([&](){
         obj->SetThumbPosition(value);
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API void ScrollBar_SetThumbPosition_(ScrollBar* obj, int value)
 
 ALTERNET_UI_API int ScrollBar_GetRange_(ScrollBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_GetRange_");
     return MarshalExceptions<int>([&](){
         return obj->GetRange();
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API int ScrollBar_GetRange_(ScrollBar* obj)
 
 ALTERNET_UI_API int ScrollBar_GetThumbSize_(ScrollBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_GetThumbSize_");
     return MarshalExceptions<int>([&](){
         return obj->GetThumbSize();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API int ScrollBar_GetThumbSize_(ScrollBar* obj)
 
 ALTERNET_UI_API int ScrollBar_GetPageSize_(ScrollBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_GetPageSize_");
     return MarshalExceptions<int>([&](){
         return obj->GetPageSize();
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API int ScrollBar_GetPageSize_(ScrollBar* obj)
 
 ALTERNET_UI_API void ScrollBar_SetScrollbar_(ScrollBar* obj, int position, int thumbSize, int range, int pageSize, c_bool refresh)
 {
+    ALTERNET_UI_PERF_EXPORT("ScrollBar_SetScrollbar_");
     MarshalExceptions<void>([&](){
         obj->SetScrollbar(position, thumbSize, range, pageSize, refresh);
     });
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API SelectDirectoryDialog* SelectDirectoryDialog_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("SelectDirectoryDialog_Create_");
     return MarshalExceptions<SelectDirectoryDialog*>([&](){
         return new SelectDirectoryDialog();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API SelectDirectoryDialog* SelectDirectoryDialog_Create_()
 
 ALTERNET_UI_API ModalResult SelectDirectoryDialog_ShowModal_(SelectDirectoryDialog* obj, Window* owner)
 {
+    ALTERNET_UI_PERF_EXPORT("SelectDirectoryDialog_ShowModal_");
     return MarshalExceptions<ModalResult>([&](){
         return obj->ShowModal(owner);
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API ModalResult SelectDirectoryDialog_ShowModal_(SelectDirectoryDial
 
 ALTERNET_UI_API NativeStringSpan_C SelectDirectoryDialog_GetInitialDirectory_(SelectDirectoryDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("SelectDirectoryDialog_GetInitialDirectory_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetInitialDirectory();
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API NativeStringSpan_C SelectDirectoryDialog_GetInitialDirectory_(Se
 
 ALTERNET_UI_API void SelectDirectoryDialog_SetInitialDirectory_(SelectDirectoryDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("SelectDirectoryDialog_SetInitialDirectory_");
     MarshalExceptions<void>([&](){
         obj->SetInitialDirectory(*value);
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API void SelectDirectoryDialog_SetInitialDirectory_(SelectDirectoryD
 
 ALTERNET_UI_API NativeStringSpan_C SelectDirectoryDialog_GetTitle_(SelectDirectoryDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("SelectDirectoryDialog_GetTitle_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetTitle();
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API NativeStringSpan_C SelectDirectoryDialog_GetTitle_(SelectDirecto
 
 ALTERNET_UI_API void SelectDirectoryDialog_SetTitle_(SelectDirectoryDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("SelectDirectoryDialog_SetTitle_");
     MarshalExceptions<void>([&](){
         obj->SetTitle(*value);
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API void SelectDirectoryDialog_SetTitle_(SelectDirectoryDialog* obj,
 
 ALTERNET_UI_API NativeStringSpan_C SelectDirectoryDialog_GetDirectoryName_(SelectDirectoryDialog* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("SelectDirectoryDialog_GetDirectoryName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetDirectoryName();
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API NativeStringSpan_C SelectDirectoryDialog_GetDirectoryName_(Selec
 
 ALTERNET_UI_API void SelectDirectoryDialog_SetDirectoryName_(SelectDirectoryDialog* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("SelectDirectoryDialog_SetDirectoryName_");
     MarshalExceptions<void>([&](){
         obj->SetDirectoryName(*value);
     });
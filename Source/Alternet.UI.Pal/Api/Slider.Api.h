@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Slider* Slider_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_Create_");
     return MarshalExceptions<Slider*>([&](){
         return new Slider();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API Slider* Slider_Create_()
 
 ALTERNET_UI_API int Slider_GetMinimum_(Slider* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_GetMinimum_");
     return MarshalExceptions<int>([&](){
         return obj->GetMinimum();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API int Slider_GetMinimum_(Slider* obj)
 
 ALTERNET_UI_API void Slider_SetMinimum_(Slider* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_SetMinimum_");
     MarshalExceptions<void>([&](){
         obj->SetMinimum(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void Slider_SetMinimum_(Slider* obj, int value)
 
 ALTERNET_UI_API int Slider_GetMaximum_(Slider* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_GetMaximum_");
     return MarshalExceptions<int>([&](){
         return obj->GetMaximum();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API int Slider_GetMaximum_(Slider* obj)
 
 ALTERNET_UI_API void Slider_SetMaximum_(Slider* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_SetMaximum_");
     MarshalExceptions<void>([&](){
         obj->SetMaximum(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void Slider_SetMaximum_(Slider* obj, int value)
 
 ALTERNET_UI_API int Slider_GetValue_(Slider* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_GetValue_");
     return MarshalExceptions<int>([&](){
         return obj->GetValue();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API int Slider_GetValue_(Slider* obj)
 
 ALTERNET_UI_API void Slider_SetValue_(Slider* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_SetValue_");
     MarshalExceptions<void>([&](){
         obj->SetValue(value);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void Slider_SetValue_(Slider* obj, int value)
 
 ALTERNET_UI_API int Slider_GetSmallChange_(Slider* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_GetSmallChange_");
     return MarshalExceptions<int>([&](){
         return obj->GetSmallChange();
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API int Slider_GetSmallChange_(Slider* obj)
 
 ALTERNET_UI_API void Slider_SetSmallChange_(Slider* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_SetSmallChange_");
     MarshalExceptions<void>([&](){
         obj->SetSmallChange(value);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API void Slider_SetSmallChange_(Slider* obj, int value)
 
 ALTERNET_UI_API int Slider_GetLargeChange_(Slider* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_GetLargeChange_");
     return MarshalExceptions<int>([&](){
         return obj->GetLargeChange();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API int Slider_GetLargeChange_(Slider* obj)
 
 ALTERNET_UI_API void Slider_SetLargeChange_(Slider* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_SetLargeChange_");
     MarshalExceptions<void>([&](){
         obj->SetLargeChange(value);
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API void Slider_SetLargeChange_(Slider* obj, int value)
 
 ALTERNET_UI_API int Slider_GetTickFrequency_(Slider* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_GetTickFrequency_");
     return MarshalExceptions<int>([&](){
         return obj->GetTickFrequency();
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API int Slider_GetTickFrequency_(Slider* obj)
 
 ALTERNET_UI_API void Slider_SetTickFrequency_(Slider* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_SetTickFrequency_");
     MarshalExceptions<void>([&](){
         obj->SetTickFrequency(value);
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API void Slider_SetTickFrequency_(Slider* obj, int value)
 
 ALTERNET_UI_API SliderOrientation Slider_GetOrientation_(Slider* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_GetOrientation_");
     return MarshalExceptions<SliderOrientation>([&](){
         return obj->GetOrientation();
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API SliderOrientation Slider_GetOrientation_(Slider* obj)
 
 ALTERNET_UI_API void Slider_SetOrientation_(Slider* obj, SliderOrientation value)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_SetOrientation_");
     MarshalExceptions<void>([&](){
         obj->SetOrientation(value);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API void Slider_SetOrientation_(Slider* obj, SliderOrientation value
 
 ALTERNET_UI_API SliderTickStyle Slider_GetTickStyle_(Slider* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_GetTickStyle_");
     return MarshalExceptions<SliderTickStyle>([&](){
         return obj->GetTickStyle();
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API SliderTickStyle Slider_GetTickStyle_(Slider* obj)
 
 ALTERNET_UI_API void Slider_SetTickStyle_(Slider* obj, SliderTickStyle value)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_SetTickStyle_");
     MarshalExceptions<void>([&](){
         obj->SetTickStyle(value);
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API void Slider_SetTickStyle_(Slider* obj, SliderTickStyle value)
 
 ALTERNET_UI_API void Slider_ClearTicks_(Slider* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Slider_ClearTicks_");
     MarshalExceptions<void>([&](){
         obj->ClearTicks();
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API SolidBrush* SolidBrush_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("SolidBrush_Create_");
     return MarshalExceptions<SolidBrush*>([&](){
         return new SolidBrush();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API SolidBrush* SolidBrush_Create_()
 
 ALTERNET_UI_API void SolidBrush_Initialize_(SolidBrush* obj, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("SolidBrush_Initialize_");
     MarshalExceptions<void>([&](){
         obj->Initialize(*color);
     });
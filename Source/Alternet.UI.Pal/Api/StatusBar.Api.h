@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API StatusBar* StatusBar_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("StatusBar_Create_");
     #if !defined(__WXMSW__) || defined(_DEBUG)
     return MarshalExceptions<StatusBar*>([&](){
     #endif
@@ -21,6 +22,7 @@ ALTERNET_UI_API StatusBar* StatusBar_Create_()
 
 ALTERNET_UI_API void* StatusBar_GetRealHandle_(StatusBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("StatusBar_GetRealHandle_");
     #if !defined(__WXMSW__) || defined(_DEBUG)
     return MarshalExceptions<void*>([&](){
     #endif
@@ -32,6 +34,7 @@ ALTERNET_UI_API void* StatusBar_GetRealHandle_(StatusBar* obj)
 
 ALTERNET_UI_API c_bool StatusBar_GetSizingGripVisible_(StatusBar* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("StatusBar_GetSizingGripVisible_");
     #if !defined(__WXMSW__) || defined(_DEBUG)
     return MarshalExceptions<c_bool>([&](){
     #endif
@@ -43,6 +46,7 @@ ALTERNET_UI_API c_bool StatusBar_GetSizingGripVisible_(StatusBar* obj)
 
 ALTERNET_UI_API void StatusBar_SetSizingGripVisible_(StatusBar* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("StatusBar_SetSizingGripVisible_");
     #if !defined(__WXMSW__) || defined(_DEBUG)
     MarshalExceptions<void>([&](){
     #endif
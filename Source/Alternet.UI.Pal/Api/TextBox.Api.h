@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API TextBox* TextBox_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_Create_");
     return MarshalExceptions<TextBox*>([&](){
         return new TextBox();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API TextBox* TextBox_Create_()
 
 ALTERNET_UI_API int TextBox_GetTextWrap_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetTextWrap_");
     return MarshalExceptions<int>([&](){
         return obj->GetTextWrap();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API int TextBox_GetTextWrap_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetTextWrap_(TextBox* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetTextWrap_");
     MarshalExceptions<void>([&](){
         obj->SetTextWrap(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void TextBox_SetTextWrap_(TextBox* obj, int value)
 
 ALTERNET_UI_API int TextBox_GetTextAlign_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetTextAlign_");
     return MarshalExceptions<int>([&](){
         return obj->GetTextAlign();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API int TextBox_GetTextAlign_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetTextAlign_(TextBox* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetTextAlign_");
     MarshalExceptions<void>([&](){
         obj->SetTextAlign(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void TextBox_SetTextAlign_(TextBox* obj, int value)
 
 ALTERNET_UI_API c_bool TextBox_GetEditControlOnly_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetEditControlOnly_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetEditControlOnly();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API c_bool TextBox_GetEditControlOnly_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetEditControlOnly_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetEditControlOnly_");
     MarshalExceptions<void>([&](){
         obj->SetEditControlOnly(value);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void TextBox_SetEditControlOnly_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TextBox_GetReadOnly_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetReadOnly_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetReadOnly();
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API c_bool TextBox_GetReadOnly_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetReadOnly_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetReadOnly_");
     MarshalExceptions<void>([&](){
         obj->SetReadOnly(value);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API void TextBox_SetReadOnly_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API void* TextBox_GetValidator_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetValidator_");
     return MarshalExceptions<void*>([&](){
         return obj->GetValidator();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API void* TextBox_GetValidator_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetValidator_(TextBox* obj, void* value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetValidator_");
     MarshalExceptions<void>([&](){
         obj->SetValidator(value);
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API void TextBox_SetValidator_(TextBox* obj, void* value)
 
 ALTERNET_UI_API c_bool TextBox_GetMultiline_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetMultiline_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetMultiline();
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API c_bool TextBox_GetMultiline_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetMultiline_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetMultiline_");
     MarshalExceptions<void>([&](){
         obj->SetMultiline(value);
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API void TextBox_SetMultiline_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TextBox_GetIsRichEdit_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetIsRichEdit_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsRichEdit();
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API c_bool TextBox_GetIsRichEdit_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetIsRichEdit_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetIsRichEdit_");
     MarshalExceptions<void>([&](){
         obj->SetIsRichEdit(value);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API void TextBox_SetIsRichEdit_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TextBox_GetHasSelection_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetHasSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasSelection();
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API c_bool TextBox_GetHasSelection_(TextBox* obj)
 
 ALTERNET_UI_API c_bool TextBox_GetIsModified_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetIsModified_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsModified();
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API c_bool TextBox_GetIsModified_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetIsModified_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetIsModified_");
     MarshalExceptions<void>([&](){
         obj->SetIsModified(value);
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API void TextBox_SetIsModified_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TextBox_GetCanCopy_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetCanCopy_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanCopy();
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API c_bool TextBox_GetCanCopy_(TextBox* obj)
 
 ALTERNET_UI_API c_bool TextBox_GetCanCut_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetCanCut_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanCut();
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API c_bool TextBox_GetCanCut_(TextBox* obj)
 
 ALTERNET_UI_API c_bool TextBox_GetCanPaste_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetCanPaste_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanPaste();
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API c_bool TextBox_GetCanPaste_(TextBox* obj)
 
 ALTERNET_UI_API c_bool TextBox_GetCanRedo_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetCanRedo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanRedo();
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API c_bool TextBox_GetCanRedo_(TextBox* obj)
 
 ALTERNET_UI_API c_bool TextBox_GetCanUndo_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetCanUndo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanUndo();
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API c_bool TextBox_GetCanUndo_(TextBox* obj)
 
 ALTERNET_UI_API c_bool TextBox_GetIsEmpty_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetIsEmpty_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsEmpty();
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API c_bool TextBox_GetIsEmpty_(TextBox* obj)
 
 ALTERNET_UI_API c_bool TextBox_GetHideSelection_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetHideSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHideSelection();
     });
@@ -185,6 +210,7 @@ ALTERNET_UI_API c_bool TextBox_GetHideSelection_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetHideSelection_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetHideSelection_");
     MarshalExceptions<void>([&](){
         obj->SetHideSelection(value);
     });
@@ -192,6 +218,7 @@ ALTERNET_UI_API void TextBox_SetHideSelection_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TextBox_GetProcessTab_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetProcessTab_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetProcessTab();
     });
@@ -199,6 +226,7 @@ ALTERNET_UI_API c_bool TextBox_GetProcessTab_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetProcessTab_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetProcessTab_");
     MarshalExceptions<void>([&](){
         obj->SetProcessTab(value);
     });
@@ -206,6 +234,7 @@ ALTERNET_UI_API void TextBox_SetProcessTab_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TextBox_GetProcessEnter_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetProcessEnter_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetProcessEnter();
     });
@@ -213,6 +242,7 @@ ALTERNET_UI_API c_bool TextBox_GetProcessEnter_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetProcessEnter_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetProcessEnter_");
     MarshalExceptions<void>([&](){
         obj->SetProcessEnter(value);
     });
@@ -220,6 +250,7 @@ ALTERNET_UI_API void TextBox_SetProcessEnter_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TextBox_GetIsPassword_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetIsPassword_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsPassword();
     });
@@ -227,6 +258,7 @@ ALTERNET_UI_API c_bool TextBox_GetIsPassword_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetIsPassword_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetIsPassword_");
     MarshalExceptions<void>([&](){
         obj->SetIsPassword(value);
     });
@@ -234,6 +266,7 @@ ALTERNET_UI_API void TextBox_SetIsPassword_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TextBox_GetAutoUrl_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetAutoUrl_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAutoUrl();
     });
@@ -241,6 +274,7 @@ ALTERNET_UI_API c_bool TextBox_GetAutoUrl_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetAutoUrl_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetAutoUrl_");
     MarshalExceptions<void>([&](){
         obj->SetAutoUrl(value);
     });
@@ -248,6 +282,7 @@ ALTERNET_UI_API void TextBox_SetAutoUrl_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TextBox_GetHideVertScrollbar_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetHideVertScrollbar_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHideVertScrollbar();
     });
@@ -255,6 +290,7 @@ ALTERNET_UI_API c_bool TextBox_GetHideVertScrollbar_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetHideVertScrollbar_(TextBox* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetHideVertScrollbar_");
     MarshalExceptions<void>([&](){
         obj->SetHideVertScrollbar(value);
     });
@@ -262,6 +298,7 @@ ALTERNET_UI_API void TextBox_SetHideVertScrollbar_(TextBox* obj, c_bool value)
 
 ALTERNET_UI_API void* TextBox_CreateTextBox_(void* validator)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_CreateTextBox_");
     return MarshalExceptions<void*>([&](){
         return TextBox::CreateTextBox(validator);
     });
@@ -269,6 +306,7 @@ ALTERNET_UI_API void* TextBox_CreateTextBox_(void* validator)
 
 ALTERNET_UI_API NativeStringSpan_C TextBox_GetReportedUrl_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetReportedUrl_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetReportedUrl();
     });
@@ -276,6 +314,7 @@ ALTERNET_UI_API NativeStringSpan_C TextBox_GetReportedUrl_(TextBox* obj)
 
 ALTERNET_UI_API int TextBox_GetLineLength_(TextBox* obj, int64_t lineNo)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetLineLength_");
     return MarshalExceptions<int>([&](){
         return obj->GetLineLength(lineNo);
     });
@@ -283,6 +322,7 @@ ALTERNET_UI_API int TextBox_GetLineLength_(TextBox* obj, int64_t lineNo)
 
 ALTERNET_UI_API NativeStringSpan_C TextBox_GetLineText_(TextBox* obj, int64_t lineNo)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetLineText_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetLineText(lineNo);
     });
@@ -290,6 +330,7 @@ ALTERNET_UI_API NativeStringSpan_C TextBox_GetLineText_(TextBox* obj, int64_t li
 
 ALTERNET_UI_API int TextBox_GetNumberOfLines_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetNumberOfLines_");
     return MarshalExceptions<int>([&](){
         return obj->GetNumberOfLines();
     });
@@ -297,6 +338,7 @@ ALTERNET_UI_API int TextBox_GetNumberOfLines_(TextBox* obj)
 
 ALTERNET_UI_API PointI_C TextBox_PositionToXY_(TextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_PositionToXY_");
     return MarshalExceptions<PointI_C>([&](){
         return obj->PositionToXY(pos);
     });
@@ -304,6 +346,7 @@ ALTERNET_UI_API PointI_C TextBox_PositionToXY_(TextBox* obj, int64_t pos)
 
 ALTERNET_UI_API PointD_C TextBox_PositionToCoords_(TextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_PositionToCoords_");
     return MarshalExceptions<PointD_C>([&](){
         return obj->PositionToCoords(pos);
     });
@@ -311,6 +354,7 @@ ALTERNET_UI_API PointD_C TextBox_PositionToCoords_(TextBox* obj, int64_t pos)
 
 ALTERNET_UI_API void TextBox_ShowPosition_(TextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_ShowPosition_");
     MarshalExceptions<void>([&](){
         obj->ShowPosition(pos);
     });
@@ -318,6 +362,7 @@ ALTERNET_UI_API void TextBox_ShowPosition_(TextBox* obj, int64_t pos)
 
 ALTERNET_UI_API int64_t TextBox_XYToPosition_(TextBox* obj, int64_t x, int64_t y)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_XYToPosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->XYToPosition(x, y);
     });
@@ -325,6 +370,7 @@ ALTERNET_UI_API int64_t TextBox_XYToPosition_(TextBox* obj, int64_t x, int64_t y
 
 ALTERNET_UI_API void* TextBox_GetDefaultStyle_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetDefaultStyle_");
     return MarshalExceptions<void*>([&](){
         return obj->GetDefaultStyle();
     });
@@ -332,6 +378,7 @@ ALTERNET_UI_API void* TextBox_GetDefaultStyle_(TextBox* obj)
 
 ALTERNET_UI_API void* TextBox_GetStyle_(TextBox* obj, int64_t position)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetStyle_");
     return MarshalExceptions<void*>([&](){
         return obj->GetStyle(position);
     });
@@ -339,6 +386,7 @@ ALTERNET_UI_API void* TextBox_GetStyle_(TextBox* obj, int64_t position)
 
 ALTERNET_UI_API c_bool TextBox_SetDefaultStyle_(TextBox* obj, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetDefaultStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetDefaultStyle(style);
     });
@@ -346,6 +394,7 @@ ALTERNET_UI_API c_bool TextBox_SetDefaultStyle_(TextBox* obj, void* style)
 
 ALTERNET_UI_API c_bool TextBox_SetStyle_(TextBox* obj, int64_t start, int64_t end, void* style)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetStyle_");
     return MarshalExceptions<c_bool>([&](){
         return obj->SetStyle(start, end, style);
     });
@@ -353,6 +402,7 @@ ALTERNET_UI_API c_bool TextBox_SetStyle_(TextBox* obj, int64_t start, int64_t en
 
 ALTERNET_UI_API void TextBox_Clear_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_Clear_");
     MarshalExceptions<void>([&](){
         obj->Clear();
     });
@@ -360,6 +410,7 @@ ALTERNET_UI_API void TextBox_Clear_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_Copy_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_Copy_");
     MarshalExceptions<void>([&](){
         obj->Copy();
     });
@@ -367,6 +418,7 @@ ALTERNET_UI_API void TextBox_Copy_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_Cut_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_Cut_");
     MarshalExceptions<void>([&](){
         obj->Cut();
     });
@@ -374,6 +426,7 @@ ALTERNET_UI_API void TextBox_Cut_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_AppendText_(TextBox* obj, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_AppendText_");
     MarshalExceptions<void>([&](){
         obj->AppendText(*text);
     });
@@ -381,6 +434,7 @@ ALTERNET_UI_API void TextBox_AppendText_(TextBox* obj, NativeStringSpan* text)
 
 ALTERNET_UI_API int64_t TextBox_GetInsertionPoint_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetInsertionPoint_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetInsertionPoint();
     });
@@ -388,6 +442,7 @@ ALTERNET_UI_API int64_t TextBox_GetInsertionPoint_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_Paste_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_Paste_");
     MarshalExceptions<void>([&](){
         obj->Paste();
     });
@@ -395,6 +450,7 @@ ALTERNET_UI_API void TextBox_Paste_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_Redo_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_Redo_");
     MarshalExceptions<void>([&](){
         obj->Redo();
     });
@@ -402,6 +458,7 @@ ALTERNET_UI_API void TextBox_Redo_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_Remove_(TextBox* obj, int64_t from, int64_t to)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_Remove_");
     MarshalExceptions<void>([&](){
         obj->Remove(from, to);
     });
@@ -409,6 +466,7 @@ ALTERNET_UI_API void TextBox_Remove_(TextBox* obj, int64_t from, int64_t to)
 
 ALTERNET_UI_API void TextBox_Replace_(TextBox* obj, int64_t from, int64_t to, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_Replace_");
     MarshalExceptions<void>([&](){
         obj->Replace(from, to, *value);
     });
@@ -416,6 +474,7 @@ ALTERNET_UI_API void TextBox_Replace_(TextBox* obj, int64_t from, int64_t to, Na
 
 ALTERNET_UI_API void TextBox_SetInsertionPoint_(TextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetInsertionPoint_");
     MarshalExceptions<void>([&](){
         obj->SetInsertionPoint(pos);
     });
@@ -423,6 +482,7 @@ ALTERNET_UI_API void TextBox_SetInsertionPoint_(TextBox* obj, int64_t pos)
 
 ALTERNET_UI_API void TextBox_SetInsertionPointEnd_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetInsertionPointEnd_");
     MarshalExceptions<void>([&](){
         obj->SetInsertionPointEnd();
     });
@@ -430,6 +490,7 @@ ALTERNET_UI_API void TextBox_SetInsertionPointEnd_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetMaxLength_(TextBox* obj, uint64_t len)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetMaxLength_");
     MarshalExceptions<void>([&](){
         obj->SetMaxLength(len);
     });
@@ -437,6 +498,7 @@ ALTERNET_UI_API void TextBox_SetMaxLength_(TextBox* obj, uint64_t len)
 
 ALTERNET_UI_API void TextBox_SetSelection_(TextBox* obj, int64_t from, int64_t to)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetSelection_");
     MarshalExceptions<void>([&](){
         obj->SetSelection(from, to);
     });
@@ -444,6 +506,7 @@ ALTERNET_UI_API void TextBox_SetSelection_(TextBox* obj, int64_t from, int64_t t
 
 ALTERNET_UI_API void TextBox_SelectAll_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SelectAll_");
     MarshalExceptions<void>([&](){
         obj->SelectAll();
     });
@@ -451,6 +514,7 @@ ALTERNET_UI_API void TextBox_SelectAll_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SelectNone_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SelectNone_");
     MarshalExceptions<void>([&](){
         obj->SelectNone();
     });
@@ -458,6 +522,7 @@ ALTERNET_UI_API void TextBox_SelectNone_(TextBox* obj)
 
 ALTERNET_UI_API NativeStringSpan_C TextBox_GetEmptyTextHint_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetEmptyTextHint_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetEmptyTextHint();
     });
@@ -465,6 +530,7 @@ ALTERNET_UI_API NativeStringSpan_C TextBox_GetEmptyTextHint_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_SetEmptyTextHint_(TextBox* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetEmptyTextHint_");
     MarshalExceptions<void>([&](){
         obj->SetEmptyTextHint(*value);
     });
@@ -472,6 +538,7 @@ ALTERNET_UI_API void TextBox_SetEmptyTextHint_(TextBox* obj, NativeStringSpan* v
 
 ALTERNET_UI_API void TextBox_Undo_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_Undo_");
     MarshalExceptions<void>([&](){
         obj->Undo();
     });
@@ -479,6 +546,7 @@ ALTERNET_UI_API void TextBox_Undo_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_WriteText_(TextBox* obj, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_WriteText_");
     MarshalExceptions<void>([&](){
         obj->WriteText(*text);
     });
@@ -486,6 +554,7 @@ ALTERNET_UI_API void TextBox_WriteText_(TextBox* obj, NativeStringSpan* text)
 
 ALTERNET_UI_API NativeStringSpan_C TextBox_GetRange_(TextBox* obj, int64_t from, int64_t to)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetRange_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetRange(from, to);
     });
@@ -493,6 +562,7 @@ ALTERNET_UI_API NativeStringSpan_C TextBox_GetRange_(TextBox* obj, int64_t from,
 
 ALTERNET_UI_API NativeStringSpan_C TextBox_GetStringSelection_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetStringSelection_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetStringSelection();
     });
@@ -500,6 +570,7 @@ ALTERNET_UI_API NativeStringSpan_C TextBox_GetStringSelection_(TextBox* obj)
 
 ALTERNET_UI_API void TextBox_EmptyUndoBuffer_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_EmptyUndoBuffer_");
     MarshalExceptions<void>([&](){
         obj->EmptyUndoBuffer();
     });
@@ -507,6 +578,7 @@ ALTERNET_UI_API void TextBox_EmptyUndoBuffer_(TextBox* obj)
 
 ALTERNET_UI_API c_bool TextBox_IsValidPosition_(TextBox* obj, int64_t pos)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_IsValidPosition_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsValidPosition(pos);
     });
@@ -514,6 +586,7 @@ ALTERNET_UI_API c_bool TextBox_IsValidPosition_(TextBox* obj, int64_t pos)
 
 ALTERNET_UI_API int64_t TextBox_GetLastPosition_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetLastPosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetLastPosition();
     });
@@ -521,6 +594,7 @@ ALTERNET_UI_API int64_t TextBox_GetLastPosition_(TextBox* obj)
 
 ALTERNET_UI_API int64_t TextBox_GetSelectionStart_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetSelectionStart_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetSelectionStart();
     });
@@ -528,11 +602,92 @@ ALTERNET_UI_API int64_t TextBox_GetSelectionStart_(TextBox* obj)
 
 ALTERNET_UI_API int64_t TextBox_GetSelectionEnd_(TextBox* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetSelectionEnd_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetSelectionEnd();
     });
 }
 
+ALTERNET_UI_API int TextBox_RegisterStyle_(TextBox* obj, void* style)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_RegisterStyle_");
+    return MarshalExceptions<int>([&](){
+        return obj->RegisterStyle(style);
+    });
+}
+
+ALTERNET_UI_API void TextBox_ClearRegisteredStyles_(TextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_ClearRegisteredStyles_");
+    MarshalExceptions<void>([&](){
+        obj->ClearRegisteredStyles();
+    });
+}
+
+ALTERNET_UI_API void TextBox_ApplyStyleRuns_(TextBox* obj, int64_t* runs, int runsCount)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_ApplyStyleRuns_");
+    MarshalExceptions<void>([&](){
+        obj->ApplyStyleRuns(runs, runsCount);
+    });
+}
+
+ALTERNET_UI_API c_bool TextBox_GetLogMode_(TextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetLogMode_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->GetLogMode();
+    });
+}
+
+ALTERNET_UI_API void TextBox_SetLogMode_(TextBox* obj, c_bool value)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetLogMode_");
+    MarshalExceptions<void>([&](){
+        obj->SetLogMode(value);
+    });
+}
+
+ALTERNET_UI_API void TextBox_SetLogLimits_(TextBox* obj, int maxLines, int64_t maxLength)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetLogLimits_");
+    MarshalExceptions<void>([&](){
+        obj->SetLogLimits(maxLines, maxLength);
+    });
+}
+
+ALTERNET_UI_API void TextBox_FlushLog_(TextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_FlushLog_");
+    MarshalExceptions<void>([&](){
+        obj->FlushLog();
+    });
+}
+
+ALTERNET_UI_API c_bool TextBox_SetSearchPattern_(TextBox* obj, NativeStringSpan* pattern, int options)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_SetSearchPattern_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->SetSearchPattern(*pattern, options);
+    });
+}
+
+ALTERNET_UI_API int TextBox_FindMatches_(TextBox* obj, int64_t start, int64_t* results, int resultsCount, int timeBudgetMs)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_FindMatches_");
+    return MarshalExceptions<int>([&](){
+        return obj->FindMatches(start, results, resultsCount, timeBudgetMs);
+    });
+}
+
+ALTERNET_UI_API int64_t TextBox_GetSearchCursor_(TextBox* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBox_GetSearchCursor_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetSearchCursor();
+    });
+}
+
 ALTERNET_UI_API void TextBox_SetEventCallback_(TextBox::TextBoxEventCallbackType callback)
 {
     TextBox::SetEventCallback(callback);
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API TextBoxTextAttr* TextBoxTextAttr_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_Create_");
     return MarshalExceptions<TextBoxTextAttr*>([&](){
         return new TextBoxTextAttr();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API TextBoxTextAttr* TextBoxTextAttr_Create_()
 
 ALTERNET_UI_API void TextBoxTextAttr_Delete_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_Delete_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::Delete(attr);
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API void TextBoxTextAttr_Delete_(void* attr)
 
 ALTERNET_UI_API void TextBoxTextAttr_DeleteRichTextAttr_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_DeleteRichTextAttr_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::DeleteRichTextAttr(attr);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void TextBoxTextAttr_DeleteRichTextAttr_(void* attr)
 
 ALTERNET_UI_API void TextBoxTextAttr_Copy_(void* toAttr, void* fromAttr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_Copy_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::Copy(toAttr, fromAttr);
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API void TextBoxTextAttr_Copy_(void* toAttr, void* fromAttr)
 
 ALTERNET_UI_API void* TextBoxTextAttr_CreateTextAttr_()
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_CreateTextAttr_");
     return MarshalExceptions<void*>([&](){
         return TextBoxTextAttr::CreateTextAttr();
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void* TextBoxTextAttr_CreateTextAttr_()
 
 ALTERNET_UI_API void* TextBoxTextAttr_CreateRichTextAttr_()
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_CreateRichTextAttr_");
     return MarshalExceptions<void*>([&](){
         return TextBoxTextAttr::CreateRichTextAttr();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API void* TextBoxTextAttr_CreateRichTextAttr_()
 
 ALTERNET_UI_API void* TextBoxTextAttr_RichGetTextBoxAttr_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_RichGetTextBoxAttr_");
     return MarshalExceptions<void*>([&](){
         return TextBoxTextAttr::RichGetTextBoxAttr(attr);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void* TextBoxTextAttr_RichGetTextBoxAttr_(void* attr)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetTextColor_(void* attr, Color* colText)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetTextColor_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetTextColor(attr, *colText);
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetTextColor_(void* attr, Color* colText)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetBackgroundColor_(void* attr, Color* colBack)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetBackgroundColor_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetBackgroundColor(attr, *colBack);
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetBackgroundColor_(void* attr, Color* colB
 
 ALTERNET_UI_API void TextBoxTextAttr_SetAlignment_(void* attr, int alignment)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetAlignment_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetAlignment(attr, alignment);
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetAlignment_(void* attr, int alignment)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetFontPointSize_(void* attr, int pointSize)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetFontPointSize_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetFontPointSize(attr, pointSize);
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetFontPointSize_(void* attr, int pointSize
 
 ALTERNET_UI_API void TextBoxTextAttr_SetFontStyle_(void* attr, int fontStyle)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetFontStyle_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetFontStyle(attr, fontStyle);
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetFontStyle_(void* attr, int fontStyle)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetFontWeight_(void* attr, int fontWeight)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetFontWeight_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetFontWeight(attr, fontWeight);
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetFontWeight_(void* attr, int fontWeight)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetFontFaceName_(void* attr, NativeStringSpan* faceName)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetFontFaceName_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetFontFaceName(attr, *faceName);
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetFontFaceName_(void* attr, NativeStringSp
 
 ALTERNET_UI_API void TextBoxTextAttr_SetFontUnderlined_(void* attr, c_bool underlined)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetFontUnderlined_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetFontUnderlined(attr, underlined);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetFontUnderlined_(void* attr, c_bool under
 
 ALTERNET_UI_API void TextBoxTextAttr_SetFontUnderlinedEx_(void* attr, int type, Color* colour)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetFontUnderlinedEx_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetFontUnderlinedEx(attr, type, *colour);
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetFontUnderlinedEx_(void* attr, int type,
 
 ALTERNET_UI_API void TextBoxTextAttr_SetFontStrikethrough_(void* attr, c_bool strikethrough)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetFontStrikethrough_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetFontStrikethrough(attr, strikethrough);
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetFontStrikethrough_(void* attr, c_bool st
 
 ALTERNET_UI_API void TextBoxTextAttr_SetFontFamily_(void* attr, int family)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetFontFamily_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetFontFamily(attr, family);
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetFontFamily_(void* attr, int family)
 
 ALTERNET_UI_API Color_C TextBoxTextAttr_GetTextColor_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetTextColor_");
     return MarshalExceptions<Color_C>([&](){
         return TextBoxTextAttr::GetTextColor(attr);
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API Color_C TextBoxTextAttr_GetTextColor_(void* attr)
 
 ALTERNET_UI_API Color_C TextBoxTextAttr_GetBackgroundColor_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetBackgroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return TextBoxTextAttr::GetBackgroundColor(attr);
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API Color_C TextBoxTextAttr_GetBackgroundColor_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetAlignment_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetAlignment_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetAlignment(attr);
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetAlignment_(void* attr)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetURL_(void* attr, NativeStringSpan* url)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetURL_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetURL(attr, *url);
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetURL_(void* attr, NativeStringSpan* url)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetFlags_(void* attr, int64_t flags)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetFlags_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetFlags(attr, flags);
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetFlags_(void* attr, int64_t flags)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetParagraphSpacingAfter_(void* attr, int spacing)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetParagraphSpacingAfter_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetParagraphSpacingAfter(attr, spacing);
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetParagraphSpacingAfter_(void* attr, int s
 
 ALTERNET_UI_API void TextBoxTextAttr_SetParagraphSpacingBefore_(void* attr, int spacing)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetParagraphSpacingBefore_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetParagraphSpacingBefore(attr, spacing);
     });
@@ -185,6 +210,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetParagraphSpacingBefore_(void* attr, int
 
 ALTERNET_UI_API void TextBoxTextAttr_SetLineSpacing_(void* attr, int spacing)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetLineSpacing_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetLineSpacing(attr, spacing);
     });
@@ -192,6 +218,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetLineSpacing_(void* attr, int spacing)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetBulletStyle_(void* attr, int style)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetBulletStyle_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetBulletStyle(attr, style);
     });
@@ -199,6 +226,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetBulletStyle_(void* attr, int style)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetBulletNumber_(void* attr, int n)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetBulletNumber_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetBulletNumber(attr, n);
     });
@@ -206,6 +234,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetBulletNumber_(void* attr, int n)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetBulletText_(void* attr, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetBulletText_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetBulletText(attr, *text);
     });
@@ -213,6 +242,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetBulletText_(void* attr, NativeStringSpan
 
 ALTERNET_UI_API void TextBoxTextAttr_SetPageBreak_(void* attr, c_bool pageBreak)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetPageBreak_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetPageBreak(attr, pageBreak);
     });
@@ -220,6 +250,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetPageBreak_(void* attr, c_bool pageBreak)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetCharacterStyleName_(void* attr, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetCharacterStyleName_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetCharacterStyleName(attr, *name);
     });
@@ -227,6 +258,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetCharacterStyleName_(void* attr, NativeSt
 
 ALTERNET_UI_API void TextBoxTextAttr_SetParagraphStyleName_(void* attr, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetParagraphStyleName_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetParagraphStyleName(attr, *name);
     });
@@ -234,6 +266,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetParagraphStyleName_(void* attr, NativeSt
 
 ALTERNET_UI_API void TextBoxTextAttr_SetListStyleName_(void* attr, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetListStyleName_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetListStyleName(attr, *name);
     });
@@ -241,6 +274,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetListStyleName_(void* attr, NativeStringS
 
 ALTERNET_UI_API void TextBoxTextAttr_SetBulletFont_(void* attr, NativeStringSpan* bulletFont)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetBulletFont_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetBulletFont(attr, *bulletFont);
     });
@@ -248,6 +282,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetBulletFont_(void* attr, NativeStringSpan
 
 ALTERNET_UI_API void TextBoxTextAttr_SetBulletName_(void* attr, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetBulletName_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetBulletName(attr, *name);
     });
@@ -255,6 +290,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetBulletName_(void* attr, NativeStringSpan
 
 ALTERNET_UI_API void TextBoxTextAttr_SetTextEffects_(void* attr, int effects)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetTextEffects_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetTextEffects(attr, effects);
     });
@@ -262,6 +298,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetTextEffects_(void* attr, int effects)
 
 ALTERNET_UI_API void TextBoxTextAttr_SetTextEffectFlags_(void* attr, int effects)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetTextEffectFlags_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetTextEffectFlags(attr, effects);
     });
@@ -269,6 +306,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetTextEffectFlags_(void* attr, int effects
 
 ALTERNET_UI_API void TextBoxTextAttr_SetOutlineLevel_(void* attr, int level)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_SetOutlineLevel_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::SetOutlineLevel(attr, level);
     });
@@ -276,6 +314,7 @@ ALTERNET_UI_API void TextBoxTextAttr_SetOutlineLevel_(void* attr, int level)
 
 ALTERNET_UI_API int64_t TextBoxTextAttr_GetFlags_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetFlags_");
     return MarshalExceptions<int64_t>([&](){
         return TextBoxTextAttr::GetFlags(attr);
     });
@@ -283,6 +322,7 @@ ALTERNET_UI_API int64_t TextBoxTextAttr_GetFlags_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetFontSize_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetFontSize_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetFontSize(attr);
     });
@@ -290,6 +330,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetFontSize_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetFontStyle_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetFontStyle_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetFontStyle(attr);
     });
@@ -297,6 +338,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetFontStyle_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetFontWeight_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetFontWeight_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetFontWeight(attr);
     });
@@ -304,6 +346,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetFontWeight_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_GetFontUnderlined_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetFontUnderlined_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::GetFontUnderlined(attr);
     });
@@ -311,6 +354,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_GetFontUnderlined_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetUnderlineType_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetUnderlineType_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetUnderlineType(attr);
     });
@@ -318,6 +362,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetUnderlineType_(void* attr)
 
 ALTERNET_UI_API Color_C TextBoxTextAttr_GetUnderlineColor_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetUnderlineColor_");
     return MarshalExceptions<Color_C>([&](){
         return TextBoxTextAttr::GetUnderlineColor(attr);
     });
@@ -325,6 +370,7 @@ ALTERNET_UI_API Color_C TextBoxTextAttr_GetUnderlineColor_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_GetFontStrikethrough_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetFontStrikethrough_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::GetFontStrikethrough(attr);
     });
@@ -332,6 +378,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_GetFontStrikethrough_(void* attr)
 
 ALTERNET_UI_API NativeStringSpan_C TextBoxTextAttr_GetFontFaceName_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetFontFaceName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return TextBoxTextAttr::GetFontFaceName(attr);
     });
@@ -339,6 +386,7 @@ ALTERNET_UI_API NativeStringSpan_C TextBoxTextAttr_GetFontFaceName_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetFontFamily_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetFontFamily_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetFontFamily(attr);
     });
@@ -346,6 +394,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetFontFamily_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetParagraphSpacingAfter_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetParagraphSpacingAfter_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetParagraphSpacingAfter(attr);
     });
@@ -353,6 +402,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetParagraphSpacingAfter_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetParagraphSpacingBefore_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetParagraphSpacingBefore_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetParagraphSpacingBefore(attr);
     });
@@ -360,6 +410,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetParagraphSpacingBefore_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetLineSpacing_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetLineSpacing_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetLineSpacing(attr);
     });
@@ -367,6 +418,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetLineSpacing_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetBulletStyle_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetBulletStyle_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetBulletStyle(attr);
     });
@@ -374,6 +426,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetBulletStyle_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetBulletNumber_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetBulletNumber_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetBulletNumber(attr);
     });
@@ -381,6 +434,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetBulletNumber_(void* attr)
 
 ALTERNET_UI_API NativeStringSpan_C TextBoxTextAttr_GetBulletText_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetBulletText_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return TextBoxTextAttr::GetBulletText(attr);
     });
@@ -388,6 +442,7 @@ ALTERNET_UI_API NativeStringSpan_C TextBoxTextAttr_GetBulletText_(void* attr)
 
 ALTERNET_UI_API NativeStringSpan_C TextBoxTextAttr_GetURL_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetURL_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return TextBoxTextAttr::GetURL(attr);
     });
@@ -395,6 +450,7 @@ ALTERNET_UI_API NativeStringSpan_C TextBoxTextAttr_GetURL_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetTextEffects_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetTextEffects_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetTextEffects(attr);
     });
@@ -402,6 +458,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetTextEffects_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetTextEffectFlags_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetTextEffectFlags_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetTextEffectFlags(attr);
     });
@@ -409,6 +466,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetTextEffectFlags_(void* attr)
 
 ALTERNET_UI_API int TextBoxTextAttr_GetOutlineLevel_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetOutlineLevel_");
     return MarshalExceptions<int>([&](){
         return TextBoxTextAttr::GetOutlineLevel(attr);
     });
@@ -416,6 +474,7 @@ ALTERNET_UI_API int TextBoxTextAttr_GetOutlineLevel_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_IsCharacterStyle_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_IsCharacterStyle_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::IsCharacterStyle(attr);
     });
@@ -423,6 +482,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_IsCharacterStyle_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_IsParagraphStyle_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_IsParagraphStyle_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::IsParagraphStyle(attr);
     });
@@ -430,6 +490,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_IsParagraphStyle_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_IsDefault_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_IsDefault_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::IsDefault(attr);
     });
@@ -437,6 +498,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_IsDefault_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasTextColor_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasTextColor_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasTextColor(attr);
     });
@@ -444,6 +506,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasTextColor_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasBackgroundColor_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasBackgroundColor_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasBackgroundColor(attr);
     });
@@ -451,6 +514,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasBackgroundColor_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasAlignment_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasAlignment_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasAlignment(attr);
     });
@@ -458,6 +522,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasAlignment_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasTabs_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasTabs_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasTabs(attr);
     });
@@ -465,6 +530,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasTabs_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasLeftIndent_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasLeftIndent_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasLeftIndent(attr);
     });
@@ -472,6 +538,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasLeftIndent_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasRightIndent_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasRightIndent_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasRightIndent(attr);
     });
@@ -479,6 +546,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasRightIndent_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontWeight_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontWeight_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontWeight(attr);
     });
@@ -486,6 +554,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontWeight_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontSize_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontSize_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontSize(attr);
     });
@@ -493,6 +562,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontSize_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontPointSize_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontPointSize_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontPointSize(attr);
     });
@@ -500,6 +570,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontPointSize_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontPixelSize_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontPixelSize_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontPixelSize(attr);
     });
@@ -507,6 +578,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontPixelSize_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontItalic_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontItalic_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontItalic(attr);
     });
@@ -514,6 +586,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontItalic_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontUnderlined_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontUnderlined_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontUnderlined(attr);
     });
@@ -521,6 +594,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontUnderlined_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontStrikethrough_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontStrikethrough_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontStrikethrough(attr);
     });
@@ -528,6 +602,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontStrikethrough_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontFaceName_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontFaceName_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontFaceName(attr);
     });
@@ -535,6 +610,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontFaceName_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontEncoding_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontEncoding_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontEncoding(attr);
     });
@@ -542,6 +618,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontEncoding_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontFamily_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFontFamily_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFontFamily(attr);
     });
@@ -549,6 +626,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFontFamily_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFont_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFont_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFont(attr);
     });
@@ -556,6 +634,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFont_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasParagraphSpacingAfter_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasParagraphSpacingAfter_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasParagraphSpacingAfter(attr);
     });
@@ -563,6 +642,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasParagraphSpacingAfter_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasParagraphSpacingBefore_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasParagraphSpacingBefore_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasParagraphSpacingBefore(attr);
     });
@@ -570,6 +650,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasParagraphSpacingBefore_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasLineSpacing_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasLineSpacing_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasLineSpacing(attr);
     });
@@ -577,6 +658,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasLineSpacing_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasCharacterStyleName_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasCharacterStyleName_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasCharacterStyleName(attr);
     });
@@ -584,6 +666,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasCharacterStyleName_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasParagraphStyleName_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasParagraphStyleName_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasParagraphStyleName(attr);
     });
@@ -591,6 +674,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasParagraphStyleName_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasListStyleName_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasListStyleName_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasListStyleName(attr);
     });
@@ -598,6 +682,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasListStyleName_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasBulletStyle_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasBulletStyle_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasBulletStyle(attr);
     });
@@ -605,6 +690,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasBulletStyle_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasBulletNumber_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasBulletNumber_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasBulletNumber(attr);
     });
@@ -612,6 +698,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasBulletNumber_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasBulletText_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasBulletText_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasBulletText(attr);
     });
@@ -619,6 +706,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasBulletText_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasBulletName_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasBulletName_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasBulletName(attr);
     });
@@ -626,6 +714,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasBulletName_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasURL_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasURL_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasURL(attr);
     });
@@ -633,6 +722,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasURL_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasPageBreak_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasPageBreak_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasPageBreak(attr);
     });
@@ -640,6 +730,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasPageBreak_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasTextEffects_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasTextEffects_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasTextEffects(attr);
     });
@@ -647,6 +738,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasTextEffects_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasTextEffect_(void* attr, int effect)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasTextEffect_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasTextEffect(attr, effect);
     });
@@ -654,6 +746,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasTextEffect_(void* attr, int effect)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasOutlineLevel_(void* attr)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasOutlineLevel_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasOutlineLevel(attr);
     });
@@ -661,6 +754,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasOutlineLevel_(void* attr)
 
 ALTERNET_UI_API c_bool TextBoxTextAttr_HasFlag_(void* attr, int64_t flag)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_HasFlag_");
     return MarshalExceptions<c_bool>([&](){
         return TextBoxTextAttr::HasFlag(attr, flag);
     });
@@ -668,6 +762,7 @@ ALTERNET_UI_API c_bool TextBoxTextAttr_HasFlag_(void* attr, int64_t flag)
 
 ALTERNET_UI_API void TextBoxTextAttr_RemoveFlag_(void* attr, int64_t flag)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_RemoveFlag_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::RemoveFlag(attr, flag);
     });
@@ -675,8 +770,57 @@ ALTERNET_UI_API void TextBoxTextAttr_RemoveFlag_(void* attr, int64_t flag)
 
 ALTERNET_UI_API void TextBoxTextAttr_AddFlag_(void* attr, int64_t flag)
 {
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_AddFlag_");
     MarshalExceptions<void>([&](){
         TextBoxTextAttr::AddFlag(attr, flag);
     });
 }
 
+ALTERNET_UI_API int TextBoxTextAttr_InternAttr_(void* attr)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_InternAttr_");
+    return MarshalExceptions<int>([&](){
+        return TextBoxTextAttr::InternAttr(attr);
+    });
+}
+
+ALTERNET_UI_API void* TextBoxTextAttr_GetPooledAttr_(int id)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetPooledAttr_");
+    return MarshalExceptions<void*>([&](){
+        return TextBoxTextAttr::GetPooledAttr(id);
+    });
+}
+
+ALTERNET_UI_API int TextBoxTextAttr_GetPooledAttrCount_()
+{
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_GetPooledAttrCount_");
+    return MarshalExceptions<int>([&](){
+        return TextBoxTextAttr::GetPooledAttrCount();
+    });
+}
+
+ALTERNET_UI_API void TextBoxTextAttr_ClearAttrPool_()
+{
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_ClearAttrPool_");
+    MarshalExceptions<void>([&](){
+        TextBoxTextAttr::ClearAttrPool();
+    });
+}
+
+ALTERNET_UI_API c_bool TextBoxTextAttr_ReadPacked_(void* attr, void* buffer, int bufferSize)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_ReadPacked_");
+    return MarshalExceptions<c_bool>([&](){
+        return TextBoxTextAttr::ReadPacked(attr, buffer, bufferSize);
+    });
+}
+
+ALTERNET_UI_API c_bool TextBoxTextAttr_ReadPackedPooledAttr_(int id, void* buffer, int bufferSize)
+{
+    ALTERNET_UI_PERF_EXPORT("TextBoxTextAttr_ReadPackedPooledAttr_");
+    return MarshalExceptions<c_bool>([&](){
+        return TextBoxTextAttr::ReadPackedPooledAttr(id, buffer, bufferSize);
+    });
+}
+
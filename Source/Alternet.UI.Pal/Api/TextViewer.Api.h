@@ -0,0 +1,194 @@
+// <auto-generated> DO NOT MODIFY MANUALLY. Copyright (c) 2026 AlterNET Software.</auto-generated>
+
+#pragma once
+
+#include "TextViewer.h"
+#include "ApiUtils.h"
+#include "Exceptions.h"
+
+using namespace Alternet::UI;
+
+ALTERNET_UI_API TextViewer* TextViewer_Create_()
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_Create_");
+    return MarshalExceptions<TextViewer*>([&](){
+        return new TextViewer();
+    });
+}
+
+ALTERNET_UI_API c_bool TextViewer_LoadFile_(TextViewer* obj, NativeStringSpan* path)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_LoadFile_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->LoadFile(*path);
+    });
+}
+
+ALTERNET_UI_API void TextViewer_SetText_(TextViewer* obj, NativeStringSpan* text)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_SetText_");
+    MarshalExceptions<void>([&](){
+        obj->SetText(*text);
+    });
+}
+
+ALTERNET_UI_API void TextViewer_AppendText_(TextViewer* obj, NativeStringSpan* text)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_AppendText_");
+    MarshalExceptions<void>([&](){
+        obj->AppendText(*text);
+    });
+}
+
+ALTERNET_UI_API void TextViewer_ClearText_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_ClearText_");
+    MarshalExceptions<void>([&](){
+        obj->ClearText();
+    });
+}
+
+ALTERNET_UI_API int64_t TextViewer_GetLength_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetLength_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetLength();
+    });
+}
+
+ALTERNET_UI_API int64_t TextViewer_GetLineCount_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetLineCount_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetLineCount();
+    });
+}
+
+ALTERNET_UI_API c_bool TextViewer_GetIsIndexing_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetIsIndexing_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->GetIsIndexing();
+    });
+}
+
+ALTERNET_UI_API int64_t TextViewer_GetLineStart_(TextViewer* obj, int64_t line)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetLineStart_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetLineStart(line);
+    });
+}
+
+ALTERNET_UI_API int64_t TextViewer_GetLineFromOffset_(TextViewer* obj, int64_t offset)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetLineFromOffset_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetLineFromOffset(offset);
+    });
+}
+
+ALTERNET_UI_API NativeStringSpan_C TextViewer_GetLineText_(TextViewer* obj, int64_t line)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetLineText_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return obj->GetLineText(line);
+    });
+}
+
+ALTERNET_UI_API NativeStringSpan_C TextViewer_GetTextRange_(TextViewer* obj, int64_t offset, int64_t length)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetTextRange_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return obj->GetTextRange(offset, length);
+    });
+}
+
+ALTERNET_UI_API int64_t TextViewer_FindText_(TextViewer* obj, NativeStringSpan* text, int64_t start, c_bool matchCase)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_FindText_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->FindText(*text, start, matchCase);
+    });
+}
+
+ALTERNET_UI_API void TextViewer_SetSelection_(TextViewer* obj, int64_t start, int64_t end)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_SetSelection_");
+    MarshalExceptions<void>([&](){
+        obj->SetSelection(start, end);
+    });
+}
+
+ALTERNET_UI_API int64_t TextViewer_GetSelectionStart_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetSelectionStart_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetSelectionStart();
+    });
+}
+
+ALTERNET_UI_API int64_t TextViewer_GetSelectionEnd_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetSelectionEnd_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetSelectionEnd();
+    });
+}
+
+ALTERNET_UI_API void TextViewer_SelectAll_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_SelectAll_");
+    MarshalExceptions<void>([&](){
+        obj->SelectAll();
+    });
+}
+
+ALTERNET_UI_API NativeStringSpan_C TextViewer_GetSelectedText_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetSelectedText_");
+    return MarshalExceptions<NativeStringSpan_C>([&](){
+        return obj->GetSelectedText();
+    });
+}
+
+ALTERNET_UI_API c_bool TextViewer_CopySelection_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_CopySelection_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->CopySelection();
+    });
+}
+
+ALTERNET_UI_API void TextViewer_ScrollToLine_(TextViewer* obj, int64_t line)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_ScrollToLine_");
+    MarshalExceptions<void>([&](){
+        obj->ScrollToLine(line);
+    });
+}
+
+ALTERNET_UI_API void TextViewer_ScrollToOffset_(TextViewer* obj, int64_t offset)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_ScrollToOffset_");
+    MarshalExceptions<void>([&](){
+        obj->ScrollToOffset(offset);
+    });
+}
+
+ALTERNET_UI_API int64_t TextViewer_GetFirstVisibleLine_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetFirstVisibleLine_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->GetFirstVisibleLine();
+    });
+}
+
+ALTERNET_UI_API int TextViewer_GetVisibleLineCount_(TextViewer* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("TextViewer_GetVisibleLineCount_");
+    return MarshalExceptions<int>([&](){
+        return obj->GetVisibleLineCount();
+    });
+}
+
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API TextureBrush* TextureBrush_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("TextureBrush_Create_");
     return MarshalExceptions<TextureBrush*>([&](){
         return new TextureBrush();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API TextureBrush* TextureBrush_Create_()
 
 ALTERNET_UI_API void TextureBrush_Initialize_(TextureBrush* obj, Image* image)
 {
+    ALTERNET_UI_PERF_EXPORT("TextureBrush_Initialize_");
     MarshalExceptions<void>([&](){
         obj->Initialize(image);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Timer* Timer_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Timer_Create_");
     return MarshalExceptions<Timer*>([&](){
         return new Timer();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API Timer* Timer_Create_()
 
 ALTERNET_UI_API c_bool Timer_GetEnabled_(Timer* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Timer_GetEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetEnabled();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API c_bool Timer_GetEnabled_(Timer* obj)
 
 ALTERNET_UI_API void Timer_SetEnabled_(Timer* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Timer_SetEnabled_");
     MarshalExceptions<void>([&](){
         obj->SetEnabled(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void Timer_SetEnabled_(Timer* obj, c_bool value)
 
 ALTERNET_UI_API int Timer_GetInterval_(Timer* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Timer_GetInterval_");
     return MarshalExceptions<int>([&](){
         return obj->GetInterval();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API int Timer_GetInterval_(Timer* obj)
 
 ALTERNET_UI_API void Timer_SetInterval_(Timer* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("Timer_SetInterval_");
     MarshalExceptions<void>([&](){
         obj->SetInterval(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void Timer_SetInterval_(Timer* obj, int value)
 
 ALTERNET_UI_API c_bool Timer_GetAutoReset_(Timer* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Timer_GetAutoReset_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAutoReset();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API c_bool Timer_GetAutoReset_(Timer* obj)
 
 ALTERNET_UI_API void Timer_SetAutoReset_(Timer* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Timer_SetAutoReset_");
     MarshalExceptions<void>([&](){
         obj->SetAutoReset(value);
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API void Timer_SetAutoReset_(Timer* obj, c_bool value)
 
 ALTERNET_UI_API void Timer_Restart_(Timer* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Timer_Restart_");
     MarshalExceptions<void>([&](){
         obj->Restart();
     });
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API TreeView* TreeView_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_Create_");
     return MarshalExceptions<TreeView*>([&](){
         return new TreeView();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API TreeView* TreeView_Create_()
 
 ALTERNET_UI_API int64_t TreeView_GetCreateStyle_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetCreateStyle_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetCreateStyle();
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API int64_t TreeView_GetCreateStyle_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetCreateStyle_(TreeView* obj, int64_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetCreateStyle_");
     MarshalExceptions<void>([&](){
         obj->SetCreateStyle(value);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void TreeView_SetCreateStyle_(TreeView* obj, int64_t value)
 
 ALTERNET_UI_API c_bool TreeView_GetHideRoot_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetHideRoot_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHideRoot();
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API c_bool TreeView_GetHideRoot_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetHideRoot_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetHideRoot_");
     MarshalExceptions<void>([&](){
         obj->SetHideRoot(value);
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API void TreeView_SetHideRoot_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TreeView_GetVariableRowHeight_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetVariableRowHeight_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetVariableRowHeight();
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API c_bool TreeView_GetVariableRowHeight_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetVariableRowHeight_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetVariableRowHeight_");
     MarshalExceptions<void>([&](){
         obj->SetVariableRowHeight(value);
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API void TreeView_SetVariableRowHeight_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TreeView_GetTwistButtons_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetTwistButtons_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetTwistButtons();
     });
@@ -67,6 +75,7 @@ ALTERNET_UI_API c_bool TreeView_GetTwistButtons_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetTwistButtons_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetTwistButtons_");
     MarshalExceptions<void>([&](){
         obj->SetTwistButtons(value);
     });
@@ -74,6 +83,7 @@ ALTERNET_UI_API void TreeView_SetTwistButtons_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API uint32_t TreeView_GetStateImageSpacing_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetStateImageSpacing_");
     return MarshalExceptions<uint32_t>([&](){
         return obj->GetStateImageSpacing();
     });
@@ -81,6 +91,7 @@ ALTERNET_UI_API uint32_t TreeView_GetStateImageSpacing_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetStateImageSpacing_(TreeView* obj, uint32_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetStateImageSpacing_");
     MarshalExceptions<void>([&](){
         obj->SetStateImageSpacing(value);
     });
@@ -88,6 +99,7 @@ ALTERNET_UI_API void TreeView_SetStateImageSpacing_(TreeView* obj, uint32_t valu
 
 ALTERNET_UI_API uint32_t TreeView_GetIndentation_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetIndentation_");
     return MarshalExceptions<uint32_t>([&](){
         return obj->GetIndentation();
     });
@@ -95,6 +107,7 @@ ALTERNET_UI_API uint32_t TreeView_GetIndentation_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetIndentation_(TreeView* obj, uint32_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetIndentation_");
     MarshalExceptions<void>([&](){
         obj->SetIndentation(value);
     });
@@ -102,6 +115,7 @@ ALTERNET_UI_API void TreeView_SetIndentation_(TreeView* obj, uint32_t value)
 
 ALTERNET_UI_API c_bool TreeView_GetRowLines_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetRowLines_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetRowLines();
     });
@@ -109,6 +123,7 @@ ALTERNET_UI_API c_bool TreeView_GetRowLines_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetRowLines_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetRowLines_");
     MarshalExceptions<void>([&](){
         obj->SetRowLines(value);
     });
@@ -116,6 +131,7 @@ ALTERNET_UI_API void TreeView_SetRowLines_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TreeView_GetHasBorder_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -123,6 +139,7 @@ ALTERNET_UI_API c_bool TreeView_GetHasBorder_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetHasBorder_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -130,6 +147,7 @@ ALTERNET_UI_API void TreeView_SetHasBorder_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API ImageList* TreeView_GetImageList_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetImageList_");
     return MarshalExceptions<ImageList*>([&](){
         return obj->GetImageList();
     });
@@ -137,6 +155,7 @@ ALTERNET_UI_API ImageList* TreeView_GetImageList_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetImageList_(TreeView* obj, ImageList* value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetImageList_");
     MarshalExceptions<void>([&](){
         obj->SetImageList(value);
     });
@@ -144,6 +163,7 @@ ALTERNET_UI_API void TreeView_SetImageList_(TreeView* obj, ImageList* value)
 
 ALTERNET_UI_API void* TreeView_GetRootItem_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetRootItem_");
     return MarshalExceptions<void*>([&](){
         return obj->GetRootItem();
     });
@@ -151,6 +171,7 @@ ALTERNET_UI_API void* TreeView_GetRootItem_(TreeView* obj)
 
 ALTERNET_UI_API TreeViewSelectionMode TreeView_GetSelectionMode_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetSelectionMode_");
     return MarshalExceptions<TreeViewSelectionMode>([&](){
         return obj->GetSelectionMode();
     });
@@ -158,6 +179,7 @@ ALTERNET_UI_API TreeViewSelectionMode TreeView_GetSelectionMode_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetSelectionMode_(TreeView* obj, TreeViewSelectionMode value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetSelectionMode_");
     MarshalExceptions<void>([&](){
         obj->SetSelectionMode(value);
     });
@@ -165,6 +187,7 @@ ALTERNET_UI_API void TreeView_SetSelectionMode_(TreeView* obj, TreeViewSelection
 
 ALTERNET_UI_API c_bool TreeView_GetShowLines_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetShowLines_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowLines();
     });
@@ -172,6 +195,7 @@ ALTERNET_UI_API c_bool TreeView_GetShowLines_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetShowLines_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetShowLines_");
     MarshalExceptions<void>([&](){
         obj->SetShowLines(value);
     });
@@ -179,6 +203,7 @@ ALTERNET_UI_API void TreeView_SetShowLines_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TreeView_GetShowRootLines_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetShowRootLines_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowRootLines();
     });
@@ -186,6 +211,7 @@ ALTERNET_UI_API c_bool TreeView_GetShowRootLines_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetShowRootLines_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetShowRootLines_");
     MarshalExceptions<void>([&](){
         obj->SetShowRootLines(value);
     });
@@ -193,6 +219,7 @@ ALTERNET_UI_API void TreeView_SetShowRootLines_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TreeView_GetShowExpandButtons_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetShowExpandButtons_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowExpandButtons();
     });
@@ -200,6 +227,7 @@ ALTERNET_UI_API c_bool TreeView_GetShowExpandButtons_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetShowExpandButtons_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetShowExpandButtons_");
     MarshalExceptions<void>([&](){
         obj->SetShowExpandButtons(value);
     });
@@ -207,6 +235,7 @@ ALTERNET_UI_API void TreeView_SetShowExpandButtons_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API void* TreeView_GetTopItem_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetTopItem_");
     return MarshalExceptions<void*>([&](){
         return obj->GetTopItem();
     });
@@ -214,6 +243,7 @@ ALTERNET_UI_API void* TreeView_GetTopItem_(TreeView* obj)
 
 ALTERNET_UI_API c_bool TreeView_GetFullRowSelect_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetFullRowSelect_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetFullRowSelect();
     });
@@ -221,6 +251,7 @@ ALTERNET_UI_API c_bool TreeView_GetFullRowSelect_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetFullRowSelect_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetFullRowSelect_");
     MarshalExceptions<void>([&](){
         obj->SetFullRowSelect(value);
     });
@@ -228,6 +259,7 @@ ALTERNET_UI_API void TreeView_SetFullRowSelect_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API c_bool TreeView_GetAllowLabelEdit_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetAllowLabelEdit_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAllowLabelEdit();
     });
@@ -235,6 +267,7 @@ ALTERNET_UI_API c_bool TreeView_GetAllowLabelEdit_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetAllowLabelEdit_(TreeView* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetAllowLabelEdit_");
     MarshalExceptions<void>([&](){
         obj->SetAllowLabelEdit(value);
     });
@@ -242,6 +275,7 @@ ALTERNET_UI_API void TreeView_SetAllowLabelEdit_(TreeView* obj, c_bool value)
 
 ALTERNET_UI_API void* TreeView_OpenSelectedItemsArray_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_OpenSelectedItemsArray_");
     return MarshalExceptions<void*>([&](){
         return obj->OpenSelectedItemsArray();
     });
@@ -249,6 +283,7 @@ ALTERNET_UI_API void* TreeView_OpenSelectedItemsArray_(TreeView* obj)
 
 ALTERNET_UI_API int TreeView_GetSelectedItemsItemCount_(TreeView* obj, void* array)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetSelectedItemsItemCount_");
     return MarshalExceptions<int>([&](){
         return obj->GetSelectedItemsItemCount(array);
     });
@@ -256,6 +291,7 @@ ALTERNET_UI_API int TreeView_GetSelectedItemsItemCount_(TreeView* obj, void* arr
 
 ALTERNET_UI_API void* TreeView_GetSelectedItemsItemAt_(TreeView* obj, void* array, int index)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetSelectedItemsItemAt_");
     return MarshalExceptions<void*>([&](){
         return obj->GetSelectedItemsItemAt(array, index);
     });
@@ -263,6 +299,7 @@ ALTERNET_UI_API void* TreeView_GetSelectedItemsItemAt_(TreeView* obj, void* arra
 
 ALTERNET_UI_API void TreeView_CloseSelectedItemsArray_(TreeView* obj, void* array)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_CloseSelectedItemsArray_");
     MarshalExceptions<void>([&](){
         obj->CloseSelectedItemsArray(array);
     });
@@ -270,6 +307,7 @@ ALTERNET_UI_API void TreeView_CloseSelectedItemsArray_(TreeView* obj, void* arra
 
 ALTERNET_UI_API void TreeView_SetItemBold_(void* handle, void* item, c_bool bold)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetItemBold_");
     MarshalExceptions<void>([&](){
         TreeView::SetItemBold(handle, item, bold);
     });
@@ -277,6 +315,7 @@ ALTERNET_UI_API void TreeView_SetItemBold_(void* handle, void* item, c_bool bold
 
 ALTERNET_UI_API Color_C TreeView_GetItemTextColor_(void* handle, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetItemTextColor_");
     return MarshalExceptions<Color_C>([&](){
         return TreeView::GetItemTextColor(handle, item);
     });
@@ -284,6 +323,7 @@ ALTERNET_UI_API Color_C TreeView_GetItemTextColor_(void* handle, void* item)
 
 ALTERNET_UI_API Color_C TreeView_GetItemBackgroundColor_(void* handle, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetItemBackgroundColor_");
     return MarshalExceptions<Color_C>([&](){
         return TreeView::GetItemBackgroundColor(handle, item);
     });
@@ -291,6 +331,7 @@ ALTERNET_UI_API Color_C TreeView_GetItemBackgroundColor_(void* handle, void* ite
 
 ALTERNET_UI_API void TreeView_SetItemTextColor_(void* handle, void* item, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetItemTextColor_");
     MarshalExceptions<void>([&](){
         TreeView::SetItemTextColor(handle, item, *color);
     });
@@ -298,6 +339,7 @@ ALTERNET_UI_API void TreeView_SetItemTextColor_(void* handle, void* item, Color*
 
 ALTERNET_UI_API void TreeView_SetItemBackgroundColor_(void* handle, void* item, Color* color)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetItemBackgroundColor_");
     MarshalExceptions<void>([&](){
         TreeView::SetItemBackgroundColor(handle, item, *color);
     });
@@ -305,6 +347,7 @@ ALTERNET_UI_API void TreeView_SetItemBackgroundColor_(void* handle, void* item,
 
 ALTERNET_UI_API void TreeView_ResetItemTextColor_(void* handle, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_ResetItemTextColor_");
     MarshalExceptions<void>([&](){
         TreeView::ResetItemTextColor(handle, item);
     });
@@ -312,6 +355,7 @@ ALTERNET_UI_API void TreeView_ResetItemTextColor_(void* handle, void* item)
 
 ALTERNET_UI_API void TreeView_ResetItemBackgroundColor_(void* handle, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_ResetItemBackgroundColor_");
     MarshalExceptions<void>([&](){
         TreeView::ResetItemBackgroundColor(handle, item);
     });
@@ -319,6 +363,7 @@ ALTERNET_UI_API void TreeView_ResetItemBackgroundColor_(void* handle, void* item
 
 ALTERNET_UI_API void TreeView_SetNodeUniqueId_(TreeView* obj, void* node, int64_t uniqueId)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetNodeUniqueId_");
     MarshalExceptions<void>([&](){
         obj->SetNodeUniqueId(node, uniqueId);
     });
@@ -326,6 +371,7 @@ ALTERNET_UI_API void TreeView_SetNodeUniqueId_(TreeView* obj, void* node, int64_
 
 ALTERNET_UI_API int64_t TreeView_GetNodeUniqueId_(TreeView* obj, void* node)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetNodeUniqueId_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetNodeUniqueId(node);
     });
@@ -333,6 +379,7 @@ ALTERNET_UI_API int64_t TreeView_GetNodeUniqueId_(TreeView* obj, void* node)
 
 ALTERNET_UI_API void TreeView_MakeAsListBox_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_MakeAsListBox_");
     MarshalExceptions<void>([&](){
         obj->MakeAsListBox();
     });
@@ -340,6 +387,7 @@ ALTERNET_UI_API void TreeView_MakeAsListBox_(TreeView* obj)
 
 ALTERNET_UI_API int TreeView_GetItemCount_(TreeView* obj, void* parentItem)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetItemCount_");
     return MarshalExceptions<int>([&](){
         return obj->GetItemCount(parentItem);
     });
@@ -347,6 +395,7 @@ ALTERNET_UI_API int TreeView_GetItemCount_(TreeView* obj, void* parentItem)
 
 ALTERNET_UI_API void* TreeView_InsertItem_(TreeView* obj, void* parentItem, void* insertAfter, NativeStringSpan* text, int imageIndex, c_bool parentIsExpanded)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_InsertItem_");
     return MarshalExceptions<void*>([&](){
         return obj->InsertItem(parentItem, insertAfter, *text, imageIndex, parentIsExpanded);
     });
@@ -354,6 +403,7 @@ ALTERNET_UI_API void* TreeView_InsertItem_(TreeView* obj, void* parentItem, void
 
 ALTERNET_UI_API void TreeView_RemoveItem_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_RemoveItem_");
     MarshalExceptions<void>([&](){
         obj->RemoveItem(item);
     });
@@ -361,6 +411,7 @@ ALTERNET_UI_API void TreeView_RemoveItem_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_ClearItems_(TreeView* obj, void* parentItem)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_ClearItems_");
     MarshalExceptions<void>([&](){
         obj->ClearItems(parentItem);
     });
@@ -368,6 +419,7 @@ ALTERNET_UI_API void TreeView_ClearItems_(TreeView* obj, void* parentItem)
 
 ALTERNET_UI_API void TreeView_ClearSelected_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_ClearSelected_");
     MarshalExceptions<void>([&](){
         obj->ClearSelected();
     });
@@ -375,6 +427,7 @@ ALTERNET_UI_API void TreeView_ClearSelected_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_SetSelected_(TreeView* obj, void* item, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetSelected_");
     MarshalExceptions<void>([&](){
         obj->SetSelected(item, value);
     });
@@ -382,6 +435,7 @@ ALTERNET_UI_API void TreeView_SetSelected_(TreeView* obj, void* item, c_bool val
 
 ALTERNET_UI_API void TreeView_DeleteAllItems_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_DeleteAllItems_");
     MarshalExceptions<void>([&](){
         obj->DeleteAllItems();
     });
@@ -389,6 +443,7 @@ ALTERNET_UI_API void TreeView_DeleteAllItems_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_ExpandAll_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_ExpandAll_");
     MarshalExceptions<void>([&](){
         obj->ExpandAll();
     });
@@ -396,6 +451,7 @@ ALTERNET_UI_API void TreeView_ExpandAll_(TreeView* obj)
 
 ALTERNET_UI_API void TreeView_CollapseAll_(TreeView* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_CollapseAll_");
     MarshalExceptions<void>([&](){
         obj->CollapseAll();
     });
@@ -403,6 +459,7 @@ ALTERNET_UI_API void TreeView_CollapseAll_(TreeView* obj)
 
 ALTERNET_UI_API void* TreeView_ItemHitTest_(TreeView* obj, PointD* point)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_ItemHitTest_");
     return MarshalExceptions<void*>([&](){
         return obj->ItemHitTest(*point);
     });
@@ -410,6 +467,7 @@ ALTERNET_UI_API void* TreeView_ItemHitTest_(TreeView* obj, PointD* point)
 
 ALTERNET_UI_API TreeViewHitTestLocations TreeView_GetHitTestResultLocations_(TreeView* obj, void* hitTestResult)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetHitTestResultLocations_");
     return MarshalExceptions<TreeViewHitTestLocations>([&](){
         return obj->GetHitTestResultLocations(hitTestResult);
     });
@@ -417,6 +475,7 @@ ALTERNET_UI_API TreeViewHitTestLocations TreeView_GetHitTestResultLocations_(Tre
 
 ALTERNET_UI_API void* TreeView_GetHitTestResultItem_(TreeView* obj, void* hitTestResult)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetHitTestResultItem_");
     return MarshalExceptions<void*>([&](){
         return obj->GetHitTestResultItem(hitTestResult);
     });
@@ -424,6 +483,7 @@ ALTERNET_UI_API void* TreeView_GetHitTestResultItem_(TreeView* obj, void* hitTes
 
 ALTERNET_UI_API void TreeView_FreeHitTestResult_(TreeView* obj, void* hitTestResult)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_FreeHitTestResult_");
     MarshalExceptions<void>([&](){
         obj->FreeHitTestResult(hitTestResult);
     });
@@ -431,6 +491,7 @@ ALTERNET_UI_API void TreeView_FreeHitTestResult_(TreeView* obj, void* hitTestRes
 
 ALTERNET_UI_API c_bool TreeView_IsItemSelected_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_IsItemSelected_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsItemSelected(item);
     });
@@ -438,6 +499,7 @@ ALTERNET_UI_API c_bool TreeView_IsItemSelected_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_SetFocused_(TreeView* obj, void* item, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetFocused_");
     MarshalExceptions<void>([&](){
         obj->SetFocused(item, value);
     });
@@ -445,6 +507,7 @@ ALTERNET_UI_API void TreeView_SetFocused_(TreeView* obj, void* item, c_bool valu
 
 ALTERNET_UI_API c_bool TreeView_IsItemFocused_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_IsItemFocused_");
     return MarshalExceptions<c_bool>([&](){
         return obj->IsItemFocused(item);
     });
@@ -452,6 +515,7 @@ ALTERNET_UI_API c_bool TreeView_IsItemFocused_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_SetItemText_(TreeView* obj, void* item, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetItemText_");
     MarshalExceptions<void>([&](){
         obj->SetItemText(item, *text);
     });
@@ -459,6 +523,7 @@ ALTERNET_UI_API void TreeView_SetItemText_(TreeView* obj, void* item, NativeStri
 
 ALTERNET_UI_API NativeStringSpan_C TreeView_GetItemText_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetItemText_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetItemText(item);
     });
@@ -466,6 +531,7 @@ ALTERNET_UI_API NativeStringSpan_C TreeView_GetItemText_(TreeView* obj, void* it
 
 ALTERNET_UI_API void TreeView_SetItemImageIndex_(TreeView* obj, void* item, int imageIndex)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_SetItemImageIndex_");
     MarshalExceptions<void>([&](){
         obj->SetItemImageIndex(item, imageIndex);
     });
@@ -473,6 +539,7 @@ ALTERNET_UI_API void TreeView_SetItemImageIndex_(TreeView* obj, void* item, int
 
 ALTERNET_UI_API int TreeView_GetItemImageIndex_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_GetItemImageIndex_");
     return MarshalExceptions<int>([&](){
         return obj->GetItemImageIndex(item);
     });
@@ -480,6 +547,7 @@ ALTERNET_UI_API int TreeView_GetItemImageIndex_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_BeginLabelEdit_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_BeginLabelEdit_");
     MarshalExceptions<void>([&](){
         obj->BeginLabelEdit(item);
     });
@@ -487,6 +555,7 @@ ALTERNET_UI_API void TreeView_BeginLabelEdit_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_EndLabelEdit_(TreeView* obj, void* item, c_bool cancel)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_EndLabelEdit_");
     MarshalExceptions<void>([&](){
         obj->EndLabelEdit(item, cancel);
     });
@@ -494,6 +563,7 @@ ALTERNET_UI_API void TreeView_EndLabelEdit_(TreeView* obj, void* item, c_bool ca
 
 ALTERNET_UI_API void TreeView_ExpandItem_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_ExpandItem_");
     MarshalExceptions<void>([&](){
         obj->ExpandItem(item);
     });
@@ -501,6 +571,7 @@ ALTERNET_UI_API void TreeView_ExpandItem_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_CollapseItem_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_CollapseItem_");
     MarshalExceptions<void>([&](){
         obj->CollapseItem(item);
     });
@@ -508,6 +579,7 @@ ALTERNET_UI_API void TreeView_CollapseItem_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_ExpandAllChildren_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_ExpandAllChildren_");
     MarshalExceptions<void>([&](){
         obj->ExpandAllChildren(item);
     });
@@ -515,6 +587,7 @@ ALTERNET_UI_API void TreeView_ExpandAllChildren_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_CollapseAllChildren_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_CollapseAllChildren_");
     MarshalExceptions<void>([&](){
         obj->CollapseAllChildren(item);
     });
@@ -522,6 +595,7 @@ ALTERNET_UI_API void TreeView_CollapseAllChildren_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_EnsureVisible_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_EnsureVisible_");
     MarshalExceptions<void>([&](){
         obj->EnsureVisible(item);
     });
@@ -529,6 +603,7 @@ ALTERNET_UI_API void TreeView_EnsureVisible_(TreeView* obj, void* item)
 
 ALTERNET_UI_API void TreeView_ScrollIntoView_(TreeView* obj, void* item)
 {
+    ALTERNET_UI_PERF_EXPORT("TreeView_ScrollIntoView_");
     MarshalExceptions<void>([&](){
         obj->ScrollIntoView(item);
     });
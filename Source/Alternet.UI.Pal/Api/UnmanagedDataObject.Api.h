@@ -12,6 +12,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API UnmanagedDataObject* UnmanagedDataObject_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_Create_");
     return MarshalExceptions<UnmanagedDataObject*>([&](){
         return new UnmanagedDataObject();
     });
@@ -19,6 +20,7 @@ ALTERNET_UI_API UnmanagedDataObject* UnmanagedDataObject_Create_()
 
 ALTERNET_UI_API NativeStringSpan_C UnmanagedDataObject_GetFormats_(UnmanagedDataObject* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_GetFormats_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetFormats();
     });
@@ -26,6 +28,7 @@ ALTERNET_UI_API NativeStringSpan_C UnmanagedDataObject_GetFormats_(UnmanagedData
 
 ALTERNET_UI_API NativeStringSpan_C UnmanagedDataObject_GetStringData_(UnmanagedDataObject* obj, NativeStringSpan* format)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_GetStringData_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetStringData(*format);
     });
@@ -33,6 +36,7 @@ ALTERNET_UI_API NativeStringSpan_C UnmanagedDataObject_GetStringData_(UnmanagedD
 
 ALTERNET_UI_API NativeStringSpan_C UnmanagedDataObject_GetFileNamesData_(UnmanagedDataObject* obj, NativeStringSpan* format)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_GetFileNamesData_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetFileNamesData(*format);
     });
@@ -40,6 +44,7 @@ ALTERNET_UI_API NativeStringSpan_C UnmanagedDataObject_GetFileNamesData_(Unmanag
 
 ALTERNET_UI_API UnmanagedStream* UnmanagedDataObject_GetStreamData_(UnmanagedDataObject* obj, NativeStringSpan* format)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_GetStreamData_");
     return MarshalExceptions<UnmanagedStream*>([&](){
         return obj->GetStreamData(*format);
     });
@@ -47,6 +52,7 @@ ALTERNET_UI_API UnmanagedStream* UnmanagedDataObject_GetStreamData_(UnmanagedDat
 
 ALTERNET_UI_API void UnmanagedDataObject_SetStringData_(UnmanagedDataObject* obj, NativeStringSpan* format, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_SetStringData_");
     MarshalExceptions<void>([&](){
         obj->SetStringData(*format, *value);
     });
@@ -54,6 +60,7 @@ ALTERNET_UI_API void UnmanagedDataObject_SetStringData_(UnmanagedDataObject* obj
 
 ALTERNET_UI_API void UnmanagedDataObject_SetFileNamesData_(UnmanagedDataObject* obj, NativeStringSpan* format, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_SetFileNamesData_");
     MarshalExceptions<void>([&](){
         obj->SetFileNamesData(*format, *value);
     });
@@ -61,6 +68,7 @@ ALTERNET_UI_API void UnmanagedDataObject_SetFileNamesData_(UnmanagedDataObject*
 
 ALTERNET_UI_API void UnmanagedDataObject_SetStreamData_(UnmanagedDataObject* obj, NativeStringSpan* format, void* value)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_SetStreamData_");
     MarshalExceptions<void>([&](){
         obj->SetStreamData(*format, value);
     });
@@ -68,6 +76,7 @@ ALTERNET_UI_API void UnmanagedDataObject_SetStreamData_(UnmanagedDataObject* obj
 
 ALTERNET_UI_API c_bool UnmanagedDataObject_GetDataPresent_(UnmanagedDataObject* obj, NativeStringSpan* format)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_GetDataPresent_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetDataPresent(*format);
     });
@@ -75,6 +84,7 @@ ALTERNET_UI_API c_bool UnmanagedDataObject_GetDataPresent_(UnmanagedDataObject*
 
 ALTERNET_UI_API c_bool UnmanagedDataObject_GetNativeDataPresent_(UnmanagedDataObject* obj, int format)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedDataObject_GetNativeDataPresent_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetNativeDataPresent(format);
     });
@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API UnmanagedStream* UnmanagedStream_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedStream_Create_");
     return MarshalExceptions<UnmanagedStream*>([&](){
         return new UnmanagedStream();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API UnmanagedStream* UnmanagedStream_Create_()
 
 ALTERNET_UI_API int64_t UnmanagedStream_GetLength_(UnmanagedStream* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedStream_GetLength_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetLength();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API int64_t UnmanagedStream_GetLength_(UnmanagedStream* obj)
 
 ALTERNET_UI_API c_bool UnmanagedStream_GetIsOK_(UnmanagedStream* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedStream_GetIsOK_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsOK();
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API c_bool UnmanagedStream_GetIsOK_(UnmanagedStream* obj)
 
 ALTERNET_UI_API c_bool UnmanagedStream_GetIsSeekable_(UnmanagedStream* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedStream_GetIsSeekable_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsSeekable();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API c_bool UnmanagedStream_GetIsSeekable_(UnmanagedStream* obj)
 
 ALTERNET_UI_API int64_t UnmanagedStream_GetPosition_(UnmanagedStream* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedStream_GetPosition_");
     return MarshalExceptions<int64_t>([&](){
         return obj->GetPosition();
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API int64_t UnmanagedStream_GetPosition_(UnmanagedStream* obj)
 
 ALTERNET_UI_API void UnmanagedStream_SetPosition_(UnmanagedStream* obj, int64_t value)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedStream_SetPosition_");
     MarshalExceptions<void>([&](){
         obj->SetPosition(value);
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API void UnmanagedStream_SetPosition_(UnmanagedStream* obj, int64_t
 
 ALTERNET_UI_API void* UnmanagedStream_Read_(UnmanagedStream* obj, void* buffer, int bufferCount, void* length)
 {
+    ALTERNET_UI_PERF_EXPORT("UnmanagedStream_Read_");
     return MarshalExceptions<void*>([&](){
         return obj->Read(buffer, bufferCount, length);
     });
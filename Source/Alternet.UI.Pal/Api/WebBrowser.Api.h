@@ -10,6 +10,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API WebBrowser* WebBrowser_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Create_");
     return MarshalExceptions<WebBrowser*>([&](){
         return new WebBrowser();
     });
@@ -17,6 +18,7 @@ ALTERNET_UI_API WebBrowser* WebBrowser_Create_()
 
 ALTERNET_UI_API c_bool WebBrowser_GetIsEdgeBackendEnabled_()
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetIsEdgeBackendEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return WebBrowser::GetIsEdgeBackendEnabled();
     });
@@ -24,6 +26,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetIsEdgeBackendEnabled_()
 
 ALTERNET_UI_API void WebBrowser_SetIsEdgeBackendEnabled_(c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetIsEdgeBackendEnabled_");
     MarshalExceptions<void>([&](){
         WebBrowser::SetIsEdgeBackendEnabled(value);
     });
@@ -31,6 +34,7 @@ ALTERNET_UI_API void WebBrowser_SetIsEdgeBackendEnabled_(c_bool value)
 
 ALTERNET_UI_API c_bool WebBrowser_GetHasBorder_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -38,6 +42,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetHasBorder_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_SetHasBorder_(WebBrowser* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -45,6 +50,7 @@ ALTERNET_UI_API void WebBrowser_SetHasBorder_(WebBrowser* obj, c_bool value)
 
 ALTERNET_UI_API c_bool WebBrowser_GetCanGoBack_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetCanGoBack_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanGoBack();
     });
@@ -52,6 +58,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetCanGoBack_(WebBrowser* obj)
 
 ALTERNET_UI_API c_bool WebBrowser_GetCanGoForward_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetCanGoForward_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanGoForward();
     });
@@ -59,6 +66,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetCanGoForward_(WebBrowser* obj)
 
 ALTERNET_UI_API c_bool WebBrowser_GetCanCut_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetCanCut_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanCut();
     });
@@ -66,6 +74,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetCanCut_(WebBrowser* obj)
 
 ALTERNET_UI_API c_bool WebBrowser_GetCanCopy_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetCanCopy_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanCopy();
     });
@@ -73,6 +82,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetCanCopy_(WebBrowser* obj)
 
 ALTERNET_UI_API c_bool WebBrowser_GetCanUndo_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetCanUndo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanUndo();
     });
@@ -80,6 +90,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetCanUndo_(WebBrowser* obj)
 
 ALTERNET_UI_API c_bool WebBrowser_GetCanRedo_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetCanRedo_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanRedo();
     });
@@ -87,6 +98,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetCanRedo_(WebBrowser* obj)
 
 ALTERNET_UI_API c_bool WebBrowser_GetIsBusy_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetIsBusy_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsBusy();
     });
@@ -94,6 +106,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetIsBusy_(WebBrowser* obj)
 
 ALTERNET_UI_API c_bool WebBrowser_GetCanPaste_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetCanPaste_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCanPaste();
     });
@@ -101,6 +114,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetCanPaste_(WebBrowser* obj)
 
 ALTERNET_UI_API float WebBrowser_GetZoomFactor_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetZoomFactor_");
     return MarshalExceptions<float>([&](){
         return obj->GetZoomFactor();
     });
@@ -108,6 +122,7 @@ ALTERNET_UI_API float WebBrowser_GetZoomFactor_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_SetZoomFactor_(WebBrowser* obj, float value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetZoomFactor_");
     MarshalExceptions<void>([&](){
         obj->SetZoomFactor(value);
     });
@@ -115,6 +130,7 @@ ALTERNET_UI_API void WebBrowser_SetZoomFactor_(WebBrowser* obj, float value)
 
 ALTERNET_UI_API c_bool WebBrowser_GetHasSelection_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetHasSelection_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasSelection();
     });
@@ -122,6 +138,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetHasSelection_(WebBrowser* obj)
 
 ALTERNET_UI_API c_bool WebBrowser_GetAccessToDevToolsEnabled_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetAccessToDevToolsEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAccessToDevToolsEnabled();
     });
@@ -129,6 +146,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetAccessToDevToolsEnabled_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_SetAccessToDevToolsEnabled_(WebBrowser* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetAccessToDevToolsEnabled_");
     MarshalExceptions<void>([&](){
         obj->SetAccessToDevToolsEnabled(value);
     });
@@ -136,6 +154,7 @@ ALTERNET_UI_API void WebBrowser_SetAccessToDevToolsEnabled_(WebBrowser* obj, c_b
 
 ALTERNET_UI_API int WebBrowser_GetPreferredColorScheme_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetPreferredColorScheme_");
     return MarshalExceptions<int>([&](){
         return obj->GetPreferredColorScheme();
     });
@@ -143,6 +162,7 @@ ALTERNET_UI_API int WebBrowser_GetPreferredColorScheme_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_SetPreferredColorScheme_(WebBrowser* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetPreferredColorScheme_");
     MarshalExceptions<void>([&](){
         obj->SetPreferredColorScheme(value);
     });
@@ -150,6 +170,7 @@ ALTERNET_UI_API void WebBrowser_SetPreferredColorScheme_(WebBrowser* obj, int va
 
 ALTERNET_UI_API c_bool WebBrowser_GetContextMenuEnabled_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetContextMenuEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetContextMenuEnabled();
     });
@@ -157,6 +178,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetContextMenuEnabled_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_SetContextMenuEnabled_(WebBrowser* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetContextMenuEnabled_");
     MarshalExceptions<void>([&](){
         obj->SetContextMenuEnabled(value);
     });
@@ -164,6 +186,7 @@ ALTERNET_UI_API void WebBrowser_SetContextMenuEnabled_(WebBrowser* obj, c_bool v
 
 ALTERNET_UI_API c_bool WebBrowser_GetEditable_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetEditable_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetEditable();
     });
@@ -171,6 +194,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetEditable_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_SetEditable_(WebBrowser* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetEditable_");
     MarshalExceptions<void>([&](){
         obj->SetEditable(value);
     });
@@ -178,6 +202,7 @@ ALTERNET_UI_API void WebBrowser_SetEditable_(WebBrowser* obj, c_bool value)
 
 ALTERNET_UI_API int WebBrowser_GetZoom_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetZoom_");
     return MarshalExceptions<int>([&](){
         return obj->GetZoom();
     });
@@ -185,6 +210,7 @@ ALTERNET_UI_API int WebBrowser_GetZoom_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_SetZoom_(WebBrowser* obj, int value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetZoom_");
     MarshalExceptions<void>([&](){
         obj->SetZoom(value);
     });
@@ -192,6 +218,7 @@ ALTERNET_UI_API void WebBrowser_SetZoom_(WebBrowser* obj, int value)
 
 ALTERNET_UI_API c_bool WebBrowser_GetIsEdge_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetIsEdge_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsEdge();
     });
@@ -199,6 +226,7 @@ ALTERNET_UI_API c_bool WebBrowser_GetIsEdge_(WebBrowser* obj)
 
 ALTERNET_UI_API int WebBrowser_Find_(WebBrowser* obj, NativeStringSpan* text, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Find_");
     return MarshalExceptions<int>([&](){
         return obj->Find(*text, flags);
     });
@@ -206,6 +234,7 @@ ALTERNET_UI_API int WebBrowser_Find_(WebBrowser* obj, NativeStringSpan* text, in
 
 ALTERNET_UI_API void WebBrowser_CrtSetDbgFlag_(int value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_CrtSetDbgFlag_");
     MarshalExceptions<void>([&](){
         WebBrowser::CrtSetDbgFlag(value);
     });
@@ -213,6 +242,7 @@ ALTERNET_UI_API void WebBrowser_CrtSetDbgFlag_(int value)
 
 ALTERNET_UI_API int WebBrowser_GetBackend_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetBackend_");
     return MarshalExceptions<int>([&](){
         return obj->GetBackend();
     });
@@ -220,6 +250,7 @@ ALTERNET_UI_API int WebBrowser_GetBackend_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_SetZoomType_(WebBrowser* obj, int zoomType)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetZoomType_");
     MarshalExceptions<void>([&](){
         obj->SetZoomType(zoomType);
     });
@@ -227,6 +258,7 @@ ALTERNET_UI_API void WebBrowser_SetZoomType_(WebBrowser* obj, int zoomType)
 
 ALTERNET_UI_API c_bool WebBrowser_CanSetZoomType_(WebBrowser* obj, int type)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_CanSetZoomType_");
     return MarshalExceptions<c_bool>([&](){
         return obj->CanSetZoomType(type);
     });
@@ -234,6 +266,7 @@ ALTERNET_UI_API c_bool WebBrowser_CanSetZoomType_(WebBrowser* obj, int type)
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetBackendVersionString_(int backend)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetBackendVersionString_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return WebBrowser::GetBackendVersionString(backend);
     });
@@ -241,6 +274,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetBackendVersionString_(int backe
 
 ALTERNET_UI_API c_bool WebBrowser_IsBackendIEAvailable_()
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_IsBackendIEAvailable_");
     return MarshalExceptions<c_bool>([&](){
         return WebBrowser::IsBackendIEAvailable();
     });
@@ -248,6 +282,7 @@ ALTERNET_UI_API c_bool WebBrowser_IsBackendIEAvailable_()
 
 ALTERNET_UI_API c_bool WebBrowser_IsBackendEdgeAvailable_()
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_IsBackendEdgeAvailable_");
     return MarshalExceptions<c_bool>([&](){
         return WebBrowser::IsBackendEdgeAvailable();
     });
@@ -255,6 +290,7 @@ ALTERNET_UI_API c_bool WebBrowser_IsBackendEdgeAvailable_()
 
 ALTERNET_UI_API c_bool WebBrowser_IsBackendWebKitAvailable_()
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_IsBackendWebKitAvailable_");
     return MarshalExceptions<c_bool>([&](){
         return WebBrowser::IsBackendWebKitAvailable();
     });
@@ -262,6 +298,7 @@ ALTERNET_UI_API c_bool WebBrowser_IsBackendWebKitAvailable_()
 
 ALTERNET_UI_API void WebBrowser_SetBackend_(int value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetBackend_");
     MarshalExceptions<void>([&](){
         WebBrowser::SetBackend(value);
     });
@@ -269,6 +306,7 @@ ALTERNET_UI_API void WebBrowser_SetBackend_(int value)
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetLibraryVersionString_()
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetLibraryVersionString_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return WebBrowser::GetLibraryVersionString();
     });
@@ -276,6 +314,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetLibraryVersionString_()
 
 ALTERNET_UI_API void WebBrowser_SetDefaultPage_(NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetDefaultPage_");
     MarshalExceptions<void>([&](){
         WebBrowser::SetDefaultPage(*value);
     });
@@ -283,6 +322,7 @@ ALTERNET_UI_API void WebBrowser_SetDefaultPage_(NativeStringSpan* value)
 
 ALTERNET_UI_API int WebBrowser_GetZoomType_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetZoomType_");
     return MarshalExceptions<int>([&](){
         return obj->GetZoomType();
     });
@@ -290,6 +330,7 @@ ALTERNET_UI_API int WebBrowser_GetZoomType_(WebBrowser* obj)
 
 ALTERNET_UI_API void* WebBrowser_CreateWebBrowser_(NativeStringSpan* url)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_CreateWebBrowser_");
     return MarshalExceptions<void*>([&](){
         return WebBrowser::CreateWebBrowser(*url);
     });
@@ -297,6 +338,7 @@ ALTERNET_UI_API void* WebBrowser_CreateWebBrowser_(NativeStringSpan* url)
 
 ALTERNET_UI_API void WebBrowser_SetDefaultUserAgent_(NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetDefaultUserAgent_");
     MarshalExceptions<void>([&](){
         WebBrowser::SetDefaultUserAgent(*value);
     });
@@ -304,6 +346,7 @@ ALTERNET_UI_API void WebBrowser_SetDefaultUserAgent_(NativeStringSpan* value)
 
 ALTERNET_UI_API void WebBrowser_SetDefaultScriptMesageName_(NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetDefaultScriptMesageName_");
     MarshalExceptions<void>([&](){
         WebBrowser::SetDefaultScriptMesageName(*value);
     });
@@ -311,6 +354,7 @@ ALTERNET_UI_API void WebBrowser_SetDefaultScriptMesageName_(NativeStringSpan* va
 
 ALTERNET_UI_API void WebBrowser_SetDefaultFSNameMemory_(NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetDefaultFSNameMemory_");
     MarshalExceptions<void>([&](){
         WebBrowser::SetDefaultFSNameMemory(*value);
     });
@@ -318,6 +362,7 @@ ALTERNET_UI_API void WebBrowser_SetDefaultFSNameMemory_(NativeStringSpan* value)
 
 ALTERNET_UI_API void WebBrowser_SetDefaultFSNameArchive_(NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetDefaultFSNameArchive_");
     MarshalExceptions<void>([&](){
         WebBrowser::SetDefaultFSNameArchive(*value);
     });
@@ -325,6 +370,7 @@ ALTERNET_UI_API void WebBrowser_SetDefaultFSNameArchive_(NativeStringSpan* value
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetSelectedSource_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetSelectedSource_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetSelectedSource();
     });
@@ -332,6 +378,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetSelectedSource_(WebBrowser* obj
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetSelectedText_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetSelectedText_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetSelectedText();
     });
@@ -339,6 +386,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetSelectedText_(WebBrowser* obj)
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetPageSource_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetPageSource_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetPageSource();
     });
@@ -346,6 +394,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetPageSource_(WebBrowser* obj)
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetPageText_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetPageText_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetPageText();
     });
@@ -353,6 +402,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetPageText_(WebBrowser* obj)
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetUserAgent_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetUserAgent_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetUserAgent();
     });
@@ -360,6 +410,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetUserAgent_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_SetUserAgent_(WebBrowser* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetUserAgent_");
     MarshalExceptions<void>([&](){
         obj->SetUserAgent(*value);
     });
@@ -367,6 +418,7 @@ ALTERNET_UI_API void WebBrowser_SetUserAgent_(WebBrowser* obj, NativeStringSpan*
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_DoCommand_(WebBrowser* obj, NativeStringSpan* cmdName, NativeStringSpan* cmdParam1, NativeStringSpan* cmdParam2)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_DoCommand_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->DoCommand(*cmdName, *cmdParam1, *cmdParam2);
     });
@@ -374,6 +426,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_DoCommand_(WebBrowser* obj, Native
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_DoCommandGlobal_(NativeStringSpan* cmdName, NativeStringSpan* cmdParam1, NativeStringSpan* cmdParam2)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_DoCommandGlobal_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return WebBrowser::DoCommandGlobal(*cmdName, *cmdParam1, *cmdParam2);
     });
@@ -381,6 +434,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_DoCommandGlobal_(NativeStringSpan*
 
 ALTERNET_UI_API void WebBrowser_SetVirtualHostNameToFolderMapping_(WebBrowser* obj, NativeStringSpan* hostName, NativeStringSpan* folderPath, int accessKind)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetVirtualHostNameToFolderMapping_");
     MarshalExceptions<void>([&](){
         obj->SetVirtualHostNameToFolderMapping(*hostName, *folderPath, accessKind);
     });
@@ -388,6 +442,7 @@ ALTERNET_UI_API void WebBrowser_SetVirtualHostNameToFolderMapping_(WebBrowser* o
 
 ALTERNET_UI_API void* WebBrowser_GetNativeBackend_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetNativeBackend_");
     return MarshalExceptions<void*>([&](){
         return obj->GetNativeBackend();
     });
@@ -395,6 +450,7 @@ ALTERNET_UI_API void* WebBrowser_GetNativeBackend_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_GoBack_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GoBack_");
     MarshalExceptions<void>([&](){
         obj->GoBack();
     });
@@ -402,6 +458,7 @@ ALTERNET_UI_API void WebBrowser_GoBack_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_GoForward_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GoForward_");
     MarshalExceptions<void>([&](){
         obj->GoForward();
     });
@@ -409,6 +466,7 @@ ALTERNET_UI_API void WebBrowser_GoForward_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_Stop_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Stop_");
     MarshalExceptions<void>([&](){
         obj->Stop();
     });
@@ -416,6 +474,7 @@ ALTERNET_UI_API void WebBrowser_Stop_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_ClearSelection_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_ClearSelection_");
     MarshalExceptions<void>([&](){
         obj->ClearSelection();
     });
@@ -423,6 +482,7 @@ ALTERNET_UI_API void WebBrowser_ClearSelection_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_Copy_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Copy_");
     MarshalExceptions<void>([&](){
         obj->Copy();
     });
@@ -430,6 +490,7 @@ ALTERNET_UI_API void WebBrowser_Copy_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_Paste_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Paste_");
     MarshalExceptions<void>([&](){
         obj->Paste();
     });
@@ -437,6 +498,7 @@ ALTERNET_UI_API void WebBrowser_Paste_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_Cut_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Cut_");
     MarshalExceptions<void>([&](){
         obj->Cut();
     });
@@ -444,6 +506,7 @@ ALTERNET_UI_API void WebBrowser_Cut_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_ClearHistory_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_ClearHistory_");
     MarshalExceptions<void>([&](){
         obj->ClearHistory();
     });
@@ -451,6 +514,7 @@ ALTERNET_UI_API void WebBrowser_ClearHistory_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_EnableHistory_(WebBrowser* obj, c_bool enable)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_EnableHistory_");
     MarshalExceptions<void>([&](){
         obj->EnableHistory(enable);
     });
@@ -458,6 +522,7 @@ ALTERNET_UI_API void WebBrowser_EnableHistory_(WebBrowser* obj, c_bool enable)
 
 ALTERNET_UI_API void WebBrowser_ReloadDefault_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_ReloadDefault_");
     MarshalExceptions<void>([&](){
         obj->ReloadDefault();
     });
@@ -465,6 +530,7 @@ ALTERNET_UI_API void WebBrowser_ReloadDefault_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_Reload_(WebBrowser* obj, c_bool noCache)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Reload_");
     MarshalExceptions<void>([&](){
         obj->Reload(noCache);
     });
@@ -472,6 +538,7 @@ ALTERNET_UI_API void WebBrowser_Reload_(WebBrowser* obj, c_bool noCache)
 
 ALTERNET_UI_API void WebBrowser_SelectAll_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SelectAll_");
     MarshalExceptions<void>([&](){
         obj->SelectAll();
     });
@@ -479,6 +546,7 @@ ALTERNET_UI_API void WebBrowser_SelectAll_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_DeleteSelection_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_DeleteSelection_");
     MarshalExceptions<void>([&](){
         obj->DeleteSelection();
     });
@@ -486,6 +554,7 @@ ALTERNET_UI_API void WebBrowser_DeleteSelection_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_Undo_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Undo_");
     MarshalExceptions<void>([&](){
         obj->Undo();
     });
@@ -493,6 +562,7 @@ ALTERNET_UI_API void WebBrowser_Undo_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_Redo_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Redo_");
     MarshalExceptions<void>([&](){
         obj->Redo();
     });
@@ -500,6 +570,7 @@ ALTERNET_UI_API void WebBrowser_Redo_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_Print_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_Print_");
     MarshalExceptions<void>([&](){
         obj->Print();
     });
@@ -507,6 +578,7 @@ ALTERNET_UI_API void WebBrowser_Print_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_RemoveAllUserScripts_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_RemoveAllUserScripts_");
     MarshalExceptions<void>([&](){
         obj->RemoveAllUserScripts();
     });
@@ -514,6 +586,7 @@ ALTERNET_UI_API void WebBrowser_RemoveAllUserScripts_(WebBrowser* obj)
 
 ALTERNET_UI_API c_bool WebBrowser_AddScriptMessageHandler_(WebBrowser* obj, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_AddScriptMessageHandler_");
     return MarshalExceptions<c_bool>([&](){
         return obj->AddScriptMessageHandler(*name);
     });
@@ -521,6 +594,7 @@ ALTERNET_UI_API c_bool WebBrowser_AddScriptMessageHandler_(WebBrowser* obj, Nati
 
 ALTERNET_UI_API c_bool WebBrowser_RemoveScriptMessageHandler_(WebBrowser* obj, NativeStringSpan* name)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_RemoveScriptMessageHandler_");
     return MarshalExceptions<c_bool>([&](){
         return obj->RemoveScriptMessageHandler(*name);
     });
@@ -528,6 +602,7 @@ ALTERNET_UI_API c_bool WebBrowser_RemoveScriptMessageHandler_(WebBrowser* obj, N
 
 ALTERNET_UI_API void WebBrowser_RunScriptAsync_(WebBrowser* obj, NativeStringSpan* javascript, void* clientData)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_RunScriptAsync_");
     MarshalExceptions<void>([&](){
         obj->RunScriptAsync(*javascript, clientData);
     });
@@ -535,6 +610,7 @@ ALTERNET_UI_API void WebBrowser_RunScriptAsync_(WebBrowser* obj, NativeStringSpa
 
 ALTERNET_UI_API void WebBrowser_CreateBackend_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_CreateBackend_");
     MarshalExceptions<void>([&](){
         obj->CreateBackend();
     });
@@ -542,6 +618,7 @@ ALTERNET_UI_API void WebBrowser_CreateBackend_(WebBrowser* obj)
 
 ALTERNET_UI_API int WebBrowser_GetBackendOS_()
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetBackendOS_");
     return MarshalExceptions<int>([&](){
         return WebBrowser::GetBackendOS();
     });
@@ -549,6 +626,7 @@ ALTERNET_UI_API int WebBrowser_GetBackendOS_()
 
 ALTERNET_UI_API void WebBrowser_SetEdgePath_(NativeStringSpan* path)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetEdgePath_");
     MarshalExceptions<void>([&](){
         WebBrowser::SetEdgePath(*path);
     });
@@ -556,6 +634,7 @@ ALTERNET_UI_API void WebBrowser_SetEdgePath_(NativeStringSpan* path)
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetCurrentTitle_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetCurrentTitle_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetCurrentTitle();
     });
@@ -563,6 +642,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetCurrentTitle_(WebBrowser* obj)
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetCurrentURL_(WebBrowser* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetCurrentURL_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetCurrentURL();
     });
@@ -570,6 +650,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_GetCurrentURL_(WebBrowser* obj)
 
 ALTERNET_UI_API void WebBrowser_LoadURL_(WebBrowser* obj, NativeStringSpan* url)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_LoadURL_");
     MarshalExceptions<void>([&](){
         obj->LoadURL(*url);
     });
@@ -577,6 +658,7 @@ ALTERNET_UI_API void WebBrowser_LoadURL_(WebBrowser* obj, NativeStringSpan* url)
 
 ALTERNET_UI_API NativeStringSpan_C WebBrowser_RunScript_(WebBrowser* obj, NativeStringSpan* javascript)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_RunScript_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->RunScript(*javascript);
     });
@@ -584,6 +666,7 @@ ALTERNET_UI_API NativeStringSpan_C WebBrowser_RunScript_(WebBrowser* obj, Native
 
 ALTERNET_UI_API void WebBrowser_SetPage_(WebBrowser* obj, NativeStringSpan* text, NativeStringSpan* baseUrl)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetPage_");
     MarshalExceptions<void>([&](){
         obj->SetPage(*text, *baseUrl);
     });
@@ -591,11 +674,44 @@ ALTERNET_UI_API void WebBrowser_SetPage_(WebBrowser* obj, NativeStringSpan* text
 
 ALTERNET_UI_API c_bool WebBrowser_AddUserScript_(WebBrowser* obj, NativeStringSpan* javascript, int injectionTime)
 {
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_AddUserScript_");
     return MarshalExceptions<c_bool>([&](){
         return obj->AddUserScript(*javascript, injectionTime);
     });
 }
 
+ALTERNET_UI_API int64_t WebBrowser_QueueScript_(WebBrowser* obj, NativeStringSpan* javascript)
+{
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_QueueScript_");
+    return MarshalExceptions<int64_t>([&](){
+        return obj->QueueScript(*javascript);
+    });
+}
+
+ALTERNET_UI_API void WebBrowser_FlushScripts_(WebBrowser* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_FlushScripts_");
+    MarshalExceptions<void>([&](){
+        obj->FlushScripts();
+    });
+}
+
+ALTERNET_UI_API void WebBrowser_SetScriptMessageBatching_(WebBrowser* obj, c_bool value)
+{
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_SetScriptMessageBatching_");
+    MarshalExceptions<void>([&](){
+        obj->SetScriptMessageBatching(value);
+    });
+}
+
+ALTERNET_UI_API c_bool WebBrowser_GetScriptMessageBatching_(WebBrowser* obj)
+{
+    ALTERNET_UI_PERF_EXPORT("WebBrowser_GetScriptMessageBatching_");
+    return MarshalExceptions<c_bool>([&](){
+        return obj->GetScriptMessageBatching();
+    });
+}
+
 ALTERNET_UI_API void WebBrowser_SetEventCallback_(WebBrowser::WebBrowserEventCallbackType callback)
 {
     WebBrowser::SetEventCallback(callback);
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API Window* Window_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("Window_Create_");
     return MarshalExceptions<Window*>([&](){
         return new Window();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API Window* Window_Create_()
 
 ALTERNET_UI_API c_bool Window_GetShowInTaskbar_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetShowInTaskbar_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetShowInTaskbar();
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API c_bool Window_GetShowInTaskbar_(Window* obj)
 
 ALTERNET_UI_API void Window_SetShowInTaskbar_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetShowInTaskbar_");
     MarshalExceptions<void>([&](){
         obj->SetShowInTaskbar(value);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void Window_SetShowInTaskbar_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetMinimizeEnabled_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetMinimizeEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetMinimizeEnabled();
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API c_bool Window_GetMinimizeEnabled_(Window* obj)
 
 ALTERNET_UI_API void Window_SetMinimizeEnabled_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetMinimizeEnabled_");
     MarshalExceptions<void>([&](){
         obj->SetMinimizeEnabled(value);
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API void Window_SetMinimizeEnabled_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetMaximizeEnabled_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetMaximizeEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetMaximizeEnabled();
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API c_bool Window_GetMaximizeEnabled_(Window* obj)
 
 ALTERNET_UI_API void Window_SetMaximizeEnabled_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetMaximizeEnabled_");
     MarshalExceptions<void>([&](){
         obj->SetMaximizeEnabled(value);
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API void Window_SetMaximizeEnabled_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetCloseEnabled_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetCloseEnabled_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetCloseEnabled();
     });
@@ -67,6 +75,7 @@ ALTERNET_UI_API c_bool Window_GetCloseEnabled_(Window* obj)
 
 ALTERNET_UI_API void Window_SetCloseEnabled_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetCloseEnabled_");
     MarshalExceptions<void>([&](){
         obj->SetCloseEnabled(value);
     });
@@ -74,6 +83,7 @@ ALTERNET_UI_API void Window_SetCloseEnabled_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetAlwaysOnTop_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetAlwaysOnTop_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetAlwaysOnTop();
     });
@@ -81,6 +91,7 @@ ALTERNET_UI_API c_bool Window_GetAlwaysOnTop_(Window* obj)
 
 ALTERNET_UI_API void Window_SetAlwaysOnTop_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetAlwaysOnTop_");
     MarshalExceptions<void>([&](){
         obj->SetAlwaysOnTop(value);
     });
@@ -88,6 +99,7 @@ ALTERNET_UI_API void Window_SetAlwaysOnTop_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetIsToolWindow_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetIsToolWindow_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsToolWindow();
     });
@@ -95,6 +107,7 @@ ALTERNET_UI_API c_bool Window_GetIsToolWindow_(Window* obj)
 
 ALTERNET_UI_API void Window_SetIsToolWindow_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetIsToolWindow_");
     MarshalExceptions<void>([&](){
         obj->SetIsToolWindow(value);
     });
@@ -102,6 +115,7 @@ ALTERNET_UI_API void Window_SetIsToolWindow_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetResizable_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetResizable_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetResizable();
     });
@@ -109,6 +123,7 @@ ALTERNET_UI_API c_bool Window_GetResizable_(Window* obj)
 
 ALTERNET_UI_API void Window_SetResizable_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetResizable_");
     MarshalExceptions<void>([&](){
         obj->SetResizable(value);
     });
@@ -116,6 +131,7 @@ ALTERNET_UI_API void Window_SetResizable_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetHasBorder_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetHasBorder_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasBorder();
     });
@@ -123,6 +139,7 @@ ALTERNET_UI_API c_bool Window_GetHasBorder_(Window* obj)
 
 ALTERNET_UI_API void Window_SetHasBorder_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetHasBorder_");
     MarshalExceptions<void>([&](){
         obj->SetHasBorder(value);
     });
@@ -130,6 +147,7 @@ ALTERNET_UI_API void Window_SetHasBorder_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetHasTitleBar_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetHasTitleBar_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasTitleBar();
     });
@@ -137,6 +155,7 @@ ALTERNET_UI_API c_bool Window_GetHasTitleBar_(Window* obj)
 
 ALTERNET_UI_API void Window_SetHasTitleBar_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetHasTitleBar_");
     MarshalExceptions<void>([&](){
         obj->SetHasTitleBar(value);
     });
@@ -144,6 +163,7 @@ ALTERNET_UI_API void Window_SetHasTitleBar_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetHasSystemMenu_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetHasSystemMenu_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetHasSystemMenu();
     });
@@ -151,6 +171,7 @@ ALTERNET_UI_API c_bool Window_GetHasSystemMenu_(Window* obj)
 
 ALTERNET_UI_API void Window_SetHasSystemMenu_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetHasSystemMenu_");
     MarshalExceptions<void>([&](){
         obj->SetHasSystemMenu(value);
     });
@@ -158,6 +179,7 @@ ALTERNET_UI_API void Window_SetHasSystemMenu_(Window* obj, c_bool value)
 
 ALTERNET_UI_API c_bool Window_GetIsPopupWindow_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetIsPopupWindow_");
     return MarshalExceptions<c_bool>([&](){
         return obj->GetIsPopupWindow();
     });
@@ -165,6 +187,7 @@ ALTERNET_UI_API c_bool Window_GetIsPopupWindow_(Window* obj)
 
 ALTERNET_UI_API void Window_SetIsPopupWindow_(Window* obj, c_bool value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetIsPopupWindow_");
     MarshalExceptions<void>([&](){
         obj->SetIsPopupWindow(value);
     });
@@ -172,6 +195,7 @@ ALTERNET_UI_API void Window_SetIsPopupWindow_(Window* obj, c_bool value)
 
 ALTERNET_UI_API Window* Window_GetActiveWindow_()
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetActiveWindow_");
     return MarshalExceptions<Window*>([&](){
         return Window::GetActiveWindow();
     });
@@ -179,6 +203,7 @@ ALTERNET_UI_API Window* Window_GetActiveWindow_()
 
 ALTERNET_UI_API WindowState Window_GetState_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetState_");
     return MarshalExceptions<WindowState>([&](){
         return obj->GetState();
     });
@@ -186,6 +211,7 @@ ALTERNET_UI_API WindowState Window_GetState_(Window* obj)
 
 ALTERNET_UI_API void Window_SetState_(Window* obj, WindowState value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetState_");
     MarshalExceptions<void>([&](){
         obj->SetState(value);
     });
@@ -193,6 +219,7 @@ ALTERNET_UI_API void Window_SetState_(Window* obj, WindowState value)
 
 ALTERNET_UI_API IconSet* Window_GetIcon_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetIcon_");
     return MarshalExceptions<IconSet*>([&](){
         return obj->GetIcon();
     });
@@ -200,6 +227,7 @@ ALTERNET_UI_API IconSet* Window_GetIcon_(Window* obj)
 
 ALTERNET_UI_API void Window_SetIcon_(Window* obj, IconSet* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetIcon_");
     MarshalExceptions<void>([&](){
         obj->SetIcon(value);
     });
@@ -207,6 +235,7 @@ ALTERNET_UI_API void Window_SetIcon_(Window* obj, IconSet* value)
 
 ALTERNET_UI_API void* Window_GetWxStatusBar_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetWxStatusBar_");
     return MarshalExceptions<void*>([&](){
         return obj->GetWxStatusBar();
     });
@@ -214,6 +243,7 @@ ALTERNET_UI_API void* Window_GetWxStatusBar_(Window* obj)
 
 ALTERNET_UI_API void Window_SetWxStatusBar_(Window* obj, void* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetWxStatusBar_");
     MarshalExceptions<void>([&](){
         obj->SetWxStatusBar(value);
     });
@@ -221,6 +251,7 @@ ALTERNET_UI_API void Window_SetWxStatusBar_(Window* obj, void* value)
 
 ALTERNET_UI_API void* Window_CreateEx_(int kind)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_CreateEx_");
     return MarshalExceptions<void*>([&](){
         return Window::CreateEx(kind);
     });
@@ -228,6 +259,7 @@ ALTERNET_UI_API void* Window_CreateEx_(int kind)
 
 ALTERNET_UI_API void Window_SetDefaultBounds_(RectD* bounds)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetDefaultBounds_");
     MarshalExceptions<void>([&](){
         Window::SetDefaultBounds(*bounds);
     });
@@ -235,6 +267,7 @@ ALTERNET_UI_API void Window_SetDefaultBounds_(RectD* bounds)
 
 ALTERNET_UI_API void Window_SetParkingWindowFontRef_(void* font)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetParkingWindowFontRef_");
     MarshalExceptions<void>([&](){
         Window::SetParkingWindowFontRef(font);
     });
@@ -242,6 +275,7 @@ ALTERNET_UI_API void Window_SetParkingWindowFontRef_(void* font)
 
 ALTERNET_UI_API void Window_SetMinSize_(Window* obj, SizeD* size)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetMinSize_");
     MarshalExceptions<void>([&](){
         obj->SetMinSize(*size);
     });
@@ -249,6 +283,7 @@ ALTERNET_UI_API void Window_SetMinSize_(Window* obj, SizeD* size)
 
 ALTERNET_UI_API void Window_SetMaxSize_(Window* obj, SizeD* size)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetMaxSize_");
     MarshalExceptions<void>([&](){
         obj->SetMaxSize(*size);
     });
@@ -256,6 +291,7 @@ ALTERNET_UI_API void Window_SetMaxSize_(Window* obj, SizeD* size)
 
 ALTERNET_UI_API NativeStringSpan_C Window_GetTitle_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_GetTitle_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return obj->GetTitle();
     });
@@ -263,6 +299,7 @@ ALTERNET_UI_API NativeStringSpan_C Window_GetTitle_(Window* obj)
 
 ALTERNET_UI_API void Window_SetTitle_(Window* obj, NativeStringSpan* value)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_SetTitle_");
     MarshalExceptions<void>([&](){
         obj->SetTitle(*value);
     });
@@ -270,6 +307,7 @@ ALTERNET_UI_API void Window_SetTitle_(Window* obj, NativeStringSpan* value)
 
 ALTERNET_UI_API void Window_Close_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_Close_");
     MarshalExceptions<void>([&](){
         obj->Close();
     });
@@ -277,6 +315,7 @@ ALTERNET_UI_API void Window_Close_(Window* obj)
 
 ALTERNET_UI_API void Window_Activate_(Window* obj)
 {
+    ALTERNET_UI_PERF_EXPORT("Window_Activate_");
     MarshalExceptions<void>([&](){
         obj->Activate();
     });
@@ -11,6 +11,7 @@ using namespace Alternet::UI;
 
 ALTERNET_UI_API WxOtherFactory* WxOtherFactory_Create_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_Create_");
     return MarshalExceptions<WxOtherFactory*>([&](){
         return new WxOtherFactory();
     });
@@ -18,6 +19,7 @@ ALTERNET_UI_API WxOtherFactory* WxOtherFactory_Create_()
 
 ALTERNET_UI_API void WxOtherFactory_TestPopupWindow_(void* parent, PointI* pos, SizeI* sz)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_TestPopupWindow_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::TestPopupWindow(parent, *pos, *sz);
     });
@@ -25,6 +27,7 @@ ALTERNET_UI_API void WxOtherFactory_TestPopupWindow_(void* parent, PointI* pos,
 
 ALTERNET_UI_API void* WxOtherFactory_CreateToolTip_(NativeStringSpan* tip)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateToolTip_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateToolTip(*tip);
     });
@@ -32,6 +35,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateToolTip_(NativeStringSpan* tip)
 
 ALTERNET_UI_API void WxOtherFactory_DeleteToolTip_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DeleteToolTip_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::DeleteToolTip(handle);
     });
@@ -39,6 +43,7 @@ ALTERNET_UI_API void WxOtherFactory_DeleteToolTip_(void* handle)
 
 ALTERNET_UI_API NativeStringSpan_C WxOtherFactory_ToolTipGetTip_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_ToolTipGetTip_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return WxOtherFactory::ToolTipGetTip(handle);
     });
@@ -46,6 +51,7 @@ ALTERNET_UI_API NativeStringSpan_C WxOtherFactory_ToolTipGetTip_(void* handle)
 
 ALTERNET_UI_API void* WxOtherFactory_ToolTipGetWindow_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_ToolTipGetWindow_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::ToolTipGetWindow(handle);
     });
@@ -53,6 +59,7 @@ ALTERNET_UI_API void* WxOtherFactory_ToolTipGetWindow_(void* handle)
 
 ALTERNET_UI_API void WxOtherFactory_ToolTipSetTip_(void* handle, NativeStringSpan* tip)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_ToolTipSetTip_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::ToolTipSetTip(handle, *tip);
     });
@@ -60,6 +67,7 @@ ALTERNET_UI_API void WxOtherFactory_ToolTipSetTip_(void* handle, NativeStringSpa
 
 ALTERNET_UI_API void WxOtherFactory_ToolTipEnable_(c_bool flag)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_ToolTipEnable_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::ToolTipEnable(flag);
     });
@@ -67,6 +75,7 @@ ALTERNET_UI_API void WxOtherFactory_ToolTipEnable_(c_bool flag)
 
 ALTERNET_UI_API void WxOtherFactory_ToolTipSetAutoPop_(int64_t msecs)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_ToolTipSetAutoPop_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::ToolTipSetAutoPop(msecs);
     });
@@ -74,6 +83,7 @@ ALTERNET_UI_API void WxOtherFactory_ToolTipSetAutoPop_(int64_t msecs)
 
 ALTERNET_UI_API void WxOtherFactory_ToolTipSetDelay_(int64_t msecs)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_ToolTipSetDelay_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::ToolTipSetDelay(msecs);
     });
@@ -81,6 +91,7 @@ ALTERNET_UI_API void WxOtherFactory_ToolTipSetDelay_(int64_t msecs)
 
 ALTERNET_UI_API void WxOtherFactory_ToolTipSetMaxWidth_(int width)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_ToolTipSetMaxWidth_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::ToolTipSetMaxWidth(width);
     });
@@ -88,6 +99,7 @@ ALTERNET_UI_API void WxOtherFactory_ToolTipSetMaxWidth_(int width)
 
 ALTERNET_UI_API void WxOtherFactory_ToolTipSetReshow_(int64_t msecs)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_ToolTipSetReshow_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::ToolTipSetReshow(msecs);
     });
@@ -95,6 +107,7 @@ ALTERNET_UI_API void WxOtherFactory_ToolTipSetReshow_(int64_t msecs)
 
 ALTERNET_UI_API void* WxOtherFactory_CreateCursor_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateCursor_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateCursor();
     });
@@ -102,6 +115,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateCursor_()
 
 ALTERNET_UI_API void* WxOtherFactory_CreateCursor2_(int cursorId)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateCursor2_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateCursor2(cursorId);
     });
@@ -109,6 +123,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateCursor2_(int cursorId)
 
 ALTERNET_UI_API void* WxOtherFactory_CreateCursor3_(NativeStringSpan* cursorName, int type, int hotSpotX, int hotSpotY)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateCursor3_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateCursor3(*cursorName, type, hotSpotX, hotSpotY);
     });
@@ -116,6 +131,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateCursor3_(NativeStringSpan* cursorName
 
 ALTERNET_UI_API void* WxOtherFactory_CreateCursor4_(Image* image, int hotSpotX, int hotSpotY)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateCursor4_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateCursor4(image, hotSpotX, hotSpotY);
     });
@@ -123,6 +139,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateCursor4_(Image* image, int hotSpotX,
 
 ALTERNET_UI_API void* WxOtherFactory_CreateCursor5_(void* image, int hotSpotX, int hotSpotY)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateCursor5_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateCursor5(image, hotSpotX, hotSpotY);
     });
@@ -130,6 +147,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateCursor5_(void* image, int hotSpotX, i
 
 ALTERNET_UI_API void WxOtherFactory_DeleteCursor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DeleteCursor_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::DeleteCursor(handle);
     });
@@ -137,6 +155,7 @@ ALTERNET_UI_API void WxOtherFactory_DeleteCursor_(void* handle)
 
 ALTERNET_UI_API c_bool WxOtherFactory_CursorIsOk_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CursorIsOk_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::CursorIsOk(handle);
     });
@@ -144,6 +163,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_CursorIsOk_(void* handle)
 
 ALTERNET_UI_API PointI_C WxOtherFactory_CursorGetHotSpot_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CursorGetHotSpot_");
     return MarshalExceptions<PointI_C>([&](){
         return WxOtherFactory::CursorGetHotSpot(handle);
     });
@@ -151,6 +171,7 @@ ALTERNET_UI_API PointI_C WxOtherFactory_CursorGetHotSpot_(void* handle)
 
 ALTERNET_UI_API void WxOtherFactory_SetCursor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SetCursor_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::SetCursor(handle);
     });
@@ -158,6 +179,7 @@ ALTERNET_UI_API void WxOtherFactory_SetCursor_(void* handle)
 
 ALTERNET_UI_API int WxOtherFactory_CaretGetBlinkTime_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretGetBlinkTime_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::CaretGetBlinkTime();
     });
@@ -165,6 +187,7 @@ ALTERNET_UI_API int WxOtherFactory_CaretGetBlinkTime_()
 
 ALTERNET_UI_API void WxOtherFactory_CaretSetBlinkTime_(int milliseconds)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretSetBlinkTime_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::CaretSetBlinkTime(milliseconds);
     });
@@ -172,6 +195,7 @@ ALTERNET_UI_API void WxOtherFactory_CaretSetBlinkTime_(int milliseconds)
 
 ALTERNET_UI_API void WxOtherFactory_DeleteCaret_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DeleteCaret_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::DeleteCaret(handle);
     });
@@ -179,6 +203,7 @@ ALTERNET_UI_API void WxOtherFactory_DeleteCaret_(void* handle)
 
 ALTERNET_UI_API PointI_C WxOtherFactory_CaretGetPosition_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretGetPosition_");
     return MarshalExceptions<PointI_C>([&](){
         return WxOtherFactory::CaretGetPosition(handle);
     });
@@ -186,6 +211,7 @@ ALTERNET_UI_API PointI_C WxOtherFactory_CaretGetPosition_(void* handle)
 
 ALTERNET_UI_API SizeI_C WxOtherFactory_CaretGetSize_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretGetSize_");
     return MarshalExceptions<SizeI_C>([&](){
         return WxOtherFactory::CaretGetSize(handle);
     });
@@ -193,6 +219,7 @@ ALTERNET_UI_API SizeI_C WxOtherFactory_CaretGetSize_(void* handle)
 
 ALTERNET_UI_API void WxOtherFactory_CaretMove_(void* handle, int x, int y)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretMove_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::CaretMove(handle, x, y);
     });
@@ -200,6 +227,7 @@ ALTERNET_UI_API void WxOtherFactory_CaretMove_(void* handle, int x, int y)
 
 ALTERNET_UI_API void WxOtherFactory_CaretSetSize_(void* handle, int width, int height)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretSetSize_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::CaretSetSize(handle, width, height);
     });
@@ -207,6 +235,7 @@ ALTERNET_UI_API void WxOtherFactory_CaretSetSize_(void* handle, int width, int h
 
 ALTERNET_UI_API void* WxOtherFactory_CreateCaret_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateCaret_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateCaret();
     });
@@ -214,6 +243,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateCaret_()
 
 ALTERNET_UI_API void* WxOtherFactory_CreateCaret2_(void* window, int width, int height)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateCaret2_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateCaret2(window, width, height);
     });
@@ -221,6 +251,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateCaret2_(void* window, int width, int
 
 ALTERNET_UI_API void* WxOtherFactory_CaretGetWindow_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretGetWindow_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CaretGetWindow(handle);
     });
@@ -228,6 +259,7 @@ ALTERNET_UI_API void* WxOtherFactory_CaretGetWindow_(void* handle)
 
 ALTERNET_UI_API void WxOtherFactory_CaretHide_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretHide_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::CaretHide(handle);
     });
@@ -235,6 +267,7 @@ ALTERNET_UI_API void WxOtherFactory_CaretHide_(void* handle)
 
 ALTERNET_UI_API c_bool WxOtherFactory_CaretIsOk_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretIsOk_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::CaretIsOk(handle);
     });
@@ -242,6 +275,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_CaretIsOk_(void* handle)
 
 ALTERNET_UI_API c_bool WxOtherFactory_CaretIsVisible_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretIsVisible_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::CaretIsVisible(handle);
     });
@@ -249,6 +283,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_CaretIsVisible_(void* handle)
 
 ALTERNET_UI_API void WxOtherFactory_CaretShow_(void* handle, c_bool show)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CaretShow_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::CaretShow(handle, show);
     });
@@ -256,6 +291,7 @@ ALTERNET_UI_API void WxOtherFactory_CaretShow_(void* handle, c_bool show)
 
 ALTERNET_UI_API void* WxOtherFactory_CreateDisplay_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateDisplay_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateDisplay();
     });
@@ -263,6 +299,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateDisplay_()
 
 ALTERNET_UI_API void* WxOtherFactory_CreateDisplay2_(uint32_t index)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateDisplay2_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateDisplay2(index);
     });
@@ -270,6 +307,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateDisplay2_(uint32_t index)
 
 ALTERNET_UI_API void* WxOtherFactory_CreateDisplay3_(void* window)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_CreateDisplay3_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::CreateDisplay3(window);
     });
@@ -277,6 +315,7 @@ ALTERNET_UI_API void* WxOtherFactory_CreateDisplay3_(void* window)
 
 ALTERNET_UI_API void WxOtherFactory_DeleteDisplay_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DeleteDisplay_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::DeleteDisplay(handle);
     });
@@ -284,6 +323,7 @@ ALTERNET_UI_API void WxOtherFactory_DeleteDisplay_(void* handle)
 
 ALTERNET_UI_API uint32_t WxOtherFactory_DisplayGetCount_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetCount_");
     return MarshalExceptions<uint32_t>([&](){
         return WxOtherFactory::DisplayGetCount();
     });
@@ -291,6 +331,7 @@ ALTERNET_UI_API uint32_t WxOtherFactory_DisplayGetCount_()
 
 ALTERNET_UI_API c_bool WxOtherFactory_DisplayIsOk_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayIsOk_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::DisplayIsOk(handle);
     });
@@ -298,6 +339,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_DisplayIsOk_(void* handle)
 
 ALTERNET_UI_API int WxOtherFactory_DisplayGetFromPoint_(PointI* pt)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetFromPoint_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::DisplayGetFromPoint(*pt);
     });
@@ -305,6 +347,7 @@ ALTERNET_UI_API int WxOtherFactory_DisplayGetFromPoint_(PointI* pt)
 
 ALTERNET_UI_API int WxOtherFactory_DisplayGetFromWindow_(void* win)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetFromWindow_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::DisplayGetFromWindow(win);
     });
@@ -312,6 +355,7 @@ ALTERNET_UI_API int WxOtherFactory_DisplayGetFromWindow_(void* win)
 
 ALTERNET_UI_API int WxOtherFactory_DisplayGetStdPPIValue_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetStdPPIValue_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::DisplayGetStdPPIValue();
     });
@@ -319,6 +363,7 @@ ALTERNET_UI_API int WxOtherFactory_DisplayGetStdPPIValue_()
 
 ALTERNET_UI_API SizeI_C WxOtherFactory_DisplayGetStdPPI_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetStdPPI_");
     return MarshalExceptions<SizeI_C>([&](){
         return WxOtherFactory::DisplayGetStdPPI();
     });
@@ -326,6 +371,7 @@ ALTERNET_UI_API SizeI_C WxOtherFactory_DisplayGetStdPPI_()
 
 ALTERNET_UI_API NativeStringSpan_C WxOtherFactory_DisplayGetName_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return WxOtherFactory::DisplayGetName(handle);
     });
@@ -333,6 +379,7 @@ ALTERNET_UI_API NativeStringSpan_C WxOtherFactory_DisplayGetName_(void* handle)
 
 ALTERNET_UI_API SizeI_C WxOtherFactory_DisplayGetPPI_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetPPI_");
     return MarshalExceptions<SizeI_C>([&](){
         return WxOtherFactory::DisplayGetPPI(handle);
     });
@@ -340,6 +387,7 @@ ALTERNET_UI_API SizeI_C WxOtherFactory_DisplayGetPPI_(void* handle)
 
 ALTERNET_UI_API float WxOtherFactory_DisplayGetScaleFactor_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetScaleFactor_");
     return MarshalExceptions<float>([&](){
         return WxOtherFactory::DisplayGetScaleFactor(handle);
     });
@@ -347,6 +395,7 @@ ALTERNET_UI_API float WxOtherFactory_DisplayGetScaleFactor_(void* handle)
 
 ALTERNET_UI_API c_bool WxOtherFactory_DisplayIsPrimary_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayIsPrimary_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::DisplayIsPrimary(handle);
     });
@@ -354,6 +403,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_DisplayIsPrimary_(void* handle)
 
 ALTERNET_UI_API RectI_C WxOtherFactory_DisplayGetClientArea_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetClientArea_");
     return MarshalExceptions<RectI_C>([&](){
         return WxOtherFactory::DisplayGetClientArea(handle);
     });
@@ -361,6 +411,7 @@ ALTERNET_UI_API RectI_C WxOtherFactory_DisplayGetClientArea_(void* handle)
 
 ALTERNET_UI_API RectI_C WxOtherFactory_DisplayGetGeometry_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_DisplayGetGeometry_");
     return MarshalExceptions<RectI_C>([&](){
         return WxOtherFactory::DisplayGetGeometry(handle);
     });
@@ -368,6 +419,7 @@ ALTERNET_UI_API RectI_C WxOtherFactory_DisplayGetGeometry_(void* handle)
 
 ALTERNET_UI_API c_bool WxOtherFactory_SystemSettingsHasFeature_(int index)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SystemSettingsHasFeature_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::SystemSettingsHasFeature(index);
     });
@@ -375,6 +427,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_SystemSettingsHasFeature_(int index)
 
 ALTERNET_UI_API Color_C WxOtherFactory_SystemSettingsGetColor_(int index)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SystemSettingsGetColor_");
     return MarshalExceptions<Color_C>([&](){
         return WxOtherFactory::SystemSettingsGetColor(index);
     });
@@ -382,6 +435,7 @@ ALTERNET_UI_API Color_C WxOtherFactory_SystemSettingsGetColor_(int index)
 
 ALTERNET_UI_API int WxOtherFactory_SystemSettingsGetMetric_(int index, void* win)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SystemSettingsGetMetric_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::SystemSettingsGetMetric(index, win);
     });
@@ -389,6 +443,7 @@ ALTERNET_UI_API int WxOtherFactory_SystemSettingsGetMetric_(int index, void* win
 
 ALTERNET_UI_API NativeStringSpan_C WxOtherFactory_SystemAppearanceGetName_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SystemAppearanceGetName_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return WxOtherFactory::SystemAppearanceGetName();
     });
@@ -396,6 +451,7 @@ ALTERNET_UI_API NativeStringSpan_C WxOtherFactory_SystemAppearanceGetName_()
 
 ALTERNET_UI_API c_bool WxOtherFactory_SystemAppearanceIsDark_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SystemAppearanceIsDark_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::SystemAppearanceIsDark();
     });
@@ -403,6 +459,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_SystemAppearanceIsDark_()
 
 ALTERNET_UI_API c_bool WxOtherFactory_SystemAppearanceIsUsingDarkBackground_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SystemAppearanceIsUsingDarkBackground_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::SystemAppearanceIsUsingDarkBackground();
     });
@@ -410,6 +467,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_SystemAppearanceIsUsingDarkBackground_()
 
 ALTERNET_UI_API c_bool WxOtherFactory_IsBusyCursor_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_IsBusyCursor_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::IsBusyCursor();
     });
@@ -417,6 +475,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_IsBusyCursor_()
 
 ALTERNET_UI_API void WxOtherFactory_BeginBusyCursor_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_BeginBusyCursor_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::BeginBusyCursor();
     });
@@ -424,6 +483,7 @@ ALTERNET_UI_API void WxOtherFactory_BeginBusyCursor_()
 
 ALTERNET_UI_API void WxOtherFactory_EndBusyCursor_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_EndBusyCursor_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::EndBusyCursor();
     });
@@ -431,6 +491,7 @@ ALTERNET_UI_API void WxOtherFactory_EndBusyCursor_()
 
 ALTERNET_UI_API void WxOtherFactory_Bell_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_Bell_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::Bell();
     });
@@ -438,6 +499,7 @@ ALTERNET_UI_API void WxOtherFactory_Bell_()
 
 ALTERNET_UI_API NativeStringSpan_C WxOtherFactory_GetTextFromUser_(NativeStringSpan* message, NativeStringSpan* caption, NativeStringSpan* defaultValue, void* parent, int x, int y, c_bool centre)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_GetTextFromUser_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return WxOtherFactory::GetTextFromUser(*message, *caption, *defaultValue, parent, x, y, centre);
     });
@@ -445,6 +507,7 @@ ALTERNET_UI_API NativeStringSpan_C WxOtherFactory_GetTextFromUser_(NativeStringS
 
 ALTERNET_UI_API int64_t WxOtherFactory_GetNumberFromUser_(NativeStringSpan* message, NativeStringSpan* prompt, NativeStringSpan* caption, int64_t value, int64_t min, int64_t max, void* parent, PointI* pos)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_GetNumberFromUser_");
     return MarshalExceptions<int64_t>([&](){
         return WxOtherFactory::GetNumberFromUser(*message, *prompt, *caption, value, min, max, parent, *pos);
     });
@@ -452,6 +515,7 @@ ALTERNET_UI_API int64_t WxOtherFactory_GetNumberFromUser_(NativeStringSpan* mess
 
 ALTERNET_UI_API int WxOtherFactory_RendererDrawHeaderButton_(void* renderer, void* win, Image* dc, RectI* rect, int flags, int sortArrow, void* headerButtonParams)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawHeaderButton_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::RendererDrawHeaderButton(renderer, win, dc, *rect, flags, sortArrow, headerButtonParams);
     });
@@ -459,6 +523,7 @@ ALTERNET_UI_API int WxOtherFactory_RendererDrawHeaderButton_(void* renderer, voi
 
 ALTERNET_UI_API int WxOtherFactory_RendererDrawHeaderButtonContents_(void* renderer, void* win, Image* dc, RectI* rect, int flags, int sortArrow, void* headerButtonParams)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawHeaderButtonContents_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::RendererDrawHeaderButtonContents(renderer, win, dc, *rect, flags, sortArrow, headerButtonParams);
     });
@@ -466,6 +531,7 @@ ALTERNET_UI_API int WxOtherFactory_RendererDrawHeaderButtonContents_(void* rende
 
 ALTERNET_UI_API int WxOtherFactory_RendererGetHeaderButtonHeight_(void* renderer, void* win)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererGetHeaderButtonHeight_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::RendererGetHeaderButtonHeight(renderer, win);
     });
@@ -473,6 +539,7 @@ ALTERNET_UI_API int WxOtherFactory_RendererGetHeaderButtonHeight_(void* renderer
 
 ALTERNET_UI_API int WxOtherFactory_RendererGetHeaderButtonMargin_(void* renderer, void* win)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererGetHeaderButtonMargin_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::RendererGetHeaderButtonMargin(renderer, win);
     });
@@ -480,6 +547,7 @@ ALTERNET_UI_API int WxOtherFactory_RendererGetHeaderButtonMargin_(void* renderer
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawTreeItemButton_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawTreeItemButton_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawTreeItemButton(renderer, win, dc, *rect, flags);
     });
@@ -487,6 +555,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawTreeItemButton_(void* renderer,
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawSplitterBorder_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawSplitterBorder_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawSplitterBorder(renderer, win, dc, *rect, flags);
     });
@@ -494,6 +563,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawSplitterBorder_(void* renderer,
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawSplitterSash_(void* renderer, void* win, Image* dcReal, SizeI* sizeReal, int position, int orientation, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawSplitterSash_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawSplitterSash(renderer, win, dcReal, *sizeReal, position, orientation, flags);
     });
@@ -501,6 +571,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawSplitterSash_(void* renderer, vo
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawComboBoxDropButton_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawComboBoxDropButton_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawComboBoxDropButton(renderer, win, dc, *rect, flags);
     });
@@ -508,6 +579,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawComboBoxDropButton_(void* render
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawDropArrow_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawDropArrow_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawDropArrow(renderer, win, dc, *rect, flags);
     });
@@ -515,6 +587,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawDropArrow_(void* renderer, void*
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawCheckBox_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawCheckBox_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawCheckBox(renderer, win, dc, *rect, flags);
     });
@@ -522,6 +595,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawCheckBox_(void* renderer, void*
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawCheckMark_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawCheckMark_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawCheckMark(renderer, win, dc, *rect, flags);
     });
@@ -529,6 +603,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawCheckMark_(void* renderer, void*
 
 ALTERNET_UI_API SizeI_C WxOtherFactory_RendererGetCheckBoxSize_(void* renderer, void* win, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererGetCheckBoxSize_");
     return MarshalExceptions<SizeI_C>([&](){
         return WxOtherFactory::RendererGetCheckBoxSize(renderer, win, flags);
     });
@@ -536,6 +611,7 @@ ALTERNET_UI_API SizeI_C WxOtherFactory_RendererGetCheckBoxSize_(void* renderer,
 
 ALTERNET_UI_API SizeI_C WxOtherFactory_RendererGetCheckMarkSize_(void* renderer, void* win)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererGetCheckMarkSize_");
     return MarshalExceptions<SizeI_C>([&](){
         return WxOtherFactory::RendererGetCheckMarkSize(renderer, win);
     });
@@ -543,6 +619,7 @@ ALTERNET_UI_API SizeI_C WxOtherFactory_RendererGetCheckMarkSize_(void* renderer,
 
 ALTERNET_UI_API SizeI_C WxOtherFactory_RendererGetExpanderSize_(void* renderer, void* win)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererGetExpanderSize_");
     return MarshalExceptions<SizeI_C>([&](){
         return WxOtherFactory::RendererGetExpanderSize(renderer, win);
     });
@@ -550,6 +627,7 @@ ALTERNET_UI_API SizeI_C WxOtherFactory_RendererGetExpanderSize_(void* renderer,
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawPushButton_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawPushButton_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawPushButton(renderer, win, dc, *rect, flags);
     });
@@ -557,6 +635,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawPushButton_(void* renderer, void
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawCollapseButton_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawCollapseButton_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawCollapseButton(renderer, win, dc, *rect, flags);
     });
@@ -564,6 +643,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawCollapseButton_(void* renderer,
 
 ALTERNET_UI_API SizeI_C WxOtherFactory_RendererGetCollapseButtonSize_(void* renderer, void* win, Image* dc)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererGetCollapseButtonSize_");
     return MarshalExceptions<SizeI_C>([&](){
         return WxOtherFactory::RendererGetCollapseButtonSize(renderer, win, dc);
     });
@@ -571,6 +651,7 @@ ALTERNET_UI_API SizeI_C WxOtherFactory_RendererGetCollapseButtonSize_(void* rend
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawItemSelectionRect_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawItemSelectionRect_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawItemSelectionRect(renderer, win, dc, *rect, flags);
     });
@@ -578,6 +659,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawItemSelectionRect_(void* rendere
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawFocusRect_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawFocusRect_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawFocusRect(renderer, win, dc, *rect, flags);
     });
@@ -585,6 +667,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawFocusRect_(void* renderer, void*
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawChoice_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawChoice_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawChoice(renderer, win, dc, *rect, flags);
     });
@@ -592,6 +675,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawChoice_(void* renderer, void* wi
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawComboBox_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawComboBox_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawComboBox(renderer, win, dc, *rect, flags);
     });
@@ -599,6 +683,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawComboBox_(void* renderer, void*
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawTextCtrl_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawTextCtrl_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawTextCtrl(renderer, win, dc, *rect, flags);
     });
@@ -606,6 +691,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawTextCtrl_(void* renderer, void*
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawRadioBitmap_(void* renderer, void* win, Image* dc, RectI* rect, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawRadioBitmap_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawRadioBitmap(renderer, win, dc, *rect, flags);
     });
@@ -613,6 +699,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawRadioBitmap_(void* renderer, voi
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawGauge_(void* renderer, void* win, Image* dc, RectI* rect, int value, int max, int flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawGauge_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawGauge(renderer, win, dc, *rect, value, max, flags);
     });
@@ -620,6 +707,7 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawGauge_(void* renderer, void* win
 
 ALTERNET_UI_API void WxOtherFactory_RendererDrawItemText_(void* renderer, void* win, Image* dc, NativeStringSpan* text, RectI* rect, int align, int flags, int ellipsizeMode)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawItemText_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::RendererDrawItemText(renderer, win, dc, *text, *rect, align, flags, ellipsizeMode);
     });
@@ -627,13 +715,55 @@ ALTERNET_UI_API void WxOtherFactory_RendererDrawItemText_(void* renderer, void*
 
 ALTERNET_UI_API NativeStringSpan_C WxOtherFactory_RendererGetVersion_(void* renderer)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererGetVersion_");
     return MarshalExceptions<NativeStringSpan_C>([&](){
         return WxOtherFactory::RendererGetVersion(renderer);
     });
 }
 
+ALTERNET_UI_API int WxOtherFactory_RendererDrawBatch_(void* renderer, void* win, Image* dc, int64_t* records, int recordsCount, NativeStringSpan* strings, c_bool useCache)
+{
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererDrawBatch_");
+    return MarshalExceptions<int>([&](){
+        return WxOtherFactory::RendererDrawBatch(renderer, win, dc, records, recordsCount, *strings, useCache);
+    });
+}
+
+ALTERNET_UI_API void WxOtherFactory_RendererSetPartCacheLimit_(int64_t value)
+{
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererSetPartCacheLimit_");
+    MarshalExceptions<void>([&](){
+        WxOtherFactory::RendererSetPartCacheLimit(value);
+    });
+}
+
+ALTERNET_UI_API int64_t WxOtherFactory_RendererGetPartCacheLimit_()
+{
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererGetPartCacheLimit_");
+    return MarshalExceptions<int64_t>([&](){
+        return WxOtherFactory::RendererGetPartCacheLimit();
+    });
+}
+
+ALTERNET_UI_API int64_t WxOtherFactory_RendererGetPartCacheBytes_()
+{
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererGetPartCacheBytes_");
+    return MarshalExceptions<int64_t>([&](){
+        return WxOtherFactory::RendererGetPartCacheBytes();
+    });
+}
+
+ALTERNET_UI_API void WxOtherFactory_RendererClearPartCache_()
+{
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_RendererClearPartCache_");
+    MarshalExceptions<void>([&](){
+        WxOtherFactory::RendererClearPartCache();
+    });
+}
+
 ALTERNET_UI_API void* WxOtherFactory_MemoryAlloc_(uint64_t size)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_MemoryAlloc_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::MemoryAlloc(size);
     });
@@ -641,6 +771,7 @@ ALTERNET_UI_API void* WxOtherFactory_MemoryAlloc_(uint64_t size)
 
 ALTERNET_UI_API void* WxOtherFactory_MemoryRealloc_(void* memory, uint64_t newSize)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_MemoryRealloc_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::MemoryRealloc(memory, newSize);
     });
@@ -648,6 +779,7 @@ ALTERNET_UI_API void* WxOtherFactory_MemoryRealloc_(void* memory, uint64_t newSi
 
 ALTERNET_UI_API void WxOtherFactory_MemoryFree_(void* memory)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_MemoryFree_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::MemoryFree(memory);
     });
@@ -655,6 +787,7 @@ ALTERNET_UI_API void WxOtherFactory_MemoryFree_(void* memory)
 
 ALTERNET_UI_API void* WxOtherFactory_MemoryCopy_(void* dest, void* src, uint64_t count)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_MemoryCopy_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::MemoryCopy(dest, src, count);
     });
@@ -662,6 +795,7 @@ ALTERNET_UI_API void* WxOtherFactory_MemoryCopy_(void* dest, void* src, uint64_t
 
 ALTERNET_UI_API void* WxOtherFactory_MemoryMove_(void* dest, void* src, uint64_t count)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_MemoryMove_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::MemoryMove(dest, src, count);
     });
@@ -669,6 +803,7 @@ ALTERNET_UI_API void* WxOtherFactory_MemoryMove_(void* dest, void* src, uint64_t
 
 ALTERNET_UI_API void* WxOtherFactory_MemorySet_(void* dest, int fillByte, uint64_t count)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_MemorySet_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::MemorySet(dest, fillByte, count);
     });
@@ -676,6 +811,7 @@ ALTERNET_UI_API void* WxOtherFactory_MemorySet_(void* dest, int fillByte, uint64
 
 ALTERNET_UI_API void* WxOtherFactory_FsWatcherCreate_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_FsWatcherCreate_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::FsWatcherCreate();
     });
@@ -683,6 +819,7 @@ ALTERNET_UI_API void* WxOtherFactory_FsWatcherCreate_()
 
 ALTERNET_UI_API void WxOtherFactory_FsWatcherDelete_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_FsWatcherDelete_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::FsWatcherDelete(handle);
     });
@@ -690,6 +827,7 @@ ALTERNET_UI_API void WxOtherFactory_FsWatcherDelete_(void* handle)
 
 ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherAdd_(void* handle, NativeStringSpan* path, int events)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_FsWatcherAdd_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::FsWatcherAdd(handle, *path, events);
     });
@@ -697,6 +835,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherAdd_(void* handle, NativeStringSp
 
 ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherAddTree_(void* handle, NativeStringSpan* path, int events, NativeStringSpan* filter)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_FsWatcherAddTree_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::FsWatcherAddTree(handle, *path, events, *filter);
     });
@@ -704,6 +843,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherAddTree_(void* handle, NativeStri
 
 ALTERNET_UI_API int WxOtherFactory_FsWatcherGetWatchedPathsCount_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_FsWatcherGetWatchedPathsCount_");
     return MarshalExceptions<int>([&](){
         return WxOtherFactory::FsWatcherGetWatchedPathsCount(handle);
     });
@@ -711,6 +851,7 @@ ALTERNET_UI_API int WxOtherFactory_FsWatcherGetWatchedPathsCount_(void* handle)
 
 ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherRemove_(void* handle, NativeStringSpan* path)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_FsWatcherRemove_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::FsWatcherRemove(handle, *path);
     });
@@ -718,6 +859,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherRemove_(void* handle, NativeStrin
 
 ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherRemoveAll_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_FsWatcherRemoveAll_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::FsWatcherRemoveAll(handle);
     });
@@ -725,6 +867,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherRemoveAll_(void* handle)
 
 ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherRemoveTree_(void* handle, NativeStringSpan* path)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_FsWatcherRemoveTree_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::FsWatcherRemoveTree(handle, *path);
     });
@@ -732,6 +875,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_FsWatcherRemoveTree_(void* handle, NativeS
 
 ALTERNET_UI_API void WxOtherFactory_FsWatcherSetOwner_(void* handle, void* handler)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_FsWatcherSetOwner_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::FsWatcherSetOwner(handle, handler);
     });
@@ -739,6 +883,7 @@ ALTERNET_UI_API void WxOtherFactory_FsWatcherSetOwner_(void* handle, void* handl
 
 ALTERNET_UI_API void* WxOtherFactory_SoundCreate_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SoundCreate_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::SoundCreate();
     });
@@ -746,6 +891,7 @@ ALTERNET_UI_API void* WxOtherFactory_SoundCreate_()
 
 ALTERNET_UI_API void* WxOtherFactory_SoundCreate2_(NativeStringSpan* fileName, c_bool isResource)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SoundCreate2_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::SoundCreate2(*fileName, isResource);
     });
@@ -753,6 +899,7 @@ ALTERNET_UI_API void* WxOtherFactory_SoundCreate2_(NativeStringSpan* fileName, c
 
 ALTERNET_UI_API void* WxOtherFactory_SoundCreate4_(uint64_t size, void* data)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SoundCreate4_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::SoundCreate4(size, data);
     });
@@ -760,6 +907,7 @@ ALTERNET_UI_API void* WxOtherFactory_SoundCreate4_(uint64_t size, void* data)
 
 ALTERNET_UI_API void WxOtherFactory_SoundDelete_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SoundDelete_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::SoundDelete(handle);
     });
@@ -767,6 +915,7 @@ ALTERNET_UI_API void WxOtherFactory_SoundDelete_(void* handle)
 
 ALTERNET_UI_API c_bool WxOtherFactory_SoundPlay2_(NativeStringSpan* filename, uint32_t flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SoundPlay2_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::SoundPlay2(*filename, flags);
     });
@@ -774,6 +923,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_SoundPlay2_(NativeStringSpan* filename, ui
 
 ALTERNET_UI_API c_bool WxOtherFactory_SoundPlay_(void* handle, uint32_t flags)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SoundPlay_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::SoundPlay(handle, flags);
     });
@@ -781,6 +931,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_SoundPlay_(void* handle, uint32_t flags)
 
 ALTERNET_UI_API void WxOtherFactory_SoundStop_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SoundStop_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::SoundStop();
     });
@@ -788,6 +939,7 @@ ALTERNET_UI_API void WxOtherFactory_SoundStop_()
 
 ALTERNET_UI_API c_bool WxOtherFactory_SoundIsOk_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_SoundIsOk_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::SoundIsOk(handle);
     });
@@ -795,6 +947,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_SoundIsOk_(void* handle)
 
 ALTERNET_UI_API void WxOtherFactory_UIActionSimulatorDelete_(void* handle)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorDelete_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::UIActionSimulatorDelete(handle);
     });
@@ -802,6 +955,7 @@ ALTERNET_UI_API void WxOtherFactory_UIActionSimulatorDelete_(void* handle)
 
 ALTERNET_UI_API void* WxOtherFactory_UIActionSimulatorCreate_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorCreate_");
     return MarshalExceptions<void*>([&](){
         return WxOtherFactory::UIActionSimulatorCreate();
     });
@@ -809,6 +963,7 @@ ALTERNET_UI_API void* WxOtherFactory_UIActionSimulatorCreate_()
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorChar_(void* handle, int keycode, int modifiers)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorChar_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorChar(handle, keycode, modifiers);
     });
@@ -816,6 +971,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorChar_(void* handle, int k
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorKeyDown_(void* handle, int keycode, int modifiers)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorKeyDown_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorKeyDown(handle, keycode, modifiers);
     });
@@ -823,6 +979,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorKeyDown_(void* handle, in
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorKeyUp_(void* handle, int keycode, int modifiers)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorKeyUp_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorKeyUp(handle, keycode, modifiers);
     });
@@ -830,6 +987,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorKeyUp_(void* handle, int
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseClick_(void* handle, int button)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorMouseClick_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorMouseClick(handle, button);
     });
@@ -837,6 +995,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseClick_(void* handle,
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseDblClick_(void* handle, int button)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorMouseDblClick_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorMouseDblClick(handle, button);
     });
@@ -844,6 +1003,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseDblClick_(void* hand
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseDown_(void* handle, int button)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorMouseDown_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorMouseDown(handle, button);
     });
@@ -851,6 +1011,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseDown_(void* handle,
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseDragDrop_(void* handle, int64_t x1, int64_t y1, int64_t x2, int64_t y2, int button)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorMouseDragDrop_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorMouseDragDrop(handle, x1, y1, x2, y2, button);
     });
@@ -858,6 +1019,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseDragDrop_(void* hand
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseMove_(void* handle, PointI* point)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorMouseMove_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorMouseMove(handle, *point);
     });
@@ -865,6 +1027,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseMove_(void* handle,
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseUp_(void* handle, int button)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorMouseUp_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorMouseUp(handle, button);
     });
@@ -872,6 +1035,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorMouseUp_(void* handle, in
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorSelect_(void* handle, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorSelect_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorSelect(handle, *text);
     });
@@ -879,6 +1043,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorSelect_(void* handle, Nat
 
 ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorText_(void* handle, NativeStringSpan* text)
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorText_");
     return MarshalExceptions<c_bool>([&](){
         return WxOtherFactory::UIActionSimulatorText(handle, *text);
     });
@@ -886,6 +1051,7 @@ ALTERNET_UI_API c_bool WxOtherFactory_UIActionSimulatorText_(void* handle, Nativ
 
 ALTERNET_UI_API void WxOtherFactory_UIActionSimulatorYield_()
 {
+    ALTERNET_UI_PERF_EXPORT("WxOtherFactory_UIActionSimulatorYield_");
     MarshalExceptions<void>([&](){
         WxOtherFactory::UIActionSimulatorYield();
     });
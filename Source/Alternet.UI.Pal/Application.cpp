@@ -211,6 +211,7 @@ scrollbar.horizontal{
 
     void IdleCallback()
     {
+        Control::FlushPendingRecreations();
         Application::GetCurrent()->RaiseIdle();
 
     }
@@ -226,10 +227,15 @@ scrollbar.horizontal{
 
     Application::Application()
     {
+        PerformanceCounters::StartupScope totalScope(StartupPhase::Total);
+
         Exception::_logMessageProc = LogExceptionInfo;
         wxSizerFlags::DisableConsistencyChecks();
 
-        GenericImage::EnsureImageHandlersInitialized();
+        {
+            PerformanceCounters::StartupScope scope(StartupPhase::ImageHandlers);
+            GenericImage::EnsureImageHandlersInitialized();
+        }
 
         if (s_current != nullptr)
             throwExInvalidOpWithInfo("Application::Application");
@@ -242,8 +248,16 @@ scrollbar.horizontal{
         char b[] = "";
         char* argv[] = { b };
         int argc = 1;
-        wxEntryStart(argc, argv);
-        wxTheApp->CallOnInit();
+
+        {
+            PerformanceCounters::StartupScope scope(StartupPhase::EntryStart);
+            wxEntryStart(argc, argv);
+        }
+
+        {
+            PerformanceCounters::StartupScope scope(StartupPhase::CallOnInit);
+            wxTheApp->CallOnInit();
+        }
 
         _keyboard = new Keyboard();
         _mouse = new Mouse();
@@ -792,4 +806,37 @@ public:
 		return NativeStringSpan();
     }
 
+    /*static*/ NativeStringSpan Application::GetPerformanceCounters()
+    {
+        _containerStatic = PerformanceCounters::GetSnapshot();
+        return wxStr(_containerStatic);
+    }
+
+    /*static*/ void Application::ResetPerformanceCounters()
+    {
+        PerformanceCounters::Reset();
+    }
+
+    /*static*/ void Application::StartPerformanceTrace(int maxEvents)
+    {
+        PerformanceCounters::StartTracing(maxEvents);
+    }
+
+    /*static*/ void Application::StopPerformanceTrace()
+    {
+        PerformanceCounters::StopTracing();
+    }
+
+    /*static*/ NativeStringSpan Application::GetPerformanceTraceJson()
+    {
+        _containerStatic = PerformanceCounters::GetTraceJson();
+        return wxStr(_containerStatic);
+    }
+
+    /*static*/ void Application::GetStartupTimings(int64_t* timings, int timingsCount)
+    {
+        auto count = std::min(timingsCount, (int)StartupPhase::Count);
+        for (int i = 0; i < count; i++)
+            timings[i] = PerformanceCounters::GetStartupMicroseconds((StartupPhase)i);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "BenchmarkRunner.h"
+
+namespace Alternet::UI::Benchmarks
+{
+    BenchmarkRunner::BenchmarkRunner(const wxString& filter, int repetitions)
+        : _filter(filter), _repetitions(repetitions < 1 ? 1 : repetitions)
+    {
+    }
+
+    void BenchmarkRunner::Add(const Benchmark& benchmark)
+    {
+        if (_filter.IsEmpty() || benchmark.Name.Contains(_filter))
+            _benchmarks.push_back(benchmark);
+    }
+
+    void BenchmarkRunner::Add(const wxString& name, int iterations, std::function<void(int iteration)> body)
+    {
+        Benchmark benchmark;
+        benchmark.Name = name;
+        benchmark.Iterations = iterations;
+        benchmark.Body = body;
+        Add(benchmark);
+    }
+
+    /*static*/ double BenchmarkRunner::RunRepetition(const Benchmark& benchmark, int iterations)
+    {
+        if (benchmark.SetUp)
+            benchmark.SetUp();
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < iterations; i++)
+            benchmark.Body(i);
+
+        auto end = std::chrono::steady_clock::now();
+
+        if (benchmark.TearDown)
+            benchmark.TearDown();
+
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        return (double)ns / iterations;
+    }
+
+    void BenchmarkRunner::Run()
+    {
+        for (auto& benchmark : _benchmarks)
+        {
+            std::cerr << benchmark.Name.ToStdString() << std::endl;
+
+            RunRepetition(benchmark, std::max(1, benchmark.Iterations / 10));
+
+            std::vector<double> samples;
+            for (int i = 0; i < _repetitions; i++)
+                samples.push_back(RunRepetition(benchmark, benchmark.Iterations));
+
+            std::sort(samples.begin(), samples.end());
+
+            Result result;
+            result.Name = benchmark.Name;
+            result.Iterations = benchmark.Iterations;
+            result.MedianNsPerOp = samples[samples.size() / 2];
+            result.MinNsPerOp = samples.front();
+            result.MaxNsPerOp = samples.back();
+            _results.push_back(result);
+        }
+    }
+
+    wxString BenchmarkRunner::ToJson()
+    {
+        wxString result = wxString::Format(
+            "{\n  \"toolkit\": \"%s\",\n  \"repetitions\": %d,\n  \"benchmarks\": [",
+            wxVERSION_STRING, _repetitions);
+
+        for (size_t i = 0; i < _results.size(); i++)
+        {
+            auto& item = _results[i];
+
+            if (i > 0)
+                result += ",";
+
+            result += wxString::Format(
+                "\n    {\"name\": \"%s\", \"iterations\": %d, \"medianNsPerOp\": %.1f, "
+                "\"minNsPerOp\": %.1f, \"maxNsPerOp\": %.1f}",
+                item.Name,
+                item.Iterations,
+                item.MedianNsPerOp,
+                item.MinNsPerOp,
+                item.MaxNsPerOp);
+        }
+
+        result += "\n  ]\n}\n";
+        return result;
+    }
+}
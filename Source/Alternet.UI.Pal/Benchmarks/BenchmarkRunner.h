@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Common.h"
+
+#include <chrono>
+
+namespace Alternet::UI::Benchmarks
+{
+    // Runs registered benchmarks and reports results as JSON. Each benchmark
+    // runs a fixed number of iterations per repetition after a warm-up, and
+    // the median repetition is reported, so results of different runs of the
+    // same build are comparable.
+    class BenchmarkRunner
+    {
+    public:
+        struct Benchmark
+        {
+            wxString Name;
+            int Iterations = 1;
+            std::function<void()> SetUp;
+            std::function<void(int iteration)> Body;
+            std::function<void()> TearDown;
+        };
+
+        BenchmarkRunner(const wxString& filter, int repetitions);
+
+        void Add(const Benchmark& benchmark);
+        void Add(const wxString& name, int iterations, std::function<void(int iteration)> body);
+
+        void Run();
+        wxString ToJson();
+
+    private:
+        struct Result
+        {
+            wxString Name;
+            int Iterations;
+            double MedianNsPerOp;
+            double MinNsPerOp;
+            double MaxNsPerOp;
+        };
+
+        static double RunRepetition(const Benchmark& benchmark, int iterations);
+
+        wxString _filter;
+        int _repetitions;
+        std::vector<Benchmark> _benchmarks;
+        std::vector<Result> _results;
+    };
+
+    void AddDrawingBenchmarks(BenchmarkRunner& runner);
+    void AddImageBenchmarks(BenchmarkRunner& runner);
+    void AddControlBenchmarks(BenchmarkRunner& runner);
+    void AddMarshallingBenchmarks(BenchmarkRunner& runner);
+    void AddTextBenchmarks(BenchmarkRunner& runner);
+}
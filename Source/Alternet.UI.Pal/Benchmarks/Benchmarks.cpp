@@ -0,0 +1,1014 @@
+#include "BenchmarkRunner.h"
+
+#include "AnimationDecoder.h"
+#include "DrawingContext.h"
+#include "GenericImage.h"
+#include "Image.h"
+#include "ImageEncoder.h"
+#include "ImageList.h"
+#include "MappedImage.h"
+#include "SolidBrush.h"
+#include "Pen.h"
+#include "Panel.h"
+#include "ListView.h"
+#include "TreeView.h"
+#include "RichTextBox.h"
+#include "TextBox.h"
+#include "TextBoxTextAttr.h"
+#include "TextDocument.h"
+#include "ThemePartRenderer.h"
+#include "WebBrowser.h"
+#include "WxOtherFactory.h"
+
+#include <wx/wfstream.h>
+
+#include <memory>
+#include <thread>
+
+namespace Alternet::UI::Benchmarks
+{
+    using Benchmark = BenchmarkRunner::Benchmark;
+
+    namespace
+    {
+        // Keeps the encoded text alive while the span is used, the same way
+        // managed callers pass strings to the exports.
+        class NativeText
+        {
+        public:
+            NativeText(const wxString& text)
+            {
+#if defined(__WXMSW__)
+                _buffer = text.wc_str();
+                Span.Length = (int)text.length();
+#else
+                _buffer = text.utf8_str();
+                Span.Length = (int)_buffer.length();
+#endif
+                Span.Pointer = (void*)_buffer.data();
+            }
+
+            NativeStringSpan Span;
+
+        private:
+#if defined(__WXMSW__)
+            wxScopedWCharBuffer _buffer;
+#else
+            wxScopedCharBuffer _buffer;
+#endif
+        };
+
+        struct DrawingState
+        {
+            GenericImage* Target = nullptr;
+            DrawingContext* Context = nullptr;
+            SolidBrush* Fill = nullptr;
+            Pen* Stroke = nullptr;
+            std::vector<float> Rects;
+            std::vector<float> Points;
+
+            void SetUp()
+            {
+                Target = new GenericImage(wxImage(800, 600, true));
+                Context = DrawingContext::CreateHeadless(Target);
+
+                Fill = new SolidBrush();
+                Fill->Initialize(Color(255, 30, 120, 200));
+
+                Stroke = new Pen();
+                Stroke->Initialize(DashStyle::Solid, Color(255, 200, 40, 40), 1, LineCap::Flat, LineJoin::Miter);
+
+                Rects.clear();
+                Points.clear();
+
+                for (int i = 0; i < 1000; i++)
+                {
+                    float x = (float)((i * 37) % 780);
+                    float y = (float)((i * 53) % 580);
+
+                    Rects.insert(Rects.end(), { x, y, 16, 12 });
+                    Points.insert(Points.end(), { x, y, x + 20, y + 15 });
+                }
+            }
+
+            void TearDown()
+            {
+                Context->Release();
+                Fill->Release();
+                Stroke->Release();
+                Target->Release();
+            }
+        };
+
+        Benchmark MakeDrawingBenchmark(const wxString& name, int iterations,
+            std::function<void(DrawingState& state, int iteration)> body)
+        {
+            auto state = std::make_shared<DrawingState>();
+
+            Benchmark benchmark;
+            benchmark.Name = name;
+            benchmark.Iterations = iterations;
+            benchmark.SetUp = [state]() { state->SetUp(); };
+            benchmark.Body = [state, body](int i) { body(*state, i); };
+            benchmark.TearDown = [state]() { state->TearDown(); };
+            return benchmark;
+        }
+
+        const char* SampleSvg =
+            "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"0 0 24 24\">"
+            "<path d=\"M12 2L2 7l10 5 10-5-10-5zM2 17l10 5 10-5M2 12l10 5 10-5\" "
+            "fill=\"none\" stroke=\"currentColor\" stroke-width=\"2\"/>"
+            "<circle cx=\"12\" cy=\"12\" r=\"3\" fill=\"currentColor\"/></svg>";
+
+        void* ControlEventCallback(Control* obj, ControlEvent event, void* param)
+        {
+            return nullptr;
+        }
+
+        int s_webBrowserLoads = 0;
+        int s_scriptBatchResults = 0;
+        int s_scriptBatchErrors = 0;
+
+        void* WebBrowserEventCallback(WebBrowser* obj, WebBrowserEvent event, void* param)
+        {
+            if (event == WebBrowserEvent::Loaded)
+                s_webBrowserLoads++;
+            else if (event == WebBrowserEvent::ScriptBatchResult)
+            {
+                s_scriptBatchResults++;
+                auto data = (WebBrowserEventData*)param;
+                if (wxStr(data->Text).Contains(",1,"))
+                    s_scriptBatchErrors++;
+            }
+            return nullptr;
+        }
+
+        // Processes events until the condition is met, returns false when
+        // the timeout is over first.
+        bool ProcessEventsUntil(std::function<bool()> condition, int timeoutMs)
+        {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+            while (!condition())
+            {
+                if (std::chrono::steady_clock::now() >= deadline)
+                    return false;
+
+                wxTheApp->Yield(true);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            return true;
+        }
+
+        void QueueScripts(WebBrowser* browser, int count)
+        {
+            for (int script = 0; script < count; script++)
+            {
+                NativeText text(wxString::Format("var x%d = %d; x%d * 2", script, script, script));
+                browser->QueueScript(text.Span);
+            }
+        }
+
+        // 10k lines of code-like text and its (start, end, styleId) runs for
+        // keyword, identifier, number and comment styles.
+        struct HighlightState
+        {
+            wxString Text;
+            std::vector<int64_t> Runs;
+            std::vector<wxTextAttr> Styles;
+
+            void SetUp()
+            {
+                Text.clear();
+                Runs.clear();
+
+                wxString line = "int value = 12345; // comment\n";
+                int64_t position = 0;
+
+                for (int i = 0; i < 10000; i++)
+                {
+                    Text += line;
+                    Runs.insert(Runs.end(), {
+                        position, position + 3, 0,
+                        position + 4, position + 9, 1,
+                        position + 12, position + 17, 2,
+                        position + 19, position + 29, 3 });
+                    position += line.length();
+                }
+
+                Styles.clear();
+                for (auto color : { wxColour(0, 0, 255), wxColour(0, 0, 0), wxColour(9, 134, 88), wxColour(0, 128, 0) })
+                {
+                    wxTextAttr style;
+                    style.SetTextColour(color);
+                    Styles.push_back(style);
+                }
+            }
+        };
+    }
+
+    void AddDrawingBenchmarks(BenchmarkRunner& runner)
+    {
+        runner.Add(MakeDrawingBenchmark("DrawingContext.FillRectangle", 20000,
+            [](DrawingState& state, int i)
+            {
+                auto r = &state.Rects[(i % 1000) * 4];
+                state.Context->FillRectangle(state.Fill, Rect(r[0], r[1], r[2], r[3]));
+            }));
+
+        runner.Add(MakeDrawingBenchmark("DrawingContext.FillRectangles.1000", 100,
+            [](DrawingState& state, int i)
+            {
+                state.Context->FillRectangles(state.Fill, state.Rects.data(), (int)state.Rects.size());
+            }));
+
+        runner.Add(MakeDrawingBenchmark("DrawingContext.DrawLine", 20000,
+            [](DrawingState& state, int i)
+            {
+                auto p = &state.Points[(i % 1000) * 4];
+                state.Context->DrawLine(state.Stroke, Point(p[0], p[1]), Point(p[2], p[3]));
+            }));
+
+        runner.Add(MakeDrawingBenchmark("DrawingContext.DrawLineSegments.1000", 100,
+            [](DrawingState& state, int i)
+            {
+                state.Context->DrawLineSegments(state.Stroke, state.Points.data(), (int)state.Points.size());
+            }));
+
+        runner.Add(MakeDrawingBenchmark("DrawingContext.Ellipse", 10000,
+            [](DrawingState& state, int i)
+            {
+                auto r = &state.Rects[(i % 1000) * 4];
+                state.Context->Ellipse(state.Stroke, state.Fill, Rect(r[0], r[1], r[2], r[3]));
+            }));
+
+        runner.Add("DrawingContext.CreateMemoryDC", 10000, [](int i)
+            {
+                DrawingContext::CreateMemoryDC(1)->Release();
+            });
+
+        // Scratch 64x64 bitmap for each owner-drawn item, new and pooled.
+        runner.Add("Image.Scratch.64x64.New", 10000, [](int i)
+            {
+                auto image = new Image();
+                image->SetBitmap(wxBitmap(64, 64, 32));
+                DrawingContext::CreateMemoryDCFromImage(image)->Release();
+                image->Release();
+            });
+
+        runner.Add("Image.Scratch.64x64.Pooled", 10000, [](int i)
+            {
+                auto image = Image::CreatePooled(64, 64, 32, 1);
+                DrawingContext::CreateMemoryDCFromImage(image)->Release();
+                image->ReturnToPool();
+                image->Release();
+            });
+
+        // 1000 checklist rows of a check box and a label, drawn with a call
+        // for each part and in one batch with and without the part cache.
+        struct ChecklistState
+        {
+            wxFrame* Frame = nullptr;
+            Image* Target = nullptr;
+            std::vector<int64_t> Records;
+            std::unique_ptr<NativeText> Strings;
+        };
+
+        auto checklist = std::make_shared<ChecklistState>();
+
+        auto addChecklist = [&runner, checklist](const wxString& name,
+            std::function<void(ChecklistState& state)> draw)
+        {
+            Benchmark benchmark;
+            benchmark.Name = name;
+            benchmark.Iterations = 20;
+            benchmark.SetUp = [checklist]()
+            {
+                auto& state = *checklist;
+                state.Frame = new wxFrame(nullptr, wxID_ANY, wxEmptyString);
+                state.Target = new Image();
+                state.Target->SetBitmap(wxBitmap(200, 1000 * 20, 32));
+
+                wxArrayString labels;
+                state.Records.clear();
+                for (int row = 0; row < 1000; row++)
+                {
+                    auto flags = row % 3 == 0 ? wxCONTROL_CHECKED : 0;
+                    labels.Add(wxString::Format("Item %d", row));
+                    state.Records.insert(state.Records.end(), {
+                        ThemePartRenderer::CheckBox, 2, row * 20 + 2, 16, 16, flags, 0, 0, -1,
+                        ThemePartRenderer::ItemText, 22, row * 20, 178, 20, 0,
+                        wxALIGN_LEFT | wxALIGN_CENTER_VERTICAL, wxELLIPSIZE_END, row });
+                }
+                state.Strings = std::make_unique<NativeText>(ArrayStringToString(labels));
+                WxOtherFactory::RendererClearPartCache();
+            };
+            benchmark.Body = [checklist, draw](int i) { draw(*checklist); };
+            benchmark.TearDown = [checklist]()
+            {
+                checklist->Target->Release();
+                checklist->Frame->Destroy();
+            };
+            runner.Add(benchmark);
+        };
+
+        addChecklist("Renderer.Checklist.1000.PerCall", [](ChecklistState& state)
+            {
+                auto& records = state.Records;
+                for (size_t i = 0; i < records.size(); i += ThemePartRenderer::RecordStride * 2)
+                {
+                    auto record = records.data() + i;
+                    WxOtherFactory::RendererDrawCheckBox(nullptr, state.Frame, state.Target,
+                        Int32Rect((int)record[1], (int)record[2], (int)record[3], (int)record[4]),
+                        (int)record[5]);
+
+                    record += ThemePartRenderer::RecordStride;
+                    NativeText text(wxString::Format("Item %d", (int)record[8]));
+                    WxOtherFactory::RendererDrawItemText(nullptr, state.Frame, state.Target, text.Span,
+                        Int32Rect((int)record[1], (int)record[2], (int)record[3], (int)record[4]),
+                        (int)record[6], (int)record[5], (int)record[7]);
+                }
+            });
+
+        addChecklist("Renderer.Checklist.1000.Batch", [](ChecklistState& state)
+            {
+                WxOtherFactory::RendererDrawBatch(nullptr, state.Frame, state.Target, state.Records.data(),
+                    (int)state.Records.size(), state.Strings->Span, false);
+            });
+
+        addChecklist("Renderer.Checklist.1000.BatchCached", [](ChecklistState& state)
+            {
+                WxOtherFactory::RendererDrawBatch(nullptr, state.Frame, state.Target, state.Records.data(),
+                    (int)state.Records.size(), state.Strings->Span, true);
+            });
+    }
+
+    void AddImageBenchmarks(BenchmarkRunner& runner)
+    {
+        auto image = std::make_shared<GenericImage*>(nullptr);
+
+        auto add = [&runner, image](const wxString& name, int iterations,
+            std::function<void*(void* handle)> filter)
+        {
+            Benchmark benchmark;
+            benchmark.Name = name;
+            benchmark.Iterations = iterations;
+            benchmark.SetUp = [image]()
+            {
+                *image = new GenericImage(wxImage(512, 512, true));
+                (*image)->_image.SetRGB(wxRect(64, 64, 256, 256), 200, 100, 50);
+            };
+            benchmark.Body = [image, filter](int i)
+            {
+                auto result = filter(*image);
+                if (result != nullptr)
+                    GenericImage::DeleteImage(result);
+            };
+            benchmark.TearDown = [image]() { GenericImage::DeleteImage(*image); };
+            runner.Add(benchmark);
+        };
+
+        add("GenericImage.Blur.512", 20,
+            [](void* handle) { return GenericImage::Blur(handle, 4); });
+        add("GenericImage.ConvertToGreyscale.512", 200,
+            [](void* handle) { return GenericImage::ConvertToGreyscale(handle); });
+        add("GenericImage.Scale.512to128", 200,
+            [](void* handle) { return GenericImage::Scale(handle, 128, 128, wxIMAGE_QUALITY_BILINEAR); });
+        add("GenericImage.Rotate90.512", 200,
+            [](void* handle) { return GenericImage::Rotate90(handle, true); });
+        add("GenericImage.ChangeBrightness.512", 100,
+            [](void* handle) { GenericImage::ChangeBrightness(handle, 0.1); return (void*)nullptr; });
+
+        runner.Add("Image.LoadSvgFromString.32", 500, [](int i)
+            {
+                static const NativeText svg(SampleSvg);
+                auto image = new Image();
+                image->LoadSvgFromString(svg.Span, 32, 32, Color(255, 0, 0, 0));
+                image->Release();
+            });
+
+        // 1000 decodes of PNG, JPEG, BMP and TIFF images of different sizes.
+        auto encoded = std::make_shared<std::vector<std::vector<uint8_t>>>();
+
+        for (int threads : { 1, 2, 4, 8 })
+        {
+            Benchmark decode;
+            decode.Name = wxString::Format("GenericImage.DecodeAsync.1000.Threads%d", threads);
+            decode.Iterations = 1;
+            decode.SetUp = [encoded, threads]()
+            {
+                GenericImage::EnsureImageHandlersInitialized();
+                GenericImage::SetDecodeThreadCount(threads);
+
+                if (!encoded->empty())
+                    return;
+
+                wxBitmapType types[] = { wxBITMAP_TYPE_PNG, wxBITMAP_TYPE_JPEG,
+                    wxBITMAP_TYPE_BMP, wxBITMAP_TYPE_TIFF };
+
+                for (int i = 0; i < 250; i++)
+                {
+                    auto type = types[i % 4];
+                    if (wxImage::FindHandler(type) == nullptr)
+                        type = wxBITMAP_TYPE_BMP;
+
+                    wxImage sample(128 + (i % 5) * 64, 96 + (i % 3) * 64);
+                    auto data = sample.GetData();
+                    for (int p = 0; p < sample.GetWidth() * sample.GetHeight(); p++)
+                    {
+                        data[p * 3] = (unsigned char)(p + i);
+                        data[p * 3 + 1] = (unsigned char)(p / sample.GetWidth() * 2);
+                        data[p * 3 + 2] = (unsigned char)(i * 7);
+                    }
+
+                    wxMemoryOutputStream stream;
+                    sample.SaveFile(stream, type);
+
+                    std::vector<uint8_t> bytes(stream.GetLength());
+                    stream.CopyTo(bytes.data(), bytes.size());
+                    encoded->push_back(std::move(bytes));
+                }
+            };
+            decode.Body = [encoded](int i)
+            {
+                int remaining = 0;
+                for (int copy = 0; copy < 4; copy++)
+                {
+                    for (auto& bytes : *encoded)
+                    {
+                        GenericImage::DecodeMemoryAsync((void*)bytes.data(), (int)bytes.size(),
+                            wxBITMAP_TYPE_ANY, -1);
+                        remaining++;
+                    }
+                }
+
+                int64_t results[64 * 3];
+                while (remaining > 0)
+                {
+                    auto count = GenericImage::PollDecoded(results, 64 * 3);
+                    for (int r = 0; r < count; r++)
+                    {
+                        if (results[r * 3 + 1] != 0)
+                            GenericImage::DeleteImage((void*)results[r * 3 + 1]);
+                    }
+
+                    remaining -= count;
+                    if (count == 0)
+                        std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+            };
+            decode.TearDown = []() { GenericImage::SetDecodeThreadCount(0); };
+            runner.Add(decode);
+        }
+
+        // 4000x3000 JPEG reduced to 160x120: full decode with scaling
+        // compared to the thumbnail path.
+        auto photo = std::make_shared<std::vector<uint8_t>>();
+        auto makePhoto = [photo]()
+        {
+            GenericImage::EnsureImageHandlersInitialized();
+            if (!photo->empty() || wxImage::FindHandler(wxBITMAP_TYPE_JPEG) == nullptr)
+                return;
+
+            wxImage sample(4000, 3000);
+            auto data = sample.GetData();
+            for (int p = 0; p < 4000 * 3000; p++)
+            {
+                data[p * 3] = (unsigned char)(p % 4000 / 16);
+                data[p * 3 + 1] = (unsigned char)(p / 4000 / 12);
+                data[p * 3 + 2] = (unsigned char)(p % 251);
+            }
+
+            wxMemoryOutputStream stream;
+            sample.SaveFile(stream, wxBITMAP_TYPE_JPEG);
+            photo->resize(stream.GetLength());
+            stream.CopyTo(photo->data(), photo->size());
+        };
+
+        Benchmark fullDecode;
+        fullDecode.Name = "GenericImage.DecodeAndScale.4000x3000";
+        fullDecode.Iterations = 5;
+        fullDecode.SetUp = makePhoto;
+        fullDecode.Body = [photo](int i)
+        {
+            wxImage image;
+            wxMemoryInputStream stream(photo->data(), photo->size());
+            if (image.LoadFile(stream, wxBITMAP_TYPE_JPEG))
+                image.Rescale(160, 120, wxIMAGE_QUALITY_BILINEAR);
+        };
+        runner.Add(fullDecode);
+
+        Benchmark thumbnail;
+        thumbnail.Name = "GenericImage.CreateThumbnail.4000x3000";
+        thumbnail.Iterations = 5;
+        thumbnail.SetUp = makePhoto;
+        thumbnail.Body = [photo](int i)
+        {
+            auto image = GenericImage::CreateThumbnailFromMemory(photo->data(),
+                (int)photo->size(), 160, 120);
+            if (image != nullptr)
+                GenericImage::DeleteImage(image);
+        };
+        runner.Add(thumbnail);
+
+        // 4000x4000 24-bit BMP file: loaded by the handler, converted from
+        // the mapping and a 256x256 region read from the mapping.
+        auto bmpPath = std::make_shared<wxString>();
+        auto makeBmp = [bmpPath]()
+        {
+            GenericImage::EnsureImageHandlersInitialized();
+            if (!bmpPath->IsEmpty())
+                return;
+
+            wxImage sample(4000, 4000);
+            auto data = sample.GetData();
+            for (int p = 0; p < 4000 * 4000; p++)
+            {
+                data[p * 3] = (unsigned char)(p % 4000 / 16);
+                data[p * 3 + 1] = (unsigned char)(p / 4000 / 16);
+                data[p * 3 + 2] = (unsigned char)(p % 251);
+            }
+
+            *bmpPath = wxFileName::CreateTempFileName("bench");
+            sample.SaveFile(*bmpPath, wxBITMAP_TYPE_BMP);
+        };
+        auto removeBmp = [bmpPath]()
+        {
+            if (!bmpPath->IsEmpty())
+                wxRemoveFile(*bmpPath);
+            bmpPath->clear();
+        };
+
+        Benchmark loadBmp;
+        loadBmp.Name = "GenericImage.LoadFile.Bmp.4000x4000";
+        loadBmp.Iterations = 5;
+        loadBmp.SetUp = makeBmp;
+        loadBmp.Body = [bmpPath](int i)
+        {
+            wxImage image;
+            image.LoadFile(*bmpPath, wxBITMAP_TYPE_BMP);
+        };
+        runner.Add(loadBmp);
+
+        Benchmark mappedBmp;
+        mappedBmp.Name = "GenericImage.CreateImageFromMappedFile.Bmp.4000x4000";
+        mappedBmp.Iterations = 5;
+        mappedBmp.SetUp = makeBmp;
+        mappedBmp.Body = [bmpPath](int i)
+        {
+            NativeText path(*bmpPath);
+            auto image = GenericImage::CreateImageFromMappedFile(path.Span);
+            if (image != nullptr)
+                GenericImage::DeleteImage(image);
+        };
+        runner.Add(mappedBmp);
+
+        Benchmark mappedRegion;
+        mappedRegion.Name = "MappedImage.ReadRegion.256x256";
+        mappedRegion.Iterations = 100;
+        mappedRegion.SetUp = makeBmp;
+        mappedRegion.Body = [bmpPath](int i)
+        {
+            NativeText path(*bmpPath);
+            MappedImage mapped;
+            wxImage region;
+            if (mapped.Open(path.Span))
+                mapped.Read(wxRect(i % 15 * 256, i / 15 % 15 * 256, 256, 256), region);
+        };
+        mappedRegion.TearDown = removeBmp;
+        runner.Add(mappedRegion);
+
+        // 3840x2160 screenshot-like image saved as PNG by the handler and
+        // by the encoder with the balanced preset.
+        auto screenshot = std::make_shared<wxImage>();
+        auto makeScreenshot = [screenshot]()
+        {
+            GenericImage::EnsureImageHandlersInitialized();
+            if (screenshot->IsOk())
+                return;
+
+            screenshot->Create(3840, 2160, false);
+            auto data = screenshot->GetData();
+            for (int p = 0; p < 3840 * 2160; p++)
+            {
+                auto x = p % 3840;
+                auto y = p / 3840;
+                auto text = (x / 7 + y / 15) % 5 == 0;
+                data[p * 3] = text ? 30 : (unsigned char)(240 - y / 40);
+                data[p * 3 + 1] = text ? 30 : (unsigned char)(240 - x / 80);
+                data[p * 3 + 2] = text ? 30 : 250;
+            }
+        };
+
+        Benchmark handlerPng;
+        handlerPng.Name = "GenericImage.SaveFile.Png.3840x2160";
+        handlerPng.Iterations = 3;
+        handlerPng.SetUp = makeScreenshot;
+        handlerPng.Body = [screenshot](int i)
+        {
+            wxMemoryOutputStream stream;
+            screenshot->SaveFile(stream, wxBITMAP_TYPE_PNG);
+        };
+        runner.Add(handlerPng);
+
+        Benchmark encoderPng;
+        encoderPng.Name = "ImageEncoder.Save.Png.Balanced.3840x2160";
+        encoderPng.Iterations = 3;
+        encoderPng.SetUp = makeScreenshot;
+        encoderPng.Body = [screenshot](int i)
+        {
+            wxMemoryOutputStream stream;
+            ImageEncoder::Save(*screenshot, stream, wxBITMAP_TYPE_PNG,
+                ImageEncoder::GetOptions(ImageEncoder::Balanced, -1, -1, -1, -1));
+        };
+        runner.Add(encoderPng);
+
+        // 30 frame 256x256 GIF played 10 times: each frame loaded by index
+        // compared to the animation decoder with its frame cache.
+        auto gifPath = std::make_shared<wxString>();
+        auto makeGif = [gifPath]()
+        {
+            GenericImage::EnsureImageHandlersInitialized();
+            if (!gifPath->IsEmpty())
+                return;
+
+            wxImageArray frames;
+            for (int frame = 0; frame < 30; frame++)
+            {
+                wxImage image(256, 256);
+                image.SetRGB(wxRect(0, 0, 256, 256), 255, 255, 255);
+                image.SetRGB(wxRect(frame * 8, 96, 32, 64), 40, 120, 200);
+                frames.Add(image);
+            }
+
+            *gifPath = wxFileName::CreateTempFileName("bench");
+            wxFileOutputStream stream(*gifPath);
+            wxGIFHandler().SaveAnimation(frames, &stream, false, 50);
+        };
+        auto removeGif = [gifPath]()
+        {
+            if (!gifPath->IsEmpty())
+                wxRemoveFile(*gifPath);
+            gifPath->clear();
+        };
+
+        Benchmark gifByIndex;
+        gifByIndex.Name = "GenericImage.LoadFile.GifFrames.30x10";
+        gifByIndex.Iterations = 1;
+        gifByIndex.SetUp = makeGif;
+        gifByIndex.Body = [gifPath](int i)
+        {
+            for (int loop = 0; loop < 10; loop++)
+            {
+                for (int frame = 0; frame < 30; frame++)
+                {
+                    wxImage image;
+                    image.LoadFile(*gifPath, wxBITMAP_TYPE_GIF, frame);
+                }
+            }
+        };
+        runner.Add(gifByIndex);
+
+        Benchmark gifDecoder;
+        gifDecoder.Name = "AnimationDecoder.GetFrameImage.30x10";
+        gifDecoder.Iterations = 1;
+        gifDecoder.SetUp = makeGif;
+        gifDecoder.Body = [gifPath](int i)
+        {
+            NativeText path(*gifPath);
+            auto decoder = new AnimationDecoder();
+            decoder->LoadFile(path.Span);
+
+            for (int loop = 0; loop < 10; loop++)
+            {
+                for (int frame = 0; frame < decoder->GetFrameCount(); frame++)
+                    GenericImage::DeleteImage(decoder->GetFrameImage(frame));
+            }
+
+            decoder->Release();
+        };
+        gifDecoder.TearDown = removeGif;
+        runner.Add(gifDecoder);
+
+        // 5000 16x16 icons added to image lists of 16x16 (no conversion) and
+        // 24x24 (scaled) images, one by one and as a batch with and without
+        // the atlas.
+        auto icons = std::shared_ptr<std::vector<int64_t>>(new std::vector<int64_t>(),
+            [](std::vector<int64_t>* handles)
+            {
+                for (auto handle : *handles)
+                    ((Image*)handle)->Release();
+                delete handles;
+            });
+
+        struct ImageListCase
+        {
+            const char* Name;
+            int Size;
+            bool Batch;
+            bool Atlas;
+        };
+
+        ImageListCase imageListCases[] =
+        {
+            { "ImageList.AddImage.5000.Scaled", 24, false, false },
+            { "ImageList.AddImage.5000", 16, false, false },
+            { "ImageList.AddImages.5000", 16, true, false },
+            { "ImageList.AddImages.5000.Atlas", 16, true, true },
+        };
+
+        for (auto& imageListCase : imageListCases)
+        {
+            Benchmark imageList;
+            imageList.Name = imageListCase.Name;
+            imageList.Iterations = 5;
+            imageList.SetUp = [icons]()
+            {
+                if (!icons->empty())
+                    return;
+
+                for (int i = 0; i < 5000; i++)
+                {
+                    wxImage icon(16, 16);
+                    icon.SetRGB(wxRect(0, 0, 16, 16), (unsigned char)i, (unsigned char)(i >> 8), 128);
+                    icon.InitAlpha();
+                    memset(icon.GetAlpha(), 255 - i % 64, 16 * 16);
+
+                    auto image = new Image();
+                    image->SetBitmap(wxBitmap(icon, 32));
+                    icons->push_back((int64_t)image);
+                }
+            };
+            imageList.Body = [icons, imageListCase](int i)
+            {
+                auto list = new ImageList();
+                list->SetPixelImageSize(imageListCase.Size, imageListCase.Size);
+                list->SetUseAtlas(imageListCase.Atlas);
+
+                if (imageListCase.Batch)
+                    list->AddImages(icons->data(), (int)icons->size());
+                else
+                {
+                    for (auto handle : *icons)
+                        list->AddImage((Image*)handle);
+                }
+
+                list->Release();
+            };
+            runner.Add(imageList);
+        }
+    }
+
+    void AddControlBenchmarks(BenchmarkRunner& runner)
+    {
+        runner.Add("ListView.InsertItemAt.1000", 5, [](int i)
+            {
+                auto listView = new ListView();
+
+                for (int item = 0; item < 1000; item++)
+                {
+                    NativeText text(wxString::Format("Item %d", item));
+                    listView->InsertItemAt(item, text.Span, 0, -1);
+                }
+
+                listView->Release();
+            });
+
+        runner.Add("TreeView.InsertItem.1000", 5, [](int i)
+            {
+                auto treeView = new TreeView();
+                auto root = treeView->GetRootItem();
+
+                for (int item = 0; item < 100; item++)
+                {
+                    NativeText text(wxString::Format("Node %d", item));
+                    auto node = treeView->InsertItem(root, nullptr, text.Span, -1, false);
+
+                    for (int child = 0; child < 9; child++)
+                    {
+                        NativeText childText(wxString::Format("Child %d", child));
+                        treeView->InsertItem(node, nullptr, childText.Span, -1, false);
+                    }
+                }
+
+                treeView->Release();
+            });
+
+        auto panel = std::make_shared<Panel*>(nullptr);
+
+        Benchmark events;
+        events.Name = "Control.RaiseEvent";
+        events.Iterations = 1000000;
+        events.SetUp = [panel]()
+        {
+            *panel = new Panel();
+            Control::SetEventCallback(ControlEventCallback);
+        };
+        events.Body = [panel](int i) { (*panel)->RaiseEvent(ControlEvent::Paint); };
+        events.TearDown = [panel]()
+        {
+            Control::SetEventCallback(nullptr);
+            (*panel)->Release();
+        };
+        runner.Add(events);
+
+        // Round trip of 100 queued scripts sent in one batch. Skipped when
+        // there is no web view backend, on Linux it runs with WebKitGTK.
+        auto browser = std::make_shared<WebBrowser*>(nullptr);
+
+        Benchmark scripts;
+        scripts.Name = "WebBrowser.QueueScript.100";
+        scripts.Iterations = 20;
+        scripts.SetUp = [browser]()
+        {
+            if (!wxWebView::IsBackendAvailable(wxWebViewBackendDefault))
+                return;
+
+            WebBrowser::SetEventCallback(WebBrowserEventCallback);
+            s_webBrowserLoads = 0;
+
+            *browser = new WebBrowser("about:blank");
+            (*browser)->GetWxWindow();
+
+            if (!ProcessEventsUntil([]() { return s_webBrowserLoads > 0; }, 10000))
+                std::cerr << "WebBrowser: the page was not loaded" << std::endl;
+        };
+        scripts.Body = [browser](int i)
+        {
+            if (*browser == nullptr)
+                return;
+
+            auto expected = s_scriptBatchResults + 1;
+            QueueScripts(*browser, 100);
+            (*browser)->FlushScripts();
+
+            if (!ProcessEventsUntil([expected]() { return s_scriptBatchResults >= expected; }, 5000))
+                std::cerr << "WebBrowser: no result of the script batch" << std::endl;
+        };
+        scripts.TearDown = [browser]()
+        {
+            if (*browser == nullptr)
+                return;
+
+            // A batch in flight is completed with errors when the window is
+            // destroyed.
+            auto expected = s_scriptBatchResults + 1;
+            auto expectedErrors = s_scriptBatchErrors + 1;
+            QueueScripts(*browser, 100);
+            (*browser)->FlushScripts();
+            (*browser)->Destroy();
+
+            if (s_scriptBatchResults < expected || s_scriptBatchErrors < expectedErrors)
+                std::cerr << "WebBrowser: the batch in flight was not completed on destroy" << std::endl;
+
+            (*browser)->Release();
+            *browser = nullptr;
+            WebBrowser::SetEventCallback(nullptr);
+        };
+        runner.Add(scripts);
+    }
+
+    void AddMarshallingBenchmarks(BenchmarkRunner& runner)
+    {
+        runner.Add("wxStr.ToNative.64", 1000000, [](int i)
+            {
+                static const wxString text(wxT("The quick brown fox jumps over the lazy dog 0123456789 abcdefghi"));
+                volatile int length = wxStr(text).Length;
+                (void)length;
+            });
+
+        runner.Add("wxStr.FromNative.64", 1000000, [](int i)
+            {
+                static const NativeText text(wxT("The quick brown fox jumps over the lazy dog 0123456789 abcdefghi"));
+                auto result = wxStr(text.Span);
+                (void)result;
+            });
+    }
+
+    void AddTextBenchmarks(BenchmarkRunner& runner)
+    {
+        auto state = std::make_shared<HighlightState>();
+        auto richTextBox = std::make_shared<RichTextBox*>(nullptr);
+
+        Benchmark perToken;
+        perToken.Name = "RichTextBox.SetStyle.10kLines";
+        perToken.Iterations = 1;
+        perToken.SetUp = [state, richTextBox]()
+        {
+            state->SetUp();
+            *richTextBox = new RichTextBox();
+            NativeText text(state->Text);
+            (*richTextBox)->WriteText(text.Span);
+        };
+        perToken.Body = [state, richTextBox](int i)
+        {
+            auto& runs = state->Runs;
+            for (size_t run = 0; run + 2 < runs.size(); run += 3)
+                (*richTextBox)->SetStyle(runs[run], runs[run + 1], &state->Styles[runs[run + 2]]);
+        };
+        perToken.TearDown = [richTextBox]() { (*richTextBox)->Release(); };
+        runner.Add(perToken);
+
+        Benchmark batch = perToken;
+        batch.Name = "RichTextBox.ApplyStyleRuns.10kLines";
+        batch.Body = [state, richTextBox](int i)
+        {
+            for (auto& style : state->Styles)
+                (*richTextBox)->RegisterStyle(&style);
+            (*richTextBox)->ApplyStyleRuns(state->Runs.data(), (int)state->Runs.size());
+        };
+        runner.Add(batch);
+
+        Benchmark walkStyles = perToken;
+        walkStyles.Name = "RichTextBox.GetStyle.Walk.10kLines";
+        walkStyles.Body = [state, richTextBox](int i)
+        {
+            auto& runs = state->Runs;
+            for (size_t run = 0; run + 2 < runs.size(); run += 3)
+                TextBoxTextAttr::Delete((*richTextBox)->GetStyle(runs[run]));
+        };
+        runner.Add(walkStyles);
+
+        Benchmark walkStyleIds = perToken;
+        walkStyleIds.Name = "RichTextBox.GetStyleId.Walk.10kLines";
+        walkStyleIds.Body = [state, richTextBox](int i)
+        {
+            TextAttrPacked packed;
+            auto& runs = state->Runs;
+            for (size_t run = 0; run + 2 < runs.size(); run += 3)
+            {
+                auto id = (*richTextBox)->GetStyleId(runs[run]);
+                TextBoxTextAttr::ReadPackedPooledAttr(id, &packed, sizeof(packed));
+            }
+        };
+        runner.Add(walkStyleIds);
+
+        Benchmark search = perToken;
+        search.Name = "RichTextBox.FindMatches.10kLines";
+        search.Body = [richTextBox](int i)
+        {
+            static const NativeText pattern("value");
+            std::vector<int64_t> results(20000 * 2);
+
+            (*richTextBox)->SetSearchPattern(pattern.Span, TextSearch::WholeWord);
+            (*richTextBox)->FindMatches(0, results.data(), (int)results.size(), 0);
+        };
+        runner.Add(search);
+
+        auto textBox = std::make_shared<TextBox*>(nullptr);
+
+        Benchmark textBoxBatch;
+        textBoxBatch.Name = "TextBox.ApplyStyleRuns.10kLines";
+        textBoxBatch.Iterations = 1;
+        textBoxBatch.SetUp = [state, textBox]()
+        {
+            state->SetUp();
+            *textBox = new TextBox();
+            (*textBox)->SetMultiline(true);
+            (*textBox)->SetIsRichEdit(true);
+            NativeText text(state->Text);
+            (*textBox)->SetText(text.Span);
+        };
+        textBoxBatch.Body = [state, textBox](int i)
+        {
+            for (auto& style : state->Styles)
+                (*textBox)->RegisterStyle(&style);
+            (*textBox)->ApplyStyleRuns(state->Runs.data(), (int)state->Runs.size());
+        };
+        textBoxBatch.TearDown = [textBox]() { (*textBox)->Release(); };
+        runner.Add(textBoxBatch);
+
+        for (auto logMode : { false, true })
+        {
+            runner.Add(logMode ? "TextBox.AppendText.LogMode.5kLines" : "TextBox.AppendText.5kLines", 1,
+                [logMode](int i)
+                {
+                    auto textBox = new TextBox();
+                    textBox->SetMultiline(true);
+                    textBox->SetLogMode(logMode);
+                    textBox->SetLogLimits(1000, 0);
+
+                    NativeText line("2026-01-01 12:00:00.000 INFO Request completed in 12 ms\n");
+                    for (int item = 0; item < 5000; item++)
+                        textBox->AppendText(line.Span);
+
+                    textBox->FlushLog();
+                    textBox->Release();
+                });
+        }
+
+        runner.Add("TextDocument.Index.1MLines", 1, [](int i)
+            {
+                std::string text;
+                for (int line = 0; line < 1000000; line++)
+                    text += "2026-01-01 12:00:00.000 INFO Request completed in 12 ms\n";
+
+                TextDocument document;
+                document.SetText(text);
+
+                while (document.IsIndexing())
+                    std::this_thread::yield();
+            });
+    }
+}
@@ -0,0 +1,57 @@
+#include "BenchmarkRunner.h"
+#include "Application.h"
+
+#include <fstream>
+
+using namespace Alternet::UI;
+using namespace Alternet::UI::Benchmarks;
+
+// Usage: Alternet.UI.Pal.Benchmarks [--filter <text>] [--repetitions <n>] [--output <file.json>]
+// On Linux run it under a virtual display, for example "xvfb-run -a".
+int main(int argc, char* argv[])
+{
+    wxString filter;
+    wxString output;
+    int repetitions = 5;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        wxString name = argv[i];
+        wxString value = argv[i + 1];
+
+        if (name == "--filter")
+            filter = value;
+        else if (name == "--repetitions")
+            repetitions = wxAtoi(value);
+        else if (name == "--output")
+            output = value;
+        else
+        {
+            std::cerr << "Unknown option: " << name.ToStdString() << std::endl;
+            return 1;
+        }
+    }
+
+    auto application = new Application();
+
+    BenchmarkRunner runner(filter, repetitions);
+    AddDrawingBenchmarks(runner);
+    AddImageBenchmarks(runner);
+    AddControlBenchmarks(runner);
+    AddMarshallingBenchmarks(runner);
+    AddTextBenchmarks(runner);
+    runner.Run();
+
+    auto json = runner.ToJson();
+
+    if (output.IsEmpty())
+        std::cout << json.ToStdString();
+    else
+    {
+        std::ofstream stream(output.ToStdString());
+        stream << json.ToStdString();
+    }
+
+    application->Release();
+    return 0;
+}
@@ -0,0 +1,174 @@
+#include "BitmapPool.h"
+#include "Image.h"
+
+namespace Alternet::UI
+{
+    BitmapPool& BitmapPool::GetInstance()
+    {
+        // Not destroyed on exit, the DCs can't be deleted after wx cleanup.
+        static auto instance = new BitmapPool();
+        return *instance;
+    }
+
+    BitmapPool::~BitmapPool()
+    {
+        Clear();
+    }
+
+    wxMemoryDC* BitmapPool::AcquireDC()
+    {
+        if (_dcs.empty())
+            return new wxMemoryDC();
+
+        auto dc = _dcs.back();
+        _dcs.pop_back();
+        return dc;
+    }
+
+    void BitmapPool::ReleaseDC(wxMemoryDC* dc)
+    {
+        if (dc == nullptr)
+            return;
+
+        // The state is reset while the bitmap is selected: on GTK the DC is
+        // a wxGCDC which has no graphics context without a bitmap.
+        if (_dcs.size() >= MaxDCs || !dc->IsOk())
+        {
+            delete dc;
+            return;
+        }
+
+        dc->DestroyClippingRegion();
+        dc->SetDeviceOrigin(0, 0);
+        dc->SetLogicalOrigin(0, 0);
+        dc->SetUserScale(1, 1);
+        dc->SetLogicalFunction(wxCOPY);
+        dc->SetPen(*wxBLACK_PEN);
+        dc->SetBrush(*wxWHITE_BRUSH);
+        dc->SetBackground(*wxWHITE_BRUSH);
+        dc->SetBackgroundMode(wxBRUSHSTYLE_TRANSPARENT);
+        dc->SetFont(*wxNORMAL_FONT);
+        dc->SetTextForeground(*wxBLACK);
+        dc->SetTextBackground(*wxWHITE);
+        dc->SelectObject(wxNullBitmap);
+
+        _dcs.push_back(dc);
+    }
+
+    wxBitmap BitmapPool::AcquireBitmap(int width, int height, int depth, double scaleFactor)
+    {
+        // Released bitmaps are matched by their actual depth.
+        auto actualDepth = depth;
+        if (actualDepth <= 0)
+        {
+            if (_screenDepth == 0)
+                _screenDepth = wxBitmap(1, 1).GetDepth();
+            actualDepth = _screenDepth;
+        }
+
+        for (auto i = _bitmaps.size(); i > 0; i--)
+        {
+            auto& entry = _bitmaps[i - 1];
+            if (entry.Width == width && entry.Height == height && entry.Depth == actualDepth
+                && entry.ScaleFactor == scaleFactor)
+            {
+                auto bitmap = entry.Bitmap;
+                _pooledBytes -= GetBytes(entry);
+                _bitmaps.erase(_bitmaps.begin() + (i - 1));
+                return bitmap;
+            }
+        }
+
+        wxBitmap bitmap(width, height, depth);
+        bitmap.SetScaleFactor(scaleFactor);
+        return bitmap;
+    }
+
+    void BitmapPool::ReleaseBitmap(wxBitmap& bitmap)
+    {
+        Entry entry;
+        entry.Bitmap = bitmap;
+        bitmap = wxNullBitmap;
+
+        auto refData = entry.Bitmap.GetRefData();
+        if (refData == nullptr || refData->GetRefCount() != 1 || entry.Bitmap.GetMask() != nullptr)
+            return;
+
+        entry.Width = entry.Bitmap.GetWidth();
+        entry.Height = entry.Bitmap.GetHeight();
+        entry.Depth = entry.Bitmap.GetDepth();
+        entry.ScaleFactor = entry.Bitmap.GetScaleFactor();
+
+        _pooledBytes += GetBytes(entry);
+        _bitmaps.push_back(entry);
+        Trim();
+    }
+
+    void BitmapPool::SetLimit(int64_t value)
+    {
+        _limit = std::max(value, (int64_t)0);
+        Trim();
+    }
+
+    int64_t BitmapPool::GetLimit()
+    {
+        return _limit;
+    }
+
+    int64_t BitmapPool::GetPooledBytes()
+    {
+        return _pooledBytes;
+    }
+
+    void BitmapPool::Clear()
+    {
+        for (auto dc : _dcs)
+            delete dc;
+        _dcs.clear();
+
+        _bitmaps.clear();
+        _pooledBytes = 0;
+    }
+
+    /*static*/ int64_t BitmapPool::GetBytes(const Entry& entry)
+    {
+        auto depth = entry.Depth > 0 ? entry.Depth : 32;
+        return (int64_t)entry.Width * entry.Height * depth / 8;
+    }
+
+    void BitmapPool::Trim()
+    {
+        while (!_bitmaps.empty() && (_pooledBytes > _limit || _bitmaps.size() > MaxBitmaps))
+        {
+            _pooledBytes -= GetBytes(_bitmaps.front());
+            _bitmaps.erase(_bitmaps.begin());
+        }
+    }
+
+    BitmapPool::DCScope::DCScope(Image* image)
+    {
+        _dc = GetInstance().AcquireDC();
+
+        if (image == nullptr)
+            return;
+
+        // Taken from the image while it is selected, so the only reference
+        // isn't copied by unsharing. Not replaced with SetBitmap, which
+        // drops the bundle of the image.
+        auto bitmap = image->_bitmap;
+        image->_bitmap = wxNullBitmap;
+        _dc->SelectObject(bitmap);
+        image->_bitmap = bitmap;
+    }
+
+    BitmapPool::DCScope::DCScope(const wxBitmap& source)
+    {
+        _dc = GetInstance().AcquireDC();
+        _dc->SelectObjectAsSource(source);
+    }
+
+    BitmapPool::DCScope::~DCScope()
+    {
+        GetInstance().ReleaseDC(_dc);
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "Common.h"
+
+#include <wx/dcmemory.h>
+
+namespace Alternet::UI
+{
+    class Image;
+
+    // Memory DCs and scratch bitmaps reused by short-lived offscreen
+    // drawing. Bitmaps are matched by size, depth and scale factor and are
+    // taken back only when nothing else references them, so a pooled bitmap
+    // is never shared. Their contents are not cleared. UI thread only.
+    class BitmapPool
+    {
+    public:
+        static constexpr size_t MaxDCs = 8;
+        static constexpr size_t MaxBitmaps = 64;
+        static constexpr int64_t DefaultLimit = 16 * 1024 * 1024;
+
+        static BitmapPool& GetInstance();
+
+        ~BitmapPool();
+
+        wxMemoryDC* AcquireDC();
+        // Deselects the bitmap and resets the state changed by drawing.
+        void ReleaseDC(wxMemoryDC* dc);
+
+        wxBitmap AcquireBitmap(int width, int height, int depth, double scaleFactor);
+        // Resets the bitmap, it is kept when that was the last reference.
+        void ReleaseBitmap(wxBitmap& bitmap);
+
+        void SetLimit(int64_t value);
+        int64_t GetLimit();
+        int64_t GetPooledBytes();
+        void Clear();
+
+        // Pooled memory DC with a bitmap selected for the lifetime of the
+        // scope. With an image the DC draws into its bitmap; selecting
+        // unshares the bitmap, so it is put back into the image.
+        class DCScope
+        {
+        public:
+            DCScope(Image* image);
+            // Source of blits, the bitmap isn't unshared.
+            DCScope(const wxBitmap& source);
+            ~DCScope();
+
+            DCScope(const DCScope&) = delete;
+            DCScope& operator=(const DCScope&) = delete;
+
+            wxMemoryDC& GetDC() { return *_dc; }
+
+        private:
+            wxMemoryDC* _dc;
+        };
+
+    private:
+        struct Entry
+        {
+            int Width = 0;
+            int Height = 0;
+            int Depth = 0;
+            double ScaleFactor = 1;
+            wxBitmap Bitmap;
+        };
+
+        static int64_t GetBytes(const Entry& entry);
+        void Trim();
+
+        std::vector<wxMemoryDC*> _dcs;
+        // Oldest first, taken from the end.
+        std::vector<Entry> _bitmaps;
+        int64_t _pooledBytes = 0;
+        int64_t _limit = DefaultLimit;
+        int _screenDepth = 0;
+    };
+}
@@ -91,10 +91,10 @@ namespace Alternet::UI
         RecreateWxWindowIfNeeded();
     }
 
-    void Button::RecreateWxWindowIfNeeded()
+    void Button::RecreateWxWindowCore()
     {
         auto text = GetButton()->GetLabel();
-        Control::RecreateWxWindowIfNeeded();
+        Control::RecreateWxWindowCore();
         GetButton()->SetLabel(text);
     }
 
@@ -227,7 +227,7 @@ namespace Alternet::UI
         {
             _focusedImage->AddRef();
             if (ButtonImagesEnabled)
-                button->SetBitmapFocus(_focusedImage->GetBitmap());
+                button->SetBitmapFocus(_focusedImage->GetBitmapBundle());
         }
         else
         {
@@ -258,7 +258,7 @@ namespace Alternet::UI
         {
             _normalImage->AddRef();
             if(ButtonImagesEnabled)
-                button->SetBitmap(_normalImage->GetBitmap());
+                button->SetBitmap(_normalImage->GetBitmapBundle());
         }
         else
         {
@@ -288,7 +288,7 @@ namespace Alternet::UI
         {
             _hoveredImage->AddRef();
             if (ButtonImagesEnabled)
-                button->SetBitmapCurrent(_hoveredImage->GetBitmap());
+                button->SetBitmapCurrent(_hoveredImage->GetBitmapBundle());
         }
         else
         {
@@ -318,7 +318,7 @@ namespace Alternet::UI
         {
             _pressedImage->AddRef();
             if (ButtonImagesEnabled)
-                button->SetBitmapPressed(_pressedImage->GetBitmap());
+                button->SetBitmapPressed(_pressedImage->GetBitmapBundle());
         }
         else
         {
@@ -348,7 +348,7 @@ namespace Alternet::UI
         {
             _disabledImage->AddRef();
             if (ButtonImagesEnabled)
-                button->SetBitmapDisabled(_disabledImage->GetBitmap());
+                button->SetBitmapDisabled(_disabledImage->GetBitmapBundle());
         }
         else
         {
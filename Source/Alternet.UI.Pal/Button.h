@@ -48,7 +48,7 @@ namespace Alternet::UI
 
         NativeStringSpan GetText() override;
         void SetText(const NativeStringSpan& value) override;
-        virtual void RecreateWxWindowIfNeeded() override;
+        virtual void RecreateWxWindowCore() override;
 
     protected:
         virtual void OnWxWindowCreated() override;
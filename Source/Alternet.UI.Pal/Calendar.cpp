@@ -52,9 +52,9 @@ namespace Alternet::UI
         RecreateWxWindowIfNeeded();
     }
 
-    void Calendar::RecreateWxWindowIfNeeded()
+    void Calendar::RecreateWxWindowCore()
     {
-        Control::RecreateWxWindowIfNeeded();
+        Control::RecreateWxWindowCore();
     }
 
     wxWindow* Calendar::CreateWxWindowUnparented()
@@ -15,7 +15,7 @@ namespace Alternet::UI
     public:
         wxWindow* CreateWxWindowCore(wxWindow* parent) override;
         wxWindow* CreateWxWindowUnparented() override;
-        virtual void RecreateWxWindowIfNeeded() override;
+        virtual void RecreateWxWindowCore() override;
         static wxCalendarDateAttr* CloneDateAttr(const wxCalendarDateAttr& attr);
 
     private:
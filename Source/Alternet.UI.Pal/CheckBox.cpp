@@ -115,11 +115,11 @@ namespace Alternet::UI
         RecreateWxWindowIfNeeded();
     }
 
-    void CheckBox::RecreateWxWindowIfNeeded()
+    void CheckBox::RecreateWxWindowCore()
     {
 		auto text = GetCheckBox()->GetLabel();
 		auto state = GetCheckState();
-        Control::RecreateWxWindowIfNeeded();
+        Control::RecreateWxWindowCore();
         GetCheckBox()->SetLabel(text);
         SetCheckState(state);
     }
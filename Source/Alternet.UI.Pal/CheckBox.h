@@ -16,7 +16,7 @@ namespace Alternet::UI
         NativeStringSpan GetText() override;
         void SetText(const NativeStringSpan& value) override;
 
-        virtual void RecreateWxWindowIfNeeded() override;
+        virtual void RecreateWxWindowCore() override;
     private:
 
         wxCheckBox* GetCheckBox();
@@ -72,10 +72,10 @@ namespace Alternet::UI
         return ((ComboBox*)_palControl)->OnMeasureItemWidth(item);
     }
 
-    void ComboBox::RecreateWxWindowIfNeeded()
+    void ComboBox::RecreateWxWindowCore()
     {
         auto text = GetComboBox()->GetValue();
-        Control::RecreateWxWindowIfNeeded();
+        Control::RecreateWxWindowCore();
         GetComboBox()->SetValue(text);
     }
 
@@ -386,6 +386,7 @@ namespace Alternet::UI
         
         _isEditable = value;
         RecreateWxWindowIfNeeded();
+        FlushRecreate();
 
         SetSelectedIndex(oldSelectedIndex);
     }
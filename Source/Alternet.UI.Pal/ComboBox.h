@@ -184,7 +184,7 @@ namespace Alternet::UI
     public:
         NativeStringSpan GetText() override;
         void SetText(const NativeStringSpan& value) override;
-        virtual void RecreateWxWindowIfNeeded() override;
+        virtual void RecreateWxWindowCore() override;
 
         wxWindow* CreateWxWindowCore(wxWindow* parent) override;
         wxWindow* CreateWxWindowUnparented() override;
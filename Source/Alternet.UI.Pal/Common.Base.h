@@ -44,6 +44,7 @@
 #include <utility>
 #include <locale>
 #include <tuple>
+#include <typeinfo>
 #include <codecvt>
 
 #include "OptionalInclude.h"
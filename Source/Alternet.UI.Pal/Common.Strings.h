@@ -53,6 +53,23 @@ namespace Alternet::UI
         return joined;
     }
 
+    inline wxArrayString StringToArrayString(const wxString& joined)
+    {
+        wxArrayString items;
+        size_t start = 0;
+        for (size_t i = 0; i < joined.length(); ++i)
+        {
+            if (joined[i] == L'\0')
+            {
+                items.Add(joined.Mid(start, i - start));
+                start = i + 1;
+            }
+        }
+        if (start < joined.length())
+            items.Add(joined.Mid(start));
+        return items;
+    }
+
     inline const NativeStringSpan_C wxStr(const wxString& s)
     {
         int length = static_cast<int>(s.length());
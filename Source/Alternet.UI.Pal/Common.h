@@ -6,6 +6,7 @@
 
 #include "Api/DrawingTypes.h"
 #include "DelayedValue.h"
+#include "PerformanceCounters.h"
 
 
 namespace Alternet::UI
@@ -3,6 +3,7 @@
 #include "Application.h"
 #include "Screenshot.h"
 #include "Window.h"
+#include "WxWindowPool.h"
 
 namespace Alternet::UI
 {
@@ -33,7 +34,18 @@ namespace Alternet::UI
                 parentingWxWindow = ParkingWindow::GetWindow();
         }
 
-        _wxWindow = CreateWxWindowCore(parentingWxWindow);
+        _wxWindowPoolKey = GetWxWindowPoolKey();
+
+        if (!_wxWindowPoolKey.IsEmpty())
+            _wxWindow = WxWindowPool::Acquire(_wxWindowPoolGroup, _wxWindowPoolKey, parentingWxWindow);
+
+        if (_wxWindow != nullptr)
+            ResetPooledWxWindow(_wxWindow);
+        else
+        {
+            _wxWindow = CreateWxWindowCore(parentingWxWindow);
+            PerformanceCounters::Increment(PerformanceCounter::WindowsCreated);
+        }
 
         _wxWindow->SetAutoLayout(false);
 
@@ -115,6 +127,7 @@ namespace Alternet::UI
     {
         _destroyed = true;
         _destroying = true;
+        CancelPendingRecreation();
         DestroyDropTarget(false);
         DestroyWxWindow();
 
@@ -164,6 +177,8 @@ namespace Alternet::UI
     }
 
     /*static*/ Control::ControlsByWxWindowsMap Control::s_controlsByWxWindowsMap;
+    /*static*/ std::vector<Control*> Control::s_pendingRecreations;
+    /*static*/ std::map<wxString, int> Control::s_recreationCounts;
 
     wxString Control::GetMouseEventDesc(const wxMouseEvent& ev)
     {
@@ -467,9 +482,22 @@ namespace Alternet::UI
             return;
         }
 
+        // Destroyed with its parent, the queued recreation would create it
+        // again on idle.
         if (!IsRecreatingWxWindow())
+        {
+            CancelPendingRecreation();
             _wxWindow = nullptr;
+        }
 
+        DetachWxWindow(wxWindow);
+
+        if (IsRecreatingWxWindow())
+            SetRecreatingWxWindow(false);
+    }
+
+    void Control::DetachWxWindow(wxWindow* wxWindow)
+    {
         wxWindow->Unbind(wxEVT_DPI_CHANGED, &Control::OnDpiChanged, this);
         wxWindow->Unbind(wxEVT_TEXT, &Control::OnTextChanged, this);
 
@@ -508,9 +536,6 @@ namespace Alternet::UI
         OnWxWindowDestroyed(wxWindow);
         RaiseEvent(ControlEvent::HandleDestroyed);
         RaiseEvent(ControlEvent::Destroyed);
-
-        if (IsRecreatingWxWindow())
-            SetRecreatingWxWindow(false);
     }
     
     void Control::OnSysColorChanged(wxSysColourChangedEvent& event)
@@ -693,6 +718,10 @@ namespace Alternet::UI
 
     DrawingContext* Control::OpenDrawingContextForDC(void* dc, bool deleteDc)
     {
+        // Headless drawing contexts report a null wxDC.
+        if (dc == nullptr)
+            throwExInvalidOpWithInfo("Control::OpenDrawingContextForDC");
+
         auto result = new DrawingContext((wxDC*)dc);
         if (!deleteDc)
             result->SetDoNotDeleteDC(true);
@@ -710,14 +739,91 @@ namespace Alternet::UI
 
     void Control::DestroyWxWindow()
     {
+        if (!IsRecreatingWxWindow())
+            CancelPendingRecreation();
+
         if (_wxWindow != nullptr)
         {
             OnBeforeDestroyWxWindow();
-            _wxWindow->Destroy();
+            if (!TryParkWxWindow())
+                _wxWindow->Destroy();
             _wxWindow = nullptr;
         }
     }
 
+    bool Control::CanPoolWxWindow()
+    {
+        return false;
+    }
+
+    wxString Control::GetWxWindowPoolKey()
+    {
+        if (_wxWindowPoolGroup.IsEmpty() || !CanPoolWxWindow())
+            return wxEmptyString;
+
+        // Native window can be reused only if it was created with the same
+        // creation-time parameters.
+        return wxString::Format("%s|%s|%ld|%d|%d",
+            _wxWindowPoolGroup,
+            typeid(*this).name(),
+            GetDefaultStyle(),
+            (int)GetTabStop(),
+            (int)GetUserPaint());
+    }
+
+    bool Control::TryParkWxWindow()
+    {
+        if (_wxWindowPoolKey.IsEmpty() || IsRecreatingWxWindow())
+            return false;
+
+        auto window = _wxWindow;
+
+        if (!window->GetChildren().IsEmpty())
+            return false;
+
+        if (WxWindowPool::GetCapacity(_wxWindowPoolGroup) <= 0)
+            return false;
+
+        DetachWxWindow(window);
+
+        if (WxWindowPool::Park(_wxWindowPoolGroup, _wxWindowPoolKey, window))
+            return true;
+
+        window->Destroy();
+        return true;
+    }
+
+    void Control::ResetPooledWxWindow(wxWindow* window)
+    {
+        window->SetFont(wxNullFont);
+        window->SetBackgroundColour(wxNullColour);
+        window->SetForegroundColour(wxNullColour);
+        window->SetCursor(wxNullCursor);
+        window->UnsetToolTip();
+        window->Enable();
+    }
+
+    void Control::SetWindowPoolGroup(const NativeStringSpan& value)
+    {
+        _wxWindowPoolGroup = wxStr(value);
+    }
+
+    /*static*/ void Control::SetWindowPoolCapacity(const NativeStringSpan& group, int capacity)
+    {
+        WxWindowPool::SetCapacity(wxStr(group), capacity);
+    }
+
+    /*static*/ NativeStringSpan Control::GetWindowPoolStats()
+    {
+        _containerStatic = WxWindowPool::GetStats();
+        return wxStr(_containerStatic);
+    }
+
+    /*static*/ void Control::ClearWindowPool()
+    {
+        WxWindowPool::Clear();
+    }
+
     Control* Control::GetParent()
     {
         return _parent;
@@ -750,6 +856,7 @@ namespace Alternet::UI
         if (_flags.IsSet(ControlFlags::PostInitWxWindowRecreationPending))
         {
             RecreateWxWindowIfNeeded();
+            FlushRecreate();
             _flags.Set(ControlFlags::PostInitWxWindowRecreationPending, false);
         }
 
@@ -1004,6 +1111,7 @@ namespace Alternet::UI
     void Control::RecreateWindow() 
     {
         RecreateWxWindowIfNeeded();
+        FlushRecreate();
     }
 
     void Control::BeginIgnoreRecreate() 
@@ -1019,6 +1127,21 @@ namespace Alternet::UI
     }
 
     void Control::RecreateWxWindowIfNeeded()
+    {
+        if (_ignoreRecreate>0 || !IsWxWindowCreated())
+            return;
+
+        _flags.Set(ControlFlags::WxWindowRecreationPending, true);
+
+        if (std::find(s_pendingRecreations.begin(), s_pendingRecreations.end(), this)
+            != s_pendingRecreations.end())
+            return;
+
+        s_pendingRecreations.push_back(this);
+        wxWakeUpIdle();
+    }
+
+    void Control::RecreateWxWindowCore()
     {
         if (_ignoreRecreate>0 || !IsWxWindowCreated())
             return;
@@ -1026,11 +1149,91 @@ namespace Alternet::UI
         if (_disableRecreateCounter > 0)
             Application::Log("Native window recreated");
 
+        s_recreationCounts[_wxWindow->GetClassInfo()->GetClassName()]++;
+        PerformanceCounters::Increment(PerformanceCounter::WindowsRecreated);
+
         SetRecreatingWxWindow(true);
         DestroyWxWindow();
         CreateWxWindow();
     }
 
+    bool Control::IsRecreationPending()
+    {
+        return _flags.IsSet(ControlFlags::WxWindowRecreationPending);
+    }
+
+    void Control::CancelPendingRecreation()
+    {
+        if (!IsRecreationPending())
+            return;
+
+        _flags.Set(ControlFlags::WxWindowRecreationPending, false);
+
+        auto it = std::find(s_pendingRecreations.begin(), s_pendingRecreations.end(), this);
+        if (it != s_pendingRecreations.end())
+            s_pendingRecreations.erase(it);
+    }
+
+    void Control::FlushRecreate()
+    {
+        if (!IsRecreationPending())
+            return;
+
+        // Overrides read the old window before recreating it, which would
+        // create a destroyed window again.
+        if (!IsWxWindowCreated())
+        {
+            CancelPendingRecreation();
+            return;
+        }
+
+        // Kept pending with its actions, EndIgnoreRecreate queues it again.
+        if (_ignoreRecreate > 0)
+        {
+            auto it = std::find(s_pendingRecreations.begin(), s_pendingRecreations.end(), this);
+            if (it != s_pendingRecreations.end())
+                s_pendingRecreations.erase(it);
+            return;
+        }
+
+        CancelPendingRecreation();
+        RecreateWxWindowCore();
+
+        auto actions = std::move(_postRecreateActions);
+        _postRecreateActions.clear();
+
+        for (auto& action : actions)
+            action();
+    }
+
+    /*static*/ void Control::FlushPendingRecreations()
+    {
+        auto pending = s_pendingRecreations;
+
+        for (auto control : pending)
+        {
+            // Control could be deleted while flushing the previous one.
+            auto it = std::find(s_pendingRecreations.begin(), s_pendingRecreations.end(), control);
+            if (it != s_pendingRecreations.end())
+                control->FlushRecreate();
+        }
+    }
+
+    /*static*/ NativeStringSpan Control::GetRecreationStats()
+    {
+        _containerStatic.Clear();
+
+        for (auto& item : s_recreationCounts)
+            _containerStatic += wxString::Format("%s=%d\n", item.first, item.second);
+
+        return wxStr(_containerStatic);
+    }
+
+    /*static*/ void Control::ResetRecreationStats()
+    {
+        s_recreationCounts.clear();
+    }
+
     void Control::OnWxWindowCreated()
     {
     }
@@ -1145,7 +1348,11 @@ namespace Alternet::UI
         if (!_flags.IsSet(ControlFlags::InitInProgress))
         {
             RecreateWxWindowIfNeeded();
-            postRecreateAction();
+
+            if (IsRecreationPending())
+                _postRecreateActions.push_back(postRecreateAction);
+            else
+                postRecreateAction();
             return;
         }
 
@@ -1461,11 +1668,15 @@ namespace Alternet::UI
         if(size.x <= 0 ||size.y <=0 )
 			return;
 
+        PerformanceCounters::Increment(PerformanceCounter::Paints);
+        PerformanceCounters::TraceScope traceScope("Paint", "paint");
+
         wxPaintDC dc(window);
 
         auto gc = wxGraphicsContext::Create(dc);
         if (gc)
         {
+            PerformanceCounters::Increment(PerformanceCounter::GraphicsObjectsCreated);
             DrawingContext ctx(gc, &dc);
             ctx.SetDoNotDeleteDC(true);
             _drawingContext = &ctx;
@@ -1705,6 +1916,7 @@ namespace Alternet::UI
 
     Size Control::GetPreferredSize(const Size& availableSize)
     {
+        FlushRecreate();
         auto wxWindow = GetWxWindow();
         return toDip(wxWindow->GetBestSize(), wxWindow);
     }
@@ -2220,6 +2432,7 @@ namespace Alternet::UI
     public:
         wxWindow* CreateWxWindowCore(wxWindow* parent) override;
         wxWindow* CreateWxWindowUnparented() override;
+        bool CanPoolWxWindow() override;
 
         ControlNonAbstract()
         {
@@ -2235,6 +2448,11 @@ namespace Alternet::UI
         return new ControlNonAbstract();
     }
 
+    bool ControlNonAbstract::CanPoolWxWindow()
+    {
+        return true;
+    }
+
     wxWindow* ControlNonAbstract::CreateWxWindowUnparented()
     {
         return new wxWindow2();
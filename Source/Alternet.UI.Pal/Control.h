@@ -186,6 +186,7 @@ namespace Alternet::UI
             IsScrollable = 1 << 7,
             TabStop = 1 << 8,
             Active = 1 << 9,
+            WxWindowRecreationPending = 1 << 10,
         };
 
         wxString _name;
@@ -246,7 +247,8 @@ namespace Alternet::UI
 
         virtual void CreateWxWindow();
 
-        virtual void RecreateWxWindowIfNeeded();
+        void RecreateWxWindowIfNeeded();
+        virtual void RecreateWxWindowCore();
         void ScheduleRecreateWxWindow(std::function<void()> postRecreateAction);
         void ScheduleRecreateWxWindow();
 
@@ -277,6 +279,8 @@ namespace Alternet::UI
         virtual void OnEndInit();
 
         virtual void DestroyWxWindow();
+
+        virtual bool CanPoolWxWindow();
     private:
         RectD _eventBounds;
         bool _destroying = false;
@@ -297,6 +301,21 @@ namespace Alternet::UI
         int _recreatingWxWindowCounter = 0;
 
         std::vector<std::function<void()>> _postInitActions;
+        std::vector<std::function<void()>> _postRecreateActions;
+
+        bool IsRecreationPending();
+        void CancelPendingRecreation();
+
+        wxString _wxWindowPoolGroup;
+        wxString _wxWindowPoolKey;
+
+        wxString GetWxWindowPoolKey();
+        bool TryParkWxWindow();
+        void ResetPooledWxWindow(wxWindow* window);
+        void DetachWxWindow(wxWindow* wxWindow);
+
+        static std::vector<Control*> s_pendingRecreations;
+        static std::map<wxString, int> s_recreationCounts;
 
         wxWindow* _wxWindow = nullptr;
         Control* _parent = nullptr;
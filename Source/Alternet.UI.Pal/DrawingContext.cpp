@@ -1,6 +1,7 @@
 ﻿#include "DrawingContext.h"
 #include "SolidBrush.h"
 #include "GenericImage.h"
+#include "BitmapPool.h"
 #include <algorithm>
 
 namespace Alternet::UI
@@ -15,6 +16,8 @@ namespace Alternet::UI
 	{
 		assert(_dc);
 
+		PerformanceCounters::Increment(PerformanceCounter::GraphicsObjectsCreated);
+
 #ifdef  __WXMSW__
 
 		useDirectDraw = false;
@@ -37,39 +40,117 @@ namespace Alternet::UI
 	{
 		wxDELETE(_graphicsContext);
 
-		if (!_doNotDeleteDC)
+		if (_pooledDC)
+		{
+			// Deselected first, the bitmap goes back only when unreferenced.
+			BitmapPool::GetInstance().ReleaseDC((wxMemoryDC*)_dc);
+			if (_pooledBitmap.IsOk())
+				BitmapPool::GetInstance().ReleaseBitmap(_pooledBitmap);
+			_dc = nullptr;
+		}
+		else if (!_doNotDeleteDC)
 			wxDELETE(_dc);
 	}
 
 	SizeI DrawingContext::GetSize()
 	{
+		if (IsHeadless())
+		{
+			wxDouble width, height;
+			_graphicsContext->GetSize(&width, &height);
+			return SizeI(wxRound(width), wxRound(height));
+		}
+
 		return _dc->GetSize();
 	}
 
 	SizeI DrawingContext::GetPPI()
 	{
+		if (IsHeadless())
+		{
+			wxDouble dpiX, dpiY;
+			_graphicsContext->GetDPI(&dpiX, &dpiY);
+			return SizeI(wxRound(dpiX), wxRound(dpiY));
+		}
+
 		return _dc->GetPPI();
 	}
 
 	DrawingContext* DrawingContext::CreateMemoryDC(float scaleFactor)
 	{
-		auto bitmap = wxBitmap(10, 10);
-		bitmap.SetScaleFactor(scaleFactor);
-		auto memoryDC = new wxMemoryDC(bitmap);
-		auto ppi = memoryDC->GetPPI();
-		return new DrawingContext(memoryDC);
+		// Used for measuring, the DC and its small bitmap come from the pool.
+		auto& pool = BitmapPool::GetInstance();
+		auto memoryDC = pool.AcquireDC();
+		auto bitmap = pool.AcquireBitmap(10, 10, -1, scaleFactor);
+		memoryDC->SelectObject(bitmap);
+
+		auto result = new DrawingContext(memoryDC);
+		result->_pooledDC = true;
+		result->_pooledBitmap = bitmap;
+		return result;
 	}
 
 	DrawingContext* DrawingContext::CreateMemoryDCFromImage(Image* image)
 	{
-		wxBitmap bitmap = image->GetBitmap();
-		auto memoryDC = new wxMemoryDC(bitmap);
-		return new DrawingContext(memoryDC);
+		auto memoryDC = BitmapPool::GetInstance().AcquireDC();
+
+		// Selecting unshares the bitmap, the image gets the selected one
+		// like in FromImage.
+		auto bitmap = image->_bitmap;
+		image->_bitmap = wxNullBitmap;
+		memoryDC->SelectObject(bitmap);
+		image->_bitmap = bitmap;
+
+		auto result = new DrawingContext(memoryDC);
+		result->_pooledDC = true;
+		return result;
 	}
 
 	SizeI DrawingContext::GetDpi()
 	{
-		return _dc->GetPPI();
+		return GetPPI();
+	}
+
+	/*static*/ wxGraphicsRenderer* DrawingContext::GetHeadlessRenderer()
+	{
+#if wxUSE_CAIRO
+		auto renderer = wxGraphicsRenderer::GetCairoRenderer();
+		if (renderer != nullptr)
+			return renderer;
+#endif
+		return wxGraphicsRenderer::GetDefaultRenderer();
+	}
+
+	/*static*/ DrawingContext* DrawingContext::CreateHeadless(GenericImage* target)
+	{
+		if (!target->_image.IsOk())
+			throwExInvalidOpWithInfo("Headless drawing context requires a valid target image.");
+
+		// Image contexts render into their own surface and copy it back to the
+		// target image on Flush() and on destruction, so neither a display connection
+		// nor a wxDC is needed. The target must outlive the context.
+		auto graphicsContext = GetHeadlessRenderer()->CreateContextFromImage(target->_image);
+		if (graphicsContext == nullptr)
+			throwExInvalidOpWithInfo("Could not create headless graphics context.");
+
+		PerformanceCounters::Increment(PerformanceCounter::GraphicsObjectsCreated);
+
+		return new DrawingContext(graphicsContext, (wxDC*)nullptr);
+	}
+
+	void DrawingContext::Flush()
+	{
+		_graphicsContext->Flush();
+	}
+
+	bool DrawingContext::IsHeadless()
+	{
+		return _dc == nullptr;
+	}
+
+	wxWindow* DrawingContext::GetDCWindow()
+	{
+		return IsHeadless() ? nullptr : _dc->GetWindow();
 	}
 
 	void* DrawingContext::GetWxWidgetDC()
@@ -77,26 +158,45 @@ namespace Alternet::UI
 		return _dc;
 	}
 
+	Coord DrawingContext::GetScaleFactor()
+	{
+		if (IsHeadless())
+			return 1;
+		return GetDPIScaleFactor(GetDCWindow());
+	}
+
 	void DrawingContext::ImageFromDrawingContext(Image* image,
 		int width, int height, DrawingContext* dc)
 	{
 		auto wxdc = dc->GetDC();
-		image->_bitmap = wxBitmap(width, height, *wxdc);
+		if (wxdc == nullptr)
+			image->_bitmap = wxBitmap(width, height);
+		else
+			image->_bitmap = wxBitmap(width, height, *wxdc);
 	}
 
 	void DrawingContext::ImageFromGenericImageDC(Image* image, void* source, DrawingContext* dc)
 	{
+		PerformanceCounters::Increment(PerformanceCounter::ImageConversions);
+
 		auto wxdc = dc->GetDC();
-		image->_bitmap = wxBitmap(((GenericImage*)source)->_image, *wxdc);
+		if (wxdc == nullptr)
+			image->_bitmap = wxBitmap(((GenericImage*)source)->_image);
+		else
+			image->_bitmap = wxBitmap(((GenericImage*)source)->_image, *wxdc);
 	}
 
 	bool DrawingContext::GetIsOk()
 	{
+		if (IsHeadless())
+			return _graphicsContext != nullptr;
 		return _dc->IsOk();
 	}
 
 	void* DrawingContext::GetHandle()
 	{
+		if (IsHeadless())
+			return _graphicsContext->GetNativeContext();
 		return _dc->GetHandle();
 	}
 
@@ -136,12 +236,19 @@ namespace Alternet::UI
 
 	void DrawingContext::SetClippingRect(const Rect& rect)
 	{
-		auto bounds = fromDip(rect, _dc->GetWindow());
+		auto bounds = fromDipSf(rect, GetScaleFactor());
 		_graphicsContext->Clip(bounds.x, bounds.y, bounds.width, bounds.height);
 	}
 
 	Rect DrawingContext::GetClippingBox()
 	{
+		if (IsHeadless())
+		{
+			wxDouble x, y, width, height;
+			_graphicsContext->GetClipBox(&x, &y, &width, &height);
+			return Rect(x, y, width, height);
+		}
+
 		wxRect rect;
 		auto result = _dc->GetClippingBox(rect);
 		if (result)
@@ -172,7 +279,7 @@ namespace Alternet::UI
 	{
 		_graphicsContext->SetPen(pen->GetWxPen());
 		_graphicsContext->SetBrush(GetGraphicsBrush(brush, wxPoint2DDouble(rect.X, rect.Y)));
-		auto r = fromDipF(rect, _dc->GetWindow());
+		auto r = fromDipFSf(rect, GetScaleFactor());
 		_graphicsContext->DrawRoundedRectangle(r.X, r.Y, r.Width, r.Height, cornerRadius);
 	}
 
@@ -180,7 +287,7 @@ namespace Alternet::UI
 	{
 		_graphicsContext->SetPen(pen->GetWxPen());
 		_graphicsContext->SetBrush(*wxTRANSPARENT_BRUSH);
-		auto r = fromDipF(rect, _dc->GetWindow());
+		auto r = fromDipFSf(rect, GetScaleFactor());
 		_graphicsContext->DrawRoundedRectangle(r.X, r.Y, r.Width, r.Height, cornerRadius);
 	}
 
@@ -198,7 +305,7 @@ namespace Alternet::UI
 	{
 		_graphicsContext->SetPen(*wxTRANSPARENT_PEN);
 		_graphicsContext->SetBrush(GetGraphicsBrush(brush, wxPoint2DDouble(rect.X, rect.Y)));
-		auto r = fromDipF(rect, _dc->GetWindow());
+		auto r = fromDipFSf(rect, GetScaleFactor());
 		_graphicsContext->DrawRoundedRectangle(r.X, r.Y, r.Width, r.Height, cornerRadius);
 	}
 
@@ -206,7 +313,7 @@ namespace Alternet::UI
 	{
 		auto bitmap = image->GetBitmap();
 		auto dc = new wxMemoryDC(bitmap);
-		image->SetBitmap(bitmap); // wxMemoryDC unshared bitmap, so need to reassign it back.
+		image->_bitmap = bitmap; // wxMemoryDC unshared bitmap, so need to reassign it back.
 		return new DrawingContext(dc);
 	}
 
@@ -218,9 +325,8 @@ namespace Alternet::UI
 	void DrawingContext::DrawImageAtPoint(Image* image, const Point& origin, bool useMask)
 	{
 		wxBitmap bitmap = image->GetBitmap();
-		auto window = _dc->GetWindow();
 
-		auto pt = fromDip(origin, _dc->GetWindow());
+		auto pt = fromDipSf(origin, GetScaleFactor());
 
 		auto wxr = wxRect(pt, image->GetPixelSize());
 		_graphicsContext->DrawBitmap(bitmap, wxr.x, wxr.y, wxr.width, wxr.height);
@@ -229,6 +335,13 @@ namespace Alternet::UI
 	void DrawingContext::DrawBitmapAtPointI(Image* image, int x, int y, bool useMask)
 	{
 		wxBitmap bitmap = image->GetBitmap();
+
+		if (IsHeadless())
+		{
+			_graphicsContext->DrawBitmap(bitmap, x, y, bitmap.GetWidth(), bitmap.GetHeight());
+			return;
+		}
+
 		_dc->DrawBitmap(bitmap, x, y, useMask);
 	}
 
@@ -236,9 +349,15 @@ namespace Alternet::UI
 	{
 		wxBitmap bitmap = image->GetBitmap();
 
-		// Create a memory DC to hold the source bitmap
-		wxMemoryDC memDC;
-		memDC.SelectObject(bitmap);
+		if (IsHeadless())
+		{
+			_graphicsContext->DrawBitmap(bitmap, rect.X, rect.Y, rect.Width, rect.Height);
+			return;
+		}
+
+		// Pooled memory DC holding the source bitmap, selected as a source
+		// so the bitmap isn't unshared.
+		BitmapPool::DCScope memDC(bitmap);
 
 		int destX = rect.X;
 		int destY = rect.Y;
@@ -251,19 +370,17 @@ namespace Alternet::UI
 		// StretchBlit will scale the source bitmap into the destination rectangle
 		_dc->StretchBlit(
 			destX, destY, destW, destH,   // destination rectangle
-			&memDC,
+			&memDC.GetDC(),
 			0, 0, srcW, srcH,             // source rectangle
 			useMask ? wxCOPY : wxCOPY,    // raster operation (mask handling can be extended)
 			useMask ? true : false        // use mask if requested
 		);
-
-		memDC.SelectObject(wxNullBitmap); // release
 	}
 
 	void DrawingContext::DrawImageAtRect(Image* image, const Rect& destinationRect, bool useMask)
 	{
 		wxBitmap bitmap = image->GetBitmap();
-		auto destRect = fromDip(destinationRect, _dc->GetWindow());
+		auto destRect = fromDipSf(destinationRect, GetScaleFactor());
 
 		auto oldInterpolationQuality = _graphicsContext->GetInterpolationQuality();
 		_graphicsContext->SetInterpolationQuality(GetInterpolationQuality(_interpolationMode));
@@ -311,7 +428,7 @@ namespace Alternet::UI
 
 	void DrawingContext::Rectangle(Pen* pen, Brush* brush, const Rect& rectangle)
 	{
-		auto rect = fromDipF(rectangle, _dc->GetWindow());
+		auto rect = fromDipFSf(rectangle, GetScaleFactor());
 
 		_graphicsContext->SetPen(pen->GetWxPen());
 		_graphicsContext->SetBrush(GetGraphicsBrush(brush, wxPoint2DDouble(rect.X, rect.Y)));
@@ -321,13 +438,13 @@ namespace Alternet::UI
 
 	void DrawingContext::FillRectangle(Brush* brush, const Rect& rectangle)
 	{
-		auto r = fromDip(
+		auto r = fromDipSf(
 			Rect(
 				rectangle.X,
 				rectangle.Y,
 				rectangle.Width,
 				rectangle.Height),
-			_dc->GetWindow());
+			GetScaleFactor());
 		FillRectangleI(brush, r);
 	}
 
@@ -340,15 +457,24 @@ namespace Alternet::UI
 
 	void DrawingContext::DrawPoint(Pen* pen, float x, float y)
 	{
+		if (IsHeadless())
+		{
+			auto point = fromDipSf(Point(x, y), GetScaleFactor());
+			_graphicsContext->SetPen(*wxTRANSPARENT_PEN);
+			_graphicsContext->SetBrush(wxBrush(pen->GetWxPen().GetColour()));
+			_graphicsContext->DrawRectangle(point.x, point.y, 1, 1);
+			return;
+		}
+
 		auto& oldPen = _dc->GetPen();
 		_dc->SetPen(pen->GetWxPen());
-		_dc->DrawPoint(fromDip(Point(x, y), _dc->GetWindow()));
+		_dc->DrawPoint(fromDipSf(Point(x, y), GetScaleFactor()));
 		_dc->SetPen(oldPen);
 	}
 
 	void DrawingContext::FillEllipse(Brush* brush, const Rect& bounds)
 	{
-		auto rect = fromDipF(bounds, _dc->GetWindow());
+		auto rect = fromDipFSf(bounds, GetScaleFactor());
 
 		_graphicsContext->SetPen(*wxTRANSPARENT_PEN);
 		_graphicsContext->SetBrush(GetGraphicsBrush(brush, wxPoint2DDouble(rect.X, rect.Y)));
@@ -358,7 +484,7 @@ namespace Alternet::UI
 
 	void DrawingContext::Ellipse(Pen* pen, Brush* brush, const Rect& bounds)
 	{
-		auto rect = fromDipF(bounds, _dc->GetWindow());
+		auto rect = fromDipFSf(bounds, GetScaleFactor());
 
 		_graphicsContext->SetPen(pen->GetWxPen());
 		_graphicsContext->SetBrush(GetGraphicsBrush(brush, wxPoint2DDouble(rect.X, rect.Y)));
@@ -371,7 +497,7 @@ namespace Alternet::UI
 		_graphicsContext->SetPen(pen->GetWxPen());
 		_graphicsContext->SetBrush(*wxTRANSPARENT_BRUSH);
 
-		auto rect = fromDip(rectangle, _dc->GetWindow());
+		auto rect = fromDipSf(rectangle, GetScaleFactor());
 
 		_graphicsContext->DrawRectangle(rect.x, rect.y, rect.width, rect.height);
 	}
@@ -380,9 +506,9 @@ namespace Alternet::UI
 	{
 		_graphicsContext->SetPen(pen->GetWxPen());
 
-		auto window = _dc->GetWindow();
-		auto p1 = fromDip(a, window);
-		auto p2 = fromDip(b, window);
+		auto scaleFactor = GetScaleFactor();
+		auto p1 = fromDipSf(a, scaleFactor);
+		auto p2 = fromDipSf(b, scaleFactor);
 		_graphicsContext->StrokeLine(p1.x, p1.y, p2.x, p2.y);
 
 		_graphicsContext->Flush();
@@ -393,22 +519,20 @@ namespace Alternet::UI
 		_graphicsContext->SetPen(pen->GetWxPen());
 		_graphicsContext->SetBrush(*wxTRANSPARENT_BRUSH);
 
-		auto rect = fromDip(
+		auto rect = fromDipSf(
 			Rect(
 				bounds.X,
 				bounds.Y,
 				bounds.Width,
 				bounds.Height),
-			_dc->GetWindow());
+			GetScaleFactor());
 		_graphicsContext->DrawEllipse(rect.x, rect.y, rect.width, rect.height);
 	}
 
 	void DrawingContext::DrawText(const NativeStringSpan& text, const PointD& location,
 		Font* font, const Color& foreColor, Brush* backColor, float angle, bool useBrush)
 	{
-		auto window = DrawingContext::GetWindow(_dc);
-
-		auto point = fromDip(location, window);
+		auto point = fromDipSf(location, GetScaleFactor());
 
 		auto x = static_cast<float>(point.x);
 		auto y = static_cast<float>(point.y);
@@ -442,13 +566,76 @@ namespace Alternet::UI
 		}
 	}
 
+	void DrawingContext::FillRectangles(Brush* brush, float* rects, int rectsCount)
+	{
+		auto scaleFactor = GetScaleFactor();
+		bool solid = dynamic_cast<SolidBrush*>(brush) != nullptr;
+
+		_graphicsContext->SetPen(*wxTRANSPARENT_PEN);
+
+		if (solid)
+			_graphicsContext->SetBrush(GetGraphicsBrush(brush, wxPoint2DDouble(0, 0)));
+
+		for (int i = 0; i + 3 < rectsCount; i += 4)
+		{
+			auto x = rects[i] * scaleFactor;
+			auto y = rects[i + 1] * scaleFactor;
+
+			// Gradient and texture brushes are positioned relative to each rectangle.
+			if (!solid)
+				_graphicsContext->SetBrush(GetGraphicsBrush(brush, wxPoint2DDouble(x, y)));
+
+			_graphicsContext->DrawRectangle(x, y,
+				rects[i + 2] * scaleFactor, rects[i + 3] * scaleFactor);
+		}
+	}
+
+	void DrawingContext::DrawLineSegments(Pen* pen, float* points, int pointsCount)
+	{
+		auto scaleFactor = GetScaleFactor();
+		auto count = pointsCount / 4;
+		if (count == 0)
+			return;
+
+		std::vector<wxPoint2DDouble> beginPoints(count);
+		std::vector<wxPoint2DDouble> endPoints(count);
+
+		for (int i = 0; i < count; i++)
+		{
+			auto p = points + i * 4;
+			beginPoints[i] = wxPoint2DDouble(p[0] * scaleFactor, p[1] * scaleFactor);
+			endPoints[i] = wxPoint2DDouble(p[2] * scaleFactor, p[3] * scaleFactor);
+		}
+
+		_graphicsContext->SetPen(pen->GetWxPen());
+		_graphicsContext->StrokeLines(count, beginPoints.data(), endPoints.data());
+	}
+
+	void DrawingContext::DrawLines(Pen* pen, float* points, int pointsCount)
+	{
+		auto scaleFactor = GetScaleFactor();
+		auto count = pointsCount / 2;
+		if (count < 2)
+			return;
+
+		std::vector<wxPoint2DDouble> polyline(count);
+
+		for (int i = 0; i < count; i++)
+			polyline[i] = wxPoint2DDouble(points[i * 2] * scaleFactor, points[i * 2 + 1] * scaleFactor);
+
+		_graphicsContext->SetPen(pen->GetWxPen());
+		_graphicsContext->StrokeLines(count, polyline.data());
+	}
+
 	wxGraphicsBrush DrawingContext::GetGraphicsBrush(Brush* brush, const wxPoint2DDouble& offset)
 	{
+		PerformanceCounters::Increment(PerformanceCounter::GraphicsObjectsCreated);
 		return brush->GetGraphicsBrush(_graphicsContext->GetRenderer(), offset);
 	}
 
 	wxGraphicsPen DrawingContext::GetGraphicsPen(Pen* pen)
 	{
+		PerformanceCounters::Increment(PerformanceCounter::GraphicsObjectsCreated);
 		return pen->GetGraphicsPen(_graphicsContext->GetRenderer());
 	}
 
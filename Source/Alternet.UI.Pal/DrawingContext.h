@@ -3,6 +3,7 @@
 #include "ApiTypes.h"
 #include "Object.h"
 #include "Image.h"
+#include "GenericImage.h"
 #include "Font.h"
 #include "Brush.h"
 #include "Pen.h"
@@ -28,7 +29,19 @@ namespace Alternet::UI
 
         static wxWindow* GetWindow(wxDC* dc);
 
+        // Headless contexts draw into a GenericImage through a graphics context
+        // only and have no wxDC and no window.
+        bool IsHeadless();
+
     private:
+        static wxGraphicsRenderer* GetHeadlessRenderer();
+
+        wxWindow* GetDCWindow();
+
+        // 1 for headless contexts, they draw in image pixels and must not
+        // create the parking window to get a display scale.
+        Coord GetScaleFactor();
+
         static wxInterpolationQuality GetInterpolationQuality(InterpolationMode mode);
 
         wxAffineMatrix2D _currentTransform;
@@ -42,5 +55,8 @@ namespace Alternet::UI
         wxGraphicsPen GetGraphicsPen(Pen* pen);
 
         bool _doNotDeleteDC = false;
+        // The DC goes back to BitmapPool with the bitmap made for it.
+        bool _pooledDC = false;
+        wxBitmap _pooledBitmap;
     };
 }
@@ -3,49 +3,18 @@
 #include "Api/OutputStream.h"
 #include "ManagedInputStream.h"
 #include "ManagedOutputStream.h"
+#include "ImageDecodeQueue.h"
+#include "ImageEncoder.h"
+#include "ImageThumbnail.h"
+#include "LazyImageHandler.h"
+#include "MappedImage.h"
 
 namespace Alternet::UI
 {
-	void wxImageAddHandlerV2(wxImageHandler* handler)
-	{
-		if (wxImage::FindHandler(handler->GetType()) == 0)
-			wxImage::AddHandler(handler);
-	}
-
 	void GenericImage::wxInitAllImageHandlersV2()
 	{
-#if wxUSE_LIBPNG
-		wxImageAddHandlerV2(new wxPNGHandler);
-#endif
-#if wxUSE_LIBJPEG
-		wxImageAddHandlerV2(new wxJPEGHandler);
-#endif
-#if wxUSE_LIBTIFF
-		wxImageAddHandlerV2(new wxTIFFHandler);
-#endif
-#if wxUSE_GIF
-		wxImageAddHandlerV2(new wxGIFHandler);
-#endif
-#if wxUSE_PNM
-		wxImageAddHandlerV2(new wxPNMHandler);
-#endif
-#if wxUSE_PCX
-		wxImageAddHandlerV2(new wxPCXHandler);
-#endif
-#if wxUSE_IFF
-		wxImageAddHandlerV2(new wxIFFHandler);
-#endif
-#if wxUSE_ICO_CUR
-		wxImageAddHandlerV2(new wxICOHandler);
-		wxImageAddHandlerV2(new wxCURHandler);
-		wxImageAddHandlerV2(new wxANIHandler);
-#endif
-#if wxUSE_TGA
-		wxImageAddHandlerV2(new wxTGAHandler);
-#endif
-#if wxUSE_XPM
-		wxImageAddHandlerV2(new wxXPMHandler);
-#endif
+		// Handlers are created on first use, see LazyImageHandler.
+		LazyImageHandler::Register();
 	}
 
 	/*static*/ void GenericImage::EnsureImageHandlersInitialized()
@@ -647,4 +616,102 @@ namespace Alternet::UI
 			((GenericImage*)handle)->pixelData = nullptr;
 		}
 	}
+
+	int64_t GenericImage::DecodeFileAsync(const NativeStringSpan& path, int bitmapType, int index)
+	{
+		return ImageDecodeQueue::GetInstance().AddFile(wxStr(path), bitmapType, index);
+	}
+
+	int64_t GenericImage::DecodeMemoryAsync(void* data, int dataCount, int bitmapType, int index)
+	{
+		auto bytes = (const uint8_t*)data;
+		std::vector<uint8_t> buffer(bytes, bytes + dataCount);
+		return ImageDecodeQueue::GetInstance().AddMemory(std::move(buffer), bitmapType, index);
+	}
+
+	bool GenericImage::CancelDecode(int64_t id)
+	{
+		return ImageDecodeQueue::GetInstance().Cancel(id);
+	}
+
+	int GenericImage::PollDecoded(int64_t* results, int resultsCount)
+	{
+		return ImageDecodeQueue::GetInstance().Poll(results, resultsCount);
+	}
+
+	void GenericImage::SetDecodeThreadCount(int value)
+	{
+		ImageDecodeQueue::GetInstance().SetThreadCount(value);
+	}
+
+	int GenericImage::GetDecodeThreadCount()
+	{
+		return ImageDecodeQueue::GetInstance().GetThreadCount();
+	}
+
+	int GenericImage::GetDecodePendingCount()
+	{
+		return ImageDecodeQueue::GetInstance().GetPendingCount();
+	}
+
+	void* GenericImage::CreateThumbnailFromFile(const NativeStringSpan& path, int width, int height)
+	{
+		EnsureImageHandlersInitialized();
+
+		wxImage image;
+		if (!ImageThumbnail::LoadFile(wxStr(path), width, height, image))
+			return nullptr;
+		return new GenericImage(image);
+	}
+
+	void* GenericImage::CreateThumbnailFromMemory(void* data, int dataCount, int width, int height)
+	{
+		EnsureImageHandlersInitialized();
+
+		wxImage image;
+		wxMemoryInputStream stream(data, dataCount);
+		if (!ImageThumbnail::Load(stream, width, height, image))
+			return nullptr;
+		return new GenericImage(image);
+	}
+
+	int64_t GenericImage::DecodeThumbnailAsync(const NativeStringSpan& path, int width, int height)
+	{
+		return ImageDecodeQueue::GetInstance().AddFile(wxStr(path), wxBITMAP_TYPE_ANY, -1,
+			width, height);
+	}
+
+	void GenericImage::SetEnabledImageTypes(int* bitmapTypes, int bitmapTypesCount)
+	{
+		// Removed handlers are deleted, so they are changed while no worker
+		// of the decode queue uses them.
+		auto& queue = ImageDecodeQueue::GetInstance();
+		queue.SuspendWorkers();
+
+		LazyImageHandler::SetEnabledTypes(std::vector<int>(bitmapTypes, bitmapTypes + bitmapTypesCount));
+		LazyImageHandler::Register();
+
+		queue.ResumeWorkers();
+	}
+
+	void* GenericImage::CreateImageFromMappedFile(const NativeStringSpan& path)
+	{
+		// Converted from the mapped pages in one pass, without the copy of
+		// the file in memory made by the stream based handlers.
+		MappedImage image;
+		if (!image.Open(path))
+			return nullptr;
+		return image.ReadImage();
+	}
+
+	bool GenericImage::SaveStreamWithPreset(void* handle, void* stream, int bitmapType, int preset,
+		int quality, int compressionLevel, int filter, int threadCount)
+	{
+		OutputStream outputStream(stream);
+		ManagedOutputStream managedOutputStream(&outputStream);
+
+		return ImageEncoder::Save(((GenericImage*)handle)->_image, managedOutputStream,
+			(wxBitmapType)bitmapType,
+			ImageEncoder::GetOptions(preset, quality, compressionLevel, filter, threadCount));
+	}
 }
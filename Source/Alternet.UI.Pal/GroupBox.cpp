@@ -119,10 +119,10 @@ namespace Alternet::UI
         return wxStr(_textValue);
     }
 
-    void GroupBox::RecreateWxWindowIfNeeded()
+    void GroupBox::RecreateWxWindowCore()
     {
         auto text = GetStaticBox()->GetLabel();
-        Control::RecreateWxWindowIfNeeded();
+        Control::RecreateWxWindowCore();
         GetStaticBox()->SetLabel(text);
     }
 
@@ -8,7 +8,7 @@ namespace Alternet::UI
     {
 #include "Api/GroupBox.inc"
     public:
-        virtual void RecreateWxWindowIfNeeded() override;
+        virtual void RecreateWxWindowCore() override;
         NativeStringSpan GetText() override;
         void SetText(const NativeStringSpan& value) override;
 
@@ -42,4 +42,34 @@ namespace Alternet::UI
 	{
 		_iconBundle = wxIconBundle();
 	}
+
+	void IconSet::AddImageBundle(ImageBundle* bundle)
+	{
+		auto bitmapBundle = ImageBundle::GetBundle(bundle);
+		if (!bitmapBundle.IsOk())
+			return;
+
+		// Window icons are chosen from a fixed set by their size in pixels,
+		// which depends on the DPI of the display the window is on. The
+		// bundle is asked for the standard sizes at the usual scales and at
+		// the scales of the connected displays, so wx finds an icon of the
+		// right size when the window moves to another display.
+		std::vector<double> scales = { 1.0, 1.25, 1.5, 1.75, 2.0 };
+		for (unsigned int i = 0; i < wxDisplay::GetCount(); i++)
+			scales.push_back(wxDisplay(i).GetScaleFactor());
+
+		std::set<int> sizes;
+		for (auto scale : scales)
+		{
+			for (int size : IconSizes)
+				sizes.insert(wxRound(size * scale));
+		}
+
+		for (auto pixels : sizes)
+		{
+			wxIcon icon;
+			icon.CopyFromBitmap(bitmapBundle.GetBitmap(wxSize(pixels, pixels)));
+			_iconBundle.AddIcon(icon);
+		}
+	}
 }
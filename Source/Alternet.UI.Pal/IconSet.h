@@ -3,6 +3,7 @@
 #include "ApiTypes.h"
 #include "Object.h"
 #include "Image.h"
+#include "ImageBundle.h"
 
 namespace Alternet::UI
 {
@@ -18,6 +19,8 @@ namespace Alternet::UI
             return iconBundle->_iconBundle;
         }
     private:
+        static constexpr int IconSizes[] = { 16, 24, 32, 48, 64, 128, 256 };
+
         wxIconBundle _iconBundle;
     };
 }
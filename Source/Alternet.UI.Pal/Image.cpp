@@ -1,12 +1,16 @@
 #include <stdint.h>
 
 #include "Image.h"
+#include "ImageBundle.h"
+#include "BitmapPool.h"
+#include "ImageEncoder.h"
 #include "Api/InputStream.h"
 #include "Api/OutputStream.h"
 #include "ManagedInputStream.h"
 #include "ManagedOutputStream.h"
 
 #include <wx/wxprec.h>
+#include <wx/wfstream.h>
 
 #include "../../External/WxWidgets/3rdparty/nanosvg/src/nanosvg.h"
 #include "../../External/WxWidgets/3rdparty/nanosvg/src/nanosvgrast.h"
@@ -180,6 +184,7 @@ namespace Alternet::UI
 
 	bool Image::InitializeFromScreen()
 	{
+		ResetBundle();
 		wxScreenDC screenDC;
 		wxSize size = screenDC.GetSize();
 
@@ -198,6 +203,7 @@ namespace Alternet::UI
 
 	bool Image::InitializeFromDipSize(int width, int height, Coord scale, int depth)
 	{
+		ResetBundle();
 		_bitmap = wxBitmap();
 		return _bitmap.CreateWithDIPSize(width, height, scale, depth);
 	}
@@ -209,6 +215,7 @@ namespace Alternet::UI
 
 	Image::~Image()
 	{
+		ResetBundle();
 	}
 
 	class wxBitmapBundleImplSVG : public wxBitmapBundleImpl
@@ -388,6 +395,7 @@ namespace Alternet::UI
 
 	bool Image::LoadSvgFromString(const NativeStringSpan& s, int width, int height, const Color& color)
 	{
+		ResetBundle();
 
 		auto bundle = CreateFromSvgStr(s, width, height, color);
 
@@ -406,6 +414,7 @@ namespace Alternet::UI
 
 	bool Image::LoadSvgFromStream(void* stream, int width, int height, const Color& color)
 	{
+		ResetBundle();
 		auto bundle = CreateFromSvgStream(stream, width, height, color);
 
 		if (bundle.IsOk())
@@ -423,6 +432,7 @@ namespace Alternet::UI
 
 	bool Image::LoadFromStream(void* stream)
 	{
+		ResetBundle();
 		InputStream inputStream(stream);
 		ManagedInputStream managedInputStream(&inputStream);
 
@@ -432,11 +442,14 @@ namespace Alternet::UI
 
 	void* Image::ConvertToGenericImage()
 	{
+		PerformanceCounters::Increment(PerformanceCounter::ImageConversions);
 		return new GenericImage(_bitmap.ConvertToImage());
 	}
 
 	void Image::LoadFromGenericImage(void* image, int depth)
 	{
+		ResetBundle();
+		PerformanceCounters::Increment(PerformanceCounter::ImageConversions);
 		_bitmap = wxBitmap(((GenericImage*)image)->_image, depth);
 	}
 
@@ -445,7 +458,8 @@ namespace Alternet::UI
 		OutputStream outputStream(stream);
 		ManagedOutputStream managedOutputStream(&outputStream);
 
-		return _bitmap.ConvertToImage().SaveFile(managedOutputStream, GetBitmapTypeFromFormat(wxStr(format)));
+		return ImageEncoder::Save(_bitmap, managedOutputStream, GetBitmapTypeFromFormat(wxStr(format)),
+			ImageEncoder::Options());
 	}
 
 	bool Image::SaveToFile(const NativeStringSpan& fileName)
@@ -456,6 +470,7 @@ namespace Alternet::UI
 
 	void Image::Initialize(const Int32Size& size, int depth)
 	{
+		ResetBundle();
 		if (size.Width == 0 || size.Height == 0)
 		{
 			_bitmap = wxBitmap();
@@ -484,6 +499,7 @@ namespace Alternet::UI
 
 	void Image::InitializeFromImage(Image* source, const Int32Size& size)
 	{
+		ResetBundle();
 		if (!source->_bitmap.IsOk())
 		{
 			_bitmap = wxBitmap(size.Width, size.Height, 32);
@@ -498,6 +514,7 @@ namespace Alternet::UI
 
 	void Image::CopyFrom(Image* otherImage)
 	{
+		ResetBundle();
 		if (!otherImage->_bitmap.IsOk())
 			_bitmap = wxBitmap();
 		else
@@ -514,6 +531,7 @@ namespace Alternet::UI
 
 	void Image::SetBitmap(const wxBitmap& value)
 	{
+		ResetBundle();
 		_bitmap = value;
 	}
 
@@ -717,6 +735,7 @@ namespace Alternet::UI
 
 	bool Image::Rescale(const Int32Size& sizeNeeded)
 	{
+		ResetBundle();
 		wxBitmap::Rescale(_bitmap, sizeNeeded);
 		return true;
 	}
@@ -758,6 +777,7 @@ namespace Alternet::UI
 
 	bool Image::LoadFile(const NativeStringSpan& name, int type)
 	{
+		ResetBundle();
 		return _bitmap.LoadFile(wxStr(name), (wxBitmapType)type);
 	}
 
@@ -771,13 +791,12 @@ namespace Alternet::UI
 		OutputStream outputStream(stream);
 		ManagedOutputStream managedOutputStream(&outputStream);
 
-		auto image = _bitmap.ConvertToImage();
-
-		return image.SaveFile(managedOutputStream, (wxBitmapType)type);
+		return ImageEncoder::Save(_bitmap, managedOutputStream, (wxBitmapType)type, ImageEncoder::Options());
 	}
 
 	bool Image::LoadStream(void* stream, int type)
 	{
+		ResetBundle();
 		InputStream inputStream(stream);
 		ManagedInputStream managedInputStream(&inputStream);
 
@@ -811,4 +830,85 @@ namespace Alternet::UI
 		result->_bitmap = sub;
 		return result;
 	}
+
+	void Image::SetBundle(ImageBundle* bundle)
+	{
+		// Referenced, so images added to the bundle later are used too.
+		if (bundle != nullptr)
+			bundle->AddRef();
+		ResetBundle();
+		_bundle = bundle;
+	}
+
+	void Image::ResetBundle()
+	{
+		if (_bundle == nullptr)
+			return;
+
+		_bundle->Release();
+		_bundle = nullptr;
+	}
+
+	wxBitmapBundle Image::GetBitmapBundle()
+	{
+		auto bundle = ImageBundle::GetBundle(_bundle);
+		if (bundle.IsOk())
+			return bundle;
+		return wxBitmapBundle(_bitmap);
+	}
+
+	bool Image::SaveStreamWithPreset(void* stream, int bitmapType, int preset, int quality,
+		int compressionLevel, int filter, int threadCount)
+	{
+		OutputStream outputStream(stream);
+		ManagedOutputStream managedOutputStream(&outputStream);
+
+		return ImageEncoder::Save(_bitmap, managedOutputStream, (wxBitmapType)bitmapType,
+			ImageEncoder::GetOptions(preset, quality, compressionLevel, filter, threadCount));
+	}
+
+	bool Image::SaveFileWithPreset(const NativeStringSpan& fileName, int bitmapType, int preset,
+		int quality, int compressionLevel, int filter, int threadCount)
+	{
+		wxFileOutputStream stream(wxStr(fileName));
+		if (!stream.IsOk())
+			return false;
+
+		return ImageEncoder::Save(_bitmap, stream, (wxBitmapType)bitmapType,
+			ImageEncoder::GetOptions(preset, quality, compressionLevel, filter, threadCount))
+			&& stream.Close();
+	}
+
+	/*static*/ Image* Image::CreatePooled(int width, int height, int depth, double scaleFactor)
+	{
+		auto image = new Image();
+		image->_bitmap = BitmapPool::GetInstance().AcquireBitmap(width, height, depth, scaleFactor);
+		return image;
+	}
+
+	void Image::ReturnToPool()
+	{
+		ResetBundle();
+		BitmapPool::GetInstance().ReleaseBitmap(_bitmap);
+	}
+
+	/*static*/ void Image::SetBitmapPoolLimit(int64_t value)
+	{
+		BitmapPool::GetInstance().SetLimit(value);
+	}
+
+	/*static*/ int64_t Image::GetBitmapPoolLimit()
+	{
+		return BitmapPool::GetInstance().GetLimit();
+	}
+
+	/*static*/ int64_t Image::GetBitmapPoolBytes()
+	{
+		return BitmapPool::GetInstance().GetPooledBytes();
+	}
+
+	/*static*/ void Image::ClearBitmapPool()
+	{
+		BitmapPool::GetInstance().Clear();
+	}
 }
\ No newline at end of file
@@ -74,6 +74,8 @@ namespace Alternet::UI
         }
     };
 
+    class ImageBundle;
+
     class Image : public Object
     {
 #include "Api/Image.inc"       
@@ -99,8 +101,16 @@ namespace Alternet::UI
 
         Int32Size GetPixelSize();
 
+        // Bundle set with SetBundle or a bundle of the bitmap alone. Controls
+        // take it to choose the bitmap for their DPI scale themselves. The
+        // bundle is dropped when the bitmap is replaced.
+        wxBitmapBundle GetBitmapBundle();
+
         wxBitmap _bitmap; // reference-counted, so use copy-by-value.
     private:
+        void ResetBundle();
+
+        ImageBundle* _bundle = nullptr;
         ImageAlphaPixelData* alphaPixelData = nullptr;
         ImageNativePixelData* nativePixelData = nullptr;
         int _stride = 0;
@@ -0,0 +1,206 @@
+#include "ImageBundle.h"
+
+namespace Alternet::UI
+{
+    wxSize ImageBundleImpl::GetDefaultSize() const
+    {
+        if (_defaultSize.IsFullySpecified())
+            return _defaultSize;
+        if (!_bitmaps.empty())
+            return _bitmaps.front().GetSize();
+        return wxSize(0, 0);
+    }
+
+    wxSize ImageBundleImpl::GetPreferredBitmapSizeAtScale(double scale) const
+    {
+        // Any size can be served, images of other sizes are scaled once
+        // and then taken from the cache.
+        auto size = GetDefaultSize();
+        return wxSize(wxRound(size.x * scale), wxRound(size.y * scale));
+    }
+
+    wxBitmap ImageBundleImpl::GetBitmap(const wxSize& size)
+    {
+        for (auto& bitmap : _bitmaps)
+        {
+            if (bitmap.GetSize() == size)
+                return bitmap;
+        }
+
+        auto key = GetKey(size);
+        auto it = _cache.find(key);
+        if (it != _cache.end())
+            return it->second;
+
+        auto bitmap = CreateBitmap(size);
+        if (!bitmap.IsOk())
+            return bitmap;
+
+        if (_cacheOrder.size() >= MaxCachedBitmaps)
+        {
+            _cache.erase(_cacheOrder.front());
+            _cacheOrder.erase(_cacheOrder.begin());
+        }
+
+        _cache[key] = bitmap;
+        _cacheOrder.push_back(key);
+        return bitmap;
+    }
+
+    wxBitmap ImageBundleImpl::CreateBitmap(const wxSize& size)
+    {
+        if (_svg.IsOk())
+            return _svg.GetBitmap(size);
+
+        if (_bitmaps.empty())
+            return wxBitmap();
+
+        // Scaling down from the smallest larger image keeps the most detail,
+        // the largest image is scaled up only when there is nothing larger.
+        auto source = std::find_if(_bitmaps.begin(), _bitmaps.end(),
+            [&size](const wxBitmap& bitmap)
+            {
+                return bitmap.GetWidth() >= size.x && bitmap.GetHeight() >= size.y;
+            });
+
+        auto& bitmap = source != _bitmaps.end() ? *source : _bitmaps.back();
+
+        PerformanceCounters::Increment(PerformanceCounter::ImageConversions);
+        auto image = bitmap.ConvertToImage().Scale(size.x, size.y, wxIMAGE_QUALITY_HIGH);
+
+        PerformanceCounters::Increment(PerformanceCounter::ImageConversions);
+        return wxBitmap(image);
+    }
+
+    void ImageBundleImpl::AddBitmap(const wxBitmap& bitmap)
+    {
+        if (!bitmap.IsOk())
+            return;
+
+        auto it = std::find_if(_bitmaps.begin(), _bitmaps.end(),
+            [&bitmap](const wxBitmap& item) { return item.GetWidth() >= bitmap.GetWidth(); });
+
+        if (it != _bitmaps.end() && it->GetSize() == bitmap.GetSize())
+            *it = bitmap;
+        else
+            _bitmaps.insert(it, bitmap);
+
+        ClearCache();
+    }
+
+    void ImageBundleImpl::SetSvg(const wxBitmapBundle& svg, const wxSize& defaultSize)
+    {
+        _svg = svg;
+        _defaultSize = defaultSize;
+        ClearCache();
+    }
+
+    void ImageBundleImpl::Clear()
+    {
+        _bitmaps.clear();
+        _svg = wxBitmapBundle();
+        _defaultSize = wxDefaultSize;
+        ClearCache();
+    }
+
+    void ImageBundleImpl::ClearCache()
+    {
+        _cache.clear();
+        _cacheOrder.clear();
+    }
+
+    bool ImageBundleImpl::IsOk() const
+    {
+        return _svg.IsOk() || !_bitmaps.empty();
+    }
+
+    size_t ImageBundleImpl::GetCachedCount() const
+    {
+        return _cache.size();
+    }
+
+    /*static*/ uint64_t ImageBundleImpl::GetKey(const wxSize& size)
+    {
+        return ((uint64_t)(uint32_t)size.x << 32) | (uint32_t)size.y;
+    }
+
+    ImageBundle::ImageBundle()
+    {
+        GenericImage::EnsureImageHandlersInitialized();
+
+        // The bundle owns the implementation, _impl stays valid while the
+        // bundle or its copies given to controls are alive.
+        _impl = new ImageBundleImpl();
+        _bundle = wxBitmapBundle::FromImpl(_impl);
+    }
+
+    ImageBundle::~ImageBundle()
+    {
+    }
+
+    /*static*/ wxBitmapBundle ImageBundle::GetBundle(ImageBundle* bundle)
+    {
+        if (bundle == nullptr || !bundle->IsOk())
+            return wxBitmapBundle();
+        return bundle->_bundle;
+    }
+
+    void ImageBundle::AddImage(Image* image)
+    {
+        _impl->AddBitmap(image->GetBitmap());
+    }
+
+    bool ImageBundle::LoadSvgFromString(const NativeStringSpan& s, int width, int height,
+        const Color& color)
+    {
+        auto svg = Image::CreateFromSvgStr(s, width, height, color);
+        if (!svg.IsOk())
+            return false;
+
+        _impl->SetSvg(svg, wxSize(width, height));
+        return true;
+    }
+
+    void ImageBundle::Clear()
+    {
+        _impl->Clear();
+    }
+
+    bool ImageBundle::IsOk()
+    {
+        return _impl->IsOk();
+    }
+
+    Image* ImageBundle::CreateImage(double scale)
+    {
+        if (!IsOk())
+            return nullptr;
+
+        auto image = new Image();
+        image->SetBitmap(_bundle.GetBitmap(_bundle.GetPreferredBitmapSizeAtScale(scale)));
+        return image;
+    }
+
+    Image* ImageBundle::GetImage(double scale)
+    {
+        return CreateImage(scale);
+    }
+
+    Image* ImageBundle::GetImageForControl(Control* control)
+    {
+        // Doesn't create the window of the control only to get its scale.
+        auto scale = control != nullptr && control->IsWxWindowCreated()
+            ? control->GetWxWindow()->GetDPIScaleFactor() : 1.0;
+        return CreateImage(scale);
+    }
+
+    int ImageBundle::GetCachedCount()
+    {
+        return (int)_impl->GetCachedCount();
+    }
+
+    void ImageBundle::ClearCache()
+    {
+        _impl->ClearCache();
+    }
+}
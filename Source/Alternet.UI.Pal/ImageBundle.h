@@ -0,0 +1,59 @@
+#pragma once
+#include "Common.h"
+#include "ApiTypes.h"
+#include "Object.h"
+#include "Image.h"
+#include "Control.h"
+
+#include <map>
+
+namespace Alternet::UI
+{
+    // Bitmap bundle over images of several resolutions of the same icon and
+    // optionally its SVG source. Bitmaps for sizes without an image are made
+    // from the SVG or scaled down from the nearest larger image, and are kept
+    // so switching between monitors with different DPI doesn't recreate them.
+    class ImageBundleImpl : public wxBitmapBundleImpl
+    {
+    public:
+        static constexpr size_t MaxCachedBitmaps = 8;
+
+        wxSize GetDefaultSize() const override;
+        wxSize GetPreferredBitmapSizeAtScale(double scale) const override;
+        wxBitmap GetBitmap(const wxSize& size) override;
+
+        void AddBitmap(const wxBitmap& bitmap);
+        void SetSvg(const wxBitmapBundle& svg, const wxSize& defaultSize);
+        void Clear();
+        void ClearCache();
+
+        bool IsOk() const;
+        size_t GetCachedCount() const;
+
+    private:
+        static uint64_t GetKey(const wxSize& size);
+
+        wxBitmap CreateBitmap(const wxSize& size);
+
+        // Sorted by width.
+        std::vector<wxBitmap> _bitmaps;
+        wxBitmapBundle _svg;
+        wxSize _defaultSize;
+
+        std::map<uint64_t, wxBitmap> _cache;
+        std::vector<uint64_t> _cacheOrder;
+    };
+
+    class ImageBundle : public Object
+    {
+#include "Api/ImageBundle.inc"
+    public:
+        static wxBitmapBundle GetBundle(ImageBundle* bundle);
+
+    private:
+        Image* CreateImage(double scale);
+
+        ImageBundleImpl* _impl = nullptr;
+        wxBitmapBundle _bundle;
+    };
+}
@@ -0,0 +1,239 @@
+#include "ImageDecodeQueue.h"
+#include "ImageThumbnail.h"
+
+namespace Alternet::UI
+{
+    ImageDecodeQueue& ImageDecodeQueue::GetInstance()
+    {
+        // Not destroyed on exit, workers can't be joined safely while the
+        // library is unloaded.
+        static auto instance = new ImageDecodeQueue();
+        return *instance;
+    }
+
+    ImageDecodeQueue::~ImageDecodeQueue()
+    {
+        StopWorkers();
+    }
+
+    int64_t ImageDecodeQueue::AddFile(const wxString& path, int bitmapType, int index,
+        int maxWidth, int maxHeight)
+    {
+        Request request;
+        request.Path = path;
+        request.BitmapType = bitmapType;
+        request.Index = index;
+        request.MaxWidth = maxWidth;
+        request.MaxHeight = maxHeight;
+        return Add(std::move(request));
+    }
+
+    int64_t ImageDecodeQueue::AddMemory(std::vector<uint8_t>&& data, int bitmapType, int index,
+        int maxWidth, int maxHeight)
+    {
+        Request request;
+        request.Data = std::move(data);
+        request.BitmapType = bitmapType;
+        request.Index = index;
+        request.MaxWidth = maxWidth;
+        request.MaxHeight = maxHeight;
+        return Add(std::move(request));
+    }
+
+    int64_t ImageDecodeQueue::Add(Request&& request)
+    {
+        // Handlers are registered on the UI thread before the workers use
+        // them, the list of handlers is only read while decoding and is
+        // changed only with the workers suspended.
+        GenericImage::EnsureImageHandlersInitialized();
+
+        int64_t id;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            id = _nextId++;
+            request.Id = id;
+            _requests.push_back(std::move(request));
+        }
+
+        if (_workers.empty())
+            StartWorkers();
+        else
+            _wake.notify_one();
+
+        return id;
+    }
+
+    bool ImageDecodeQueue::Cancel(int64_t id)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = std::find_if(_requests.begin(), _requests.end(),
+            [id](const Request& request) { return request.Id == id; });
+
+        if (it != _requests.end())
+        {
+            _requests.erase(it);
+
+            Result result;
+            result.Id = id;
+            result.State = Cancelled;
+            _results.push_back(std::move(result));
+            return true;
+        }
+
+        if (_running.count(id) == 0)
+            return false;
+
+        _cancelled.insert(id);
+        return true;
+    }
+
+    int ImageDecodeQueue::Poll(int64_t* results, int resultsCount)
+    {
+        std::vector<Result> finished;
+        auto capacity = (size_t)(resultsCount / ResultStride);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            auto count = std::min(capacity, _results.size());
+            finished.assign(std::make_move_iterator(_results.begin()),
+                std::make_move_iterator(_results.begin() + count));
+            _results.erase(_results.begin(), _results.begin() + count);
+        }
+
+        for (size_t i = 0; i < finished.size(); i++)
+        {
+            auto& result = finished[i];
+            auto record = results + i * ResultStride;
+
+            record[0] = result.Id;
+            record[1] = result.State == Done ? (int64_t)new GenericImage(result.Image) : 0;
+            record[2] = result.State;
+        }
+
+        return (int)finished.size();
+    }
+
+    void ImageDecodeQueue::SetThreadCount(int value)
+    {
+        if (_threadCount == value)
+            return;
+
+        StopWorkers();
+        _threadCount = value;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_requests.empty())
+            StartWorkers();
+    }
+
+    int ImageDecodeQueue::GetThreadCount()
+    {
+        if (_threadCount > 0)
+            return _threadCount;
+        return (int)std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    int ImageDecodeQueue::GetPendingCount()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return (int)(_requests.size() + _running.size() + _results.size());
+    }
+
+    void ImageDecodeQueue::SuspendWorkers()
+    {
+        StopWorkers();
+    }
+
+    void ImageDecodeQueue::ResumeWorkers()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_workers.empty() && !_requests.empty())
+            StartWorkers();
+    }
+
+    void ImageDecodeQueue::StartWorkers()
+    {
+        _stopWorkers = false;
+
+        auto count = GetThreadCount();
+        for (int i = 0; i < count; i++)
+            _workers.emplace_back(&ImageDecodeQueue::WorkerLoop, this);
+    }
+
+    void ImageDecodeQueue::StopWorkers()
+    {
+        if (_workers.empty())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopWorkers = true;
+        }
+
+        _wake.notify_all();
+
+        for (auto& worker : _workers)
+            worker.join();
+        _workers.clear();
+    }
+
+    void ImageDecodeQueue::WorkerLoop()
+    {
+        // Errors of handlers are reported by the result status, not logged.
+        wxLogNull noLog;
+
+        while (true)
+        {
+            Request request;
+
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _wake.wait(lock, [this]() { return _stopWorkers || !_requests.empty(); });
+
+                if (_stopWorkers)
+                    return;
+
+                request = std::move(_requests.front());
+                _requests.pop_front();
+                _running.insert(request.Id);
+            }
+
+            Result result;
+            result.Id = request.Id;
+
+            auto type = (wxBitmapType)request.BitmapType;
+            auto thumbnail = request.MaxWidth > 0 && request.MaxHeight > 0;
+
+            if (request.Path.IsEmpty())
+            {
+                wxMemoryInputStream stream(request.Data.data(), request.Data.size());
+                if (thumbnail)
+                    ImageThumbnail::Load(stream, request.MaxWidth, request.MaxHeight, result.Image);
+                else
+                    result.Image.LoadFile(stream, type, request.Index);
+            }
+            else if (thumbnail)
+                ImageThumbnail::LoadFile(request.Path, request.MaxWidth, request.MaxHeight, result.Image);
+            else
+                result.Image.LoadFile(request.Path, type, request.Index);
+
+            result.State = result.Image.IsOk() ? Done : Failed;
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                _running.erase(request.Id);
+
+                if (_cancelled.erase(request.Id) > 0)
+                {
+                    result.State = Cancelled;
+                    result.Image = wxImage();
+                }
+
+                _results.push_back(std::move(result));
+            }
+        }
+    }
+}
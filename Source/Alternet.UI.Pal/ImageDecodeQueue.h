@@ -0,0 +1,87 @@
+#pragma once
+#include "Common.h"
+#include "GenericImage.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace Alternet::UI
+{
+    // Decodes images on a pool of worker threads with the registered image
+    // handlers. Requests are identified by ids returned when they are added.
+    // Finished requests are collected with Poll on the UI thread, which
+    // creates the GenericImage objects, so workers only deal with wxImage.
+    class ImageDecodeQueue
+    {
+    public:
+        enum Status
+        {
+            Done,
+            Failed,
+            Cancelled,
+        };
+
+        // Poll result: request id, GenericImage handle or null, status.
+        static constexpr int ResultStride = 3;
+
+        static ImageDecodeQueue& GetInstance();
+
+        ~ImageDecodeQueue();
+
+        // When maxWidth and maxHeight are set, the image is loaded reduced
+        // to fit them with ImageThumbnail.
+        int64_t AddFile(const wxString& path, int bitmapType, int index,
+            int maxWidth = 0, int maxHeight = 0);
+        int64_t AddMemory(std::vector<uint8_t>&& data, int bitmapType, int index,
+            int maxWidth = 0, int maxHeight = 0);
+        bool Cancel(int64_t id);
+        int Poll(int64_t* results, int resultsCount);
+
+        void SetThreadCount(int value);
+        int GetThreadCount();
+        int GetPendingCount();
+
+        // Waits for the images being decoded and stops the workers, queued
+        // requests are kept. Used while the image handlers are changed.
+        void SuspendWorkers();
+        void ResumeWorkers();
+
+    private:
+        struct Request
+        {
+            int64_t Id = 0;
+            wxString Path;
+            std::vector<uint8_t> Data;
+            int BitmapType = wxBITMAP_TYPE_ANY;
+            int Index = -1;
+            int MaxWidth = 0;
+            int MaxHeight = 0;
+        };
+
+        struct Result
+        {
+            int64_t Id = 0;
+            wxImage Image;
+            Status State = Done;
+        };
+
+        int64_t Add(Request&& request);
+        void StartWorkers();
+        void StopWorkers();
+        void WorkerLoop();
+
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::deque<Request> _requests;
+        std::vector<Result> _results;
+        std::unordered_set<int64_t> _running;
+        std::unordered_set<int64_t> _cancelled;
+        std::vector<std::thread> _workers;
+        int _threadCount = 0;
+        int64_t _nextId = 1;
+        bool _stopWorkers = false;
+    };
+}
@@ -0,0 +1,563 @@
+#include "ImageEncoder.h"
+
+#include <wx/zstream.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Alternet::UI
+{
+    /*static*/ ImageEncoder::Options ImageEncoder::GetOptions(int preset, int quality,
+        int compressionLevel, int filter, int threadCount)
+    {
+        Options options;
+
+        switch (preset)
+        {
+        case Fastest:
+            options.Quality = 90;
+            options.CompressionLevel = 1;
+            options.Filter = FilterUp;
+            options.ThreadCount = 0;
+            break;
+        case Balanced:
+            options.Quality = 85;
+            options.CompressionLevel = 6;
+            options.Filter = FilterAdaptive;
+            options.ThreadCount = 0;
+            break;
+        case Smallest:
+            options.Quality = 75;
+            options.CompressionLevel = 9;
+            options.Filter = FilterAdaptive;
+            options.ThreadCount = 0;
+            break;
+        }
+
+        if (quality >= 0)
+            options.Quality = std::min(quality, 100);
+        if (compressionLevel >= 0)
+            options.CompressionLevel = std::min(compressionLevel, 9);
+        if (filter >= 0)
+            options.Filter = std::min(filter, (int)FilterAdaptive);
+        if (threadCount >= 0)
+            options.ThreadCount = threadCount;
+
+        return options;
+    }
+
+    /*static*/ bool ImageEncoder::Save(const wxImage& image, wxOutputStream& stream, wxBitmapType type,
+        const Options& options)
+    {
+        if (!image.IsOk())
+            return false;
+
+        Source source;
+        source.Width = image.GetWidth();
+        source.Height = image.GetHeight();
+        source.HasAlpha = image.HasAlpha();
+
+        auto rgb = image.GetData();
+        auto alpha = image.GetAlpha();
+        source.ReadRow = [rgb, alpha, &source](int y, uint8_t* row)
+        {
+            auto width = (size_t)source.Width;
+            auto rowRgb = rgb + y * width * 3;
+
+            if (alpha == nullptr)
+            {
+                memcpy(row, rowRgb, width * 3);
+                return;
+            }
+
+            auto rowAlpha = alpha + y * width;
+            for (size_t x = 0; x < width; x++, row += 4, rowRgb += 3)
+            {
+                row[0] = rowRgb[0];
+                row[1] = rowRgb[1];
+                row[2] = rowRgb[2];
+                row[3] = rowAlpha[x];
+            }
+        };
+
+        // Masks are written by the handler as transparency.
+        if (!image.HasMask() && CanSavePng(source, type, options))
+            return SavePng(source, stream, options);
+
+        // Options are set on a copy, setting them unshares the image data.
+        auto copy = image;
+        return SaveWithHandler(copy, stream, type, options);
+    }
+
+    /*static*/ bool ImageEncoder::Save(const wxBitmap& bitmap, wxOutputStream& stream, wxBitmapType type,
+        const Options& options)
+    {
+        if (!bitmap.IsOk())
+            return false;
+
+        auto pixels = bitmap;
+        Source source;
+        source.Width = bitmap.GetWidth();
+        source.Height = bitmap.GetHeight();
+        source.HasAlpha = bitmap.HasAlpha();
+
+        // Pixel data is locked on this thread, rows are then read through
+        // iterators of their own by the encoding threads.
+        std::unique_ptr<ImageAlphaPixelData> alphaData;
+        std::unique_ptr<ImageNativePixelData> nativeData;
+
+        if (bitmap.GetMask() == nullptr && source.HasAlpha)
+        {
+            alphaData.reset(new ImageAlphaPixelData(pixels));
+            if (*alphaData)
+            {
+                auto data = alphaData.get();
+                source.ReadRow = [data, &source](int y, uint8_t* row)
+                {
+                    ImageAlphaPixelData::Iterator p(*data);
+                    p.MoveTo(*data, 0, y);
+
+                    for (int x = 0; x < source.Width; x++, ++p, row += 4)
+                    {
+                        auto a = p.Alpha();
+                        row[3] = a;
+#if defined(__WXMSW__) || defined(__WXOSX__)
+                        // Alpha bitmaps are premultiplied on these platforms.
+                        if (a != 0 && a != 255)
+                        {
+                            row[0] = (uint8_t)std::min(p.Red() * 255 / a, 255);
+                            row[1] = (uint8_t)std::min(p.Green() * 255 / a, 255);
+                            row[2] = (uint8_t)std::min(p.Blue() * 255 / a, 255);
+                            continue;
+                        }
+#endif
+                        row[0] = p.Red();
+                        row[1] = p.Green();
+                        row[2] = p.Blue();
+                    }
+                };
+            }
+        }
+        else if (bitmap.GetMask() == nullptr)
+        {
+            nativeData.reset(new ImageNativePixelData(pixels));
+            if (*nativeData)
+            {
+                auto data = nativeData.get();
+                source.ReadRow = [data, &source](int y, uint8_t* row)
+                {
+                    ImageNativePixelData::Iterator p(*data);
+                    p.MoveTo(*data, 0, y);
+
+                    for (int x = 0; x < source.Width; x++, ++p, row += 3)
+                    {
+                        row[0] = p.Red();
+                        row[1] = p.Green();
+                        row[2] = p.Blue();
+                    }
+                };
+            }
+        }
+
+        // Bitmaps with a mask or a pixel format without raw access.
+        if (!source.ReadRow)
+        {
+            alphaData.reset();
+            nativeData.reset();
+            return Save(bitmap.ConvertToImage(), stream, type, options);
+        }
+
+        if (CanSavePng(source, type, options))
+            return SavePng(source, stream, options);
+
+        wxImage image(source.Width, source.Height, false);
+        if (!image.IsOk())
+            return false;
+        if (source.HasAlpha)
+            image.SetAlpha();
+
+        std::vector<uint8_t> row((size_t)source.Width * 4);
+        auto rgb = image.GetData();
+        auto alpha = image.GetAlpha();
+
+        for (int y = 0; y < source.Height; y++)
+        {
+            if (alpha == nullptr)
+            {
+                source.ReadRow(y, rgb);
+                rgb += source.Width * 3;
+                continue;
+            }
+
+            source.ReadRow(y, row.data());
+            for (int x = 0; x < source.Width; x++, rgb += 3)
+            {
+                rgb[0] = row[x * 4];
+                rgb[1] = row[x * 4 + 1];
+                rgb[2] = row[x * 4 + 2];
+                *alpha++ = row[x * 4 + 3];
+            }
+        }
+
+        alphaData.reset();
+        nativeData.reset();
+        return SaveWithHandler(image, stream, type, options);
+    }
+
+    /*static*/ bool ImageEncoder::SaveWithHandler(wxImage& image, wxOutputStream& stream,
+        wxBitmapType type, const Options& options)
+    {
+        if (type == wxBITMAP_TYPE_PNG)
+        {
+            // Filter flags of libpng.
+            static const int pngFilters[] = { 0x08, 0x10, 0x20, 0x40, 0x80, 0xF8 };
+
+            if (options.CompressionLevel >= 0)
+            {
+                image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_LEVEL, options.CompressionLevel);
+                image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_BUFFER_SIZE, (int)BlockSize);
+            }
+            if (options.Filter >= 0)
+                image.SetOption(wxIMAGE_OPTION_PNG_FILTER, pngFilters[options.Filter]);
+        }
+        else if (type == wxBITMAP_TYPE_JPEG && options.Quality >= 0)
+            image.SetOption(wxIMAGE_OPTION_QUALITY, options.Quality);
+
+        // TIFF handler seeks in the output, it writes to the stream itself.
+        if (type == wxBITMAP_TYPE_TIFF)
+            return image.SaveFile(stream, type);
+
+        wxBufferedOutputStream buffered(stream, BlockSize);
+        auto result = image.SaveFile(buffered, type);
+        return buffered.Close() && result;
+    }
+
+    /*static*/ int ImageEncoder::GetThreadCount(const Options& options)
+    {
+        if (options.ThreadCount > 0)
+            return options.ThreadCount;
+        return (int)std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    /*static*/ bool ImageEncoder::CanSavePng(const Source& source, wxBitmapType type, const Options& options)
+    {
+        if (type != wxBITMAP_TYPE_PNG || options.CompressionLevel < 0 || GetThreadCount(options) < 2)
+            return false;
+
+        // Images of one chunk aren't worth the threads.
+        auto rowBytes = (size_t)source.Width * (source.HasAlpha ? 4 : 3) + 1;
+        return source.Width > 0 && rowBytes * source.Height > ChunkSize;
+    }
+
+    /*static*/ bool ImageEncoder::SavePng(const Source& source, wxOutputStream& stream, const Options& options)
+    {
+        auto rowBytes = (size_t)source.Width * (source.HasAlpha ? 4 : 3) + 1;
+        auto rowsPerChunk = std::max(1, (int)(ChunkSize / rowBytes));
+        auto chunkCount = (source.Height + rowsPerChunk - 1) / rowsPerChunk;
+        auto level = options.CompressionLevel;
+        auto filter = options.Filter < 0 ? (int)FilterAdaptive : options.Filter;
+
+        std::vector<Chunk> chunks(chunkCount);
+        std::atomic<int> nextChunk(0);
+        std::mutex mutex;
+        std::condition_variable chunkDone;
+
+        auto encode = [&]()
+        {
+            while (true)
+            {
+                auto index = nextChunk++;
+                if (index >= chunkCount)
+                    return;
+
+                Chunk chunk;
+                DeflateChunk(source, index, rowsPerChunk, level, filter, chunk);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                chunks[index] = std::move(chunk);
+                chunks[index].Done = true;
+                chunkDone.notify_all();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        auto threadCount = std::min(GetThreadCount(options), chunkCount);
+        for (int i = 0; i < threadCount; i++)
+            threads.emplace_back(encode);
+
+        wxBufferedOutputStream buffered(stream, BlockSize);
+
+        static const uint8_t signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        buffered.Write(signature, sizeof(signature));
+
+        uint8_t header[13] =
+        {
+            (uint8_t)(source.Width >> 24), (uint8_t)(source.Width >> 16),
+            (uint8_t)(source.Width >> 8), (uint8_t)source.Width,
+            (uint8_t)(source.Height >> 24), (uint8_t)(source.Height >> 16),
+            (uint8_t)(source.Height >> 8), (uint8_t)source.Height,
+            8, (uint8_t)(source.HasAlpha ? 6 : 2), 0, 0, 0,
+        };
+        WriteChunk(buffered, "IHDR", header, sizeof(header));
+
+        // Chunks are written in order as they are finished, each one as an
+        // IDAT chunk; the checksum of the zlib stream goes into the last.
+        auto ok = true;
+        uint32_t adler = 1;
+
+        for (int i = 0; i < chunkCount; i++)
+        {
+            std::vector<uint8_t> data;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                chunkDone.wait(lock, [&chunks, i]() { return chunks[i].Done; });
+                data = std::move(chunks[i].Data);
+                ok = ok && chunks[i].Ok;
+                adler = CombineAdler32(adler, chunks[i].Adler, chunks[i].Length);
+            }
+
+            if (!ok)
+                continue;
+
+            if (i == chunkCount - 1)
+            {
+                data.push_back((uint8_t)(adler >> 24));
+                data.push_back((uint8_t)(adler >> 16));
+                data.push_back((uint8_t)(adler >> 8));
+                data.push_back((uint8_t)adler);
+            }
+
+            WriteChunk(buffered, "IDAT", data.data(), data.size());
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        WriteChunk(buffered, "IEND", nullptr, 0);
+
+        return buffered.Close() && ok;
+    }
+
+    /*static*/ void ImageEncoder::DeflateChunk(const Source& source, int index, int rowsPerChunk,
+        int level, int filter, Chunk& chunk)
+    {
+        auto bytesPerPixel = source.HasAlpha ? 4 : 3;
+        auto length = (size_t)source.Width * bytesPerPixel;
+        auto first = index * rowsPerChunk;
+        auto last = std::min(first + rowsPerChunk, source.Height);
+
+        std::vector<uint8_t> previous(length), current(length);
+        std::vector<uint8_t> filtered(length + 1), candidate(length + 1);
+
+        // Up, Average and Paeth filters of the first row of the chunk refer
+        // to the last row of the previous one.
+        if (first > 0)
+            source.ReadRow(first - 1, previous.data());
+
+        wxMemoryOutputStream memory;
+
+        if (index == 0)
+        {
+            // zlib header with the compression level hint.
+            auto levelFlags = level <= 1 ? 0x01 : level <= 5 ? 0x5E : level == 6 ? 0x9C : 0xDA;
+            memory.PutC(0x78);
+            memory.PutC((char)levelFlags);
+        }
+
+        {
+            wxZlibOutputStream deflate(memory, level, wxZLIB_NO_HEADER);
+
+            for (int y = first; y < last; y++)
+            {
+                source.ReadRow(y, current.data());
+                FilterRow(filter, bytesPerPixel, previous.data(), current.data(), length,
+                    filtered.data(), candidate.data());
+
+                chunk.Adler = Adler32(chunk.Adler, filtered.data(), filtered.size());
+                chunk.Length += filtered.size();
+                deflate.Write(filtered.data(), filtered.size());
+
+                std::swap(previous, current);
+            }
+
+            // A full flush ends the chunk on a byte boundary with the
+            // dictionary reset, so the next chunk continues the stream.
+            if (last == source.Height)
+                deflate.Close();
+            else
+                deflate.Sync();
+
+            chunk.Ok = deflate.IsOk();
+
+            // Taken before the destructor finishes the stream.
+            chunk.Data.resize((size_t)memory.GetLength());
+            memory.CopyTo(chunk.Data.data(), chunk.Data.size());
+        }
+    }
+
+    /*static*/ void ImageEncoder::FilterRow(int filter, int bytesPerPixel, const uint8_t* previous,
+        const uint8_t* current, size_t length, uint8_t* result, uint8_t* candidate)
+    {
+        if (filter != FilterAdaptive)
+        {
+            ApplyFilter(filter, bytesPerPixel, previous, current, length, result);
+            return;
+        }
+
+        // Same heuristic as libpng: the smallest sum of the filtered bytes
+        // taken as signed values.
+        uint64_t bestSum = UINT64_MAX;
+
+        for (int type = FilterNone; type <= FilterPaeth; type++)
+        {
+            ApplyFilter(type, bytesPerPixel, previous, current, length, candidate);
+
+            uint64_t sum = 0;
+            for (size_t i = 1; i <= length; i++)
+                sum += std::abs((int)(int8_t)candidate[i]);
+
+            if (sum < bestSum)
+            {
+                bestSum = sum;
+                memcpy(result, candidate, length + 1);
+            }
+        }
+    }
+
+    /*static*/ void ImageEncoder::ApplyFilter(int filter, int bytesPerPixel, const uint8_t* previous,
+        const uint8_t* current, size_t length, uint8_t* result)
+    {
+        result[0] = (uint8_t)filter;
+        auto target = result + 1;
+
+        for (size_t i = 0; i < length; i++)
+        {
+            int left = i >= (size_t)bytesPerPixel ? current[i - bytesPerPixel] : 0;
+            int up = previous[i];
+            int upLeft = i >= (size_t)bytesPerPixel ? previous[i - bytesPerPixel] : 0;
+            int predictor;
+
+            switch (filter)
+            {
+            case FilterSub:
+                predictor = left;
+                break;
+            case FilterUp:
+                predictor = up;
+                break;
+            case FilterAverage:
+                predictor = (left + up) >> 1;
+                break;
+            case FilterPaeth:
+            {
+                auto p = left + up - upLeft;
+                auto pa = std::abs(p - left);
+                auto pb = std::abs(p - up);
+                auto pc = std::abs(p - upLeft);
+                predictor = pa <= pb && pa <= pc ? left : pb <= pc ? up : upLeft;
+                break;
+            }
+            default:
+                predictor = 0;
+                break;
+            }
+
+            target[i] = (uint8_t)(current[i] - predictor);
+        }
+    }
+
+    /*static*/ void ImageEncoder::WriteChunk(wxOutputStream& stream, const char* type, const uint8_t* data,
+        size_t length)
+    {
+        uint8_t header[8] =
+        {
+            (uint8_t)(length >> 24), (uint8_t)(length >> 16), (uint8_t)(length >> 8), (uint8_t)length,
+            (uint8_t)type[0], (uint8_t)type[1], (uint8_t)type[2], (uint8_t)type[3],
+        };
+
+        auto crc = Crc32(0xFFFFFFFF, header + 4, 4);
+        if (length > 0)
+            crc = Crc32(crc, data, length);
+        crc ^= 0xFFFFFFFF;
+
+        uint8_t footer[4] = { (uint8_t)(crc >> 24), (uint8_t)(crc >> 16), (uint8_t)(crc >> 8), (uint8_t)crc };
+
+        stream.Write(header, sizeof(header));
+        if (length > 0)
+            stream.Write(data, length);
+        stream.Write(footer, sizeof(footer));
+    }
+
+    /*static*/ uint32_t ImageEncoder::Crc32(uint32_t crc, const uint8_t* data, size_t length)
+    {
+        static const auto table = []()
+        {
+            std::vector<uint32_t> result(256);
+            for (uint32_t n = 0; n < 256; n++)
+            {
+                auto c = n;
+                for (int k = 0; k < 8; k++)
+                    c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+                result[n] = c;
+            }
+            return result;
+        }();
+
+        for (size_t i = 0; i < length; i++)
+            crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return crc;
+    }
+
+    /*static*/ uint32_t ImageEncoder::Adler32(uint32_t adler, const uint8_t* data, size_t length)
+    {
+        const uint32_t Base = 65521;
+        // Largest number of bytes summed before the sums can overflow.
+        const size_t MaxRun = 5552;
+
+        uint32_t a = adler & 0xFFFF;
+        uint32_t b = adler >> 16;
+
+        while (length > 0)
+        {
+            auto run = std::min(length, MaxRun);
+            length -= run;
+
+            while (run-- > 0)
+            {
+                a += *data++;
+                b += a;
+            }
+
+            a %= Base;
+            b %= Base;
+        }
+
+        return (b << 16) | a;
+    }
+
+    /*static*/ uint32_t ImageEncoder::CombineAdler32(uint32_t adler1, uint32_t adler2, size_t length2)
+    {
+        // adler32_combine of zlib.
+        const uint32_t Base = 65521;
+
+        auto remainder = (uint32_t)(length2 % Base);
+        uint32_t sum1 = adler1 & 0xFFFF;
+        uint32_t sum2 = (uint32_t)(((uint64_t)remainder * sum1) % Base);
+
+        sum1 += (adler2 & 0xFFFF) + Base - 1;
+        sum2 += ((adler1 >> 16) & 0xFFFF) + ((adler2 >> 16) & 0xFFFF) + Base - remainder;
+
+        if (sum1 >= Base)
+            sum1 -= Base;
+        if (sum1 >= Base)
+            sum1 -= Base;
+        if (sum2 >= (Base << 1))
+            sum2 -= (Base << 1);
+        if (sum2 >= Base)
+            sum2 -= Base;
+
+        return sum1 | (sum2 << 16);
+    }
+}
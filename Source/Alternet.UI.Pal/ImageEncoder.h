@@ -0,0 +1,97 @@
+#pragma once
+#include "Common.h"
+#include "GenericImage.h"
+
+namespace Alternet::UI
+{
+    // Saves images with speed/size presets. PNG images larger than one
+    // chunk of rows are filtered and deflated on several threads; other
+    // images go through the wx handlers with the preset options. Bitmaps
+    // are read from their pixel data in one pass and the output is written
+    // to the stream in large blocks.
+    class ImageEncoder
+    {
+    public:
+        enum Preset
+        {
+            // Handler defaults on one thread, same as SaveFile.
+            Default = 0,
+            Fastest = 1,
+            Balanced = 2,
+            Smallest = 3,
+        };
+
+        enum Filter
+        {
+            FilterNone = 0,
+            FilterSub = 1,
+            FilterUp = 2,
+            FilterAverage = 3,
+            FilterPaeth = 4,
+            // Filter with the smallest sum of differences for each row.
+            FilterAdaptive = 5,
+        };
+
+        // Negative values leave the handler defaults, zero thread count uses
+        // a thread per processor.
+        struct Options
+        {
+            int Quality = -1;
+            int CompressionLevel = -1;
+            int Filter = -1;
+            int ThreadCount = 1;
+        };
+
+        // Values which are not negative override the values of the preset.
+        static Options GetOptions(int preset, int quality, int compressionLevel,
+            int filter, int threadCount);
+
+        static bool Save(const wxImage& image, wxOutputStream& stream, wxBitmapType type,
+            const Options& options);
+        static bool Save(const wxBitmap& bitmap, wxOutputStream& stream, wxBitmapType type,
+            const Options& options);
+
+        // Writes a PNG chunk with its length and CRC.
+        static void WriteChunk(wxOutputStream& stream, const char* type, const uint8_t* data,
+            size_t length);
+        static uint32_t Crc32(uint32_t crc, const uint8_t* data, size_t length);
+
+    private:
+        static constexpr size_t BlockSize = 1024 * 1024;
+        static constexpr size_t ChunkSize = 256 * 1024;
+
+        // Reads a row as RGB or RGBA bytes, called from several threads.
+        struct Source
+        {
+            int Width = 0;
+            int Height = 0;
+            bool HasAlpha = false;
+            std::function<void(int y, uint8_t* row)> ReadRow;
+        };
+
+        struct Chunk
+        {
+            std::vector<uint8_t> Data;
+            uint32_t Adler = 1;
+            size_t Length = 0;
+            bool Ok = false;
+            bool Done = false;
+        };
+
+        static bool SaveWithHandler(wxImage& image, wxOutputStream& stream, wxBitmapType type,
+            const Options& options);
+        static bool SavePng(const Source& source, wxOutputStream& stream, const Options& options);
+        static bool CanSavePng(const Source& source, wxBitmapType type, const Options& options);
+        static int GetThreadCount(const Options& options);
+
+        static void DeflateChunk(const Source& source, int index, int rowsPerChunk, int level,
+            int filter, Chunk& chunk);
+        static void FilterRow(int filter, int bytesPerPixel, const uint8_t* previous,
+            const uint8_t* current, size_t length, uint8_t* result, uint8_t* candidate);
+        static void ApplyFilter(int filter, int bytesPerPixel, const uint8_t* previous,
+            const uint8_t* current, size_t length, uint8_t* result);
+
+        static uint32_t Adler32(uint32_t adler, const uint8_t* data, size_t length);
+        static uint32_t CombineAdler32(uint32_t adler1, uint32_t adler2, size_t length2);
+    };
+}
@@ -1,4 +1,5 @@
 #include "ImageList.h"
+#include "BitmapPool.h"
 
 namespace Alternet::UI
 {
@@ -15,11 +16,17 @@ namespace Alternet::UI
 
     bool ImageList::Remove(int index)
     {
-        return _imageList->Remove(index);
+        if (!_imageList->Remove(index))
+            return false;
+
+        if (_useAtlas)
+            RebuildAtlas();
+        return true;
     }
 
     bool ImageList::Clear()
     {
+        _atlas = wxNullBitmap;
         return _imageList->RemoveAll();
     }
 
@@ -57,24 +64,247 @@ namespace Alternet::UI
         SetPixelImageSize(fromDip(value, nullptr));
     }
 
+    bool ImageList::GetUseAtlas()
+    {
+        return _useAtlas;
+    }
+
+    void ImageList::SetUseAtlas(bool value)
+    {
+        if (_useAtlas == value)
+            return;
+
+        _useAtlas = value;
+
+        if (_useAtlas)
+            RebuildAtlas();
+        else
+            _atlas = wxNullBitmap;
+    }
+
     void ImageList::AddImage(Image* image)
     {
-        AddImageCore(image->GetBitmap().ConvertToImage());
+        AddBitmaps({ PrepareBitmap(image->GetBitmap()) });
     }
 
-    void ImageList::AddImageCore(const wxImage& image)
+    int ImageList::AddImages(int64_t* images, int imagesCount)
     {
-        if (_imageList == nullptr)
-            throwExInvalidOpWithInfo("ImageList::AddImageCore");
+        std::vector<wxBitmap> bitmaps;
+        bitmaps.reserve(imagesCount);
+
+        for (int i = 0; i < imagesCount; i++)
+        {
+            auto image = (Image*)images[i];
+            if (image != nullptr)
+                bitmaps.push_back(PrepareBitmap(image->GetBitmap()));
+        }
+
+        if (bitmaps.empty())
+            return -1;
 
-        auto finalImage = image;
+        return AddBitmaps(bitmaps);
+    }
+
+    wxBitmap ImageList::PrepareBitmap(const wxBitmap& bitmap)
+    {
         auto targetSize = _imageList->GetSize();
 
-        if (finalImage.GetSize() != targetSize)
-            finalImage = finalImage.Scale(targetSize.x, targetSize.y, wxIMAGE_QUALITY_BILINEAR);
+        // Bitmaps of the list size are added as they are, without the round
+        // trip through wxImage.
+        if (bitmap.GetSize() == targetSize)
+            return bitmap;
 
-        wxBitmap bitmap(finalImage);
-        _imageList->Add(bitmap);
+        PerformanceCounters::Increment(PerformanceCounter::ImageConversions);
+        auto image = bitmap.ConvertToImage().Scale(targetSize.x, targetSize.y,
+            wxIMAGE_QUALITY_BILINEAR);
+
+        PerformanceCounters::Increment(PerformanceCounter::ImageConversions);
+        return wxBitmap(image);
+    }
+
+    int ImageList::AddBitmaps(const std::vector<wxBitmap>& bitmaps)
+    {
+        if (_imageList == nullptr)
+            throwExInvalidOpWithInfo("ImageList::AddBitmaps");
+
+        auto first = _imageList->GetImageCount();
+        auto count = (int)bitmaps.size();
+
+        // Images added after the atlas was dropped over its size limit
+        // aren't put in it either.
+        if (!_useAtlas || (first > 0 && !_atlas.IsOk()) || !ReserveAtlas(first + count))
+        {
+            for (auto& bitmap : bitmaps)
+                _imageList->Add(bitmap);
+            return first;
+        }
+
+        for (int i = 0; i < count; i++)
+            CopyToAtlas(bitmaps[i], first + i);
+
+        // The image list splits a strip of several images on Add, so new
+        // images are passed to it a row of the atlas at a time.
+        auto end = first + count;
+        for (auto index = first; index < end;)
+        {
+            auto rowEnd = std::min(end, (index / AtlasColumns + 1) * AtlasColumns);
+            auto cell = GetAtlasCell(index);
+            cell.width *= rowEnd - index;
+            _imageList->Add(_atlas.GetSubBitmap(cell));
+            index = rowEnd;
+        }
+
+        return first;
+    }
+
+    wxRect ImageList::GetAtlasCell(int index)
+    {
+        auto size = _imageList->GetSize();
+        return wxRect((index % AtlasColumns) * size.x, (index / AtlasColumns) * size.y,
+            size.x, size.y);
+    }
+
+    bool ImageList::ReserveAtlas(int count)
+    {
+        auto size = _imageList->GetSize();
+        auto rows = (count + AtlasColumns - 1) / AtlasColumns;
+        auto currentRows = _atlas.IsOk() ? _atlas.GetHeight() / size.y : 0;
+
+        if (rows <= currentRows)
+            return true;
+
+        if (size.x <= 0 || size.y <= 0)
+            return false;
+
+        auto width = (int64_t)AtlasColumns * size.x;
+        auto maxRows = std::min((int64_t)MaxAtlasSide / size.y,
+            MaxAtlasBytes / (width * size.y * 4));
+
+        // Large images or many of them would need a bitmap beyond the limits
+        // of the platforms, the atlas is dropped then.
+        if (width > MaxAtlasSide || rows > maxRows)
+        {
+            _atlas = wxNullBitmap;
+            return false;
+        }
+
+        // Rows are doubled so adding images one by one doesn't copy the
+        // atlas every time.
+        rows = (int)std::min((int64_t)std::max(rows, currentRows * 2), maxRows);
+
+        wxImage image(AtlasColumns * size.x, rows * size.y);
+        image.InitAlpha();
+        memset(image.GetAlpha(), 0, (size_t)image.GetWidth() * image.GetHeight());
+
+        wxBitmap atlas(image, 32);
+
+        if (currentRows > 0)
+        {
+            ImageAlphaPixelData source(_atlas);
+            ImageAlphaPixelData target(atlas,
+                wxRect(0, 0, _atlas.GetWidth(), _atlas.GetHeight()));
+
+            if (source && target)
+            {
+                ImageAlphaPixelData::Iterator sourceRow(source);
+                ImageAlphaPixelData::Iterator targetRow(target);
+
+                for (int y = 0; y < _atlas.GetHeight(); y++)
+                {
+                    auto sourcePixel = sourceRow;
+                    auto targetPixel = targetRow;
+
+                    for (int x = 0; x < _atlas.GetWidth(); x++, ++sourcePixel, ++targetPixel)
+                        targetPixel.Data() = sourcePixel.Data();
+
+                    sourceRow.OffsetY(source, 1);
+                    targetRow.OffsetY(target, 1);
+                }
+            }
+        }
+
+        _atlas = atlas;
+        return true;
+    }
+
+    void ImageList::CopyToAtlas(const wxBitmap& bitmap, int index)
+    {
+        auto source = bitmap;
+
+        // Raw pixels are copied only between bitmaps with alpha, others
+        // get it from the mask or as opaque.
+        if (!source.HasAlpha())
+        {
+            PerformanceCounters::Increment(PerformanceCounter::ImageConversions);
+            auto image = source.ConvertToImage();
+            image.InitAlpha();
+            source = wxBitmap(image, 32);
+        }
+
+        auto cell = GetAtlasCell(index);
+        ImageAlphaPixelData sourceData(source, wxRect(wxPoint(), cell.GetSize()));
+        ImageAlphaPixelData targetData(_atlas, cell);
+
+        if (!sourceData || !targetData)
+            return;
+
+        ImageAlphaPixelData::Iterator sourceRow(sourceData);
+        ImageAlphaPixelData::Iterator targetRow(targetData);
+
+        for (int y = 0; y < cell.height; y++)
+        {
+            auto sourcePixel = sourceRow;
+            auto targetPixel = targetRow;
+
+            for (int x = 0; x < cell.width; x++, ++sourcePixel, ++targetPixel)
+                targetPixel.Data() = sourcePixel.Data();
+
+            sourceRow.OffsetY(sourceData, 1);
+            targetRow.OffsetY(targetData, 1);
+        }
+    }
+
+    void ImageList::RebuildAtlas()
+    {
+        _atlas = wxNullBitmap;
+
+        auto count = _imageList->GetImageCount();
+        if (count == 0)
+            return;
+
+        if (!ReserveAtlas(count))
+            return;
+
+        for (int i = 0; i < count; i++)
+            CopyToAtlas(_imageList->GetBitmap(i), i);
+    }
+
+    void ImageList::Draw(DrawingContext* dc, int index, int x, int y)
+    {
+        if (index < 0 || index >= _imageList->GetImageCount())
+            return;
+
+        auto atlasOk = _useAtlas && _atlas.IsOk();
+
+        if (dc->IsHeadless())
+        {
+            auto bitmap = atlasOk ? _atlas.GetSubBitmap(GetAtlasCell(index))
+                : _imageList->GetBitmap(index);
+            dc->GetGraphicsContext()->DrawBitmap(bitmap, x, y,
+                bitmap.GetWidth(), bitmap.GetHeight());
+            return;
+        }
+
+        if (!atlasOk)
+        {
+            _imageList->Draw(index, *dc->GetDC(), x, y, wxIMAGELIST_DRAW_TRANSPARENT);
+            return;
+        }
+
+        // A blit of the atlas cell, no bitmap is created for the image.
+        auto cell = GetAtlasCell(index);
+        BitmapPool::DCScope scope(_atlas);
+        dc->GetDC()->Blit(x, y, cell.width, cell.height, &scope.GetDC(), cell.x, cell.y, wxCOPY, true);
     }
 
     wxImageList* ImageList::GetImageList()
@@ -105,15 +335,21 @@ namespace Alternet::UI
 
         if (_imageList != nullptr)
         {
-            for (int i = 0; _imageList->GetImageCount(); i++)
+            auto count = _imageList->GetImageCount();
+            bitmapsToRestore.reserve(count);
+            for (int i = 0; i < count; i++)
                 bitmapsToRestore.push_back(_imageList->GetBitmap(i));
         }
 
         DestroyImageList();
         CreateImageList();
+        _atlas = wxNullBitmap;
+
+        for (auto& bitmap : bitmapsToRestore)
+            bitmap = PrepareBitmap(bitmap);
 
-        for (auto bitmap : bitmapsToRestore)
-            AddImageCore(bitmap.ConvertToImage());
+        if (!bitmapsToRestore.empty())
+            AddBitmaps(bitmapsToRestore);
     }
 
     int ImageList::GetPixelImageSizeY()
@@ -2,6 +2,7 @@
 #include "Common.h"
 #include "ApiTypes.h"
 #include "Image.h"
+#include "DrawingContext.h"
 #include "Object.h"
 
 namespace Alternet::UI
@@ -21,14 +22,29 @@ namespace Alternet::UI
         void SetPixelImageSize(const Int32Size& value);
 
     private:
+        // Atlas images are laid out in rows of this many cells.
+        static constexpr int AtlasColumns = 32;
+        // Above these limits the atlas isn't used and images are drawn from
+        // the image list.
+        static constexpr int MaxAtlasSide = 8192;
+        static constexpr int64_t MaxAtlasBytes = 64 * 1024 * 1024;
 
         void CreateImageList();
         void DestroyImageList();
         void RecreateImageList();
 
-        void AddImageCore(const wxImage& image);
+        wxBitmap PrepareBitmap(const wxBitmap& bitmap);
+        int AddBitmaps(const std::vector<wxBitmap>& bitmaps);
+
+        wxRect GetAtlasCell(int index);
+        bool ReserveAtlas(int count);
+        void CopyToAtlas(const wxBitmap& bitmap, int index);
+        void RebuildAtlas();
 
         Int32Size _pixelImageSize;
         wxImageList* _imageList = nullptr;
+
+        bool _useAtlas = false;
+        wxBitmap _atlas;
     };
 }
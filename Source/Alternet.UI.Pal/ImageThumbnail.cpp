@@ -0,0 +1,192 @@
+#include "ImageThumbnail.h"
+
+#include <wx/wfstream.h>
+
+namespace Alternet::UI
+{
+    bool ImageThumbnail::LoadFile(const wxString& path, int width, int height, wxImage& result)
+    {
+        wxFileInputStream stream(path);
+        if (!stream.IsOk())
+            return false;
+        return Load(stream, width, height, result);
+    }
+
+    bool ImageThumbnail::Load(wxInputStream& stream, int width, int height, wxImage& result)
+    {
+        if (width <= 0 || height <= 0)
+            return result.LoadFile(stream, wxBITMAP_TYPE_ANY);
+
+        auto jpegHandler = wxImage::FindHandler(wxBITMAP_TYPE_JPEG);
+        auto isJpeg = jpegHandler != nullptr && stream.IsSeekable() && jpegHandler->CanRead(stream);
+
+        if (isJpeg)
+        {
+            if (LoadExifThumbnail(stream, width, height, result))
+                return true;
+
+            // libjpeg decodes at 1/2, 1/4 or 1/8 of the size, the handler
+            // picks the smallest scale which is not less than the limits.
+            result.SetOption(wxIMAGE_OPTION_MAX_WIDTH, width);
+            result.SetOption(wxIMAGE_OPTION_MAX_HEIGHT, height);
+
+            if (!result.LoadFile(stream, wxBITMAP_TYPE_JPEG))
+                return false;
+        }
+        else if (!result.LoadFile(stream, wxBITMAP_TYPE_ANY))
+            return false;
+
+        Reduce(result, width, height);
+        return true;
+    }
+
+    wxSize ImageThumbnail::GetFitSize(const wxSize& size, int width, int height)
+    {
+        if (size.x <= width && size.y <= height)
+            return size;
+
+        auto scale = std::min((double)width / size.x, (double)height / size.y);
+        return wxSize(std::max((int)(size.x * scale + 0.5), 1),
+            std::max((int)(size.y * scale + 0.5), 1));
+    }
+
+    void ImageThumbnail::Reduce(wxImage& image, int width, int height)
+    {
+        auto size = image.GetSize();
+        auto fit = GetFitSize(size, width, height);
+        if (fit == size)
+            return;
+
+        // Integer box filter shrink does most of the work cheaply, the final
+        // scaling to the exact size is then done on a small image.
+        auto factor = std::min(size.x / fit.x, size.y / fit.y);
+        if (factor >= 2)
+            image = image.ShrinkBy(factor, factor);
+
+        if (image.GetSize() != fit)
+            image.Rescale(fit.x, fit.y, wxIMAGE_QUALITY_BILINEAR);
+    }
+
+    bool ImageThumbnail::LoadExifThumbnail(wxInputStream& stream, int width, int height,
+        wxImage& result)
+    {
+        auto start = stream.TellI();
+        std::vector<uint8_t> app1;
+
+        auto readByte = [&stream]() { return (int)(uint8_t)stream.GetC(); };
+
+        if (readByte() == 0xFF && readByte() == 0xD8)
+        {
+            // Looks through the markers before the image data for APP1.
+            while (!stream.Eof())
+            {
+                if (readByte() != 0xFF)
+                    break;
+
+                auto marker = readByte();
+                if (marker == 0xDA || marker == 0xD9)
+                    break;
+
+                auto length = (readByte() << 8) | readByte();
+                if (length < 2)
+                    break;
+
+                if (marker == 0xE1 && app1.empty())
+                {
+                    app1.resize((size_t)length - 2);
+                    stream.Read(app1.data(), app1.size());
+                    if (stream.LastRead() != app1.size())
+                        app1.clear();
+                    break;
+                }
+
+                stream.SeekI(length - 2, wxFromCurrent);
+            }
+        }
+
+        stream.SeekI(start);
+
+        static const char exifHeader[] = "Exif\0";
+        if (app1.size() <= sizeof(exifHeader) || memcmp(app1.data(), exifHeader, sizeof(exifHeader)) != 0)
+            return false;
+
+        std::vector<uint8_t> tiff(app1.begin() + sizeof(exifHeader), app1.end());
+
+        size_t offset, length;
+        if (!FindExifThumbnail(tiff, offset, length))
+            return false;
+
+        wxImage thumbnail;
+        {
+            wxLogNull noLog;
+            wxMemoryInputStream thumbnailStream(tiff.data() + offset, length);
+            if (!thumbnail.LoadFile(thumbnailStream, wxBITMAP_TYPE_JPEG))
+                return false;
+        }
+
+        // A thumbnail which fits into the box is smaller than the result
+        // of decoding the full image would be, so it is not used.
+        if (thumbnail.GetWidth() < width && thumbnail.GetHeight() < height)
+            return false;
+
+        result = thumbnail;
+        Reduce(result, width, height);
+        return true;
+    }
+
+    bool ImageThumbnail::FindExifThumbnail(const std::vector<uint8_t>& tiff, size_t& offset,
+        size_t& length)
+    {
+        if (tiff.size() < 8)
+            return false;
+
+        auto littleEndian = tiff[0] == 'I' && tiff[1] == 'I';
+        if (!littleEndian && !(tiff[0] == 'M' && tiff[1] == 'M'))
+            return false;
+
+        auto read16 = [&](size_t at) -> uint32_t
+        {
+            if (at + 2 > tiff.size())
+                return 0;
+            return littleEndian
+                ? tiff[at] | (tiff[at + 1] << 8)
+                : (tiff[at] << 8) | tiff[at + 1];
+        };
+
+        auto read32 = [&](size_t at) -> uint32_t
+        {
+            if (at + 4 > tiff.size())
+                return 0;
+            return littleEndian
+                ? read16(at) | (read16(at + 2) << 16)
+                : (read16(at) << 16) | read16(at + 2);
+        };
+
+        // The thumbnail is described by the second IFD, which follows the
+        // entries of the first one.
+        auto ifd0 = (size_t)read32(4);
+        if (ifd0 == 0 || ifd0 + 2 > tiff.size())
+            return false;
+
+        auto ifd1 = (size_t)read32(ifd0 + 2 + read16(ifd0) * 12);
+        if (ifd1 == 0 || ifd1 + 2 > tiff.size())
+            return false;
+
+        offset = 0;
+        length = 0;
+
+        auto count = read16(ifd1);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            auto entry = ifd1 + 2 + i * 12;
+            auto tag = read16(entry);
+
+            if (tag == 0x0201)
+                offset = read32(entry + 8);
+            else if (tag == 0x0202)
+                length = read32(entry + 8);
+        }
+
+        return offset > 0 && length > 0 && offset + length <= tiff.size();
+    }
+}
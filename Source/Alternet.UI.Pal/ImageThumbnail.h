@@ -0,0 +1,24 @@
+#pragma once
+#include "Common.h"
+
+#include <wx/image.h>
+
+namespace Alternet::UI
+{
+    // Loads images reduced to fit a bounding box. JPEG images are decoded
+    // at a reduced size by libjpeg or replaced with the embedded EXIF
+    // thumbnail when it is big enough; other images are decoded and then
+    // shrunk with a box filter before the final scaling.
+    class ImageThumbnail
+    {
+    public:
+        static bool LoadFile(const wxString& path, int width, int height, wxImage& result);
+        static bool Load(wxInputStream& stream, int width, int height, wxImage& result);
+
+    private:
+        static bool LoadExifThumbnail(wxInputStream& stream, int width, int height, wxImage& result);
+        static bool FindExifThumbnail(const std::vector<uint8_t>& app1, size_t& offset, size_t& length);
+        static wxSize GetFitSize(const wxSize& size, int width, int height);
+        static void Reduce(wxImage& image, int width, int height);
+    };
+}
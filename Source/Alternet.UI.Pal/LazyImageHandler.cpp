@@ -0,0 +1,172 @@
+#include "LazyImageHandler.h"
+#include "PerformanceCounters.h"
+
+
+namespace Alternet::UI
+{
+    LazyImageHandler::LazyImageHandler(const Format& format) : _format(format)
+    {
+        m_name = format.Name;
+        m_extension = format.Extension;
+        m_altExtensions = wxSplit(format.AltExtensions, ';', 0);
+        m_type = format.Type;
+        m_mime = format.MimeType;
+    }
+
+    /*static*/ const std::vector<LazyImageHandler::Format>& LazyImageHandler::GetFormats()
+    {
+        static const std::vector<Format> formats =
+        {
+#if wxUSE_LIBPNG
+            { wxBITMAP_TYPE_PNG, "PNG file", "png", "", "image/png",
+                { { "\x89PNG", 4 } },
+                []() -> wxImageHandler* { return new wxPNGHandler; } },
+#endif
+#if wxUSE_LIBJPEG
+            { wxBITMAP_TYPE_JPEG, "JPEG file", "jpg", "jpeg;jpe", "image/jpeg",
+                { { "\xFF\xD8", 2 } },
+                []() -> wxImageHandler* { return new wxJPEGHandler; } },
+#endif
+#if wxUSE_LIBTIFF
+            { wxBITMAP_TYPE_TIFF, "TIFF file", "tif", "tiff", "image/tiff",
+                { { "II*\0", 4 }, { "MM\0*", 4 } },
+                []() -> wxImageHandler* { return new wxTIFFHandler; } },
+#endif
+#if wxUSE_GIF
+            { wxBITMAP_TYPE_GIF, "GIF file", "gif", "", "image/gif",
+                { { "GIF8", 4 } },
+                []() -> wxImageHandler* { return new wxGIFHandler; } },
+#endif
+#if wxUSE_PNM
+            { wxBITMAP_TYPE_PNM, "PNM file", "pnm", "ppm;pgm;pbm", "image/pnm",
+                { { "P", 1 } },
+                []() -> wxImageHandler* { return new wxPNMHandler; } },
+#endif
+#if wxUSE_PCX
+            { wxBITMAP_TYPE_PCX, "PCX file", "pcx", "", "image/pcx",
+                { { "\x0A", 1 } },
+                []() -> wxImageHandler* { return new wxPCXHandler; } },
+#endif
+#if wxUSE_IFF
+            { wxBITMAP_TYPE_IFF, "IFF file", "iff", "", "image/x-iff",
+                { { "FORM", 4 } },
+                []() -> wxImageHandler* { return new wxIFFHandler; } },
+#endif
+#if wxUSE_ICO_CUR
+            { wxBITMAP_TYPE_ICO, "Windows icon file", "ico", "", "image/x-icon",
+                { { "\0\0\1\0", 4 } },
+                []() -> wxImageHandler* { return new wxICOHandler; } },
+            { wxBITMAP_TYPE_CUR, "Windows cursor file", "cur", "", "image/x-cursor",
+                { { "\0\0\2\0", 4 } },
+                []() -> wxImageHandler* { return new wxCURHandler; } },
+            { wxBITMAP_TYPE_ANI, "Windows animated cursor file", "ani", "", "image/x-ani",
+                { { "RIFF", 4 } },
+                []() -> wxImageHandler* { return new wxANIHandler; } },
+#endif
+#if wxUSE_TGA
+            { wxBITMAP_TYPE_TGA, "TGA file", "tga", "", "image/tga",
+                { },
+                []() -> wxImageHandler* { return new wxTGAHandler; } },
+#endif
+#if wxUSE_XPM
+            { wxBITMAP_TYPE_XPM, "XPM file", "xpm", "", "image/xpm",
+                { { "/* XPM */", 9 } },
+                []() -> wxImageHandler* { return new wxXPMHandler; } },
+#endif
+        };
+
+        return formats;
+    }
+
+    wxImageHandler* LazyImageHandler::GetHandler()
+    {
+        // Decode workers may reach the handler at the same time.
+        std::call_once(_created, [this]()
+            {
+                _handler.reset(_format.Create());
+                PerformanceCounters::Increment(PerformanceCounter::ImageHandlersCreated);
+            });
+
+        return _handler.get();
+    }
+
+    bool LazyImageHandler::MatchesSignature(wxInputStream& stream)
+    {
+        auto& signatures = _format.Signatures;
+        if (signatures[0].Bytes == nullptr)
+            return true;
+
+        char header[16];
+        stream.Read(header, sizeof(header));
+        auto count = stream.LastRead();
+
+        for (auto& signature : signatures)
+        {
+            if (signature.Bytes != nullptr && count >= signature.Length
+                && memcmp(header, signature.Bytes, signature.Length) == 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    bool LazyImageHandler::DoCanRead(wxInputStream& stream)
+    {
+        // The position is restored by CanRead after this returns, the real
+        // handler needs it restored before its own check.
+        auto start = stream.TellI();
+
+        if (!MatchesSignature(stream))
+            return false;
+
+        if (stream.SeekI(start) == wxInvalidOffset)
+            return false;
+
+        return GetHandler()->CanRead(stream);
+    }
+
+    int LazyImageHandler::DoGetImageCount(wxInputStream& stream)
+    {
+        return GetHandler()->GetImageCount(stream);
+    }
+
+    bool LazyImageHandler::LoadFile(wxImage* image, wxInputStream& stream, bool verbose, int index)
+    {
+        return GetHandler()->LoadFile(image, stream, verbose, index);
+    }
+
+    bool LazyImageHandler::SaveFile(wxImage* image, wxOutputStream& stream, bool verbose)
+    {
+        return GetHandler()->SaveFile(image, stream, verbose);
+    }
+
+    /*static*/ bool LazyImageHandler::IsEnabled(wxBitmapType type)
+    {
+        return s_enabledTypes.empty()
+            || std::find(s_enabledTypes.begin(), s_enabledTypes.end(), (int)type) != s_enabledTypes.end();
+    }
+
+    /*static*/ void LazyImageHandler::Register()
+    {
+        for (auto& format : GetFormats())
+        {
+            auto handler = wxImage::FindHandler(format.Type);
+
+            if (!IsEnabled(format.Type))
+            {
+                // Handlers added by other code are left alone.
+                if (dynamic_cast<LazyImageHandler*>(handler) != nullptr)
+                    wxImage::RemoveHandler(handler->GetName());
+                continue;
+            }
+
+            if (handler == nullptr)
+                wxImage::AddHandler(new LazyImageHandler(format));
+        }
+    }
+
+    /*static*/ void LazyImageHandler::SetEnabledTypes(const std::vector<int>& types)
+    {
+        s_enabledTypes = types;
+    }
+}
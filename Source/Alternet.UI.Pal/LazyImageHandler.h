@@ -0,0 +1,70 @@
+#pragma once
+#include "Common.h"
+
+#include <wx/image.h>
+
+#include <memory>
+#include <mutex>
+
+namespace Alternet::UI
+{
+    // Stands in for a wx image handler until it is needed. Extension, MIME
+    // type and file signatures are known up front, so handlers are listed
+    // and matched without being created; the real handler is created the
+    // first time a stream passes the signature check or an image is loaded
+    // or saved with it.
+    class LazyImageHandler : public wxImageHandler
+    {
+    public:
+        using Factory = wxImageHandler* (*)();
+
+        struct Signature
+        {
+            const char* Bytes;
+            size_t Length;
+        };
+
+        struct Format
+        {
+            wxBitmapType Type;
+            const char* Name;
+            const char* Extension;
+            // Separated with ';'.
+            const char* AltExtensions;
+            const char* MimeType;
+            // Formats without signatures are always checked by the real handler.
+            Signature Signatures[2];
+            Factory Create;
+        };
+
+        LazyImageHandler(const Format& format);
+
+        bool LoadFile(wxImage* image, wxInputStream& stream, bool verbose = true,
+            int index = -1) override;
+        bool SaveFile(wxImage* image, wxOutputStream& stream, bool verbose = true) override;
+
+        // Registers handlers for the enabled formats and removes the ones
+        // created here for formats which were disabled.
+        static void Register();
+
+        // Empty list enables all formats.
+        static void SetEnabledTypes(const std::vector<int>& types);
+
+    protected:
+        bool DoCanRead(wxInputStream& stream) override;
+        int DoGetImageCount(wxInputStream& stream) override;
+
+    private:
+        wxImageHandler* GetHandler();
+        bool MatchesSignature(wxInputStream& stream);
+
+        static bool IsEnabled(wxBitmapType type);
+        static const std::vector<Format>& GetFormats();
+
+        const Format& _format;
+        std::unique_ptr<wxImageHandler> _handler;
+        std::once_flag _created;
+
+        inline static std::vector<int> s_enabledTypes;
+    };
+}
@@ -130,11 +130,11 @@ namespace Alternet::UI
         return _view;
     }
 
-    void ListView::RecreateWxWindowIfNeeded()
+    void ListView::RecreateWxWindowCore()
     {
         if (_ignoreRecreate)
             return;
-        Control::RecreateWxWindowIfNeeded();
+        Control::RecreateWxWindowCore();
         RaiseEvent(ListViewEvent::ControlRecreated);
     }
 
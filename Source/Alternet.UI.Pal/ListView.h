@@ -116,7 +116,7 @@ namespace Alternet::UI
 
         static ListViewHitTestLocations GetHitTestLocationsFromWxFlags(int flags);
         void OnLabelEditEvent(wxListEvent& event, ListViewEvent e);
-        virtual void RecreateWxWindowIfNeeded() override;
+        virtual void RecreateWxWindowCore() override;
         std::vector<int64_t> GetSelectedIndices();
         void SetSelectedIndices(const std::vector<int64_t>& value);
         void DeselectAll(wxListView2* listView);
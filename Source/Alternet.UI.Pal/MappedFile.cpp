@@ -0,0 +1,200 @@
+#include "MappedFile.h"
+
+#if defined(__WXMSW__)
+#include <wx/msw/wrapwin.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Alternet::UI
+{
+    namespace
+    {
+        // Offsets of views are multiples of this.
+        int64_t GetAllocationGranularity()
+        {
+#if defined(__WXMSW__)
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return info.dwAllocationGranularity;
+#else
+            return sysconf(_SC_PAGESIZE);
+#endif
+        }
+    }
+
+    MappedFile::View::~View()
+    {
+        Reset();
+    }
+
+    void MappedFile::View::Reset()
+    {
+        if (_base != nullptr)
+        {
+#if defined(__WXMSW__)
+            UnmapViewOfFile(_base);
+#else
+            munmap(_base, _length);
+#endif
+        }
+
+        _base = nullptr;
+        _length = 0;
+        _data = nullptr;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const wxString& path, bool random, bool mapWhole)
+    {
+        Close();
+
+#if defined(__WXMSW__)
+        auto file = CreateFileW(path.wc_str(), GENERIC_READ,
+            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | (random ? FILE_FLAG_RANDOM_ACCESS : FILE_FLAG_SEQUENTIAL_SCAN), nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        _file = file;
+
+        if (size.QuadPart == 0)
+            return true;
+
+        _mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mapping == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        _size = size.QuadPart;
+
+        if (!mapWhole)
+            return true;
+
+        _data = (const char*)MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (_data == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        return true;
+#else
+        int file = open(path.fn_str(), O_RDONLY);
+        if (file < 0)
+            return false;
+
+        struct stat info;
+        if (fstat(file, &info) != 0)
+        {
+            close(file);
+            return false;
+        }
+
+        if (info.st_size == 0)
+        {
+            close(file);
+            return true;
+        }
+
+        if (!mapWhole)
+        {
+            _descriptor = file;
+            _size = info.st_size;
+            return true;
+        }
+
+        auto data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+
+        if (data == MAP_FAILED)
+            return false;
+
+        madvise(data, (size_t)info.st_size, random ? MADV_RANDOM : MADV_SEQUENTIAL);
+
+        _data = (const char*)data;
+        _size = info.st_size;
+        return true;
+#endif
+    }
+
+    void MappedFile::Close()
+    {
+#if defined(__WXMSW__)
+        if (_data != nullptr)
+            UnmapViewOfFile(_data);
+        if (_mapping != nullptr)
+            CloseHandle(_mapping);
+        if (_file != nullptr)
+            CloseHandle(_file);
+        _mapping = nullptr;
+        _file = nullptr;
+#else
+        if (_data != nullptr)
+            munmap((void*)_data, (size_t)_size);
+        if (_descriptor >= 0)
+            close(_descriptor);
+        _descriptor = -1;
+#endif
+        _data = nullptr;
+        _size = 0;
+    }
+
+    bool MappedFile::MapView(int64_t offset, int64_t size, View& view) const
+    {
+        view.Reset();
+
+        if (offset < 0 || size <= 0 || offset + size > _size)
+            return false;
+
+        if (_data != nullptr)
+        {
+            view._data = _data + offset;
+            return true;
+        }
+
+        auto start = offset - offset % GetAllocationGranularity();
+        auto length = (uint64_t)(offset + size - start);
+        if (length > SIZE_MAX)
+            return false;
+
+#if defined(__WXMSW__)
+        if (_mapping == nullptr)
+            return false;
+
+        auto base = MapViewOfFile(_mapping, FILE_MAP_READ,
+            (DWORD)((uint64_t)start >> 32), (DWORD)start, (SIZE_T)length);
+        if (base == nullptr)
+            return false;
+#else
+        if (_descriptor < 0)
+            return false;
+
+        auto base = mmap(nullptr, (size_t)length, PROT_READ, MAP_PRIVATE, _descriptor, (off_t)start);
+        if (base == MAP_FAILED)
+            return false;
+#endif
+
+        view._base = base;
+        view._length = (size_t)length;
+        view._data = (const char*)base + (offset - start);
+        return true;
+    }
+}
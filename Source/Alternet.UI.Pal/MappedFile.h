@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Common.h"
+
+namespace Alternet::UI
+{
+    // Read-only memory mapping of a whole file, or of parts of it when the
+    // file doesn't fit into the address space, as with large files in
+    // 32-bit processes.
+    class MappedFile
+    {
+    public:
+        // Mapped part of a file, unmapped when destroyed or reset.
+        class View
+        {
+        public:
+            View() {}
+            ~View();
+
+            View(const View&) = delete;
+            View& operator=(const View&) = delete;
+
+            const char* GetData() const { return _data; }
+            void Reset();
+
+        private:
+            friend class MappedFile;
+
+            void* _base = nullptr;
+            size_t _length = 0;
+            const char* _data = nullptr;
+        };
+
+        MappedFile() {}
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Sequential access is hinted to the system unless random is set.
+        // Unless mapWhole is set, only the file is opened and its parts are
+        // mapped with MapView, GetData is then null.
+        bool Open(const wxString& path, bool random = false, bool mapWhole = true);
+        void Close();
+
+        const char* GetData() const { return _data; }
+        int64_t GetSize() const { return _size; }
+
+        // Views of a whole mapped file point into its mapping. Safe to call
+        // from several threads.
+        bool MapView(int64_t offset, int64_t size, View& view) const;
+
+    private:
+        const char* _data = nullptr;
+        int64_t _size = 0;
+#if defined(__WXMSW__)
+        void* _file = nullptr;
+        void* _mapping = nullptr;
+#else
+        int _descriptor = -1;
+#endif
+    };
+}
@@ -0,0 +1,461 @@
+#include "MappedImage.h"
+
+namespace Alternet::UI
+{
+    MappedImage::MappedImage()
+    {
+    }
+
+    MappedImage::~MappedImage()
+    {
+    }
+
+    bool MappedImage::Open(const NativeStringSpan& path)
+    {
+        Close();
+
+        // Regions are read in any order, the whole file isn't read ahead.
+        // A file which doesn't fit into the address space is mapped in parts.
+        if (!_file.Open(wxStr(path), true) && !_file.Open(wxStr(path), true, false))
+            return false;
+
+        _size = _file.GetSize();
+
+        auto first = ByteAt(0);
+        auto second = ByteAt(1);
+        auto parsed = false;
+
+        if (first == 'B' && second == 'M')
+            parsed = ParseBmp() && CheckRows();
+        else if (first == 'P' && (second == '5' || second == '6'))
+            parsed = ParsePnm() && CheckRows();
+        else if (_size >= 4 && ((first == 'I' && second == 'I') || (first == 'M' && second == 'M')))
+            parsed = ParseTiff() && CheckRows();
+
+        _headerView.Reset();
+        _headerViewSize = 0;
+
+        if (parsed)
+            return true;
+
+        Close();
+        return false;
+    }
+
+    void MappedImage::Close()
+    {
+        _headerView.Reset();
+        _headerViewOffset = 0;
+        _headerViewSize = 0;
+        _file.Close();
+        _size = 0;
+        _bigEndian = false;
+        _width = 0;
+        _height = 0;
+        _rowOffsets.clear();
+    }
+
+    bool MappedImage::IsOk()
+    {
+        return !_rowOffsets.empty();
+    }
+
+    int MappedImage::GetWidth()
+    {
+        return _width;
+    }
+
+    int MappedImage::GetHeight()
+    {
+        return _height;
+    }
+
+    void* MappedImage::ReadImage()
+    {
+        return ReadRegion(0, 0, _width, _height);
+    }
+
+    void* MappedImage::ReadRegion(int x, int y, int width, int height)
+    {
+        wxImage image;
+        if (!Read(wxRect(x, y, width, height), image))
+            return nullptr;
+        return new GenericImage(image);
+    }
+
+    bool MappedImage::Read(const wxRect& rect, wxImage& result) const
+    {
+        auto region = rect.Intersect(wxRect(0, 0, _width, _height));
+        if (_rowOffsets.empty() || region.IsEmpty())
+            return false;
+
+        auto hasAlpha = _layout == PixelLayout::RGBA || _layout == PixelLayout::BGRA;
+
+        // Not cleared, every pixel is written below.
+        wxImage image(region.width, region.height, false);
+        if (!image.IsOk())
+            return false;
+        if (hasAlpha)
+            image.SetAlpha();
+
+        auto rgb = image.GetData();
+        auto alpha = image.GetAlpha();
+        auto bytesPerPixel = GetBytesPerPixel(_layout);
+        auto rowBytes = (int64_t)region.width * bytesPerPixel;
+
+        // The rows of the region are read through one view, or through a
+        // view per row when the file is mapped in parts and their span
+        // doesn't fit. Views of a whole mapped file map nothing.
+        int64_t first = INT64_MAX;
+        int64_t end = 0;
+        for (int y = 0; y < region.height; y++)
+        {
+            auto offset = _rowOffsets[region.y + y] + (int64_t)region.x * bytesPerPixel;
+            first = std::min(first, offset);
+            end = std::max(end, offset + rowBytes);
+        }
+
+        MappedFile::View view;
+        MappedFile::View rowView;
+        auto span = _file.MapView(first, end - first, view) ? (const uint8_t*)view.GetData() : nullptr;
+
+        for (int y = 0; y < region.height; y++)
+        {
+            auto offset = _rowOffsets[region.y + y] + (int64_t)region.x * bytesPerPixel;
+
+            const uint8_t* source;
+            if (span != nullptr)
+                source = span + (offset - first);
+            else if (_file.MapView(offset, rowBytes, rowView))
+                source = (const uint8_t*)rowView.GetData();
+            else
+                return false;
+
+            auto target = rgb + (size_t)y * region.width * 3;
+            auto targetAlpha = hasAlpha ? alpha + (size_t)y * region.width : nullptr;
+
+            switch (_layout)
+            {
+            case PixelLayout::RGB:
+                memcpy(target, source, (size_t)region.width * 3);
+                break;
+            case PixelLayout::Gray:
+                for (int x = 0; x < region.width; x++, target += 3)
+                    target[0] = target[1] = target[2] = source[x];
+                break;
+            case PixelLayout::RGBA:
+                for (int x = 0; x < region.width; x++, source += 4, target += 3)
+                {
+                    target[0] = source[0];
+                    target[1] = source[1];
+                    target[2] = source[2];
+                    targetAlpha[x] = source[3];
+                }
+                break;
+            default:
+                for (int x = 0; x < region.width; x++, source += bytesPerPixel, target += 3)
+                {
+                    target[0] = source[2];
+                    target[1] = source[1];
+                    target[2] = source[0];
+                    if (targetAlpha != nullptr)
+                        targetAlpha[x] = source[3];
+                }
+                break;
+            }
+        }
+
+        result = image;
+        return true;
+    }
+
+    /*static*/ int MappedImage::GetBytesPerPixel(PixelLayout layout)
+    {
+        switch (layout)
+        {
+        case PixelLayout::Gray:
+            return 1;
+        case PixelLayout::RGB:
+        case PixelLayout::BGR:
+            return 3;
+        default:
+            return 4;
+        }
+    }
+
+    const uint8_t* MappedImage::Access(int64_t offset, int64_t size) const
+    {
+        if (offset < 0 || size <= 0 || offset + size > _size)
+            return nullptr;
+
+        auto data = (const uint8_t*)_file.GetData();
+        if (data != nullptr)
+            return data + offset;
+
+        if (offset < _headerViewOffset || offset + size > _headerViewOffset + _headerViewSize)
+        {
+            _headerViewOffset = offset - offset % HeaderWindowSize;
+            _headerViewSize = std::min(std::max(offset + size - _headerViewOffset, HeaderWindowSize),
+                _size - _headerViewOffset);
+
+            if (!_file.MapView(_headerViewOffset, _headerViewSize, _headerView))
+            {
+                _headerViewSize = 0;
+                return nullptr;
+            }
+        }
+
+        return (const uint8_t*)_headerView.GetData() + (offset - _headerViewOffset);
+    }
+
+    int MappedImage::ByteAt(int64_t position) const
+    {
+        auto p = Access(position, 1);
+        return p == nullptr ? -1 : *p;
+    }
+
+    uint32_t MappedImage::Read16(int64_t offset) const
+    {
+        auto p = Access(offset, 2);
+        if (p == nullptr)
+            return 0;
+
+        return _bigEndian ? (p[0] << 8) | p[1] : p[0] | (p[1] << 8);
+    }
+
+    uint32_t MappedImage::Read32(int64_t offset) const
+    {
+        if (offset < 0 || offset + 4 > _size)
+            return 0;
+
+        return _bigEndian
+            ? (Read16(offset) << 16) | Read16(offset + 2)
+            : Read16(offset) | (Read16(offset + 2) << 16);
+    }
+
+    bool MappedImage::SetRows(int64_t firstRow, int64_t rowStride, bool bottomUp)
+    {
+        _rowOffsets.resize(_height);
+        for (int y = 0; y < _height; y++)
+        {
+            auto row = bottomUp ? _height - 1 - y : y;
+            _rowOffsets[y] = firstRow + row * rowStride;
+        }
+        return true;
+    }
+
+    bool MappedImage::CheckRows()
+    {
+        if (_width <= 0 || _height <= 0 || (int64_t)_rowOffsets.size() != _height)
+            return false;
+
+        auto rowBytes = (int64_t)_width * GetBytesPerPixel(_layout);
+        for (auto offset : _rowOffsets)
+        {
+            if (offset < 0 || offset + rowBytes > _size)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool MappedImage::ParseBmp()
+    {
+        // BITMAPFILEHEADER followed by BITMAPINFOHEADER or a later version.
+        _bigEndian = false;
+
+        auto dataOffset = (int64_t)Read32(10);
+        auto headerSize = Read32(14);
+        if (headerSize < 40)
+            return false;
+
+        _width = (int32_t)Read32(18);
+        auto height = (int32_t)Read32(22);
+        auto bitCount = Read16(28);
+        auto compression = Read32(30);
+
+        auto bottomUp = height > 0;
+        _height = bottomUp ? height : -height;
+
+        const uint32_t BI_RGB = 0;
+        const uint32_t BI_BITFIELDS = 3;
+
+        if (bitCount == 24 && compression == BI_RGB)
+            _layout = PixelLayout::BGR;
+        else if (bitCount == 32 && compression == BI_RGB)
+            _layout = PixelLayout::BGRX;
+        else if (bitCount == 32 && compression == BI_BITFIELDS)
+        {
+            // Only the usual BGRA order of the masks is read directly.
+            if (Read32(54) != 0x00FF0000 || Read32(58) != 0x0000FF00 || Read32(62) != 0x000000FF)
+                return false;
+
+            auto alphaMask = headerSize >= 56 ? Read32(66) : 0;
+            _layout = alphaMask == 0xFF000000 ? PixelLayout::BGRA : PixelLayout::BGRX;
+        }
+        else
+            return false;
+
+        auto rowStride = (((int64_t)_width * bitCount + 31) / 32) * 4;
+        return SetRows(dataOffset, rowStride, bottomUp);
+    }
+
+    bool MappedImage::ParsePnm()
+    {
+        auto gray = ByteAt(1) == '5';
+        int64_t position = 2;
+        int64_t values[3] = {};
+
+        // Width, height and maximum value separated by whitespace and
+        // comments, then a single whitespace character before the pixels.
+        for (auto& value : values)
+        {
+            while (position < _size)
+            {
+                auto c = ByteAt(position);
+                if (c == '#')
+                {
+                    while (position < _size && ByteAt(position) != '\n')
+                        position++;
+                }
+                else if (isspace(c))
+                    position++;
+                else
+                    break;
+            }
+
+            if (position >= _size || !isdigit(ByteAt(position)))
+                return false;
+
+            while (position < _size && isdigit(ByteAt(position)) && value <= INT_MAX)
+                value = value * 10 + (ByteAt(position++) - '0');
+        }
+
+        if (position >= _size || !isspace(ByteAt(position)))
+            return false;
+
+        // Two bytes per sample above 255.
+        if (values[2] <= 0 || values[2] > 255 || values[0] > INT_MAX || values[1] > INT_MAX)
+            return false;
+
+        _width = (int)values[0];
+        _height = (int)values[1];
+        _layout = gray ? PixelLayout::Gray : PixelLayout::RGB;
+
+        return SetRows(position + 1, (int64_t)_width * GetBytesPerPixel(_layout), false);
+    }
+
+    bool MappedImage::ParseTiff()
+    {
+        _bigEndian = ByteAt(0) == 'M';
+
+        // BigTIFF (43) uses 64-bit offsets and isn't read here.
+        if (Read16(2) != 42)
+            return false;
+
+        auto ifd = (int64_t)Read32(4);
+        auto count = Read16(ifd);
+
+        uint32_t compression = 1;
+        uint32_t photometric = 2;
+        uint32_t samplesPerPixel = 1;
+        uint32_t planarConfig = 1;
+        uint32_t rowsPerStrip = UINT32_MAX;
+        bool tiled = false;
+        bool eightBit = true;
+        std::vector<uint32_t> stripOffsets;
+
+        // Values of SHORT and LONG entries, stored in the entry when they fit.
+        auto readValues = [this](int64_t entry)
+        {
+            std::vector<uint32_t> result;
+
+            auto type = Read16(entry + 2);
+            auto valueCount = Read32(entry + 4);
+            auto size = type == 3 ? 2 : type == 4 ? 4 : 0;
+            if (size == 0 || valueCount > (uint32_t)(_size / size))
+                return result;
+
+            auto offset = (int64_t)valueCount * size <= 4 ? entry + 8 : (int64_t)Read32(entry + 8);
+            result.reserve(valueCount);
+            for (uint32_t i = 0; i < valueCount; i++)
+                result.push_back(size == 2 ? Read16(offset + i * 2) : Read32(offset + i * 4));
+            return result;
+        };
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            auto entry = ifd + 2 + i * 12;
+            auto values = readValues(entry);
+            if (values.empty())
+                continue;
+
+            switch (Read16(entry))
+            {
+            case 256:
+                _width = (int)values[0];
+                break;
+            case 257:
+                _height = (int)values[0];
+                break;
+            case 258:
+                for (auto bits : values)
+                    eightBit = eightBit && bits == 8;
+                break;
+            case 259:
+                compression = values[0];
+                break;
+            case 262:
+                photometric = values[0];
+                break;
+            case 273:
+                stripOffsets = values;
+                break;
+            case 277:
+                samplesPerPixel = values[0];
+                break;
+            case 278:
+                rowsPerStrip = values[0];
+                break;
+            case 284:
+                planarConfig = values[0];
+                break;
+            case 322:
+            case 323:
+                tiled = true;
+                break;
+            }
+        }
+
+        // Uncompressed 8-bit strips with interleaved samples only.
+        if (compression != 1 || planarConfig != 1 || tiled || !eightBit
+            || stripOffsets.empty() || _width <= 0 || _height <= 0)
+            return false;
+
+        if (photometric == 1 && samplesPerPixel == 1)
+            _layout = PixelLayout::Gray;
+        else if (photometric == 2 && samplesPerPixel == 3)
+            _layout = PixelLayout::RGB;
+        else if (photometric == 2 && samplesPerPixel == 4)
+            _layout = PixelLayout::RGBA;
+        else
+            return false;
+
+        rowsPerStrip = std::min(rowsPerStrip, (uint32_t)_height);
+        if (rowsPerStrip == 0)
+            return false;
+
+        auto rowBytes = (int64_t)_width * samplesPerPixel;
+        _rowOffsets.resize(_height);
+
+        for (int y = 0; y < _height; y++)
+        {
+            auto strip = (size_t)(y / rowsPerStrip);
+            if (strip >= stripOffsets.size())
+                return false;
+            _rowOffsets[y] = stripOffsets[strip] + (y % rowsPerStrip) * rowBytes;
+        }
+
+        return true;
+    }
+}
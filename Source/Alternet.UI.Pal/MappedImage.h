@@ -0,0 +1,64 @@
+#pragma once
+#include "Common.h"
+#include "ApiTypes.h"
+#include "Object.h"
+#include "GenericImage.h"
+#include "MappedFile.h"
+
+namespace Alternet::UI
+{
+    // Uncompressed BMP, binary PNM and baseline TIFF images read straight
+    // from a memory-mapped file. Only the rows of the requested region are
+    // touched, so regions of images larger than the memory can be read;
+    // whole images are converted into the wxImage buffer in a single pass.
+    // A file which can't be mapped whole, as in 32-bit processes, is
+    // mapped in parts: each read region gets its own view.
+    class MappedImage : public Object
+    {
+#include "Api/MappedImage.inc"
+    public:
+        // Safe to call from several threads once the image is open.
+        bool Read(const wxRect& rect, wxImage& result) const;
+
+    private:
+        enum class PixelLayout
+        {
+            Gray,
+            RGB,
+            RGBA,
+            BGR,
+            BGRX,
+            BGRA,
+        };
+
+        bool ParseBmp();
+        bool ParsePnm();
+        bool ParseTiff();
+        bool SetRows(int64_t firstRow, int64_t rowStride, bool bottomUp);
+        bool CheckRows();
+
+        // Header access, used while the image is opened only.
+        const uint8_t* Access(int64_t offset, int64_t size) const;
+        int ByteAt(int64_t position) const;
+        uint32_t Read16(int64_t offset) const;
+        uint32_t Read32(int64_t offset) const;
+
+        static int GetBytesPerPixel(PixelLayout layout);
+
+        static constexpr int64_t HeaderWindowSize = 64 * 1024;
+
+        MappedFile _file;
+        int64_t _size = 0;
+        // Moving window over the header of a file mapped in parts.
+        mutable MappedFile::View _headerView;
+        mutable int64_t _headerViewOffset = 0;
+        mutable int64_t _headerViewSize = 0;
+        bool _bigEndian = false;
+
+        int _width = 0;
+        int _height = 0;
+        PixelLayout _layout = PixelLayout::RGB;
+        // File offset of each row, top to bottom.
+        std::vector<int64_t> _rowOffsets;
+    };
+}
@@ -279,7 +279,7 @@ namespace Alternet::UI
         if (item->_normalImage != nullptr)
         {
             item->_normalImage->AddRef();
-            item->SetBitmap(wxBitmapBundle(value->GetBitmap()));
+            item->SetBitmap(value->GetBitmapBundle());
         }
         else
         {
@@ -81,7 +81,7 @@ namespace Alternet::UI
 
         if (_icon != nullptr)
         {
-            wxBitmapBundle bundle(_icon->GetBitmap());
+            auto bundle = _icon->GetBitmapBundle();
             _taskBarIcon->SetIcon(bundle, _text);
         }
         else
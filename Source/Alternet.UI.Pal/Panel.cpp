@@ -51,6 +51,11 @@ namespace Alternet::UI
         return true;
     }
 
+    bool Panel::CanPoolWxWindow()
+    {
+        return true;
+    }
+
     wxWindow* Panel::CreateWxWindowUnparented()
     {
         return new wxPanel2();
@@ -11,5 +11,6 @@ namespace Alternet::UI
     public:
         wxWindow* CreateWxWindowCore(wxWindow* parent) override;
         wxWindow* CreateWxWindowUnparented() override;
+        bool CanPoolWxWindow() override;
     };
 }
@@ -0,0 +1,194 @@
+#include "PerformanceCounters.h"
+#include "Exception.h"
+
+#include <thread>
+
+namespace Alternet::UI
+{
+    /*static*/ PerformanceCounters::ExportCounter* PerformanceCounters::GetExportCounter(const char* name)
+    {
+        // Counters are created once per export and live until the process ends,
+        // so the generated wrappers can keep pointers to them.
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto counter = new ExportCounter();
+        counter->Name = name;
+        s_exportCounters.push_back(counter);
+        return counter;
+    }
+
+    /*static*/ PerformanceCounters::EventCounters* PerformanceCounters::GetEventCounters(const char* className)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto counters = new EventCounters();
+        counters->ClassName = className;
+        s_eventCounters.push_back(counters);
+        return counters;
+    }
+
+    /*static*/ void PerformanceCounters::StartTracing(int maxEvents)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_traceEvents.clear();
+        s_maxTraceEvents = maxEvents > 0 ? maxEvents : 0;
+        s_traceEvents.reserve(std::min<size_t>(s_maxTraceEvents, 65536));
+        s_traceStart = Clock::now();
+        s_tracing.store(true, std::memory_order_relaxed);
+    }
+
+    /*static*/ void PerformanceCounters::StopTracing()
+    {
+        s_tracing.store(false, std::memory_order_relaxed);
+    }
+
+    /*static*/ void PerformanceCounters::AddTraceEvent(const char* name, const char* category,
+        Clock::time_point start, Clock::time_point end)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        if (!IsTracing() || s_traceEvents.size() >= s_maxTraceEvents)
+            return;
+
+        TraceEvent event;
+        event.Name = name;
+        event.Category = category;
+        event.StartMicroseconds =
+            std::chrono::duration_cast<std::chrono::microseconds>(start - s_traceStart).count();
+        event.DurationMicroseconds =
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        event.ThreadId = std::hash<std::thread::id>()(std::this_thread::get_id());
+        s_traceEvents.push_back(event);
+    }
+
+    /*static*/ const char* PerformanceCounters::GetCounterName(PerformanceCounter counter)
+    {
+        switch (counter)
+        {
+        case PerformanceCounter::Paints:
+            return "Paints";
+        case PerformanceCounter::WindowsCreated:
+            return "WindowsCreated";
+        case PerformanceCounter::WindowsRecreated:
+            return "WindowsRecreated";
+        case PerformanceCounter::ImageConversions:
+            return "ImageConversions";
+        case PerformanceCounter::GraphicsObjectsCreated:
+            return "GraphicsObjectsCreated";
+        case PerformanceCounter::ImageHandlersCreated:
+            return "ImageHandlersCreated";
+        default:
+            throwExNoInfo;
+        }
+    }
+
+    /*static*/ const char* PerformanceCounters::GetStartupPhaseName(StartupPhase phase)
+    {
+        switch (phase)
+        {
+        case StartupPhase::ImageHandlers:
+            return "ImageHandlers";
+        case StartupPhase::EntryStart:
+            return "EntryStart";
+        case StartupPhase::CallOnInit:
+            return "CallOnInit";
+        case StartupPhase::Total:
+            return "Total";
+        default:
+            throwExNoInfo;
+        }
+    }
+
+    /*static*/ wxString PerformanceCounters::GetSnapshot()
+    {
+        wxString result;
+
+        for (int i = 0; i < (int)PerformanceCounter::Count; i++)
+        {
+            result += wxString::Format("%s=%lld\n",
+                GetCounterName((PerformanceCounter)i),
+                (long long)s_counters[i].load(std::memory_order_relaxed));
+        }
+
+        // Startup times are measured once and are not cleared by Reset.
+        for (int i = 0; i < (int)StartupPhase::Count; i++)
+        {
+            result += wxString::Format("Startup.%s=%.3f ms\n",
+                GetStartupPhaseName((StartupPhase)i),
+                GetStartupMicroseconds((StartupPhase)i) / 1000.0);
+        }
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        for (auto counter : s_exportCounters)
+        {
+            auto calls = counter->Calls.load(std::memory_order_relaxed);
+            if (calls == 0)
+                continue;
+
+            result += wxString::Format("Export.%s=%lld calls %.3f ms\n",
+                counter->Name,
+                (long long)calls,
+                counter->Nanoseconds.load(std::memory_order_relaxed) / 1000000.0);
+        }
+
+        for (auto counters : s_eventCounters)
+        {
+            for (int i = 0; i < MaxEventsPerClass; i++)
+            {
+                auto calls = counters->Calls[i].load(std::memory_order_relaxed);
+                if (calls != 0)
+                    result += wxString::Format("Event.%s.%d=%lld\n", counters->ClassName, i, (long long)calls);
+            }
+        }
+
+        return result;
+    }
+
+    /*static*/ wxString PerformanceCounters::GetTraceJson()
+    {
+        // Chrome trace event format, "complete" events with microsecond timestamps.
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        wxString result = "{\"traceEvents\":[";
+
+        for (size_t i = 0; i < s_traceEvents.size(); i++)
+        {
+            auto& event = s_traceEvents[i];
+
+            if (i > 0)
+                result += ",";
+
+            result += wxString::Format(
+                "\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%llu}",
+                event.Name,
+                event.Category,
+                (long long)event.StartMicroseconds,
+                (long long)event.DurationMicroseconds,
+                (unsigned long long)(event.ThreadId & 0xFFFFFFFF));
+        }
+
+        result += "\n],\"displayTimeUnit\":\"ms\"}";
+        return result;
+    }
+
+    /*static*/ void PerformanceCounters::Reset()
+    {
+        for (auto& counter : s_counters)
+            counter.store(0, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        for (auto counter : s_exportCounters)
+        {
+            counter->Calls.store(0, std::memory_order_relaxed);
+            counter->Nanoseconds.store(0, std::memory_order_relaxed);
+        }
+
+        for (auto counters : s_eventCounters)
+        {
+            for (auto& calls : counters->Calls)
+                calls.store(0, std::memory_order_relaxed);
+        }
+
+        s_traceEvents.clear();
+    }
+}
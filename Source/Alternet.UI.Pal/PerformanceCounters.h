@@ -0,0 +1,192 @@
+#pragma once
+
+#include "Common.Base.h"
+#include "Common.Strings.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace Alternet::UI
+{
+    enum class PerformanceCounter
+    {
+        Paints,
+        WindowsCreated,
+        WindowsRecreated,
+        ImageConversions,
+        GraphicsObjectsCreated,
+        ImageHandlersCreated,
+        Count
+    };
+
+    enum class StartupPhase
+    {
+        ImageHandlers,
+        EntryStart,
+        CallOnInit,
+        Total,
+        Count
+    };
+
+    // Process-wide counters of native activity. The fixed counters are always
+    // maintained. Per-export call statistics and event callback counters are
+    // compiled into the generated Api wrappers only when
+    // ALTERNET_UI_PERFORMANCE_COUNTERS is defined.
+    class PerformanceCounters
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr int MaxEventsPerClass = 256;
+
+        struct ExportCounter
+        {
+            const char* Name = nullptr;
+            std::atomic<int64_t> Calls{ 0 };
+            std::atomic<int64_t> Nanoseconds{ 0 };
+        };
+
+        struct EventCounters
+        {
+            const char* ClassName = nullptr;
+            std::atomic<int64_t> Calls[MaxEventsPerClass] = {};
+        };
+
+        // Measures the enclosing scope. Adds it to the export counter and,
+        // while tracing is on, to the trace.
+        class TraceScope
+        {
+        public:
+            TraceScope(const char* name, const char* category,
+                ExportCounter* counter = nullptr)
+                : _name(name), _category(category), _counter(counter), _start(Clock::now())
+            {
+            }
+
+            ~TraceScope()
+            {
+                auto end = Clock::now();
+
+                if (_counter != nullptr)
+                {
+                    _counter->Calls.fetch_add(1, std::memory_order_relaxed);
+                    _counter->Nanoseconds.fetch_add(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(end - _start).count(),
+                        std::memory_order_relaxed);
+                }
+
+                if (IsTracing())
+                    AddTraceEvent(_name, _category, _start, end);
+            }
+
+        private:
+            BYREF_ONLY(TraceScope);
+
+            const char* _name;
+            const char* _category;
+            ExportCounter* _counter;
+            Clock::time_point _start;
+        };
+
+        // Records the duration of an Application startup phase, also as a
+        // trace span when tracing was started before the Application.
+        class StartupScope
+        {
+        public:
+            StartupScope(StartupPhase phase) : _phase(phase), _start(Clock::now())
+            {
+            }
+
+            ~StartupScope()
+            {
+                auto end = Clock::now();
+                s_startupMicroseconds[(int)_phase].store(
+                    std::chrono::duration_cast<std::chrono::microseconds>(end - _start).count(),
+                    std::memory_order_relaxed);
+
+                if (IsTracing())
+                    AddTraceEvent(GetStartupPhaseName(_phase), "startup", _start, end);
+            }
+
+        private:
+            BYREF_ONLY(StartupScope);
+
+            StartupPhase _phase;
+            Clock::time_point _start;
+        };
+
+        inline static int64_t GetStartupMicroseconds(StartupPhase phase)
+        {
+            return s_startupMicroseconds[(int)phase].load(std::memory_order_relaxed);
+        }
+
+        inline static void Increment(PerformanceCounter counter)
+        {
+            s_counters[(int)counter].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline static bool IsTracing()
+        {
+            return s_tracing.load(std::memory_order_relaxed);
+        }
+
+        static ExportCounter* GetExportCounter(const char* name);
+        static EventCounters* GetEventCounters(const char* className);
+
+        static void StartTracing(int maxEvents);
+        static void StopTracing();
+        static void AddTraceEvent(const char* name, const char* category,
+            Clock::time_point start, Clock::time_point end);
+
+        static wxString GetSnapshot();
+        static wxString GetTraceJson();
+        static void Reset();
+
+    private:
+        struct TraceEvent
+        {
+            const char* Name;
+            const char* Category;
+            int64_t StartMicroseconds;
+            int64_t DurationMicroseconds;
+            size_t ThreadId;
+        };
+
+        static const char* GetCounterName(PerformanceCounter counter);
+        static const char* GetStartupPhaseName(StartupPhase phase);
+
+        inline static std::atomic<int64_t> s_counters[(int)PerformanceCounter::Count] = {};
+        inline static std::atomic<int64_t> s_startupMicroseconds[(int)StartupPhase::Count] = {};
+
+        inline static std::mutex s_mutex;
+        inline static std::vector<ExportCounter*> s_exportCounters;
+        inline static std::vector<EventCounters*> s_eventCounters;
+
+        inline static std::atomic<bool> s_tracing{ false };
+        inline static std::vector<TraceEvent> s_traceEvents;
+        inline static size_t s_maxTraceEvents = 0;
+        inline static Clock::time_point s_traceStart;
+    };
+}
+
+#if defined(ALTERNET_UI_PERFORMANCE_COUNTERS)
+
+#define ALTERNET_UI_PERF_EXPORT(name) \
+    static auto _perfExportCounter = ::Alternet::UI::PerformanceCounters::GetExportCounter(name); \
+    ::Alternet::UI::PerformanceCounters::TraceScope _perfExportScope(name, "export", _perfExportCounter)
+
+#define ALTERNET_UI_PERF_EVENT(className, eventId) \
+    do \
+    { \
+        static auto _perfEventCounters = ::Alternet::UI::PerformanceCounters::GetEventCounters(className); \
+        if ((int)(eventId) < ::Alternet::UI::PerformanceCounters::MaxEventsPerClass) \
+            _perfEventCounters->Calls[(int)(eventId)].fetch_add(1, std::memory_order_relaxed); \
+    } while (false)
+
+#else
+
+#define ALTERNET_UI_PERF_EXPORT(name)
+#define ALTERNET_UI_PERF_EVENT(className, eventId)
+
+#endif
@@ -1,4 +1,5 @@
 #include "PropertyGrid.h"
+#include "PropertyGridBulk.h"
 
 namespace Alternet::UI
 {
@@ -370,19 +371,6 @@ namespace Alternet::UI
 		return new wxIntProperty(wxStr(label), wxStr(name), (long)value);
 	}
 
-	class wxFloatProperty2 : public wxFloatProperty
-	{
-	public:
-		wxFloatProperty2(const wxString& label = wxPG_LABEL,
-			const wxString& name = wxPG_LABEL,
-			double value = 0.0)
-			:wxFloatProperty(label, name, value)
-		{
-		}
-
-		virtual wxString ValueToString(wxVariant& value, wxPGPropValFormatFlags flags = wxPGPropValFormatFlags::Null) const wxOVERRIDE;
-	};
-
 	wxString wxFloatProperty2::ValueToString(wxVariant& value, wxPGPropValFormatFlags flags) const
 	{
 		auto dbl = value.GetDouble();
@@ -1470,4 +1458,174 @@ namespace Alternet::UI
 		auto prop = result.GetProperty();
 		return prop;
 	}
+
+	int PropertyGrid::AppendProperties(int64_t* schema, int schemaCount,
+		const NativeStringSpan& strings, int64_t* results, int resultsCount)
+	{
+		auto stride = PropertyGridBulk::PropertyStride;
+		auto count = std::min(schemaCount / stride, resultsCount);
+		auto texts = StringToArrayString(wxStr(strings));
+		auto propGrid = GetPropGrid();
+
+		propGrid->Freeze();
+
+		for (int i = 0; i < count; i++)
+		{
+			auto record = schema + (size_t)i * stride;
+			auto property = PropertyGridBulk::CreateProperty(record, texts);
+			results[i] = (int64_t)property;
+
+			if (property == nullptr)
+				continue;
+
+			auto parent = record[1];
+			if (parent >= 0 && parent < i && results[parent] != 0)
+				propGrid->AppendIn((wxPGProperty*)results[parent], property);
+			else
+				propGrid->Append(property);
+
+			if (record[2] != 0)
+				property->ChangeFlag((wxPGFlags)record[2], true);
+		}
+
+		propGrid->Thaw();
+		return count;
+	}
+
+	int PropertyGrid::SetPropertyValues(int64_t* values, int valuesCount,
+		const NativeStringSpan& strings)
+	{
+		return SetPropertyValues(values, valuesCount, strings, false);
+	}
+
+	int PropertyGrid::ApplyPropertyValues(int64_t* values, int valuesCount,
+		const NativeStringSpan& strings)
+	{
+		return SetPropertyValues(values, valuesCount, strings, true);
+	}
+
+	int PropertyGrid::SetPropertyValues(int64_t* values, int valuesCount,
+		const NativeStringSpan& strings, bool onlyChanged)
+	{
+		auto stride = PropertyGridBulk::ValueStride;
+		auto count = valuesCount / stride;
+		auto texts = StringToArrayString(wxStr(strings));
+		auto propGrid = GetPropGrid();
+		bool frozen = false;
+		int applied = 0;
+
+		for (int i = 0; i < count; i++)
+		{
+			auto record = values + (size_t)i * stride;
+			auto property = (wxPGProperty*)record[0];
+			if (property == nullptr)
+				continue;
+
+			auto kind = (int)record[1];
+			auto& text = PropertyGridBulk::GetString(texts, record[3]);
+
+			if (onlyChanged && PropertyGridBulk::IsSameValue(property, kind, record[2], text))
+				continue;
+
+			wxVariant value;
+			if (!PropertyGridBulk::ToVariant(kind, record[2], text, value))
+				continue;
+
+			// The grid is frozen on the first changed value, so applying
+			// values which are all unchanged doesn't repaint anything.
+			if (!frozen)
+			{
+				propGrid->Freeze();
+				frozen = true;
+			}
+
+			ToPropArg(property);
+			if (kind == PropertyGridBulk::Unspecified)
+				propGrid->SetPropertyValueUnspecified(_propArg);
+			else if (kind == PropertyGridBulk::Text)
+				propGrid->SetPropertyValueString(_propArg, text);
+			else
+				propGrid->SetPropertyValue(_propArg, value);
+			applied++;
+		}
+
+		if (frozen)
+			propGrid->Thaw();
+		return applied;
+	}
+
+	int PropertyGrid::GetPropertyValues(int64_t* values, int valuesCount)
+	{
+		auto stride = PropertyGridBulk::ValueStride;
+		auto capacity = valuesCount / stride;
+		wxArrayString texts;
+		int count = 0;
+
+		auto it = GetPropGrid()->GetIterator(wxPG_ITERATE_PROPERTIES);
+		for (; !it.AtEnd() && count < capacity; it++, count++)
+		{
+			auto property = *it;
+			auto record = values + (size_t)count * stride;
+
+			int64_t value;
+			wxString text;
+			auto kind = PropertyGridBulk::FromProperty(property, value, text);
+
+			record[0] = (int64_t)property;
+			record[1] = kind;
+			record[2] = value;
+			record[3] = -1;
+
+			if (kind == PropertyGridBulk::Text)
+			{
+				record[3] = texts.size();
+				texts.Add(text);
+			}
+		}
+
+		_valuesText = ArrayStringToString(texts);
+		return count;
+	}
+
+	NativeStringSpan PropertyGrid::GetPropertyValuesText()
+	{
+		return wxStr(_valuesText);
+	}
+
+	NativeStringSpan PropertyGrid::GetEventPropValueInline(int64_t* value, int valueCount)
+	{
+		return PropertyGridBulk::ReadInline(_eventValue->variant, value, valueCount, _container);
+	}
+
+	NativeStringSpan PropertyGrid::GetPropertyValueInline(void* id, int64_t* value, int valueCount)
+	{
+		ToPropArg(id);
+		auto variant = GetPropGrid()->GetPropertyValue(_propArg);
+		return PropertyGridBulk::ReadInline(variant, value, valueCount, _container);
+	}
+
+	void PropertyGrid::SetPropertyValueInline(void* id, int64_t* value, int valueCount,
+		const NativeStringSpan& text)
+	{
+		wxVariant v;
+		if (!PropertyGridBulk::WriteInline(value, valueCount, text, v))
+			return;
+
+		ToPropArg(id);
+		if (v.IsNull())
+			GetPropGrid()->SetPropertyValueUnspecified(_propArg);
+		else
+			GetPropGrid()->SetPropertyValue(_propArg, v);
+	}
+
+	bool PropertyGrid::ChangePropertyValueInline(void* id, int64_t* value, int valueCount,
+		const NativeStringSpan& text)
+	{
+		wxVariant v;
+		if (!PropertyGridBulk::WriteInline(value, valueCount, text, v))
+			return false;
+
+		ToPropArg(id);
+		return GetPropGrid()->ChangePropertyValue(_propArg, v);
+	}
 }
\ No newline at end of file
@@ -19,6 +19,19 @@
 
 namespace Alternet::UI
 {
+    class wxFloatProperty2 : public wxFloatProperty
+    {
+    public:
+        wxFloatProperty2(const wxString& label = wxPG_LABEL,
+            const wxString& name = wxPG_LABEL,
+            double value = 0.0)
+            :wxFloatProperty(label, name, value)
+        {
+        }
+
+        virtual wxString ValueToString(wxVariant& value, wxPGPropValFormatFlags flags = wxPGPropValFormatFlags::Null) const wxOVERRIDE;
+    };
+
     class PropertyGrid : public Control
     {
 #include "Api/PropertyGrid.inc"
@@ -40,6 +53,10 @@ namespace Alternet::UI
         void* _eventProperty = nullptr;
         wxString _eventPropertyName = wxEmptyString;
         wxString _eventValidationFailureMessage = wxEmptyString;
+        wxString _valuesText;
+
+        int SetPropertyValues(int64_t* values, int valuesCount,
+            const NativeStringSpan& strings, bool onlyChanged);
 
         void OnButton(wxCommandEvent& event);
         void FromEventData(PropertyGridEvent evType, wxPropertyGridEvent& event);
@@ -0,0 +1,249 @@
+#include "PropertyGridBulk.h"
+
+namespace Alternet::UI
+{
+    const wxString& PropertyGridBulk::GetString(const wxArrayString& strings, int64_t index)
+    {
+        if (index < 0 || index >= (int64_t)strings.size())
+            return wxEmptyString;
+        return strings[(size_t)index];
+    }
+
+    double PropertyGridBulk::ToDouble(int64_t bits)
+    {
+        double result;
+        memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    int64_t PropertyGridBulk::FromDouble(double value)
+    {
+        int64_t result;
+        memcpy(&result, &value, sizeof(result));
+        return result;
+    }
+
+    wxColour PropertyGridBulk::ToColour(int64_t argb)
+    {
+        return wxColour((unsigned char)(argb >> 16), (unsigned char)(argb >> 8),
+            (unsigned char)argb, (unsigned char)(argb >> 24));
+    }
+
+    int64_t PropertyGridBulk::FromColour(const wxColour& colour)
+    {
+        return ((int64_t)colour.Alpha() << 24) | ((int64_t)colour.Red() << 16)
+            | ((int64_t)colour.Green() << 8) | (int64_t)colour.Blue();
+    }
+
+    wxPGProperty* PropertyGridBulk::CreateProperty(const int64_t* record, const wxArrayString& strings)
+    {
+        auto kind = (int)record[0];
+        auto choices = (PropertyGridChoices*)record[3];
+        auto value = record[4];
+        auto& label = GetString(strings, record[5]);
+        auto& name = GetString(strings, record[6]);
+        auto& text = GetString(strings, record[7]);
+
+        switch (kind)
+        {
+        case Category:
+            return new wxPropertyCategory(label, name);
+        case String:
+            return new wxStringProperty(label, name, text);
+        case LongString:
+            return new wxLongStringProperty(label, name, text);
+        case Bool:
+            return new wxBoolProperty(label, name, value != 0);
+        case Int:
+            return new wxIntProperty(label, name, (long)value);
+        case UInt:
+            return new wxUIntProperty(label, name, (unsigned long)value);
+        case Float:
+            return new wxFloatProperty2(label, name, ToDouble(value));
+        case Date:
+            return new wxDateProperty(label, name, wxDateTime(wxLongLong(value)));
+        case Enum:
+            if (choices == nullptr)
+                return nullptr;
+            return new wxEnumProperty(label, name, choices->choices, (int)value);
+        case EditEnum:
+            if (choices == nullptr)
+                return nullptr;
+            return new wxEditEnumProperty(label, name, choices->choices, text);
+        case Flags:
+            if (choices == nullptr)
+                return nullptr;
+            return new wxFlagsProperty(label, name, choices->choices, (int)value);
+        case Filename:
+            return new wxFileProperty(label, name, text);
+        case Dir:
+            return new wxDirProperty(label, name, text);
+        case ImageFilename:
+            return new wxImageFileProperty(label, name, text);
+        case Color:
+            return new wxAlternetColourProperty(label, name, ToColour(value));
+        case SystemColor:
+            return new wxAlternetSystemColourProperty(label, name,
+                wxColourPropertyValue((uint32_t)record[3], ToColour(value)));
+        case Cursor:
+            return new wxCursorProperty(label, name, (int)value);
+        default:
+            return nullptr;
+        }
+    }
+
+    bool PropertyGridBulk::ToVariant(int kind, int64_t value, const wxString& text, wxVariant& result,
+        uint32_t colourKind)
+    {
+        switch (kind)
+        {
+        case Unspecified:
+            result.MakeNull();
+            return true;
+        case Long:
+            result = wxVariant(wxLongLong(value));
+            return true;
+        case ULong:
+            result = wxVariant(wxULongLong((uint64_t)value));
+            return true;
+        case Double:
+            result = ToDouble(value);
+            return true;
+        case Boolean:
+            result = value != 0;
+            return true;
+        case Text:
+            result = text;
+            return true;
+        case Colour:
+            result << ToColour(value);
+            return true;
+        case DateTime:
+            result = wxDateTime(wxLongLong(value));
+            return true;
+        case SystemColour:
+            result << wxColourPropertyValue(colourKind, ToColour(value));
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    int PropertyGridBulk::FromVariant(const wxVariant& variant, int64_t& value,
+        uint32_t& colourKind, wxString& text)
+    {
+        value = 0;
+        colourKind = wxPG_COLOUR_CUSTOM;
+        text.clear();
+
+        if (variant.IsNull())
+            return Unspecified;
+
+        auto type = variant.GetType();
+
+        if (type == wxPG_VARIANT_TYPE_LONG)
+        {
+            value = variant.GetLong();
+            return Long;
+        }
+        if (type == wxPG_VARIANT_TYPE_LONGLONG)
+        {
+            value = variant.GetLongLong().GetValue();
+            return Long;
+        }
+        if (type == wxPG_VARIANT_TYPE_ULONGLONG)
+        {
+            value = (int64_t)variant.GetULongLong().GetValue();
+            return ULong;
+        }
+        if (type == wxPG_VARIANT_TYPE_DOUBLE)
+        {
+            value = FromDouble(variant.GetDouble());
+            return Double;
+        }
+        if (type == wxPG_VARIANT_TYPE_BOOL)
+        {
+            value = variant.GetBool() ? 1 : 0;
+            return Boolean;
+        }
+        if (type == wxPG_VARIANT_TYPE_STRING)
+        {
+            text = variant.GetString();
+            return Text;
+        }
+        if (type == wxPG_VARIANT_TYPE_DATETIME)
+        {
+            value = variant.GetDateTime().GetValue().GetValue();
+            return DateTime;
+        }
+        if (type == "wxColour")
+        {
+            wxColour colour;
+            colour << variant;
+            value = FromColour(colour);
+            return Colour;
+        }
+        if (type == "wxColourPropertyValue")
+        {
+            wxAny any = variant;
+            auto colour = any.As<wxColourPropertyValue>();
+            value = FromColour(colour.m_colour);
+            colourKind = colour.m_type;
+            return SystemColour;
+        }
+
+        return Complex;
+    }
+
+    int PropertyGridBulk::FromProperty(wxPGProperty* property, int64_t& value, wxString& text)
+    {
+        uint32_t colourKind;
+        auto kind = FromVariant(property->GetValue(), value, colourKind, text);
+
+        // Snapshot records have no place for the color kind, so system
+        // colors are passed as text like other values without a value kind.
+        if (kind == SystemColour || kind == Complex || kind == Text)
+        {
+            value = 0;
+            text = property->GetValueAsString();
+            return Text;
+        }
+
+        return kind;
+    }
+
+    NativeStringSpan PropertyGridBulk::ReadInline(const wxVariant& variant, int64_t* value,
+        int valueCount, wxString& text)
+    {
+        if (valueCount < InlineValueSize)
+            return wxStr(wxEmptyString);
+
+        uint32_t colourKind;
+        value[0] = FromVariant(variant, value[1], colourKind, text);
+        value[2] = colourKind;
+        return wxStr(text);
+    }
+
+    bool PropertyGridBulk::WriteInline(const int64_t* value, int valueCount,
+        const NativeStringSpan& text, wxVariant& result)
+    {
+        if (valueCount < InlineValueSize)
+            return false;
+
+        return ToVariant((int)value[0], value[1], wxStr(text), result, (uint32_t)value[2]);
+    }
+
+    bool PropertyGridBulk::IsSameValue(wxPGProperty* property, int kind, int64_t value,
+        const wxString& text)
+    {
+        int64_t currentValue;
+        wxString currentText;
+        auto currentKind = FromProperty(property, currentValue, currentText);
+
+        if (currentKind != kind)
+            return false;
+        if (kind == Text)
+            return currentText == text;
+        return currentValue == value;
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include "Common.h"
+#include "PropertyGrid.h"
+
+namespace Alternet::UI
+{
+    // Builds and updates properties from packed records, so a whole object
+    // is shown with one call instead of a call per property and attribute.
+    // Strings are passed once as a '\0' separated list and records refer to
+    // them by index, -1 means an empty string.
+    class PropertyGridBulk
+    {
+    public:
+        enum PropertyKind
+        {
+            Category,
+            String,
+            LongString,
+            Bool,
+            Int,
+            UInt,
+            Float,
+            Date,
+            Enum,
+            EditEnum,
+            Flags,
+            Filename,
+            Dir,
+            ImageFilename,
+            Color,
+            SystemColor,
+            Cursor,
+        };
+
+        enum ValueKind
+        {
+            Unspecified,
+            Long,
+            ULong,
+            Double,
+            Boolean,
+            Text,
+            Colour,
+            DateTime,
+            SystemColour,
+            Complex,
+        };
+
+        // Property record: kind, parent record index or -1 for the root,
+        // flags, choices handle (color kind for SystemColor), value
+        // (integer, bool, ARGB color, double bits or Unix time in
+        // milliseconds for Date), label, name and string value indices.
+        static constexpr int PropertyStride = 8;
+
+        // Value record: property handle, value kind, value, string index.
+        // Values of types without a value kind are passed as text.
+        static constexpr int ValueStride = 4;
+
+        // Inline value: value kind, value and color kind for SystemColour.
+        // Text is passed separately. Complex means the value has no inline
+        // form and is read with a PropertyGridVariant.
+        static constexpr int InlineValueSize = 3;
+
+        static wxPGProperty* CreateProperty(const int64_t* record, const wxArrayString& strings);
+        static bool ToVariant(int kind, int64_t value, const wxString& text, wxVariant& result,
+            uint32_t colourKind = wxPG_COLOUR_CUSTOM);
+        static int FromVariant(const wxVariant& variant, int64_t& value, uint32_t& colourKind,
+            wxString& text);
+        static int FromProperty(wxPGProperty* property, int64_t& value, wxString& text);
+        static bool IsSameValue(wxPGProperty* property, int kind, int64_t value, const wxString& text);
+
+        static NativeStringSpan ReadInline(const wxVariant& variant, int64_t* value,
+            int valueCount, wxString& text);
+        static bool WriteInline(const int64_t* value, int valueCount,
+            const NativeStringSpan& text, wxVariant& result);
+
+        static const wxString& GetString(const wxArrayString& strings, int64_t index);
+        static double ToDouble(int64_t bits);
+        static int64_t FromDouble(double value);
+        static wxColour ToColour(int64_t argb);
+        static int64_t FromColour(const wxColour& colour);
+    };
+}
@@ -1,4 +1,5 @@
 #include "PropertyGridVariant.h"
+#include "PropertyGridBulk.h"
 
 namespace Alternet::UI
 {
@@ -228,4 +229,17 @@ namespace Alternet::UI
 		wxVariant v = wxStr(value);
 		FromVariant(handle, v);
 	}
+
+	NativeStringSpan PropertyGridVariant::GetInline(void* handle, int64_t* value, int valueCount)
+	{
+		return PropertyGridBulk::ReadInline(ToVar(handle), value, valueCount, _containerStatic);
+	}
+
+	void PropertyGridVariant::SetInline(void* handle, int64_t* value, int valueCount,
+		const NativeStringSpan& text)
+	{
+		wxVariant v;
+		if (PropertyGridBulk::WriteInline(value, valueCount, text, v))
+			FromVariant(handle, v);
+	}
 }
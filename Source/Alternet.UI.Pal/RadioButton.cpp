@@ -65,11 +65,11 @@ namespace Alternet::UI
         return dynamic_cast<wxRadioButton*>(GetWxWindow());
     }
 
-    void RadioButton::RecreateWxWindowIfNeeded()
+    void RadioButton::RecreateWxWindowCore()
     {
         auto text = GetRadioButton()->GetLabel();
         auto state = GetIsChecked();
-        Control::RecreateWxWindowIfNeeded();
+        Control::RecreateWxWindowCore();
         GetRadioButton()->SetLabel(text);
         SetIsChecked(state);
     }
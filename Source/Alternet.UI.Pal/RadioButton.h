@@ -15,7 +15,7 @@ namespace Alternet::UI
     public:
         NativeStringSpan GetText() override;
         void SetText(const NativeStringSpan& value) override;
-        virtual void RecreateWxWindowIfNeeded() override;
+        virtual void RecreateWxWindowCore() override;
 
     private:
         wxRadioButton* GetRadioButton();
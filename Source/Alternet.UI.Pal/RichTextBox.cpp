@@ -1,7 +1,43 @@
 #include "RichTextBox.h"
 
+#include <wx/wfstream.h>
+
 namespace Alternet::UI
 {
+	namespace
+	{
+		// Counts bytes read by a handler for the load progress and fails
+		// reading when loading is cancelled.
+		class LoadInputStream : public wxFilterInputStream
+		{
+		public:
+			LoadInputStream(wxInputStream* stream, std::atomic<int64_t>& position,
+				const std::atomic<bool>& cancel)
+				: wxFilterInputStream(stream), _position(position), _cancel(cancel)
+			{
+			}
+
+		protected:
+			size_t OnSysRead(void* buffer, size_t size) override
+			{
+				if (_cancel)
+				{
+					m_lasterror = wxSTREAM_READ_ERROR;
+					return 0;
+				}
+
+				auto count = m_parent_i_stream->Read(buffer, size).LastRead();
+				m_lasterror = m_parent_i_stream->GetLastError();
+				_position += count;
+				return count;
+			}
+
+		private:
+			std::atomic<int64_t>& _position;
+			const std::atomic<bool>& _cancel;
+		};
+	}
+
 	class wxRichTextCtrl2 : public wxRichTextCtrl, public wxWidgetExtender
 	{
 	public:
@@ -93,6 +129,12 @@ namespace Alternet::UI
 
 	RichTextBox::~RichTextBox()
 	{
+		_loadTimer.Stop();
+		_loadCancel = true;
+		if (_loadThread.joinable())
+			_loadThread.join();
+		delete _loadBuffer;
+
 		if (IsWxWindowCreated())
 		{
 			auto window = GetWxWindow();
@@ -1569,5 +1611,318 @@ namespace Alternet::UI
 		// wxRichTextBuffer&
 		return nullptr;
 	}
+
+	int RichTextBox::RegisterStyle(void* style)
+	{
+		return _styleTable.Register(wxRichTextAttr(*(wxTextAttr*)style));
+	}
+
+	void RichTextBox::ClearRegisteredStyles()
+	{
+		_styleTable.Clear();
+	}
+
+	void RichTextBox::ApplyStyleRuns(int64_t* runs, int runsCount)
+	{
+		auto textCtrl = GetTextCtrl();
+		auto container = textCtrl->GetFocusObject();
+
+		// Runs are applied to the buffer directly, without undo records and
+		// without layout after each run. The control is laid out once at the end.
+		textCtrl->Freeze();
+		textCtrl->BeginSuppressUndo();
+
+		for (int i = 0; i + 2 < runsCount; i += 3)
+		{
+			auto start = runs[i];
+			auto end = runs[i + 1];
+			auto style = _styleTable.Find(runs[i + 2]);
+
+			if (style == nullptr || end <= start)
+				continue;
+
+			container->SetStyle(wxRichTextRange(start, end - 1), *style,
+				wxRICHTEXT_SETSTYLE_CHARACTERS_ONLY);
+		}
+
+		textCtrl->EndSuppressUndo();
+		textCtrl->LayoutContent();
+		textCtrl->Thaw();
+		textCtrl->Refresh(false);
+	}
+
+	int RichTextBox::GetStyleId(int64_t position)
+	{
+		wxRichTextAttr textAttr;
+
+		if (!GetTextCtrl()->GetStyle(position, textAttr))
+			return -1;
+
+		return TextAttrPool::Intern(textAttr);
+	}
+
+	int RichTextBox::GetStyleIdForRange(int64_t startRange, int64_t endRange)
+	{
+		wxRichTextAttr textAttr;
+
+		if (!GetTextCtrl()->GetStyleForRange(wxRichTextRange(startRange, endRange), textAttr))
+			return -1;
+
+		return TextAttrPool::Intern(textAttr);
+	}
+
+	int RichTextBox::GetStyleIdInContainer(int64_t position, void* container)
+	{
+		wxRichTextAttr textAttr;
+
+		if (!GetTextCtrl()->GetStyle(position, textAttr,
+			(wxRichTextParagraphLayoutBox*)container))
+			return -1;
+
+		return TextAttrPool::Intern(textAttr);
+	}
+
+	int RichTextBox::GetStyleIdForRangeInContainer(int64_t startRange, int64_t endRange,
+		void* container)
+	{
+		wxRichTextAttr textAttr;
+
+		if (!GetTextCtrl()->GetStyleForRange(wxRichTextRange(startRange, endRange), textAttr,
+			(wxRichTextParagraphLayoutBox*)container))
+			return -1;
+
+		return TextAttrPool::Intern(textAttr);
+	}
+
+	bool RichTextBox::SetSearchPattern(const NativeStringSpan& pattern, int options)
+	{
+		return _search.SetPattern(wxStr(pattern), options);
+	}
+
+	int RichTextBox::FindMatches(int64_t start, int64_t* results, int resultsCount, int timeBudgetMs)
+	{
+		return _search.Find(GetTextCtrl(), start, results, resultsCount, timeBudgetMs);
+	}
+
+	int64_t RichTextBox::GetSearchCursor()
+	{
+		return _search.GetCursor();
+	}
+
+	bool RichTextBox::BeginLoadFromStream(void* stream, int type)
+	{
+		if (IsLoading())
+			return false;
+
+		auto handler = wxRichTextBuffer::FindHandler((wxRichTextFileType)type);
+		if (handler == nullptr)
+			return false;
+
+		// Managed streams can be read only during the call and on the UI
+		// thread, so the data is copied here and parsed in the background.
+		InputStream inputStream(stream);
+		ManagedInputStream managedInputStream(&inputStream);
+
+		auto data = new wxMemoryOutputStream();
+		managedInputStream.Read(*data);
+
+		auto length = data->GetLength();
+		auto input = new wxMemoryInputStream(*data);
+		delete data;
+
+		_loadLength = length;
+		_loadFileName = wxEmptyString;
+		return BeginLoad(input, handler);
+	}
+
+	bool RichTextBox::BeginLoadFile(const NativeStringSpan& file, int type)
+	{
+		if (IsLoading())
+			return false;
+
+		auto fileName = wxStr(file);
+		auto handler = wxRichTextBuffer::FindHandlerFilenameOrType(fileName,
+			(wxRichTextFileType)type);
+		if (handler == nullptr)
+			return false;
+
+		auto input = new wxFileInputStream(fileName);
+		if (!input->IsOk())
+		{
+			delete input;
+			return false;
+		}
+
+		_loadLength = input->GetLength();
+		_loadFileName = fileName;
+		return BeginLoad(input, handler);
+	}
+
+	/*static*/ wxRichTextFileHandler* RichTextBox::CreateLoadHandler(wxRichTextFileHandler* handler)
+	{
+		auto classInfo = handler->GetClassInfo();
+		if (classInfo->IsDynamic())
+		{
+			auto result = wxDynamicCast(classInfo->CreateObject(), wxRichTextFileHandler);
+			if (result != nullptr)
+				return result;
+		}
+
+		if (handler->GetType() == wxRICHTEXT_TYPE_TEXT)
+			return new wxRichTextPlainTextHandler();
+
+		return nullptr;
+	}
+
+	bool RichTextBox::BeginLoad(wxInputStream* stream, wxRichTextFileHandler* handler)
+	{
+		// The registered handler can be used on the UI thread while the
+		// worker parses, so flags are set on a private instance.
+		_loadHandler.reset(CreateLoadHandler(handler));
+		if (_loadHandler == nullptr)
+		{
+			delete stream;
+			return false;
+		}
+
+		handler = _loadHandler.get();
+		handler->SetFlags(GetHandlerFlags());
+
+		_loadBuffer = new wxRichTextBuffer();
+
+		// Named styles are imported only into an existing style sheet, like
+		// when loading into the control, so the loaded buffer gets a copy.
+		auto styleSheet = GetTextCtrl()->GetStyleSheet();
+		if (styleSheet != nullptr)
+			_loadBuffer->SetStyleSheet(new wxRichTextStyleSheet(*styleSheet));
+		_loadPosition = 0;
+		_loadCancel = false;
+		_loadFinished = false;
+		_loadResult = false;
+
+		// The handler fills a buffer which is not attached to the control,
+		// so parsing doesn't touch any window. The buffer is moved into the
+		// control on the UI thread when the timer sees the worker finished.
+		auto buffer = _loadBuffer;
+		_loadThread = std::thread([this, stream, handler, buffer]()
+			{
+				LoadInputStream input(stream, _loadPosition, _loadCancel);
+				_loadResult = handler->LoadFile(buffer, input) && !_loadCancel;
+				_loadFinished = true;
+			});
+
+		_loadTimer.Start(LoadTimerInterval);
+		return true;
+	}
+
+	void RichTextBox::OnLoadTimer()
+	{
+		if (!_loadFinished)
+		{
+			RaiseEvent(RichTextBoxEvent::LoadProgress);
+			return;
+		}
+
+		EndLoad();
+		RaiseEvent(RichTextBoxEvent::LoadCompleted);
+	}
+
+	void RichTextBox::EndLoad()
+	{
+		_loadTimer.Stop();
+		_loadThread.join();
+
+		if (_loadResult)
+			ShowLoadedBuffer();
+
+		delete _loadBuffer;
+		_loadBuffer = nullptr;
+		_loadHandler.reset();
+	}
+
+	void RichTextBox::ShowLoadedBuffer()
+	{
+		auto textCtrl = GetTextCtrl();
+		auto& buffer = textCtrl->GetBuffer();
+
+		textCtrl->Freeze();
+
+		// Paragraphs are moved from the loaded buffer instead of copied, so
+		// showing a large document costs the same as showing a small one.
+		buffer.Clear();
+		buffer.GetCommandProcessor()->ClearCommands();
+		buffer.SetBasicStyle(_loadBuffer->GetBasicStyle());
+		buffer.SetDefaultStyle(_loadBuffer->GetDefaultStyle());
+
+		// Copied into the sheet of the control, which may be referenced
+		// by the caller and can't be replaced.
+		auto styleSheet = buffer.GetStyleSheet();
+		auto loadedStyleSheet = _loadBuffer->GetStyleSheet();
+		if (styleSheet != nullptr && loadedStyleSheet != nullptr)
+			*styleSheet = *loadedStyleSheet;
+
+		auto& children = _loadBuffer->GetChildren();
+		while (!children.IsEmpty())
+		{
+			auto node = children.GetFirst();
+			auto child = node->GetData();
+			children.Erase(node);
+			buffer.AppendChild(child);
+		}
+
+		if (buffer.GetChildCount() == 0)
+			buffer.AddParagraph(wxEmptyString);
+
+		buffer.UpdateRanges();
+		buffer.Invalidate(wxRICHTEXT_ALL);
+
+		if (!_loadFileName.IsEmpty())
+			textCtrl->SetFilename(_loadFileName);
+
+		textCtrl->DiscardEdits();
+		textCtrl->SelectNone();
+		textCtrl->SetInsertionPoint(0);
+
+		// Large documents are laid out for the visible part only, the rest
+		// is laid out later by the delayed layout of the control.
+		auto threshold = textCtrl->GetDelayedLayoutThreshold();
+		if (threshold > 0 && buffer.GetOwnRange().GetEnd() > threshold)
+		{
+			textCtrl->SetFullLayoutRequired(true);
+			textCtrl->SetFullLayoutTime(wxGetLocalTimeMillis());
+			textCtrl->SetFullLayoutSavedPosition(0);
+			textCtrl->LayoutContent(true);
+		}
+		else
+			textCtrl->LayoutContent();
+
+		textCtrl->PositionCaret();
+		textCtrl->SetupScrollbars(true);
+		textCtrl->Thaw();
+		textCtrl->Refresh(false);
+	}
+
+	bool RichTextBox::IsLoading()
+	{
+		return _loadThread.joinable();
+	}
+
+	int RichTextBox::GetLoadProgress()
+	{
+		if (_loadLength <= 0)
+			return -1;
+
+		return (int)std::min(_loadPosition * 100 / _loadLength, (int64_t)100);
+	}
+
+	bool RichTextBox::GetLoadResult()
+	{
+		return _loadResult;
+	}
+
+	void RichTextBox::CancelLoad()
+	{
+		_loadCancel = true;
+	}
 }
 
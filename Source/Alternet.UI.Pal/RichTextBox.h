@@ -5,10 +5,16 @@
 #include "Font.h"
 #include "Image.h"
 #include "Control.h"
+#include "TextStyleTable.h"
+#include "TextAttrPool.h"
+#include "TextSearch.h"
 
 #include <wx/richtext/richtextctrl.h>
 #include <wx/richtext/richtexthtml.h>
 
+#include <atomic>
+#include <thread>
+
 #include "Api/InputStream.h"
 #include "Api/OutputStream.h"
 #include "ManagedInputStream.h"
@@ -29,7 +35,41 @@ namespace Alternet::UI
         bool IsCursorSuppressed() override { return true; }
 
     private:
+        class LoadTimer : public wxTimer
+        {
+        public:
+            LoadTimer(RichTextBox* owner) : _owner(owner) {}
+            void Notify() override { _owner->OnLoadTimer(); }
+
+        private:
+            RichTextBox* _owner;
+        };
+
+        static constexpr int LoadTimerInterval = 100;
+
+        bool BeginLoad(wxInputStream* stream, wxRichTextFileHandler* handler);
+        static wxRichTextFileHandler* CreateLoadHandler(wxRichTextFileHandler* handler);
+        void EndLoad();
+        void ShowLoadedBuffer();
+        void OnLoadTimer();
+
         wxString _eventUrl = wxEmptyString;
         bool hasBorder = true;
+        TextStyleTable<wxRichTextAttr> _styleTable;
+        TextSearch _search;
+
+        // Document loaded in the background. The worker thread parses into
+        // _loadBuffer, which is moved into the control on the UI thread.
+        std::thread _loadThread;
+        wxRichTextBuffer* _loadBuffer = nullptr;
+        // Handlers are shared by the process, the worker gets its own one.
+        std::unique_ptr<wxRichTextFileHandler> _loadHandler;
+        LoadTimer _loadTimer { this };
+        wxString _loadFileName;
+        int64_t _loadLength = 0;
+        std::atomic<int64_t> _loadPosition { 0 };
+        std::atomic<bool> _loadCancel { false };
+        std::atomic<bool> _loadFinished { false };
+        std::atomic<bool> _loadResult { false };
     };
 }
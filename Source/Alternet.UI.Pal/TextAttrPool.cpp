@@ -0,0 +1,115 @@
+#include "TextAttrPool.h"
+
+namespace Alternet::UI
+{
+    namespace
+    {
+        uint32_t ToArgb(const wxColour& color)
+        {
+            if (!color.IsOk())
+                return 0;
+            return ((uint32_t)color.Alpha() << 24) | ((uint32_t)color.Red() << 16) |
+                ((uint32_t)color.Green() << 8) | (uint32_t)color.Blue();
+        }
+
+        void HashCombine(size_t& seed, size_t value)
+        {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+    }
+
+    /*static*/ size_t TextAttrPool::GetHash(const wxTextAttr& attr)
+    {
+        size_t result = std::hash<int64_t>()(attr.GetFlags());
+
+        if (attr.HasTextColour())
+            HashCombine(result, ToArgb(attr.GetTextColour()));
+        if (attr.HasBackgroundColour())
+            HashCombine(result, ToArgb(attr.GetBackgroundColour()));
+        if (attr.HasFontSize())
+            HashCombine(result, (size_t)attr.GetFontSize());
+        if (attr.HasFontWeight())
+            HashCombine(result, (size_t)attr.GetFontWeight());
+        if (attr.HasFontItalic())
+            HashCombine(result, (size_t)attr.GetFontStyle());
+        if (attr.HasFontFaceName())
+            HashCombine(result, std::hash<std::wstring>()(attr.GetFontFaceName().ToStdWstring()));
+
+        return result;
+    }
+
+    /*static*/ int TextAttrPool::MakeId(int index)
+    {
+        return (s_generation << IndexBits) | index;
+    }
+
+    /*static*/ int TextAttrPool::Intern(const wxRichTextAttr& attr)
+    {
+        auto hash = GetHash(attr);
+
+        auto range = s_ids.equal_range(hash);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            if (s_attrs[it->second] == attr)
+                return MakeId(it->second);
+        }
+
+        int index = (int)s_attrs.size();
+        if (index > IndexMask)
+            return -1;
+
+        s_attrs.push_back(attr);
+        s_ids.emplace(hash, index);
+        return MakeId(index);
+    }
+
+    /*static*/ const wxRichTextAttr* TextAttrPool::Find(int id)
+    {
+        if (id < 0 || (id >> IndexBits) != s_generation)
+            return nullptr;
+
+        int index = id & IndexMask;
+        if (index >= (int)s_attrs.size())
+            return nullptr;
+        return &s_attrs[index];
+    }
+
+    /*static*/ int TextAttrPool::GetCount()
+    {
+        return (int)s_attrs.size();
+    }
+
+    /*static*/ void TextAttrPool::Clear()
+    {
+        s_ids.clear();
+        s_attrs.clear();
+        s_generation = (s_generation + 1) & GenerationMask;
+    }
+
+    /*static*/ void TextAttrPool::Pack(const wxTextAttr& attr, TextAttrPacked& result)
+    {
+        result.Flags = attr.GetFlags();
+        result.Size = sizeof(TextAttrPacked);
+        result.TextColor = attr.HasTextColour() ? ToArgb(attr.GetTextColour()) : 0;
+        result.BackgroundColor = attr.HasBackgroundColour() ? ToArgb(attr.GetBackgroundColour()) : 0;
+        result.UnderlineColor = ToArgb(attr.GetUnderlineColour());
+        result.FontSize = attr.GetFontSize();
+        result.FontStyle = attr.GetFontStyle();
+        result.FontWeight = attr.GetFontWeight();
+        result.FontFamily = attr.GetFontFamily();
+        result.FontUnderlined = attr.GetFontUnderlined();
+        result.UnderlineType = attr.GetUnderlineType();
+        result.FontStrikethrough = attr.GetFontStrikethrough();
+        result.Alignment = attr.GetAlignment();
+        result.LeftIndent = attr.GetLeftIndent();
+        result.LeftSubIndent = attr.GetLeftSubIndent();
+        result.RightIndent = attr.GetRightIndent();
+        result.ParagraphSpacingBefore = attr.GetParagraphSpacingBefore();
+        result.ParagraphSpacingAfter = attr.GetParagraphSpacingAfter();
+        result.LineSpacing = attr.GetLineSpacing();
+        result.TextEffects = attr.GetTextEffects();
+        result.TextEffectFlags = attr.GetTextEffectFlags();
+        result.BulletStyle = attr.GetBulletStyle();
+        result.OutlineLevel = attr.GetOutlineLevel();
+    }
+}
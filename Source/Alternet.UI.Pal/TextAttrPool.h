@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Common.h"
+
+#include <wx/richtext/richtextctrl.h>
+
+#include <deque>
+#include <unordered_map>
+
+namespace Alternet::UI
+{
+    // Fixed layout of a text attribute read in one call by
+    // TextBoxTextAttr::ReadPacked. Colors are ARGB, zero when the color is not
+    // set; Flags tells which of the other fields are set (wxTEXT_ATTR_*).
+    // Only 32 and 64 bit fields are used, so the layout has no padding.
+    struct TextAttrPacked
+    {
+        int64_t Flags;
+        int32_t Size;
+        uint32_t TextColor;
+        uint32_t BackgroundColor;
+        uint32_t UnderlineColor;
+        int32_t FontSize;
+        int32_t FontStyle;
+        int32_t FontWeight;
+        int32_t FontFamily;
+        int32_t FontUnderlined;
+        int32_t UnderlineType;
+        int32_t FontStrikethrough;
+        int32_t Alignment;
+        int32_t LeftIndent;
+        int32_t LeftSubIndent;
+        int32_t RightIndent;
+        int32_t ParagraphSpacingBefore;
+        int32_t ParagraphSpacingAfter;
+        int32_t LineSpacing;
+        int32_t TextEffects;
+        int32_t TextEffectFlags;
+        int32_t BulletStyle;
+        int32_t OutlineLevel;
+    };
+
+    static_assert(sizeof(TextAttrPacked) == 96, "TextAttrPacked layout is shared with managed code.");
+
+    // Process-wide pool of immutable text attributes. Equal attributes are
+    // stored once and identified by a stable id; pooled attributes are owned by
+    // the pool and must not be deleted or changed by callers. The pool never
+    // evicts, it grows with the number of distinct attributes. Ids carry the
+    // generation of the pool, so after Clear old ids are not found instead of
+    // resolving to other attributes. Pointers returned by Find are freed by
+    // Clear and must not be used after it.
+    class TextAttrPool
+    {
+    public:
+        static int Intern(const wxRichTextAttr& attr);
+        static const wxRichTextAttr* Find(int id);
+
+        static int GetCount();
+        static void Clear();
+
+        static void Pack(const wxTextAttr& attr, TextAttrPacked& result);
+
+    private:
+        static constexpr int IndexBits = 24;
+        static constexpr int IndexMask = (1 << IndexBits) - 1;
+        static constexpr int GenerationMask = 0x7F;
+
+        static size_t GetHash(const wxTextAttr& attr);
+        static int MakeId(int index);
+
+        inline static std::deque<wxRichTextAttr> s_attrs;
+        inline static std::unordered_multimap<size_t, int> s_ids;
+        inline static int s_generation = 0;
+    };
+}
@@ -19,25 +19,29 @@ namespace Alternet::UI
 					window->Unbind(wxEVT_TEXT_ENTER, &TextBox::OnTextEnter, this);
 				window->Unbind(wxEVT_TEXT_URL, &TextBox::OnTextUrl, this);
 				window->Unbind(wxEVT_TEXT_MAXLEN, &TextBox::OnTextMaxLength, this);
+				if (_logMode)
+					window->Unbind(wxEVT_IDLE, &TextBox::OnLogIdle, this);
 			}
 		}
 	}
 
-	void TextBox::RecreateWxWindowIfNeeded()
+	void TextBox::RecreateWxWindowCore()
 	{
 		auto text = GetTextCtrl()->GetValue();
-		Control::RecreateWxWindowIfNeeded();
+		Control::RecreateWxWindowCore();
 		GetTextCtrl()->SetValue(text);
 	}
 	
 	NativeStringSpan TextBox::GetText()
 	{
+		FlushLog();
 		_textValue = GetTextCtrl()->GetValue();
 		return wxStr(_textValue);
 	}
 
 	void TextBox::SetText(const NativeStringSpan& value)
 	{
+		_logPending.clear();
 		GetTextCtrl()->SetValue(wxStr(value));
 	}
 
@@ -100,6 +104,8 @@ namespace Alternet::UI
 			textCtrl->Bind(wxEVT_TEXT_ENTER, &TextBox::OnTextEnter, this);
 		textCtrl->Bind(wxEVT_TEXT_URL, &TextBox::OnTextUrl, this);
 		textCtrl->Bind(wxEVT_TEXT_MAXLEN, &TextBox::OnTextMaxLength, this);
+		if (_logMode)
+			textCtrl->Bind(wxEVT_IDLE, &TextBox::OnLogIdle, this);
 
 		_allowDoubleBuffered = false;
 		_flags.Set(ControlFlags::UserPaint, false);
@@ -427,27 +433,32 @@ namespace Alternet::UI
 
 	bool TextBox::GetIsEmpty()
 	{
+		FlushLog();
 		return GetTextCtrl()->IsEmpty();
 	}
 
 	int TextBox::GetLineLength(int64_t lineNo)
 	{
+		FlushLog();
 		return GetTextCtrl()->GetLineLength(lineNo);
 	}
 
 	NativeStringSpan TextBox::GetLineText(int64_t lineNo)
 	{
+		FlushLog();
 		_container = GetTextCtrl()->GetLineText(lineNo);
 		return wxStr(_container);
 	}
 
 	int TextBox::GetNumberOfLines()
 	{
+		FlushLog();
 		return GetTextCtrl()->GetNumberOfLines();
 	}
 
 	Int32Point TextBox::PositionToXY(int64_t pos)
 	{
+		FlushLog();
 		long x;
 		long y;
 		auto result = GetTextCtrl()->PositionToXY(pos, &x, &y);
@@ -469,11 +480,13 @@ namespace Alternet::UI
 
 	int64_t TextBox::XYToPosition(int64_t x, int64_t y)
 	{
+		FlushLog();
 		return GetTextCtrl()->XYToPosition(x, y);
 	}
 
 	void TextBox::Clear()
 	{
+		_logPending.clear();
 		GetTextCtrl()->Clear();
 	}
 
@@ -489,11 +502,184 @@ namespace Alternet::UI
 
 	void TextBox::AppendText(const NativeStringSpan& text)
 	{
-		GetTextCtrl()->AppendText(wxStr(text));
+		if (!_logMode)
+		{
+			GetTextCtrl()->AppendText(wxStr(text));
+			return;
+		}
+
+		if (_logPending.empty())
+		{
+			_logPendingSince = std::chrono::steady_clock::now();
+			wxWakeUpIdle();
+		}
+
+		_logPending += wxStr(text);
+
+		// Idle events don't come while the application is busy, so pending
+		// text is also flushed when there is too much of it or it is too old.
+		if (_logPending.length() >= LogMaxPendingLength ||
+			std::chrono::steady_clock::now() - _logPendingSince >= LogMaxPendingTime)
+		{
+			FlushLog();
+		}
+	}
+
+	void TextBox::OnLogIdle(wxIdleEvent& event)
+	{
+		event.Skip();
+		FlushLog();
+	}
+
+	bool TextBox::GetLogMode()
+	{
+		return _logMode;
+	}
+
+	void TextBox::SetLogMode(bool value)
+	{
+		if (_logMode == value)
+			return;
+
+		if (!value)
+			FlushLog();
+		_logMode = value;
+
+		if (!IsWxWindowCreated())
+			return;
+
+		// Pending text is flushed on idle, other text boxes don't get idle
+		// events.
+		auto window = GetWxWindow();
+		if (value)
+			window->Bind(wxEVT_IDLE, &TextBox::OnLogIdle, this);
+		else
+			window->Unbind(wxEVT_IDLE, &TextBox::OnLogIdle, this);
+	}
+
+	void TextBox::SetLogLimits(int maxLines, int64_t maxLength)
+	{
+		_logMaxLines = maxLines;
+		_logMaxLength = maxLength;
+	}
+
+	void TextBox::FlushLog()
+	{
+		if (_logPending.empty() || IsNullOrDeleting() || !IsWxWindowCreated())
+			return;
+
+		wxString text;
+		text.swap(_logPending);
+
+		auto textCtrl = GetTextCtrl();
+
+		long selectionStart, selectionEnd;
+		textCtrl->GetSelection(&selectionStart, &selectionEnd);
+
+		// The view follows the appended text only when the caret was at the end.
+		auto follow = selectionStart == selectionEnd &&
+			selectionEnd == textCtrl->GetLastPosition();
+
+#ifdef __WXMSW__
+		auto hwnd = (HWND)textCtrl->GetHWND();
+		auto firstVisibleLine = (long)::SendMessage(hwnd, EM_GETFIRSTVISIBLELINE, 0, 0);
+#endif
+
+		textCtrl->Freeze();
+		textCtrl->AppendText(text);
+
+		long removedLines = 0;
+		auto removed = TrimLog(removedLines);
+
+		if (follow)
+		{
+			textCtrl->SetInsertionPointEnd();
+			textCtrl->ShowPosition(textCtrl->GetLastPosition());
+		}
+		else
+		{
+			selectionStart = std::max(selectionStart - removed, 0L);
+			selectionEnd = std::max(selectionEnd - removed, 0L);
+			textCtrl->SetSelection(selectionStart, selectionEnd);
+
+#ifdef __WXMSW__
+			auto line = (long)::SendMessage(hwnd, EM_GETFIRSTVISIBLELINE, 0, 0);
+			auto wantedLine = std::max(firstVisibleLine - removedLines, 0L);
+			::SendMessage(hwnd, EM_LINESCROLL, 0, wantedLine - line);
+#else
+			textCtrl->ShowPosition(selectionStart);
+#endif
+		}
+
+		textCtrl->Thaw();
+	}
+
+	bool TextBox::SetSearchPattern(const NativeStringSpan& pattern, int options)
+	{
+		return _search.SetPattern(wxStr(pattern), options);
+	}
+
+	int TextBox::FindMatches(int64_t start, int64_t* results, int resultsCount, int timeBudgetMs)
+	{
+		FlushLog();
+		return _search.Find(GetTextCtrl(), start, results, resultsCount, timeBudgetMs);
+	}
+
+	int64_t TextBox::GetSearchCursor()
+	{
+		return _search.GetCursor();
+	}
+
+	long TextBox::TrimLog(long& removedLines)
+	{
+		auto textCtrl = GetTextCtrl();
+		long removeTo = 0;
+
+		if (_logMaxLines > 0)
+		{
+			auto lines = textCtrl->GetNumberOfLines();
+			if (lines > _logMaxLines)
+			{
+				removedLines = lines - _logMaxLines;
+				removeTo = textCtrl->XYToPosition(0, removedLines);
+			}
+		}
+
+		if (_logMaxLength > 0)
+		{
+			auto last = textCtrl->GetLastPosition();
+			if (last - removeTo > _logMaxLength)
+			{
+				// Text is removed by whole lines, unless the last line alone
+				// is longer than the limit.
+				long x, y;
+				textCtrl->PositionToXY(last - _logMaxLength, &x, &y);
+
+				auto line = x == 0 ? y : y + 1;
+				auto lineStart = textCtrl->XYToPosition(0, line);
+
+				if (lineStart < 0)
+				{
+					removedLines = y;
+					removeTo = last - _logMaxLength;
+				}
+				else
+				{
+					removedLines = line;
+					removeTo = lineStart;
+				}
+			}
+		}
+
+		if (removeTo > 0)
+			textCtrl->Remove(0, removeTo);
+
+		return removeTo;
 	}
 
 	int64_t TextBox::GetInsertionPoint()
 	{
+		FlushLog();
 		return GetTextCtrl()->GetInsertionPoint();
 	}
 
@@ -559,12 +745,14 @@ namespace Alternet::UI
 
 	NativeStringSpan TextBox::GetRange(int64_t from, int64_t to)
 	{
+		FlushLog();
 		_container = GetTextCtrl()->GetRange(from, to);
 		return wxStr(_container);
 	}
 
 	NativeStringSpan TextBox::GetStringSelection()
 	{
+		FlushLog();
 		_container = GetTextCtrl()->GetStringSelection();
 		return wxStr(_container);
 	}
@@ -576,11 +764,13 @@ namespace Alternet::UI
 
 	bool TextBox::IsValidPosition(int64_t pos)
 	{
+		FlushLog();
 		return pos >= 0 && pos <= GetTextCtrl()->GetLastPosition();
 	}
 
 	int64_t TextBox::GetLastPosition()
 	{
+		FlushLog();
 		return GetTextCtrl()->GetLastPosition();
 	}
 
@@ -653,4 +843,35 @@ namespace Alternet::UI
 		return from != to;
 	}
 
+	int TextBox::RegisterStyle(void* style)
+	{
+		return _styleTable.Register(*(wxTextAttr*)style);
+	}
+
+	void TextBox::ClearRegisteredStyles()
+	{
+		_styleTable.Clear();
+	}
+
+	void TextBox::ApplyStyleRuns(int64_t* runs, int runsCount)
+	{
+		auto textCtrl = GetTextCtrl();
+
+		textCtrl->Freeze();
+
+		for (int i = 0; i + 2 < runsCount; i += 3)
+		{
+			auto start = runs[i];
+			auto end = runs[i + 1];
+			auto style = _styleTable.Find(runs[i + 2]);
+
+			if (style == nullptr || end <= start)
+				continue;
+
+			textCtrl->SetStyle(start, end, *style);
+		}
+
+		textCtrl->Thaw();
+	}
+
 }
@@ -2,6 +2,8 @@
 #include "Common.h"
 #include "ApiTypes.h"
 #include "Control.h"
+#include "TextStyleTable.h"
+#include "TextSearch.h"
 
 namespace Alternet::UI
 {
@@ -17,8 +19,9 @@ namespace Alternet::UI
         void OnTextEnter(wxCommandEvent& event);
         void OnTextUrl(wxTextUrlEvent& event);
         void OnTextMaxLength(wxCommandEvent& event);
+        void OnLogIdle(wxIdleEvent& event);
         TextBox(void* validator);
-        virtual void RecreateWxWindowIfNeeded() override;
+        virtual void RecreateWxWindowCore() override;
 
     protected:
         bool IsCursorSuppressed() override { return true; }
@@ -38,6 +41,21 @@ namespace Alternet::UI
         int _textAlign = 0;
         int _textWrap = 0;
         wxString _eventUrl = wxEmptyString;
+        TextStyleTable<wxTextAttr> _styleTable;
+        TextSearch _search;
+
+        // In log mode appended text is collected here and inserted into the
+        // control in one call on idle, or earlier when too much is pending.
+        static constexpr size_t LogMaxPendingLength = 1024 * 1024;
+        static constexpr std::chrono::milliseconds LogMaxPendingTime{ 100 };
+
+        bool _logMode = false;
+        int _logMaxLines = 0;
+        int64_t _logMaxLength = 0;
+        wxString _logPending;
+        std::chrono::steady_clock::time_point _logPendingSince;
+
+        long TrimLog(long& removedLines);
 
         wxTextCtrl* GetTextCtrl();
 
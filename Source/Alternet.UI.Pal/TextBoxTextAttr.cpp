@@ -444,4 +444,38 @@ namespace Alternet::UI
 	void TextBoxTextAttr::AddFlag(void* attr, int64_t flag)
 	{ return Attr(attr)->AddFlag(flag);}
 
+	int TextBoxTextAttr::InternAttr(void* attr)
+	{
+		return TextAttrPool::Intern(wxRichTextAttr(*Attr(attr)));
+	}
+
+	void* TextBoxTextAttr::GetPooledAttr(int id)
+	{
+		return (void*)TextAttrPool::Find(id);
+	}
+
+	int TextBoxTextAttr::GetPooledAttrCount()
+	{
+		return TextAttrPool::GetCount();
+	}
+
+	void TextBoxTextAttr::ClearAttrPool()
+	{
+		TextAttrPool::Clear();
+	}
+
+	bool TextBoxTextAttr::ReadPacked(void* attr, void* buffer, int bufferSize)
+	{
+		if (attr == nullptr || bufferSize < (int)sizeof(TextAttrPacked))
+			return false;
+
+		TextAttrPool::Pack(*Attr(attr), *(TextAttrPacked*)buffer);
+		return true;
+	}
+
+	bool TextBoxTextAttr::ReadPackedPooledAttr(int id, void* buffer, int bufferSize)
+	{
+		return ReadPacked((void*)TextAttrPool::Find(id), buffer, bufferSize);
+	}
+
 }
@@ -3,6 +3,7 @@
 #include "ApiTypes.h"
 #include "Object.h"
 #include "Font.h"
+#include "TextAttrPool.h"
 
 #include <wx/richtext/richtextctrl.h>
 
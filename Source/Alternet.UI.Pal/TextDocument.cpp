@@ -0,0 +1,280 @@
+#include "TextDocument.h"
+
+namespace Alternet::UI
+{
+    TextDocument::TextDocument()
+    {
+        _lineStarts.push_back(0);
+    }
+
+    TextDocument::~TextDocument()
+    {
+        StopIndexing();
+    }
+
+    bool TextDocument::LoadFile(const wxString& path)
+    {
+        Clear();
+
+        if (!_file.Open(path))
+            return false;
+
+        AddPiece(_file.GetData(), _file.GetSize());
+        return true;
+    }
+
+    void TextDocument::SetText(const std::string& text)
+    {
+        Clear();
+        Append(text);
+    }
+
+    void TextDocument::Append(const std::string& text)
+    {
+        if (text.empty())
+            return;
+
+        _chunks.push_back(text);
+        auto& chunk = _chunks.back();
+        AddPiece(chunk.data(), (int64_t)chunk.length());
+    }
+
+    void TextDocument::Clear()
+    {
+        StopIndexing();
+
+        _pieces.clear();
+        _lineStarts.clear();
+        _lineStarts.push_back(0);
+        _length = 0;
+        _indexedLength = 0;
+
+        _chunks.clear();
+        _file.Close();
+        _version++;
+    }
+
+    void TextDocument::AddPiece(const char* data, int64_t length)
+    {
+        if (length == 0)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pieces.push_back({ data, _length, length });
+            _length += length;
+        }
+
+        _version++;
+
+        if (_indexer.joinable())
+            _indexWake.notify_one();
+        else
+            StartIndexing();
+    }
+
+    void TextDocument::StartIndexing()
+    {
+        _stopIndexing = false;
+        _indexer = std::thread(&TextDocument::IndexLoop, this);
+    }
+
+    void TextDocument::StopIndexing()
+    {
+        if (!_indexer.joinable())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopIndexing = true;
+        }
+
+        _indexWake.notify_one();
+        _indexer.join();
+    }
+
+    void TextDocument::IndexLoop()
+    {
+        std::vector<int64_t> found;
+
+        while (true)
+        {
+            const char* data;
+            int64_t start;
+            int64_t length;
+
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _indexWake.wait(lock, [this]() { return _stopIndexing || _indexedLength < _length; });
+
+                if (_stopIndexing)
+                    return;
+
+                auto& piece = _pieces[FindPiece(_indexedLength)];
+                auto offsetInPiece = _indexedLength - piece.Start;
+
+                data = piece.Data + offsetInPiece;
+                start = _indexedLength;
+                length = std::min(piece.Length - offsetInPiece, IndexChunkSize);
+            }
+
+            // Pieces point to buffers which are not changed or freed while
+            // the indexer runs, so the scan is done without the lock.
+            found.clear();
+
+            auto end = data + length;
+            auto p = data;
+            while ((p = (const char*)memchr(p, '\n', end - p)) != nullptr)
+            {
+                p++;
+                found.push_back(start + (p - data));
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _lineStarts.insert(_lineStarts.end(), found.begin(), found.end());
+                _indexedLength = start + length;
+            }
+
+            _version++;
+        }
+    }
+
+    size_t TextDocument::FindPiece(int64_t offset)
+    {
+        auto it = std::upper_bound(_pieces.begin(), _pieces.end(), offset,
+            [](int64_t value, const Piece& piece) { return value < piece.Start; });
+        return it == _pieces.begin() ? 0 : (size_t)(it - _pieces.begin() - 1);
+    }
+
+    void TextDocument::CopyText(int64_t offset, int64_t length, std::string& result)
+    {
+        result.clear();
+
+        if (offset < 0)
+        {
+            length += offset;
+            offset = 0;
+        }
+
+        length = std::min(length, _length - offset);
+        if (length <= 0)
+            return;
+
+        result.reserve((size_t)length);
+
+        for (auto i = FindPiece(offset); i < _pieces.size() && length > 0; i++)
+        {
+            auto& piece = _pieces[i];
+            auto offsetInPiece = offset - piece.Start;
+            auto count = std::min(piece.Length - offsetInPiece, length);
+
+            result.append(piece.Data + offsetInPiece, (size_t)count);
+            offset += count;
+            length -= count;
+        }
+    }
+
+    int64_t TextDocument::GetLength()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _length;
+    }
+
+    int64_t TextDocument::GetLineCount()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return (int64_t)_lineStarts.size();
+    }
+
+    bool TextDocument::IsIndexing()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _indexedLength < _length;
+    }
+
+    uint64_t TextDocument::GetVersion()
+    {
+        return _version;
+    }
+
+    int64_t TextDocument::GetLineStart(int64_t line)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (line < 0 || line >= (int64_t)_lineStarts.size())
+            return -1;
+        return _lineStarts[(size_t)line];
+    }
+
+    int64_t TextDocument::GetLineEnd(int64_t line)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (line < 0 || line >= (int64_t)_lineStarts.size())
+            return -1;
+
+        auto start = _lineStarts[(size_t)line];
+        int64_t end;
+
+        if (line + 1 < (int64_t)_lineStarts.size())
+        {
+            end = _lineStarts[(size_t)line + 1] - 1;
+
+            std::string last;
+            CopyText(end - 1, 1, last);
+            if (end > start && last == "\r")
+                end--;
+        }
+        else
+            end = _indexedLength;
+
+        return end;
+    }
+
+    int64_t TextDocument::GetLineFromOffset(int64_t offset)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = std::upper_bound(_lineStarts.begin(), _lineStarts.end(), offset);
+        return std::max((int64_t)(it - _lineStarts.begin()) - 1, (int64_t)0);
+    }
+
+    std::string TextDocument::GetText(int64_t offset, int64_t length)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        std::string result;
+        CopyText(offset, length, result);
+        return result;
+    }
+
+    int64_t TextDocument::Find(const std::string& text, int64_t start, bool matchCase)
+    {
+        if (text.empty())
+            return -1;
+
+        // Case-insensitive search folds ASCII letters only, other UTF-8
+        // sequences are compared as is.
+        auto equals = [matchCase](char a, char b)
+        {
+            if (matchCase)
+                return a == b;
+            return tolower((unsigned char)a) == tolower((unsigned char)b);
+        };
+
+        auto length = GetLength();
+        auto overlap = (int64_t)text.length() - 1;
+
+        for (auto position = std::max(start, (int64_t)0); position < length; position += FindChunkSize)
+        {
+            auto chunk = GetText(position, FindChunkSize + overlap);
+            auto it = std::search(chunk.begin(), chunk.end(), text.begin(), text.end(), equals);
+
+            if (it != chunk.end())
+                return position + (it - chunk.begin());
+        }
+
+        return -1;
+    }
+}
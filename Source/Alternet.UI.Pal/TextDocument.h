@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Common.h"
+#include "MappedFile.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Alternet::UI
+{
+    // UTF-8 text stored as a table of pieces over immutable buffers: the
+    // mapped file and the chunks of appended text. Offsets are in bytes.
+    // Line starts are found by a background thread, so lines become available
+    // progressively; GetVersion changes each time more lines are indexed or
+    // the text changes.
+    class TextDocument
+    {
+    public:
+        TextDocument();
+        ~TextDocument();
+
+        bool LoadFile(const wxString& path);
+        void SetText(const std::string& text);
+        void Append(const std::string& text);
+        void Clear();
+
+        int64_t GetLength();
+        int64_t GetLineCount();
+        bool IsIndexing();
+        uint64_t GetVersion();
+
+        int64_t GetLineStart(int64_t line);
+        int64_t GetLineEnd(int64_t line);
+        int64_t GetLineFromOffset(int64_t offset);
+
+        std::string GetText(int64_t offset, int64_t length);
+        int64_t Find(const std::string& text, int64_t start, bool matchCase);
+
+    private:
+        struct Piece
+        {
+            const char* Data;
+            int64_t Start;
+            int64_t Length;
+        };
+
+        static constexpr int64_t IndexChunkSize = 4 * 1024 * 1024;
+        static constexpr int64_t FindChunkSize = 1024 * 1024;
+
+        void AddPiece(const char* data, int64_t length);
+        size_t FindPiece(int64_t offset);
+        void CopyText(int64_t offset, int64_t length, std::string& result);
+        void StartIndexing();
+        void StopIndexing();
+        void IndexLoop();
+
+        MappedFile _file;
+        std::deque<std::string> _chunks;
+
+        std::mutex _mutex;
+        std::condition_variable _indexWake;
+        std::thread _indexer;
+        bool _stopIndexing = false;
+
+        std::vector<Piece> _pieces;
+        std::vector<int64_t> _lineStarts;
+        int64_t _length = 0;
+        int64_t _indexedLength = 0;
+        std::atomic<uint64_t> _version{ 0 };
+    };
+}
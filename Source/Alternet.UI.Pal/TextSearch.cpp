@@ -0,0 +1,342 @@
+#include "TextSearch.h"
+
+#if defined(__WXGTK__)
+#include <gtk/gtk.h>
+#endif
+
+#include <wx/richtext/richtextctrl.h>
+
+namespace Alternet::UI
+{
+    namespace
+    {
+        // Characters read from a plain text control at a time.
+        constexpr int64_t ReadWindowLength = 64 * 1024;
+
+        bool IsWordChar(wxUniChar c)
+        {
+            return wxIsalnum(c) || c == '_';
+        }
+
+        // Reads the text between two positions, character i of the result
+        // is at position from + i. Line breaks of a plain multiline edit
+        // control on MSW are read as "\r\n", they are two positions there.
+        wxString ReadRange(wxTextCtrl* text, int64_t from, int64_t to)
+        {
+#if defined(__WXGTK__)
+            // GetRange of a multiline control copies the whole buffer.
+            if (text->IsMultiLine())
+            {
+                auto buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(text->GetConnectWidget()));
+                GtkTextIter startIter, endIter;
+                gtk_text_buffer_get_iter_at_offset(buffer, &startIter, (gint)from);
+                gtk_text_buffer_get_iter_at_offset(buffer, &endIter, (gint)to);
+
+                auto chars = gtk_text_buffer_get_text(buffer, &startIter, &endIter, TRUE);
+                auto result = wxString::FromUTF8(chars);
+                g_free(chars);
+                return result;
+            }
+#elif defined(__WXMSW__)
+            // GetRange of a plain edit control copies the whole value, its
+            // own buffer is read instead.
+            if (text->IsMultiLine() && !(text->GetWindowStyle() & (wxTE_RICH | wxTE_RICH2)))
+            {
+                auto handle = (HLOCAL)::SendMessage((HWND)text->GetHWND(), EM_GETHANDLE, 0, 0);
+                auto chars = handle != nullptr ? (const wchar_t*)::LocalLock(handle) : nullptr;
+                if (chars != nullptr)
+                {
+                    wxString result(chars + from, (size_t)(to - from));
+                    ::LocalUnlock(handle);
+                    return result;
+                }
+            }
+#endif
+            return text->GetRange((long)from, (long)to);
+        }
+    }
+
+    bool TextSearch::SetPattern(const wxString& pattern, int options)
+    {
+        _pattern = pattern;
+        _options = options;
+        _cursor = -1;
+
+        if (options & Regex)
+        {
+            auto flags = wxRE_ADVANCED;
+            if (!(options & MatchCase))
+                flags |= wxRE_ICASE;
+            _isOk = !pattern.IsEmpty() && _regex.Compile(pattern, flags);
+        }
+        else
+            _isOk = !pattern.IsEmpty();
+
+        return _isOk;
+    }
+
+    bool TextSearch::IsWholeWord(const wxString& line, size_t begin, size_t end,
+        size_t start, size_t length)
+    {
+        if (start > begin && IsWordChar(line[start - 1]))
+            return false;
+
+        auto matchEnd = start + length;
+        return matchEnd >= end || !IsWordChar(line[matchEnd]);
+    }
+
+    bool TextSearch::FindInLine(const wxString& line, size_t begin, size_t end, size_t from,
+        size_t& start, size_t& length)
+    {
+        auto wholeWord = (_options & WholeWord) != 0;
+
+        if (_options & Regex)
+        {
+            while (from <= end)
+            {
+                if (!_regex.Matches(line.wx_str() + from, from > begin ? wxRE_NOTBOL : 0, end - from))
+                    return false;
+
+                size_t matchStart, matchLength;
+                _regex.GetMatch(&matchStart, &matchLength);
+                matchStart += from;
+
+                if (!wholeWord || IsWholeWord(line, begin, end, matchStart, matchLength))
+                {
+                    start = matchStart;
+                    length = matchLength;
+                    return true;
+                }
+
+                from = matchStart + 1;
+            }
+
+            return false;
+        }
+
+        auto matchCase = (_options & MatchCase) != 0;
+        auto equals = [matchCase](wxUniChar a, wxUniChar b)
+        {
+            return matchCase ? a == b : wxTolower(a) == wxTolower(b);
+        };
+
+        auto lineEnd = line.begin() + end;
+
+        while (from + _pattern.length() <= end)
+        {
+            auto it = std::search(line.begin() + from, lineEnd,
+                _pattern.begin(), _pattern.end(), equals);
+            if (it == lineEnd)
+                return false;
+
+            auto matchStart = (size_t)(it - line.begin());
+
+            if (!wholeWord || IsWholeWord(line, begin, end, matchStart, _pattern.length()))
+            {
+                start = matchStart;
+                length = _pattern.length();
+                return true;
+            }
+
+            from = matchStart + 1;
+        }
+
+        return false;
+    }
+
+    bool TextSearch::FindAllInLine(const wxString& line, size_t begin, size_t end,
+        int64_t textStart, size_t from, int64_t* results, int resultsCount, int& found)
+    {
+        size_t matchStart, matchLength;
+
+        while (FindInLine(line, begin, end, from, matchStart, matchLength))
+        {
+            if ((found + 1) * 2 > resultsCount)
+            {
+                _cursor = textStart + matchStart;
+                return false;
+            }
+
+            results[found * 2] = textStart + matchStart;
+            results[found * 2 + 1] = matchLength;
+            found++;
+
+            from = matchStart + std::max(matchLength, (size_t)1);
+        }
+
+        return true;
+    }
+
+    int TextSearch::Find(wxTextCtrl* text, int64_t start, int64_t* results,
+        int resultsCount, int timeBudgetMs)
+    {
+        _cursor = -1;
+
+        if (!_isOk)
+            return 0;
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeBudgetMs);
+
+        // Lines of a multiline control on MSW are wrapped display lines, so
+        // the text is read in windows and split into paragraphs here.
+        auto last = (int64_t)text->GetLastPosition();
+        start = std::min(std::max(start, (int64_t)0), last);
+
+        // The search starts at the line break before the start, so a resumed
+        // search reads only the rest of the text.
+        auto position = start;
+        while (position > 0)
+        {
+            auto from = std::max(position - ReadWindowLength, (int64_t)0);
+            auto window = ReadRange(text, from, position);
+            auto lineBreak = window.rfind('\n');
+            if (lineBreak != wxString::npos)
+            {
+                position = from + (int64_t)lineBreak + 1;
+                break;
+            }
+            position = from;
+        }
+
+        int found = 0;
+
+        // Searches the line between begin and end of the text, which starts
+        // at textStart. Returns false when the search stops.
+        auto searchLine = [&](const wxString& line, size_t begin, size_t end,
+            int64_t textStart, int64_t nextLineStart)
+        {
+            if (end > begin && line[end - 1] == '\r')
+                end--;
+
+            auto from = begin + (size_t)std::max(start - (textStart + (int64_t)begin), (int64_t)0);
+
+            if (!FindAllInLine(line, begin, end, textStart, from, results, resultsCount, found))
+                return false;
+
+            if (nextLineStart >= 0 && timeBudgetMs > 0 && std::chrono::steady_clock::now() >= deadline)
+            {
+                _cursor = nextLineStart;
+                return false;
+            }
+
+            return true;
+        };
+
+        // Lines are searched in place in the window, only a line which
+        // continues in the next window is collected. Matches don't span
+        // line breaks.
+        wxString carried;
+        int64_t carriedStart = position;
+
+        while (position < last)
+        {
+            auto window = ReadRange(text, position, std::min(position + ReadWindowLength, last));
+            if (window.IsEmpty())
+                break;
+
+            size_t begin = 0;
+            while (true)
+            {
+                auto lineEnd = window.find('\n', begin);
+                if (lineEnd == wxString::npos)
+                {
+                    if (carried.IsEmpty())
+                        carriedStart = position + (int64_t)begin;
+                    carried.append(window, begin, wxString::npos);
+                    break;
+                }
+
+                auto nextLineStart = position + (int64_t)lineEnd + 1;
+
+                if (carried.IsEmpty())
+                {
+                    if (!searchLine(window, begin, lineEnd, position, nextLineStart))
+                        return found;
+                }
+                else
+                {
+                    carried.append(window, begin, lineEnd - begin);
+                    if (!searchLine(carried, 0, carried.length(), carriedStart, nextLineStart))
+                        return found;
+                    carried.clear();
+                }
+
+                begin = lineEnd + 1;
+            }
+
+            position += (int64_t)window.length();
+        }
+
+        if (carried.IsEmpty())
+            carriedStart = position;
+        searchLine(carried, 0, carried.length(), carriedStart, -1);
+
+        return found;
+    }
+
+    int TextSearch::Find(wxRichTextCtrl* text, int64_t start, int64_t* results,
+        int resultsCount, int timeBudgetMs)
+    {
+        _cursor = -1;
+
+        if (!_isOk)
+            return 0;
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeBudgetMs);
+
+        auto& buffer = text->GetBuffer();
+        auto node = buffer.GetChildren().GetFirst();
+
+        if (start > 0)
+        {
+            auto paragraph = buffer.GetParagraphAtPosition((long)start);
+            if (paragraph == nullptr)
+                return 0;
+            node = buffer.GetChildren().Find(paragraph);
+        }
+
+        int found = 0;
+
+        // Paragraphs are walked once and read one by one, so a search never
+        // holds more than one paragraph of the text. Matches don't span
+        // paragraphs.
+        for (; node; node = node->GetNext())
+        {
+            auto paragraph = wxDynamicCast(node->GetData(), wxRichTextParagraph);
+            if (paragraph == nullptr)
+                continue;
+
+            auto range = paragraph->GetRange();
+            auto lineStart = (int64_t)range.GetStart();
+
+            // Objects without text, like images and fields, are replaced
+            // with U+FFFC of their length so the offsets stay exact.
+            wxString line;
+            for (auto childNode = paragraph->GetChildren().GetFirst(); childNode;
+                childNode = childNode->GetNext())
+            {
+                auto child = childNode->GetData();
+                auto childRange = child->GetRange();
+                auto childText = child->GetTextForRange(childRange);
+                if ((long)childText.length() != childRange.GetLength())
+                    childText = wxString(wxUniChar(0xFFFC), (size_t)std::max(childRange.GetLength(), 0L));
+                line += childText;
+            }
+
+            auto from = (size_t)std::max(start - lineStart, (int64_t)0);
+
+            if (!FindAllInLine(line, 0, line.length(), lineStart, from, results, resultsCount, found))
+                return found;
+
+            if (timeBudgetMs > 0 && std::chrono::steady_clock::now() >= deadline)
+            {
+                auto next = node->GetNext();
+                if (next)
+                    _cursor = next->GetData()->GetRange().GetStart();
+                return found;
+            }
+        }
+
+        return found;
+    }
+}
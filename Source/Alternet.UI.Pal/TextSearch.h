@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Common.h"
+
+#include <wx/regex.h>
+
+class wxRichTextCtrl;
+
+namespace Alternet::UI
+{
+    // Finds text in the paragraphs of a text control. Paragraphs of a rich
+    // text control are read one at a time from its buffer, a plain text
+    // control is read in windows from the line of the start position and
+    // its lines are searched in place. Matches are reported as (position,
+    // length) pairs; a search which stops because the result buffer is full
+    // or the time budget is over can be continued from GetCursor.
+    class TextSearch
+    {
+    public:
+        enum Options
+        {
+            MatchCase = 1,
+            WholeWord = 2,
+            Regex = 4,
+        };
+
+        bool SetPattern(const wxString& pattern, int options);
+
+        int Find(wxTextCtrl* text, int64_t start, int64_t* results,
+            int resultsCount, int timeBudgetMs);
+        int Find(wxRichTextCtrl* text, int64_t start, int64_t* results,
+            int resultsCount, int timeBudgetMs);
+
+        int64_t GetCursor() const { return _cursor; }
+
+    private:
+        // The line is the part of the text between begin and end, positions
+        // are indexes in the text.
+        bool FindInLine(const wxString& line, size_t begin, size_t end, size_t from,
+            size_t& start, size_t& length);
+        // Returns false when the results are full, the cursor is then set.
+        bool FindAllInLine(const wxString& line, size_t begin, size_t end, int64_t textStart,
+            size_t from, int64_t* results, int resultsCount, int& found);
+        bool IsWholeWord(const wxString& line, size_t begin, size_t end,
+            size_t start, size_t length);
+
+        wxString _pattern;
+        int _options = 0;
+        wxRegEx _regex;
+        bool _isOk = false;
+        int64_t _cursor = -1;
+    };
+}
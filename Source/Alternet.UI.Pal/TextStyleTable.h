@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Common.h"
+
+namespace Alternet::UI
+{
+    // Small table of text styles registered once and then referenced by index
+    // from style runs. Registering an attribute equal to an already registered
+    // one returns the existing index.
+    template<typename TAttr>
+    class TextStyleTable
+    {
+    public:
+        int Register(const TAttr& style)
+        {
+            for (size_t i = 0; i < _styles.size(); i++)
+            {
+                if (_styles[i] == style)
+                    return (int)i;
+            }
+
+            _styles.push_back(style);
+            return (int)_styles.size() - 1;
+        }
+
+        void Clear()
+        {
+            _styles.clear();
+        }
+
+        const TAttr* Find(int64_t id) const
+        {
+            if (id < 0 || id >= (int64_t)_styles.size())
+                return nullptr;
+            return &_styles[(size_t)id];
+        }
+
+    private:
+        std::vector<TAttr> _styles;
+    };
+}
@@ -0,0 +1,759 @@
+#include "TextViewer.h"
+
+namespace Alternet::UI
+{
+    namespace
+    {
+        // Decodes one UTF-8 sequence. Invalid bytes are decoded one by one
+        // as U+FFFD.
+        int DecodeUtf8(const char* text, int length, wxUint32& codePoint)
+        {
+            auto lead = (unsigned char)text[0];
+
+            int count;
+            if (lead < 0x80)
+            {
+                codePoint = lead;
+                return 1;
+            }
+            else if ((lead & 0xE0) == 0xC0)
+            {
+                codePoint = lead & 0x1F;
+                count = 2;
+            }
+            else if ((lead & 0xF0) == 0xE0)
+            {
+                codePoint = lead & 0x0F;
+                count = 3;
+            }
+            else if ((lead & 0xF8) == 0xF0)
+            {
+                codePoint = lead & 0x07;
+                count = 4;
+            }
+            else
+                count = 0;
+
+            if (count == 0 || count > length)
+            {
+                codePoint = 0xFFFD;
+                return 1;
+            }
+
+            for (int i = 1; i < count; i++)
+            {
+                auto next = (unsigned char)text[i];
+                if ((next & 0xC0) != 0x80)
+                {
+                    codePoint = 0xFFFD;
+                    return 1;
+                }
+                codePoint = (codePoint << 6) | (next & 0x3F);
+            }
+
+            return count;
+        }
+
+        std::string ToUtf8(const NativeStringSpan& text)
+        {
+            auto buffer = wxStr(text).utf8_str();
+            return std::string(buffer.data(), buffer.length());
+        }
+    }
+
+    class wxTextViewer2 : public wxWindow, public wxWidgetExtender
+    {
+    public:
+        wxTextViewer2() {}
+        wxTextViewer2(wxWindow* parent, long style)
+        {
+            Create(parent, wxID_ANY, wxDefaultPosition, wxDefaultSize, style);
+        }
+
+        virtual bool AcceptsFocus() const override { return true; }
+        virtual bool AcceptsFocusFromKeyboard() const override { return true; }
+    };
+
+    TextViewer::TextViewer()
+    {
+        _flags.Set(ControlFlags::UserPaint, true);
+    }
+
+    TextViewer::~TextViewer()
+    {
+        _indexTimer.Stop();
+    }
+
+    wxWindow* TextViewer::CreateWxWindowUnparented()
+    {
+        return new wxTextViewer2();
+    }
+
+    wxWindow* TextViewer::CreateWxWindowCore(wxWindow* parent)
+    {
+        auto style = GetDefaultStyle() | wxVSCROLL | wxHSCROLL | wxWANTS_CHARS;
+        return new wxTextViewer2(parent, style);
+    }
+
+    void TextViewer::OnWxWindowCreated()
+    {
+        Control::OnWxWindowCreated();
+
+        auto window = GetWxWindow();
+
+        for (auto eventType : { wxEVT_SCROLLWIN_TOP, wxEVT_SCROLLWIN_BOTTOM,
+            wxEVT_SCROLLWIN_LINEUP, wxEVT_SCROLLWIN_LINEDOWN,
+            wxEVT_SCROLLWIN_PAGEUP, wxEVT_SCROLLWIN_PAGEDOWN,
+            wxEVT_SCROLLWIN_THUMBTRACK, wxEVT_SCROLLWIN_THUMBRELEASE })
+        {
+            window->Bind(eventType, &TextViewer::OnViewerScroll, this);
+        }
+
+        window->Bind(wxEVT_LEFT_DOWN, &TextViewer::OnViewerMouseDown, this);
+        window->Bind(wxEVT_MOTION, &TextViewer::OnViewerMouseMove, this);
+        window->Bind(wxEVT_KEY_DOWN, &TextViewer::OnViewerKeyDown, this);
+        window->Bind(wxEVT_TIMER, &TextViewer::OnIndexTimer, this);
+
+        _indexTimer.SetOwner(window);
+
+        UpdateMetrics();
+        UpdateScrollBars();
+        StartIndexTimer();
+    }
+
+    void TextViewer::OnBeforeDestroyWxWindow()
+    {
+        _indexTimer.Stop();
+        Control::OnBeforeDestroyWxWindow();
+    }
+
+    wxGraphicsContext* TextViewer::CreateMeasuringContext()
+    {
+        auto context = wxGraphicsRenderer::GetDefaultRenderer()->CreateMeasuringContext();
+        context->SetFont(GetWxWindow()->GetFont(), *wxBLACK);
+        return context;
+    }
+
+    void TextViewer::UpdateMetrics()
+    {
+        std::unique_ptr<wxGraphicsContext> context(CreateMeasuringContext());
+
+        wxDouble width, height;
+        context->GetTextExtent("Ag", &width, &height);
+        _lineHeight = std::max((int)std::ceil(height), 1);
+    }
+
+    int TextViewer::GetVisibleLineCount()
+    {
+        if (!IsWxWindowCreated())
+            return 0;
+        return std::max(GetWxWindow()->GetClientSize().y / _lineHeight, 1);
+    }
+
+    bool TextViewer::IsLastLineVisible()
+    {
+        return _firstLine + GetVisibleLineCount() >= _document.GetLineCount();
+    }
+
+    void TextViewer::UpdateScrollBars()
+    {
+        if (!IsWxWindowCreated())
+            return;
+
+        auto window = GetWxWindow();
+        auto version = _document.GetVersion();
+        auto lineCount = _document.GetLineCount();
+        auto clientWidth = window->GetClientSize().x;
+
+        window->SetScrollbar(wxVERTICAL, (int)_firstLine, GetVisibleLineCount(),
+            (int)std::min(lineCount, (int64_t)INT_MAX));
+        window->SetScrollbar(wxHORIZONTAL, _horizontalOffset, clientWidth,
+            _maxLineWidth + _lineHeight);
+
+        _shownVersion = version;
+    }
+
+    void TextViewer::StartIndexTimer()
+    {
+        if (!IsWxWindowCreated() || _indexTimer.IsRunning())
+            return;
+
+        if (_document.IsIndexing() || _shownVersion != _document.GetVersion())
+            _indexTimer.Start(100);
+    }
+
+    void TextViewer::OnIndexTimer(wxTimerEvent& event)
+    {
+        if (IsNullOrDeleting())
+            return;
+
+        auto indexing = _document.IsIndexing();
+
+        if (_shownVersion != _document.GetVersion())
+        {
+            UpdateScrollBars();
+
+            if (_followEnd)
+                SetFirstLine(_document.GetLineCount());
+
+            GetWxWindow()->Refresh(false);
+        }
+
+        if (!indexing)
+            _indexTimer.Stop();
+    }
+
+    void TextViewer::SetFirstLine(int64_t line)
+    {
+        auto lastFirstLine = _document.GetLineCount() - GetVisibleLineCount();
+        line = std::max(std::min(line, lastFirstLine), (int64_t)0);
+
+        if (line == _firstLine)
+            return;
+
+        _firstLine = line;
+
+        if (IsWxWindowCreated())
+        {
+            GetWxWindow()->SetScrollPos(wxVERTICAL, (int)_firstLine);
+            GetWxWindow()->Refresh(false);
+        }
+    }
+
+    void TextViewer::SetHorizontalOffset(int offset)
+    {
+        if (!IsWxWindowCreated())
+            return;
+
+        auto maxOffset = _maxLineWidth + _lineHeight - GetWxWindow()->GetClientSize().x;
+        offset = std::max(std::min(offset, maxOffset), 0);
+
+        if (offset == _horizontalOffset)
+            return;
+
+        _horizontalOffset = offset;
+        GetWxWindow()->SetScrollPos(wxHORIZONTAL, _horizontalOffset);
+        GetWxWindow()->Refresh(false);
+    }
+
+    void TextViewer::LayoutLine(int64_t line, LineLayout& layout)
+    {
+        layout.Text.clear();
+        layout.CharBytes.clear();
+
+        layout.Start = _document.GetLineStart(line);
+        auto end = _document.GetLineEnd(line);
+        if (layout.Start < 0)
+        {
+            layout.Start = 0;
+            layout.CharBytes.push_back(0);
+            return;
+        }
+
+        auto length = (int)std::min(end - layout.Start, (int64_t)MaxLineLayoutLength);
+        auto bytes = _document.GetText(layout.Start, length);
+        length = (int)bytes.length();
+
+        int column = 0;
+        int position = 0;
+
+        while (position < length)
+        {
+            wxUint32 codePoint;
+            auto count = DecodeUtf8(bytes.data() + position, length - position, codePoint);
+            auto textLength = layout.Text.length();
+
+            if (codePoint == '\t')
+            {
+                auto spaces = TabSize - column % TabSize;
+                layout.Text.append(spaces, ' ');
+                column += spaces;
+            }
+            else
+            {
+                layout.Text += wxUniChar(codePoint);
+                column++;
+            }
+
+            for (auto i = textLength; i < layout.Text.length(); i++)
+                layout.CharBytes.push_back(position);
+
+            position += count;
+        }
+
+        layout.CharBytes.push_back(position);
+    }
+
+    int TextViewer::GetCharIndex(const LineLayout& layout, int64_t offset)
+    {
+        auto byte = offset - layout.Start;
+        auto it = std::lower_bound(layout.CharBytes.begin(), layout.CharBytes.end(), byte);
+        if (it == layout.CharBytes.end())
+            return (int)layout.CharBytes.size() - 1;
+        return (int)(it - layout.CharBytes.begin());
+    }
+
+    void TextViewer::OnPaint(wxPaintEvent& event)
+    {
+        if (IsNullOrDeleting())
+            return;
+
+        auto window = GetWxWindow();
+        auto size = window->GetClientSize();
+        wxAutoBufferedPaintDC dc(window);
+
+        if (size.x <= 0 || size.y <= 0)
+            return;
+
+        PerformanceCounters::Increment(PerformanceCounter::Paints);
+        PerformanceCounters::TraceScope traceScope("TextViewer.Paint", "paint");
+
+        std::unique_ptr<wxGraphicsContext> gc(wxGraphicsContext::Create(dc));
+        if (gc == nullptr)
+            return;
+
+        PerformanceCounters::Increment(PerformanceCounter::GraphicsObjectsCreated);
+
+        gc->SetPen(*wxTRANSPARENT_PEN);
+        gc->SetBrush(wxBrush(window->GetBackgroundColour()));
+        gc->DrawRectangle(0, 0, size.x, size.y);
+
+        gc->SetFont(window->GetFont(), window->GetForegroundColour());
+
+        wxDouble textWidth, textHeight;
+        gc->GetTextExtent("Ag", &textWidth, &textHeight);
+        _lineHeight = std::max((int)std::ceil(textHeight), 1);
+
+        auto highlight = wxSystemSettings::GetColour(wxSYS_COLOUR_HIGHLIGHT);
+        auto selectionBrush = gc->CreateBrush(wxBrush(
+            wxColour(highlight.Red(), highlight.Green(), highlight.Blue(), 96)));
+
+        auto selectionStart = GetSelectionStart();
+        auto selectionEnd = GetSelectionEnd();
+
+        auto lineCount = _document.GetLineCount();
+        auto lastLine = std::min(_firstLine + GetVisibleLineCount() + 1, lineCount);
+
+        LineLayout layout;
+        wxArrayDouble widths;
+        auto maxLineWidth = _maxLineWidth;
+
+        for (auto line = _firstLine; line < lastLine; line++)
+        {
+            LayoutLine(line, layout);
+            gc->GetPartialTextExtents(layout.Text, widths);
+
+            auto width = widths.IsEmpty() ? 0 : (int)std::ceil(widths.Last());
+            _maxLineWidth = std::max(_maxLineWidth, width);
+
+            auto x = (wxDouble)-_horizontalOffset;
+            auto y = (wxDouble)((line - _firstLine) * _lineHeight);
+
+            auto lineEnd = layout.Start + layout.CharBytes.back();
+            if (selectionStart < selectionEnd && selectionStart <= lineEnd && selectionEnd > layout.Start)
+            {
+                auto first = GetCharIndex(layout, selectionStart);
+                auto last = GetCharIndex(layout, selectionEnd);
+
+                auto left = first == 0 ? 0 : widths[first - 1];
+                auto right = last == 0 ? 0 : widths[last - 1];
+
+                // Selected line breaks are shown as a space wide selection.
+                if (selectionEnd > lineEnd)
+                    right += _lineHeight / 2;
+
+                gc->SetBrush(selectionBrush);
+                gc->DrawRectangle(x + left, y, right - left, _lineHeight);
+            }
+
+            gc->DrawText(layout.Text, x, y);
+        }
+
+        if (_shownVersion != _document.GetVersion() || maxLineWidth != _maxLineWidth)
+            UpdateScrollBars();
+    }
+
+    int64_t TextViewer::HitTest(const wxPoint& point)
+    {
+        auto lineCount = _document.GetLineCount();
+        auto line = _firstLine + (point.y >= 0 ? point.y / _lineHeight : -1);
+        line = std::max(std::min(line, lineCount - 1), (int64_t)0);
+
+        LineLayout layout;
+        LayoutLine(line, layout);
+
+        std::unique_ptr<wxGraphicsContext> context(CreateMeasuringContext());
+        wxArrayDouble widths;
+        context->GetPartialTextExtents(layout.Text, widths);
+
+        auto x = point.x + _horizontalOffset;
+        size_t index = 0;
+        wxDouble left = 0;
+
+        while (index < widths.size() && x > (left + widths[index]) / 2)
+        {
+            left = widths[index];
+            index++;
+        }
+
+        return layout.Start + layout.CharBytes[index];
+    }
+
+    void TextViewer::OnViewerScroll(wxScrollWinEvent& event)
+    {
+        if (IsNullOrDeleting())
+            return;
+
+        auto type = event.GetEventType();
+        auto vertical = event.GetOrientation() == wxVERTICAL;
+
+        int64_t position = vertical ? _firstLine : _horizontalOffset;
+        int64_t line = vertical ? 1 : _lineHeight;
+        int64_t page = vertical ? GetVisibleLineCount() : GetWxWindow()->GetClientSize().x;
+
+        if (type == wxEVT_SCROLLWIN_TOP)
+            position = 0;
+        else if (type == wxEVT_SCROLLWIN_BOTTOM)
+            position = INT64_MAX / 2;
+        else if (type == wxEVT_SCROLLWIN_LINEUP)
+            position -= line;
+        else if (type == wxEVT_SCROLLWIN_LINEDOWN)
+            position += line;
+        else if (type == wxEVT_SCROLLWIN_PAGEUP)
+            position -= page;
+        else if (type == wxEVT_SCROLLWIN_PAGEDOWN)
+            position += page;
+        else
+            position = event.GetPosition();
+
+        if (vertical)
+            SetFirstLine(position);
+        else
+            SetHorizontalOffset((int)std::min(position, (int64_t)INT_MAX));
+    }
+
+    void TextViewer::OnMouseWheel(wxMouseEvent& event)
+    {
+        if (IsNullOrDeleting() || event.GetWheelDelta() == 0)
+            return;
+
+        // High resolution wheels and touchpads report parts of the delta,
+        // the rotation is summed until it makes a step.
+        auto horizontal = event.GetWheelAxis() == wxMOUSE_WHEEL_HORIZONTAL;
+        auto& rotation = horizontal ? _horizontalWheelRotation : _wheelRotation;
+        rotation += event.GetWheelRotation();
+
+        auto steps = rotation / event.GetWheelDelta();
+        rotation -= steps * event.GetWheelDelta();
+
+        if (steps == 0)
+            return;
+
+        auto firstLine = _firstLine;
+        auto horizontalOffset = _horizontalOffset;
+
+        if (horizontal)
+            SetHorizontalOffset(_horizontalOffset + steps * _lineHeight * WheelLines);
+        else
+            SetFirstLine(_firstLine - steps * WheelLines);
+
+        // At the ends of the text the parent scrolls instead.
+        if (firstLine == _firstLine && horizontalOffset == _horizontalOffset)
+            event.Skip();
+    }
+
+    void TextViewer::OnViewerMouseDown(wxMouseEvent& event)
+    {
+        event.Skip();
+        if (IsNullOrDeleting())
+            return;
+
+        auto window = GetWxWindow();
+        window->SetFocus();
+
+        _selectionCaret = HitTest(event.GetPosition());
+        if (!event.ShiftDown())
+            _selectionAnchor = _selectionCaret;
+
+        _selecting = true;
+        if (!window->HasCapture())
+            window->CaptureMouse();
+
+        window->Refresh(false);
+    }
+
+    void TextViewer::OnViewerMouseMove(wxMouseEvent& event)
+    {
+        event.Skip();
+        if (IsNullOrDeleting() || !_selecting)
+            return;
+
+        if (!event.LeftIsDown())
+        {
+            _selecting = false;
+            return;
+        }
+
+        auto point = event.GetPosition();
+        auto height = GetWxWindow()->GetClientSize().y;
+
+        if (point.y < 0)
+            SetFirstLine(_firstLine - 1);
+        else if (point.y >= height)
+            SetFirstLine(_firstLine + 1);
+
+        _selectionCaret = HitTest(point);
+        GetWxWindow()->Refresh(false);
+    }
+
+    void TextViewer::OnMouseLeftUp(wxMouseEvent& event)
+    {
+        if (_selecting && !IsNullOrDeleting())
+        {
+            _selecting = false;
+
+            auto window = GetWxWindow();
+            if (window->HasCapture())
+                window->ReleaseMouse();
+        }
+
+        Control::OnMouseLeftUp(event);
+    }
+
+    void TextViewer::OnViewerKeyDown(wxKeyEvent& event)
+    {
+        if (IsNullOrDeleting())
+            return;
+
+        auto control = event.ControlDown();
+        auto page = GetVisibleLineCount();
+
+        switch (event.GetKeyCode())
+        {
+        case WXK_UP:
+            SetFirstLine(_firstLine - 1);
+            break;
+        case WXK_DOWN:
+            SetFirstLine(_firstLine + 1);
+            break;
+        case WXK_PAGEUP:
+            SetFirstLine(_firstLine - page);
+            break;
+        case WXK_PAGEDOWN:
+            SetFirstLine(_firstLine + page);
+            break;
+        case WXK_LEFT:
+            SetHorizontalOffset(_horizontalOffset - _lineHeight);
+            break;
+        case WXK_RIGHT:
+            SetHorizontalOffset(_horizontalOffset + _lineHeight);
+            break;
+        case WXK_HOME:
+            if (control)
+                SetFirstLine(0);
+            SetHorizontalOffset(0);
+            break;
+        case WXK_END:
+            if (control)
+                SetFirstLine(_document.GetLineCount());
+            break;
+        case 'A':
+            if (!control)
+            {
+                event.Skip();
+                return;
+            }
+            SelectAll();
+            break;
+        case 'C':
+        case WXK_INSERT:
+            if (!control)
+            {
+                event.Skip();
+                return;
+            }
+            CopySelection();
+            break;
+        default:
+            event.Skip();
+            break;
+        }
+    }
+
+    void TextViewer::OnSizeChanged(wxSizeEvent& event)
+    {
+        Control::OnSizeChanged(event);
+
+        if (IsNullOrDeleting())
+            return;
+
+        SetFirstLine(_firstLine);
+        UpdateScrollBars();
+    }
+
+    bool TextViewer::LoadFile(const NativeStringSpan& path)
+    {
+        _firstLine = 0;
+        _horizontalOffset = 0;
+        _maxLineWidth = 0;
+        _selectionAnchor = _selectionCaret = 0;
+        _followEnd = false;
+
+        auto result = _document.LoadFile(wxStr(path));
+
+        UpdateScrollBars();
+        StartIndexTimer();
+
+        if (IsWxWindowCreated())
+            GetWxWindow()->Refresh(false);
+
+        return result;
+    }
+
+    void TextViewer::SetText(const NativeStringSpan& text)
+    {
+        ClearText();
+        AppendText(text);
+    }
+
+    void TextViewer::AppendText(const NativeStringSpan& text)
+    {
+        // Keeps showing the end of the text when it was shown before, so
+        // appended log lines scroll into view once they are indexed.
+        _followEnd = IsLastLineVisible();
+
+        _document.Append(ToUtf8(text));
+        StartIndexTimer();
+    }
+
+    void TextViewer::ClearText()
+    {
+        _document.Clear();
+
+        _firstLine = 0;
+        _horizontalOffset = 0;
+        _maxLineWidth = 0;
+        _selectionAnchor = _selectionCaret = 0;
+        _followEnd = false;
+
+        UpdateScrollBars();
+
+        if (IsWxWindowCreated())
+            GetWxWindow()->Refresh(false);
+    }
+
+    int64_t TextViewer::GetLength()
+    {
+        return _document.GetLength();
+    }
+
+    int64_t TextViewer::GetLineCount()
+    {
+        return _document.GetLineCount();
+    }
+
+    bool TextViewer::GetIsIndexing()
+    {
+        return _document.IsIndexing();
+    }
+
+    int64_t TextViewer::GetLineStart(int64_t line)
+    {
+        return _document.GetLineStart(line);
+    }
+
+    int64_t TextViewer::GetLineFromOffset(int64_t offset)
+    {
+        return _document.GetLineFromOffset(offset);
+    }
+
+    NativeStringSpan TextViewer::GetLineText(int64_t line)
+    {
+        auto start = _document.GetLineStart(line);
+        if (start < 0)
+            _container = wxEmptyString;
+        else
+        {
+            auto text = _document.GetText(start, _document.GetLineEnd(line) - start);
+            _container = wxString::FromUTF8(text.data(), text.length());
+        }
+        return wxStr(_container);
+    }
+
+    NativeStringSpan TextViewer::GetTextRange(int64_t offset, int64_t length)
+    {
+        auto text = _document.GetText(offset, length);
+        _container = wxString::FromUTF8(text.data(), text.length());
+        return wxStr(_container);
+    }
+
+    int64_t TextViewer::FindText(const NativeStringSpan& text, int64_t start, bool matchCase)
+    {
+        return _document.Find(ToUtf8(text), start, matchCase);
+    }
+
+    void TextViewer::SetSelection(int64_t start, int64_t end)
+    {
+        auto length = _document.GetLength();
+        _selectionAnchor = std::max(std::min(start, length), (int64_t)0);
+        _selectionCaret = std::max(std::min(end, length), (int64_t)0);
+
+        if (IsWxWindowCreated())
+            GetWxWindow()->Refresh(false);
+    }
+
+    int64_t TextViewer::GetSelectionStart()
+    {
+        return std::min(_selectionAnchor, _selectionCaret);
+    }
+
+    int64_t TextViewer::GetSelectionEnd()
+    {
+        return std::max(_selectionAnchor, _selectionCaret);
+    }
+
+    void TextViewer::SelectAll()
+    {
+        SetSelection(0, _document.GetLength());
+    }
+
+    NativeStringSpan TextViewer::GetSelectedText()
+    {
+        return GetTextRange(GetSelectionStart(), GetSelectionEnd() - GetSelectionStart());
+    }
+
+    bool TextViewer::CopySelection()
+    {
+        auto start = GetSelectionStart();
+        auto end = GetSelectionEnd();
+        if (start == end)
+            return false;
+
+        auto text = _document.GetText(start, end - start);
+
+        wxClipboardLocker lock;
+        if (!lock)
+            return false;
+
+        return wxTheClipboard->SetData(
+            new wxTextDataObject(wxString::FromUTF8(text.data(), text.length())));
+    }
+
+    void TextViewer::ScrollToLine(int64_t line)
+    {
+        SetFirstLine(line);
+    }
+
+    void TextViewer::ScrollToOffset(int64_t offset)
+    {
+        auto line = _document.GetLineFromOffset(offset);
+
+        if (line < _firstLine || line >= _firstLine + GetVisibleLineCount())
+            SetFirstLine(line - GetVisibleLineCount() / 2);
+    }
+
+    int64_t TextViewer::GetFirstVisibleLine()
+    {
+        return _firstLine;
+    }
+}
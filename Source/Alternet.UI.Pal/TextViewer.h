@@ -0,0 +1,77 @@
+#pragma once
+#include "Common.h"
+#include "ApiTypes.h"
+#include "Control.h"
+#include "TextDocument.h"
+
+namespace Alternet::UI
+{
+    // Read-only viewer of large texts. The text is kept in a TextDocument and
+    // only the visible lines are laid out and drawn, so the cost of painting
+    // and scrolling doesn't depend on the document size. Offsets are UTF-8
+    // byte offsets in the document.
+    class TextViewer : public Control
+    {
+#include "Api/TextViewer.inc"
+    public:
+        wxWindow* CreateWxWindowCore(wxWindow* parent) override;
+        wxWindow* CreateWxWindowUnparented() override;
+
+    protected:
+        void OnPaint(wxPaintEvent& event) override;
+        void OnMouseWheel(wxMouseEvent& event) override;
+        void OnMouseLeftUp(wxMouseEvent& event) override;
+        void OnSizeChanged(wxSizeEvent& event) override;
+        void OnWxWindowCreated() override;
+        void OnBeforeDestroyWxWindow() override;
+
+    private:
+        // Line text prepared for drawing. CharBytes maps each character of
+        // Text to its byte offset in the line and has one extra item with
+        // the length of the laid out part of the line.
+        struct LineLayout
+        {
+            int64_t Start = 0;
+            wxString Text;
+            std::vector<int> CharBytes;
+        };
+
+        static constexpr int MaxLineLayoutLength = 16384;
+        static constexpr int TabSize = 4;
+        static constexpr int WheelLines = 3;
+
+        void OnViewerScroll(wxScrollWinEvent& event);
+        void OnViewerMouseDown(wxMouseEvent& event);
+        void OnViewerMouseMove(wxMouseEvent& event);
+        void OnViewerKeyDown(wxKeyEvent& event);
+        void OnIndexTimer(wxTimerEvent& event);
+
+        void LayoutLine(int64_t line, LineLayout& layout);
+        int GetCharIndex(const LineLayout& layout, int64_t offset);
+        wxGraphicsContext* CreateMeasuringContext();
+
+        void UpdateMetrics();
+        void UpdateScrollBars();
+        void StartIndexTimer();
+        void SetFirstLine(int64_t line);
+        void SetHorizontalOffset(int offset);
+        int64_t HitTest(const wxPoint& point);
+        bool IsLastLineVisible();
+
+        TextDocument _document;
+        wxTimer _indexTimer;
+        uint64_t _shownVersion = 0;
+
+        int64_t _firstLine = 0;
+        int _horizontalOffset = 0;
+        int _lineHeight = 1;
+        int _maxLineWidth = 0;
+        int _wheelRotation = 0;
+        int _horizontalWheelRotation = 0;
+
+        int64_t _selectionAnchor = 0;
+        int64_t _selectionCaret = 0;
+        bool _selecting = false;
+        bool _followEnd = false;
+    };
+}
@@ -0,0 +1,301 @@
+#include "ThemePartRenderer.h"
+
+#include <wx/dcmemory.h>
+#include <wx/settings.h>
+
+#include <tuple>
+
+namespace Alternet::UI
+{
+    ThemePartRenderer& ThemePartRenderer::GetInstance()
+    {
+        // Not destroyed on exit, the bitmaps can't be freed after wx cleanup.
+        static auto instance = new ThemePartRenderer();
+        return *instance;
+    }
+
+    int ThemePartRenderer::DrawBatch(wxWindow* window, wxDC& dc, const int64_t* records,
+        int recordsCount, const wxArrayString& strings, bool useCache)
+    {
+        if (records == nullptr)
+            return 0;
+
+        useCache = useCache && _cacheLimit > 0;
+
+        // Same for the whole batch, so it is read once.
+        auto theme = useCache ? GetThemeKey() : 0;
+        auto scaleFactor = dc.GetContentScaleFactor();
+
+        int drawn = 0;
+
+        for (int i = 0; i + RecordStride <= recordsCount; i += RecordStride)
+        {
+            auto record = records + i;
+            auto part = (int)record[0];
+            wxRect rect((int)record[1], (int)record[2], (int)record[3], (int)record[4]);
+            auto flags = (int)record[5];
+            auto value = (int)record[6];
+            auto extra = (int)record[7];
+            auto textIndex = record[8];
+
+            if (rect.width <= 0 || rect.height <= 0)
+                continue;
+
+            if (useCache && IsCacheable(part)
+                && rect.width <= MaxCachedPartSize && rect.height <= MaxCachedPartSize)
+            {
+                Key key{ part, rect.width, rect.height, flags, value, extra, scaleFactor, theme };
+
+                auto cached = FindCached(key);
+                if (cached != nullptr)
+                {
+                    dc.DrawBitmap(*cached, rect.GetPosition(), true);
+                    drawn++;
+                    continue;
+                }
+
+                auto bitmap = RenderCached(window, key);
+                if (bitmap.IsOk())
+                {
+                    AddCached(key, bitmap);
+                    dc.DrawBitmap(bitmap, rect.GetPosition(), true);
+                    drawn++;
+                    continue;
+                }
+            }
+
+            auto hasText = textIndex >= 0 && textIndex < (int64_t)strings.size();
+            DrawPart(window, dc, part, rect, flags, value, extra,
+                hasText ? strings[(size_t)textIndex] : wxEmptyString);
+            drawn++;
+        }
+
+        return drawn;
+    }
+
+    void ThemePartRenderer::DrawPart(wxWindow* window, wxDC& dc, int part, const wxRect& rect,
+        int flags, int value, int extra, const wxString& text)
+    {
+        auto& renderer = wxRendererNative::Get();
+
+        switch (part)
+        {
+        case CheckBox:
+            renderer.DrawCheckBox(window, dc, rect, flags);
+            break;
+        case CheckMark:
+            renderer.DrawCheckMark(window, dc, rect, flags);
+            break;
+        case RadioBitmap:
+            renderer.DrawRadioBitmap(window, dc, rect, flags);
+            break;
+        case PushButton:
+            renderer.DrawPushButton(window, dc, rect, flags);
+            break;
+        case HeaderButton:
+            renderer.DrawHeaderButton(window, dc, rect, flags, (wxHeaderSortIconType)value);
+            break;
+        case HeaderButtonContents:
+            renderer.DrawHeaderButtonContents(window, dc, rect, flags, (wxHeaderSortIconType)value);
+            break;
+        case TreeItemButton:
+            renderer.DrawTreeItemButton(window, dc, rect, flags);
+            break;
+        case ComboBoxDropButton:
+            renderer.DrawComboBoxDropButton(window, dc, rect, flags);
+            break;
+        case DropArrow:
+            renderer.DrawDropArrow(window, dc, rect, flags);
+            break;
+        case CollapseButton:
+            renderer.DrawCollapseButton(window, dc, rect, flags);
+            break;
+        case ItemSelectionRect:
+            renderer.DrawItemSelectionRect(window, dc, rect, flags);
+            break;
+        case FocusRect:
+            renderer.DrawFocusRect(window, dc, rect, flags);
+            break;
+        case Choice:
+            renderer.DrawChoice(window, dc, rect, flags);
+            break;
+        case ComboBox:
+            renderer.DrawComboBox(window, dc, rect, flags);
+            break;
+        case TextCtrl:
+            renderer.DrawTextCtrl(window, dc, rect, flags);
+            break;
+        case SplitterBorder:
+            renderer.DrawSplitterBorder(window, dc, rect, flags);
+            break;
+        case Gauge:
+            renderer.DrawGauge(window, dc, rect, value, extra, flags);
+            break;
+        case ItemText:
+            renderer.DrawItemText(window, dc, text, rect, value, flags, (wxEllipsizeMode)extra);
+            break;
+        }
+    }
+
+    void ThemePartRenderer::SetCacheLimit(int64_t value)
+    {
+        _cacheLimit = std::max(value, (int64_t)0);
+        TrimCache();
+    }
+
+    int64_t ThemePartRenderer::GetCacheLimit()
+    {
+        return _cacheLimit;
+    }
+
+    int64_t ThemePartRenderer::GetCachedBytes()
+    {
+        return _cachedBytes;
+    }
+
+    void ThemePartRenderer::ClearCache()
+    {
+        _cache.clear();
+        _cachedBytes = 0;
+    }
+
+    bool ThemePartRenderer::Key::operator<(const Key& other) const
+    {
+        return std::tie(Part, Width, Height, Flags, Value, Extra, ScaleFactor, Theme)
+            < std::tie(other.Part, other.Width, other.Height, other.Flags, other.Value,
+                other.Extra, other.ScaleFactor, other.Theme);
+    }
+
+    /*static*/ bool ThemePartRenderer::IsCacheable(int part)
+    {
+        // Parts which depend only on their size and state. Selection and
+        // focus rectangles, text and fields are usually as wide as the
+        // cell and aren't worth keeping.
+        switch (part)
+        {
+        case CheckBox:
+        case CheckMark:
+        case RadioBitmap:
+        case PushButton:
+        case HeaderButton:
+        case TreeItemButton:
+        case ComboBoxDropButton:
+        case DropArrow:
+        case CollapseButton:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /*static*/ uint32_t ThemePartRenderer::GetThemeKey()
+    {
+        // The theme has no id, switching it changes the system colors or
+        // the dark mode, and the renderer version changes with the renderer.
+        auto face = wxSystemSettings::GetColour(wxSYS_COLOUR_BTNFACE).GetRGB();
+        auto highlight = wxSystemSettings::GetColour(wxSYS_COLOUR_HIGHLIGHT).GetRGB();
+        auto dark = wxSystemSettings::GetAppearance().IsDark() ? 1u : 0u;
+        auto version = (uint32_t)wxRendererNative::Get().GetVersion().age;
+
+        return face ^ (highlight * 31) ^ (version << 24) ^ (dark << 31);
+    }
+
+    const wxBitmap* ThemePartRenderer::FindCached(const Key& key)
+    {
+        auto it = _cache.find(key);
+        if (it == _cache.end())
+            return nullptr;
+
+        it->second.LastUse = ++_useCounter;
+        return &it->second.Bitmap;
+    }
+
+    void ThemePartRenderer::AddCached(const Key& key, const wxBitmap& bitmap)
+    {
+        Entry entry;
+        entry.Bitmap = bitmap;
+        entry.Bytes = (int64_t)bitmap.GetWidth() * bitmap.GetHeight() * 4;
+        entry.LastUse = ++_useCounter;
+
+        _cachedBytes += entry.Bytes;
+        _cache[key] = entry;
+        TrimCache();
+    }
+
+    wxBitmap ThemePartRenderer::RenderCached(wxWindow* window, const Key& key)
+    {
+        // Physical size of the part in a DC with the same content scale as
+        // the target, so the cached part matches the directly drawn one.
+        auto width = (int)std::ceil(key.Width * key.ScaleFactor);
+        auto height = (int)std::ceil(key.Height * key.ScaleFactor);
+        wxRect rect(0, 0, key.Width, key.Height);
+
+        wxBitmap onBlack(width, height, 24);
+        wxBitmap onWhite(width, height, 24);
+        onBlack.SetScaleFactor(key.ScaleFactor);
+        onWhite.SetScaleFactor(key.ScaleFactor);
+
+        {
+            wxMemoryDC dc(onBlack);
+            dc.SetBackground(*wxBLACK_BRUSH);
+            dc.Clear();
+            DrawPart(window, dc, key.Part, rect, key.Flags, key.Value, key.Extra, wxEmptyString);
+        }
+
+        {
+            wxMemoryDC dc(onWhite);
+            dc.SetBackground(*wxWHITE_BRUSH);
+            dc.Clear();
+            DrawPart(window, dc, key.Part, rect, key.Flags, key.Value, key.Extra, wxEmptyString);
+        }
+
+        auto black = onBlack.ConvertToImage();
+        auto white = onWhite.ConvertToImage();
+        if (!black.IsOk() || !white.IsOk())
+            return wxNullBitmap;
+
+        // Where the part is opaque both renderings are the same, where it
+        // is transparent they differ by the background. The difference
+        // gives the alpha and the rendering on black the premultiplied color.
+        wxImage result(width, height, false);
+        result.SetAlpha();
+
+        auto blackData = black.GetData();
+        auto whiteData = white.GetData();
+        auto data = result.GetData();
+        auto alpha = result.GetAlpha();
+        auto count = (size_t)width * height;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            auto color = blackData + i * 3;
+            auto other = whiteData + i * 3;
+            auto difference = (other[0] - color[0]) + (other[1] - color[1]) + (other[2] - color[2]);
+            auto a = std::clamp(255 - difference / 3, 0, 255);
+
+            alpha[i] = (unsigned char)a;
+            for (int c = 0; c < 3; c++)
+                data[i * 3 + c] = a == 0 ? 0 : (unsigned char)std::min(color[c] * 255 / a, 255);
+        }
+
+        wxBitmap bitmap(result, 32);
+        bitmap.SetScaleFactor(key.ScaleFactor);
+        return bitmap;
+    }
+
+    void ThemePartRenderer::TrimCache()
+    {
+        while (!_cache.empty() && (_cachedBytes > _cacheLimit || _cache.size() > MaxCachedParts))
+        {
+            auto oldest = _cache.begin();
+            for (auto it = _cache.begin(); it != _cache.end(); ++it)
+            {
+                if (it->second.LastUse < oldest->second.LastUse)
+                    oldest = it;
+            }
+
+            _cachedBytes -= oldest->second.Bytes;
+            _cache.erase(oldest);
+        }
+    }
+}
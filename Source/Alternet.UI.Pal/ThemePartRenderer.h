@@ -0,0 +1,98 @@
+#pragma once
+#include "Common.h"
+
+#include <wx/renderer.h>
+
+#include <map>
+
+namespace Alternet::UI
+{
+    // Draws batches of native theme parts into one DC and keeps small
+    // stateless parts pre-rendered, so rows of check boxes or buttons are
+    // blitted instead of asking the theme for every cell. Cached parts are
+    // rendered on black and on white to recover their transparency, they
+    // are keyed by part, size, flags, parameters, DC scale and theme.
+    // UI thread only.
+    class ThemePartRenderer
+    {
+    public:
+        enum Part
+        {
+            CheckBox,
+            CheckMark,
+            RadioBitmap,
+            PushButton,
+            HeaderButton,
+            HeaderButtonContents,
+            TreeItemButton,
+            ComboBoxDropButton,
+            DropArrow,
+            CollapseButton,
+            ItemSelectionRect,
+            FocusRect,
+            Choice,
+            ComboBox,
+            TextCtrl,
+            SplitterBorder,
+            Gauge,
+            ItemText,
+        };
+
+        // Batch record: part, x, y, width, height, flags, value, extra and
+        // text index. Value is the sort arrow of headers, the value of gauges
+        // and the alignment of texts; extra is the maximum of gauges and the
+        // ellipsize mode of texts.
+        static constexpr int RecordStride = 9;
+        static constexpr int MaxCachedPartSize = 128;
+        static constexpr size_t MaxCachedParts = 512;
+        static constexpr int64_t DefaultCacheLimit = 4 * 1024 * 1024;
+
+        static ThemePartRenderer& GetInstance();
+
+        // Returns the number of drawn records.
+        int DrawBatch(wxWindow* window, wxDC& dc, const int64_t* records, int recordsCount,
+            const wxArrayString& strings, bool useCache);
+        void DrawPart(wxWindow* window, wxDC& dc, int part, const wxRect& rect, int flags,
+            int value, int extra, const wxString& text);
+
+        void SetCacheLimit(int64_t value);
+        int64_t GetCacheLimit();
+        int64_t GetCachedBytes();
+        void ClearCache();
+
+    private:
+        struct Key
+        {
+            int Part;
+            int Width;
+            int Height;
+            int Flags;
+            int Value;
+            int Extra;
+            double ScaleFactor;
+            uint32_t Theme;
+
+            bool operator<(const Key& other) const;
+        };
+
+        struct Entry
+        {
+            wxBitmap Bitmap;
+            int64_t Bytes = 0;
+            uint64_t LastUse = 0;
+        };
+
+        static bool IsCacheable(int part);
+        static uint32_t GetThemeKey();
+
+        const wxBitmap* FindCached(const Key& key);
+        void AddCached(const Key& key, const wxBitmap& bitmap);
+        wxBitmap RenderCached(wxWindow* window, const Key& key);
+        void TrimCache();
+
+        std::map<Key, Entry> _cache;
+        int64_t _cachedBytes = 0;
+        int64_t _cacheLimit = DefaultCacheLimit;
+        uint64_t _useCounter = 0;
+    };
+}
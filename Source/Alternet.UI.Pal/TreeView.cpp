@@ -172,6 +172,7 @@ namespace Alternet::UI
 		_skipSelectionChangedEvent = true;
 		_skipExpandedEvent = true;
 		RecreateWxWindowIfNeeded();
+		FlushRecreate();
 		_skipSelectionChangedEvent = false;
 		_skipExpandedEvent = false;
 	}
@@ -330,6 +331,7 @@ namespace Alternet::UI
 		_hideRoot = true;
 		_variableRowHeight = false;
 		RecreateWxWindowIfNeeded();
+		FlushRecreate();
 		SetStateImageSpacing(0);
 		if (GetIndentation() > 3)
 			SetIndentation(3);
@@ -687,11 +689,11 @@ namespace Alternet::UI
 		return style;
 	}
 
-	void TreeView::RecreateWxWindowIfNeeded()
+	void TreeView::RecreateWxWindowCore()
 	{
 		if (_ignoreRecreate)
 			return;
-		Control::RecreateWxWindowIfNeeded();
+		Control::RecreateWxWindowCore();
 		RaiseEvent(TreeViewEvent::ControlRecreated);
 	}
 
@@ -27,7 +27,7 @@ namespace Alternet::UI
 
         long GetStyle();
 
-        virtual void RecreateWxWindowIfNeeded() override;
+        virtual void RecreateWxWindowCore() override;
 
         wxTreeCtrlBase* GetTreeCtrl();
 
@@ -43,6 +43,35 @@
 
 namespace Alternet::UI
 {
+    namespace
+    {
+        // Appends text as a quoted JSON string, which is also a valid
+        // JavaScript string literal.
+        void AppendJsonString(wxString& result, const wxString& text)
+        {
+            result += '"';
+            for (wxUniChar c : text)
+            {
+                auto code = c.GetValue();
+                switch (code)
+                {
+                case '"': result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\n': result += "\\n"; break;
+                case '\r': result += "\\r"; break;
+                case '\t': result += "\\t"; break;
+                case 0x2028: result += "\\u2028"; break;
+                case 0x2029: result += "\\u2029"; break;
+                default:
+                    if (code < 0x20)
+                        result += wxString::Format("\\u%04x", (int)code);
+                    else
+                        result += c;
+                }
+            }
+            result += '"';
+        }
+    }
 
     WebBrowserBackend WebBrowser::DefaultBackend = WebBrowserBackend::Default;
     wxString WebBrowser::DefaultPage = "about:blank";
@@ -354,6 +383,10 @@ namespace Alternet::UI
         catch (const std::exception&)
         {
         }
+
+        // Scripts queued before the window was created are sent now.
+        if (!_pendingScripts.empty())
+            StartScriptTimer();
     }
 
     bool WebBrowser::GetHasBorder()
@@ -504,6 +537,8 @@ namespace Alternet::UI
 
     WebBrowser::~WebBrowser()
     {
+        _scriptTimer.Stop();
+
         if (IsWxWindowCreated())
         {
             auto window = GetWxWindow();
@@ -585,12 +620,174 @@ namespace Alternet::UI
     
     void WebBrowser::OnScriptMessageReceived(wxWebViewEvent& event)
     {
-        RaiseEventEx(WebBrowserEvent::ScriptMessageReceived, event);
+        if (!_scriptMessageBatching)
+        {
+            RaiseEventEx(WebBrowserEvent::ScriptMessageReceived, event);
+            return;
+        }
+
+        event.Skip();
+        _pendingMessages.emplace_back(event.GetMessageHandler(), event.GetString());
+        StartScriptTimer();
     }
     
     void WebBrowser::OnScriptResult(wxWebViewEvent& event)
     {
-        RaiseEventEx(WebBrowserEvent::ScriptResult, event);
+        auto clientData = event.GetClientData();
+        auto it = std::find_if(_scriptBatches.begin(), _scriptBatches.end(),
+            [clientData](const std::unique_ptr<ScriptBatch>& batch)
+            {
+                return batch.get() == clientData;
+            });
+
+        if (it == _scriptBatches.end())
+        {
+            RaiseEventEx(WebBrowserEvent::ScriptResult, event);
+            return;
+        }
+
+        event.Skip();
+
+        auto& ids = (*it)->Ids;
+
+        // Results are passed as [id, isError, text] items.
+        if (event.IsError())
+            SetBatchError(ids, event.GetString());
+        else
+            _batchContainer = event.GetString();
+
+        auto count = (int)ids.size();
+        _scriptBatches.erase(it);
+        RaiseBatchEvent(WebBrowserEvent::ScriptBatchResult, count);
+    }
+
+    void WebBrowser::SetBatchError(const std::vector<int64_t>& ids, const wxString& error)
+    {
+        // When the whole batch fails, every script in it gets the error.
+        _batchContainer = "[";
+        for (size_t i = 0; i < ids.size(); i++)
+        {
+            if (i > 0)
+                _batchContainer += ",";
+            _batchContainer += wxString::Format("[%lld,1,", (long long)ids[i]);
+            AppendJsonString(_batchContainer, error);
+            _batchContainer += "]";
+        }
+        _batchContainer += "]";
+    }
+
+    void WebBrowser::OnWxWindowDestroyed(wxWindow* window)
+    {
+        _scriptTimer.Stop();
+        FlushScriptMessages();
+
+        // Also called when the window is destroyed with its parent. Results
+        // of the batches sent to the destroyed page never come, so their
+        // scripts are completed with an error. Scripts which were not sent
+        // yet stay queued for the next window.
+        auto batches = std::move(_scriptBatches);
+        _scriptBatches.clear();
+
+        for (auto& batch : batches)
+        {
+            SetBatchError(batch->Ids, "Web browser window was destroyed");
+            RaiseBatchEvent(WebBrowserEvent::ScriptBatchResult, (int)batch->Ids.size());
+        }
+
+        Control::OnWxWindowDestroyed(window);
+    }
+
+    void WebBrowser::RaiseBatchEvent(WebBrowserEvent eventId, int count)
+    {
+        WebBrowserEventData data = WebBrowserEventData();
+        data.Text = wxStr(_batchContainer);
+        data.IntVal = count;
+        RaiseEvent(eventId, &data);
+    }
+
+    void WebBrowser::StartScriptTimer()
+    {
+        if (!_scriptTimer.IsRunning())
+            _scriptTimer.StartOnce(ScriptBatchInterval);
+    }
+
+    int64_t WebBrowser::QueueScript(const NativeStringSpan& javascript)
+    {
+        auto id = _nextScriptId++;
+        _pendingScripts.emplace_back(id, wxStr(javascript));
+        StartScriptTimer();
+        return id;
+    }
+
+    void WebBrowser::FlushScripts()
+    {
+        _scriptTimer.Stop();
+        FlushScriptMessages();
+
+        if (_pendingScripts.empty() || !IsWxWindowCreated())
+            return;
+
+        // All queued scripts run in one injected script. Each one is
+        // evaluated separately, so an exception doesn't stop the others and
+        // its result is the value of its last statement as with RunScript.
+        // The eval is indirect, so scripts run in the global scope: their
+        // declarations persist and they don't see the variables here.
+        auto batch = std::make_unique<ScriptBatch>();
+        wxString script = "(function(){var r=[];";
+
+        for (auto& item : _pendingScripts)
+        {
+            auto id = wxString::Format("%lld", (long long)item.first);
+            script += "try{r.push([" + id + ",0,String((0,eval)(";
+            AppendJsonString(script, item.second);
+            script += "))]);}catch(e){r.push([" + id + ",1,String(e)]);}";
+            batch->Ids.push_back(item.first);
+        }
+
+        script += "return JSON.stringify(r);})()";
+        _pendingScripts.clear();
+
+        auto clientData = batch.get();
+        _scriptBatches.push_back(std::move(batch));
+        GetWebViewCtrl()->RunScriptAsync(script, clientData);
+    }
+
+    void WebBrowser::FlushScriptMessages()
+    {
+        if (_pendingMessages.empty())
+            return;
+
+        // Messages are passed as [handler, text] items.
+        _batchContainer = "[";
+        for (size_t i = 0; i < _pendingMessages.size(); i++)
+        {
+            if (i > 0)
+                _batchContainer += ",";
+            _batchContainer += "[";
+            AppendJsonString(_batchContainer, _pendingMessages[i].first);
+            _batchContainer += ",";
+            AppendJsonString(_batchContainer, _pendingMessages[i].second);
+            _batchContainer += "]";
+        }
+        _batchContainer += "]";
+
+        auto count = (int)_pendingMessages.size();
+        _pendingMessages.clear();
+        RaiseBatchEvent(WebBrowserEvent::ScriptMessageBatch, count);
+    }
+
+    void WebBrowser::SetScriptMessageBatching(bool value)
+    {
+        if (_scriptMessageBatching == value)
+            return;
+        _scriptMessageBatching = value;
+        if (!value)
+            FlushScriptMessages();
+    }
+
+    bool WebBrowser::GetScriptMessageBatching()
+    {
+        return _scriptMessageBatching;
     }
     
     void WebBrowser::OnBeforeBrowserCreate(wxWebViewEvent& event)
@@ -10,6 +10,8 @@
 
 #include <wx/webview.h>
 
+#include <memory>
+
 namespace Alternet::UI
 {
     class WebBrowser : public Control
@@ -72,6 +74,7 @@ namespace Alternet::UI
 
     protected:
         void OnWxWindowCreated() override;
+        void OnWxWindowDestroyed(wxWindow* window) override;
         bool IsCursorSuppressed() override { return true; }
 
     private:
@@ -91,6 +94,38 @@ namespace Alternet::UI
         void OnFullScreenChanged(wxWebViewEvent& event);
         void OnScriptMessageReceived(wxWebViewEvent& event);
         void OnScriptResult(wxWebViewEvent& event);
+
+        // Scripts queued with QueueScript and script messages are collected
+        // and sent to or raised from the page once per frame.
+        class ScriptTimer : public wxTimer
+        {
+        public:
+            ScriptTimer(WebBrowser* owner) : _owner(owner) {}
+            void Notify() override { _owner->FlushScripts(); }
+
+        private:
+            WebBrowser* _owner;
+        };
+
+        struct ScriptBatch
+        {
+            std::vector<int64_t> Ids;
+        };
+
+        static constexpr int ScriptBatchInterval = 16;
+
+        void StartScriptTimer();
+        void FlushScriptMessages();
+        void RaiseBatchEvent(WebBrowserEvent eventId, int count);
+        void SetBatchError(const std::vector<int64_t>& ids, const wxString& error);
+
+        std::vector<std::pair<int64_t, wxString>> _pendingScripts;
+        std::vector<std::pair<wxString, wxString>> _pendingMessages;
+        std::vector<std::unique_ptr<ScriptBatch>> _scriptBatches;
+        int64_t _nextScriptId = 1;
+        bool _scriptMessageBatching = false;
+        ScriptTimer _scriptTimer { this };
+        wxString _batchContainer;
     };
 }
 
@@ -1,4 +1,6 @@
 #include "WxOtherFactory.h"
+#include "BitmapPool.h"
+#include "ThemePartRenderer.h"
 #include "Application.h"
 #include "Api/InputStream.h"
 #include "Api/OutputStream.h"
@@ -705,8 +707,8 @@ namespace Alternet::UI
 	void WxOtherFactory::RendererDrawPushButton(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		
 		wxRendererNative::Get().DrawPushButton((wxWindow*)win, memoryDc, rect, flags);
 		/*
@@ -717,8 +719,6 @@ namespace Alternet::UI
 		memoryDc.DrawText("Hello", 20, 70);
 		*/
 
-		memoryDc.SelectObject(wxNullBitmap);
-
 		/*
 		wxBitmap.SaveFile("e:\\output.png", wxBITMAP_TYPE_PNG);
 		*/
@@ -727,18 +727,16 @@ namespace Alternet::UI
 	void WxOtherFactory::RendererDrawCollapseButton(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawCollapseButton((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	Int32Size WxOtherFactory::RendererGetCollapseButtonSize(void* renderer, void* win, Image* dc)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		auto size = wxRendererNative::Get().GetCollapseButtonSize((wxWindow*)win, memoryDc);
-		memoryDc.SelectObject(wxNullBitmap);
 		return size;
 	}
 
@@ -746,75 +744,67 @@ namespace Alternet::UI
 		Image* dc, const Int32Rect& rect,
 		int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawItemSelectionRect((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawFocusRect(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawFocusRect((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawChoice(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawChoice((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawComboBox(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawComboBox((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawTextCtrl(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawTextCtrl((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawRadioBitmap(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawRadioBitmap((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawGauge(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int value,
 		int max, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawGauge((wxWindow*)win, memoryDc, rect, value, max,flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawItemText(void* renderer, void* win, Image* dc, const NativeStringSpan& text,
 		const Int32Rect& rect, int align, int flags, int ellipsizeMode)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawItemText((wxWindow*)win, memoryDc, wxStr(text), rect, align,
 			flags,(wxEllipsizeMode) ellipsizeMode);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	NativeStringSpan WxOtherFactory::RendererGetVersion(void* renderer)
@@ -825,15 +815,44 @@ namespace Alternet::UI
 		return wxStr(_containerStatic);
 	}
 
+	int WxOtherFactory::RendererDrawBatch(void* renderer, void* win, Image* dc, int64_t* records,
+		int recordsCount, const NativeStringSpan& strings, bool useCache)
+	{
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
+		auto texts = StringToArrayString(wxStr(strings));
+		return ThemePartRenderer::GetInstance().DrawBatch((wxWindow*)win, memoryDc, records,
+			recordsCount, texts, useCache);
+	}
+
+	void WxOtherFactory::RendererSetPartCacheLimit(int64_t value)
+	{
+		ThemePartRenderer::GetInstance().SetCacheLimit(value);
+	}
+
+	int64_t WxOtherFactory::RendererGetPartCacheLimit()
+	{
+		return ThemePartRenderer::GetInstance().GetCacheLimit();
+	}
+
+	int64_t WxOtherFactory::RendererGetPartCacheBytes()
+	{
+		return ThemePartRenderer::GetInstance().GetCachedBytes();
+	}
+
+	void WxOtherFactory::RendererClearPartCache()
+	{
+		ThemePartRenderer::GetInstance().ClearCache();
+	}
+
 	int WxOtherFactory::RendererDrawHeaderButton(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect,
 		int flags, int sortArrow, void* headerButtonParams)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		auto result = wxRendererNative::Get().DrawHeaderButton((wxWindow*)win, memoryDc, rect, flags,
 			(wxHeaderSortIconType)sortArrow, (wxHeaderButtonParams*) headerButtonParams);
-		memoryDc.SelectObject(wxNullBitmap);
 		return result;
 	}
 
@@ -841,11 +860,10 @@ namespace Alternet::UI
 		Image* dc, const Int32Rect& rect,
 		int flags, int sortArrow, void* headerButtonParams)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		auto result = wxRendererNative::Get().DrawHeaderButtonContents((wxWindow*)win, memoryDc, rect, flags,
 			(wxHeaderSortIconType)sortArrow, (wxHeaderButtonParams*)headerButtonParams);
-		memoryDc.SelectObject(wxNullBitmap);
 		return result;
 	}
 
@@ -862,66 +880,59 @@ namespace Alternet::UI
 	void WxOtherFactory::RendererDrawTreeItemButton(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawTreeItemButton((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawSplitterBorder(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawSplitterBorder((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawSplitterSash(void* renderer, void* win, Image* dcReal,
 		const Int32Size& sizeReal,
 		int position, int orientation, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dcReal);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dcReal);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawSplitterSash((wxWindow*)win, memoryDc,
 			sizeReal, position, (wxOrientation)orientation, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawComboBoxDropButton(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawComboBoxDropButton((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawDropArrow(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawDropArrow((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawCheckBox(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawCheckBox((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	void WxOtherFactory::RendererDrawCheckMark(void* renderer, void* win, Image* dc,
 		const Int32Rect& rect, int flags)
 	{
-		auto wxBitmap = Image::GetWxBitmap(dc);
-		auto memoryDc = wxMemoryDC(wxBitmap);
+		BitmapPool::DCScope scope(dc);
+		auto& memoryDc = scope.GetDC();
 		wxRendererNative::Get().DrawCheckMark((wxWindow*)win, memoryDc, rect, flags);
-		memoryDc.SelectObject(wxNullBitmap);
 	}
 
 	Int32Size WxOtherFactory::RendererGetCheckBoxSize(void* renderer, void* win, int flags)
@@ -0,0 +1,149 @@
+#include "WxWindowPool.h"
+
+namespace Alternet::UI
+{
+    /*static*/ wxWindow* WxWindowPool::Acquire(
+        const wxString& group, const wxString& key, wxWindow* parent)
+    {
+        auto groupIt = s_groups.find(group);
+        if (groupIt == s_groups.end() || groupIt->second.Capacity <= 0)
+            return nullptr;
+
+        auto& info = groupIt->second;
+        auto& windows = s_windows[key];
+
+        if (windows.empty())
+        {
+            info.Misses++;
+            return nullptr;
+        }
+
+        auto window = windows.back();
+        windows.pop_back();
+        info.Parked--;
+        info.Hits++;
+
+        window->Unbind(wxEVT_DESTROY, &WxWindowPool::OnParkedWindowDestroy);
+        window->Reparent(parent);
+        return window;
+    }
+
+    /*static*/ bool WxWindowPool::Park(
+        const wxString& group, const wxString& key, wxWindow* window)
+    {
+        auto groupIt = s_groups.find(group);
+        if (groupIt == s_groups.end() || groupIt->second.Capacity <= 0)
+            return false;
+
+        auto& info = groupIt->second;
+
+        if (info.Parked >= info.Capacity)
+        {
+            info.Rejected++;
+            return false;
+        }
+
+        window->Hide();
+        window->Reparent(ParkingWindow::GetWindow());
+
+        // Parked windows are destroyed with the parking window.
+        window->Bind(wxEVT_DESTROY, &WxWindowPool::OnParkedWindowDestroy);
+
+        s_windows[key].push_back(window);
+        s_keyGroups[key] = group;
+        info.Parked++;
+        return true;
+    }
+
+    /*static*/ void WxWindowPool::SetCapacity(const wxString& group, int capacity)
+    {
+        if (capacity < 0)
+            capacity = 0;
+
+        s_groups[group].Capacity = capacity;
+        DestroyParked(group, capacity);
+    }
+
+    /*static*/ int WxWindowPool::GetCapacity(const wxString& group)
+    {
+        auto groupIt = s_groups.find(group);
+        if (groupIt == s_groups.end())
+            return 0;
+        return groupIt->second.Capacity;
+    }
+
+    /*static*/ void WxWindowPool::Clear()
+    {
+        for (auto& item : s_groups)
+            DestroyParked(item.first, 0);
+    }
+
+    /*static*/ void WxWindowPool::DestroyParked(const wxString& group, int keepCount)
+    {
+        auto& info = s_groups[group];
+
+        for (auto& item : s_windows)
+        {
+            if (info.Parked <= keepCount)
+                break;
+
+            if (s_keyGroups[item.first] != group)
+                continue;
+
+            auto& windows = item.second;
+
+            while (!windows.empty() && info.Parked > keepCount)
+            {
+                auto window = windows.back();
+                windows.pop_back();
+                info.Parked--;
+
+                window->Unbind(wxEVT_DESTROY, &WxWindowPool::OnParkedWindowDestroy);
+                window->Destroy();
+            }
+        }
+    }
+
+    /*static*/ void WxWindowPool::OnParkedWindowDestroy(wxWindowDestroyEvent& event)
+    {
+        event.Skip();
+
+        auto window = event.GetWindow();
+
+        for (auto& item : s_windows)
+        {
+            auto& windows = item.second;
+            auto it = std::find(windows.begin(), windows.end(), window);
+            if (it == windows.end())
+                continue;
+
+            windows.erase(it);
+            s_groups[s_keyGroups[item.first]].Parked--;
+            return;
+        }
+    }
+
+    /*static*/ wxString WxWindowPool::GetStats()
+    {
+        wxString result;
+
+        for (auto& item : s_groups)
+        {
+            auto& info = item.second;
+            auto requests = info.Hits + info.Misses;
+            double hitRate = requests == 0 ? 0 : (double)info.Hits * 100 / requests;
+
+            result += wxString::Format(
+                "%s: capacity=%d parked=%d hits=%lld misses=%lld rejected=%lld hitRate=%.1f%%\n",
+                item.first,
+                info.Capacity,
+                info.Parked,
+                (long long)info.Hits,
+                (long long)info.Misses,
+                (long long)info.Rejected,
+                hitRate);
+        }
+
+        return result;
+    }
+}
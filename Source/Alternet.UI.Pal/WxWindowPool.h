@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Common.h"
+
+namespace Alternet::UI
+{
+    // Keeps hidden native windows parked on the parking window, so they can be
+    // reused by controls of the same pool group instead of being destroyed and
+    // created again. Pooling is disabled for a group until its capacity is set.
+    class WxWindowPool
+    {
+    public:
+        static wxWindow* Acquire(const wxString& group, const wxString& key, wxWindow* parent);
+        static bool Park(const wxString& group, const wxString& key, wxWindow* window);
+
+        static void SetCapacity(const wxString& group, int capacity);
+        static int GetCapacity(const wxString& group);
+
+        static void Clear();
+        static wxString GetStats();
+
+    private:
+        struct GroupInfo
+        {
+            int Capacity = 0;
+            int Parked = 0;
+            int64_t Hits = 0;
+            int64_t Misses = 0;
+            int64_t Rejected = 0;
+        };
+
+        static void DestroyParked(const wxString& group, int keepCount);
+        static void OnParkedWindowDestroy(wxWindowDestroyEvent& event);
+
+        inline static std::map<wxString, GroupInfo> s_groups;
+        inline static std::map<wxString, std::vector<wxWindow*>> s_windows;
+        inline static std::map<wxString, wxString> s_keyGroups;
+    };
+}
@@ -17,5 +17,19 @@ namespace Alternet.UI.Native
             var url = GetReportedUrl().ToString();
             (UIControl as UI.RichTextBox)?.OnTextUrl(new UrlEventArgs(url));
         }
+
+        public event EventHandler? LoadProgress;
+
+        public event EventHandler? LoadCompleted;
+
+        public void OnPlatformEventLoadProgress()
+        {
+            LoadProgress?.Invoke(this, EventArgs.Empty);
+        }
+
+        public void OnPlatformEventLoadCompleted()
+        {
+            LoadCompleted?.Invoke(this, EventArgs.Empty);
+        }
     }
 }
\ No newline at end of file
@@ -88,6 +88,20 @@ namespace Alternet.UI.Native
             (UIControl as UI.WebBrowser)?.RaiseBeforeBrowserCreate(ea);
         }
 
+        public event EventHandler<WebBrowserEventArgs>? ScriptBatchResult;
+
+        public event EventHandler<WebBrowserEventArgs>? ScriptMessageBatch;
+
+        public void OnPlatformEventScriptBatchResult(NativeEventArgs<WebBrowserEventData> e)
+        {
+            ScriptBatchResult?.Invoke(this, CreateArgs(e));
+        }
+
+        public void OnPlatformEventScriptMessageBatch(NativeEventArgs<WebBrowserEventData> e)
+        {
+            ScriptMessageBatch?.Invoke(this, CreateArgs(e));
+        }
+
         internal void SetUserAgent(string value)
         {
             throw new NotImplementedException();
@@ -0,0 +1,161 @@
+// <auto-generated> DO NOT MODIFY MANUALLY. Copyright (c) 2026 AlterNET Software.</auto-generated>
+#nullable enable
+#pragma warning disable
+
+using System;
+using System.Runtime.InteropServices;
+using System.ComponentModel;
+using System.Security;
+namespace Alternet.UI.Native
+{
+    internal partial class AnimationDecoder : NativeObject
+    {
+        static AnimationDecoder()
+        {
+        }
+        
+        public AnimationDecoder()
+        {
+            SetNativePointer(NativeApi.AnimationDecoder_Create_());
+        }
+        
+        public AnimationDecoder(IntPtr nativePointer) : base(nativePointer)
+        {
+        }
+        
+        public long CacheLimit
+        {
+            get
+            {
+                CheckDisposed();
+                return NativeApi.AnimationDecoder_GetCacheLimit_(NativePointer);
+            }
+            
+            set
+            {
+                CheckDisposed();
+                NativeApi.AnimationDecoder_SetCacheLimit_(NativePointer, value);
+            }
+        }
+        
+        public bool LoadFile(Alternet.UI.NativeStringSpan path)
+        {
+            CheckDisposed();
+            var path_Native = path.ToNative();
+return NativeApi.AnimationDecoder_LoadFile_(NativePointer, ref path_Native);
+        }
+        
+        public bool LoadStream(InputStream stream)
+        {
+            CheckDisposed();
+            return NativeApi.AnimationDecoder_LoadStream_(NativePointer, stream.NativePointer);
+        }
+        
+        public void Close()
+        {
+            CheckDisposed();
+            NativeApi.AnimationDecoder_Close_(NativePointer);
+        }
+        
+        public bool IsOk()
+        {
+            CheckDisposed();
+            return NativeApi.AnimationDecoder_IsOk_(NativePointer);
+        }
+        
+        public int GetFrameCount()
+        {
+            CheckDisposed();
+            return NativeApi.AnimationDecoder_GetFrameCount_(NativePointer);
+        }
+        
+        public Alternet.Drawing.SizeI GetSize()
+        {
+            CheckDisposed();
+            return NativeApi.AnimationDecoder_GetSize_(NativePointer);
+        }
+        
+        public int GetFrameDelay(int index)
+        {
+            CheckDisposed();
+            return NativeApi.AnimationDecoder_GetFrameDelay_(NativePointer, index);
+        }
+        
+        public Image GetFrame(int index)
+        {
+            CheckDisposed();
+            var _nnn = NativeApi.AnimationDecoder_GetFrame_(NativePointer, index);
+            var _mmm = NativeObject.GetFromNativePointer<Image>(_nnn, p => new Image(p))!;
+            ReleaseNativeObjectPointer(_nnn);
+            return _mmm;
+        }
+        
+        public System.IntPtr GetFrameImage(int index)
+        {
+            CheckDisposed();
+            return NativeApi.AnimationDecoder_GetFrameImage_(NativePointer, index);
+        }
+        
+        public long GetCachedBytes()
+        {
+            CheckDisposed();
+            return NativeApi.AnimationDecoder_GetCachedBytes_(NativePointer);
+        }
+        
+        public void ClearCache()
+        {
+            CheckDisposed();
+            NativeApi.AnimationDecoder_ClearCache_(NativePointer);
+        }
+        
+        
+        [SuppressUnmanagedCodeSecurity]
+        public class NativeApi : NativeApiProvider
+        {
+            static NativeApi() => Initialize();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr AnimationDecoder_Create_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long AnimationDecoder_GetCacheLimit_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void AnimationDecoder_SetCacheLimit_(IntPtr obj, long value);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool AnimationDecoder_LoadFile_(IntPtr obj, ref Alternet.UI.NativeStringSpan path);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool AnimationDecoder_LoadStream_(IntPtr obj, IntPtr stream);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void AnimationDecoder_Close_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool AnimationDecoder_IsOk_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int AnimationDecoder_GetFrameCount_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.Drawing.SizeI AnimationDecoder_GetSize_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int AnimationDecoder_GetFrameDelay_(IntPtr obj, int index);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr AnimationDecoder_GetFrame_(IntPtr obj, int index);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern System.IntPtr AnimationDecoder_GetFrameImage_(IntPtr obj, int index);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long AnimationDecoder_GetCachedBytes_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void AnimationDecoder_ClearCache_(IntPtr obj);
+            
+        }
+    }
+}
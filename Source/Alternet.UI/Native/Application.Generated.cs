@@ -327,6 +327,36 @@ return NativeApi.Application_SetNativeTheme_(NativePointer, ref theme_Native);
 return NativeApi.Application_GetCustomData_(NativePointer, ref key_Native);
         }
         
+        public static Alternet.UI.NativeStringSpan GetPerformanceCounters()
+        {
+            return NativeApi.Application_GetPerformanceCounters_();
+        }
+        
+        public static void ResetPerformanceCounters()
+        {
+            NativeApi.Application_ResetPerformanceCounters_();
+        }
+        
+        public static void StartPerformanceTrace(int maxEvents)
+        {
+            NativeApi.Application_StartPerformanceTrace_(maxEvents);
+        }
+        
+        public static void StopPerformanceTrace()
+        {
+            NativeApi.Application_StopPerformanceTrace_();
+        }
+        
+        public static Alternet.UI.NativeStringSpan GetPerformanceTraceJson()
+        {
+            return NativeApi.Application_GetPerformanceTraceJson_();
+        }
+        
+        public static void GetStartupTimings(System.Int64[] timings)
+        {
+            NativeApi.Application_GetStartupTimings_(timings, timings.Length);
+        }
+        
         static GCHandle eventCallbackGCHandle;
         public static Application? GlobalObject;
         
@@ -580,6 +610,24 @@ return NativeApi.Application_GetCustomData_(NativePointer, ref key_Native);
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern Alternet.UI.NativeStringSpan Application_GetCustomData_(IntPtr obj, ref Alternet.UI.NativeStringSpan key);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan Application_GetPerformanceCounters_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Application_ResetPerformanceCounters_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Application_StartPerformanceTrace_(int maxEvents);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Application_StopPerformanceTrace_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan Application_GetPerformanceTraceJson_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Application_GetStartupTimings_(System.Int64[] timings, int timingsCount);
+            
         }
     }
 }
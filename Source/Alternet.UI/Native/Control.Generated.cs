@@ -1063,6 +1063,50 @@ NativeApi.Control_SetBoundsEx_(NativePointer, ref rect_Native, flags);
             return NativeApi.Control_GetScrollBarEvtPosition_(NativePointer);
         }
         
+        public void FlushRecreate()
+        {
+            CheckDisposed();
+            NativeApi.Control_FlushRecreate_(NativePointer);
+        }
+        
+        public static void FlushPendingRecreations()
+        {
+            NativeApi.Control_FlushPendingRecreations_();
+        }
+        
+        public static Alternet.UI.NativeStringSpan GetRecreationStats()
+        {
+            return NativeApi.Control_GetRecreationStats_();
+        }
+        
+        public static void ResetRecreationStats()
+        {
+            NativeApi.Control_ResetRecreationStats_();
+        }
+        
+        public void SetWindowPoolGroup(Alternet.UI.NativeStringSpan value)
+        {
+            CheckDisposed();
+            var value_Native = value.ToNative();
+NativeApi.Control_SetWindowPoolGroup_(NativePointer, ref value_Native);
+        }
+        
+        public static void SetWindowPoolCapacity(Alternet.UI.NativeStringSpan group, int capacity)
+        {
+            var group_Native = group.ToNative();
+NativeApi.Control_SetWindowPoolCapacity_(ref group_Native, capacity);
+        }
+        
+        public static Alternet.UI.NativeStringSpan GetWindowPoolStats()
+        {
+            return NativeApi.Control_GetWindowPoolStats_();
+        }
+        
+        public static void ClearWindowPool()
+        {
+            NativeApi.Control_ClearWindowPool_();
+        }
+        
         static GCHandle eventCallbackGCHandle;
         public static Control? GlobalObject;
         
@@ -1684,6 +1728,30 @@ NativeApi.Control_SetBoundsEx_(NativePointer, ref rect_Native, flags);
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern int Control_GetScrollBarEvtPosition_(IntPtr obj);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Control_FlushRecreate_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Control_FlushPendingRecreations_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan Control_GetRecreationStats_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Control_ResetRecreationStats_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Control_SetWindowPoolGroup_(IntPtr obj, ref Alternet.UI.NativeStringSpan value);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Control_SetWindowPoolCapacity_(ref Alternet.UI.NativeStringSpan group, int capacity);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan Control_GetWindowPoolStats_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Control_ClearWindowPool_();
+            
         }
     }
 }
@@ -302,6 +302,38 @@ NativeApi.DrawingContext_DrawRoundedRectangle_(NativePointer, pen.NativePointer,
 NativeApi.DrawingContext_FillRoundedRectangle_(NativePointer, brush.NativePointer, ref rect_Native, cornerRadius);
         }
         
+        public static DrawingContext CreateHeadless(GenericImage target)
+        {
+            var _nnn = NativeApi.DrawingContext_CreateHeadless_(target.NativePointer);
+            var _mmm = NativeObject.GetFromNativePointer<DrawingContext>(_nnn, p => new DrawingContext(p))!;
+            ReleaseNativeObjectPointer(_nnn);
+            return _mmm;
+        }
+        
+        public void Flush()
+        {
+            CheckDisposed();
+            NativeApi.DrawingContext_Flush_(NativePointer);
+        }
+        
+        public void FillRectangles(Brush brush, System.Single[] rects)
+        {
+            CheckDisposed();
+            NativeApi.DrawingContext_FillRectangles_(NativePointer, brush.NativePointer, rects, rects.Length);
+        }
+        
+        public void DrawLineSegments(Pen pen, System.Single[] points)
+        {
+            CheckDisposed();
+            NativeApi.DrawingContext_DrawLineSegments_(NativePointer, pen.NativePointer, points, points.Length);
+        }
+        
+        public void DrawLines(Pen pen, System.Single[] points)
+        {
+            CheckDisposed();
+            NativeApi.DrawingContext_DrawLines_(NativePointer, pen.NativePointer, points, points.Length);
+        }
+        
         
         [SuppressUnmanagedCodeSecurity]
         public class NativeApi : NativeApiProvider
@@ -428,6 +460,21 @@ NativeApi.DrawingContext_FillRoundedRectangle_(NativePointer, brush.NativePointe
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern void DrawingContext_FillRoundedRectangle_(IntPtr obj, IntPtr brush, ref Alternet.Drawing.RectD rect, float cornerRadius);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr DrawingContext_CreateHeadless_(IntPtr target);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void DrawingContext_Flush_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void DrawingContext_FillRectangles_(IntPtr obj, IntPtr brush, System.Single[] rects, int rectsCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void DrawingContext_DrawLineSegments_(IntPtr obj, IntPtr pen, System.Single[] points, int pointsCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void DrawingContext_DrawLines_(IntPtr obj, IntPtr pen, System.Single[] points, int pointsCount);
+            
         }
     }
 }
@@ -569,6 +569,75 @@ return NativeApi.GenericImage_GetImageCountInFile_(ref filename_Native, bitmapTy
             NativeApi.GenericImage_UnlockBits_(handle);
         }
         
+        public static long DecodeFileAsync(Alternet.UI.NativeStringSpan path, int bitmapType, int index)
+        {
+            var path_Native = path.ToNative();
+return NativeApi.GenericImage_DecodeFileAsync_(ref path_Native, bitmapType, index);
+        }
+        
+        public static long DecodeMemoryAsync(System.Byte[] data, int bitmapType, int index)
+        {
+            return NativeApi.GenericImage_DecodeMemoryAsync_(data, data.Length, bitmapType, index);
+        }
+        
+        public static bool CancelDecode(long id)
+        {
+            return NativeApi.GenericImage_CancelDecode_(id);
+        }
+        
+        public static int PollDecoded(System.Int64[] results)
+        {
+            return NativeApi.GenericImage_PollDecoded_(results, results.Length);
+        }
+        
+        public static void SetDecodeThreadCount(int value)
+        {
+            NativeApi.GenericImage_SetDecodeThreadCount_(value);
+        }
+        
+        public static int GetDecodeThreadCount()
+        {
+            return NativeApi.GenericImage_GetDecodeThreadCount_();
+        }
+        
+        public static int GetDecodePendingCount()
+        {
+            return NativeApi.GenericImage_GetDecodePendingCount_();
+        }
+        
+        public static System.IntPtr CreateThumbnailFromFile(Alternet.UI.NativeStringSpan path, int width, int height)
+        {
+            var path_Native = path.ToNative();
+return NativeApi.GenericImage_CreateThumbnailFromFile_(ref path_Native, width, height);
+        }
+        
+        public static System.IntPtr CreateThumbnailFromMemory(System.Byte[] data, int width, int height)
+        {
+            return NativeApi.GenericImage_CreateThumbnailFromMemory_(data, data.Length, width, height);
+        }
+        
+        public static long DecodeThumbnailAsync(Alternet.UI.NativeStringSpan path, int width, int height)
+        {
+            var path_Native = path.ToNative();
+return NativeApi.GenericImage_DecodeThumbnailAsync_(ref path_Native, width, height);
+        }
+        
+        public static void SetEnabledImageTypes(System.Int32[] bitmapTypes)
+        {
+            NativeApi.GenericImage_SetEnabledImageTypes_(bitmapTypes, bitmapTypes.Length);
+        }
+        
+        public static System.IntPtr CreateImageFromMappedFile(Alternet.UI.NativeStringSpan path)
+        {
+            var path_Native = path.ToNative();
+return NativeApi.GenericImage_CreateImageFromMappedFile_(ref path_Native);
+        }
+        
+        public static bool SaveStreamWithPreset(System.IntPtr handle, OutputStream stream, int bitmapType, int preset, int quality, int compressionLevel, int filter, int threadCount)
+        {
+            return NativeApi.GenericImage_SaveStreamWithPreset_(handle, stream.NativePointer, bitmapType, preset, quality, compressionLevel, filter, threadCount);
+        }
+        
         
         [SuppressUnmanagedCodeSecurity]
         public class NativeApi : NativeApiProvider
@@ -887,6 +956,45 @@ return NativeApi.GenericImage_GetImageCountInFile_(ref filename_Native, bitmapTy
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern void GenericImage_UnlockBits_(System.IntPtr handle);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long GenericImage_DecodeFileAsync_(ref Alternet.UI.NativeStringSpan path, int bitmapType, int index);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long GenericImage_DecodeMemoryAsync_(System.Byte[] data, int dataCount, int bitmapType, int index);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool GenericImage_CancelDecode_(long id);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int GenericImage_PollDecoded_(System.Int64[] results, int resultsCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void GenericImage_SetDecodeThreadCount_(int value);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int GenericImage_GetDecodeThreadCount_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int GenericImage_GetDecodePendingCount_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern System.IntPtr GenericImage_CreateThumbnailFromFile_(ref Alternet.UI.NativeStringSpan path, int width, int height);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern System.IntPtr GenericImage_CreateThumbnailFromMemory_(System.Byte[] data, int dataCount, int width, int height);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long GenericImage_DecodeThumbnailAsync_(ref Alternet.UI.NativeStringSpan path, int width, int height);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void GenericImage_SetEnabledImageTypes_(System.Int32[] bitmapTypes, int bitmapTypesCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern System.IntPtr GenericImage_CreateImageFromMappedFile_(ref Alternet.UI.NativeStringSpan path);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool GenericImage_SaveStreamWithPreset_(System.IntPtr handle, IntPtr stream, int bitmapType, int preset, int quality, int compressionLevel, int filter, int threadCount);
+            
         }
     }
 }
@@ -47,6 +47,12 @@ namespace Alternet.UI.Native
             return NativeApi.IconSet_IsOk_(NativePointer);
         }
         
+        public void AddImageBundle(ImageBundle bundle)
+        {
+            CheckDisposed();
+            NativeApi.IconSet_AddImageBundle_(NativePointer, bundle.NativePointer);
+        }
+        
         
         [SuppressUnmanagedCodeSecurity]
         public class NativeApi : NativeApiProvider
@@ -68,6 +74,9 @@ namespace Alternet.UI.Native
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern bool IconSet_IsOk_(IntPtr obj);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void IconSet_AddImageBundle_(IntPtr obj, IntPtr bundle);
+            
         }
     }
 }
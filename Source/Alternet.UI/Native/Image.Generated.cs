@@ -359,6 +359,59 @@ return NativeApi.Image_Rescale_(NativePointer, ref sizeNeeded_Native);
             NativeApi.Image_UnlockBits_(NativePointer);
         }
         
+        public void SetBundle(ImageBundle? bundle)
+        {
+            CheckDisposed();
+            NativeApi.Image_SetBundle_(NativePointer, bundle?.NativePointer ?? IntPtr.Zero);
+        }
+        
+        public bool SaveStreamWithPreset(OutputStream stream, int bitmapType, int preset, int quality, int compressionLevel, int filter, int threadCount)
+        {
+            CheckDisposed();
+            return NativeApi.Image_SaveStreamWithPreset_(NativePointer, stream.NativePointer, bitmapType, preset, quality, compressionLevel, filter, threadCount);
+        }
+        
+        public bool SaveFileWithPreset(Alternet.UI.NativeStringSpan fileName, int bitmapType, int preset, int quality, int compressionLevel, int filter, int threadCount)
+        {
+            CheckDisposed();
+            var fileName_Native = fileName.ToNative();
+return NativeApi.Image_SaveFileWithPreset_(NativePointer, ref fileName_Native, bitmapType, preset, quality, compressionLevel, filter, threadCount);
+        }
+        
+        public static Image CreatePooled(int width, int height, int depth, double scaleFactor)
+        {
+            var _nnn = NativeApi.Image_CreatePooled_(width, height, depth, scaleFactor);
+            var _mmm = NativeObject.GetFromNativePointer<Image>(_nnn, p => new Image(p))!;
+            ReleaseNativeObjectPointer(_nnn);
+            return _mmm;
+        }
+        
+        public void ReturnToPool()
+        {
+            CheckDisposed();
+            NativeApi.Image_ReturnToPool_(NativePointer);
+        }
+        
+        public static void SetBitmapPoolLimit(long value)
+        {
+            NativeApi.Image_SetBitmapPoolLimit_(value);
+        }
+        
+        public static long GetBitmapPoolLimit()
+        {
+            return NativeApi.Image_GetBitmapPoolLimit_();
+        }
+        
+        public static long GetBitmapPoolBytes()
+        {
+            return NativeApi.Image_GetBitmapPoolBytes_();
+        }
+        
+        public static void ClearBitmapPool()
+        {
+            NativeApi.Image_ClearBitmapPool_();
+        }
+        
         
         [SuppressUnmanagedCodeSecurity]
         public class NativeApi : NativeApiProvider
@@ -500,6 +553,33 @@ return NativeApi.Image_Rescale_(NativePointer, ref sizeNeeded_Native);
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern void Image_UnlockBits_(IntPtr obj);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Image_SetBundle_(IntPtr obj, IntPtr bundle);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool Image_SaveStreamWithPreset_(IntPtr obj, IntPtr stream, int bitmapType, int preset, int quality, int compressionLevel, int filter, int threadCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool Image_SaveFileWithPreset_(IntPtr obj, ref Alternet.UI.NativeStringSpan fileName, int bitmapType, int preset, int quality, int compressionLevel, int filter, int threadCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr Image_CreatePooled_(int width, int height, int depth, double scaleFactor);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Image_ReturnToPool_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Image_SetBitmapPoolLimit_(long value);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long Image_GetBitmapPoolLimit_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long Image_GetBitmapPoolBytes_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void Image_ClearBitmapPool_();
+            
         }
     }
 }
@@ -0,0 +1,117 @@
+// <auto-generated> DO NOT MODIFY MANUALLY. Copyright (c) 2026 AlterNET Software.</auto-generated>
+#nullable enable
+#pragma warning disable
+
+using System;
+using System.Runtime.InteropServices;
+using System.ComponentModel;
+using System.Security;
+namespace Alternet.UI.Native
+{
+    internal partial class ImageBundle : NativeObject
+    {
+        static ImageBundle()
+        {
+        }
+        
+        public ImageBundle()
+        {
+            SetNativePointer(NativeApi.ImageBundle_Create_());
+        }
+        
+        public ImageBundle(IntPtr nativePointer) : base(nativePointer)
+        {
+        }
+        
+        public void AddImage(Image image)
+        {
+            CheckDisposed();
+            NativeApi.ImageBundle_AddImage_(NativePointer, image.NativePointer);
+        }
+        
+        public bool LoadSvgFromString(Alternet.UI.NativeStringSpan s, int width, int height, Alternet.Drawing.Color color)
+        {
+            CheckDisposed();
+            var s_Native = s.ToNative();
+var color_Native = color.ToNative();
+return NativeApi.ImageBundle_LoadSvgFromString_(NativePointer, ref s_Native, width, height, ref color_Native);
+        }
+        
+        public void Clear()
+        {
+            CheckDisposed();
+            NativeApi.ImageBundle_Clear_(NativePointer);
+        }
+        
+        public bool IsOk()
+        {
+            CheckDisposed();
+            return NativeApi.ImageBundle_IsOk_(NativePointer);
+        }
+        
+        public Image GetImage(double scale)
+        {
+            CheckDisposed();
+            var _nnn = NativeApi.ImageBundle_GetImage_(NativePointer, scale);
+            var _mmm = NativeObject.GetFromNativePointer<Image>(_nnn, p => new Image(p))!;
+            ReleaseNativeObjectPointer(_nnn);
+            return _mmm;
+        }
+        
+        public Image GetImageForControl(Control control)
+        {
+            CheckDisposed();
+            var _nnn = NativeApi.ImageBundle_GetImageForControl_(NativePointer, control.NativePointer);
+            var _mmm = NativeObject.GetFromNativePointer<Image>(_nnn, p => new Image(p))!;
+            ReleaseNativeObjectPointer(_nnn);
+            return _mmm;
+        }
+        
+        public int GetCachedCount()
+        {
+            CheckDisposed();
+            return NativeApi.ImageBundle_GetCachedCount_(NativePointer);
+        }
+        
+        public void ClearCache()
+        {
+            CheckDisposed();
+            NativeApi.ImageBundle_ClearCache_(NativePointer);
+        }
+        
+        
+        [SuppressUnmanagedCodeSecurity]
+        public class NativeApi : NativeApiProvider
+        {
+            static NativeApi() => Initialize();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr ImageBundle_Create_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void ImageBundle_AddImage_(IntPtr obj, IntPtr image);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool ImageBundle_LoadSvgFromString_(IntPtr obj, ref Alternet.UI.NativeStringSpan s, int width, int height, ref NativeApiTypes.Color color);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void ImageBundle_Clear_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool ImageBundle_IsOk_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr ImageBundle_GetImage_(IntPtr obj, double scale);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr ImageBundle_GetImageForControl_(IntPtr obj, IntPtr control);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int ImageBundle_GetCachedCount_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void ImageBundle_ClearCache_(IntPtr obj);
+            
+        }
+    }
+}
@@ -63,6 +63,21 @@ namespace Alternet.UI.Native
             
         }
         
+        public bool UseAtlas
+        {
+            get
+            {
+                CheckDisposed();
+                return NativeApi.ImageList_GetUseAtlas_(NativePointer);
+            }
+            
+            set
+            {
+                CheckDisposed();
+                NativeApi.ImageList_SetUseAtlas_(NativePointer, value);
+            }
+        }
+        
         public void AddImage(Image image)
         {
             CheckDisposed();
@@ -93,6 +108,18 @@ namespace Alternet.UI.Native
             return NativeApi.ImageList_Clear_(NativePointer);
         }
         
+        public int AddImages(System.Int64[] images)
+        {
+            CheckDisposed();
+            return NativeApi.ImageList_AddImages_(NativePointer, images, images.Length);
+        }
+        
+        public void Draw(DrawingContext dc, int index, int x, int y)
+        {
+            CheckDisposed();
+            NativeApi.ImageList_Draw_(NativePointer, dc.NativePointer, index, x, y);
+        }
+        
         
         [SuppressUnmanagedCodeSecurity]
         public class NativeApi : NativeApiProvider
@@ -129,6 +156,18 @@ namespace Alternet.UI.Native
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern bool ImageList_Clear_(IntPtr obj);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool ImageList_GetUseAtlas_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void ImageList_SetUseAtlas_(IntPtr obj, bool value);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int ImageList_AddImages_(IntPtr obj, System.Int64[] images, int imagesCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void ImageList_Draw_(IntPtr obj, IntPtr dc, int index, int x, int y);
+            
         }
     }
 }
@@ -0,0 +1,101 @@
+// <auto-generated> DO NOT MODIFY MANUALLY. Copyright (c) 2026 AlterNET Software.</auto-generated>
+#nullable enable
+#pragma warning disable
+
+using System;
+using System.Runtime.InteropServices;
+using System.ComponentModel;
+using System.Security;
+namespace Alternet.UI.Native
+{
+    internal partial class MappedImage : NativeObject
+    {
+        static MappedImage()
+        {
+        }
+        
+        public MappedImage()
+        {
+            SetNativePointer(NativeApi.MappedImage_Create_());
+        }
+        
+        public MappedImage(IntPtr nativePointer) : base(nativePointer)
+        {
+        }
+        
+        public bool Open(Alternet.UI.NativeStringSpan path)
+        {
+            CheckDisposed();
+            var path_Native = path.ToNative();
+return NativeApi.MappedImage_Open_(NativePointer, ref path_Native);
+        }
+        
+        public void Close()
+        {
+            CheckDisposed();
+            NativeApi.MappedImage_Close_(NativePointer);
+        }
+        
+        public bool IsOk()
+        {
+            CheckDisposed();
+            return NativeApi.MappedImage_IsOk_(NativePointer);
+        }
+        
+        public int GetWidth()
+        {
+            CheckDisposed();
+            return NativeApi.MappedImage_GetWidth_(NativePointer);
+        }
+        
+        public int GetHeight()
+        {
+            CheckDisposed();
+            return NativeApi.MappedImage_GetHeight_(NativePointer);
+        }
+        
+        public System.IntPtr ReadImage()
+        {
+            CheckDisposed();
+            return NativeApi.MappedImage_ReadImage_(NativePointer);
+        }
+        
+        public System.IntPtr ReadRegion(int x, int y, int width, int height)
+        {
+            CheckDisposed();
+            return NativeApi.MappedImage_ReadRegion_(NativePointer, x, y, width, height);
+        }
+        
+        
+        [SuppressUnmanagedCodeSecurity]
+        public class NativeApi : NativeApiProvider
+        {
+            static NativeApi() => Initialize();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr MappedImage_Create_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool MappedImage_Open_(IntPtr obj, ref Alternet.UI.NativeStringSpan path);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void MappedImage_Close_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool MappedImage_IsOk_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int MappedImage_GetWidth_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int MappedImage_GetHeight_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern System.IntPtr MappedImage_ReadImage_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern System.IntPtr MappedImage_ReadRegion_(IntPtr obj, int x, int y, int width, int height);
+            
+        }
+    }
+}
@@ -1358,6 +1358,65 @@ NativeApi.PropertyGrid_SetPropertyAttribute_(NativePointer, id, ref attrName_Nat
 NativeApi.PropertyGrid_SetPropertyAttributeAll_(NativePointer, ref attrName_Native, variant);
         }
         
+        public int AppendProperties(System.Int64[] schema, Alternet.UI.NativeStringSpan strings, System.Int64[] results)
+        {
+            CheckDisposed();
+            var strings_Native = strings.ToNative();
+return NativeApi.PropertyGrid_AppendProperties_(NativePointer, schema, schema.Length, ref strings_Native, results, results.Length);
+        }
+        
+        public int SetPropertyValues(System.Int64[] values, Alternet.UI.NativeStringSpan strings)
+        {
+            CheckDisposed();
+            var strings_Native = strings.ToNative();
+return NativeApi.PropertyGrid_SetPropertyValues_(NativePointer, values, values.Length, ref strings_Native);
+        }
+        
+        public int ApplyPropertyValues(System.Int64[] values, Alternet.UI.NativeStringSpan strings)
+        {
+            CheckDisposed();
+            var strings_Native = strings.ToNative();
+return NativeApi.PropertyGrid_ApplyPropertyValues_(NativePointer, values, values.Length, ref strings_Native);
+        }
+        
+        public int GetPropertyValues(System.Int64[] values)
+        {
+            CheckDisposed();
+            return NativeApi.PropertyGrid_GetPropertyValues_(NativePointer, values, values.Length);
+        }
+        
+        public Alternet.UI.NativeStringSpan GetPropertyValuesText()
+        {
+            CheckDisposed();
+            return NativeApi.PropertyGrid_GetPropertyValuesText_(NativePointer);
+        }
+        
+        public Alternet.UI.NativeStringSpan GetEventPropValueInline(System.Int64[] value)
+        {
+            CheckDisposed();
+            return NativeApi.PropertyGrid_GetEventPropValueInline_(NativePointer, value, value.Length);
+        }
+        
+        public Alternet.UI.NativeStringSpan GetPropertyValueInline(System.IntPtr id, System.Int64[] value)
+        {
+            CheckDisposed();
+            return NativeApi.PropertyGrid_GetPropertyValueInline_(NativePointer, id, value, value.Length);
+        }
+        
+        public void SetPropertyValueInline(System.IntPtr id, System.Int64[] value, Alternet.UI.NativeStringSpan text)
+        {
+            CheckDisposed();
+            var text_Native = text.ToNative();
+NativeApi.PropertyGrid_SetPropertyValueInline_(NativePointer, id, value, value.Length, ref text_Native);
+        }
+        
+        public bool ChangePropertyValueInline(System.IntPtr id, System.Int64[] value, Alternet.UI.NativeStringSpan text)
+        {
+            CheckDisposed();
+            var text_Native = text.ToNative();
+return NativeApi.PropertyGrid_ChangePropertyValueInline_(NativePointer, id, value, value.Length, ref text_Native);
+        }
+        
         static GCHandle eventCallbackGCHandle;
         public static PropertyGrid? GlobalObject;
         
@@ -2114,6 +2173,33 @@ NativeApi.PropertyGrid_SetPropertyAttributeAll_(NativePointer, ref attrName_Nati
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern void PropertyGrid_SetPropertyAttributeAll_(IntPtr obj, ref Alternet.UI.NativeStringSpan attrName, System.IntPtr variant);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int PropertyGrid_AppendProperties_(IntPtr obj, System.Int64[] schema, int schemaCount, ref Alternet.UI.NativeStringSpan strings, System.Int64[] results, int resultsCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int PropertyGrid_SetPropertyValues_(IntPtr obj, System.Int64[] values, int valuesCount, ref Alternet.UI.NativeStringSpan strings);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int PropertyGrid_ApplyPropertyValues_(IntPtr obj, System.Int64[] values, int valuesCount, ref Alternet.UI.NativeStringSpan strings);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int PropertyGrid_GetPropertyValues_(IntPtr obj, System.Int64[] values, int valuesCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan PropertyGrid_GetPropertyValuesText_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan PropertyGrid_GetEventPropValueInline_(IntPtr obj, System.Int64[] value, int valueCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan PropertyGrid_GetPropertyValueInline_(IntPtr obj, System.IntPtr id, System.Int64[] value, int valueCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void PropertyGrid_SetPropertyValueInline_(IntPtr obj, System.IntPtr id, System.Int64[] value, int valueCount, ref Alternet.UI.NativeStringSpan text);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool PropertyGrid_ChangePropertyValueInline_(IntPtr obj, System.IntPtr id, System.Int64[] value, int valueCount, ref Alternet.UI.NativeStringSpan text);
+            
         }
     }
 }
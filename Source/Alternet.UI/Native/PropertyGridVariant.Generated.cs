@@ -172,6 +172,17 @@ NativeApi.PropertyGridVariant_SetString_(handle, ref value_Native);
             return NativeApi.PropertyGridVariant_GetLastColorKind_();
         }
         
+        public static Alternet.UI.NativeStringSpan GetInline(System.IntPtr handle, System.Int64[] value)
+        {
+            return NativeApi.PropertyGridVariant_GetInline_(handle, value, value.Length);
+        }
+        
+        public static void SetInline(System.IntPtr handle, System.Int64[] value, Alternet.UI.NativeStringSpan text)
+        {
+            var text_Native = text.ToNative();
+NativeApi.PropertyGridVariant_SetInline_(handle, value, value.Length, ref text_Native);
+        }
+        
         
         [SuppressUnmanagedCodeSecurity]
         public class NativeApi : NativeApiProvider
@@ -268,6 +279,12 @@ NativeApi.PropertyGridVariant_SetString_(handle, ref value_Native);
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern uint PropertyGridVariant_GetLastColorKind_();
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan PropertyGridVariant_GetInline_(System.IntPtr handle, System.Int64[] value, int valueCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void PropertyGridVariant_SetInline_(System.IntPtr handle, System.Int64[] value, int valueCount, ref Alternet.UI.NativeStringSpan text);
+            
         }
     }
 }
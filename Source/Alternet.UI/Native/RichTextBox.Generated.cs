@@ -1576,6 +1576,104 @@ return NativeApi.RichTextBox_WriteField_(NativePointer, ref fieldType_Native, pr
             return NativeApi.RichTextBox_DeleteSelectedContent_(NativePointer);
         }
         
+        public int RegisterStyle(System.IntPtr style)
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_RegisterStyle_(NativePointer, style);
+        }
+        
+        public void ClearRegisteredStyles()
+        {
+            CheckDisposed();
+            NativeApi.RichTextBox_ClearRegisteredStyles_(NativePointer);
+        }
+        
+        public void ApplyStyleRuns(System.Int64[] runs)
+        {
+            CheckDisposed();
+            NativeApi.RichTextBox_ApplyStyleRuns_(NativePointer, runs, runs.Length);
+        }
+        
+        public int GetStyleId(long position)
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_GetStyleId_(NativePointer, position);
+        }
+        
+        public int GetStyleIdForRange(long startRange, long endRange)
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_GetStyleIdForRange_(NativePointer, startRange, endRange);
+        }
+        
+        public bool SetSearchPattern(Alternet.UI.NativeStringSpan pattern, int options)
+        {
+            CheckDisposed();
+            var pattern_Native = pattern.ToNative();
+return NativeApi.RichTextBox_SetSearchPattern_(NativePointer, ref pattern_Native, options);
+        }
+        
+        public int FindMatches(long start, System.Int64[] results, int timeBudgetMs)
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_FindMatches_(NativePointer, start, results, results.Length, timeBudgetMs);
+        }
+        
+        public long GetSearchCursor()
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_GetSearchCursor_(NativePointer);
+        }
+        
+        public bool BeginLoadFromStream(InputStream stream, int type)
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_BeginLoadFromStream_(NativePointer, stream.NativePointer, type);
+        }
+        
+        public bool BeginLoadFile(Alternet.UI.NativeStringSpan file, int type)
+        {
+            CheckDisposed();
+            var file_Native = file.ToNative();
+return NativeApi.RichTextBox_BeginLoadFile_(NativePointer, ref file_Native, type);
+        }
+        
+        public bool IsLoading()
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_IsLoading_(NativePointer);
+        }
+        
+        public int GetLoadProgress()
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_GetLoadProgress_(NativePointer);
+        }
+        
+        public bool GetLoadResult()
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_GetLoadResult_(NativePointer);
+        }
+        
+        public void CancelLoad()
+        {
+            CheckDisposed();
+            NativeApi.RichTextBox_CancelLoad_(NativePointer);
+        }
+        
+        public int GetStyleIdInContainer(long position, System.IntPtr container)
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_GetStyleIdInContainer_(NativePointer, position, container);
+        }
+        
+        public int GetStyleIdForRangeInContainer(long startRange, long endRange, System.IntPtr container)
+        {
+            CheckDisposed();
+            return NativeApi.RichTextBox_GetStyleIdForRangeInContainer_(NativePointer, startRange, endRange, container);
+        }
+        
         static GCHandle eventCallbackGCHandle;
         public static RichTextBox? GlobalObject;
         
@@ -1610,6 +1708,14 @@ return NativeApi.RichTextBox_WriteField_(NativePointer, ref fieldType_Native, pr
                 {
                     OnPlatformEventTextUrl(); return IntPtr.Zero;
                 }
+                case NativeApi.RichTextBoxEvent.LoadProgress:
+                {
+                    OnPlatformEventLoadProgress(); return IntPtr.Zero;
+                }
+                case NativeApi.RichTextBoxEvent.LoadCompleted:
+                {
+                    OnPlatformEventLoadCompleted(); return IntPtr.Zero;
+                }
                 default: throw new Exception("Unexpected RichTextBoxEvent value: " + e);
             }
         }
@@ -1627,6 +1733,8 @@ return NativeApi.RichTextBox_WriteField_(NativePointer, ref fieldType_Native, pr
             {
                 TextEnter,
                 TextUrl,
+                LoadProgress,
+                LoadCompleted,
             }
             
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
@@ -2397,6 +2505,54 @@ return NativeApi.RichTextBox_WriteField_(NativePointer, ref fieldType_Native, pr
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern long RichTextBox_DeleteSelectedContent_(IntPtr obj);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int RichTextBox_RegisterStyle_(IntPtr obj, System.IntPtr style);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void RichTextBox_ClearRegisteredStyles_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void RichTextBox_ApplyStyleRuns_(IntPtr obj, System.Int64[] runs, int runsCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int RichTextBox_GetStyleId_(IntPtr obj, long position);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int RichTextBox_GetStyleIdForRange_(IntPtr obj, long startRange, long endRange);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool RichTextBox_SetSearchPattern_(IntPtr obj, ref Alternet.UI.NativeStringSpan pattern, int options);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int RichTextBox_FindMatches_(IntPtr obj, long start, System.Int64[] results, int resultsCount, int timeBudgetMs);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long RichTextBox_GetSearchCursor_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool RichTextBox_BeginLoadFromStream_(IntPtr obj, IntPtr stream, int type);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool RichTextBox_BeginLoadFile_(IntPtr obj, ref Alternet.UI.NativeStringSpan file, int type);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool RichTextBox_IsLoading_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int RichTextBox_GetLoadProgress_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool RichTextBox_GetLoadResult_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void RichTextBox_CancelLoad_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int RichTextBox_GetStyleIdInContainer_(IntPtr obj, long position, System.IntPtr container);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int RichTextBox_GetStyleIdForRangeInContainer_(IntPtr obj, long startRange, long endRange, System.IntPtr container);
+            
         }
     }
 }
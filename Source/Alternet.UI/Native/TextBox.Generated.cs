@@ -541,6 +541,67 @@ NativeApi.TextBox_WriteText_(NativePointer, ref text_Native);
             return NativeApi.TextBox_GetSelectionEnd_(NativePointer);
         }
         
+        public int RegisterStyle(System.IntPtr style)
+        {
+            CheckDisposed();
+            return NativeApi.TextBox_RegisterStyle_(NativePointer, style);
+        }
+        
+        public void ClearRegisteredStyles()
+        {
+            CheckDisposed();
+            NativeApi.TextBox_ClearRegisteredStyles_(NativePointer);
+        }
+        
+        public void ApplyStyleRuns(System.Int64[] runs)
+        {
+            CheckDisposed();
+            NativeApi.TextBox_ApplyStyleRuns_(NativePointer, runs, runs.Length);
+        }
+        
+        public bool GetLogMode()
+        {
+            CheckDisposed();
+            return NativeApi.TextBox_GetLogMode_(NativePointer);
+        }
+        
+        public void SetLogMode(bool value)
+        {
+            CheckDisposed();
+            NativeApi.TextBox_SetLogMode_(NativePointer, value);
+        }
+        
+        public void SetLogLimits(int maxLines, long maxLength)
+        {
+            CheckDisposed();
+            NativeApi.TextBox_SetLogLimits_(NativePointer, maxLines, maxLength);
+        }
+        
+        public void FlushLog()
+        {
+            CheckDisposed();
+            NativeApi.TextBox_FlushLog_(NativePointer);
+        }
+        
+        public bool SetSearchPattern(Alternet.UI.NativeStringSpan pattern, int options)
+        {
+            CheckDisposed();
+            var pattern_Native = pattern.ToNative();
+return NativeApi.TextBox_SetSearchPattern_(NativePointer, ref pattern_Native, options);
+        }
+        
+        public int FindMatches(long start, System.Int64[] results, int timeBudgetMs)
+        {
+            CheckDisposed();
+            return NativeApi.TextBox_FindMatches_(NativePointer, start, results, results.Length, timeBudgetMs);
+        }
+        
+        public long GetSearchCursor()
+        {
+            CheckDisposed();
+            return NativeApi.TextBox_GetSearchCursor_(NativePointer);
+        }
+        
         static GCHandle eventCallbackGCHandle;
         public static TextBox? GlobalObject;
         
@@ -827,6 +888,36 @@ NativeApi.TextBox_WriteText_(NativePointer, ref text_Native);
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern long TextBox_GetSelectionEnd_(IntPtr obj);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int TextBox_RegisterStyle_(IntPtr obj, System.IntPtr style);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextBox_ClearRegisteredStyles_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextBox_ApplyStyleRuns_(IntPtr obj, System.Int64[] runs, int runsCount);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool TextBox_GetLogMode_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextBox_SetLogMode_(IntPtr obj, bool value);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextBox_SetLogLimits_(IntPtr obj, int maxLines, long maxLength);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextBox_FlushLog_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool TextBox_SetSearchPattern_(IntPtr obj, ref Alternet.UI.NativeStringSpan pattern, int options);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int TextBox_FindMatches_(IntPtr obj, long start, System.Int64[] results, int resultsCount, int timeBudgetMs);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long TextBox_GetSearchCursor_(IntPtr obj);
+            
         }
     }
 }
@@ -509,6 +509,36 @@ NativeApi.TextBoxTextAttr_SetBulletName_(attr, ref name_Native);
             NativeApi.TextBoxTextAttr_AddFlag_(attr, flag);
         }
         
+        public static int InternAttr(System.IntPtr attr)
+        {
+            return NativeApi.TextBoxTextAttr_InternAttr_(attr);
+        }
+        
+        public static System.IntPtr GetPooledAttr(int id)
+        {
+            return NativeApi.TextBoxTextAttr_GetPooledAttr_(id);
+        }
+        
+        public static int GetPooledAttrCount()
+        {
+            return NativeApi.TextBoxTextAttr_GetPooledAttrCount_();
+        }
+        
+        public static void ClearAttrPool()
+        {
+            NativeApi.TextBoxTextAttr_ClearAttrPool_();
+        }
+        
+        public static bool ReadPacked(System.IntPtr attr, System.IntPtr buffer, int bufferSize)
+        {
+            return NativeApi.TextBoxTextAttr_ReadPacked_(attr, buffer, bufferSize);
+        }
+        
+        public static bool ReadPackedPooledAttr(int id, System.IntPtr buffer, int bufferSize)
+        {
+            return NativeApi.TextBoxTextAttr_ReadPackedPooledAttr_(id, buffer, bufferSize);
+        }
+        
         
         [SuppressUnmanagedCodeSecurity]
         public class NativeApi : NativeApiProvider
@@ -803,6 +833,24 @@ NativeApi.TextBoxTextAttr_SetBulletName_(attr, ref name_Native);
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern void TextBoxTextAttr_AddFlag_(System.IntPtr attr, long flag);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int TextBoxTextAttr_InternAttr_(System.IntPtr attr);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern System.IntPtr TextBoxTextAttr_GetPooledAttr_(int id);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int TextBoxTextAttr_GetPooledAttrCount_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextBoxTextAttr_ClearAttrPool_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool TextBoxTextAttr_ReadPacked_(System.IntPtr attr, System.IntPtr buffer, int bufferSize);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool TextBoxTextAttr_ReadPackedPooledAttr_(int id, System.IntPtr buffer, int bufferSize);
+            
         }
     }
 }
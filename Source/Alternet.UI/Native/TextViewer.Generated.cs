@@ -0,0 +1,239 @@
+// <auto-generated> DO NOT MODIFY MANUALLY. Copyright (c) 2026 AlterNET Software.</auto-generated>
+#nullable enable
+#pragma warning disable
+
+using System;
+using System.Runtime.InteropServices;
+using System.ComponentModel;
+using System.Security;
+namespace Alternet.UI.Native
+{
+    internal partial class TextViewer : Control
+    {
+        static TextViewer()
+        {
+        }
+        
+        public TextViewer()
+        {
+            SetNativePointer(NativeApi.TextViewer_Create_());
+        }
+        
+        public TextViewer(IntPtr nativePointer) : base(nativePointer)
+        {
+        }
+        
+        public bool LoadFile(Alternet.UI.NativeStringSpan path)
+        {
+            CheckDisposed();
+            var path_Native = path.ToNative();
+return NativeApi.TextViewer_LoadFile_(NativePointer, ref path_Native);
+        }
+        
+        public void SetText(Alternet.UI.NativeStringSpan text)
+        {
+            CheckDisposed();
+            var text_Native = text.ToNative();
+NativeApi.TextViewer_SetText_(NativePointer, ref text_Native);
+        }
+        
+        public void AppendText(Alternet.UI.NativeStringSpan text)
+        {
+            CheckDisposed();
+            var text_Native = text.ToNative();
+NativeApi.TextViewer_AppendText_(NativePointer, ref text_Native);
+        }
+        
+        public void ClearText()
+        {
+            CheckDisposed();
+            NativeApi.TextViewer_ClearText_(NativePointer);
+        }
+        
+        public long GetLength()
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetLength_(NativePointer);
+        }
+        
+        public long GetLineCount()
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetLineCount_(NativePointer);
+        }
+        
+        public bool GetIsIndexing()
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetIsIndexing_(NativePointer);
+        }
+        
+        public long GetLineStart(long line)
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetLineStart_(NativePointer, line);
+        }
+        
+        public long GetLineFromOffset(long offset)
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetLineFromOffset_(NativePointer, offset);
+        }
+        
+        public Alternet.UI.NativeStringSpan GetLineText(long line)
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetLineText_(NativePointer, line);
+        }
+        
+        public Alternet.UI.NativeStringSpan GetTextRange(long offset, long length)
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetTextRange_(NativePointer, offset, length);
+        }
+        
+        public long FindText(Alternet.UI.NativeStringSpan text, long start, bool matchCase)
+        {
+            CheckDisposed();
+            var text_Native = text.ToNative();
+return NativeApi.TextViewer_FindText_(NativePointer, ref text_Native, start, matchCase);
+        }
+        
+        public void SetSelection(long start, long end)
+        {
+            CheckDisposed();
+            NativeApi.TextViewer_SetSelection_(NativePointer, start, end);
+        }
+        
+        public long GetSelectionStart()
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetSelectionStart_(NativePointer);
+        }
+        
+        public long GetSelectionEnd()
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetSelectionEnd_(NativePointer);
+        }
+        
+        public void SelectAll()
+        {
+            CheckDisposed();
+            NativeApi.TextViewer_SelectAll_(NativePointer);
+        }
+        
+        public Alternet.UI.NativeStringSpan GetSelectedText()
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetSelectedText_(NativePointer);
+        }
+        
+        public bool CopySelection()
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_CopySelection_(NativePointer);
+        }
+        
+        public void ScrollToLine(long line)
+        {
+            CheckDisposed();
+            NativeApi.TextViewer_ScrollToLine_(NativePointer, line);
+        }
+        
+        public void ScrollToOffset(long offset)
+        {
+            CheckDisposed();
+            NativeApi.TextViewer_ScrollToOffset_(NativePointer, offset);
+        }
+        
+        public long GetFirstVisibleLine()
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetFirstVisibleLine_(NativePointer);
+        }
+        
+        public int GetVisibleLineCount()
+        {
+            CheckDisposed();
+            return NativeApi.TextViewer_GetVisibleLineCount_(NativePointer);
+        }
+        
+        
+        [SuppressUnmanagedCodeSecurity]
+        public class NativeApi : NativeApiProvider
+        {
+            static NativeApi() => Initialize();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr TextViewer_Create_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool TextViewer_LoadFile_(IntPtr obj, ref Alternet.UI.NativeStringSpan path);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextViewer_SetText_(IntPtr obj, ref Alternet.UI.NativeStringSpan text);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextViewer_AppendText_(IntPtr obj, ref Alternet.UI.NativeStringSpan text);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextViewer_ClearText_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long TextViewer_GetLength_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long TextViewer_GetLineCount_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool TextViewer_GetIsIndexing_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long TextViewer_GetLineStart_(IntPtr obj, long line);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long TextViewer_GetLineFromOffset_(IntPtr obj, long offset);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan TextViewer_GetLineText_(IntPtr obj, long line);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan TextViewer_GetTextRange_(IntPtr obj, long offset, long length);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long TextViewer_FindText_(IntPtr obj, ref Alternet.UI.NativeStringSpan text, long start, bool matchCase);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextViewer_SetSelection_(IntPtr obj, long start, long end);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long TextViewer_GetSelectionStart_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long TextViewer_GetSelectionEnd_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextViewer_SelectAll_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern Alternet.UI.NativeStringSpan TextViewer_GetSelectedText_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool TextViewer_CopySelection_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextViewer_ScrollToLine_(IntPtr obj, long line);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void TextViewer_ScrollToOffset_(IntPtr obj, long offset);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long TextViewer_GetFirstVisibleLine_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int TextViewer_GetVisibleLineCount_(IntPtr obj);
+            
+        }
+    }
+}
@@ -593,6 +593,31 @@ NativeApi.WebBrowser_SetPage_(NativePointer, ref text_Native, ref baseUrl_Native
 return NativeApi.WebBrowser_AddUserScript_(NativePointer, ref javascript_Native, injectionTime);
         }
         
+        public long QueueScript(Alternet.UI.NativeStringSpan javascript)
+        {
+            CheckDisposed();
+            var javascript_Native = javascript.ToNative();
+return NativeApi.WebBrowser_QueueScript_(NativePointer, ref javascript_Native);
+        }
+        
+        public void FlushScripts()
+        {
+            CheckDisposed();
+            NativeApi.WebBrowser_FlushScripts_(NativePointer);
+        }
+        
+        public void SetScriptMessageBatching(bool value)
+        {
+            CheckDisposed();
+            NativeApi.WebBrowser_SetScriptMessageBatching_(NativePointer, value);
+        }
+        
+        public bool GetScriptMessageBatching()
+        {
+            CheckDisposed();
+            return NativeApi.WebBrowser_GetScriptMessageBatching_(NativePointer);
+        }
+        
         static GCHandle eventCallbackGCHandle;
         public static WebBrowser? GlobalObject;
         
@@ -669,6 +694,16 @@ return NativeApi.WebBrowser_AddUserScript_(NativePointer, ref javascript_Native,
                     var ea = new NativeEventArgs<WebBrowserEventData>(MarshalEx.PtrToStructure<WebBrowserEventData>(parameter));
                     OnPlatformEventBeforeBrowserCreate(ea); return ea.Result;
                 }
+                case NativeApi.WebBrowserEvent.ScriptBatchResult:
+                {
+                    var ea = new NativeEventArgs<WebBrowserEventData>(MarshalEx.PtrToStructure<WebBrowserEventData>(parameter));
+                    OnPlatformEventScriptBatchResult(ea); return ea.Result;
+                }
+                case NativeApi.WebBrowserEvent.ScriptMessageBatch:
+                {
+                    var ea = new NativeEventArgs<WebBrowserEventData>(MarshalEx.PtrToStructure<WebBrowserEventData>(parameter));
+                    OnPlatformEventScriptMessageBatch(ea); return ea.Result;
+                }
                 default: throw new Exception("Unexpected WebBrowserEvent value: " + e);
             }
         }
@@ -694,6 +729,8 @@ return NativeApi.WebBrowser_AddUserScript_(NativePointer, ref javascript_Native,
                 ScriptMessageReceived,
                 ScriptResult,
                 BeforeBrowserCreate,
+                ScriptBatchResult,
+                ScriptMessageBatch,
             }
             
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
@@ -951,6 +988,18 @@ return NativeApi.WebBrowser_AddUserScript_(NativePointer, ref javascript_Native,
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern bool WebBrowser_AddUserScript_(IntPtr obj, ref Alternet.UI.NativeStringSpan javascript, int injectionTime);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long WebBrowser_QueueScript_(IntPtr obj, ref Alternet.UI.NativeStringSpan javascript);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void WebBrowser_FlushScripts_(IntPtr obj);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void WebBrowser_SetScriptMessageBatching_(IntPtr obj, bool value);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern bool WebBrowser_GetScriptMessageBatching_(IntPtr obj);
+            
         }
     }
 }
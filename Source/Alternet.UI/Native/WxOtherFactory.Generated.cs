@@ -496,6 +496,32 @@ NativeApi.WxOtherFactory_RendererDrawItemText_(renderer, win, dc.NativePointer,
             return NativeApi.WxOtherFactory_RendererGetVersion_(renderer);
         }
         
+        public static int RendererDrawBatch(System.IntPtr renderer, System.IntPtr win, Image dc, System.Int64[] records, Alternet.UI.NativeStringSpan strings, bool useCache)
+        {
+            var strings_Native = strings.ToNative();
+return NativeApi.WxOtherFactory_RendererDrawBatch_(renderer, win, dc.NativePointer, records, records.Length, ref strings_Native, useCache);
+        }
+        
+        public static void RendererSetPartCacheLimit(long value)
+        {
+            NativeApi.WxOtherFactory_RendererSetPartCacheLimit_(value);
+        }
+        
+        public static long RendererGetPartCacheLimit()
+        {
+            return NativeApi.WxOtherFactory_RendererGetPartCacheLimit_();
+        }
+        
+        public static long RendererGetPartCacheBytes()
+        {
+            return NativeApi.WxOtherFactory_RendererGetPartCacheBytes_();
+        }
+        
+        public static void RendererClearPartCache()
+        {
+            NativeApi.WxOtherFactory_RendererClearPartCache_();
+        }
+        
         public static System.IntPtr MemoryAlloc(ulong size)
         {
             return NativeApi.WxOtherFactory_MemoryAlloc_(size);
@@ -964,6 +990,21 @@ return NativeApi.WxOtherFactory_UIActionSimulatorText_(handle, ref text_Native);
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern Alternet.UI.NativeStringSpan WxOtherFactory_RendererGetVersion_(System.IntPtr renderer);
             
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern int WxOtherFactory_RendererDrawBatch_(System.IntPtr renderer, System.IntPtr win, IntPtr dc, System.Int64[] records, int recordsCount, ref Alternet.UI.NativeStringSpan strings, bool useCache);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void WxOtherFactory_RendererSetPartCacheLimit_(long value);
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long WxOtherFactory_RendererGetPartCacheLimit_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern long WxOtherFactory_RendererGetPartCacheBytes_();
+            
+            [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
+            public static extern void WxOtherFactory_RendererClearPartCache_();
+            
             [DllImport(NativeModuleName, CallingConvention = CallingConvention.Cdecl)]
             public static extern System.IntPtr WxOtherFactory_MemoryAlloc_(ulong size);
             
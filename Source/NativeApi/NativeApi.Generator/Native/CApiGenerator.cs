@@ -82,7 +82,7 @@ namespace ApiGenerator.Native
                 w.WriteLine("{");
                 w.Indent++;
 
-                using (new MarshalExceptionsScope(w, propertyTypeName))
+                using (new MarshalExceptionsScope(w, $"{declaringTypeName}_Get{propertyName}_", propertyTypeName))
                 {
                     var callPrefix = isStatic ? declaringTypeName + "::" : "obj->";
 
@@ -106,7 +106,7 @@ namespace ApiGenerator.Native
                 w.WriteLine($"{ExportMacro} void {declaringTypeName}_Set{propertyName}_({instanceArgument}{types.GetTypeName(property.ToContextualProperty(), TypeUsage.Argument)} value)");
                 w.WriteLine("{");
                 w.Indent++;
-                using (new MarshalExceptionsScope(w, "void"))
+                using (new MarshalExceptionsScope(w, $"{declaringTypeName}_Set{propertyName}_", "void"))
                     w.WriteLine($"{callPrefix}Set{propertyName}({GetCToCppArgument(property.ToContextualProperty(), "value")});");
                 w.Indent--;
                 w.WriteLine("}");
@@ -121,12 +121,15 @@ namespace ApiGenerator.Native
             private readonly IndentedTextWriter writer;
             private readonly string conditional;
 
-            public MarshalExceptionsScope(IndentedTextWriter writer, string returnTypeName)
+            public MarshalExceptionsScope(IndentedTextWriter writer, string exportName, string returnTypeName)
             {
                 this.writer = writer;
 
                 conditional = "!defined(__WXMSW__) || defined(_DEBUG)";
 
+                // Expands to nothing unless ALTERNET_UI_PERFORMANCE_COUNTERS is defined.
+                writer.WriteLine($"ALTERNET_UI_PERF_EXPORT(\"{exportName}\");");
+
                 if (!UseMarshalExceptionsScope)
                     return;
 
@@ -231,7 +234,7 @@ namespace ApiGenerator.Native
             w.WriteLine("{");
             w.Indent++;
 
-            using (new MarshalExceptionsScope(w, returnTypeName))
+            using (new MarshalExceptionsScope(w, $"{declaringTypeName}_{methodName}_", returnTypeName))
             {
                 if (method.ReturnType != typeof(void))
                     w.Write("return ");
@@ -276,7 +279,7 @@ namespace ApiGenerator.Native
             w.WriteLine("{");
             w.Indent++;
 
-            using (new MarshalExceptionsScope(w, returnTypeName))
+            using (new MarshalExceptionsScope(w, $"{declaringTypeName}_Create_", returnTypeName))
                 w.WriteLine($"return new {declaringTypeName}();");
 
             w.Indent--;
@@ -309,7 +312,7 @@ namespace ApiGenerator.Native
             w.WriteLine("{");
             w.Indent++;
 
-            using (new MarshalExceptionsScope(w, "void"))
+            using (new MarshalExceptionsScope(w, $"{declaringTypeName}_Destroy_", "void"))
                 w.WriteLine("delete obj;");
 
             w.Indent--;
@@ -151,9 +151,13 @@ namespace ApiGenerator.Native
             w.WriteLine("public:");
             w.WriteLine();
 
+            // Expands to nothing unless ALTERNET_UI_PERFORMANCE_COUNTERS is defined.
+            var perfEvent = $"ALTERNET_UI_PERF_EVENT(\"{declTName}\", event);";
+
             w.WriteLine($"bool RaiseEvent({declTName}Event event, void* parameter = nullptr)");
             w.WriteLine("{" + Environment.NewLine +
                 "if (EventsSuspended()) return false;" + Environment.NewLine +
+                perfEvent + Environment.NewLine +
                 "if (eventCallback != nullptr)" + Environment.NewLine +
                 "   return eventCallback(this, event, parameter) != nullptr;" + Environment.NewLine +
                 "else" + Environment.NewLine +
@@ -164,6 +168,7 @@ namespace ApiGenerator.Native
             w.WriteLine(
                 $"static bool RaiseStaticEvent({declTName}Event event, void* parameter = nullptr)");
             w.WriteLine("{" + Environment.NewLine +
+                perfEvent + Environment.NewLine +
                 "if (eventCallback != nullptr)" + Environment.NewLine +
                 "   return eventCallback(nullptr, event, parameter) != nullptr;" + Environment.NewLine +
                 "else" + Environment.NewLine +
@@ -175,6 +180,7 @@ namespace ApiGenerator.Native
                 $"void* RaiseEventWithPointerResult({declTName}Event event, void* parameter = nullptr)");
             w.WriteLine("{" + Environment.NewLine +
                 "if (EventsSuspended()) return nullptr;" + Environment.NewLine +
+                perfEvent + Environment.NewLine +
                 "if (eventCallback != nullptr)" + Environment.NewLine +
                 "   return eventCallback(this, event, parameter);" + Environment.NewLine +
                 "else" + Environment.NewLine +
@@ -117,5 +117,24 @@ namespace NativeApi.Api
         public void SetUseBestVisual(bool flag, bool forceTrueColor = false) { }
 
         public NativeStringSpan GetCustomData(NativeStringSpan key) => default;
+
+        // Returns native performance counters as "Name=Value" lines. Per-export and
+        // event counters are present only if the native library was built with
+        // ALTERNET_UI_PERFORMANCE_COUNTERS defined.
+        public static NativeStringSpan GetPerformanceCounters() => default;
+
+        public static void ResetPerformanceCounters() { }
+
+        // Starts recording trace events, at most maxEvents are kept.
+        public static void StartPerformanceTrace(int maxEvents) { }
+
+        public static void StopPerformanceTrace() { }
+
+        // Returns recorded trace events in Chrome trace event format (chrome://tracing).
+        public static NativeStringSpan GetPerformanceTraceJson() => default;
+
+        // Durations of the native Application constructor phases in microseconds:
+        // image handler registration, wxEntryStart, CallOnInit, total.
+        public static void GetStartupTimings(long[] timings) { }
     }
 }
\ No newline at end of file
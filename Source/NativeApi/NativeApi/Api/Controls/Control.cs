@@ -218,5 +218,24 @@ namespace NativeApi.Api
 
         public int GetScrollBarEvtKind() => default;
         public int GetScrollBarEvtPosition() => default;
+
+        // Performs pending native window recreation of this control, if any.
+        public void FlushRecreate() { }
+
+        // Performs native window recreation of all controls with pending recreation.
+        public static void FlushPendingRecreations() { }
+
+        // Returns native window recreation counters as "ClassName=Count" lines.
+        public static NativeStringSpan GetRecreationStats() => default;
+        public static void ResetRecreationStats() { }
+
+        // Sets pool group used to reuse native window of this control after it is destroyed.
+        // Pooling is enabled for the group with SetWindowPoolCapacity.
+        public void SetWindowPoolGroup(NativeStringSpan value) { }
+        public static void SetWindowPoolCapacity(NativeStringSpan group, int capacity) { }
+
+        // Returns window pool counters as "Group: capacity=.. parked=.. hits=.." lines.
+        public static NativeStringSpan GetWindowPoolStats() => default;
+        public static void ClearWindowPool() { }
     }
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+﻿#pragma warning disable
+using ApiCommon;
+using System;
+
+namespace NativeApi.Api
+{
+    // Read-only viewer of large texts which draws only visible lines.
+    // Offsets are UTF-8 byte offsets in the text.
+    public class TextViewer : Control
+    {
+        public bool LoadFile(NativeStringSpan path) => default;
+        public void SetText(NativeStringSpan text) { }
+        public void AppendText(NativeStringSpan text) { }
+        public void ClearText() { }
+
+        public long GetLength() => default;
+        public long GetLineCount() => default;
+
+        // Line starts are found in the background, GetLineCount grows until
+        // indexing is finished.
+        public bool GetIsIndexing() => default;
+
+        public long GetLineStart(long line) => default;
+        public long GetLineFromOffset(long offset) => default;
+        public NativeStringSpan GetLineText(long line) => default;
+        public NativeStringSpan GetTextRange(long offset, long length) => default;
+
+        // Returns offset of the text or -1.
+        public long FindText(NativeStringSpan text, long start, bool matchCase) => default;
+
+        public void SetSelection(long start, long end) { }
+        public long GetSelectionStart() => default;
+        public long GetSelectionEnd() => default;
+        public void SelectAll() { }
+        public NativeStringSpan GetSelectedText() => default;
+        public bool CopySelection() => default;
+
+        public void ScrollToLine(long line) { }
+        public void ScrollToOffset(long offset) { }
+        public long GetFirstVisibleLine() => default;
+        public int GetVisibleLineCount() => default;
+    }
+}
\ No newline at end of file
@@ -224,5 +224,44 @@ namespace NativeApi.Api
         public RectI GetImageRect(IntPtr p, int item) => throw new Exception();
 
         public SizeI GetImageSize(IntPtr p, int item) => throw new Exception();
+
+        // Creates and appends properties described by packed records of 8 longs:
+        // kind, parent record index (-1 for root), flags, choices handle,
+        // value, label, name and string value indices in strings.
+        // Strings are separated with '\0'. Property handles are written to
+        // results. Returns the number of processed records.
+        public int AppendProperties(long[] schema, NativeStringSpan strings, long[] results)
+            => throw new Exception();
+
+        // Sets values from packed records of 4 longs: property handle, value kind,
+        // value and string index in strings. Returns the number of values set.
+        public int SetPropertyValues(long[] values, NativeStringSpan strings)
+            => throw new Exception();
+
+        // Same as SetPropertyValues, but skips values which are equal to the
+        // current ones. The grid is not repainted if nothing has changed.
+        public int ApplyPropertyValues(long[] values, NativeStringSpan strings)
+            => throw new Exception();
+
+        // Writes values of all properties in the SetPropertyValues format.
+        // Values without a value kind are written as text, strings are
+        // returned by GetPropertyValuesText. Returns the number of records.
+        public int GetPropertyValues(long[] values) => throw new Exception();
+
+        public NativeStringSpan GetPropertyValuesText() => throw new Exception();
+
+        // Inline values are 3 longs: value kind, value and color kind for system
+        // colors. Text is returned or passed as string. Values of kind Complex
+        // have no inline form and are read with GetPropertyValueAsVariant.
+        public NativeStringSpan GetEventPropValueInline(long[] value) => throw new Exception();
+
+        public NativeStringSpan GetPropertyValueInline(IntPtr id, long[] value)
+            => throw new Exception();
+
+        public void SetPropertyValueInline(IntPtr id, long[] value, NativeStringSpan text)
+            => throw new Exception();
+
+        public bool ChangePropertyValueInline(IntPtr id, long[] value, NativeStringSpan text)
+            => throw new Exception();
     }
 }
\ No newline at end of file
@@ -47,5 +47,10 @@ namespace NativeApi.Api
         public static void SetString(IntPtr handle, NativeStringSpan value) => throw new Exception();
 
         public static uint GetLastColorKind() => default;
+
+        // Reads or writes the value as an inline value of 3 longs: value kind,
+        // value and color kind. Text values are returned or passed as string.
+        public static NativeStringSpan GetInline(IntPtr handle, long[] value) => default;
+        public static void SetInline(IntPtr handle, long[] value, NativeStringSpan text) { }
     }
 }
\ No newline at end of file
@@ -30,6 +30,8 @@ namespace NativeApi.Api
 
         public event EventHandler? TextEnter;
         public event EventHandler? TextUrl;
+        public event EventHandler? LoadProgress;
+        public event EventHandler? LoadCompleted;
 
         public NativeStringSpan GetRange(long from, long to) => default;
 
@@ -993,6 +995,55 @@ namespace NativeApi.Api
         // Returns the new caret position in @e newPos, or leaves it if there
         // was no action. This is undoable.
         public long DeleteSelectedContent() => default;
+
+        // Copies the text attribute to the table of styles used by ApplyStyleRuns
+        // and returns its id. Equal attributes get the same id.
+        public int RegisterStyle(IntPtr style) => default;
+
+        public void ClearRegisteredStyles() { }
+
+        // Applies styles to the text in one call. Runs contain
+        // (start, end, styleId) triples.
+        public void ApplyStyleRuns(long[] runs) { }
+
+        // Returns id of the style at the position in the pool of text attributes,
+        // or -1. Use TextBoxTextAttr.GetPooledAttr to get the attribute.
+        public int GetStyleId(long position) => default;
+
+        public int GetStyleIdForRange(long startRange, long endRange) => default;
+        public int GetStyleIdInContainer(long position, IntPtr container) => default;
+        public int GetStyleIdForRangeInContainer(long startRange, long endRange, IntPtr container) => default;
+
+        // Options: 1 - match case, 2 - whole word, 4 - regular expression.
+        // Returns false if the regular expression is not valid.
+        public bool SetSearchPattern(NativeStringSpan pattern, int options) => default;
+
+        // Finds matches starting from the position and writes (position, length)
+        // pairs to results. Returns the number of matches. When results are full
+        // or the time budget in milliseconds is over, GetSearchCursor returns the
+        // position to continue from, otherwise -1.
+        public int FindMatches(long start, long[] results, int timeBudgetMs) => default;
+
+        public long GetSearchCursor() => default;
+
+        // Starts loading the document in a background thread. The stream is
+        // read into memory during the call, parsing is done in the background.
+        // LoadProgress is raised while loading, LoadCompleted when the loaded
+        // document is shown or loading has failed or was cancelled.
+        // Returns false if there is no handler for the type or another
+        // document is being loaded.
+        public bool BeginLoadFromStream(InputStream stream, int type) => default;
+
+        public bool BeginLoadFile(NativeStringSpan file, int type) => default;
+
+        public bool IsLoading() => default;
+
+        // Returns loaded percent or -1 if the length of the source is unknown.
+        public int GetLoadProgress() => default;
+
+        public bool GetLoadResult() => default;
+
+        public void CancelLoad() { }
     }
 }
 
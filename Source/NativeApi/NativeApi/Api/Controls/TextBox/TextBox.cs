@@ -116,5 +116,38 @@ namespace NativeApi.Api
         public bool AutoUrl { get; set; }
 
         public bool HideVertScrollbar { get; set; }
+
+        // Copies the text attribute to the table of styles used by ApplyStyleRuns
+        // and returns its id. Equal attributes get the same id.
+        public int RegisterStyle(IntPtr style) => default;
+
+        public void ClearRegisteredStyles() { }
+
+        // Applies styles to the text in one call. Runs contain
+        // (start, end, styleId) triples.
+        public void ApplyStyleRuns(long[] runs) { }
+
+        // In log mode AppendText collects the text and inserts it on idle in
+        // one call. The view follows the appended text only when the caret is
+        // at the end. Lines are removed from the top when limits are exceeded,
+        // zero means no limit.
+        public bool GetLogMode() => default;
+        public void SetLogMode(bool value) { }
+        public void SetLogLimits(int maxLines, long maxLength) { }
+
+        // Inserts the pending log text now.
+        public void FlushLog() { }
+
+        // Options: 1 - match case, 2 - whole word, 4 - regular expression.
+        // Returns false if the regular expression is not valid.
+        public bool SetSearchPattern(NativeStringSpan pattern, int options) => default;
+
+        // Finds matches starting from the position and writes (position, length)
+        // pairs to results. Returns the number of matches. When results are full
+        // or the time budget in milliseconds is over, GetSearchCursor returns the
+        // position to continue from, otherwise -1.
+        public int FindMatches(long start, long[] results, int timeBudgetMs) => default;
+
+        public long GetSearchCursor() => default;
     }
 }
\ No newline at end of file
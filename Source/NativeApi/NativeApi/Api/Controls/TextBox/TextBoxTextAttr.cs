@@ -143,5 +143,17 @@ namespace NativeApi.Api
         public static void RemoveFlag(IntPtr attr, long flag) { }
         public static void AddFlag(IntPtr attr, long flag) { }
 
+        // Pooled attributes are immutable and owned by the pool, don't delete them.
+        // After ClearAttrPool old ids are not found and pointers returned by
+        // GetPooledAttr must not be used.
+        public static int InternAttr(IntPtr attr) => default;
+        public static IntPtr GetPooledAttr(int id) => default;
+        public static int GetPooledAttrCount() => default;
+        public static void ClearAttrPool() { }
+
+        // Reads the attribute into the buffer with TextAttrPacked layout (96 bytes).
+        public static bool ReadPacked(IntPtr attr, IntPtr buffer, int bufferSize) => default;
+        public static bool ReadPackedPooledAttr(int id, IntPtr buffer, int bufferSize) => default;
+
     }
 }
\ No newline at end of file
@@ -132,5 +132,18 @@ namespace NativeApi.Api
         public event NativeEventHandler<WebBrowserEventData>? ScriptMessageReceived;
         public event NativeEventHandler<WebBrowserEventData>? ScriptResult;
         public event NativeEventHandler<WebBrowserEventData>? BeforeBrowserCreate; 
+        public event NativeEventHandler<WebBrowserEventData>? ScriptBatchResult;
+        public event NativeEventHandler<WebBrowserEventData>? ScriptMessageBatch;
+
+        // Queues the script and returns its id. Queued scripts are sent to the
+        // page as one script once per frame or on FlushScripts. Results come in
+        // ScriptBatchResult as a JSON array of [id, isError, text] items.
+        public long QueueScript(NativeStringSpan javascript) => default;
+        public void FlushScripts() { }
+
+        // When set, script messages are raised once per frame in
+        // ScriptMessageBatch as a JSON array of [handler, text] items.
+        public void SetScriptMessageBatching(bool value) { }
+        public bool GetScriptMessageBatching() => default;
     }
 }
@@ -0,0 +1,38 @@
+﻿#pragma warning disable
+using NativeApi.Api.ManagedServers;
+using System;
+using Alternet.Drawing;
+
+namespace NativeApi.Api
+{
+    // Frames of animated GIF and APNG images, composed on demand and cached.
+    public class AnimationDecoder
+    {
+        // Memory used by composed frames kept for the next loop, in bytes.
+        public long CacheLimit { get; set; }
+
+        public bool LoadFile(NativeStringSpan path) => default;
+
+        public bool LoadStream(InputStream stream) => default;
+
+        public void Close() { }
+
+        public bool IsOk() => default;
+
+        public int GetFrameCount() => default;
+
+        public SizeI GetSize() => default;
+
+        // Delay of the frame in milliseconds.
+        public int GetFrameDelay(int index) => default;
+
+        public Image GetFrame(int index) => throw new Exception();
+
+        // Copy of the composed frame as a generic image.
+        public IntPtr GetFrameImage(int index) => default;
+
+        public long GetCachedBytes() => default;
+
+        public void ClearCache() { }
+    }
+}
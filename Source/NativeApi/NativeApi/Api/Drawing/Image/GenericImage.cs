@@ -383,5 +383,48 @@ namespace NativeApi.Api
 
         public static void UnlockBits(IntPtr handle) { }
 
+        // Decodes images on worker threads. Returns the request id.
+        public static long DecodeFileAsync(NativeStringSpan path, int bitmapType, int index)
+            => default;
+
+        public static long DecodeMemoryAsync(byte[] data, int bitmapType, int index) => default;
+
+        public static bool CancelDecode(long id) => default;
+
+        // Writes (id, image handle, status) for finished requests and returns
+        // their count. Status: 0 - done, 1 - failed, 2 - cancelled.
+        public static int PollDecoded(long[] results) => default;
+
+        // 0 uses the number of processors.
+        public static void SetDecodeThreadCount(int value) { }
+
+        public static int GetDecodeThreadCount() => default;
+
+        public static int GetDecodePendingCount() => default;
+
+        // Loads the image reduced to fit width x height, keeping the aspect ratio.
+        // JPEG images are decoded at a reduced scale or replaced with the EXIF
+        // thumbnail when it is large enough.
+        public static IntPtr CreateThumbnailFromFile(NativeStringSpan path, int width, int height)
+            => default;
+
+        public static IntPtr CreateThumbnailFromMemory(byte[] data, int width, int height)
+            => default;
+
+        // Same as CreateThumbnailFromFile, but runs on the decode threads.
+        public static long DecodeThumbnailAsync(NativeStringSpan path, int width, int height)
+            => default;
+
+        // Limits the registered image handlers to the given bitmap types, all
+        // are registered when the array is empty. Handlers are created on first use.
+        public static void SetEnabledImageTypes(int[] bitmapTypes) { }
+
+        // Returns null when the file is not an uncompressed BMP, PNM or TIFF.
+        public static IntPtr CreateImageFromMappedFile(NativeStringSpan path) => default;
+
+        // Saves an image with encoding presets, see Image.SaveStreamWithPreset.
+        public static bool SaveStreamWithPreset(IntPtr handle, OutputStream stream, int bitmapType,
+            int preset, int quality, int compressionLevel, int filter, int threadCount) => default;
+
     }
 }
\ No newline at end of file
@@ -11,5 +11,8 @@ namespace NativeApi.Api
         public void LoadFromStream(InputStream stream) { }
         public void Clear() { }
         public bool IsOk() => default;
+
+        // Adds icons of the standard sizes for the scale of the main display.
+        public void AddImageBundle(ImageBundle bundle) { }
     }
 }
\ No newline at end of file
@@ -123,5 +123,34 @@ namespace NativeApi.Api
         public int GetStride() => default;
 
         public void UnlockBits() { }
+
+        // Controls which show this image take the bitmap for their DPI scale
+        // from the bundle. Null restores the single bitmap.
+        public void SetBundle(ImageBundle? bundle) { }
+
+        // Preset is 0 (handler defaults), 1 (fastest), 2 (balanced) or
+        // 3 (smallest); other arguments override the preset when not negative.
+        // PNG images are deflated on threadCount threads, 0 uses all processors.
+        public bool SaveStreamWithPreset(OutputStream stream, int bitmapType, int preset,
+            int quality, int compressionLevel, int filter, int threadCount) => default;
+
+        public bool SaveFileWithPreset(NativeStringSpan fileName, int bitmapType, int preset,
+            int quality, int compressionLevel, int filter, int threadCount) => default;
+
+        // Scratch bitmap from the native pool, its contents are not cleared.
+        public static Image CreatePooled(int width, int height, int depth, double scaleFactor)
+            => throw new Exception();
+
+        // Gives the bitmap back to the pool and leaves the image empty. The
+        // bitmap is kept only when nothing else references it.
+        public void ReturnToPool() { }
+
+        public static void SetBitmapPoolLimit(long value) { }
+
+        public static long GetBitmapPoolLimit() => default;
+
+        public static long GetBitmapPoolBytes() => default;
+
+        public static void ClearBitmapPool() { }
     }
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+﻿#pragma warning disable
+using NativeApi.Api.ManagedServers;
+using System;
+using Alternet.Drawing;
+
+namespace NativeApi.Api
+{
+    // Several resolutions of one image. Bitmaps for other DPI scales are made
+    // from the SVG source or the nearest larger image and cached.
+    // https://docs.wxwidgets.org/3.2/classwx_bitmap_bundle.html
+    public class ImageBundle
+    {
+        public void AddImage(Image image) { }
+
+        public bool LoadSvgFromString(NativeStringSpan s, int width, int height, Color color)
+            => default;
+
+        public void Clear() { }
+
+        public bool IsOk() => default;
+
+        public Image GetImage(double scale) => throw new Exception();
+
+        public Image GetImageForControl(Control control) => throw new Exception();
+
+        // Number of generated bitmaps kept by the bundle.
+        public int GetCachedCount() => default;
+
+        public void ClearCache() { }
+    }
+}
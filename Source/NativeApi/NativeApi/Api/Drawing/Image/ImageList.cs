@@ -23,5 +23,14 @@ namespace NativeApi.Api
 
         // Remove all images
         public bool Clear() => default;
+
+        // When true, images are also kept in a single atlas bitmap which
+        // is used by Draw.
+        public bool UseAtlas { get; set; }
+
+        // Adds images by their native handles, returns index of the first one.
+        public int AddImages(long[] images) => default;
+
+        public void Draw(DrawingContext dc, int index, int x, int y) { }
     }
 }
\ No newline at end of file
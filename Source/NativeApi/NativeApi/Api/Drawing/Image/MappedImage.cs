@@ -0,0 +1,27 @@
+﻿#pragma warning disable
+using NativeApi.Api.ManagedServers;
+using System;
+using Alternet.Drawing;
+
+namespace NativeApi.Api
+{
+    // Uncompressed BMP, PNM and TIFF image read from a memory-mapped file.
+    // Regions are converted without reading the rest of the image.
+    public class MappedImage
+    {
+        public bool Open(NativeStringSpan path) => default;
+
+        public void Close() { }
+
+        public bool IsOk() => default;
+
+        public int GetWidth() => default;
+
+        public int GetHeight() => default;
+
+        public IntPtr ReadImage() => default;
+
+        // Region is clipped to the image, null is returned when it is empty.
+        public IntPtr ReadRegion(int x, int y, int width, int height) => default;
+    }
+}
@@ -13,6 +13,7 @@ namespace NativeApi.Api
         public static DrawingContext CreateMemoryDCFromImage(Image image) => default;
 
         public bool IsOk { get; }
+        // IntPtr.Zero for headless contexts, they have no wxDC.
         public IntPtr WxWidgetDC { get; }
         public IntPtr GetHandle() => default; 
 
@@ -113,5 +114,21 @@ namespace NativeApi.Api
             => throw new Exception();
 
         public InterpolationMode InterpolationMode { get; set; }
+
+        // Creates context which draws into the image using the Cairo renderer
+        // (or the default renderer if Cairo is not available) without a display,
+        // a window or a wxDC. Image is updated on Flush() and when context is disposed.
+        public static DrawingContext CreateHeadless(GenericImage target) => default;
+
+        public void Flush() { }
+
+        // Batch drawing. Rects contain (x, y, width, height) quadruples.
+        public void FillRectangles(Brush brush, float[] rects) { }
+
+        // Points contain (x1, y1, x2, y2) quadruples, one for each separate line.
+        public void DrawLineSegments(Pen pen, float[] points) { }
+
+        // Points contain (x, y) pairs of the polyline.
+        public void DrawLines(Pen pen, float[] points) { }
     }
 }
\ No newline at end of file
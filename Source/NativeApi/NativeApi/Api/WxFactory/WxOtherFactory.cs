@@ -401,6 +401,31 @@ namespace NativeApi.Api
 
         public static NativeStringSpan RendererGetVersion(IntPtr renderer) => default;
 
+        // Draws theme parts described by packed records of 9 longs into dc:
+        // part, x, y, width, height, flags, value, extra and text index in strings.
+        // Value is the sort arrow of header buttons, the value of gauges and the
+        // alignment of item texts; extra is the maximum of gauges and the ellipsize
+        // mode of item texts. Parts: 0 check box, 1 check mark, 2 radio bitmap,
+        // 3 push button, 4 header button, 5 header button contents, 6 tree item
+        // button, 7 combobox drop button, 8 drop arrow, 9 collapse button,
+        // 10 item selection rect, 11 focus rect, 12 choice, 13 combobox,
+        // 14 text control, 15 splitter border, 16 gauge, 17 item text.
+        // Strings are separated with '\0'. With useCache small stateless parts
+        // are blitted from pre-rendered bitmaps. Returns the number of drawn records.
+        public static int RendererDrawBatch(IntPtr renderer, IntPtr win,
+            Image dc,
+            long[] records,
+            NativeStringSpan strings,
+            bool useCache) => default;
+
+        public static void RendererSetPartCacheLimit(long value) { }
+
+        public static long RendererGetPartCacheLimit() => default;
+
+        public static long RendererGetPartCacheBytes() => default;
+
+        public static void RendererClearPartCache() { }
+
         // ===================
 
         /*